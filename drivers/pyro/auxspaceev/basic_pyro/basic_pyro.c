@@ -9,6 +9,14 @@
  *   - Cap-V ADC  : measures capacitor voltage (0-9 V range).
  *   - Sense ADC  : measures pyro resistance for health check.
  *
+ * Background sampling (CONFIG_BASIC_PYRO_SAMPLE) converts every ADC
+ * channel periodically on the system work queue into a cached,
+ * timestamped per-channel status.
+ *
+ * Timed fires (CONFIG_BASIC_PYRO_TIMED_FIRE) drive the trigger GPIO from
+ * a counter alarm ISR ("fire-counter") or a kernel timer ISR and record
+ * command and fire times for latency measurement.
+ *
  * Copyright (c) 2019 Thomas Schmid <tom@lfence.de>
  * Copyright (c) 2026 Auxspace e.V.
  *
@@ -23,6 +31,9 @@
 #include <zephyr/kernel.h>
 #include <zephyr/sys/byteorder.h>
 #include <zephyr/drivers/sensor.h>
+#if defined(CONFIG_BASIC_PYRO_TIMED_FIRE) && defined(CONFIG_COUNTER)
+#include <zephyr/drivers/counter.h>
+#endif /* CONFIG_BASIC_PYRO_TIMED_FIRE && CONFIG_COUNTER */
 
 #include <aurora/drivers/pyro.h>
 #include "basic_pyro.h"
@@ -31,11 +42,312 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(basic_pyro);
 
+/* Convert one sample of @p spec to millivolts. Blocks for the conversion. */
+static int adc_read_mv(const struct adc_dt_spec *spec, uint32_t *val)
+{
+	int16_t buf;
+	int ret;
+
+	struct adc_sequence seq = {
+		.buffer = &buf,
+		.buffer_size = sizeof(buf),
+	};
+
+	adc_sequence_init_dt(spec, &seq);
+
+	ret = adc_read_dt(spec, &seq);
+	if (ret < 0) {
+		return ret;
+	}
+
+	int32_t mv = (int32_t)buf;
+
+	ret = adc_raw_to_millivolts_dt(spec, &mv);
+	if (ret < 0) {
+		return ret;
+	}
+
+	*val = (uint32_t)mv;
+
+	return 0;
+}
+
+#if defined(CONFIG_BASIC_PYRO_SAMPLE)
+/* A cached sample older than this is stale. */
+#define SAMPLE_MAX_AGE_NS							\
+	(2ULL * CONFIG_BASIC_PYRO_SAMPLE_PERIOD_MS * NSEC_PER_MSEC)
+
+/**
+ * @brief Copy a fresh cached reading of @p channel.
+ *
+ * @param flag PYRO_STATUS_CAP_VALID or PYRO_STATUS_SENSE_VALID.
+ * @return true if @p val was set, false if there is no fresh sample.
+ */
+static bool sample_fresh(const struct device *dev, uint32_t channel,
+			 uint8_t flag, uint32_t *val)
+{
+	struct pyro_data *data = dev->data;
+	struct basic_pyro_sampler *s = &data->sampler;
+	const struct pyro_channel_status *st = &s->status[channel];
+	k_spinlock_key_t key = k_spin_lock(&s->lock);
+	/* Clock read under the lock: no sample newer than "now" is visible. */
+	const bool fresh = (st->flags & flag) &&
+			   pyro_fire_now_ns() - st->timestamp_ns <= SAMPLE_MAX_AGE_NS;
+
+	if (fresh) {
+		*val = flag == PYRO_STATUS_CAP_VALID ? st->cap_mv : st->sense_mv;
+	}
+	k_spin_unlock(&s->lock, key);
+
+	return fresh;
+}
+
+/**
+ * @brief One background sampling pass over every channel.
+ *
+ * Runs on the system work queue and reschedules itself. A shared
+ * capacitor is converted once and reported on every channel. A failed
+ * conversion clears that reading's valid flag until the next pass.
+ */
+static void sample_work_fn(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct basic_pyro_sampler *s =
+		CONTAINER_OF(dwork, struct basic_pyro_sampler, work);
+	const struct pyro_config *config = s->dev->config;
+	uint32_t cap_mv = 0;
+	bool cap_ok = false;
+
+	for (uint32_t i = 0; i < config->n_channels; i++) {
+		struct pyro_channel_status st = { 0 };
+
+		if (config->capv != NULL) {
+			if (!config->single_cap || i == 0) {
+				cap_ok = adc_read_mv(&config->capv[i], &cap_mv) == 0;
+			}
+			if (cap_ok) {
+				st.cap_mv = cap_mv;
+				st.flags |= PYRO_STATUS_CAP_VALID;
+			}
+		}
+		if (config->senses != NULL &&
+		    adc_read_mv(&config->senses[i], &st.sense_mv) == 0) {
+			st.flags |= PYRO_STATUS_SENSE_VALID;
+		}
+		st.timestamp_ns = pyro_fire_now_ns();
+
+		k_spinlock_key_t key = k_spin_lock(&s->lock);
+
+		s->status[i] = st;
+		k_spin_unlock(&s->lock, key);
+	}
+
+	k_work_schedule(dwork, K_MSEC(CONFIG_BASIC_PYRO_SAMPLE_PERIOD_MS));
+}
+
+/* Start background sampling, if the instance has any ADC channel. */
+static void sample_init(const struct device *dev)
+{
+	const struct pyro_config *config = dev->config;
+	struct pyro_data *data = dev->data;
+	struct basic_pyro_sampler *s = &data->sampler;
+
+	s->dev = dev;
+	k_work_init_delayable(&s->work, sample_work_fn);
+
+	if (config->capv != NULL || config->senses != NULL) {
+		k_work_schedule(&s->work, K_NO_WAIT);
+	}
+}
+#endif /* CONFIG_BASIC_PYRO_SAMPLE */
+
+#if defined(CONFIG_BASIC_PYRO_TIMED_FIRE)
+/* Release the counter alarm of @p f, if it holds one. fire_lock held. */
+static void fire_release_alarm_locked(struct basic_pyro_fire *f)
+{
+	struct pyro_data *data = f->dev->data;
+
+	if (f->alarm >= 0) {
+		data->alarm_busy &= ~BIT(f->alarm);
+		f->alarm = -1;
+	}
+}
+
+/**
+ * @brief Drive the trigger GPIO of a pending fire.
+ *
+ * Runs with fire_lock held, from the timer ISRs or, for a zero delay,
+ * from pyro_fire_at() itself. Drops the fire if the channel has been
+ * disarmed since it was scheduled.
+ */
+static int fire_locked(struct basic_pyro_fire *f)
+{
+	const struct pyro_config *config = f->dev->config;
+	struct pyro_data *data = f->dev->data;
+
+	if (f->state != BASIC_PYRO_FIRE_PENDING) {
+		return 0;
+	}
+
+	if (!(data->arm_flags & BIT(f->channel))) {
+		fire_release_alarm_locked(f);
+		f->state = BASIC_PYRO_FIRE_NONE;
+		return -EACCES;
+	}
+
+	int ret = gpio_pin_set_dt(&config->trigger_gpios[f->channel], 1);
+
+	f->timing.fire_ns = pyro_fire_now_ns();
+	fire_release_alarm_locked(f);
+	if (ret < 0) {
+		f->state = BASIC_PYRO_FIRE_NONE;
+		return ret;
+	}
+
+	atomic_or(&data->trigger_flags, BIT(f->channel));
+	f->state = BASIC_PYRO_FIRE_DONE;
+
+	return 0;
+}
+
+static void fire_isr(struct basic_pyro_fire *f)
+{
+	struct pyro_data *data = f->dev->data;
+	k_spinlock_key_t key = k_spin_lock(&data->fire_lock);
+
+	(void)fire_locked(f);
+	k_spin_unlock(&data->fire_lock, key);
+}
+
+static void fire_timer_cb(struct k_timer *timer)
+{
+	fire_isr(k_timer_user_data_get(timer));
+}
+
+#if defined(CONFIG_COUNTER)
+static void fire_alarm_cb(const struct device *counter, uint8_t chan_id,
+			  uint32_t ticks, void *user_data)
+{
+	ARG_UNUSED(counter);
+	ARG_UNUSED(chan_id);
+	ARG_UNUSED(ticks);
+
+	fire_isr(user_data);
+}
+#endif /* CONFIG_COUNTER */
+
+/**
+ * @brief Start the timer of a pending fire.
+ *
+ * Takes a free alarm of the fire counter when there is one, else the
+ * channel's kernel timer. fire_lock held.
+ */
+static void fire_schedule_locked(struct basic_pyro_fire *f, uint32_t delay_us)
+{
+#if defined(CONFIG_COUNTER)
+	const struct pyro_config *config = f->dev->config;
+	struct pyro_data *data = f->dev->data;
+
+	if (config->fire_counter != NULL) {
+		const uint8_t n = MIN(counter_get_num_of_channels(config->fire_counter), 32);
+		struct counter_alarm_cfg alarm = {
+			.callback = fire_alarm_cb,
+			.ticks = MAX(counter_us_to_ticks(config->fire_counter, delay_us), 1U),
+			.user_data = f,
+		};
+
+		for (uint8_t a = 0; a < n; a++) {
+			if (data->alarm_busy & BIT(a)) {
+				continue;
+			}
+			/* Rejected (e.g. beyond the counter range): use the timer. */
+			if (counter_set_channel_alarm(config->fire_counter, a, &alarm) == 0) {
+				data->alarm_busy |= BIT(a);
+				f->alarm = a;
+				return;
+			}
+			break;
+		}
+	}
+#endif /* CONFIG_COUNTER */
+
+	f->alarm = -1;
+	k_timer_start(&f->timer, K_USEC(delay_us), K_NO_WAIT);
+}
+
+/**
+ * @brief Cancel a pending fire on @p channel and clear its arm flag.
+ *
+ * Both happen in one fire_lock section, so a pyro_fire_at() racing the
+ * disarm either is cancelled here or finds the channel disarmed. Safe
+ * against a racing ISR.
+ */
+static void fire_disarm(const struct device *dev, uint32_t channel)
+{
+	struct pyro_data *data = dev->data;
+	struct basic_pyro_fire *f = &data->fire[channel];
+	k_spinlock_key_t key = k_spin_lock(&data->fire_lock);
+	const bool pending = f->state == BASIC_PYRO_FIRE_PENDING;
+
+	data->arm_flags &= ~BIT(channel);
+
+	if (pending) {
+#if defined(CONFIG_COUNTER)
+		const struct pyro_config *config = dev->config;
+
+		if (f->alarm >= 0) {
+			(void)counter_cancel_channel_alarm(config->fire_counter, f->alarm);
+		}
+#endif /* CONFIG_COUNTER */
+		k_timer_stop(&f->timer);
+		fire_release_alarm_locked(f);
+		f->state = BASIC_PYRO_FIRE_NONE;
+	}
+	k_spin_unlock(&data->fire_lock, key);
+
+	if (pending) {
+		LOG_INF("channel %u: pending fire cancelled", channel);
+	}
+}
+
+static int fire_init(const struct device *dev)
+{
+	const struct pyro_config *config = dev->config;
+	struct pyro_data *data = dev->data;
+
+	for (uint32_t i = 0; i < config->n_channels; i++) {
+		struct basic_pyro_fire *f = &data->fire[i];
+
+		f->dev = dev;
+		f->channel = i;
+		f->alarm = -1;
+		k_timer_init(&f->timer, fire_timer_cb, NULL);
+		k_timer_user_data_set(&f->timer, f);
+	}
+
+#if defined(CONFIG_COUNTER)
+	if (config->fire_counter != NULL) {
+		int ret = device_is_ready(config->fire_counter) ?
+			  counter_start(config->fire_counter) : -ENODEV;
+
+		/* -EALREADY: running already, which is fine. */
+		if (ret < 0 && ret != -EALREADY) {
+			LOG_WRN("fire counter unavailable (%d), using kernel timer", ret);
+			data->alarm_busy = UINT32_MAX;
+		}
+	}
+#endif /* CONFIG_COUNTER */
+
+	return 0;
+}
+#endif /* CONFIG_BASIC_PYRO_TIMED_FIRE */
+
 /**
  * @brief Initialize the basic pyro driver instance.
  *
  * Configures trigger, arm, and (optional) short GPIOs as output-inactive.
- * Sets up ADC channels for cap-voltage and sense readings if present.
+ * Sets up ADC channels for cap-voltage and sense readings if present
+ * and starts their background sampling.
  *
  * @param dev Pyro device instance.
  * @return 0 on success, negative errno on failure.
@@ -143,7 +455,15 @@ static int auxspaceev_basic_pyro_init(const struct device *dev)
 		}
 	}
 
+#if defined(CONFIG_BASIC_PYRO_SAMPLE)
+	sample_init(dev);
+#endif /* CONFIG_BASIC_PYRO_SAMPLE */
+
+#if defined(CONFIG_BASIC_PYRO_TIMED_FIRE)
+	return fire_init(dev);
+#else
 	return 0;
+#endif /* CONFIG_BASIC_PYRO_TIMED_FIRE */
 }
 
 /**
@@ -180,7 +500,14 @@ static int auxspaceev_basic_pyro_arm_channel(const struct device *dev,
 		return ret;
 	}
 
+#if defined(CONFIG_BASIC_PYRO_TIMED_FIRE)
+	k_spinlock_key_t key = k_spin_lock(&data->fire_lock);
+
 	data->arm_flags |= BIT(channel);
+	k_spin_unlock(&data->fire_lock, key);
+#else
+	data->arm_flags |= BIT(channel);
+#endif /* CONFIG_BASIC_PYRO_TIMED_FIRE */
 
 	return 0;
 }
@@ -196,7 +523,12 @@ static int auxspaceev_basic_pyro_disarm_channel(const struct device *dev,
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_BASIC_PYRO_TIMED_FIRE)
+	/* A disarmed capacitor must never be dumped into the pyro. */
+	fire_disarm(dev, channel);
+#else
 	data->arm_flags &= ~BIT(channel);
+#endif /* CONFIG_BASIC_PYRO_TIMED_FIRE */
 
 	/*
 	 * In single_arm mode, only deassert the shared arm GPIO
@@ -232,12 +564,17 @@ static int auxspaceev_basic_pyro_secure_channel(const struct device *dev,
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_BASIC_PYRO_TIMED_FIRE)
+	/* Disarm before the trigger goes low, so no new fire can follow. */
+	fire_disarm(dev, channel);
+#endif /* CONFIG_BASIC_PYRO_TIMED_FIRE */
+
 	/* Deassert trigger first */
 	ret = gpio_pin_set_dt(&config->trigger_gpios[channel], 0);
 	if (ret < 0) {
 		return ret;
 	}
-	data->trigger_flags &= ~BIT(channel);
+	atomic_and(&data->trigger_flags, ~BIT(channel));
 
 	/* Deassert cap charge GPIO if present */
 	if (config->cap_gpios != NULL &&
@@ -288,7 +625,7 @@ static int auxspaceev_basic_pyro_trigger_channel(const struct device *dev,
 		return ret;
 	}
 
-	data->trigger_flags |= BIT(channel);
+	atomic_or(&data->trigger_flags, BIT(channel));
 
 	return 0;
 }
@@ -328,14 +665,13 @@ static int auxspaceev_basic_pyro_charge_channel(const struct device *dev,
  * @brief Read a pyro channel's continuity sense value (pyro health).
  *
  * Measures pyro resistance via the sense ADC. The returned value is
- * the raw ADC millivolt reading.
+ * the raw ADC millivolt reading, from the background sample while it
+ * is fresh.
  */
 static int auxspaceev_basic_pyro_sense_channel(const struct device *dev,
 					      uint32_t channel, uint32_t *val)
 {
 	const struct pyro_config *config = dev->config;
-	int16_t buf;
-	int ret;
 
 	if (channel >= config->n_channels) {
 		return -EINVAL;
@@ -345,76 +681,162 @@ static int auxspaceev_basic_pyro_sense_channel(const struct device *dev,
 		return -ENOTSUP;
 	}
 
-	struct adc_sequence seq = {
-		.buffer = &buf,
-		.buffer_size = sizeof(buf),
-	};
+#if defined(CONFIG_BASIC_PYRO_SAMPLE)
+	if (sample_fresh(dev, channel, PYRO_STATUS_SENSE_VALID, val)) {
+		return 0;
+	}
+#endif /* CONFIG_BASIC_PYRO_SAMPLE */
 
-	adc_sequence_init_dt(&config->senses[channel], &seq);
+	return adc_read_mv(&config->senses[channel], val);
+}
 
-	ret = adc_read_dt(&config->senses[channel], &seq);
-	if (ret < 0) {
-		return ret;
+/**
+ * @brief Read a pyro channel's capacitor voltage.
+ *
+ * Measures the capacitor voltage via the cap-V ADC, or returns the
+ * background sample while it is fresh. The returned value is in
+ * millivolts.
+ */
+static int auxspaceev_basic_pyro_read_cap_channel(const struct device *dev,
+						 uint32_t channel,
+						 uint32_t *val)
+{
+	const struct pyro_config *config = dev->config;
+
+	if (channel >= config->n_channels) {
+		return -EINVAL;
 	}
 
-	int32_t mv = (int32_t)buf;
+	if (config->capv == NULL) {
+		return -ENOTSUP;
+	}
 
-	ret = adc_raw_to_millivolts_dt(&config->senses[channel], &mv);
-	if (ret < 0) {
-		return ret;
+#if defined(CONFIG_BASIC_PYRO_SAMPLE)
+	if (sample_fresh(dev, channel, PYRO_STATUS_CAP_VALID, val)) {
+		return 0;
 	}
+#endif /* CONFIG_BASIC_PYRO_SAMPLE */
 
-	*val = (uint32_t)mv;
+	return adc_read_mv(&config->capv[config->single_cap ? 0 : channel], val);
+}
+
+#if defined(CONFIG_BASIC_PYRO_SAMPLE)
+/**
+ * @brief Read the cached status of a channel.
+ *
+ * The ADC readings come from the last sampling pass; the arm and
+ * trigger flags are taken now.
+ */
+static int auxspaceev_basic_pyro_get_status(const struct device *dev,
+					    uint32_t channel,
+					    struct pyro_channel_status *status)
+{
+	const struct pyro_config *config = dev->config;
+	struct pyro_data *data = dev->data;
+	struct basic_pyro_sampler *s = &data->sampler;
+
+	if (channel >= config->n_channels) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&s->lock);
+
+	*status = s->status[channel];
+	k_spin_unlock(&s->lock, key);
+
+	if (data->arm_flags & BIT(channel)) {
+		status->flags |= PYRO_STATUS_ARMED;
+	}
+	if (atomic_test_bit(&data->trigger_flags, channel)) {
+		status->flags |= PYRO_STATUS_TRIGGERED;
+	}
 
 	return 0;
 }
+#endif /* CONFIG_BASIC_PYRO_SAMPLE */
 
+#if defined(CONFIG_BASIC_PYRO_TIMED_FIRE)
 /**
- * @brief Read a pyro channel's capacitor voltage.
+ * @brief Schedule the trigger of an armed channel from a timer ISR.
  *
- * Measures the capacitor voltage via the cap-V ADC. The returned
- * value is in millivolts.
+ * The command stamp is taken under fire_lock, immediately before the
+ * timer is started, or for a zero delay before the GPIO is driven.
  */
-static int auxspaceev_basic_pyro_read_cap_channel(const struct device *dev,
-						 uint32_t channel,
-						 uint32_t *val)
+static int auxspaceev_basic_pyro_fire_at(const struct device *dev,
+					 uint32_t channel, uint32_t delay_us)
 {
 	const struct pyro_config *config = dev->config;
-	int16_t buf;
-	int ret;
+	struct pyro_data *data = dev->data;
+	int ret = 0;
 
-	int read_channel = config->single_cap ? 0 : channel;
-	if (read_channel >= config->n_channels) {
+	if (channel >= config->n_channels) {
 		return -EINVAL;
 	}
 
-	if (config->capv == NULL) {
-		return -ENOTSUP;
+	struct basic_pyro_fire *f = &data->fire[channel];
+	k_spinlock_key_t key = k_spin_lock(&data->fire_lock);
+
+	/* Tested under fire_lock: a racing disarm clears it there too. */
+	if (!(data->arm_flags & BIT(channel))) {
+		k_spin_unlock(&data->fire_lock, key);
+		LOG_ERR("channel %u not armed, capacitor not charged", channel);
+		return -EACCES;
 	}
 
-	struct adc_sequence seq = {
-		.buffer = &buf,
-		.buffer_size = sizeof(buf),
-	};
+	if (f->state == BASIC_PYRO_FIRE_PENDING) {
+		k_spin_unlock(&data->fire_lock, key);
+		return -EBUSY;
+	}
 
-	adc_sequence_init_dt(&config->capv[read_channel], &seq);
+	f->timing = (struct pyro_fire_timing){
+		.command_ns = pyro_fire_now_ns(),
+		.delay_us = delay_us,
+	};
+	f->state = BASIC_PYRO_FIRE_PENDING;
 
-	ret = adc_read_dt(&config->capv[read_channel], &seq);
-	if (ret < 0) {
-		return ret;
+	if (delay_us == 0U) {
+		ret = fire_locked(f);
+	} else {
+		fire_schedule_locked(f, delay_us);
 	}
+	k_spin_unlock(&data->fire_lock, key);
 
-	int32_t mv = (int32_t)buf;
+	return ret;
+}
 
-	ret = adc_raw_to_millivolts_dt(&config->capv[read_channel], &mv);
-	if (ret < 0) {
-		return ret;
+/** @brief Read the command and fire stamps of the last timed fire. */
+static int auxspaceev_basic_pyro_fire_timing(const struct device *dev,
+					     uint32_t channel,
+					     struct pyro_fire_timing *timing)
+{
+	const struct pyro_config *config = dev->config;
+	struct pyro_data *data = dev->data;
+	int ret;
+
+	if (channel >= config->n_channels) {
+		return -EINVAL;
 	}
 
-	*val = (uint32_t)mv;
+	const struct basic_pyro_fire *f = &data->fire[channel];
+	k_spinlock_key_t key = k_spin_lock(&data->fire_lock);
+
+	switch (f->state) {
+	case BASIC_PYRO_FIRE_DONE:
+		*timing = f->timing;
+		ret = 0;
+		break;
+	case BASIC_PYRO_FIRE_PENDING:
+		ret = -EINPROGRESS;
+		break;
+	default:
+		ret = -ENODATA;
+		break;
+	}
+	k_spin_unlock(&data->fire_lock, key);
 
-	return 0;
+	return ret;
 }
+#endif /* CONFIG_BASIC_PYRO_TIMED_FIRE */
 
 /** @brief Get the number of pyro channels. */
 static int auxspaceev_basic_pyro_get_nchannels(const struct device *dev)
@@ -433,6 +855,13 @@ static DEVICE_API(pyro, pyro_api_funcs) = {
 	.sense = auxspaceev_basic_pyro_sense_channel,
 	.read_cap = auxspaceev_basic_pyro_read_cap_channel,
 	.get_nchannels = auxspaceev_basic_pyro_get_nchannels,
+#if defined(CONFIG_BASIC_PYRO_TIMED_FIRE)
+	.fire_at = auxspaceev_basic_pyro_fire_at,
+	.fire_timing = auxspaceev_basic_pyro_fire_timing,
+#endif /* CONFIG_BASIC_PYRO_TIMED_FIRE */
+#if defined(CONFIG_BASIC_PYRO_SAMPLE)
+	.get_status = auxspaceev_basic_pyro_get_status,
+#endif /* CONFIG_BASIC_PYRO_SAMPLE */
 };
 
 /**
@@ -456,6 +885,20 @@ static DEVICE_API(pyro, pyro_api_funcs) = {
 	ADC_DT_SPEC_STRUCT(DT_PHANDLE_BY_IDX(node_id, prop, idx),	\
 			   DT_PHA_BY_IDX(node_id, prop, idx, input)),
 
+/**
+ * @brief Counter device of an instance's "fire-counter", or NULL.
+ *
+ * @param inst Instance number.
+ */
+#if defined(CONFIG_COUNTER)
+#define BASIC_PYRO_FIRE_COUNTER(inst)					\
+	COND_CODE_1(DT_INST_NODE_HAS_PROP(inst, fire_counter),		\
+		    (DEVICE_DT_GET(DT_INST_PHANDLE(inst, fire_counter))),	\
+		    (NULL))
+#else
+#define BASIC_PYRO_FIRE_COUNTER(inst) NULL
+#endif /* CONFIG_COUNTER */
+
 /**
  * @brief Initialize a struct pyro_config from devicetree bindings.
  *
@@ -489,6 +932,9 @@ static DEVICE_API(pyro, pyro_api_funcs) = {
 		.sense_max = COND_CODE_1(					\
 			DT_NODE_HAS_PROP(DT_DRV_INST(inst), sense_max),	\
 			(pyro_sense_max_##inst), (NULL)),			\
+		IF_ENABLED(CONFIG_BASIC_PYRO_TIMED_FIRE, (			\
+		.fire_counter = BASIC_PYRO_FIRE_COUNTER(inst),		\
+		))								\
 	}
 
 /**
@@ -540,7 +986,22 @@ static DEVICE_API(pyro, pyro_api_funcs) = {
 	static const uint32_t pyro_sense_max_##inst[] =			\
 		DT_PROP(DT_DRV_INST(inst), sense_max);			\
 	))								\
-	static struct pyro_data pyro_data_##inst;			\
+	IF_ENABLED(CONFIG_BASIC_PYRO_TIMED_FIRE, (			\
+	static struct basic_pyro_fire						\
+		pyro_fire_##inst[DT_PROP_LEN(DT_DRV_INST(inst), trigger_gpios)];\
+	))								\
+	IF_ENABLED(CONFIG_BASIC_PYRO_SAMPLE, (				\
+	static struct pyro_channel_status					\
+		pyro_status_##inst[DT_PROP_LEN(DT_DRV_INST(inst), trigger_gpios)];\
+	))								\
+	static struct pyro_data pyro_data_##inst = {			\
+		IF_ENABLED(CONFIG_BASIC_PYRO_TIMED_FIRE, (		\
+		.fire = pyro_fire_##inst,				\
+		))							\
+		IF_ENABLED(CONFIG_BASIC_PYRO_SAMPLE, (			\
+		.sampler.status = pyro_status_##inst,			\
+		))							\
+	};								\
 	static const struct pyro_config pyro_config_##inst =		\
 		PYRO_CONFIG(inst);					\
 	PYRO_DEVICE_DT_INST_DEFINE(inst,				\
@@ -12,8 +12,12 @@
 
 #include <zephyr/drivers/adc.h>
 #include <zephyr/drivers/gpio.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
 #include <stdint.h>
 
+#include <aurora/drivers/pyro.h>
+
 /**
  * @brief Configuration for the basic pyro driver.
  *
@@ -33,18 +37,72 @@ struct pyro_config {
 	const struct adc_dt_spec *senses;	/**< Per-channel sense ADC specs, or NULL. */
 	const uint32_t *capv_max;		/**< Per-channel cap voltage max values, or NULL. */
 	const uint32_t *sense_max;		/**< Per-channel sense ADC max values, or NULL. */
+#if defined(CONFIG_BASIC_PYRO_TIMED_FIRE)
+	const struct device *fire_counter;	/**< Counter for timed fires, or NULL. */
+#endif /* CONFIG_BASIC_PYRO_TIMED_FIRE */
+};
+
+#if defined(CONFIG_BASIC_PYRO_TIMED_FIRE)
+/** @brief Timed fire state of one channel. */
+enum basic_pyro_fire_state {
+	BASIC_PYRO_FIRE_NONE,		/**< Never scheduled, or cancelled. */
+	BASIC_PYRO_FIRE_PENDING,	/**< Waiting for its timer ISR. */
+	BASIC_PYRO_FIRE_DONE,		/**< Trigger GPIO driven. */
+};
+
+/**
+ * @brief Per-channel timed fire.
+ *
+ * Written under @ref pyro_data.fire_lock by the scheduling thread and
+ * the timer ISR.
+ */
+struct basic_pyro_fire {
+	const struct device *dev;	/**< Owning device, for the ISR. */
+	uint32_t channel;		/**< Channel index. */
+	enum basic_pyro_fire_state state; /**< See basic_pyro_fire_state. */
+	int alarm;			/**< Counter alarm channel, or -1 for the k_timer. */
+	struct k_timer timer;		/**< Fallback timer. */
+	struct pyro_fire_timing timing;	/**< Command and fire stamps. */
+};
+#endif /* CONFIG_BASIC_PYRO_TIMED_FIRE */
+
+#if defined(CONFIG_BASIC_PYRO_SAMPLE)
+/**
+ * @brief Background ADC sampling of one instance.
+ *
+ * @c status holds the ADC part of each channel's status (the arm and
+ * trigger flags are filled in on read). Written by the sampling work
+ * item, read from any context, both under @c lock.
+ */
+struct basic_pyro_sampler {
+	const struct device *dev;		/**< Owning device, for the work item. */
+	struct k_work_delayable work;		/**< Periodic sampling pass. */
+	struct pyro_channel_status *status;	/**< Per-channel cached status. */
+	struct k_spinlock lock;			/**< Guards status[]. */
 };
+#endif /* CONFIG_BASIC_PYRO_SAMPLE */
 
 /**
  * @brief Runtime data for the basic pyro driver.
  *
  * Tracks per-channel arm, trigger, and short state as bitmasks.
+ * @c trigger_flags is atomic since timed fires set it from an ISR.
+ * With timed fires @c arm_flags only changes under @c fire_lock, the
+ * lock a fire tests it under.
  */
 struct pyro_data {
 	uint32_t arm_flags;		/**< Bitmask of armed channels. */
-	uint32_t trigger_flags;		/**< Bitmask of triggered (fired) channels. */
+	atomic_t trigger_flags;		/**< Bitmask of triggered (fired) channels. */
 	uint32_t short_flags;		/**< Bitmask of shorted (safe) channels. */
 	uint32_t charge_flags;		/**< Bitmask of charging channels. */
+#if defined(CONFIG_BASIC_PYRO_TIMED_FIRE)
+	struct basic_pyro_fire *fire;	/**< Per-channel timed fires. */
+	uint32_t alarm_busy;		/**< Bitmask of taken counter alarms. */
+	struct k_spinlock fire_lock;	/**< Guards fire[], alarm_busy and arm_flags changes. */
+#endif /* CONFIG_BASIC_PYRO_TIMED_FIRE */
+#if defined(CONFIG_BASIC_PYRO_SAMPLE)
+	struct basic_pyro_sampler sampler; /**< Background ADC sampling. */
+#endif /* CONFIG_BASIC_PYRO_SAMPLE */
 };
 
 #endif /* __AURORA_DRIVERS_BASIC_PYRO_H__*/
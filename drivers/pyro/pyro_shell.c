@@ -6,11 +6,16 @@
 
 #include <aurora/drivers/pyro.h>
 #include <zephyr/device.h>
+#include <zephyr/kernel.h>
 #include <zephyr/shell/shell.h>
 #include <stdlib.h>
 
 #define ARGV_DEV     1
 #define ARGV_CHANNEL 2
+#define ARGV_DELAY   3
+
+/* How long "pyro fire" waits for a scheduled fire beyond its delay. */
+#define FIRE_WAIT_SLACK_MS 100
 
 static const struct device *get_pyro_device(const struct shell *sh,
 					    const char *name)
@@ -95,24 +100,46 @@ static int cmd_pyro_state(const struct shell *sh, size_t argc, char **argv)
 	shell_print(sh, "Device: %s (%d channels)", dev->name, nch);
 
 	for (uint32_t ch = 0; ch < (uint32_t)nch; ch++) {
-		uint32_t cap_mv = 0;
-		uint32_t sense_mv = 0;
-		int cap_ret, sense_ret;
-
-		cap_ret = pyro_read_cap_channel(dev, ch, &cap_mv);
-		sense_ret = pyro_sense_channel(dev, ch, &sense_mv);
+		struct pyro_channel_status st;
+		int ret = pyro_get_status(dev, ch, &st);
+
+		if (ret == -ENOSYS) {
+			/* No background sampling: convert now. */
+			st = (struct pyro_channel_status){ 0 };
+			if (pyro_read_cap_channel(dev, ch, &st.cap_mv) == 0) {
+				st.flags |= PYRO_STATUS_CAP_VALID;
+			}
+			if (pyro_sense_channel(dev, ch, &st.sense_mv) == 0) {
+				st.flags |= PYRO_STATUS_SENSE_VALID;
+			}
+		} else if (ret < 0) {
+			shell_error(sh, "  ch %u: status failed: %d", ch, ret);
+			continue;
+		}
 
 		shell_fprintf(sh, SHELL_NORMAL, "  ch %u:", ch);
-		if (cap_ret == 0) {
-			shell_fprintf(sh, SHELL_NORMAL, " cap=%u mV", cap_mv);
+		if (st.flags & PYRO_STATUS_CAP_VALID) {
+			shell_fprintf(sh, SHELL_NORMAL, " cap=%u mV", st.cap_mv);
 		} else {
 			shell_fprintf(sh, SHELL_NORMAL, " cap=n/a");
 		}
-		if (sense_ret == 0) {
-			shell_fprintf(sh, SHELL_NORMAL, " sense=%u mV", sense_mv);
+		if (st.flags & PYRO_STATUS_SENSE_VALID) {
+			shell_fprintf(sh, SHELL_NORMAL, " sense=%u mV", st.sense_mv);
 		} else {
 			shell_fprintf(sh, SHELL_NORMAL, " sense=n/a");
 		}
+		if (ret == 0) {
+			shell_fprintf(sh, SHELL_NORMAL, "%s%s",
+				      (st.flags & PYRO_STATUS_ARMED) ? " armed" : "",
+				      (st.flags & PYRO_STATUS_TRIGGERED) ? " fired" : "");
+			if (st.timestamp_ns != 0U) {
+				uint64_t age_ms = (pyro_fire_now_ns() - st.timestamp_ns) /
+						  NSEC_PER_MSEC;
+
+				shell_fprintf(sh, SHELL_NORMAL, " (%llu ms old)",
+					      (unsigned long long)age_ms);
+			}
+		}
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
 	}
 
@@ -207,6 +234,49 @@ static int cmd_pyro_trigger(const struct shell *sh, size_t argc, char **argv)
 	return 0;
 }
 
+static int cmd_pyro_fire(const struct shell *sh, size_t argc, char **argv)
+{
+	const struct device *dev;
+	struct pyro_fire_timing t;
+	uint32_t channel;
+	uint32_t delay_us = 0;
+	int ret;
+
+	ret = parse_common_args(sh, argv, &dev, &channel);
+	if (ret != 0) {
+		return ret;
+	}
+
+	if (argc > ARGV_DELAY) {
+		delay_us = shell_strtoul(argv[ARGV_DELAY], 10, &ret);
+		if (ret != 0) {
+			shell_error(sh, "invalid delay: %s", argv[ARGV_DELAY]);
+			return -EINVAL;
+		}
+	}
+
+	ret = pyro_fire_at(dev, channel, delay_us);
+	if (ret != 0) {
+		shell_error(sh, "failed to fire ch %u: %d", channel, ret);
+		return ret;
+	}
+
+	k_msleep(delay_us / USEC_PER_MSEC + FIRE_WAIT_SLACK_MS);
+
+	ret = pyro_fire_timing(dev, channel, &t);
+	if (ret != 0) {
+		shell_error(sh, "ch %u: no fire timing: %d", channel, ret);
+		return ret;
+	}
+
+	const uint64_t lat_ns = t.fire_ns - t.command_ns;
+
+	shell_print(sh, "%s ch %u fired %llu ns after command (delay %u us, late %lld ns)",
+		    dev->name, channel, (unsigned long long)lat_ns, t.delay_us,
+		    (long long)lat_ns - (long long)t.delay_us * NSEC_PER_USEC);
+	return 0;
+}
+
 static int cmd_pyro_secure(const struct shell *sh, size_t argc, char **argv)
 {
 	const struct device *dev;
@@ -297,6 +367,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		      "Trigger (fire) a pyro channel\n"
 		      "Usage: pyro trigger <device> <channel>",
 		      cmd_pyro_trigger, 3, 0),
+	SHELL_CMD_ARG(fire, NULL,
+		      "Fire a pyro channel from a timer ISR and print its latency\n"
+		      "Usage: pyro fire <device> <channel> [delay_us]",
+		      cmd_pyro_fire, 3, 1),
 	SHELL_CMD_ARG(secure, NULL,
 		      "Secure (short) a pyro channel\n"
 		      "Usage: pyro secure <device> <channel>",
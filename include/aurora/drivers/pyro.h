@@ -14,7 +14,8 @@
 #include <zephyr/device.h>
 #include <zephyr/devicetree.h>
 #include <zephyr/drivers/gpio.h>
- 
+#include <zephyr/kernel.h>
+
 /**
  * @defgroup drivers_pyro Pyro drivers
  * @ingroup drivers
@@ -33,6 +34,41 @@
  * @brief Operations of the pyro driver class.
  */
 
+/**
+ * @brief Command and fire time of a timed pyro fire.
+ *
+ * Both stamps come from pyro_fire_now_ns(), so they share the time base
+ * of the flight log.
+ */
+struct pyro_fire_timing {
+	uint64_t command_ns;	/**< When pyro_fire_at() accepted the fire. */
+	uint64_t fire_ns;	/**< When the trigger GPIO was driven. */
+	uint32_t delay_us;	/**< Delay requested in pyro_fire_at(). */
+};
+
+/** @brief pyro_channel_status.flags: @c cap_mv holds a sample. */
+#define PYRO_STATUS_CAP_VALID   BIT(0)
+/** @brief pyro_channel_status.flags: @c sense_mv holds a sample. */
+#define PYRO_STATUS_SENSE_VALID BIT(1)
+/** @brief pyro_channel_status.flags: the channel is armed. */
+#define PYRO_STATUS_ARMED       BIT(2)
+/** @brief pyro_channel_status.flags: the trigger GPIO has been driven. */
+#define PYRO_STATUS_TRIGGERED   BIT(3)
+
+/**
+ * @brief Cached continuity and charge status of a pyro channel.
+ *
+ * Filled from the driver's background sampling, so reading it never
+ * waits for an ADC conversion. @c timestamp_ns comes from
+ * pyro_fire_now_ns() and is 0 until the first sample.
+ */
+struct pyro_channel_status {
+	uint64_t timestamp_ns;	/**< When the ADC values were sampled. */
+	uint32_t cap_mv;	/**< Capacitor voltage in millivolts. */
+	uint32_t sense_mv;	/**< Continuity sense reading in millivolts. */
+	uint8_t flags;		/**< PYRO_STATUS_* flags. */
+};
+
 /** @brief Pyro driver class operations. */
 __subsystem struct pyro_driver_api {
 	int (*arm)(const struct device *dev, uint32_t channel);          /**< Arm channel. */
@@ -43,6 +79,12 @@ __subsystem struct pyro_driver_api {
 	int (*sense)(const struct device *dev, uint32_t channel, uint32_t *val);    /**< Read sense. */
 	int (*read_cap)(const struct device *dev, uint32_t channel, uint32_t *val); /**< Read cap voltage. */
 	int (*get_nchannels)(const struct device *dev);                  /**< Get channel count. */
+	int (*fire_at)(const struct device *dev, uint32_t channel,
+		       uint32_t delay_us);                               /**< Schedule a fire (optional). */
+	int (*fire_timing)(const struct device *dev, uint32_t channel,
+			   struct pyro_fire_timing *timing);             /**< Read fire timing (optional). */
+	int (*get_status)(const struct device *dev, uint32_t channel,
+			  struct pyro_channel_status *status);           /**< Read cached status (optional). */
 };
 
 /**
@@ -244,6 +286,118 @@ __ASSERT_NO_MSG(DEVICE_API_IS(pyro, dev));
 return DEVICE_API_GET(pyro, dev)->get_nchannels(dev);
 }
 
+/**
+ * @brief Trigger an armed pyro channel from a timer ISR.
+ *
+ * Validates the channel now and drives its trigger GPIO @p delay_us
+ * later from interrupt context, independent of thread scheduling. With
+ * @p delay_us == 0 the GPIO is driven before the call returns, with
+ * interrupts locked between the command and fire stamps. Disarming or
+ * securing the channel cancels a pending fire.
+ *
+ * @param dev Pyro device instance.
+ * @param channel Number of the channel to fire.
+ * @param delay_us Delay from now until the fire, in microseconds.
+ *
+ * @retval 0 if the fire was scheduled (or done, for @p delay_us == 0).
+ * @retval -EINVAL if @p channel is invalid.
+ * @retval -EACCES if the channel is not armed.
+ * @retval -EBUSY if a fire is already pending on the channel.
+ * @retval -ENOSYS if the driver does not support timed fires.
+ * @retval -errno Other negative errno code on failure.
+ */
+__syscall int pyro_fire_at(const struct device *dev, uint32_t channel,
+			   uint32_t delay_us);
+
+static inline int z_impl_pyro_fire_at(const struct device *dev,
+				      uint32_t channel, uint32_t delay_us)
+{
+__ASSERT_NO_MSG(DEVICE_API_IS(pyro, dev));
+
+if (DEVICE_API_GET(pyro, dev)->fire_at == NULL) {
+	return -ENOSYS;
+}
+
+return DEVICE_API_GET(pyro, dev)->fire_at(dev, channel, delay_us);
+}
+
+/**
+ * @brief Read the timing of the last pyro_fire_at() on a channel.
+ *
+ * @param dev Pyro device instance.
+ * @param channel Number of the channel.
+ * @param[out] timing Command and fire stamps.
+ *
+ * @retval 0 if the channel fired; @p timing is valid.
+ * @retval -EINPROGRESS if the fire is still pending.
+ * @retval -ENODATA if no fire was scheduled or it was cancelled.
+ * @retval -EINVAL if @p channel is invalid.
+ * @retval -ENOSYS if the driver does not support timed fires.
+ */
+__syscall int pyro_fire_timing(const struct device *dev, uint32_t channel,
+			       struct pyro_fire_timing *timing);
+
+static inline int z_impl_pyro_fire_timing(const struct device *dev,
+					  uint32_t channel,
+					  struct pyro_fire_timing *timing)
+{
+__ASSERT_NO_MSG(DEVICE_API_IS(pyro, dev));
+
+if (DEVICE_API_GET(pyro, dev)->fire_timing == NULL) {
+	return -ENOSYS;
+}
+
+return DEVICE_API_GET(pyro, dev)->fire_timing(dev, channel, timing);
+}
+
+/**
+ * @brief Read the cached continuity and charge status of a channel.
+ *
+ * Never blocks on the ADC: the values come from the driver's last
+ * background sample, the arm and trigger flags are current. Safe to
+ * call from any thread at any rate.
+ *
+ * @param dev Pyro device instance.
+ * @param channel Number of the channel.
+ * @param[out] status Cached status. @c PYRO_STATUS_CAP_VALID and
+ *             @c PYRO_STATUS_SENSE_VALID tell which readings exist.
+ *
+ * @retval 0 if successful.
+ * @retval -EINVAL if @p channel is invalid.
+ * @retval -ENOSYS if the driver does not sample in the background.
+ */
+__syscall int pyro_get_status(const struct device *dev, uint32_t channel,
+			      struct pyro_channel_status *status);
+
+static inline int z_impl_pyro_get_status(const struct device *dev,
+					 uint32_t channel,
+					 struct pyro_channel_status *status)
+{
+__ASSERT_NO_MSG(DEVICE_API_IS(pyro, dev));
+
+if (DEVICE_API_GET(pyro, dev)->get_status == NULL) {
+	return -ENOSYS;
+}
+
+return DEVICE_API_GET(pyro, dev)->get_status(dev, channel, status);
+}
+
+/**
+ * @brief Time base of @ref pyro_fire_timing stamps, in nanoseconds.
+ *
+ * The 64-bit cycle counter when the timer driver has one, kernel ticks
+ * otherwise. Both count system uptime, like flight log timestamps; the
+ * cycle counter resolves the sub-millisecond fire latency.
+ */
+static inline uint64_t pyro_fire_now_ns(void)
+{
+#if defined(CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER)
+	return k_cyc_to_ns_floor64(k_cycle_get_64());
+#else
+	return k_ticks_to_ns_floor64(k_uptime_ticks());
+#endif /* CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER */
+}
+
 #include <syscalls/pyro.h>
 
 /** @} */
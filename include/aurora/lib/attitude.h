@@ -26,33 +26,54 @@
  *   4. During flight, @ref attitude_update() integrates gyro into the
  *      gravity vector and returns the gravity-removed world-frame
  *      vertical acceleration.
+ *
+ * Two backends implement the update, selected by @c CONFIG_ATTITUDE_TYPE:
+ * the default propagates only @c g_b, while @c CONFIG_ATTITUDE_QUATERNION
+ * tracks the full body-to-world rotation and also yields
+ * @ref attitude_orientation().
  */
 
 /** @brief Number of axes handled by the attitude tracker. */
 #define ATTITUDE_NUM_AXES 3
 
+/**
+ * @brief Arithmetic type of the tracker state and inputs.
+ *
+ * @c float with @c CONFIG_ATTITUDE_FLOAT, @c double otherwise.
+ */
+#if defined(CONFIG_ATTITUDE_FLOAT)
+typedef float attitude_real_t;
+#else
+typedef double attitude_real_t;
+#endif /* CONFIG_ATTITUDE_FLOAT */
+
 /**
  * @brief Attitude tracker state.
  */
 struct attitude {
 	/** Gravity unit vector in body frame (points "down" in world frame). */
-	double g_b[ATTITUDE_NUM_AXES];
+	attitude_real_t g_b[ATTITUDE_NUM_AXES];
 	/** Measured gravity magnitude in m/s^2. */
-	double g_mag;
+	attitude_real_t g_mag;
 	/** Estimated accelerometer bias in body frame, m/s^2. */
-	double accel_bias[ATTITUDE_NUM_AXES];
+	attitude_real_t accel_bias[ATTITUDE_NUM_AXES];
 	/** Estimated gyroscope bias in body frame, rad/s. */
-	double gyro_bias[ATTITUDE_NUM_AXES];
+	attitude_real_t gyro_bias[ATTITUDE_NUM_AXES];
 
 	/** Number of samples accumulated into the calibration sums. */
 	int cal_samples;
 	/** Running sum of accelerometer samples during calibration. */
-	double cal_accel_sum[ATTITUDE_NUM_AXES];
+	attitude_real_t cal_accel_sum[ATTITUDE_NUM_AXES];
 	/** Running sum of gyroscope samples during calibration. */
-	double cal_gyro_sum[ATTITUDE_NUM_AXES];
+	attitude_real_t cal_gyro_sum[ATTITUDE_NUM_AXES];
 
 	/** Non-zero once attitude_calibrate_finish() has been called. */
 	int calibrated;
+
+#if defined(CONFIG_ATTITUDE_QUATERNION)
+	/** Body-to-world rotation [w, x, y, z]; identity at calibration. */
+	attitude_real_t q[4];
+#endif /* CONFIG_ATTITUDE_QUATERNION */
 };
 
 /**
@@ -83,8 +104,8 @@ int attitude_init(struct attitude *att);
  * @retval -EALREADY if calibration has already been finalized.
  */
 int attitude_calibrate_sample(struct attitude *att,
-			      const double accel[ATTITUDE_NUM_AXES],
-			      const double gyro[ATTITUDE_NUM_AXES]);
+			      const attitude_real_t accel[ATTITUDE_NUM_AXES],
+			      const attitude_real_t gyro[ATTITUDE_NUM_AXES]);
 
 /**
  * @brief Finalize calibration and seed the body-frame gravity vector.
@@ -123,10 +144,37 @@ int attitude_calibrate_finish(struct attitude *att);
  * @retval -ENODATA if calibration has not been finalized.
  */
 int attitude_update(struct attitude *att,
-		    const double accel[ATTITUDE_NUM_AXES],
-		    const double gyro[ATTITUDE_NUM_AXES],
-		    double dt_s,
-		    double *accel_vert_out);
+		    const attitude_real_t accel[ATTITUDE_NUM_AXES],
+		    const attitude_real_t gyro[ATTITUDE_NUM_AXES],
+		    attitude_real_t dt_s,
+		    attitude_real_t *accel_vert_out);
+
+#if defined(CONFIG_ATTITUDE_QUATERNION)
+/**
+ * @brief Orientation from the current quaternion estimate.
+ *
+ * Same convention as imu_sensor_value_to_orientation() (degrees, body
+ * axes remapped so the @c CONFIG_IMU_UP_AXIS_* axis is Z):
+ *   - orientation[0] = yaw   (tilt of the forward axis from horizontal)
+ *   - orientation[1] = pitch (tilt of the lateral axis from horizontal)
+ *   - orientation[2] = roll  (twist about the up axis since calibration,
+ *                             wrapped to [-180, 180])
+ *
+ * Yaw and pitch come from the estimated gravity direction rather than
+ * the raw accelerometer, so they stay valid under thrust.  No state is
+ * changed; call it after @ref attitude_update() at whatever rate the
+ * orientation is consumed.
+ *
+ * @param att         Pointer to tracker state.
+ * @param orientation Output: [yaw, pitch, roll] in degrees.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if any pointer is NULL.
+ * @retval -ENODATA if calibration has not been finalized.
+ */
+int attitude_orientation(const struct attitude *att,
+			 attitude_real_t orientation[ATTITUDE_NUM_AXES]);
+#endif /* CONFIG_ATTITUDE_QUATERNION */
 
 /**
  * @brief Query whether calibration has been finalized.
@@ -10,6 +10,8 @@
 #include <zephyr/drivers/sensor.h>
 #include <zephyr/zbus/zbus.h>
 
+#include <aurora/lib/sample.h>
+
 /**
  * @defgroup lib_baro Barometer library
  * @ingroup lib
@@ -27,12 +29,15 @@ ZBUS_CHAN_DECLARE(baro_data_chan);
  *
  * carries the measurement data from the baro including temperature and
  * pressure readings. This struct is used as a
- * z-bus message payload for baro data updates
+ * z-bus message payload for baro data updates. Readings are
+ * @ref aurora_sample_t, in millionths of degrees Celsius and kPa.
  */
 struct baro_data
 {
-	struct sensor_value temperature; /**< Latest temperature reading */
-	struct sensor_value pressure;  /**< Latest pressure reading */
+	aurora_sample_t temperature; /**< Latest temperature reading */
+	aurora_sample_t pressure;  /**< Latest pressure reading */
+	uint64_t timestamp_ns; /**< Capture time in ns since boot, taken right before the fetch */
+	uint8_t instance; /**< Producing barometer, 0 to CONFIG_BARO_INSTANCES - 1 */
 };
 
 #if !defined(CONFIG_BARO_TRIGGER)
@@ -62,6 +67,22 @@ int baro_measure(const struct device *dev);
  */
 int baro_init(const struct device *dev);
 
+/**
+ * @brief Initialize one of several redundant barometers.
+ *
+ * Same as baro_init(), and every sample of @p dev is published with
+ * @c instance set to @p instance. baro_init() is instance 0.
+ *
+ * @param dev      Pointer to the barometric sensor device.
+ * @param instance Instance number, below @c CONFIG_BARO_INSTANCES.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p instance is out of range.
+ * @retval -ENODEV if @p dev is NULL.
+ * @retval -ETIMEDOUT if the device is not ready.
+ */
+int baro_init_instance(const struct device *dev, uint8_t instance);
+
 /**
  * @brief Set the ground-level reference pressure.
  *
@@ -90,6 +111,20 @@ int baro_set_reference(double ref_kpa);
  */
 int baro_sensor_value_to_altitude(const struct sensor_value *press, double *altitude_out);
 
+/**
+ * @brief Convert a pressure sample to altitude AGL.
+ *
+ * Same as @ref baro_sensor_value_to_altitude for the
+ * @c baro_data.pressure of a z-bus message.
+ *
+ * @param press Barometric pressure in millionths of kPa.
+ * @param altitude_out Altitude in meters above the reference level.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p altitude_out is NULL.
+ */
+int baro_sample_to_altitude(aurora_sample_t press, double *altitude_out);
+
 /** @} */
 
 #if defined(CONFIG_DATA_LOGGER_BIN)
@@ -6,7 +6,10 @@
 #ifndef AURORA_LIB_DATA_LOGGER_H_
 #define AURORA_LIB_DATA_LOGGER_H_
 
+#include <stdbool.h>
 #include <stddef.h>
+#include <sys/types.h>
+#include <zephyr/kernel.h>
 #include <zephyr/drivers/sensor.h>
 
 /**
@@ -48,6 +51,14 @@ enum aurora_data {
 	AURORA_DATA_SM_POSE,       /**< SM Pose: [0] velocity, [1] altitude       */
 	AURORA_DATA_ORIENTATION,   /**< Orientation: [0] yaw, [1] pitch, [2] roll */
 	AURORA_DATA_VBAT,          /**< Battery: [0] voltage                      */
+	AURORA_DATA_SM_AUDIT,      /**< SM audit trail, see @ref AURORA_AUDIT_TAG */
+	AURORA_DATA_PYRO_FIRE,     /**< Pyro fire: [0] channel, [1] command-to-fire
+				    *   latency (ms), [2] requested delay (ms);
+				    *   timestamp is the fire time
+				    */
+	AURORA_DATA_THREAD_HEALTH, /**< Thread health, see
+				    *   @ref AURORA_HEALTH_NAME_MAX
+				    */
 	AURORA_DATA_COUNT,         /**< Sentinel — do not use as a type           */
 };
 
@@ -64,8 +75,71 @@ struct datapoint {
 	struct sensor_value channels[DP_MAX_CHANNELS]; /**< Channel readings          */
 };
 
-/** Forward declaration (needed by formatter callbacks). */
+/**
+ * @name State machine audit records
+ *
+ * With @c CONFIG_AURORA_STATE_MACHINE_AUDIT_FLIGHT_LOG every audit entry
+ * is stored as one or more @ref AURORA_DATA_SM_AUDIT datapoints of three
+ * channels, so it lands time-aligned with the sensor data in the binary
+ * log:
+ *
+ *   [0].val1  @ref AURORA_AUDIT_TAG (kind, from, to, chunk)
+ *   [0].val2  length of the event text in bytes (0 for transitions)
+ *   [1], [2]  text bytes chunk * 16 .. chunk * 16 + 15, four per int32,
+ *             first byte in the low-order bits, zero padded
+ *
+ * Transitions and events of up to 16 characters take one record; longer
+ * events continue in records with increasing @c chunk.  Text beyond
+ * @ref AURORA_AUDIT_TEXT_MAX is cut off.
+ * @{
+ */
+
+/** Event text bytes carried by one audit record. */
+#define AURORA_AUDIT_TEXT_PER_RECORD 16U
+
+/** Longest event text stored in the flight log. */
+#define AURORA_AUDIT_TEXT_MAX 64U
+
+/** Most records one audit entry takes. */
+#define AURORA_AUDIT_RECORDS_MAX \
+	(AURORA_AUDIT_TEXT_MAX / AURORA_AUDIT_TEXT_PER_RECORD)
+
+/** Pack entry kind (sm_audit_type), states and chunk index into [0].val1. */
+#define AURORA_AUDIT_TAG(kind, from, to, chunk)                         \
+	((int32_t)((uint32_t)(kind) | ((uint32_t)(from) << 8) |         \
+		   ((uint32_t)(to) << 16) | ((uint32_t)(chunk) << 24)))
+
+#define AURORA_AUDIT_TAG_KIND(tag)  ((uint8_t)((uint32_t)(tag) & 0xFFU))
+#define AURORA_AUDIT_TAG_FROM(tag)  ((uint8_t)(((uint32_t)(tag) >> 8) & 0xFFU))
+#define AURORA_AUDIT_TAG_TO(tag)    ((uint8_t)(((uint32_t)(tag) >> 16) & 0xFFU))
+#define AURORA_AUDIT_TAG_CHUNK(tag) ((uint8_t)((uint32_t)(tag) >> 24))
+
+/** @} */
+
+/**
+ * @name Thread health records
+ *
+ * With @c CONFIG_AURORA_HEALTH_FLIGHT_LOG every health sample is stored
+ * as one @ref AURORA_DATA_THREAD_HEALTH datapoint of three channels per
+ * thread:
+ *
+ *   [0], [1]  thread name bytes 0 .. 15, four per int32, first byte in
+ *             the low-order bits, zero padded
+ *   [2].val1  stack high-water mark in bytes
+ *   [2].val2  CPU share since the previous sample, in millionths
+ *
+ * All records of one sample carry the same timestamp.
+ * @{
+ */
+
+/** Thread name bytes carried by one health record. */
+#define AURORA_HEALTH_NAME_MAX 16U
+
+/** @} */
+
+/** Forward declarations (needed by formatter callbacks). */
 struct data_logger;
+struct aurora_bin_record;
 
 /**
  * @brief Lifecycle events the upstream application can deliver to a
@@ -79,6 +153,32 @@ struct data_logger;
 enum data_logger_event {
 	DLE_BOOST,	/**< Boost detected; freeze the ring forward from here. */
 	DLE_LANDED,	/**< Landed; the post-landed pad window starts now.     */
+	DLE_APOGEE,	/**< Apogee passed; descent starts now.                 */
+};
+
+/**
+ * @brief Flight phases distinguished by the decimation policy.
+ *
+ * A logger starts in @ref DLP_PAD and is advanced by
+ * @ref data_logger_event: BOOST → ascent, APOGEE → descent,
+ * LANDED → landed.
+ */
+enum data_logger_phase {
+	DLP_PAD,	/**< Open until DLE_BOOST.          */
+	DLP_ASCENT,	/**< DLE_BOOST until DLE_APOGEE.    */
+	DLP_DESCENT,	/**< DLE_APOGEE until DLE_LANDED.   */
+	DLP_LANDED,	/**< After DLE_LANDED.              */
+	DLP_COUNT,	/**< Sentinel — do not use as a phase */
+};
+
+/**
+ * @brief Decimation policy of one sensor group in one flight phase.
+ */
+struct data_logger_decimation {
+	/** Store one sample in every @c factor; 0 and 1 store them all. */
+	uint16_t factor;
+	/** Store the mean of each window instead of its last sample. */
+	bool average;
 };
 
 /**
@@ -102,6 +202,15 @@ struct data_logger_formatter {
 	int (*write_datapoint)(struct data_logger *logger,
 			       const struct datapoint *dp);
 
+	/**
+	 * Optional bulk variant of @c write_datapoint for @p n contiguous
+	 * datapoints.  Stops at the first failing datapoint and returns its
+	 * error.  When NULL, @ref data_logger_write_batch loops over
+	 * @c write_datapoint instead.
+	 */
+	int (*write_datapoints)(struct data_logger *logger,
+				const struct datapoint *dps, size_t n);
+
 	/** Flush buffered data to storage. */
 	int (*flush)(struct data_logger *logger);
 
@@ -122,6 +231,30 @@ struct data_logger_formatter {
 	 */
 	int (*on_event)(struct data_logger *logger, enum data_logger_event ev);
 
+	/**
+	 * Optional zero-copy producer hook: hand out the next record slot
+	 * of the live frame, with @c ts_delta_us already filled in.
+	 *
+	 * Must not block; return -EAGAIN when no slot is free right now.
+	 * Only formatters with a fixed in-place record layout implement it.
+	 */
+	int (*reserve)(struct data_logger *logger, uint64_t timestamp_ns,
+		       struct aurora_bin_record **rec);
+
+	/** Publish the slot handed out by @c reserve. Required with it. */
+	int (*commit)(struct data_logger *logger,
+		      struct aurora_bin_record *rec);
+
+	/**
+	 * Optional power-fail hook, see @ref data_logger_powerfail.
+	 *
+	 * Called from interrupt context without the logger mutex, so it
+	 * must not block: it only hands the live frame and the queued
+	 * backlog to the formatter's own writer.  @p asserted is false
+	 * once the supply has recovered.
+	 */
+	int (*powerfail)(struct data_logger *logger, bool asserted);
+
 	/** File suffix */
 	char file_ext[8];
 
@@ -138,6 +271,26 @@ struct data_logger_state {
 
 	/** Data logger is running and logging (atomic for ISR access) */
 	atomic_t running;
+
+	/** Paused by @ref data_logger_powerfail, resumed when power is back */
+	atomic_t pf_paused;
+
+#if defined(CONFIG_DATA_LOGGER_DECIMATION)
+	/** Current flight phase, advanced by @ref data_logger_event. */
+	enum data_logger_phase phase;
+
+	/** Whether any group is decimated in @c phase. */
+	bool decimating;
+
+	/** Policy per phase and group, seeded from Kconfig at init. */
+	struct data_logger_decimation policy[DLP_COUNT][AURORA_DATA_COUNT];
+
+	/** Open decimation window per group (sums in µ-units). */
+	struct data_logger_window {
+		uint16_t n;
+		int64_t  sum[DP_MAX_CHANNELS];
+	} window[AURORA_DATA_COUNT];
+#endif
 };
 
 /** Maximum length of a data logger name (including NUL). */
@@ -189,6 +342,23 @@ int data_logger_init(struct data_logger *logger, const char *filename,
  */
 bool flight_log_online(void);
 
+/**
+ * @brief Wait until the companion FAT volume has settled after boot.
+ *
+ * The volume is settled once the flight-log-disk bring-up has preserved,
+ * rebuilt or given up on it.  Without
+ * @c CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_ASYNC that happens inside
+ * SYS_INIT; with it the rebuild runs on its own thread, and anything that
+ * opens files on the volume waits here first.
+ * Only defined when @c CONFIG_DATA_LOGGER_DISK_AUTO_MKFS is enabled.
+ *
+ * @param timeout How long to wait (K_NO_WAIT to poll).
+ *
+ * @retval 0       Settled; the volume is mounted unless the rebuild failed.
+ * @retval -EAGAIN Still being formatted when @p timeout expired.
+ */
+int flight_log_fat_wait(k_timeout_t timeout);
+
 /**
  * @brief Set the default logger used by @ref data_logger_log.
  *
@@ -216,6 +386,69 @@ int data_logger_log(const struct datapoint *dp);
  */
 int data_logger_write(struct data_logger *logger, const struct datapoint *dp);
 
+/**
+ * @brief Serialise and store @p n datapoints under a single lock.
+ *
+ * Equivalent to calling @ref data_logger_write for each element of
+ * @p dps, but the logger mutex is taken once and the formatter's
+ * @c write_datapoints hook (if any) amortises its per-record checks.
+ *
+ * @param logger  Initialised logger instance.
+ * @param dps     Array of @p n datapoints.
+ * @param n       Number of datapoints; 0 is a no-op.
+ * @retval 0 on success, negative errno of the first failing datapoint.
+ */
+int data_logger_write_batch(struct data_logger *logger,
+			    const struct datapoint *dps, size_t n);
+
+/**
+ * @brief Log @p n datapoints to the default logger.
+ *
+ * Batch counterpart of @ref data_logger_log.
+ *
+ * @param dps  Array of @p n datapoints.
+ * @param n    Number of datapoints.
+ * @retval 0 on success, negative errno on failure.
+ */
+int data_logger_log_batch(const struct datapoint *dps, size_t n);
+
+/**
+ * @brief Reserve the next in-place binary record of a logger.
+ *
+ * Zero-copy alternative to @ref data_logger_write for the sensor hot
+ * path: on success @p rec points straight into the live frame and the
+ * logger mutex is held until @ref data_logger_commit.  The caller fills
+ * @c type, @c channel_count and the first @c channel_count channels;
+ * @c ts_delta_us has already been derived from @p timestamp_ns.
+ *
+ * Never blocks.  Callers should fall back to @ref log_enqueue (or
+ * @ref data_logger_write) on any error.
+ *
+ * @param logger        Initialised, running logger instance.
+ * @param timestamp_ns  Sample timestamp.
+ * @param rec           Receives the record slot.
+ * @retval 0 on success; commit exactly once afterwards.
+ * @retval -ENOTSUP if the formatter has no in-place record layout.
+ * @retval -EAGAIN if the logger is busy, stopped, or out of free slots.
+ * @retval -EINVAL on invalid arguments, other negative errno on failure.
+ */
+int data_logger_reserve(struct data_logger *logger, uint64_t timestamp_ns,
+			struct aurora_bin_record **rec);
+
+/**
+ * @brief Publish a record obtained from @ref data_logger_reserve.
+ *
+ * Releases the logger mutex in every case.  A record carrying an
+ * out-of-range @c type is discarded and -EINVAL is returned, which also
+ * serves as an abort.
+ *
+ * @param logger  Logger the record was reserved from.
+ * @param rec     Record slot returned by @ref data_logger_reserve.
+ * @retval 0 on success, negative errno on failure.
+ */
+int data_logger_commit(struct data_logger *logger,
+		       struct aurora_bin_record *rec);
+
 /**
  * @brief Flush buffered data to the underlying storage.
  *
@@ -267,6 +500,43 @@ int data_logger_start(struct data_logger *logger);
  */
 int data_logger_event(struct data_logger *logger, enum data_logger_event ev);
 
+/**
+ * @brief Signal a supply failure (or its recovery) to every logger.
+ *
+ * Pauses every running logger (or resumes the ones it paused; loggers
+ * stopped with @ref data_logger_stop stay stopped) and calls the
+ * formatter's optional @c powerfail hook.  The binary backends then commit the
+ * partially filled live frame and the queued backlog ahead of anything
+ * else, for at most CONFIG_DATA_LOGGER_POWERFAIL_BUDGET_MS, and leave
+ * the storage idle after that so the hold-up capacitor never runs out
+ * in the middle of a write.
+ *
+ * Safe to call from an ISR (the power-fail monitor GPIO callback).
+ *
+ * @param asserted  true when the supply drops, false when it is back.
+ */
+void data_logger_powerfail(bool asserted);
+
+/**
+ * @brief Override the decimation policy of one group in one phase.
+ *
+ * Samples written with @ref data_logger_write, @ref data_logger_write_batch
+ * or @ref data_logger_commit are run through the policy of the logger's
+ * current phase before they reach the formatter.
+ *
+ * Only available with @c CONFIG_DATA_LOGGER_DECIMATION.
+ *
+ * @param logger  Initialised logger instance.
+ * @param phase   Flight phase the policy applies to.
+ * @param type    Sensor group the policy applies to.
+ * @param d       New policy.
+ * @retval 0 on success, -EINVAL on invalid arguments.
+ */
+int data_logger_set_decimation(struct data_logger *logger,
+			       enum data_logger_phase phase,
+			       enum aurora_data type,
+			       const struct data_logger_decimation *d);
+
 /**
  * @brief Return the human-readable name for an @ref aurora_data value.
  *
@@ -322,6 +592,11 @@ extern const struct data_logger_formatter data_logger_csv_formatter;
 extern const struct data_logger_formatter data_logger_influx_formatter;
 #endif
 
+#if defined(CONFIG_DATA_LOGGER_CONVERT_AUDIT)
+/** State machine audit text — conversion target, audit records only. */
+extern const struct data_logger_formatter data_logger_audit_formatter;
+#endif
+
 #if defined(CONFIG_DATA_LOGGER_MOCK)
 /** Mock formatter — provided by the test application. */
 extern const struct data_logger_formatter data_logger_mock_formatter;
@@ -350,24 +625,61 @@ extern const struct data_logger_formatter data_logger_mock_formatter;
  * @c base_ts_ns; nanosecond precision below 1 µs is dropped (the upstream
  * tick clock is already coarser than 1 µs on every supported target).
  *
+ * With @c CONFIG_DATA_LOGGER_BIN_PACKED the payload after the header is
+ * instead a stream of variable-length records (format v3): a one-byte
+ * @c (channel_count << 6) | type tag followed by zigzag-varint deltas of
+ * the timestamp and of every channel against the previous record of the
+ * same type in the frame.  The delta state restarts at each frame
+ * header, so frames stay independently decodable.  The converter reads
+ * both versions regardless of which one the writer was built with.
+ *
+ * With @c CONFIG_DATA_LOGGER_BIN_CRC the header's @c reserved0 carries
+ * @ref AURORA_BIN_FLAG_CRC and the last @ref AURORA_BIN_CRC_SIZE bytes of
+ * the frame hold a CRC-32 (IEEE) instead of payload.  It covers the
+ * payload up to the trailer, erased tail included, followed by the
+ * header, so the writer can accumulate it record by record before the
+ * header's @c seq is final.  The converter drops frames whose CRC does
+ * not match and carries on with the next one.
+ *
  * All multi-byte integers are native little-endian.
  */
 
 /** 4-byte magic string at the start of every frame. */
 #define AURORA_BIN_FRAME_MAGIC "AURF"
 
-/** Current binary format version (bumped from 1 → 2 for the frame layout). */
-#define AURORA_BIN_VERSION 2U
+/** Fixed 32-byte @ref aurora_bin_record payload. */
+#define AURORA_BIN_VERSION_FIXED 2U
+
+/** Delta/varint-packed payload (@c CONFIG_DATA_LOGGER_BIN_PACKED). */
+#define AURORA_BIN_VERSION_PACKED 3U
+
+/** Single-type struct-of-arrays payload (@c CONFIG_DATA_LOGGER_BIN_COLUMNAR). */
+#define AURORA_BIN_VERSION_COLUMNAR 4U
+
+/** Header @c reserved0 flag: the frame ends in a CRC-32 trailer. */
+#define AURORA_BIN_FLAG_CRC 0x0001U
+
+/** Size of the trailer of a frame flagged @ref AURORA_BIN_FLAG_CRC. */
+#define AURORA_BIN_CRC_SIZE 4U
+
+/** Binary format version written by this build. */
+#if defined(CONFIG_DATA_LOGGER_BIN_PACKED)
+#define AURORA_BIN_VERSION AURORA_BIN_VERSION_PACKED
+#elif defined(CONFIG_DATA_LOGGER_BIN_COLUMNAR)
+#define AURORA_BIN_VERSION AURORA_BIN_VERSION_COLUMNAR
+#else
+#define AURORA_BIN_VERSION AURORA_BIN_VERSION_FIXED
+#endif
 
 /** Per-frame header (32 bytes). */
 struct aurora_bin_frame_header {
 	char     magic[4];        /**< @ref AURORA_BIN_FRAME_MAGIC */
 	uint16_t version;         /**< @ref AURORA_BIN_VERSION */
-	uint16_t reserved0;       /**< Zero */
+	uint16_t reserved0;       /**< Zero, or @ref AURORA_BIN_FLAG_CRC */
 	uint32_t seq;             /**< Monotonic, starts at 0 each flight */
 	uint64_t flight_id;       /**< Unique per flight (uptime at start) */
 	uint64_t base_ts_ns;      /**< Absolute reference for record deltas */
-	uint32_t reserved1;       /**< Zero (pad to 32 B / record alignment) */
+	uint32_t reserved1;       /**< Zero, or the v4 @ref AURORA_BIN_COL_TAG */
 } __packed;
 
 /** Per-datapoint record (32 bytes). Channels are stored losslessly. */
@@ -382,10 +694,159 @@ struct aurora_bin_record {
 	} channels[DP_MAX_CHANNELS];
 } __packed;
 
+/**
+ * @name Columnar (v4) frame payload
+ *
+ * A columnar frame carries @c count records of one type.  Its header's
+ * @c reserved1 holds the tag built by @ref AURORA_BIN_COL_TAG, and the
+ * payload is laid out as struct-of-arrays with a fixed per-frame
+ * capacity (see @ref AURORA_BIN_COL_CAPACITY):
+ *
+ *   column 0          uint32_t ts_delta_us[capacity]
+ *   column 1 + 2*c    int32_t  val1[capacity]   for channel c
+ *   column 2 + 2*c    int32_t  val2[capacity]   for channel c
+ *
+ * Only the first @c count entries of each column are valid.
+ * @{
+ */
+
+/** Pack type, channel count and record count into @c reserved1. */
+#define AURORA_BIN_COL_TAG(type, channels, count)                       \
+	((uint32_t)(type) | ((uint32_t)(channels) << 8) |               \
+	 ((uint32_t)(count) << 16))
+
+#define AURORA_BIN_COL_TAG_TYPE(tag)     ((uint8_t)((tag) & 0xFFU))
+#define AURORA_BIN_COL_TAG_CHANNELS(tag) ((uint8_t)(((tag) >> 8) & 0xFFU))
+#define AURORA_BIN_COL_TAG_COUNT(tag)    ((uint16_t)((tag) >> 16))
+
+/**
+ * Records that fit a frame of @p frame_size bytes at @p channels.  For a
+ * frame flagged @ref AURORA_BIN_FLAG_CRC pass the size less the trailer.
+ */
+#define AURORA_BIN_COL_CAPACITY(frame_size, channels)                   \
+	(((frame_size) - sizeof(struct aurora_bin_frame_header)) /      \
+	 (sizeof(uint32_t) * (1U + 2U * (channels))))
+
+/** Byte offset of column @p col within a frame of @p capacity records. */
+#define AURORA_BIN_COL_OFFSET(capacity, col)                            \
+	(sizeof(struct aurora_bin_frame_header) +                       \
+	 (size_t)(col) * (capacity) * sizeof(uint32_t))
+
+/** @} */
+
+/**
+ * @name Frame index
+ *
+ * With @c CONFIG_DATA_LOGGER_BIN_INDEX the last frame slot of the
+ * flight-log region holds an index of the current flight instead of
+ * data: an @ref aurora_bin_index_header followed by @c count
+ * @ref aurora_bin_index_entry in ascending @c seq order.  The writer
+ * adds one entry every @c interval frames plus one per lifecycle mark,
+ * and rewrites the slot whenever an entry was added and on close.  When
+ * the index fills up, every other periodic entry is dropped and
+ * @c interval doubles.  Entries of frames the circular flash ring has
+ * since overwritten are pruned.
+ * @{
+ */
+
+/** 4-byte magic string at the start of the index slot. */
+#define AURORA_BIN_INDEX_MAGIC "AIDX"
+
+/** Index layout version. */
+#define AURORA_BIN_INDEX_VERSION 1U
+
+/** Why an index entry was recorded. */
+enum aurora_bin_mark {
+	AURORA_BIN_MARK_FRAME,	/**< Periodic entry.                 */
+	AURORA_BIN_MARK_BOOST,	/**< First frame after DLE_BOOST.    */
+	AURORA_BIN_MARK_APOGEE,	/**< First frame after DLE_APOGEE.   */
+	AURORA_BIN_MARK_LANDED,	/**< First frame after DLE_LANDED.   */
+	AURORA_BIN_MARK_COUNT,	/**< Sentinel — do not use as a mark */
+};
+
+/** Index slot header (32 bytes). */
+struct aurora_bin_index_header {
+	char     magic[4];        /**< @ref AURORA_BIN_INDEX_MAGIC */
+	uint16_t version;         /**< @ref AURORA_BIN_INDEX_VERSION */
+	uint16_t count;           /**< Valid entries after the header */
+	uint64_t flight_id;       /**< Flight the index describes */
+	uint32_t interval;        /**< Frames between periodic entries */
+	uint32_t latest_seq;      /**< Newest frame on storage when written */
+	uint32_t latest_slot;     /**< Slot (offset / frame size) of that frame */
+	uint32_t reserved;        /**< Zero */
+} __packed;
+
+/** One index entry (24 bytes). */
+struct aurora_bin_index_entry {
+	uint64_t base_ts_ns;      /**< The frame's @c base_ts_ns */
+	uint32_t seq;             /**< The frame's @c seq */
+	uint32_t slot;            /**< Slot (offset / frame size) of the frame */
+	uint8_t  mark;            /**< @ref aurora_bin_mark */
+	uint8_t  reserved[7];     /**< Zero */
+} __packed;
+
+/** Entries that fit the index slot of a @p frame_size byte frame. */
+#define AURORA_BIN_INDEX_CAPACITY(frame_size)                           \
+	(((frame_size) - sizeof(struct aurora_bin_index_header)) /      \
+	 sizeof(struct aurora_bin_index_entry))
+
+/** @} */
+
+/**
+ * @name Session catalogue
+ *
+ * With @c CONFIG_DATA_LOGGER_DISK_SESSIONS the disk backend keeps every
+ * flight it has room for.  The first 512-byte sector of the region holds
+ * an @ref aurora_bin_session_header followed by @c count
+ * @ref aurora_bin_session_entry, oldest first; the rest of frame slot 0
+ * is unused and flights start at slot 1.  Each new flight is appended
+ * right after the previous one.
+ * @{
+ */
+
+/** 4-byte magic string at the start of the catalogue sector. */
+#define AURORA_BIN_SESSION_MAGIC "ASES"
+
+/** Catalogue layout version. */
+#define AURORA_BIN_SESSION_VERSION 1U
+
+/** @c frames value of a flight that was never closed. */
+#define AURORA_BIN_SESSION_OPEN UINT32_MAX
+
+/** @c flags bit: the flight has been converted to text outputs. */
+#define AURORA_BIN_SESSION_CONVERTED 0x01U
+
+/** Catalogue header (32 bytes). */
+struct aurora_bin_session_header {
+	char     magic[4];        /**< @ref AURORA_BIN_SESSION_MAGIC */
+	uint16_t version;         /**< @ref AURORA_BIN_SESSION_VERSION */
+	uint16_t count;           /**< Valid entries after the header */
+	uint32_t next_number;     /**< @c number of the next flight */
+	uint32_t reserved[5];     /**< Zero */
+} __packed;
+
+/** One flight in the catalogue (24 bytes). */
+struct aurora_bin_session_entry {
+	uint64_t flight_id;       /**< The flight's frame @c flight_id */
+	uint32_t number;          /**< Running flight number (FLIGHT_<n>) */
+	uint32_t first_slot;      /**< Slot of the flight's seq 0 frame */
+	uint32_t frames;          /**< Frames written, or SESSION_OPEN */
+	uint8_t  flags;           /**< AURORA_BIN_SESSION_* bits */
+	uint8_t  reserved[3];     /**< Zero */
+} __packed;
+
+/** @} */
+
 BUILD_ASSERT(sizeof(struct aurora_bin_frame_header) == 32,
 	     "frame header size changed — bump AURORA_BIN_VERSION");
 BUILD_ASSERT(sizeof(struct aurora_bin_record) == 32,
 	     "record size changed — bump AURORA_BIN_VERSION");
+BUILD_ASSERT(sizeof(struct aurora_bin_index_header) == 32 &&
+	     sizeof(struct aurora_bin_index_entry) == 24,
+	     "index layout changed — bump AURORA_BIN_INDEX_VERSION");
+BUILD_ASSERT(sizeof(struct aurora_bin_session_header) == 32 &&
+	     sizeof(struct aurora_bin_session_entry) == 24,
+	     "catalogue layout changed — bump AURORA_BIN_SESSION_VERSION");
 
 /**
  * @brief Convert the live flight log on raw flash to a text formatter output.
@@ -408,6 +869,399 @@ BUILD_ASSERT(sizeof(struct aurora_bin_record) == 32,
 int data_logger_convert(const struct data_logger_formatter *out_fmt,
 			const char *out_path);
 
+/**
+ * @brief Position of one frame in the flight log, from the frame index.
+ */
+struct data_logger_seek {
+	off_t    offset;          /**< Byte offset of the frame in the region */
+	uint32_t seq;             /**< The frame's @c seq */
+	uint64_t base_ts_ns;      /**< The frame's @c base_ts_ns */
+};
+
+/**
+ * @brief Look up the first frame written after a lifecycle event.
+ *
+ * Reads the frame index of the live flight log (see
+ * @c CONFIG_DATA_LOGGER_BIN_INDEX) and verifies the frame it points at.
+ * Must not run concurrently with active logging or conversion.
+ *
+ * @param ev   Event to seek to.
+ * @param out  Filled with the frame's position on success.
+ * @retval 0 on success.
+ * @retval -ENOENT if there is no valid index or the event is not in it.
+ * @retval -EINVAL on invalid arguments.
+ * @retval -ENOTSUP if the index is disabled in this build.
+ * @retval other negative errno on a storage read error.
+ */
+int data_logger_seek_event(enum data_logger_event ev,
+			   struct data_logger_seek *out);
+
+/**
+ * @brief Look up the newest indexed frame starting at or before @p ts_ns.
+ *
+ * Binary-searches the frame index; the frame returned is at most one
+ * index interval before the frame actually holding @p ts_ns.  Same
+ * constraints and return values as @ref data_logger_seek_event.
+ */
+int data_logger_seek_time(uint64_t ts_ns, struct data_logger_seek *out);
+
+/** Most outputs a single @ref data_logger_convert_multi pass can feed. */
+#define DATA_LOGGER_CONVERT_MAX_OUT 4
+
+/**
+ * @brief One output of a multi-format conversion.
+ */
+struct data_logger_convert_out {
+	/** Target formatter (e.g. @c data_logger_influx_formatter). */
+	const struct data_logger_formatter *fmt;
+	/** Destination path for this output. */
+	const char *path;
+	/** Result for this output, set by @ref data_logger_convert_multi. */
+	int rc;
+};
+
+/**
+ * @brief Convert the live flight log to several text outputs in one pass.
+ *
+ * Same recovery rules as @ref data_logger_convert, but every frame is
+ * read from storage once and fed to all outputs in @p outs.  An output
+ * whose formatter fails records the error in its @c rc and is dropped
+ * from the pass; the others still run to the end of the log.
+ *
+ * @param outs  Outputs to produce; each @c rc is overwritten.
+ * @param n     Number of outputs, at most @ref DATA_LOGGER_CONVERT_MAX_OUT.
+ * @retval 0 if every output succeeded, else the first output's error.
+ * @retval -EINVAL on invalid arguments.
+ * @retval -EBUSY while a trailing conversion
+ *         (@ref data_logger_convert_trail_begin) is open.
+ */
+int data_logger_convert_multi(struct data_logger_convert_out *outs, size_t n);
+
+/**
+ * @brief One flight recorded in the disk backend's session catalogue.
+ */
+struct data_logger_session {
+	uint32_t number;          /**< Running flight number */
+	uint64_t flight_id;       /**< The flight's frame @c flight_id */
+	off_t    offset;          /**< Byte offset of its first frame */
+	uint32_t frames;          /**< Frames, or AURORA_BIN_SESSION_OPEN */
+	bool     converted;       /**< Already converted to text outputs */
+};
+
+/**
+ * @brief List the flights in the session catalogue, oldest first.
+ *
+ * @param out  Filled with up to @p max flights.
+ * @param max  Capacity of @p out.
+ * @retval >=0 number of flights written to @p out.
+ * @retval -ENOTSUP without @c CONFIG_DATA_LOGGER_DISK_SESSIONS.
+ * @retval other negative errno on a storage read error.
+ */
+int data_logger_sessions(struct data_logger_session *out, size_t max);
+
+/**
+ * @brief Convert one catalogued flight, like
+ *        @ref data_logger_convert_multi does for the newest one.
+ *
+ * Marks the flight converted in the catalogue once every output
+ * succeeded.  Same constraints and return values as
+ * @ref data_logger_convert_multi; -ENOTSUP without
+ * @c CONFIG_DATA_LOGGER_DISK_SESSIONS.
+ */
+int data_logger_convert_session(const struct data_logger_session *session,
+				struct data_logger_convert_out *outs, size_t n);
+
+/**
+ * @brief Describe the flight the live logger is writing.
+ *
+ * @c number is only set with @c CONFIG_DATA_LOGGER_DISK_SESSIONS and
+ * @c frames is always @c AURORA_BIN_SESSION_OPEN.
+ *
+ * @param out  Filled with the flight on success.
+ * @retval 0 on success.
+ * @retval -ENODEV if no flight is being logged.
+ * @retval -EINVAL if @p out is NULL.
+ * @retval -ENOTSUP without @c CONFIG_DATA_LOGGER_CONVERT_TRAIL.
+ */
+int data_logger_live_session(struct data_logger_session *out);
+
+/**
+ * @brief Start converting a flight while it is still being logged.
+ *
+ * Opens every output in @p outs and writes its header, like
+ * @ref data_logger_convert_multi, but converts nothing yet: each
+ * @ref data_logger_convert_trail_step converts the frames the disk
+ * writer has put on storage since the previous step, and
+ * @ref data_logger_convert_trail_end the rest once the logger is
+ * closed.  @p outs must stay valid until then, and no other conversion
+ * can run in between.  Requires @c CONFIG_DATA_LOGGER_CONVERT_TRAIL.
+ *
+ * @param live  The flight, from @ref data_logger_live_session.
+ * @param outs  Outputs to produce; each @c rc is overwritten.
+ * @param n     Number of outputs, at most @ref DATA_LOGGER_CONVERT_MAX_OUT.
+ * @retval 0 on success.
+ * @retval -EBUSY if a trailing conversion is already open.
+ * @retval -EINVAL on invalid arguments.
+ * @retval -ENOTSUP without @c CONFIG_DATA_LOGGER_CONVERT_TRAIL.
+ * @retval other negative errno if no output could be opened.
+ */
+int data_logger_convert_trail_begin(const struct data_logger_session *live,
+				    struct data_logger_convert_out *outs,
+				    size_t n);
+
+/**
+ * @brief Convert the frames written since the last step and flush them.
+ *
+ * @retval >=0 frames of the flight converted so far, all of them
+ *         flushed to the outputs.
+ * @retval -EINVAL if no trailing conversion is open.
+ * @retval other negative errno once every output has failed.
+ */
+int data_logger_convert_trail_step(void);
+
+/**
+ * @brief Convert the rest of the flight and close the outputs.
+ *
+ * Call once the logger has been closed.  With
+ * @c CONFIG_DATA_LOGGER_DISK_SESSIONS the flight is then marked
+ * converted if every output succeeded.
+ *
+ * @retval >=0 frames converted in total.
+ * @retval -EBUSY if the flight is still being logged.
+ * @retval -EINVAL if no trailing conversion is open.
+ * @retval other negative errno, the first failing output's error.
+ */
+int data_logger_convert_trail_end(void);
+
+/** Buckets of @ref data_logger_bin_stats::lat_hist. */
+#define DATA_LOGGER_BIN_STATS_BUCKETS 20
+
+/**
+ * @brief Writer-thread statistics of the live binary backend.
+ *
+ * Collected since the bin logger was last opened (or since
+ * @ref data_logger_bin_stats_reset).  Only storage writes of data
+ * frames are counted; index and catalogue updates are not.
+ */
+struct data_logger_bin_stats {
+	/** Storage writes by latency: bucket 0 is below 1 µs, bucket
+	 *  i > 0 covers [2^(i-1), 2^i) µs, the last bucket is open-ended.
+	 */
+	uint32_t lat_hist[DATA_LOGGER_BIN_STATS_BUCKETS];
+	uint32_t lat_max_us;      /**< Slowest storage write */
+	uint32_t writes;          /**< Storage write calls */
+	uint32_t frames;          /**< Frames written */
+	uint64_t bytes;           /**< Bytes written */
+	uint32_t stalls;          /**< Producer waits for a free frame buffer */
+	uint32_t ring_max;        /**< Peak frames queued for the writer */
+	uint32_t ring_size;       /**< Frames the writer queue can hold */
+};
+
+/**
+ * @brief Snapshot the binary backend's writer statistics.
+ *
+ * Requires @c CONFIG_DATA_LOGGER_BIN_STATS.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p out is NULL.
+ */
+int data_logger_bin_stats(struct data_logger_bin_stats *out);
+
+/** @brief Clear the writer statistics; @c ring_size is kept. */
+void data_logger_bin_stats_reset(void);
+
+/**
+ * @brief Counters of the flash mirror of the disk backend.
+ *
+ * Collected since the bin logger was last opened.
+ */
+struct data_logger_bin_mirror_stats {
+	uint32_t frames;          /**< Frames written to flash */
+	uint32_t decimated;       /**< Frames skipped while falling behind */
+	uint32_t dropped;         /**< Frames lost to a full queue or flash */
+	uint32_t queue_max;       /**< Peak frames queued for the mirror */
+	bool     disk_lost;       /**< The card failed; flash is the only copy */
+};
+
+/**
+ * @brief Snapshot the flash mirror's counters.
+ *
+ * Requires @c CONFIG_DATA_LOGGER_BIN_MIRROR.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p out is NULL.
+ */
+int data_logger_bin_mirror_stats(struct data_logger_bin_mirror_stats *out);
+
+/**
+ * @brief Result of @ref data_logger_disk_bench.
+ *
+ * Throughputs count transfer time only.  The card qualifies (@c pass)
+ * when every frame read back intact, the write throughput is at least
+ * @c CONFIG_DATA_LOGGER_DISK_BENCH_MARGIN_PCT of @c need_kibps, the
+ * 99th percentile write fits in @c batch_us and the slowest one in
+ * @c ring_us.
+ */
+struct data_logger_disk_bench_result {
+	uint32_t frames;          /**< Frames written and read back */
+	uint32_t batch_frames;    /**< Frames per disk access */
+	uint32_t writes;          /**< Disk writes, and as many reads */
+	uint32_t first_sector;    /**< First disk sector tested */
+	uint32_t write_kibps;     /**< Sustained write throughput (KiB/s) */
+	uint32_t write_p99_us;    /**< 99th percentile write latency */
+	uint32_t write_max_us;    /**< Slowest write */
+	uint32_t read_kibps;      /**< Sustained read throughput (KiB/s) */
+	uint32_t read_p99_us;     /**< 99th percentile read latency */
+	uint32_t read_max_us;     /**< Slowest read */
+	uint32_t bad_frames;      /**< Frames that read back wrong */
+	uint32_t need_kibps;      /**< Log throughput at the sample rate */
+	uint32_t batch_us;        /**< Time the sample rate fills a batch in */
+	uint32_t ring_us;         /**< Time it fills the ring slots free
+				   *   during a write in
+				   */
+	bool     pass;            /**< The card qualifies */
+};
+
+/**
+ * @brief Benchmark the card under the disk backend's flight-log region.
+ *
+ * Writes @p frames frames of a test pattern to the end of the region
+ * in batches like the live writer's, reads them back and checks them.
+ * The frames tested are overwritten.  With
+ * @c CONFIG_DATA_LOGGER_DISK_SESSIONS the run is refused if they hold
+ * a kept flight.  Not while a conversion is running.  Requires
+ * @c CONFIG_DATA_LOGGER_DISK_BENCH.
+ *
+ * @param frames        Frames to test, 0 for
+ *                      @c CONFIG_DATA_LOGGER_DISK_BENCH_FRAMES; cut to
+ *                      the region and to
+ *                      @c CONFIG_DATA_LOGGER_DISK_BENCH_MAX_WRITES
+ *                      batches.
+ * @param batch_frames  Frames per disk access, 0 for
+ *                      @c CONFIG_DATA_LOGGER_BIN_MAX_BATCH_FRAMES; at
+ *                      most one less than the ring.
+ * @param out           Receives the result.
+ * @retval 0 when the run completed; see @c out->pass for the verdict.
+ * @retval -EINVAL if @p out is NULL.
+ * @retval -EBUSY while the bin logger is open.
+ * @retval -ENOSPC if the region is too small or the frames hold a
+ *         kept flight.
+ * @retval other negative errno from the disk.
+ */
+int data_logger_disk_bench(uint32_t frames, uint32_t batch_frames,
+			   struct data_logger_disk_bench_result *out);
+
+/**
+ * @brief Called by @ref data_logger_export for every frame of the flight.
+ *
+ * @param frame      One raw frame, @c CONFIG_DATA_LOGGER_BIN_FRAME_SIZE
+ *                   bytes, header included.
+ * @param len        Length of @p frame.
+ * @param user_data  As passed to @ref data_logger_export.
+ * @return 0 to continue, or a negative errno to stop the export.
+ */
+typedef int (*data_logger_export_cb_t)(const void *frame, size_t len,
+				       void *user_data);
+
+/**
+ * @brief Hand the newest flight's raw frames to @p cb, oldest first.
+ *
+ * Locates and walks the window exactly like @ref data_logger_convert
+ * but does not decode anything, so the frames can be shipped as they
+ * are and turned into text on the host.  Same constraints as
+ * @ref data_logger_convert.
+ *
+ * @retval >=0 number of frames passed to @p cb (0 for an empty log).
+ * @retval -EINVAL if @p cb is NULL.
+ * @retval other negative errno from storage or from @p cb.
+ */
+int data_logger_export(data_logger_export_cb_t cb, void *user_data);
+
+/**
+ * @brief Part of the newest flight selected by @ref data_logger_dump.
+ *
+ * A frame is dumped if its @c seq lies in [@c first_seq, @c last_seq]
+ * and its @c base_ts_ns in [@c from_ns, @c to_ns].  The records of the
+ * frame that straddles @c from_ns are therefore not included.
+ */
+struct data_logger_dump_range {
+	uint32_t first_seq;       /**< First frame; 0 for the window start */
+	uint32_t last_seq;        /**< Last frame, UINT32_MAX for no limit */
+	uint64_t from_ns;         /**< Earliest @c base_ts_ns, 0 for none */
+	uint64_t to_ns;           /**< Latest @c base_ts_ns, UINT64_MAX for none */
+};
+
+/**
+ * @brief Hand a range of the newest flight's raw frames to @p cb.
+ *
+ * Like @ref data_logger_export, but reads up to
+ * @c CONFIG_DATA_LOGGER_DUMP_BATCH_FRAMES frames per storage access and
+ * passes @p cb runs of consecutive frames (@p len a multiple of the
+ * frame size).  With @c CONFIG_DATA_LOGGER_BIN_INDEX the start of a
+ * time range is found through the frame index, so the frames before it
+ * are never read.  Same constraints as @ref data_logger_convert.
+ *
+ * @param range      Frames to dump.
+ * @param cb         Receives the frames, oldest first.
+ * @param user_data  Passed to @p cb.
+ * @retval >=0 number of frames passed to @p cb.
+ * @retval -EINVAL if @p range or @p cb is NULL or @p range is empty.
+ * @retval -ENOTSUP without @c CONFIG_DATA_LOGGER_DUMP.
+ * @retval other negative errno from storage or from @p cb.
+ */
+int data_logger_dump(const struct data_logger_dump_range *range,
+		     data_logger_export_cb_t cb, void *user_data);
+
+/**
+ * @name Raw export stream
+ *
+ * @ref data_logger_export_uart sends an @ref aurora_bin_export_header,
+ * the frames of the newest flight back to back, and an
+ * @ref aurora_bin_export_trailer carrying the frame count and the
+ * CRC-32 (IEEE) of all frame bytes.  tools/aurora_export.py reads it.
+ * @{
+ */
+
+/** 4-byte magic at the start of an export stream. */
+#define AURORA_BIN_EXPORT_MAGIC "AEXP"
+
+/** 4-byte magic of the trailer that ends an export stream. */
+#define AURORA_BIN_EXPORT_END_MAGIC "AEXE"
+
+/** Version of the export stream framing. */
+#define AURORA_BIN_EXPORT_VERSION 1U
+
+/** Export stream header (12 bytes). */
+struct aurora_bin_export_header {
+	char     magic[4];        /**< @ref AURORA_BIN_EXPORT_MAGIC */
+	uint16_t version;         /**< @ref AURORA_BIN_EXPORT_VERSION */
+	uint16_t reserved;        /**< Zero */
+	uint32_t frame_size;      /**< Bytes per frame that follows */
+} __packed;
+
+/** Export stream trailer (12 bytes). */
+struct aurora_bin_export_trailer {
+	char     magic[4];        /**< @ref AURORA_BIN_EXPORT_END_MAGIC */
+	uint32_t frames;          /**< Frames sent */
+	uint32_t crc32;           /**< crc32_ieee() over all frame bytes */
+} __packed;
+
+/** @} */
+
+/**
+ * @brief Stream the newest flight to the @c auxspace,data-export UART.
+ *
+ * Meant for a dedicated USB CDC ACM port: the frames go out as raw
+ * bytes, so the port must not also carry the shell or the log.
+ * Requires @c CONFIG_DATA_LOGGER_EXPORT.
+ *
+ * @retval >=0 number of frames sent.
+ * @retval -ENODEV if the export UART is not ready.
+ * @retval -ETIMEDOUT if the host stopped reading.
+ * @retval other negative errno from @ref data_logger_export.
+ */
+int data_logger_export_uart(void);
+
 /** @} */
 
 /** @} */
@@ -418,12 +1272,20 @@ extern atomic_t sm_logger_live;
 extern struct k_sem convert_idle;
 extern struct k_sem convert_request;
 
-/* Decouple logging from the SM hot path: SM pushes datapoints into this
- * queue with K_NO_WAIT; a dedicated logger thread drains it and owns all
- * FS-touching operations (write + periodic flush). Sized to absorb the
- * worst-case flush stall at full IMU+baro rate.
+/* Decouple logging from the SM hot path: SM pushes datapoints into a
+ * lock-free multi-producer/single-consumer ring without ever blocking;
+ * a dedicated logger thread drains it and owns all FS-touching operations
+ * (write + periodic flush). Sized to absorb the worst-case flush stall at
+ * full IMU+baro rate. Must be a power of two.
  */
 #define LOG_MSGQ_DEPTH 256
+
+/* Fill level at or above which every enqueue wakes the logger thread;
+ * below it the logger picks samples up on its flush-period timeout.
+ */
+#define LOG_QUEUE_WAKE_WATERMARK (LOG_MSGQ_DEPTH / 8)
+/* Most samples handed to the formatter per data_logger_log_batch() call. */
+#define LOG_DRAIN_BATCH 32
 #define LOG_FLUSH_PERIOD_MS 1000
 
 /* How long SM→ARMED will wait for a pending conversion to finish. */
@@ -431,6 +1293,17 @@ extern struct k_sem convert_request;
 
 void pick_convert_out_base(char *out, size_t out_sz);
 void converter_task(void *, void *, void *);
+/* Safe from any thread; the SM and fusion threads both produce. */
 void log_enqueue(const struct datapoint *dp);
+/* Samples currently queued / dropped on overflow since boot. */
+uint32_t log_queue_used(void);
+uint32_t log_queue_dropped(void);
+/* Log one sensor sample. With CONFIG_DATA_LOGGER_BIN_ZERO_COPY it is written
+ * straight into sm_logger's live frame via data_logger_reserve()/commit()
+ * while the sample queue is empty, falling back to log_enqueue() whenever
+ * samples are queued or the reserve would block.
+ */
+void log_record(enum aurora_data type, uint64_t timestamp_ns,
+		const struct sensor_value *channels, uint8_t channel_count);
 void logger_task(void *, void *, void *);
 #endif /* AURORA_LIB_DATA_LOGGER_H_ */
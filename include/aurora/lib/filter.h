@@ -7,6 +7,7 @@
 #define APP_LIB_FILTER_H_
 
 #include <inttypes.h>
+#include <stddef.h>
 
 /**
  * @defgroup lib_filter Input filter
@@ -20,26 +21,51 @@
 #define FILTER_SCALE_DIVISOR 1000.0
 
 /**
- * @brief 2-state Kalman filter structure for rocket state machine.
+ * @brief Arithmetic type of the filter state and inputs.
+ *
+ * @c float with @c CONFIG_FILTER_FLOAT, @c double otherwise.
+ */
+#if defined(CONFIG_FILTER_FLOAT)
+typedef float filter_real_t;
+#else
+typedef double filter_real_t;
+#endif /* CONFIG_FILTER_FLOAT */
+
+/**
+ * @brief Length of the filter state vector.
+ *
+ * 3 with @c CONFIG_FILTER_KALMAN3, 2 otherwise.
+ */
+#if defined(CONFIG_FILTER_KALMAN3)
+#define FILTER_NUM_STATES 3
+#else
+#define FILTER_NUM_STATES 2
+#endif /* CONFIG_FILTER_KALMAN3 */
+
+/**
+ * @brief Kalman filter structure for rocket state machine.
  *
  * State vector:
  *      x[0] = altitude (m)
  *      x[1] = vertical velocity (m/s)
+ *      x[2] = vertical accel bias (m/s^2), @c CONFIG_FILTER_KALMAN3 only
  *
  * The filter uses a constant-acceleration model with vertical acceleration
  * supplied as a control input to filter_predict(), and barometric altitude
  * as the measurement input.  Passing a_vert = 0.0 reduces the model to
- * constant-velocity behavior.
+ * constant-velocity behavior.  The 3-state backend integrates
+ * a_vert - x[2] instead of a_vert, and estimates x[2] as a random walk
+ * from the baro innovations.
  */
 struct filter {
-    double state[2];         /**< State vector [altitude, velocity]. */
-    double covariance[2][2]; /**< State covariance matrix P. */
-    double noise_p[2][2];    /**< Process noise covariance Q. */
-    double noise_m;          /**< Measurement noise variance R. */
+    filter_real_t state[FILTER_NUM_STATES]; /**< State vector x. */
+    filter_real_t covariance[FILTER_NUM_STATES][FILTER_NUM_STATES]; /**< State covariance matrix P. */
+    filter_real_t noise_p[FILTER_NUM_STATES][FILTER_NUM_STATES];    /**< Process noise covariance Q. */
+    filter_real_t noise_m;          /**< Measurement noise variance R. */
 
     /* Multi-criterion apogee detection state. */
-    double peak_altitude;    /**< Highest altitude estimate seen so far (m). */
-    double last_accel_vert;  /**< Most recent world-vertical accel (m/s^2). */
+    filter_real_t peak_altitude;    /**< Highest altitude estimate seen so far (m). */
+    filter_real_t last_accel_vert;  /**< Most recent world-vertical accel (m/s^2). */
     int consecutive_apogee;  /**< Count of consecutive samples meeting criteria. */
     int apogee_latched;      /**< Non-zero once apogee has been reported. */
 
@@ -75,7 +101,65 @@ int filter_init(struct filter *filter);
  * @retval 0 on success.
  * @retval -EINVAL if @p filter is NULL or @p dt <= 0.
  */
-int filter_predict(struct filter *filter, int64_t dt, double a_vert);
+int filter_predict(struct filter *filter, int64_t dt, filter_real_t a_vert);
+
+/**
+ * @brief One IMU sample of a batch prediction.
+ */
+struct filter_sample {
+    int64_t dt;            /**< Nanoseconds since the previous sample. */
+    filter_real_t a_vert;  /**< World-frame vertical acceleration (m/s^2). */
+};
+
+/**
+ * @brief Predict across a batch of IMU samples in one pass.
+ *
+ * Equivalent to calling filter_predict() once per sample, but the
+ * covariance is propagated once for the whole batch: with the
+ * constant-acceleration model the transition matrices compose to
+ * F(T), and the process noise of every sample is carried to the end of
+ * the batch in closed form.  Only altitude and velocity are stepped per
+ * sample.  Intended for a FIFO block covering one baro interval.
+ *
+ * The batch is validated before any state changes: every @c dt must be
+ * positive and their sum must not exceed the 1-second clamp.
+ *
+ * @param filter  Pointer to filter structure.
+ * @param samples IMU samples in capture order.
+ * @param count   Number of samples.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if a pointer is NULL, @p count is 0, a @c dt is
+ *         not positive or the batch spans more than one second.
+ */
+int filter_predict_batch(struct filter *filter,
+                         const struct filter_sample *samples, size_t count);
+
+/**
+ * @brief Multi-rate step: batch predict, then one baro update.
+ *
+ * Runs filter_predict_batch() over the IMU samples since the last baro
+ * reading and applies the measurement @p z with filter_update().
+ *
+ * @param filter  Pointer to filter structure.
+ * @param samples IMU samples covering the baro interval.
+ * @param count   Number of samples.
+ * @param z       Measured altitude in meters.
+ *
+ * @return filter_update() result, or -EINVAL if the batch is rejected
+ *         (the measurement is then not applied).
+ */
+int filter_step(struct filter *filter, const struct filter_sample *samples,
+                size_t count, filter_real_t z);
+
+/**
+ * @brief Variance of the filtered vertical velocity.
+ *
+ * @param filter Pointer to filter structure.
+ *
+ * @return P[1][1] in (m/s)^2, or a negative value if @p filter is NULL.
+ */
+filter_real_t filter_velocity_variance(const struct filter *filter);
 
 /**
  * @brief Perform the filter measurement update step.
@@ -99,7 +183,7 @@ int filter_predict(struct filter *filter, int64_t dt, double a_vert);
  * @retval -EINVAL if @p filter is NULL.
  * @retval -EDOM   if the innovation covariance is singular.
  */
-int filter_update(struct filter *filter, double z);
+int filter_update(struct filter *filter, filter_real_t z);
 
 /**
  * @brief Detect apogee using a three-criterion vote.
@@ -108,6 +192,9 @@ int filter_update(struct filter *filter, double z);
  *   1. Filtered vertical velocity is non-positive.  Velocity is the
  *      leading indicator at apogee, so no hysteresis band is applied
  *      beyond the debounce below — it would only delay detection.
+ *      With @c CONFIG_FILTER_APOGEE_VEL_SIGMA_MILLISCALE set, it must
+ *      also be that many standard deviations (from
+ *      filter_velocity_variance()) below zero.
  *   2. Filtered altitude is below the tracked peak, guarding against
  *      pad-side triggers where velocity jitter could briefly go
  *      negative before launch.
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_HEALTH_H_
+#define APP_LIB_HEALTH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @defgroup lib_health Thread health monitor
+ * @ingroup lib
+ * @{
+ *
+ * @brief Runtime CPU and stack usage of every thread.
+ *
+ * A low-priority sampler thread walks the thread list every
+ * @c CONFIG_AURORA_HEALTH_PERIOD_MS and records, per thread, its share
+ * of the CPU since the previous sample and the most stack it has ever
+ * used.  The latest sample is kept for the shell and the pad link and,
+ * with @c CONFIG_AURORA_HEALTH_FLIGHT_LOG, written to the flight log as
+ * @c AURORA_DATA_THREAD_HEALTH records.
+ */
+
+/** Longest thread name kept in a sample, excluding the terminator. */
+#define HEALTH_NAME_LEN 16
+
+/** @brief One thread in a sample. */
+struct health_thread {
+	char name[HEALTH_NAME_LEN + 1]; /**< Thread name, truncated.          */
+	uint32_t load_ppm;              /**< CPU share since the previous
+					 *   sample, in millionths.
+					 */
+	uint32_t stack_size;            /**< Stack size (bytes).              */
+	uint32_t stack_used;            /**< Stack high-water mark (bytes).   */
+};
+
+/**
+ * @brief Take a sample now.
+ *
+ * Replaces the latest sample.  The sampler thread calls this every
+ * period; calling it in between shortens the period the loads of the
+ * next sample are averaged over.  Scans every thread's stack, so it
+ * takes a while; do not call it from a flight-critical thread.
+ *
+ * @retval 0 on success.
+ * @retval -EAGAIN a sample is already being taken.
+ */
+int health_sample(void);
+
+/**
+ * @brief Copy the latest sample.
+ *
+ * Safe to call from any thread; never blocks on the sampler.
+ *
+ * @param out        Receives up to @p max threads, in thread-list order.
+ * @param max        Capacity of @p out.
+ * @param uptime_ms  Optional; receives the time of the sample, or 0
+ *                   before the first one.
+ * @return Number of threads copied.
+ */
+size_t health_get(struct health_thread *out, size_t max, int64_t *uptime_ms);
+
+/**
+ * @brief Number of threads the latest sample left out.
+ *
+ * Non-zero when more than @c CONFIG_AURORA_HEALTH_MAX_THREADS threads
+ * exist.
+ */
+uint32_t health_skipped(void);
+
+/** @} */
+
+#endif /* APP_LIB_HEALTH_H_ */
@@ -10,6 +10,7 @@
 #include <zephyr/drivers/sensor.h>
 #include <zephyr/zbus/zbus.h>
 
+#include <aurora/lib/sample.h>
 
 /**
  * @defgroup lib_imu IMU library
@@ -30,12 +31,19 @@ ZBUS_CHAN_DECLARE(imu_data_chan);
  *
  * carries the measurement data from the IMU, including accelerometer and
  * gyroscope readings for the x, y, and z axes.  This struct is used as a
- * z-bus message payload for IMU data updates
+ * z-bus message payload for IMU data updates.  Readings are
+ * @ref aurora_sample_t, in millionths of m/s^2 and rad/s, converted once
+ * by the producer.  @c timestamp_ns is the
+ * sample's capture time (the hardware FIFO timestamp with
+ * @c CONFIG_IMU_STREAM, otherwise the uptime right before the fetch), so
+ * consumers can integrate without their own scheduling latency.
  */
 struct imu_data
 {
-	struct sensor_value accel[IMU_NUM_AXES]; /**< Latest accelerometer readings (x, y, z). */
-	struct sensor_value gyro[IMU_NUM_AXES];  /**< Latest gyroscope readings (x, y, z). */
+	aurora_sample_t accel[IMU_NUM_AXES]; /**< Latest accelerometer readings (x, y, z). */
+	aurora_sample_t gyro[IMU_NUM_AXES];  /**< Latest gyroscope readings (x, y, z). */
+	uint64_t timestamp_ns; /**< Capture time in ns since boot, taken by the producer. */
+	uint8_t instance; /**< Producing IMU, 0 to CONFIG_IMU_INSTANCES - 1. */
 };
 
 #if !defined(CONFIG_IMU_TRIGGER)
@@ -50,6 +58,22 @@ struct imu_data
 int imu_poll(const struct device *dev);
 #endif /* CONFIG_IMU_TRIGGER */
 
+#if defined(CONFIG_IMU_STREAM)
+/**
+ * @brief Wait for the next IMU FIFO block and publish its samples.
+ *
+ * Blocks until the driver completes a FIFO watermark read, decodes the
+ * accelerometer and gyroscope frames and publishes each sample on
+ * @c imu_data_chan in FIFO order. The stream is armed by imu_init() and
+ * re-armed here if a read fails.
+ *
+ * @param dev Pointer to the IMU device.
+ *
+ * @return Number of samples published, or a negative errno on failure.
+ */
+int imu_read_batch(const struct device *dev);
+#endif /* CONFIG_IMU_STREAM */
+
 /**
  * @brief Set the IMU accelerometer and gyroscope sampling frequency.
  *
@@ -64,15 +88,34 @@ int imu_set_sampling_freq(const struct device *dev, int sampling_rate_hz);
 /**
  * @brief Initialize the IMU device.
  *
- * Checks device readiness and configures the sampling frequency.
+ * Checks device readiness. In trigger mode it installs the data-ready
+ * handler; with @c CONFIG_IMU_STREAM it sets the output data rate to
+ * @c CONFIG_IMU_FREQUENCY and arms the FIFO stream.
  *
  * @param dev Pointer to the IMU device.
  *
  * @retval 0 on success.
  * @retval -ENODEV if the device is not ready.
+ * @retval -errno Other negative errno if the stream could not be armed.
  */
 int imu_init(const struct device *dev);
 
+/**
+ * @brief Initialize one of several redundant IMUs.
+ *
+ * Same as imu_init(), and every sample of @p dev is published with
+ * @c instance set to @p instance. imu_init() is instance 0.
+ *
+ * @param dev      Pointer to the IMU device.
+ * @param instance Instance number, below @c CONFIG_IMU_INSTANCES.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p instance is out of range.
+ * @retval -ENODEV if the device is not ready.
+ * @retval -errno Other negative errno if the stream could not be armed.
+ */
+int imu_init_instance(const struct device *dev, uint8_t instance);
+
 /**
  * @brief calculate the average acceleration from IMU sensor values in m/s^2.
  *
@@ -7,6 +7,7 @@
 #define APP_LIB_NOTIFY_H_
 
 #include <aurora/lib/state/state.h>
+#include <zephyr/kernel.h>
 
 /**
  * @defgroup lib_notify Notification library
@@ -19,6 +20,11 @@
  * output devices (buzzer, RGB LED, …).  Each backend registers a
  * static @ref notify_backend and the library fans out every call to
  * all enabled backends.
+ *
+ * With CONFIG_AURORA_NOTIFY_ASYNC the notify_*() calls (except
+ * notify_init()) only post an event and return 0; the backends run in
+ * order on a dedicated work queue and their errors are logged there.
+ * The calls are then safe from ISRs.
  */
 
 /**
@@ -118,6 +124,18 @@ void notify_powerfail(int recover);
  */
 int notify_error(void);
 
+#if defined(CONFIG_AURORA_NOTIFY_ASYNC) || defined(__DOXYGEN__)
+/**
+ * @brief Work queue the notification backends run on.
+ *
+ * Backends may submit their own deferred work (timeouts, pattern
+ * steps) here to keep it off the system work queue.
+ *
+ * @return The notify work queue, started at boot.
+ */
+struct k_work_q *notify_work_q(void);
+#endif /* CONFIG_AURORA_NOTIFY_ASYNC */
+
 /** @} */
 
 #endif /* APP_LIB_NOTIFY_H_ */
@@ -6,6 +6,7 @@
 #ifndef AURORA_LIB_PAD_LINK_H_
 #define AURORA_LIB_PAD_LINK_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <aurora/lib/state/state.h>
@@ -47,7 +48,9 @@
  *   [16]   GPS/GNSS    1 = gps data valid (a6, planned)
  *   [23:17] reserved
  *
- * Byte 3 — reserved
+ * Byte 3 — Pyro group
+ *   [24]   Pyro        1 = pyro status valid (aa)
+ *   [31:25] reserved
  */
 enum pl_cap_imu_type {
 	PL_CAP_IMU_TYPE_NONE = 0x0,
@@ -66,6 +69,24 @@ enum pl_cap_imu_type {
 
 #define PL_CAP_GPS            (1u << 16)
 
+#define PL_CAP_PYRO           (1u << 24)
+
+/** Most pyro channels the pyro characteristic (aa) carries. */
+#define PL_PYRO_MAX_CHANNELS  4
+
+/* Per-channel pyro flags, as published on characteristic aa. */
+#define PL_PYRO_F_CAP_VALID   (1u << 0)
+#define PL_PYRO_F_SENSE_VALID (1u << 1)
+#define PL_PYRO_F_ARMED       (1u << 2)
+#define PL_PYRO_F_FIRED       (1u << 3)
+
+/** @brief Status of one pyro channel, see pad_link_publish_pyro(). */
+struct pad_link_pyro_channel {
+	uint32_t cap_mv;   /**< Capacitor voltage (mV). */
+	uint32_t sense_mv; /**< Continuity sense reading (mV). */
+	uint8_t  flags;    /**< PL_PYRO_F_* */
+};
+
 /**
  * @brief Bring up the BLE stack and start advertising.
  *
@@ -108,6 +129,22 @@ void pad_link_set_caps(uint32_t caps);
 void pad_link_publish_sm(enum sm_state state, enum sm_type type,
 			 const struct sm_inputs *inputs);
 
+/**
+ * @brief Publish the continuity and charge status of the pyro channels.
+ *
+ * Updates the pyro characteristic (aa) snapshot. A change of any
+ * channel's flags (armed, fired, reading lost) is notified at once,
+ * voltages at most every @c CONFIG_AURORA_PAD_LINK_PYRO_PERIOD_MS.
+ * Feed it from a cached source such as @c pyro_get_status so the
+ * caller never waits for an ADC. Safe to call from the SM thread;
+ * never blocks.
+ *
+ * @param ch  Channel status, @p n entries. Channels beyond
+ *            @c PL_PYRO_MAX_CHANNELS are ignored.
+ * @param n   Number of channels.
+ */
+void pad_link_publish_pyro(const struct pad_link_pyro_channel *ch, size_t n);
+
 /** @} */
 
 #endif /* AURORA_LIB_PAD_LINK_H_ */
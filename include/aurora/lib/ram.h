@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_RAM_H_
+#define APP_LIB_RAM_H_
+
+#include <zephyr/devicetree.h>
+#include <zephyr/linker/section_tags.h>
+#include <zephyr/toolchain.h>
+
+/**
+ * @defgroup lib_ram RAM placement
+ * @{
+ *
+ * @brief Section tags that move hot state and log rings out of @c .bss.
+ *
+ * Both tags expand to nothing unless the board provides the memory, so
+ * the tagged objects stay ordinary zero-initialised statics everywhere
+ * else. Either way the objects read as zero at boot. Only use them on
+ * objects without an initialiser.
+ */
+
+/**
+ * @brief Fast RAM: filter, attitude and state machine hot data.
+ *
+ * With @c CONFIG_AURORA_RAM_FAST the object goes to the memory region
+ * chosen as @c auxspace,fast-ram, else to the DTCM (@c zephyr,dtcm) or
+ * CCM (@c zephyr,ccm) of the SoC.
+ */
+#if defined(CONFIG_AURORA_RAM_FAST_REGION)
+#define __aurora_fast Z_GENERIC_SECTION(.aurora_fast_bss)
+#elif defined(CONFIG_AURORA_RAM_FAST) && DT_HAS_CHOSEN(zephyr_dtcm)
+#define __aurora_fast __dtcm_bss_section
+#elif defined(CONFIG_AURORA_RAM_FAST) && DT_HAS_CHOSEN(zephyr_ccm)
+#define __aurora_fast __ccm_bss_section
+#else
+#define __aurora_fast
+#endif
+
+/**
+ * @brief DMA RAM: the binary writer's rings and the log rings.
+ *
+ * With @c CONFIG_AURORA_RAM_DMA the object goes to the memory region
+ * chosen as @c auxspace,dma-ram. The section starts and ends on a
+ * @c CONFIG_DATA_LOGGER_BIN_BUF_ALIGN boundary; objects keep their own
+ * alignment within it.
+ */
+#if defined(CONFIG_AURORA_RAM_DMA)
+#define __aurora_dma Z_GENERIC_SECTION(.aurora_dma_bss)
+#else
+#define __aurora_dma
+#endif
+
+/** @} */
+
+#endif /* APP_LIB_RAM_H_ */
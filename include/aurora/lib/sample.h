@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_SAMPLE_H_
+#define APP_LIB_SAMPLE_H_
+
+#include <stdint.h>
+
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/sys/util.h>
+
+/**
+ * @defgroup lib_sample Fixed-point sensor samples
+ * @ingroup lib
+ * @{
+ *
+ * @brief Compact sample type of the IMU and barometer z-bus messages.
+ *
+ * A sample is one sensor channel in millionths of its SI unit (the
+ * unit of the matching Zephyr sensor channel: m/s^2, rad/s, degrees
+ * Celsius, kPa), i.e. the sensor_value pair @c val1 * 10^6 + @c val2
+ * in one int32_t.  That covers +-2147 of the unit at full
+ * sensor_value resolution, enough for every channel we publish, in
+ * half the space of a sensor_value.  Producers convert once at the
+ * driver edge; consumers that want a float use the helpers below.
+ */
+
+/** Sample value in millionths of the channel's unit. */
+typedef int32_t aurora_sample_t;
+
+/** Samples per unit. */
+#define AURORA_SAMPLE_SCALE 1000000
+
+/**
+ * @brief Convert a reading in millionths, saturating at the sample range.
+ *
+ * @param micro Reading in millionths of the unit.
+ * @return The sample.
+ */
+static inline aurora_sample_t aurora_sample_from_micro(int64_t micro)
+{
+	return (aurora_sample_t)CLAMP(micro, INT32_MIN, INT32_MAX);
+}
+
+/**
+ * @brief Convert a sensor_value, saturating at the sample range.
+ *
+ * @param val Reading as returned by sensor_channel_get().
+ * @return The sample.
+ */
+static inline aurora_sample_t aurora_sample_from_sensor_value(const struct sensor_value *val)
+{
+	return aurora_sample_from_micro((int64_t)val->val1 * AURORA_SAMPLE_SCALE +
+					val->val2);
+}
+
+/**
+ * @brief Convert a value in the channel's unit, rounding to nearest.
+ *
+ * @param v Value in the channel's unit.
+ * @return The sample.
+ */
+static inline aurora_sample_t aurora_sample_from_double(double v)
+{
+	const double micro = v * AURORA_SAMPLE_SCALE;
+
+	return aurora_sample_from_micro((int64_t)(micro < 0.0 ? micro - 0.5 : micro + 0.5));
+}
+
+/**
+ * @brief Convert to a sensor_value, losslessly.
+ *
+ * @param s   Sample.
+ * @param val Receives the reading.
+ */
+static inline void aurora_sample_to_sensor_value(aurora_sample_t s, struct sensor_value *val)
+{
+	val->val1 = s / AURORA_SAMPLE_SCALE;
+	val->val2 = s % AURORA_SAMPLE_SCALE;
+}
+
+/**
+ * @brief Convert to a double in the channel's unit.
+ *
+ * @param s Sample.
+ * @return The value in the channel's unit.
+ */
+static inline double aurora_sample_to_double(aurora_sample_t s)
+{
+	return (double)s / AURORA_SAMPLE_SCALE;
+}
+
+/**
+ * @brief Convert to a float in the channel's unit.
+ *
+ * @param s Sample.
+ * @return The value in the channel's unit.
+ */
+static inline float aurora_sample_to_float(aurora_sample_t s)
+{
+	return (float)s * (1.0f / AURORA_SAMPLE_SCALE);
+}
+
+/** @} */
+
+#endif /* APP_LIB_SAMPLE_H_ */
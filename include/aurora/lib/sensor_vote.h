@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_SENSOR_VOTE_H_
+#define APP_LIB_SENSOR_VOTE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @defgroup lib_sensor_vote Redundant sensor voting
+ * @ingroup lib
+ * @{
+ *
+ * @brief Median and consistency voting across redundant sensors.
+ *
+ * Each instance of one sensor type submits its samples as it produces
+ * them. A sample is checked against the per-channel median of the
+ * latest fresh sample of every healthy instance. With two instances
+ * the last voted output is the third vote, so a single glitching
+ * sensor cannot drag the reference along. A sample further than the
+ * channel's tolerance from the median is rejected; an instance with
+ * @c CONFIG_SENSOR_VOTE_FAULT_LIMIT rejections in a row stops voting
+ * until one of its samples agrees again.
+ */
+
+/** Most instances of one sensor type. */
+#define SENSOR_VOTE_MAX_INSTANCES 4
+
+/** Most channels per sample (IMU: 3 accel + 3 gyro). */
+#define SENSOR_VOTE_MAX_CHANNELS 6
+
+/** @brief What sensor_vote_submit() hands on. */
+enum sensor_vote_mode {
+	/**
+	 * One median sample per round, once every healthy instance has
+	 * reported (or the oldest report went stale). For sensors that
+	 * are sampled together, e.g. IMUs on one timer.
+	 */
+	SENSOR_VOTE_MEDIAN,
+	/**
+	 * Every accepted sample as it is. For sensors sampled at a phase
+	 * offset, e.g. two barometers interleaved for twice the rate.
+	 */
+	SENSOR_VOTE_PASS,
+};
+
+/** @brief Voting state of one sensor type. Treat as opaque. */
+struct sensor_vote {
+	enum sensor_vote_mode mode;
+	uint8_t instances;
+	uint8_t channels;
+	const double *tolerance;
+	uint64_t max_age_ns;
+
+	double last[SENSOR_VOTE_MAX_INSTANCES][SENSOR_VOTE_MAX_CHANNELS];
+	uint64_t last_ns[SENSOR_VOTE_MAX_INSTANCES];
+	uint8_t faults[SENSOR_VOTE_MAX_INSTANCES];
+	/** Instances that reported since the last median output. */
+	uint8_t pending;
+	/** Rejected samples per instance since init. */
+	uint32_t rejected[SENSOR_VOTE_MAX_INSTANCES];
+	/** Timestamp of the first sample. */
+	uint64_t start_ns;
+
+	double out[SENSOR_VOTE_MAX_CHANNELS];
+	bool have_out;
+};
+
+/**
+ * @brief Reset @p v for @p instances sensors of @p channels channels.
+ *
+ * @param v          Voting state.
+ * @param mode       Output mode.
+ * @param instances  Number of instances, 1 to SENSOR_VOTE_MAX_INSTANCES.
+ * @param channels   Channels per sample, 1 to SENSOR_VOTE_MAX_CHANNELS.
+ * @param tolerance  Largest distance from the median per channel, in
+ *                   channel units. Must outlive @p v.
+ * @param max_age_ns Samples older than this (relative to the newest)
+ *                   do not vote.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if a count is out of range or @p tolerance is NULL.
+ */
+int sensor_vote_init(struct sensor_vote *v, enum sensor_vote_mode mode,
+		     uint8_t instances, uint8_t channels,
+		     const double *tolerance, uint64_t max_age_ns);
+
+/**
+ * @brief Submit one sample of @p instance and get the voted output.
+ *
+ * @param v            Voting state.
+ * @param instance     Producing instance, below the init count.
+ * @param timestamp_ns Capture time of the sample.
+ * @param x            @c channels values.
+ * @param out          Receives @c channels voted values when 1 is
+ *                     returned.
+ *
+ * @retval 1 if @p out holds a new output.
+ * @retval 0 if the sample was accepted but completes no round yet.
+ * @retval -EBADMSG if the sample disagrees with the other instances.
+ * @retval -EINVAL if @p instance is out of range.
+ */
+int sensor_vote_submit(struct sensor_vote *v, uint8_t instance,
+		       uint64_t timestamp_ns, const double *x, double *out);
+
+/**
+ * @brief Whether @p instance currently takes part in the vote.
+ *
+ * @retval true if its recent samples agreed with the others.
+ * @retval false after CONFIG_SENSOR_VOTE_FAULT_LIMIT rejections in a
+ *         row, or if @p instance is out of range.
+ */
+bool sensor_vote_healthy(const struct sensor_vote *v, uint8_t instance);
+
+/** @} */
+
+#endif /* APP_LIB_SENSOR_VOTE_H_ */
@@ -6,6 +6,7 @@
 #ifndef APP_LIB_STATE_AUDIT_H_
 #define APP_LIB_STATE_AUDIT_H_
 
+#include <stddef.h>
 #include <stdint.h>
 #include <aurora/lib/state/state.h>
 
@@ -17,8 +18,10 @@
  * @brief Ring-buffer based audit log for state machine transitions and events.
  *
  * Records timestamped entries for state transitions and notable events.
- * The log is a fixed-size ring buffer; oldest entries are silently
- * overwritten when the buffer is full.
+ * The log is a fixed-size, lock-free ring of binary records; oldest
+ * entries are silently overwritten when the buffer is full. Recording
+ * never blocks and never formats text: the persistent file and the shell
+ * render entries later with sm_audit_format().
  */
 
 /** @brief Type of audit log entry. */
@@ -70,9 +73,25 @@ uint32_t sm_audit_count(void);
  *
  * @retval 0      Success.
  * @retval -EINVAL idx out of range or entry is NULL.
+ * @retval -EAGAIN The entry was overwritten (or is still being written)
+ *                 by a concurrent producer.
  */
 int sm_audit_get(uint32_t idx, struct sm_audit_entry *entry);
 
+/**
+ * @brief Render an entry as one line of text (no newline).
+ *
+ * Same layout as the persistent audit file and the shell listing.
+ *
+ * @param e   Entry to render.
+ * @param buf Output buffer.
+ * @param len Size of @p buf.
+ *
+ * @return Length the full line would have (snprintf semantics), or
+ *         -EINVAL if @p e or @p buf is NULL.
+ */
+int sm_audit_format(const struct sm_audit_entry *e, char *buf, size_t len);
+
 /**
  * @brief Clear all entries from the audit log.
  */
@@ -97,6 +97,7 @@ struct sm_inputs {
 	double accel_vert;		/**< World-frame vertical acceleration (m/s^2, gravity-removed, positive up). */
 	double velocity;		/**< Current vertical velocity. */
 	double altitude;		/**< Current altitude measurement. */
+	uint64_t timestamp_ns;		/**< Capture time of @ref altitude (ns since boot). 0 uses the time of the sm_update() call. */
 };
 
 /**
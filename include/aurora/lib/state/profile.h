@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_STATE_PROFILE_H_
+#define APP_LIB_STATE_PROFILE_H_
+
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+
+#if defined(CONFIG_TIMING_FUNCTIONS)
+#include <zephyr/timing/timing.h>
+#endif /* CONFIG_TIMING_FUNCTIONS */
+
+/**
+ * @defgroup lib_state_profile State Machine Loop Profiling
+ * @ingroup lib_state
+ * @{
+ *
+ * @brief Per-stage cycle counts of the fusion and state machine loops.
+ *
+ * With @c CONFIG_AURORA_STATE_MACHINE_PROFILE every instrumented stage
+ * accumulates the count, minimum, maximum and total of its run time in
+ * counter cycles.  The counter is the timing API's (the DWT cycle
+ * counter on Cortex-M) when @c CONFIG_TIMING_FUNCTIONS is enabled and
+ * the kernel cycle counter otherwise.  Without the option every hook
+ * compiles to nothing.
+ *
+ * Usage:
+ * @code
+ * uint32_t t = sm_prof_begin();
+ * handle_imu(...);
+ * sm_prof_end(SM_PROF_IMU, t);
+ * @endcode
+ */
+
+/** @brief Instrumented stage; nested stages count towards their parent too. */
+enum sm_prof_stage {
+	SM_PROF_FUSION,		/**< One fusion thread batch, end to end. */
+	SM_PROF_IMU,		/**< handle_imu(), attitude included. */
+	SM_PROF_ATTITUDE,	/**< attitude_update(). */
+	SM_PROF_FILTER,		/**< Filter predict + update (sm_fuse(), sm_update()). */
+	SM_PROF_CONTROL,	/**< One state machine thread step, end to end. */
+	SM_PROF_SM_UPDATE,	/**< Transition logic of sm_update(). */
+	SM_PROF_PYRO,		/**< Pyro channel handling. */
+	SM_PROF_PAD_LINK,	/**< Pad link publishing (pad_link_publish_sm()). */
+	SM_PROF_TELEMETRY,	/**< Telemetry (telemetry_send_sm_update()). */
+	SM_PROF_LOG,		/**< Flight log records (log_enqueue()). */
+	SM_PROF_COUNT,		/**< Sentinel — do not use as a stage */
+};
+
+/** @brief Accumulated run time of one stage, in counter cycles. */
+struct sm_prof_stats {
+	uint32_t count;		/**< Completed runs. */
+	uint32_t min;		/**< Shortest run (0 when count is 0). */
+	uint32_t max;		/**< Longest run. */
+	uint64_t total;		/**< Sum of all runs. */
+};
+
+#if defined(CONFIG_AURORA_STATE_MACHINE_PROFILE)
+
+/** @brief Counter value to pass to sm_prof_end() once the stage is done. */
+static inline uint32_t sm_prof_begin(void)
+{
+#if defined(CONFIG_TIMING_FUNCTIONS)
+	return (uint32_t)timing_counter_get();
+#else
+	return k_cycle_get_32();
+#endif /* CONFIG_TIMING_FUNCTIONS */
+}
+
+/**
+ * @brief Account one run of @p stage that started at @p start.
+ *
+ * Safe from any thread; runs are expected to be shorter than one wrap of
+ * the 32-bit counter.
+ */
+void sm_prof_end(enum sm_prof_stage stage, uint32_t start);
+
+/**
+ * @brief Snapshot the statistics of one stage.
+ *
+ * @retval 0       Success.
+ * @retval -EINVAL @p stage out of range or @p out is NULL.
+ */
+int sm_prof_get(enum sm_prof_stage stage, struct sm_prof_stats *out);
+
+/** @brief Clear the statistics of every stage. */
+void sm_prof_reset(void);
+
+/** @brief Rate of the counter behind sm_prof_begin(), in Hz. */
+uint64_t sm_prof_cycles_per_sec(void);
+
+/** @brief Short lowercase name of @p stage (e.g. "sm_update"). */
+const char *sm_prof_stage_str(enum sm_prof_stage stage);
+
+#else
+
+static inline uint32_t sm_prof_begin(void)
+{
+	return 0;
+}
+
+static inline void sm_prof_end(enum sm_prof_stage stage, uint32_t start)
+{
+	ARG_UNUSED(stage);
+	ARG_UNUSED(start);
+}
+
+#endif /* CONFIG_AURORA_STATE_MACHINE_PROFILE */
+
+/** @} */
+
+#endif /* APP_LIB_STATE_PROFILE_H_ */
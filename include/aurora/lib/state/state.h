@@ -25,11 +25,12 @@
  * SM_ERROR, which the common error path relies on.
  */
 #define AURORA_STATE_BACKEND_INTERNAL
-#if defined(CONFIG_SIMPLE_STATE)
+#if defined(CONFIG_SIMPLE_STATE) || defined(CONFIG_TABLE_STATE)
+/* The table backend runs the simple backend's states. */
 #include <aurora/lib/state/internal/simple.h>
 #else
 #error "Unknown state machine type! Make sure CONFIG_AURORA_STATE_MACHINE_TYPE is set."
-#endif /* CONFIG_SIMPLE_STATE */
+#endif /* CONFIG_SIMPLE_STATE || CONFIG_TABLE_STATE */
 #undef AURORA_STATE_BACKEND_INTERNAL
 
 /*-----------------------------------------------------------
@@ -46,7 +47,8 @@
  */
 enum sm_type {
     SM_TYPE_SIMPLE = 0,    /**< Simple backend (lib/state/simple.c). */
-    /* SM_TYPE_TWO_STAGE = 1, ... */
+    SM_TYPE_TABLE = 1,     /**< Table-driven backend (lib/state/table.c), simple states. */
+    /* SM_TYPE_TWO_STAGE = 2, ... */
 };
 
 /*-----------------------------------------------------------
@@ -129,12 +131,29 @@ void sm_deinit(void);
  *
  * Function evaluates sensor data and executes state transitions
  * according to the flight logic diagram. Must be called regularly
- * (e.g. at sensor update rate).
+ * (e.g. at sensor update rate).  With CONFIG_FILTER the prediction step
+ * spans the capture times in @c inputs->timestamp_ns, so the call itself
+ * may run late or at a lower rate than the sensors.
  *
  * @param inputs Pointer to populated sensor readings.
  */
 void sm_update(const struct sm_inputs *inputs);
 
+/**
+ * @brief Feed sensor readings to the input filter without a decision.
+ *
+ * Runs the same filter step as sm_update() but leaves the flight logic,
+ * the current state and @ref sm_get_inputs() untouched.  Lets the
+ * caller fuse every sample while evaluating transitions at a lower
+ * decision rate; a later sm_update() with the same capture time does
+ * not feed the filter twice.  May be called from a different thread
+ * than sm_update() (threads only; the filter is guarded by a mutex).  Without
+ * CONFIG_FILTER this is a no-op.
+ *
+ * @param inputs Pointer to populated sensor readings.
+ */
+void sm_fuse(const struct sm_inputs *inputs);
+
 /**
  * @brief Retrieve the current state of the state machine.
  *
@@ -6,9 +6,11 @@
 #ifndef AURORA_LIB_TELEMETRY_H_
 #define AURORA_LIB_TELEMETRY_H_
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
+#include <zephyr/drivers/sensor.h>
 #include <zephyr/sys/iterable_sections.h>
 
 #include <aurora/lib/state/state.h>
@@ -25,7 +27,32 @@
  * @ref TELEMETRY_BACKEND_DEFINE is initialised on boot and receives
  * each outgoing message. Backends own their own framing, transport,
  * worker threads, and any backend-specific rate limiting.
+ *
+ * Every message carries a @ref telemetry_class. A backend registered
+ * with @ref TELEMETRY_BACKEND_DEFINE_BUDGET gets a bandwidth budget
+ * from the dispatcher: urgent classes are always delivered and charged
+ * against it, periodic classes only fill what is left.
+ */
+
+/**
+ * @brief Message classes, most urgent first.
  */
+enum telemetry_class {
+	/** Flight state changed. Never throttled. */
+	TELEMETRY_CLASS_TRANSITION = 0,
+	/** One-off event the ground must see (pyro, error). Never throttled. */
+	TELEMETRY_CLASS_EVENT,
+	/** Routine kinematics update. Sent while budget is left. */
+	TELEMETRY_CLASS_KINEMATICS,
+	/** Low-rate health data. Sent only with budget to spare. */
+	TELEMETRY_CLASS_HEALTH,
+	/** Decimated raw sensor samples. Sent only with budget to spare. */
+	TELEMETRY_CLASS_SAMPLES,
+	TELEMETRY_CLASS_COUNT,
+};
+
+/** @brief True for classes the dispatcher and backends must not drop. */
+#define TELEMETRY_CLASS_URGENT(cls) ((cls) <= TELEMETRY_CLASS_EVENT)
 
 /**
  * @brief Backend operations vtable.
@@ -41,15 +68,45 @@ struct telemetry_backend_api {
 	 * @c type identifies the @c sm_state enum mapping in use
 	 * (see @ref sm_get_type); backends forward it so the receiver
 	 * can decode the @c state value without prior agreement.
+	 * Urgent classes (@ref TELEMETRY_CLASS_URGENT) must bypass any
+	 * backend-local rate limit and go out ahead of queued routine
+	 * frames.
+	 *
+	 * @return Bytes queued for the link (charged against the budget;
+	 *         0 if the backend does not account), or a negative errno.
+	 */
+	int (*send_sm_update)(enum telemetry_class cls, enum sm_state state,
+			      enum sm_type type, const struct sm_inputs *inputs);
+
+	/** @brief Offer one raw sensor sample. Must not block.
+	 *
+	 * Backends decimate and batch samples into frames of their own
+	 * and may discard any of them. @c type is an @c aurora_data
+	 * value (see data_logger.h).
+	 *
+	 * @return Bytes queued for the link by this call (a whole batch
+	 *         frame, or 0 while batching), or a negative errno.
 	 */
-	int (*send_sm_update)(enum sm_state state, enum sm_type type,
-			      const struct sm_inputs *inputs);
+	int (*send_samples)(uint8_t type, uint64_t timestamp_ns,
+			    const struct sensor_value *channels,
+			    uint8_t channel_count);
+};
+
+/** @brief Dispatcher-owned token bucket of a budgeted backend. */
+struct telemetry_budget {
+	int32_t tokens;      /**< Bytes available; negative = in debt. */
+	int64_t refill_ms;   /**< Uptime of the last refill. */
+	bool primed;         /**< Bucket filled on first use. */
 };
 
 /** @brief Backend descriptor. Collected at link time. */
 struct telemetry_backend {
 	const char *name;
 	const struct telemetry_backend_api *api;
+	/** Link budget in bytes per second, 0 = unlimited. */
+	uint32_t budget_bps;
+	/** Bucket state, NULL when @c budget_bps is 0. */
+	struct telemetry_budget *budget;
 };
 
 /**
@@ -64,6 +121,26 @@ struct telemetry_backend {
 		.api = (_api),						\
 	}
 
+/**
+ * @brief Register a telemetry backend with a bandwidth budget.
+ *
+ * The dispatcher refills the budget at @p _bps bytes per second, up to
+ * CONFIG_AURORA_TELEMETRY_BURST_MS worth of bytes. A @p _bps of 0
+ * behaves like @ref TELEMETRY_BACKEND_DEFINE.
+ *
+ * @param _name  Unique C identifier for this backend.
+ * @param _api   Pointer to a @ref telemetry_backend_api vtable.
+ * @param _bps   Link budget in bytes per second.
+ */
+#define TELEMETRY_BACKEND_DEFINE_BUDGET(_name, _api, _bps)		\
+	static struct telemetry_budget _name##_budget;			\
+	STRUCT_SECTION_ITERABLE(telemetry_backend, _name) = {		\
+		.name = #_name,						\
+		.api = (_api),						\
+		.budget_bps = (_bps),					\
+		.budget = (_bps) > 0 ? &_name##_budget : NULL,		\
+	}
+
 /**
  * @brief Initialise all registered telemetry backends.
  *
@@ -77,6 +154,10 @@ int telemetry_init(void);
  * Safe to call from any thread context. Never blocks — backends must
  * enforce that themselves (typically by dropping on overflow).
  *
+ * The first update and every update whose @p state differs from the
+ * previous one are sent as @ref TELEMETRY_CLASS_TRANSITION, the rest
+ * as @ref TELEMETRY_CLASS_KINEMATICS.
+ *
  * @param state   Current flight state.
  * @param type    Active state machine implementation ID
  *                (see @ref sm_get_type). Forwarded so the receiver
@@ -84,11 +165,52 @@ int telemetry_init(void);
  * @param inputs  Current SM inputs snapshot (see sm_get_inputs).
  *
  * @retval 0 if every backend accepted the message.
+ * @retval -EAGAIN a budget or rate limit held back a routine update.
  * @retval <0 the first error returned by any backend (others still tried).
  */
 int telemetry_send_sm_update(enum sm_state state, enum sm_type type,
 			     const struct sm_inputs *inputs);
 
+/**
+ * @brief Fan out a state-machine update with an explicit class.
+ *
+ * Like telemetry_send_sm_update() but the caller picks the class, e.g.
+ * @ref TELEMETRY_CLASS_EVENT for a pyro firing or
+ * @ref TELEMETRY_CLASS_HEALTH for a low-rate heartbeat.
+ *
+ * @param cls     Message class.
+ * @param state   Current flight state.
+ * @param type    Active state machine implementation ID.
+ * @param inputs  Current SM inputs snapshot.
+ *
+ * @retval 0 if every backend accepted the message.
+ * @retval -EINVAL @p cls is out of range.
+ * @retval <0 the first error returned by any backend (others still tried).
+ */
+int telemetry_send_sm_class(enum telemetry_class cls, enum sm_state state,
+			    enum sm_type type, const struct sm_inputs *inputs);
+
+/**
+ * @brief Offer one raw sensor sample to all registered backends.
+ *
+ * Fed from the data logger (log_record()) when
+ * CONFIG_AURORA_TELEMETRY_SAMPLES is enabled. Samples are
+ * @ref TELEMETRY_CLASS_SAMPLES: budgeted backends only take them while
+ * they have bandwidth to spare. Never blocks.
+ *
+ * @param type           @c aurora_data sample type.
+ * @param timestamp_ns   Capture time.
+ * @param channels       Channel readings.
+ * @param channel_count  Number of entries in @p channels.
+ *
+ * @retval 0 if every backend accepted (or decimated) the sample.
+ * @retval -EAGAIN a budget held the sample back.
+ * @retval <0 the first error returned by any backend (others still tried).
+ */
+int telemetry_send_samples(uint8_t type, uint64_t timestamp_ns,
+			   const struct sensor_value *channels,
+			   uint8_t channel_count);
+
 /** @} */
 
 #endif /* AURORA_LIB_TELEMETRY_H_ */
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef AURORA_LIB_TELEMETRY_CANFD_H_
+#define AURORA_LIB_TELEMETRY_CANFD_H_
+
+#include <stdint.h>
+
+#include <zephyr/zbus/zbus.h>
+
+#include <aurora/lib/state/state.h>
+
+/**
+ * @defgroup lib_telemetry_canfd CAN-FD inter-board link
+ * @ingroup lib_telemetry
+ * @{
+ *
+ * @brief Samples and state of the other AURORA boards on the CAN bus.
+ *
+ * With @c CONFIG_AURORA_TELEMETRY_CANFD_RX the CAN-FD backend
+ * republishes what the other boards send on the zbus channels below.
+ * Remote samples keep the sender's @c timestamp_ns, which is the
+ * sender's uptime, not ours.
+ */
+
+/** @brief A state-machine snapshot received from another board. */
+struct telemetry_remote_sm {
+	uint8_t node;              /**< Sender's CONFIG_AURORA_TELEMETRY_CANFD_NODE_ID */
+	uint8_t seq;               /**< Sender's frame counter, for loss detection */
+	enum sm_state state;       /**< Sender's flight state */
+	enum sm_type type;         /**< Sender's state machine implementation */
+	uint32_t timestamp_ms;     /**< Sender's uptime when it was sent */
+	struct sm_inputs inputs;   /**< Sender's SM inputs; @c log_ready is 0 */
+};
+
+/** Remote @ref telemetry_remote_sm snapshots. */
+ZBUS_CHAN_DECLARE(remote_sm_chan);
+
+/** Remote IMU samples, as @c struct @c imu_data (see imu.h). */
+ZBUS_CHAN_DECLARE(remote_imu_data_chan);
+
+/** Remote barometer samples, as @c struct @c baro_data (see baro.h). */
+ZBUS_CHAN_DECLARE(remote_baro_data_chan);
+
+/** @} */
+
+#endif /* AURORA_LIB_TELEMETRY_CANFD_H_ */
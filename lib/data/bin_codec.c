@@ -0,0 +1,190 @@
+/**
+ * @file bin_codec.c
+ * @brief Delta/zigzag-varint record codec for the packed binary log (v3).
+ *
+ * See bin_codec.h for the on-storage layout.  Most IMU/baro samples move
+ * by a few LSBs between records, so a 32-byte fixed record typically
+ * shrinks to 10-16 bytes, and channels a group doesn't carry cost
+ * nothing at all.  val1 and val2 are delta-coded independently so
+ * non-canonical sensor_value pairs still round-trip bit-exactly.
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/sys/util.h>
+
+#include "bin_codec.h"
+
+static inline uint64_t zigzag(int64_t v)
+{
+	return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+static inline int64_t unzigzag(uint64_t v)
+{
+	return (int64_t)(v >> 1) ^ -(int64_t)(v & 1U);
+}
+
+static inline size_t put_varint(uint8_t *dst, uint64_t v)
+{
+	size_t n = 0;
+
+	while (v >= 0x80U) {
+		dst[n++] = (uint8_t)(v | 0x80U);
+		v >>= 7;
+	}
+	dst[n++] = (uint8_t)v;
+	return n;
+}
+
+/* Returns bytes consumed, or 0 if the varint runs past @p len or is
+ * longer than any value the encoder can produce.
+ */
+static inline size_t get_varint(const uint8_t *src, size_t len, uint64_t *out)
+{
+	uint64_t v = 0;
+
+	for (size_t i = 0; i < len && i < 10U; i++) {
+		v |= (uint64_t)(src[i] & 0x7FU) << (7U * i);
+		if ((src[i] & 0x80U) == 0U) {
+			*out = v;
+			return i + 1U;
+		}
+	}
+	return 0;
+}
+
+void bin_codec_reset(struct bin_codec_state *st)
+{
+	memset(st, 0, sizeof(*st));
+}
+
+int bin_codec_encode(struct bin_codec_state *st, uint64_t base_ts_ns,
+		     const struct datapoint *dp, uint8_t *dst)
+{
+	if ((unsigned int)dp->type >= AURORA_DATA_COUNT) {
+		return -EINVAL;
+	}
+
+	const uint8_t type  = (uint8_t)dp->type;
+	const uint8_t count = MIN(dp->channel_count, DP_MAX_CHANNELS);
+
+	/* Same µs quantisation and clamp as the fixed v2 record, so both
+	 * formats reconstruct identical timestamps.
+	 */
+	uint64_t delta_ns = dp->timestamp_ns >= base_ts_ns
+		? dp->timestamp_ns - base_ts_ns : 0;
+	uint32_t ts_us = (uint32_t)(delta_ns / 1000U);
+	size_t n = 0;
+
+	dst[n++] = (uint8_t)((count << 6) | type);
+	n += put_varint(&dst[n],
+			zigzag((int64_t)ts_us - (int64_t)st->prev_ts_us));
+	st->prev_ts_us = ts_us;
+
+	for (uint8_t i = 0; i < count; i++) {
+		int32_t v1 = dp->channels[i].val1;
+		int32_t v2 = dp->channels[i].val2;
+
+		n += put_varint(&dst[n], zigzag((int64_t)v1 -
+					(int64_t)st->prev_val1[type][i]));
+		n += put_varint(&dst[n], zigzag((int64_t)v2 -
+					(int64_t)st->prev_val2[type][i]));
+		st->prev_val1[type][i] = v1;
+		st->prev_val2[type][i] = v2;
+	}
+
+	return (int)n;
+}
+
+int bin_codec_decode(struct bin_codec_state *st, uint64_t base_ts_ns,
+		     const uint8_t *src, size_t len, struct datapoint *dp)
+{
+	if (len == 0U || src[0] == BIN_CODEC_TAG_END) {
+		return 0;
+	}
+
+	const uint8_t type  = src[0] & 0x3FU;
+	const uint8_t count = src[0] >> 6;
+	uint64_t raw;
+	size_t off = 1;
+	size_t n;
+
+	if (type >= AURORA_DATA_COUNT) {
+		return -EBADMSG;
+	}
+
+	n = get_varint(&src[off], len - off, &raw);
+	if (n == 0U) {
+		return -EBADMSG;
+	}
+	off += n;
+	st->prev_ts_us = (uint32_t)((int64_t)st->prev_ts_us + unzigzag(raw));
+
+	dp->timestamp_ns  = base_ts_ns + (uint64_t)st->prev_ts_us * 1000ULL;
+	dp->type          = (enum aurora_data)type;
+	dp->channel_count = count;
+
+	for (uint8_t i = 0; i < DP_MAX_CHANNELS; i++) {
+		if (i >= count) {
+			dp->channels[i].val1 = 0;
+			dp->channels[i].val2 = 0;
+			continue;
+		}
+
+		n = get_varint(&src[off], len - off, &raw);
+		if (n == 0U) {
+			return -EBADMSG;
+		}
+		off += n;
+		st->prev_val1[type][i] = (int32_t)((int64_t)st->prev_val1[type][i] +
+						   unzigzag(raw));
+
+		n = get_varint(&src[off], len - off, &raw);
+		if (n == 0U) {
+			return -EBADMSG;
+		}
+		off += n;
+		st->prev_val2[type][i] = (int32_t)((int64_t)st->prev_val2[type][i] +
+						   unzigzag(raw));
+
+		dp->channels[i].val1 = st->prev_val1[type][i];
+		dp->channels[i].val2 = st->prev_val2[type][i];
+	}
+
+	return (int)off;
+}
+
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+void bin_codec_crc_seal(uint8_t *frame, size_t frame_size, size_t used,
+			uint32_t crc)
+{
+	const size_t hdr = sizeof(struct aurora_bin_frame_header);
+	const size_t end = frame_size - AURORA_BIN_CRC_SIZE;
+	struct aurora_bin_frame_header *h =
+		(struct aurora_bin_frame_header *)frame;
+
+	h->reserved0 |= AURORA_BIN_FLAG_CRC;
+	used = CLAMP(used, hdr, end);
+	crc  = bin_codec_crc_add(crc, frame + used, end - used);
+	crc  = bin_codec_crc_add(crc, frame, hdr);
+	memcpy(frame + end, &crc, sizeof(crc));
+}
+
+bool bin_codec_crc_ok(const uint8_t *frame, size_t frame_size)
+{
+	const size_t hdr = sizeof(struct aurora_bin_frame_header);
+	const size_t end = frame_size - AURORA_BIN_CRC_SIZE;
+	uint32_t crc = bin_codec_crc_add(0, frame + hdr, end - hdr);
+	uint32_t stored;
+
+	crc = bin_codec_crc_add(crc, frame, hdr);
+	memcpy(&stored, frame + end, sizeof(stored));
+	return crc == stored;
+}
+#endif /* CONFIG_DATA_LOGGER_BIN_CRC */
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Backend-private record codec for the packed (format v3) frame payload.
+ * Shared by both live writers (fmt_bin.c / fmt_bin_disk.c) and by the
+ * converter, so encode and decode can never drift apart.
+ *
+ * Packed record layout (all varints are unsigned LEB128, "zz" means the
+ * value is zigzag-mapped first so small negative deltas stay short):
+ *
+ *   tag          1 byte    (channel_count << 6) | type; 0xFF ends the frame
+ *   ts_delta     zz varint µs since the previous record in this frame
+ *                          (the first record is relative to base_ts_ns)
+ *   per channel  zz varint val1 - previous val1 of the same type/channel
+ *                zz varint val2 - previous val2 of the same type/channel
+ *
+ * The delta state is reset at every frame header (implicit keyframe), so
+ * each frame decodes on its own and a torn frame never poisons the next.
+ *
+ * The frame CRC helpers (CONFIG_DATA_LOGGER_BIN_CRC) live here for the
+ * same reason: writers seal and the converter checks with one routine.
+ */
+
+#ifndef AURORA_LIB_DATA_BIN_CODEC_H_
+#define AURORA_LIB_DATA_BIN_CODEC_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/sys/util.h>
+
+#include <aurora/lib/data_logger.h>
+
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+#include <zephyr/sys/crc.h>
+#endif
+
+/** Trailer bytes at the end of every frame this build writes. */
+#define BIN_CODEC_CRC_SIZE \
+	(IS_ENABLED(CONFIG_DATA_LOGGER_BIN_CRC) ? AURORA_BIN_CRC_SIZE : 0U)
+
+/** Tag value marking the end of the packed payload (erased storage). */
+#define BIN_CODEC_TAG_END 0xFFU
+
+/** Worst-case packed record length: tag + ts varint + 2 varints/channel. */
+#define BIN_CODEC_REC_MAX (1U + 5U + DP_MAX_CHANNELS * 2U * 5U)
+
+BUILD_ASSERT(AURORA_DATA_COUNT < 0x3F,
+	     "packed tag reserves type 0x3F for the end-of-frame marker");
+BUILD_ASSERT(DP_MAX_CHANNELS <= 3,
+	     "packed tag only carries two bits of channel_count");
+
+/** Per-frame delta state (producer or converter side). */
+struct bin_codec_state {
+	uint32_t prev_ts_us;
+	int32_t  prev_val1[AURORA_DATA_COUNT][DP_MAX_CHANNELS];
+	int32_t  prev_val2[AURORA_DATA_COUNT][DP_MAX_CHANNELS];
+};
+
+/** Whether the converter knows how to walk frames of @p version. */
+static inline bool bin_codec_version_supported(uint16_t version)
+{
+	return version == AURORA_BIN_VERSION_FIXED ||
+	       version == AURORA_BIN_VERSION_PACKED ||
+	       version == AURORA_BIN_VERSION_COLUMNAR;
+}
+
+/** End of the payload of a @p frame_size byte frame with header @p flags. */
+static inline size_t bin_codec_payload_end(size_t frame_size, uint16_t flags)
+{
+	return frame_size -
+	       ((flags & AURORA_BIN_FLAG_CRC) != 0U ? AURORA_BIN_CRC_SIZE : 0U);
+}
+
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+/** Fold @p len payload bytes into the running frame CRC @p crc. */
+static inline uint32_t bin_codec_crc_add(uint32_t crc, const void *data,
+					 size_t len)
+{
+	return crc32_ieee_update(crc, data, len);
+}
+
+/**
+ * Finish and store the CRC of a @p frame_size byte frame.  @p crc covers
+ * the payload up to @p used (0 if nothing was folded in yet); the erased
+ * rest of the payload and then the header are added here.
+ */
+void bin_codec_crc_seal(uint8_t *frame, size_t frame_size, size_t used,
+			uint32_t crc);
+
+/** Whether the trailer of a @p frame_size byte frame matches its bytes. */
+bool bin_codec_crc_ok(const uint8_t *frame, size_t frame_size);
+#endif /* CONFIG_DATA_LOGGER_BIN_CRC */
+
+/** Start a new frame: every type is keyed against zero again. */
+void bin_codec_reset(struct bin_codec_state *st);
+
+/**
+ * Encode @p dp into @p dst, which must have at least
+ * @ref BIN_CODEC_REC_MAX bytes of room.
+ *
+ * @retval >0 number of bytes written.
+ * @retval -EINVAL if @p dp carries an out-of-range type.
+ */
+int bin_codec_encode(struct bin_codec_state *st, uint64_t base_ts_ns,
+		     const struct datapoint *dp, uint8_t *dst);
+
+/**
+ * Decode one record from @p src (at most @p len bytes) into @p dp.
+ *
+ * @retval >0 number of bytes consumed.
+ * @retval 0 end of payload (end tag or no bytes left).
+ * @retval -EBADMSG if the record is truncated or malformed.
+ */
+int bin_codec_decode(struct bin_codec_state *st, uint64_t base_ts_ns,
+		     const uint8_t *src, size_t len, struct datapoint *dp);
+
+#endif /* AURORA_LIB_DATA_BIN_CODEC_H_ */
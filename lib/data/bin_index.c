@@ -0,0 +1,177 @@
+/**
+ * @file bin_index.c
+ * @brief Seekable frame index for the binary flight log.
+ *
+ * See bin_index.h.  The writer keeps the whole slot image in RAM and
+ * edits it in place, so persisting it is a single frame write.  Periodic
+ * entries sit on multiples of @c interval, which lets the index thin
+ * itself by doubling the interval and keeping the entries still on it.
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "bin_index.h"
+
+#define MARK_NONE ((atomic_val_t)UINT32_MAX)
+
+static inline struct aurora_bin_index_header *ix_hdr(struct bin_index *ix)
+{
+	return (struct aurora_bin_index_header *)ix->buf;
+}
+
+static inline struct aurora_bin_index_entry *ix_entries(struct bin_index *ix)
+{
+	return (struct aurora_bin_index_entry *)
+		(ix->buf + sizeof(struct aurora_bin_index_header));
+}
+
+void bin_index_reset(struct bin_index *ix, uint64_t flight_id,
+		     uint32_t ring_frames)
+{
+	struct aurora_bin_index_header *h = ix_hdr(ix);
+
+	memset(ix->buf, 0xFF, sizeof(ix->buf));
+	memcpy(h->magic, AURORA_BIN_INDEX_MAGIC, sizeof(h->magic));
+	h->version     = AURORA_BIN_INDEX_VERSION;
+	h->count       = 0;
+	h->flight_id   = flight_id;
+	h->interval    = CONFIG_DATA_LOGGER_BIN_INDEX_INTERVAL;
+	h->latest_seq  = 0;
+	h->latest_slot = 0;
+	h->reserved    = 0;
+
+	for (int m = 0; m < AURORA_BIN_MARK_COUNT; m++) {
+		atomic_set(&ix->mark_seq[m], MARK_NONE);
+	}
+	ix->ring_frames = ring_frames;
+	ix->dirty       = false;
+}
+
+void bin_index_mark(struct bin_index *ix, enum aurora_bin_mark mark,
+		    uint32_t seq)
+{
+	if (mark > AURORA_BIN_MARK_FRAME && mark < AURORA_BIN_MARK_COUNT) {
+		atomic_set(&ix->mark_seq[mark], (atomic_val_t)seq);
+	}
+}
+
+/* Double the interval and drop the periodic entries no longer on it. */
+static void ix_thin(struct bin_index *ix)
+{
+	struct aurora_bin_index_header *h = ix_hdr(ix);
+	struct aurora_bin_index_entry *e = ix_entries(ix);
+	size_t keep = 0;
+
+	if (h->interval > UINT32_MAX / 2U) {
+		return;
+	}
+	h->interval *= 2U;
+
+	for (size_t i = 0; i < h->count; i++) {
+		if (e[i].mark != AURORA_BIN_MARK_FRAME ||
+		    e[i].seq % h->interval == 0U) {
+			e[keep++] = e[i];
+		}
+	}
+	memset(&e[keep], 0xFF, (h->count - keep) * sizeof(*e));
+	h->count = (uint16_t)keep;
+}
+
+/* Frames ring_frames or more behind @p seq have been overwritten.  Not
+ * worth a rewrite of its own: readers verify every entry anyway.
+ */
+static void ix_prune(struct bin_index *ix, uint32_t seq)
+{
+	struct aurora_bin_index_header *h = ix_hdr(ix);
+	struct aurora_bin_index_entry *e = ix_entries(ix);
+	size_t drop = 0;
+
+	while (drop < h->count && seq - e[drop].seq >= ix->ring_frames) {
+		drop++;
+	}
+	if (drop == 0U) {
+		return;
+	}
+
+	memmove(e, &e[drop], (h->count - drop) * sizeof(*e));
+	memset(&e[h->count - drop], 0xFF, drop * sizeof(*e));
+	h->count -= (uint16_t)drop;
+}
+
+static void ix_push(struct bin_index *ix,
+		    const struct aurora_bin_frame_header *fh, uint32_t slot,
+		    uint8_t mark)
+{
+	struct aurora_bin_index_header *h = ix_hdr(ix);
+
+	if (h->count == BIN_INDEX_CAPACITY) {
+		ix_thin(ix);
+	}
+	if (h->count == BIN_INDEX_CAPACITY) {
+		return;
+	}
+
+	struct aurora_bin_index_entry *e = &ix_entries(ix)[h->count++];
+
+	memset(e, 0, sizeof(*e));
+	e->base_ts_ns = fh->base_ts_ns;
+	e->seq        = fh->seq;
+	e->slot       = slot;
+	e->mark       = mark;
+	ix->dirty     = true;
+}
+
+bool bin_index_note(struct bin_index *ix,
+		    const struct aurora_bin_frame_header *fh, uint32_t slot)
+{
+	struct aurora_bin_index_header *h = ix_hdr(ix);
+	bool dirty;
+
+	h->latest_seq  = fh->seq;
+	h->latest_slot = slot;
+	ix_prune(ix, fh->seq);
+
+	if (fh->seq % h->interval == 0U) {
+		ix_push(ix, fh, slot, AURORA_BIN_MARK_FRAME);
+	}
+
+	/* A mark lands on the first frame at or after its seq, in case the
+	 * frame it was taken in never reached storage.
+	 */
+	for (int m = AURORA_BIN_MARK_FRAME + 1; m < AURORA_BIN_MARK_COUNT; m++) {
+		atomic_val_t seq = atomic_get(&ix->mark_seq[m]);
+
+		if (seq != MARK_NONE &&
+		    (int32_t)(fh->seq - (uint32_t)seq) >= 0) {
+			ix_push(ix, fh, slot, (uint8_t)m);
+			atomic_set(&ix->mark_seq[m], MARK_NONE);
+		}
+	}
+
+	dirty = ix->dirty;
+	ix->dirty = false;
+	return dirty;
+}
+
+int bin_index_parse(const uint8_t *buf,
+		    const struct aurora_bin_index_header **hdr,
+		    const struct aurora_bin_index_entry **entries)
+{
+	const struct aurora_bin_index_header *h =
+		(const struct aurora_bin_index_header *)buf;
+
+	if (memcmp(h->magic, AURORA_BIN_INDEX_MAGIC, sizeof(h->magic)) != 0 ||
+	    h->version != AURORA_BIN_INDEX_VERSION ||
+	    h->count > BIN_INDEX_CAPACITY || h->interval == 0U) {
+		return -ENOENT;
+	}
+
+	*hdr     = h;
+	*entries = (const struct aurora_bin_index_entry *)(buf + sizeof(*h));
+	return 0;
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Backend-private frame index shared by both live writers
+ * (fmt_bin.c / fmt_bin_disk.c) and the converter.  See the "Frame
+ * index" group in data_logger.h for the on-storage layout; the index
+ * lives in the frame slot right after the data region (bin_io.h).
+ *
+ * Threading: bin_index_mark() runs on the producer side (under the
+ * logger mutex), everything else on the writer thread once the frame
+ * is on storage.  Marks are handed over through atomics.
+ */
+
+#ifndef AURORA_LIB_DATA_BIN_INDEX_H_
+#define AURORA_LIB_DATA_BIN_INDEX_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+
+#include <aurora/lib/data_logger.h>
+
+#define BIN_INDEX_CAPACITY \
+	AURORA_BIN_INDEX_CAPACITY((size_t)CONFIG_DATA_LOGGER_BIN_FRAME_SIZE)
+
+BUILD_ASSERT(BIN_INDEX_CAPACITY >= 2U * AURORA_BIN_MARK_COUNT,
+	     "index slot must hold the marks plus some periodic entries");
+
+/** Writer-side index state; @c buf is the slot image, written as-is. */
+struct bin_index {
+	uint8_t  buf[CONFIG_DATA_LOGGER_BIN_FRAME_SIZE]
+		__aligned(CONFIG_DATA_LOGGER_BIN_BUF_ALIGN);
+	/* Seq of the frame each mark belongs to, UINT32_MAX if none. */
+	atomic_t mark_seq[AURORA_BIN_MARK_COUNT];
+	uint32_t ring_frames;
+	bool     dirty;
+};
+
+/** Start an empty index for @p flight_id over @p ring_frames slots. */
+void bin_index_reset(struct bin_index *ix, uint64_t flight_id,
+		     uint32_t ring_frames);
+
+/** Producer side: tag the frame with @p seq (not yet on storage). */
+void bin_index_mark(struct bin_index *ix, enum aurora_bin_mark mark,
+		    uint32_t seq);
+
+/**
+ * Writer side: frame @p fh is now on storage at @p slot.  Returns true
+ * if the index gained an entry and should be persisted.
+ */
+bool bin_index_note(struct bin_index *ix,
+		    const struct aurora_bin_frame_header *fh, uint32_t slot);
+
+/**
+ * Validate an index slot image read back from storage.
+ *
+ * @retval 0 with @p hdr / @p entries pointing into @p buf.
+ * @retval -ENOENT if @p buf holds no valid index.
+ */
+int bin_index_parse(const uint8_t *buf,
+		    const struct aurora_bin_index_header **hdr,
+		    const struct aurora_bin_index_entry **entries);
+
+#endif /* AURORA_LIB_DATA_BIN_INDEX_H_ */
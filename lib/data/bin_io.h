@@ -20,7 +20,9 @@
 /**
  * Open the underlying medium for converter reads.  Idempotent with
  * respect to the writer; conversion is only invoked after the live
- * logger has been closed, so there is no concurrent access.
+ * logger has been closed, so there is no concurrent access.  The one
+ * exception is the trailing conversion (CONFIG_DATA_LOGGER_CONVERT_TRAIL),
+ * which only reads frames bin_io_live() reports as already written.
  */
 int bin_io_open(void);
 
@@ -34,18 +36,23 @@ int bin_io_close(void);
  */
 int bin_io_read(off_t off, void *buf, size_t len);
 
-/** Total size of the flight-log region in bytes. */
+/**
+ * Size of the data part of the flight-log region in bytes.  With
+ * CONFIG_DATA_LOGGER_BIN_INDEX the frame index occupies the one frame
+ * slot right after it, readable at offset bin_io_total_size().
+ */
 size_t bin_io_total_size(void);
 
 /**
  * Optional fast path for locating the start of the captured window.
  *
- * Backends whose on-storage layout makes the window start trivially
- * known (e.g. the disk backend writes purely linearly from offset 0,
- * so slot 0 is always the start of the most recent flight) implement
- * this and return 0 with the outputs filled in.  Backends without a
- * cheap shortcut (e.g. the circular flash backend) return -ENOTSUP
- * and the converter falls back to scanning every slot.
+ * Backends whose on-storage layout makes the window start cheap to
+ * find implement this and return 0 with the outputs filled in: the
+ * disk backend writes purely linearly from offset 0, so slot 0 is
+ * always the start of the most recent flight, and the circular flash
+ * backend binary-searches its ring for the wrap point.  Returning
+ * -ENOTSUP means the layout gives no shortcut this time; the
+ * converter then tries the frame index and finally scans every slot.
  *
  * Returning -ENOENT means the backend looked but found no valid
  * frame and the converter should treat the log as empty.  Other
@@ -55,4 +62,31 @@ int bin_io_window_start_hint(off_t *out_offset,
 			     uint32_t *out_seq,
 			     uint64_t *out_flight_id);
 
+#if defined(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+struct data_logger_session;
+
+/**
+ * Read the session catalogue (disk backend only) into @p out, oldest
+ * first.  Returns the number of catalogued flights, 0 for a blank
+ * catalogue, or a negative errno.
+ */
+int bin_io_sessions(struct data_logger_session *out, size_t max);
+
+/** Set the converted flag of flight @p number in the catalogue. */
+int bin_io_session_set_converted(uint32_t number);
+#endif
+
+#if defined(CONFIG_DATA_LOGGER_CONVERT_TRAIL)
+struct data_logger_session;
+
+/**
+ * Describe the flight the live logger is writing (disk backend only):
+ * its flight_id, the offset of its first frame and, with sessions, its
+ * catalogue number; frames is AURORA_BIN_SESSION_OPEN.  @p out_written
+ * is the end of the frames the writer has put on storage, which are
+ * never rewritten.  Returns -ENODEV if no logger is open.
+ */
+int bin_io_live(struct data_logger_session *out, size_t *out_written);
+#endif
+
 #endif /* AURORA_LIB_DATA_BIN_IO_H_ */
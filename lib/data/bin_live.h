@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Backend-private live-write surface used by data_logger.c with
+ * CONFIG_DATA_LOGGER_BIN_STATIC_DISPATCH.  Exactly one of fmt_bin.c
+ * (flash backend) or fmt_bin_disk.c (disk backend) is built into a
+ * given image; that file provides these symbols.  They are the same
+ * functions data_logger_bin_formatter points at, called without the
+ * vtable, under the logger mutex like the vtable entries.
+ */
+
+#ifndef AURORA_LIB_DATA_BIN_LIVE_H_
+#define AURORA_LIB_DATA_BIN_LIVE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <aurora/lib/data_logger.h>
+
+/** write_datapoint of data_logger_bin_formatter. */
+int bin_live_write(struct data_logger *logger, const struct datapoint *dp);
+
+/** write_datapoints of data_logger_bin_formatter. */
+int bin_live_write_batch(struct data_logger *logger,
+			 const struct datapoint *dps, size_t n);
+
+#if defined(CONFIG_DATA_LOGGER_BIN_ZERO_COPY)
+/** reserve of data_logger_bin_formatter. */
+int bin_live_reserve(struct data_logger *logger, uint64_t timestamp_ns,
+		     struct aurora_bin_record **rec);
+
+/** commit of data_logger_bin_formatter. */
+int bin_live_commit(struct data_logger *logger, struct aurora_bin_record *rec);
+#endif /* CONFIG_DATA_LOGGER_BIN_ZERO_COPY */
+
+#endif /* AURORA_LIB_DATA_BIN_LIVE_H_ */
@@ -0,0 +1,350 @@
+/**
+ * @file bin_mirror.c
+ * @brief Flash mirror of the disk-backed binary log.
+ *
+ * With CONFIG_DATA_LOGGER_BIN_MIRROR the disk backend (fmt_bin_disk.c)
+ * hands every frame it commits to this file as well.  The copy goes to
+ * the flash partition of the DT chosen entry @c auxspace,flight-log,
+ * the same partition the flash backend would use, so an SD card that
+ * ejects on a hard landing still leaves the flight on the board.
+ *
+ * The mirror has its own RAM queue of CONFIG_DATA_LOGGER_BIN_MIRROR_FRAMES
+ * frames and its own writer thread.  bin_mirror_put() never waits: while
+ * the queue is less than half full every frame is copied; beyond that
+ * only frames holding a critical record (bin_mirror_critical()) and
+ * every CONFIG_DATA_LOGGER_BIN_MIRROR_DECIMATE-th other frame are, and
+ * the last slot is kept for critical frames.  Neither medium ever waits
+ * for the other.
+ *
+ * On flash the layout is that of the flash backend: a circular ring
+ * starting at offset 0, frozen after DLE_BOOST so the BOOST frame is
+ * never overwritten, and with CONFIG_DATA_LOGGER_BIN_INDEX the last
+ * frame left out of the ring.  The writer renumbers @c seq per frame it
+ * writes (and reseals the CRC), so a decimated mirror is still one
+ * contiguous run and decodes like a flash-backend image.
+ *
+ * The ring advances in whole erase blocks of the partition's flash
+ * device: a frame that starts a block erases the block first.
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+#include <aurora/lib/data_logger.h>
+
+#include "bin_codec.h"
+#include "bin_mirror.h"
+
+LOG_MODULE_DECLARE(data_logger, CONFIG_DATA_LOGGER_LOG_LEVEL);
+
+#if !DT_HAS_CHOSEN(auxspace_flight_log)
+#error "DATA_LOGGER_BIN_MIRROR requires DT chosen 'auxspace,flight-log' to point at a fixed-partition node. See aurora/lib/data/fmt_bin.c file header for an example overlay."
+#endif
+
+#define MIR_PARTITION   DT_CHOSEN(auxspace_flight_log)
+#define MIR_AREA_ID     DT_FIXED_PARTITION_ID(MIR_PARTITION)
+#define MIR_AREA_SIZE   DT_REG_SIZE(MIR_PARTITION)
+
+#define MIR_HDR_SIZE    ((size_t)sizeof(struct aurora_bin_frame_header))
+#define MIR_FRAME_SIZE  ((size_t)CONFIG_DATA_LOGGER_BIN_FRAME_SIZE)
+#define MIR_QUEUE       ((uint32_t)CONFIG_DATA_LOGGER_BIN_MIRROR_FRAMES)
+#define MIR_DECIMATE    ((uint32_t)CONFIG_DATA_LOGGER_BIN_MIRROR_DECIMATE)
+
+/* Frame slots the ring may use; the index slot, if any, is not one. */
+#define MIR_AREA_FRAMES ((uint32_t)(MIR_AREA_SIZE / MIR_FRAME_SIZE) - \
+			 (IS_ENABLED(CONFIG_DATA_LOGGER_BIN_INDEX) ? 1U : 0U))
+
+#define MIR_NO_BOOST    UINT32_MAX
+
+BUILD_ASSERT(MIR_AREA_SIZE % MIR_FRAME_SIZE == 0,
+	     "flight_log partition size must be a multiple of the frame size");
+
+static uint8_t mir_q[MIR_QUEUE][MIR_FRAME_SIZE]
+	__aligned(CONFIG_DATA_LOGGER_BIN_BUF_ALIGN);
+
+struct mir_ctx {
+	const struct flash_area *fa;
+	uint32_t ring_frames;     /* ring size, whole erase blocks */
+	uint32_t block_frames;    /* frames per erase block */
+
+	/* Writer side. */
+	uint32_t seq;             /* mirror seq of the next frame */
+	uint32_t seq_limit;       /* first seq that would hit the BOOST block */
+
+	/* Producer side. */
+	uint32_t thin;            /* frames offered while behind */
+
+	atomic_t head;            /* next queue slot to fill */
+	atomic_t tail;            /* next queue slot to write */
+	atomic_t open;
+	atomic_t boost_req;       /* freeze ahead of the next write */
+
+	struct data_logger_bin_mirror_stats st;
+};
+
+static struct mir_ctx g_mir;
+static struct k_spinlock mir_st_lock;
+
+/* Writer wakes when a frame is queued or a drain is requested. */
+K_SEM_DEFINE(mir_data_sem, 0, K_SEM_MAX_LIMIT);
+K_SEM_DEFINE(mir_drain_sem, 0, 1);
+static atomic_t mir_drain_req = ATOMIC_INIT(0);
+
+static void mir_count(uint32_t *counter)
+{
+	k_spinlock_key_t key = k_spin_lock(&mir_st_lock);
+
+	(*counter)++;
+	k_spin_unlock(&mir_st_lock, key);
+}
+
+/* -------------------------------------------------------------------------- */
+/*  Writer thread                                                             */
+/* -------------------------------------------------------------------------- */
+
+static void mir_write(struct mir_ctx *m, uint8_t *frame)
+{
+	struct aurora_bin_frame_header *h =
+		(struct aurora_bin_frame_header *)frame;
+
+	if (atomic_cas(&m->boost_req, 1, 0)) {
+		/* The block holding the first post-boost frame is the
+		 * first one the ring must not come back to.
+		 */
+		m->seq_limit = m->seq - m->seq % m->block_frames +
+			       m->ring_frames;
+	}
+
+	if (m->seq >= m->seq_limit) {
+		mir_count(&m->st.dropped);
+		return;
+	}
+
+	h->seq = m->seq;
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+	if ((h->reserved0 & AURORA_BIN_FLAG_CRC) != 0U) {
+		bin_codec_crc_seal(frame, MIR_FRAME_SIZE, MIR_HDR_SIZE, 0);
+	}
+#endif
+
+	uint32_t slot = m->seq % m->ring_frames;
+	off_t off = (off_t)slot * (off_t)MIR_FRAME_SIZE;
+	int rc = 0;
+
+	if (slot % m->block_frames == 0U) {
+		rc = flash_area_erase(m->fa, off,
+				      m->block_frames * MIR_FRAME_SIZE);
+	}
+	if (rc == 0) {
+		rc = flash_area_write(m->fa, off, frame, MIR_FRAME_SIZE);
+	}
+	if (rc != 0) {
+		/* seq stays put, so the next frame retries this slot. */
+		LOG_WRN("bin_mirror: write at %ld failed (%d)", (long)off, rc);
+		mir_count(&m->st.dropped);
+		return;
+	}
+
+	m->seq++;
+	mir_count(&m->st.frames);
+}
+
+static void mir_writer_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1); ARG_UNUSED(p2); ARG_UNUSED(p3);
+
+	struct mir_ctx *m = &g_mir;
+
+	for (;;) {
+		(void)k_sem_take(&mir_data_sem, K_FOREVER);
+
+		uint32_t tail = (uint32_t)atomic_get(&m->tail);
+
+		while (tail != (uint32_t)atomic_get(&m->head)) {
+			mir_write(m, mir_q[tail % MIR_QUEUE]);
+			tail = (uint32_t)atomic_inc(&m->tail) + 1U;
+		}
+
+		if (atomic_get(&mir_drain_req) &&
+		    atomic_cas(&mir_drain_req, 1, 0)) {
+			k_sem_give(&mir_drain_sem);
+		}
+	}
+}
+
+K_THREAD_DEFINE(bin_mirror_th, CONFIG_DATA_LOGGER_BIN_MIRROR_STACK_SIZE,
+		mir_writer_fn, NULL, NULL, NULL,
+		CONFIG_DATA_LOGGER_BIN_MIRROR_PRIO, 0, 0);
+
+/* -------------------------------------------------------------------------- */
+/*  Producer side                                                             */
+/* -------------------------------------------------------------------------- */
+
+/* bin_mirror_open – see bin_mirror.h */
+int bin_mirror_open(void)
+{
+	struct mir_ctx *m = &g_mir;
+	struct flash_pages_info page;
+	int rc;
+
+	atomic_set(&m->open, 0);
+
+	rc = flash_area_open(MIR_AREA_ID, &m->fa);
+	if (rc != 0) {
+		LOG_ERR("bin_mirror: flash_area_open(id=%u) failed (%d)",
+			(unsigned int)MIR_AREA_ID, rc);
+		return rc;
+	}
+
+	rc = flash_get_page_info_by_offs(flash_area_get_device(m->fa),
+					 m->fa->fa_off, &page);
+	if (rc != 0 || page.size == 0U ||
+	    (page.size > MIR_FRAME_SIZE ? page.size % MIR_FRAME_SIZE
+					: MIR_FRAME_SIZE % page.size) != 0U) {
+		LOG_ERR("bin_mirror: erase block %u does not fit frame size "
+			"%zu (%d)", (unsigned int)page.size, MIR_FRAME_SIZE, rc);
+		flash_area_close(m->fa);
+		return rc != 0 ? rc : -EINVAL;
+	}
+
+	m->block_frames = (uint32_t)(MAX(page.size, MIR_FRAME_SIZE) /
+				     MIR_FRAME_SIZE);
+	m->ring_frames  = MIR_AREA_FRAMES / m->block_frames * m->block_frames;
+	if (m->ring_frames < 2U * m->block_frames) {
+		LOG_ERR("bin_mirror: partition holds fewer than two erase "
+			"blocks");
+		flash_area_close(m->fa);
+		return -EINVAL;
+	}
+
+	m->seq       = 0;
+	m->seq_limit = MIR_NO_BOOST;
+	m->thin      = 0;
+	atomic_set(&m->head, 0);
+	atomic_set(&m->tail, 0);
+	atomic_set(&m->boost_req, 0);
+	memset(&m->st, 0, sizeof(m->st));
+
+	k_sem_reset(&mir_data_sem);
+	k_sem_reset(&mir_drain_sem);
+	atomic_set(&mir_drain_req, 0);
+
+	atomic_set(&m->open, 1);
+	LOG_INF("bin_mirror: %u frames on flash, %u queued",
+		m->ring_frames, MIR_QUEUE);
+	return 0;
+}
+
+/* bin_mirror_put – see bin_mirror.h */
+void bin_mirror_put(const uint8_t *frame, bool critical)
+{
+	struct mir_ctx *m = &g_mir;
+
+	if (!atomic_get(&m->open)) {
+		return;
+	}
+
+	uint32_t head = (uint32_t)atomic_get(&m->head);
+	uint32_t used = head - (uint32_t)atomic_get(&m->tail);
+
+	/* The last slot is held back for critical frames. */
+	if (used >= (critical ? MIR_QUEUE : MIR_QUEUE - 1U)) {
+		mir_count(&m->st.dropped);
+		return;
+	}
+
+	if (critical || used < MIR_QUEUE / 2U) {
+		m->thin = 0;
+	} else if (m->thin++ % MIR_DECIMATE != 0U) {
+		mir_count(&m->st.decimated);
+		return;
+	}
+
+	memcpy(mir_q[head % MIR_QUEUE], frame, MIR_FRAME_SIZE);
+	(void)atomic_inc(&m->head);
+
+	k_spinlock_key_t key = k_spin_lock(&mir_st_lock);
+
+	m->st.queue_max = MAX(m->st.queue_max, used + 1U);
+	k_spin_unlock(&mir_st_lock, key);
+
+	k_sem_give(&mir_data_sem);
+}
+
+/* bin_mirror_boost – see bin_mirror.h */
+void bin_mirror_boost(void)
+{
+	atomic_set(&g_mir.boost_req, 1);
+}
+
+/* bin_mirror_disk_lost – see bin_mirror.h */
+void bin_mirror_disk_lost(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&mir_st_lock);
+
+	g_mir.st.disk_lost = true;
+	k_spin_unlock(&mir_st_lock, key);
+}
+
+/* bin_mirror_drain – see bin_mirror.h */
+int bin_mirror_drain(void)
+{
+	if (!atomic_get(&g_mir.open)) {
+		return 0;
+	}
+
+	k_sem_reset(&mir_drain_sem);
+	atomic_set(&mir_drain_req, 1);
+	k_sem_give(&mir_data_sem);
+
+	if (k_sem_take(&mir_drain_sem,
+		       K_MSEC(CONFIG_DATA_LOGGER_BIN_FLUSH_TIMEOUT_MS)) != 0) {
+		atomic_set(&mir_drain_req, 0);
+		LOG_WRN("bin_mirror: drain timed out");
+		return -ETIMEDOUT;
+	}
+
+	return 0;
+}
+
+/* bin_mirror_close – see bin_mirror.h */
+void bin_mirror_close(void)
+{
+	struct mir_ctx *m = &g_mir;
+
+	if (!atomic_get(&m->open)) {
+		return;
+	}
+
+	(void)bin_mirror_drain();
+	atomic_set(&m->open, 0);
+	flash_area_close(m->fa);
+
+	LOG_INF("bin_mirror: %u frames, %u decimated, %u dropped",
+		m->st.frames, m->st.decimated, m->st.dropped);
+}
+
+/* data_logger_bin_mirror_stats – see data_logger.h */
+int data_logger_bin_mirror_stats(struct data_logger_bin_mirror_stats *out)
+{
+	if (out == NULL) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&mir_st_lock);
+
+	*out = g_mir.st;
+	k_spin_unlock(&mir_st_lock, key);
+	return 0;
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Backend-private flash mirror of the disk backend (fmt_bin_disk.c).
+ * Every frame the disk producer commits is also offered to a second,
+ * independent writer that keeps a copy in the flash partition.  Without
+ * CONFIG_DATA_LOGGER_BIN_MIRROR every hook compiles to nothing.
+ *
+ * Threading: bin_mirror_put() runs on the producer side under the
+ * data_logger mutex and never waits; the flash writes happen on the
+ * mirror's own thread, so a slow card never holds up the flash copy
+ * and a slow flash erase never holds up the card.
+ */
+
+#ifndef AURORA_LIB_DATA_BIN_MIRROR_H_
+#define AURORA_LIB_DATA_BIN_MIRROR_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <zephyr/sys/util.h>
+
+#include <aurora/lib/data_logger.h>
+
+/* Record types the mirror keeps even when it falls behind: flight-state
+ * changes and pyro fires.
+ */
+#define BIN_MIRROR_CRITICAL_TYPES \
+	(BIT(AURORA_DATA_SM_AUDIT) | BIT(AURORA_DATA_PYRO_FIRE))
+
+/** Whether a record of @p type makes its frame a critical one. */
+static inline bool bin_mirror_critical(uint8_t type)
+{
+	return type < AURORA_DATA_COUNT &&
+	       (BIN_MIRROR_CRITICAL_TYPES & BIT(type)) != 0U;
+}
+
+#if defined(CONFIG_DATA_LOGGER_BIN_MIRROR)
+
+/** Open the flash partition and start the mirror of a new flight. */
+int bin_mirror_open(void);
+
+/**
+ * Offer one sealed frame.  Copied into the mirror queue if there is
+ * room; once the queue is half full only critical frames and every
+ * CONFIG_DATA_LOGGER_BIN_MIRROR_DECIMATE-th other frame are kept.
+ */
+void bin_mirror_put(const uint8_t *frame, bool critical);
+
+/** Freeze the mirror ring ahead of the next frame, as on the flash backend. */
+void bin_mirror_boost(void);
+
+/** The card is gone: from here on the mirror is the only copy. */
+void bin_mirror_disk_lost(void);
+
+/** Wait until every queued frame is on flash. */
+int bin_mirror_drain(void);
+
+/** Drain and stop accepting frames. */
+void bin_mirror_close(void);
+
+#else
+
+static inline int bin_mirror_open(void)
+{
+	return 0;
+}
+
+static inline void bin_mirror_put(const uint8_t *frame, bool critical)
+{
+	ARG_UNUSED(frame);
+	ARG_UNUSED(critical);
+}
+
+static inline void bin_mirror_boost(void)
+{
+}
+
+static inline void bin_mirror_disk_lost(void)
+{
+}
+
+static inline int bin_mirror_drain(void)
+{
+	return 0;
+}
+
+static inline void bin_mirror_close(void)
+{
+}
+
+#endif /* CONFIG_DATA_LOGGER_BIN_MIRROR */
+
+#endif /* AURORA_LIB_DATA_BIN_MIRROR_H_ */
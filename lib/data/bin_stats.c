@@ -0,0 +1,93 @@
+/**
+ * @file bin_stats.c
+ * @brief Write-latency histogram and throughput counters for the bin
+ *        writer threads.
+ *
+ * See bin_stats.h.  Latencies are bucketed by their bit length in µs,
+ * so twenty counters span sub-microsecond NOR programs up to the
+ * several-hundred-millisecond stalls an SD card's garbage collection
+ * can cause.
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/sys/util.h>
+
+#include <aurora/lib/data_logger.h>
+
+#include "bin_stats.h"
+
+static struct data_logger_bin_stats bin_stats;
+static struct k_spinlock bin_stats_lock;
+
+void bin_stats_open(uint32_t ring_size)
+{
+	k_spinlock_key_t key = k_spin_lock(&bin_stats_lock);
+
+	memset(&bin_stats, 0, sizeof(bin_stats));
+	bin_stats.ring_size = ring_size;
+	k_spin_unlock(&bin_stats_lock, key);
+}
+
+void bin_stats_write(uint32_t start, uint32_t frames, size_t bytes)
+{
+	uint32_t us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+	uint32_t bucket = us == 0U ? 0U : 32U - (uint32_t)__builtin_clz(us);
+
+	bucket = MIN(bucket, DATA_LOGGER_BIN_STATS_BUCKETS - 1U);
+
+	k_spinlock_key_t key = k_spin_lock(&bin_stats_lock);
+
+	bin_stats.lat_hist[bucket]++;
+	bin_stats.lat_max_us = MAX(bin_stats.lat_max_us, us);
+	bin_stats.writes++;
+	bin_stats.frames += frames;
+	bin_stats.bytes  += bytes;
+	k_spin_unlock(&bin_stats_lock, key);
+}
+
+void bin_stats_stall(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&bin_stats_lock);
+
+	bin_stats.stalls++;
+	k_spin_unlock(&bin_stats_lock, key);
+}
+
+void bin_stats_queued(uint32_t queued)
+{
+	k_spinlock_key_t key = k_spin_lock(&bin_stats_lock);
+
+	bin_stats.ring_max = MAX(bin_stats.ring_max, queued);
+	k_spin_unlock(&bin_stats_lock, key);
+}
+
+/* data_logger_bin_stats – see data_logger.h */
+int data_logger_bin_stats(struct data_logger_bin_stats *out)
+{
+	if (out == NULL) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&bin_stats_lock);
+
+	*out = bin_stats;
+	k_spin_unlock(&bin_stats_lock, key);
+	return 0;
+}
+
+/* data_logger_bin_stats_reset – see data_logger.h */
+void data_logger_bin_stats_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&bin_stats_lock);
+	uint32_t ring_size = bin_stats.ring_size;
+
+	memset(&bin_stats, 0, sizeof(bin_stats));
+	bin_stats.ring_size = ring_size;
+	k_spin_unlock(&bin_stats_lock, key);
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Backend-private writer statistics shared by both live writers
+ * (fmt_bin.c / fmt_bin_disk.c), read through data_logger_bin_stats().
+ * Without CONFIG_DATA_LOGGER_BIN_STATS every hook compiles to nothing.
+ *
+ * Threading: bin_stats_write() runs on the writer thread,
+ * bin_stats_stall() and bin_stats_queued() on the producer side.  All
+ * of them take one spinlock, held for a few stores.
+ */
+
+#ifndef AURORA_LIB_DATA_BIN_STATS_H_
+#define AURORA_LIB_DATA_BIN_STATS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+
+#if defined(CONFIG_DATA_LOGGER_BIN_STATS)
+
+/** Start the statistics for a new flight with a queue of @p ring_size. */
+void bin_stats_open(uint32_t ring_size);
+
+/** Timestamp to pass to bin_stats_write() once the write returns. */
+static inline uint32_t bin_stats_begin(void)
+{
+	return k_cycle_get_32();
+}
+
+/** A storage write of @p frames frames (@p bytes) started at @p start. */
+void bin_stats_write(uint32_t start, uint32_t frames, size_t bytes);
+
+/** The producer had to wait for a free frame buffer. */
+void bin_stats_stall(void);
+
+/** @p queued frames are now waiting for the writer. */
+void bin_stats_queued(uint32_t queued);
+
+#else
+
+static inline void bin_stats_open(uint32_t ring_size)
+{
+	ARG_UNUSED(ring_size);
+}
+
+static inline uint32_t bin_stats_begin(void)
+{
+	return 0;
+}
+
+static inline void bin_stats_write(uint32_t start, uint32_t frames,
+				   size_t bytes)
+{
+	ARG_UNUSED(start);
+	ARG_UNUSED(frames);
+	ARG_UNUSED(bytes);
+}
+
+static inline void bin_stats_stall(void)
+{
+}
+
+static inline void bin_stats_queued(uint32_t queued)
+{
+	ARG_UNUSED(queued);
+}
+
+#endif /* CONFIG_DATA_LOGGER_BIN_STATS */
+
+#endif /* AURORA_LIB_DATA_BIN_STATS_H_ */
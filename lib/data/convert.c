@@ -5,7 +5,9 @@
  * Walks the live flight log on whichever backend the bin formatter is
  * configured against (flash partition or disk-access region — see
  * bin_io.h) frame-by-frame, reconstructs each @ref datapoint losslessly,
- * and feeds it through the target formatter (CSV or InfluxDB).
+ * and feeds it through every target formatter (CSV, InfluxDB, ...) in
+ * the same pass, so the log is read from storage only once no matter how
+ * many outputs are produced.
  *
  * Recovery algorithm (works for both circular flash and linear disk):
  *
@@ -19,8 +21,46 @@
  *      1 per step.  Stop on the first slot that doesn't match
  *      (different flight, bad magic, gap, or out-of-order seq).
  *
- * Memory usage is bounded: only one frame and one record-decoded
- * @ref datapoint are held in RAM at a time, regardless of log length.
+ * Step 1 is only the last resort.  Both backends normally answer it
+ * through bin_io_window_start_hint() (slot 0 on disk, a binary search
+ * of the flash ring).  Failing that, with CONFIG_DATA_LOGGER_BIN_INDEX
+ * the oldest index entry that still matches its frame is at most one
+ * index interval past the window start, so only that stretch is
+ * walked back header by header.
+ *
+ * Frames flagged AURORA_BIN_FLAG_CRC are checked against their trailer
+ * first (CONFIG_DATA_LOGGER_BIN_CRC); a mismatch drops only that frame's
+ * records and the walk carries on at the next seq.
+ *
+ * Each frame is decoded according to its own header version, so a log
+ * holding fixed (v2), packed (v3) or columnar (v4) frames converts the
+ * same way no matter which payload this build writes.  The writer
+ * commits columnar frames in order of their first timestamp, so with
+ * CONFIG_DATA_LOGGER_BIN_COLUMNAR the converter keeps the latest frame
+ * of each type open and merges them: every record older than the next
+ * frame's first timestamp is emitted before that frame is opened, and
+ * the outputs see one time-ordered stream across types.  Without it,
+ * columnar frames are emitted one type at a time, grouped per frame.
+ *
+ * Memory usage is bounded: one frame buffer per prefetch slot
+ * (CONFIG_DATA_LOGGER_CONVERT_PREFETCH, at least one), one merge frame
+ * per data type with CONFIG_DATA_LOGGER_BIN_COLUMNAR and one decoded
+ * @ref datapoint, regardless of log length.  With prefetch enabled a
+ * reader thread walks the window ahead of the converter, so storage
+ * reads overlap with formatting and output writes.
+ * An output whose formatter fails keeps its error and drops out of the
+ * pass; the remaining outputs still run to the end of the log.
+ *
+ * With CONFIG_DATA_LOGGER_CONVERT_TRAIL the same walk can also run in
+ * steps behind the disk writer while the flight is still being logged
+ * (data_logger_convert_trail_begin/_step/_end): each step converts the
+ * frames the writer has put on storage since the last one and flushes
+ * every output, and the last one converts the rest after the close.
+ *
+ * data_logger_export() walks the same window but hands every frame to
+ * a callback untouched, so the host can decode it instead.
+ * data_logger_dump() does the same for a seq or time range, in batches
+ * of frames read with one storage access each.
  *
  * Copyright (c) 2026 Auxspace e.V.
  *
@@ -35,17 +75,89 @@
 
 #include <aurora/lib/data_logger.h>
 
+#include "bin_codec.h"
 #include "bin_io.h"
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+#include "bin_index.h"
+#endif
 
 LOG_MODULE_DECLARE(data_logger, CONFIG_DATA_LOGGER_LOG_LEVEL);
 
 #define BIN_FRAME_SIZE       ((size_t)CONFIG_DATA_LOGGER_BIN_FRAME_SIZE)
 #define BIN_HDR_SIZE         (sizeof(struct aurora_bin_frame_header))
 
-/* One frame's worth of bytes; aligned for the underlying driver. */
-static uint8_t convert_frame[CONFIG_DATA_LOGGER_BIN_FRAME_SIZE]
+#define CONVERT_PREFETCH     CONFIG_DATA_LOGGER_CONVERT_PREFETCH
+#define CONVERT_BUFS         MAX(CONVERT_PREFETCH, 1)
+
+/* Frame buffers; aligned for the underlying driver.  The header scan
+ * always uses the first one.
+ */
+static uint8_t convert_bufs[CONVERT_BUFS][CONFIG_DATA_LOGGER_BIN_FRAME_SIZE]
 	__aligned(CONFIG_DATA_LOGGER_BIN_BUF_ALIGN);
 
+/* Frame currently being decoded. */
+static const uint8_t *convert_frame = convert_bufs[0];
+
+/* Delta state for the packed frame currently being decoded. */
+static struct bin_codec_state convert_codec;
+
+/* One output of the running pass. */
+struct convert_sink {
+	struct data_logger logger;
+	struct data_logger_state state;
+	struct data_logger_convert_out *out;
+	bool open;
+};
+
+static struct convert_sink convert_sinks[DATA_LOGGER_CONVERT_MAX_OUT];
+static size_t convert_nsinks;
+/* Sinks that are open and have not failed yet. */
+static size_t convert_live;
+
+static inline bool sink_live(const struct convert_sink *s)
+{
+	return s->open && s->out->rc == 0;
+}
+
+/* Hand @p dp to every live output.  A failing output is dropped from
+ * the rest of the pass; the error is only returned once none is left.
+ */
+static int convert_emit(const struct datapoint *dp)
+{
+	int last = 0;
+
+	for (size_t i = 0; i < convert_nsinks; i++) {
+		struct convert_sink *s = &convert_sinks[i];
+
+		if (!sink_live(s)) {
+			continue;
+		}
+
+		int rc = s->logger.fmt->write_datapoint(&s->logger, dp);
+
+		if (rc != 0) {
+			LOG_ERR("convert: %s write_datapoint failed (%d)",
+				s->logger.fmt->name, rc);
+			s->out->rc = rc;
+			convert_live--;
+			last = rc;
+		}
+	}
+
+	return convert_live == 0 ? last : 0;
+}
+
+/* Fail every live output with @p rc (e.g. on a storage read error). */
+static void convert_fail_all(int rc)
+{
+	for (size_t i = 0; i < convert_nsinks; i++) {
+		if (sink_live(&convert_sinks[i])) {
+			convert_sinks[i].out->rc = rc;
+		}
+	}
+	convert_live = 0;
+}
+
 static void record_to_datapoint(const struct aurora_bin_record *rec,
 				uint64_t base_ts_ns,
 				struct datapoint *dp)
@@ -68,8 +180,9 @@ static void record_to_datapoint(const struct aurora_bin_record *rec,
  */
 static int read_frame(off_t off)
 {
-	int rc = bin_io_read(off, convert_frame, BIN_FRAME_SIZE);
+	int rc = bin_io_read(off, convert_bufs[0], BIN_FRAME_SIZE);
 
+	convert_frame = convert_bufs[0];
 	if (rc != 0) {
 		LOG_ERR("convert: bin_io_read at %ld failed (%d)",
 			(long)off, rc);
@@ -77,7 +190,7 @@ static int read_frame(off_t off)
 	return rc;
 }
 
-/* Returns 0 if the slot at @p off holds a valid current-version frame
+/* Returns 0 if the slot at @p off holds a valid, supported-version frame
  * (header copied to *out), positive if the slot is unwritten /
  * unsupported, negative on read error.
  */
@@ -96,7 +209,7 @@ static int read_header(off_t off, struct aurora_bin_frame_header *out)
 		return 1; /* unwritten / non-frame */
 	}
 
-	if (out->version != AURORA_BIN_VERSION) {
+	if (!bin_codec_version_supported(out->version)) {
 		LOG_WRN("convert: unsupported frame version %u at %ld",
 			out->version, (long)off);
 		return 1;
@@ -153,148 +266,1431 @@ static int find_window_start(size_t total_size,
 	return 0;
 }
 
-int data_logger_convert(const struct data_logger_formatter *out_fmt,
-			const char *out_path)
-{
-	struct data_logger out_logger;
-	struct data_logger_state out_state;
-	off_t start_offset;
-	uint32_t expect_seq;
-	uint64_t flight_id;
-	int rc;
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
 
-	if (out_fmt == NULL || out_path == NULL) {
-		return -EINVAL;
-	}
+/* Index slot image, kept apart from the frame buffers the lookups use. */
+static uint8_t convert_index[CONFIG_DATA_LOGGER_BIN_FRAME_SIZE]
+	__aligned(CONFIG_DATA_LOGGER_BIN_BUF_ALIGN);
+
+static int index_load(size_t total_size,
+		      const struct aurora_bin_index_header **hdr,
+		      const struct aurora_bin_index_entry **entries)
+{
+	int rc = bin_io_read((off_t)total_size, convert_index, BIN_FRAME_SIZE);
 
-	rc = bin_io_open();
 	if (rc != 0) {
+		LOG_ERR("convert: index read failed (%d)", rc);
 		return rc;
 	}
+	return bin_index_parse(convert_index, hdr, entries);
+}
 
-	const size_t total_size = bin_io_total_size();
-	const uint32_t ring_frames =
-		(uint32_t)(total_size / BIN_FRAME_SIZE);
-
-	memset(&out_logger, 0, sizeof(out_logger));
-	memset(&out_state, 0, sizeof(out_state));
-	k_mutex_init(&out_state.mutex);
-	out_logger.fmt   = out_fmt;
-	out_logger.state = &out_state;
+/* Returns 0 if entry @p e still describes the frame in its slot (header
+ * copied to *fh), positive if the slot has moved on since, negative on
+ * read error.
+ */
+static int index_check(const struct aurora_bin_index_entry *e,
+		       uint64_t flight_id, size_t total_size,
+		       struct aurora_bin_frame_header *fh)
+{
+	off_t off = (off_t)e->slot * (off_t)BIN_FRAME_SIZE;
 
-	rc = out_fmt->init(&out_logger, out_path);
-	if (rc != 0) {
-		LOG_ERR("convert: %s init failed (%d)", out_fmt->name, rc);
-		goto out_io;
+	if ((size_t)off + BIN_FRAME_SIZE > total_size) {
+		return 1;
 	}
 
-	rc = out_fmt->write_header(&out_logger);
+	int rc = read_header(off, fh);
+
 	if (rc != 0) {
-		LOG_ERR("convert: %s write_header failed (%d)",
-			out_fmt->name, rc);
-		goto out_close;
+		return rc;
 	}
+	return (fh->flight_id == flight_id && fh->seq == e->seq) ? 0 : 1;
+}
+
+/* find_window_start() through the index.  Returns -ENOTSUP if the index
+ * is missing or none of its entries survived, so the caller scans.
+ */
+static int index_window_start(size_t total_size,
+			      off_t *out_offset,
+			      uint32_t *out_seq,
+			      uint64_t *out_flight_id)
+{
+	const struct aurora_bin_index_header *hdr;
+	const struct aurora_bin_index_entry *entries;
+	const uint32_t ring_frames = (uint32_t)(total_size / BIN_FRAME_SIZE);
+	struct aurora_bin_frame_header fh;
+	size_t i;
+	int rc = index_load(total_size, &hdr, &entries);
 
-	rc = bin_io_window_start_hint(&start_offset, &expect_seq, &flight_id);
-	if (rc == -ENOTSUP) {
-		rc = find_window_start(total_size, &start_offset, &expect_seq,
-				       &flight_id);
-	}
 	if (rc == -ENOENT) {
-		/* No valid frames; emit an empty (header-only) file
-		 * successfully so callers can distinguish "no flight" from
-		 * real errors via on-disk presence.
-		 */
-		rc = 0;
-		goto out_flush;
+		return -ENOTSUP;
 	}
 	if (rc != 0) {
-		goto out_close;
+		return rc;
 	}
 
-	const size_t records_per_frame =
-		(BIN_FRAME_SIZE - BIN_HDR_SIZE) /
-		sizeof(struct aurora_bin_record);
+	for (i = 0; i < hdr->count; i++) {
+		rc = index_check(&entries[i], hdr->flight_id, total_size, &fh);
+		if (rc < 0) {
+			return rc;
+		}
+		if (rc == 0) {
+			break;
+		}
+	}
+	if (i == hdr->count) {
+		return -ENOTSUP;
+	}
 
-	off_t cur_offset = start_offset;
-	uint32_t frames_seen = 0;
+	const uint64_t flight_id = hdr->flight_id;
+	uint32_t slot = entries[i].slot;
+	uint32_t seq  = entries[i].seq;
 
-	while (frames_seen < ring_frames) {
-		rc = read_frame(cur_offset);
-		if (rc != 0) {
-			goto out_close;
+	/* Older frames the index skipped sit right behind it. */
+	for (uint32_t n = 1; n < ring_frames && seq > 0U; n++) {
+		uint32_t prev = slot == 0U ? ring_frames - 1U : slot - 1U;
+
+		rc = read_header((off_t)prev * (off_t)BIN_FRAME_SIZE, &fh);
+		if (rc < 0) {
+			return rc;
+		}
+		if (rc > 0 || fh.flight_id != flight_id || fh.seq != seq - 1U) {
+			break;
 		}
+		slot = prev;
+		seq--;
+	}
 
-		const struct aurora_bin_frame_header *fh =
-			(const struct aurora_bin_frame_header *)convert_frame;
+	*out_offset    = (off_t)slot * (off_t)BIN_FRAME_SIZE;
+	*out_seq       = seq;
+	*out_flight_id = flight_id;
+	return 0;
+}
 
-		if (memcmp(fh->magic, AURORA_BIN_FRAME_MAGIC,
-			   sizeof(fh->magic)) != 0) {
-			break; /* gap (e.g. boost cap region) */
-		}
-		if (fh->flight_id != flight_id) {
-			break; /* leftover from a previous flight */
+/* Newest entry with base_ts_ns <= @p ts_ns; entries are in seq order. */
+static const struct aurora_bin_index_entry *
+index_find_time(const struct aurora_bin_index_entry *entries, size_t count,
+		uint64_t ts_ns)
+{
+	size_t lo = 0;
+	size_t hi = count;
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2U;
+
+		if (entries[mid].base_ts_ns <= ts_ns) {
+			lo = mid + 1U;
+		} else {
+			hi = mid;
 		}
-		if (fh->seq != expect_seq) {
-			break; /* out-of-order / skipped */
+	}
+	return lo == 0U ? NULL : &entries[lo - 1U];
+}
+
+/* Look up @p mark, or @p ts_ns for AURORA_BIN_MARK_FRAME. */
+static int index_seek(enum aurora_bin_mark mark, uint64_t ts_ns,
+		      struct data_logger_seek *out)
+{
+	const struct aurora_bin_index_header *hdr;
+	const struct aurora_bin_index_entry *entries;
+	const struct aurora_bin_index_entry *e = NULL;
+	struct aurora_bin_frame_header fh;
+	int rc = bin_io_open();
+
+	if (rc != 0) {
+		return rc;
+	}
+
+	const size_t total_size = bin_io_total_size();
+
+	rc = index_load(total_size, &hdr, &entries);
+	if (rc != 0) {
+		goto out;
+	}
+
+	if (mark == AURORA_BIN_MARK_FRAME) {
+		e = index_find_time(entries, hdr->count, ts_ns);
+	} else {
+		for (size_t i = 0; i < hdr->count; i++) {
+			if (entries[i].mark == (uint8_t)mark) {
+				e = &entries[i];
+				break;
+			}
 		}
+	}
+	if (e == NULL) {
+		rc = -ENOENT;
+		goto out;
+	}
+
+	rc = index_check(e, hdr->flight_id, total_size, &fh);
+	if (rc > 0) {
+		rc = -ENOENT;
+	} else if (rc == 0) {
+		out->offset     = (off_t)e->slot * (off_t)BIN_FRAME_SIZE;
+		out->seq        = fh.seq;
+		out->base_ts_ns = fh.base_ts_ns;
+	}
+
+out:
+	(void)bin_io_close();
+	return rc;
+}
+
+#endif /* CONFIG_DATA_LOGGER_BIN_INDEX */
+
+/* data_logger_seek_event – see data_logger.h */
+int data_logger_seek_event(enum data_logger_event ev,
+			   struct data_logger_seek *out)
+{
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+	enum aurora_bin_mark mark;
+
+	if (out == NULL) {
+		return -EINVAL;
+	}
+
+	switch (ev) {
+	case DLE_BOOST:
+		mark = AURORA_BIN_MARK_BOOST;
+		break;
+	case DLE_APOGEE:
+		mark = AURORA_BIN_MARK_APOGEE;
+		break;
+	case DLE_LANDED:
+		mark = AURORA_BIN_MARK_LANDED;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	return index_seek(mark, 0, out);
+#else
+	ARG_UNUSED(ev);
+	ARG_UNUSED(out);
+	return -ENOTSUP;
+#endif
+}
+
+/* data_logger_seek_time – see data_logger.h */
+int data_logger_seek_time(uint64_t ts_ns, struct data_logger_seek *out)
+{
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+	if (out == NULL) {
+		return -EINVAL;
+	}
+	return index_seek(AURORA_BIN_MARK_FRAME, ts_ns, out);
+#else
+	ARG_UNUSED(ts_ns);
+	ARG_UNUSED(out);
+	return -ENOTSUP;
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+/*  Read-ahead pipeline                                                       */
+/* -------------------------------------------------------------------------- */
+
+#if CONVERT_PREFETCH > 0
 
-		const struct aurora_bin_record *recs =
-			(const struct aurora_bin_record *)
-			(convert_frame + BIN_HDR_SIZE);
+/* A filled buffer handed from the reader to the converter. */
+struct convert_fetch {
+	int idx;
+	int rc;
+};
+
+K_MSGQ_DEFINE(convert_free_q, sizeof(int), CONVERT_BUFS, 4);
+K_MSGQ_DEFINE(convert_full_q, sizeof(struct convert_fetch), CONVERT_BUFS, 4);
+K_SEM_DEFINE(convert_fetch_start, 0, 1);
+K_SEM_DEFINE(convert_fetch_done, 0, 1);
+
+static atomic_t convert_fetch_cancel;
+static off_t convert_fetch_off;
+static uint32_t convert_fetch_count;
+static size_t convert_fetch_total;
+/* Buffer the converter is decoding, -1 if none. */
+static int convert_held = -1;
+
+/* Reads up to convert_fetch_count frames from convert_fetch_off in
+ * physical order, wrapping at the region end, and stops at the first
+ * read error or once the converter cancels.  Each read goes into a free
+ * buffer, so it never runs more than CONVERT_BUFS frames ahead.
+ */
+static void convert_reader(void *, void *, void *)
+{
+	while (1) {
+		k_sem_take(&convert_fetch_start, K_FOREVER);
 
-		for (size_t i = 0; i < records_per_frame; i++) {
-			const struct aurora_bin_record *rec = &recs[i];
+		off_t off = convert_fetch_off;
 
-			if (rec->type == 0xFFU) {
+		for (uint32_t n = 0; n < convert_fetch_count; n++) {
+			struct convert_fetch f;
+
+			(void)k_msgq_get(&convert_free_q, &f.idx, K_FOREVER);
+			if (atomic_get(&convert_fetch_cancel) != 0) {
 				break;
 			}
-			if (rec->type >= AURORA_DATA_COUNT) {
-				LOG_WRN("convert: invalid record type %u at "
-					"frame %u, slot %zu — stopping frame",
-					rec->type, fh->seq, i);
+
+			f.rc = bin_io_read(off, convert_bufs[f.idx],
+					   BIN_FRAME_SIZE);
+			(void)k_msgq_put(&convert_full_q, &f, K_NO_WAIT);
+			if (f.rc != 0) {
 				break;
 			}
 
-			struct datapoint dp;
+			off += (off_t)BIN_FRAME_SIZE;
+			if ((size_t)off >= convert_fetch_total) {
+				off = 0;
+			}
+		}
+
+		k_sem_give(&convert_fetch_done);
+	}
+}
 
-			record_to_datapoint(rec, fh->base_ts_ns, &dp);
+K_THREAD_DEFINE(convert_reader_th, CONFIG_DATA_LOGGER_CONVERT_READER_STACK_SIZE,
+		convert_reader, NULL, NULL, NULL,
+		CONFIG_DATA_LOGGER_CONVERT_READER_PRIO, 0, 0);
 
-			rc = out_fmt->write_datapoint(&out_logger, &dp);
-			if (rc != 0) {
-				LOG_ERR("convert: write_datapoint failed (%d)",
-					rc);
-				goto out_close;
-			}
+static void convert_fetch_begin(off_t off, uint32_t count, size_t total)
+{
+	k_msgq_purge(&convert_free_q);
+	k_msgq_purge(&convert_full_q);
+	for (int i = 0; i < CONVERT_BUFS; i++) {
+		(void)k_msgq_put(&convert_free_q, &i, K_NO_WAIT);
+	}
+
+	k_sem_reset(&convert_fetch_done);
+	atomic_set(&convert_fetch_cancel, 0);
+	convert_held        = -1;
+	convert_fetch_off   = off;
+	convert_fetch_count = count;
+	convert_fetch_total = total;
+	k_sem_give(&convert_fetch_start);
+}
+
+static void convert_fetch_release(void)
+{
+	if (convert_held >= 0) {
+		(void)k_msgq_put(&convert_free_q, &convert_held, K_NO_WAIT);
+		convert_held = -1;
+	}
+}
+
+/* Hand back the previous frame and wait for the next one. */
+static int convert_fetch_next(off_t off)
+{
+	struct convert_fetch f;
+
+	convert_fetch_release();
+	(void)k_msgq_get(&convert_full_q, &f, K_FOREVER);
+
+	convert_held  = f.idx;
+	convert_frame = convert_bufs[f.idx];
+	if (f.rc != 0) {
+		LOG_ERR("convert: bin_io_read at %ld failed (%d)",
+			(long)off, f.rc);
+	}
+	return f.rc;
+}
+
+/* Stop the reader and wait until it is idle again.  Frames it already
+ * read are recycled so it can never block on a full pipeline.
+ */
+static void convert_fetch_end(void)
+{
+	struct convert_fetch f;
+
+	atomic_set(&convert_fetch_cancel, 1);
+	convert_fetch_release();
+
+	while (k_sem_take(&convert_fetch_done, K_NO_WAIT) != 0) {
+		if (k_msgq_get(&convert_full_q, &f, K_MSEC(10)) == 0) {
+			(void)k_msgq_put(&convert_free_q, &f.idx, K_NO_WAIT);
 		}
+	}
+}
 
-		expect_seq++;
-		frames_seen++;
-		cur_offset += (off_t)BIN_FRAME_SIZE;
-		if ((size_t)cur_offset >= total_size) {
-			cur_offset = 0;
+#else /* CONVERT_PREFETCH == 0 */
+
+static inline void convert_fetch_begin(off_t off, uint32_t count, size_t total)
+{
+	ARG_UNUSED(off);
+	ARG_UNUSED(count);
+	ARG_UNUSED(total);
+}
+
+static inline int convert_fetch_next(off_t off)
+{
+	return read_frame(off);
+}
+
+static inline void convert_fetch_end(void)
+{
+}
+
+#endif /* CONVERT_PREFETCH > 0 */
+
+/* Emit every fixed-size (v2) record of the frame in convert_frame. */
+static int convert_frame_fixed(const struct aurora_bin_frame_header *fh)
+{
+	const size_t records_per_frame =
+		(bin_codec_payload_end(BIN_FRAME_SIZE, fh->reserved0) -
+		 BIN_HDR_SIZE) / sizeof(struct aurora_bin_record);
+	const struct aurora_bin_record *recs =
+		(const struct aurora_bin_record *)
+		(convert_frame + BIN_HDR_SIZE);
+
+	for (size_t i = 0; i < records_per_frame; i++) {
+		const struct aurora_bin_record *rec = &recs[i];
+
+		if (rec->type == 0xFFU) {
+			break;
+		}
+		if (rec->type >= AURORA_DATA_COUNT) {
+			LOG_WRN("convert: invalid record type %u at "
+				"frame %u, slot %zu — stopping frame",
+				rec->type, fh->seq, i);
+			break;
+		}
+
+		struct datapoint dp;
+
+		record_to_datapoint(rec, fh->base_ts_ns, &dp);
+
+		int rc = convert_emit(&dp);
+
+		if (rc != 0) {
+			return rc;
 		}
 	}
 
-out_flush:
-	{
-		int rc_flush = out_fmt->flush(&out_logger);
+	return 0;
+}
+
+/* Emit every delta/varint-packed (v3) record of the frame in convert_frame. */
+static int convert_frame_packed(const struct aurora_bin_frame_header *fh)
+{
+	const size_t end = bin_codec_payload_end(BIN_FRAME_SIZE, fh->reserved0);
+	size_t off = BIN_HDR_SIZE;
+
+	bin_codec_reset(&convert_codec);
+
+	while (off < end) {
+		struct datapoint dp;
+		int n = bin_codec_decode(&convert_codec, fh->base_ts_ns,
+					 convert_frame + off, end - off, &dp);
 
-		if (rc == 0 && rc_flush != 0) {
-			LOG_ERR("convert: flush failed (%d)", rc_flush);
-			rc = rc_flush;
+		if (n == 0) {
+			break;
+		}
+		if (n < 0) {
+			LOG_WRN("convert: malformed packed record at frame %u, "
+				"byte %zu — stopping frame", fh->seq, off);
+			break;
+		}
+		off += (size_t)n;
+
+		int rc = convert_emit(&dp);
+
+		if (rc != 0) {
+			return rc;
 		}
 	}
 
-out_close:
-	{
-		int rc_close = out_fmt->close(&out_logger);
+	return 0;
+}
+
+/* Check the tag of the columnar (v4) frame @p fh and return its
+ * capacity, or 0 if the frame has to be skipped.
+ */
+static size_t convert_col_cap(const struct aurora_bin_frame_header *fh)
+{
+	const uint8_t type     = AURORA_BIN_COL_TAG_TYPE(fh->reserved1);
+	const uint8_t channels = AURORA_BIN_COL_TAG_CHANNELS(fh->reserved1);
+	const uint16_t count   = AURORA_BIN_COL_TAG_COUNT(fh->reserved1);
+
+	if (type >= AURORA_DATA_COUNT || channels > DP_MAX_CHANNELS) {
+		LOG_WRN("convert: invalid columnar tag 0x%08x at frame %u",
+			fh->reserved1, fh->seq);
+		return 0;
+	}
+
+	const size_t cap = AURORA_BIN_COL_CAPACITY(
+		bin_codec_payload_end(BIN_FRAME_SIZE, fh->reserved0), channels);
+
+	if (count > cap) {
+		LOG_WRN("convert: columnar count %u exceeds capacity %zu at "
+			"frame %u", count, cap, fh->seq);
+		return 0;
+	}
+	return cap;
+}
+
+/* Timestamp of the @p i th record of the columnar frame @p frame. */
+static inline uint64_t convert_col_ts(const uint8_t *frame, size_t cap,
+				      size_t i)
+{
+	const struct aurora_bin_frame_header *fh =
+		(const struct aurora_bin_frame_header *)frame;
+	const uint32_t *ts = (const uint32_t *)
+		(frame + AURORA_BIN_COL_OFFSET(cap, 0));
+
+	return fh->base_ts_ns + (uint64_t)ts[i] * 1000ULL;
+}
+
+/* Build the @p i th record of the columnar frame @p frame into @p dp. */
+static void convert_col_record(const uint8_t *frame, size_t cap, size_t i,
+			       struct datapoint *dp)
+{
+	const struct aurora_bin_frame_header *fh =
+		(const struct aurora_bin_frame_header *)frame;
+
+	memset(dp, 0, sizeof(*dp));
+	dp->type          = (enum aurora_data)AURORA_BIN_COL_TAG_TYPE(fh->reserved1);
+	dp->channel_count = AURORA_BIN_COL_TAG_CHANNELS(fh->reserved1);
+	dp->timestamp_ns  = convert_col_ts(frame, cap, i);
+
+	for (uint8_t c = 0; c < dp->channel_count; c++) {
+		const int32_t *val1 = (const int32_t *)(frame +
+			AURORA_BIN_COL_OFFSET(cap, 1U + 2U * c));
+		const int32_t *val2 = (const int32_t *)(frame +
+			AURORA_BIN_COL_OFFSET(cap, 2U + 2U * c));
+
+		dp->channels[c].val1 = val1[i];
+		dp->channels[c].val2 = val2[i];
+	}
+}
+
+#if defined(CONFIG_DATA_LOGGER_BIN_COLUMNAR)
+/* Latest columnar frame of each type, with the records not emitted yet. */
+static uint8_t convert_col_bufs[AURORA_DATA_COUNT][BIN_FRAME_SIZE]
+	__aligned(4);
+
+static struct {
+	size_t cap;
+	uint16_t next;            /* next record to emit */
+	uint16_t count;           /* 0 = nothing pending */
+} convert_cols[AURORA_DATA_COUNT];
+
+static void convert_col_reset(void)
+{
+	memset(convert_cols, 0, sizeof(convert_cols));
+}
+
+/* Emit the pending columnar records up to @p limit_ns, oldest first. */
+static int convert_col_emit_upto(uint64_t limit_ns)
+{
+	while (true) {
+		struct datapoint dp;
+		uint8_t oldest = AURORA_DATA_COUNT;
+		uint64_t oldest_ns = 0;
+
+		for (uint8_t t = 0; t < AURORA_DATA_COUNT; t++) {
+			if (convert_cols[t].next == convert_cols[t].count) {
+				continue;
+			}
+
+			const uint64_t ts = convert_col_ts(convert_col_bufs[t],
+							   convert_cols[t].cap,
+							   convert_cols[t].next);
+
+			if (oldest == AURORA_DATA_COUNT || ts < oldest_ns) {
+				oldest    = t;
+				oldest_ns = ts;
+			}
+		}
+		if (oldest == AURORA_DATA_COUNT || oldest_ns > limit_ns) {
+			return 0;
+		}
+
+		convert_col_record(convert_col_bufs[oldest],
+				   convert_cols[oldest].cap,
+				   convert_cols[oldest].next++, &dp);
 
-		if (rc == 0 && rc_close != 0) {
-			rc = rc_close;
+		int rc = convert_emit(&dp);
+
+		if (rc != 0) {
+			return rc;
 		}
 	}
-out_io:
-	(void)bin_io_close();
+}
+
+static inline int convert_col_drain(void)
+{
+	return convert_col_emit_upto(UINT64_MAX);
+}
+
+/* Open the columnar (v4) frame in convert_frame for merging.  Every
+ * pending record older than its first one is emitted first: no later
+ * frame can hold an older record than that.
+ */
+static int convert_frame_columnar(const struct aurora_bin_frame_header *fh)
+{
+	const uint8_t type     = AURORA_BIN_COL_TAG_TYPE(fh->reserved1);
+	const uint16_t count   = AURORA_BIN_COL_TAG_COUNT(fh->reserved1);
+	const size_t cap       = convert_col_cap(fh);
+	int rc;
+
+	if (cap == 0U || count == 0U) {
+		return 0;
+	}
+
+	rc = convert_col_emit_upto(fh->base_ts_ns);
+	if (rc != 0) {
+		return rc;
+	}
+
+	/* The previous frame of this type normally ends before this one
+	 * starts; if not, merge out its rest before reusing its buffer.
+	 * Every pass emits at least that frame's next record.
+	 */
+	while (convert_cols[type].next != convert_cols[type].count) {
+		rc = convert_col_emit_upto(
+			convert_col_ts(convert_col_bufs[type],
+				       convert_cols[type].cap,
+				       convert_cols[type].next));
+		if (rc != 0) {
+			return rc;
+		}
+	}
+
+	memcpy(convert_col_bufs[type], convert_frame, BIN_FRAME_SIZE);
+	convert_cols[type].cap   = cap;
+	convert_cols[type].next  = 0;
+	convert_cols[type].count = count;
+	return 0;
+}
+#else
+static inline void convert_col_reset(void)
+{
+}
+
+static inline int convert_col_drain(void)
+{
+	return 0;
+}
+
+/* Emit every record of the single-type columnar (v4) frame in
+ * convert_frame.
+ */
+static int convert_frame_columnar(const struct aurora_bin_frame_header *fh)
+{
+	const uint16_t count = AURORA_BIN_COL_TAG_COUNT(fh->reserved1);
+	const size_t cap     = convert_col_cap(fh);
+
+	if (cap == 0U) {
+		return 0;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		struct datapoint dp;
+
+		convert_col_record(convert_frame, cap, i, &dp);
+
+		int rc = convert_emit(&dp);
+
+		if (rc != 0) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_DATA_LOGGER_BIN_COLUMNAR */
+
+/* Find where @p session (or the newest flight if NULL) starts and how
+ * many frames it may span at most.
+ */
+static int convert_locate(const struct data_logger_session *session,
+			  size_t total_size, off_t *start_offset,
+			  uint32_t *expect_seq, uint64_t *flight_id,
+			  uint32_t *frame_limit)
+{
+	int rc;
+
+	*frame_limit = (uint32_t)(total_size / BIN_FRAME_SIZE);
+
+	if (session != NULL) {
+		*start_offset = session->offset;
+		*expect_seq   = 0;
+		*flight_id    = session->flight_id;
+		if (session->frames != AURORA_BIN_SESSION_OPEN) {
+			*frame_limit = MIN(session->frames, *frame_limit);
+		}
+		return 0;
+	}
+
+	rc = bin_io_window_start_hint(start_offset, expect_seq, flight_id);
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+	if (rc == -ENOTSUP) {
+		rc = index_window_start(total_size, start_offset, expect_seq,
+					flight_id);
+	}
+#endif
+	if (rc == -ENOTSUP) {
+		rc = find_window_start(total_size, start_offset, expect_seq,
+				       flight_id);
+	}
+	return rc;
+}
+
+/* Whether @p fh continues the walk of @p flight_id at @p expect_seq. */
+static inline bool convert_frame_follows(const struct aurora_bin_frame_header *fh,
+					 uint64_t flight_id,
+					 uint32_t expect_seq)
+{
+	return memcmp(fh->magic, AURORA_BIN_FRAME_MAGIC,
+		      sizeof(fh->magic)) == 0 &&
+	       fh->flight_id == flight_id && fh->seq == expect_seq;
+}
+
+/* Whether the frame in convert_frame passes its CRC, if it carries one. */
+static inline bool convert_frame_intact(const struct aurora_bin_frame_header *fh)
+{
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+	if ((fh->reserved0 & AURORA_BIN_FLAG_CRC) != 0U &&
+	    !bin_codec_crc_ok(convert_frame, BIN_FRAME_SIZE)) {
+		LOG_WRN("convert: CRC mismatch in frame %u, skipped", fh->seq);
+		return false;
+	}
+#else
+	ARG_UNUSED(fh);
+#endif
+	return true;
+}
+
+static bool convert_outs_valid(const struct data_logger_convert_out *outs,
+			       size_t n)
+{
+	if (outs == NULL || n == 0U || n > DATA_LOGGER_CONVERT_MAX_OUT) {
+		return false;
+	}
+	for (size_t i = 0; i < n; i++) {
+		if (outs[i].fmt == NULL || outs[i].path == NULL) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/* Open every output of @p outs and write its header.  Outputs that fail
+ * keep their error; convert_live counts the rest.
+ */
+static void convert_sinks_open(struct data_logger_convert_out *outs, size_t n)
+{
+	convert_nsinks = n;
+	convert_live   = 0;
+	convert_col_reset();
+
+	for (size_t i = 0; i < n; i++) {
+		struct convert_sink *s = &convert_sinks[i];
+		const struct data_logger_formatter *fmt = outs[i].fmt;
+		int rc;
+
+		outs[i].rc = 0;
+		memset(s, 0, sizeof(*s));
+		k_mutex_init(&s->state.mutex);
+		s->logger.fmt   = fmt;
+		s->logger.state = &s->state;
+		s->out          = &outs[i];
+
+		rc = fmt->init(&s->logger, outs[i].path);
+		if (rc != 0) {
+			LOG_ERR("convert: %s init failed (%d)", fmt->name, rc);
+			outs[i].rc = rc;
+			continue;
+		}
+		s->open = true;
+
+		rc = fmt->write_header(&s->logger);
+		if (rc != 0) {
+			LOG_ERR("convert: %s write_header failed (%d)",
+				fmt->name, rc);
+			outs[i].rc = rc;
+			continue;
+		}
+		convert_live++;
+	}
+}
+
+static void convert_sinks_flush(void)
+{
+	for (size_t i = 0; i < convert_nsinks; i++) {
+		struct convert_sink *s = &convert_sinks[i];
+
+		if (!sink_live(s)) {
+			continue;
+		}
+
+		int rc_flush = s->logger.fmt->flush(&s->logger);
+
+		if (rc_flush != 0) {
+			LOG_ERR("convert: %s flush failed (%d)",
+				s->logger.fmt->name, rc_flush);
+			s->out->rc = rc_flush;
+			convert_live--;
+		}
+	}
+}
+
+/* Close every open output; returns the first output's error. */
+static int convert_sinks_close(struct data_logger_convert_out *outs, size_t n)
+{
+	for (size_t i = 0; i < n; i++) {
+		struct convert_sink *s = &convert_sinks[i];
+
+		if (!s->open) {
+			continue;
+		}
+
+		int rc_close = s->logger.fmt->close(&s->logger);
+
+		if (s->out->rc == 0 && rc_close != 0) {
+			s->out->rc = rc_close;
+		}
+		s->open = false;
+	}
+	convert_nsinks = 0;
+	convert_live   = 0;
+
+	for (size_t i = 0; i < n; i++) {
+		if (outs[i].rc != 0) {
+			return outs[i].rc;
+		}
+	}
+	return 0;
+}
+
+/* Convert up to @p frame_limit frames of @p flight_id from *offset on,
+ * advancing *offset, *seq and *frames past each one.  Returns true once
+ * the walk has reached the end of the flight (or every output failed),
+ * false if it stopped at @p frame_limit.
+ */
+static bool convert_walk(off_t *offset, uint32_t *seq, uint32_t *frames,
+			 uint64_t flight_id, uint32_t frame_limit,
+			 size_t total_size)
+{
+	off_t cur_offset = *offset;
+	uint32_t expect_seq = *seq;
+	uint32_t frames_seen = 0;
+	bool end = true;
+	int rc;
+
+	convert_fetch_begin(cur_offset, frame_limit, total_size);
+
+	while (true) {
+		if (frames_seen == frame_limit) {
+			end = false;
+			break;
+		}
+
+		rc = convert_fetch_next(cur_offset);
+		if (rc != 0) {
+			convert_fail_all(rc);
+			break;
+		}
+
+		const struct aurora_bin_frame_header *fh =
+			(const struct aurora_bin_frame_header *)convert_frame;
+
+		if (!convert_frame_follows(fh, flight_id, expect_seq)) {
+			/* gap (e.g. boost cap region), leftover from a
+			 * previous flight, or out-of-order / skipped seq
+			 */
+			break;
+		}
+
+		/* A row-wise frame comes after every pending columnar record. */
+		rc = fh->version == AURORA_BIN_VERSION_COLUMNAR
+			? 0 : convert_col_drain();
+		if (rc != 0) {
+			break; /* every output has failed */
+		}
+
+		if (!convert_frame_intact(fh)) {
+			/* Torn or corrupted: its neighbours are still good. */
+			rc = 0;
+		} else if (fh->version == AURORA_BIN_VERSION_PACKED) {
+			rc = convert_frame_packed(fh);
+		} else if (fh->version == AURORA_BIN_VERSION_COLUMNAR) {
+			rc = convert_frame_columnar(fh);
+		} else if (fh->version == AURORA_BIN_VERSION_FIXED) {
+			rc = convert_frame_fixed(fh);
+		} else {
+			LOG_WRN("convert: unsupported frame version %u at %ld",
+				fh->version, (long)cur_offset);
+			break;
+		}
+		if (rc != 0) {
+			break; /* every output has failed */
+		}
+
+		expect_seq++;
+		frames_seen++;
+		cur_offset += (off_t)BIN_FRAME_SIZE;
+		if ((size_t)cur_offset >= total_size) {
+			cur_offset = 0;
+		}
+	}
+
+	convert_fetch_end();
+
+	*offset  = cur_offset;
+	*seq     = expect_seq;
+	*frames += frames_seen;
+	return end;
+}
+
+#if defined(CONFIG_DATA_LOGGER_CONVERT_TRAIL)
+/* State of the conversion trailing the live logger. */
+static struct {
+	struct data_logger_convert_out *outs;
+	size_t n;
+	struct data_logger_session session;
+	off_t offset;             /* next frame to convert */
+	uint32_t seq;
+	uint32_t frames;          /* frames converted so far */
+	bool open;
+	bool end;                 /* walk reached the end of the flight */
+} convert_trail;
+
+static inline bool convert_trailing(void)
+{
+	return convert_trail.open;
+}
+#else
+static inline bool convert_trailing(void)
+{
+	return false;
+}
+#endif /* CONFIG_DATA_LOGGER_CONVERT_TRAIL */
+
+/* Convert @p session, or the newest flight on storage if NULL. */
+static int convert_run(struct data_logger_convert_out *outs, size_t n,
+		       const struct data_logger_session *session)
+{
+	off_t start_offset;
+	uint32_t expect_seq;
+	uint64_t flight_id;
+	uint32_t frame_limit;
+	uint32_t frames = 0;
+	int rc;
+
+	if (!convert_outs_valid(outs, n)) {
+		return -EINVAL;
+	}
+	if (convert_trailing()) {
+		/* The outputs and frame buffers belong to the trail. */
+		return -EBUSY;
+	}
+
+	rc = bin_io_open();
+	if (rc != 0) {
+		for (size_t i = 0; i < n; i++) {
+			outs[i].rc = rc;
+		}
+		return rc;
+	}
+
+	const size_t total_size = bin_io_total_size();
+
+	convert_sinks_open(outs, n);
+	if (convert_live == 0) {
+		goto out_close;
+	}
+
+	rc = convert_locate(session, total_size, &start_offset, &expect_seq,
+			    &flight_id, &frame_limit);
+	if (rc == -ENOENT) {
+		/* No valid frames; emit empty (header-only) files
+		 * successfully so callers can distinguish "no flight" from
+		 * real errors via on-disk presence.
+		 */
+		goto out_flush;
+	}
+	if (rc != 0) {
+		convert_fail_all(rc);
+		goto out_close;
+	}
+
+	(void)convert_walk(&start_offset, &expect_seq, &frames, flight_id,
+			   frame_limit, total_size);
+	(void)convert_col_drain();
+
+out_flush:
+	convert_sinks_flush();
+
+out_close:
+	rc = convert_sinks_close(outs, n);
+	(void)bin_io_close();
 	return rc;
 }
+
+/* data_logger_convert_multi – see data_logger.h */
+int data_logger_convert_multi(struct data_logger_convert_out *outs, size_t n)
+{
+	return convert_run(outs, n, NULL);
+}
+
+/* data_logger_sessions – see data_logger.h */
+int data_logger_sessions(struct data_logger_session *out, size_t max)
+{
+#if defined(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+	if (out == NULL && max > 0U) {
+		return -EINVAL;
+	}
+
+	int rc = bin_io_open();
+
+	if (rc != 0) {
+		return rc;
+	}
+	rc = bin_io_sessions(out, max);
+	(void)bin_io_close();
+	return rc;
+#else
+	ARG_UNUSED(out);
+	ARG_UNUSED(max);
+	return -ENOTSUP;
+#endif
+}
+
+/* data_logger_convert_session – see data_logger.h */
+int data_logger_convert_session(const struct data_logger_session *session,
+				struct data_logger_convert_out *outs, size_t n)
+{
+#if defined(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+	if (session == NULL) {
+		return -EINVAL;
+	}
+
+	int rc = convert_run(outs, n, session);
+
+	if (rc != 0) {
+		return rc;
+	}
+
+	rc = bin_io_open();
+	if (rc == 0) {
+		rc = bin_io_session_set_converted(session->number);
+		(void)bin_io_close();
+	}
+	if (rc != 0) {
+		LOG_WRN("convert: could not mark flight %u converted (%d)",
+			session->number, rc);
+	}
+	return 0;
+#else
+	ARG_UNUSED(session);
+	ARG_UNUSED(outs);
+	ARG_UNUSED(n);
+	return -ENOTSUP;
+#endif
+}
+
+/* data_logger_live_session – see data_logger.h */
+int data_logger_live_session(struct data_logger_session *out)
+{
+#if defined(CONFIG_DATA_LOGGER_CONVERT_TRAIL)
+	size_t written;
+
+	if (out == NULL) {
+		return -EINVAL;
+	}
+	return bin_io_live(out, &written);
+#else
+	ARG_UNUSED(out);
+	return -ENOTSUP;
+#endif
+}
+
+/* data_logger_convert_trail_begin – see data_logger.h */
+int data_logger_convert_trail_begin(const struct data_logger_session *live,
+				    struct data_logger_convert_out *outs,
+				    size_t n)
+{
+#if defined(CONFIG_DATA_LOGGER_CONVERT_TRAIL)
+	if (live == NULL || !convert_outs_valid(outs, n)) {
+		return -EINVAL;
+	}
+	if (convert_trail.open) {
+		return -EBUSY;
+	}
+
+	convert_sinks_open(outs, n);
+	if (convert_live == 0) {
+		return convert_sinks_close(outs, n);
+	}
+
+	convert_trail.outs    = outs;
+	convert_trail.n       = n;
+	convert_trail.session = *live;
+	convert_trail.offset  = live->offset;
+	convert_trail.seq     = 0;
+	convert_trail.frames  = 0;
+	convert_trail.end     = false;
+	convert_trail.open    = true;
+	return 0;
+#else
+	ARG_UNUSED(live);
+	ARG_UNUSED(outs);
+	ARG_UNUSED(n);
+	return -ENOTSUP;
+#endif
+}
+
+/* data_logger_convert_trail_step – see data_logger.h */
+int data_logger_convert_trail_step(void)
+{
+#if defined(CONFIG_DATA_LOGGER_CONVERT_TRAIL)
+	struct data_logger_session live;
+	size_t written;
+
+	if (!convert_trail.open) {
+		return -EINVAL;
+	}
+	if (convert_live == 0) {
+		return convert_trail.outs[0].rc;
+	}
+	if (convert_trail.end) {
+		return (int)convert_trail.frames;
+	}
+
+	int rc = bin_io_live(&live, &written);
+
+	if (rc == -ENODEV || (rc == 0 &&
+			      live.flight_id != convert_trail.session.flight_id)) {
+		/* Closed since; data_logger_convert_trail_end() does the rest. */
+		return (int)convert_trail.frames;
+	}
+	if (rc != 0) {
+		return rc;
+	}
+
+	/* Everything below the writer's position is on storage for good. */
+	if (written <= (size_t)convert_trail.offset) {
+		return (int)convert_trail.frames;
+	}
+
+	rc = bin_io_open();
+	if (rc != 0) {
+		return rc;
+	}
+	convert_trail.end = convert_walk(&convert_trail.offset,
+					 &convert_trail.seq,
+					 &convert_trail.frames,
+					 convert_trail.session.flight_id,
+					 (uint32_t)((written -
+						     (size_t)convert_trail.offset) /
+						    BIN_FRAME_SIZE),
+					 bin_io_total_size());
+	(void)bin_io_close();
+
+	/* Make what was converted durable before reporting it. */
+	convert_sinks_flush();
+	return convert_live == 0 ? convert_trail.outs[0].rc
+				 : (int)convert_trail.frames;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+/* data_logger_convert_trail_end – see data_logger.h */
+int data_logger_convert_trail_end(void)
+{
+#if defined(CONFIG_DATA_LOGGER_CONVERT_TRAIL)
+	struct data_logger_session live;
+	size_t written;
+
+	if (!convert_trail.open) {
+		return -EINVAL;
+	}
+	if (bin_io_live(&live, &written) == 0 &&
+	    live.flight_id == convert_trail.session.flight_id) {
+		/* Still being written: the tail is not on storage yet. */
+		return -EBUSY;
+	}
+
+	int rc = bin_io_open();
+
+	if (rc != 0) {
+		convert_fail_all(rc);
+	} else {
+		const size_t total_size = bin_io_total_size();
+
+		if (convert_live > 0 && !convert_trail.end &&
+		    (size_t)convert_trail.offset < total_size) {
+			(void)convert_walk(&convert_trail.offset,
+					   &convert_trail.seq,
+					   &convert_trail.frames,
+					   convert_trail.session.flight_id,
+					   (uint32_t)((total_size -
+						       (size_t)convert_trail.offset) /
+						      BIN_FRAME_SIZE),
+					   total_size);
+		}
+		(void)convert_col_drain();
+		convert_sinks_flush();
+	}
+
+	rc = convert_sinks_close(convert_trail.outs, convert_trail.n);
+	convert_trail.open = false;
+
+#if defined(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+	if (rc == 0) {
+		int rc_mark = bin_io_session_set_converted(
+			convert_trail.session.number);
+
+		if (rc_mark != 0) {
+			LOG_WRN("convert: could not mark flight %u converted (%d)",
+				convert_trail.session.number, rc_mark);
+		}
+	}
+#endif
+	(void)bin_io_close();
+
+	return rc != 0 ? rc : (int)convert_trail.frames;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+/* data_logger_export – see data_logger.h */
+int data_logger_export(data_logger_export_cb_t cb, void *user_data)
+{
+	off_t start_offset;
+	uint32_t expect_seq;
+	uint64_t flight_id;
+	uint32_t frame_limit;
+	int frames = 0;
+
+	if (cb == NULL) {
+		return -EINVAL;
+	}
+
+	int rc = bin_io_open();
+
+	if (rc != 0) {
+		return rc;
+	}
+
+	const size_t total_size = bin_io_total_size();
+
+	rc = convert_locate(NULL, total_size, &start_offset, &expect_seq,
+			    &flight_id, &frame_limit);
+	if (rc == -ENOENT) {
+		rc = 0;
+		goto out;
+	}
+	if (rc != 0) {
+		goto out;
+	}
+
+	off_t cur_offset = start_offset;
+
+	convert_fetch_begin(start_offset, frame_limit, total_size);
+
+	while ((uint32_t)frames < frame_limit) {
+		rc = convert_fetch_next(cur_offset);
+		if (rc != 0) {
+			break;
+		}
+
+		const struct aurora_bin_frame_header *fh =
+			(const struct aurora_bin_frame_header *)convert_frame;
+
+		if (!convert_frame_follows(fh, flight_id, expect_seq)) {
+			break;
+		}
+
+		rc = cb(convert_frame, BIN_FRAME_SIZE, user_data);
+		if (rc != 0) {
+			break;
+		}
+
+		expect_seq++;
+		frames++;
+		cur_offset += (off_t)BIN_FRAME_SIZE;
+		if ((size_t)cur_offset >= total_size) {
+			cur_offset = 0;
+		}
+	}
+
+	convert_fetch_end();
+
+out:
+	(void)bin_io_close();
+	return rc != 0 ? rc : frames;
+}
+
+#if defined(CONFIG_DATA_LOGGER_DUMP)
+
+#define DUMP_BATCH ((size_t)CONFIG_DATA_LOGGER_DUMP_BATCH_FRAMES)
+
+/* Frames of one dump batch; only touched by data_logger_dump(). */
+static uint8_t dump_buf[DUMP_BATCH * BIN_FRAME_SIZE]
+	__aligned(CONFIG_DATA_LOGGER_BIN_BUF_ALIGN);
+
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+/* Frames of @p flight_id from @p seq on that the index proves start
+ * before @p from_ns, 0 without a usable entry.
+ */
+static uint32_t dump_index_skip(size_t total_size, uint64_t flight_id,
+				uint32_t seq, uint64_t from_ns)
+{
+	const struct aurora_bin_index_header *hdr;
+	const struct aurora_bin_index_entry *entries;
+	const struct aurora_bin_index_entry *e;
+	struct aurora_bin_frame_header fh;
+
+	if (index_load(total_size, &hdr, &entries) != 0 ||
+	    hdr->flight_id != flight_id) {
+		return 0;
+	}
+
+	/* The newest entry at or before from_ns may itself be in range. */
+	e = index_find_time(entries, hdr->count, from_ns);
+	if (e == NULL || e->seq <= seq ||
+	    index_check(e, flight_id, total_size, &fh) != 0) {
+		return 0;
+	}
+	return e->seq - seq;
+}
+#endif /* CONFIG_DATA_LOGGER_BIN_INDEX */
+
+#endif /* CONFIG_DATA_LOGGER_DUMP */
+
+/* data_logger_dump – see data_logger.h */
+int data_logger_dump(const struct data_logger_dump_range *range,
+		     data_logger_export_cb_t cb, void *user_data)
+{
+#if defined(CONFIG_DATA_LOGGER_DUMP)
+	off_t off;
+	uint32_t seq;
+	uint64_t flight_id;
+	uint32_t frame_limit;
+	uint32_t skip = 0;
+	int frames = 0;
+
+	if (range == NULL || cb == NULL ||
+	    range->last_seq < range->first_seq ||
+	    range->to_ns < range->from_ns) {
+		return -EINVAL;
+	}
+
+	int rc = bin_io_open();
+
+	if (rc != 0) {
+		return rc;
+	}
+
+	const size_t total_size = bin_io_total_size();
+
+	rc = convert_locate(NULL, total_size, &off, &seq, &flight_id,
+			    &frame_limit);
+	if (rc == -ENOENT) {
+		rc = 0;
+		goto out;
+	}
+	if (rc != 0) {
+		goto out;
+	}
+
+	/* Frames before the range are stepped over without reading them:
+	 * seq maps to slots one to one from the window start.
+	 */
+	if (range->first_seq > seq) {
+		skip = range->first_seq - seq;
+	}
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+	if (range->from_ns > 0U) {
+		skip = MAX(skip, dump_index_skip(total_size, flight_id, seq,
+						 range->from_ns));
+	}
+#endif
+	if (skip >= frame_limit) {
+		goto out;
+	}
+
+	const uint32_t ring_frames = (uint32_t)(total_size / BIN_FRAME_SIZE);
+
+	off = (off_t)(((uint32_t)(off / (off_t)BIN_FRAME_SIZE) + skip) %
+		      ring_frames) * (off_t)BIN_FRAME_SIZE;
+	seq += skip;
+	frame_limit -= skip;
+
+	while (frame_limit > 0U) {
+		/* One read per batch, never across the region end. */
+		const size_t n = MIN(MIN((size_t)frame_limit, DUMP_BATCH),
+				     (total_size - (size_t)off) / BIN_FRAME_SIZE);
+		size_t first = 0;
+		size_t i;
+
+		rc = bin_io_read(off, dump_buf, n * BIN_FRAME_SIZE);
+		if (rc != 0) {
+			LOG_ERR("dump: bin_io_read at %ld failed (%d)",
+				(long)off, rc);
+			break;
+		}
+
+		for (i = 0; i < n; i++) {
+			const struct aurora_bin_frame_header *fh =
+				(const struct aurora_bin_frame_header *)
+				&dump_buf[i * BIN_FRAME_SIZE];
+
+			if (!convert_frame_follows(fh, flight_id, seq) ||
+			    fh->seq > range->last_seq ||
+			    fh->base_ts_ns > range->to_ns) {
+				break;
+			}
+			/* Timestamps grow with seq: only a leading run of
+			 * the batch can be too early.
+			 */
+			if (fh->base_ts_ns < range->from_ns) {
+				first = i + 1U;
+			}
+			seq++;
+		}
+
+		if (i > first) {
+			rc = cb(&dump_buf[first * BIN_FRAME_SIZE],
+				(i - first) * BIN_FRAME_SIZE, user_data);
+			if (rc != 0) {
+				break;
+			}
+			frames += (int)(i - first);
+		}
+		if (i < n) {
+			break;
+		}
+
+		frame_limit -= (uint32_t)n;
+		off += (off_t)(n * BIN_FRAME_SIZE);
+		if ((size_t)off >= total_size) {
+			off = 0;
+		}
+	}
+
+out:
+	(void)bin_io_close();
+	return rc != 0 ? rc : frames;
+#else
+	ARG_UNUSED(range);
+	ARG_UNUSED(cb);
+	ARG_UNUSED(user_data);
+	return -ENOTSUP;
+#endif /* CONFIG_DATA_LOGGER_DUMP */
+}
+
+/* data_logger_convert – see data_logger.h */
+int data_logger_convert(const struct data_logger_formatter *out_fmt,
+			const char *out_path)
+{
+	struct data_logger_convert_out out = {
+		.fmt  = out_fmt,
+		.path = out_path,
+	};
+
+	return data_logger_convert_multi(&out, 1);
+}
@@ -0,0 +1,152 @@
+/**
+ * @file data_export.c
+ * @brief Raw flight-log export over a dedicated UART / USB CDC ACM port.
+ *
+ * Streams the newest flight's frames exactly as they sit on storage,
+ * framed by an aurora_bin_export_header and _trailer (data_logger.h), so
+ * getting a flight off the board skips the on-board text conversion and
+ * the SD card never has to leave the vehicle.  tools/aurora_export.py
+ * receives the stream and decodes it on the host.
+ *
+ * Transmission is interrupt driven: the ISR feeds the UART FIFO straight
+ * from the converter's frame buffer, and with converter prefetch the
+ * next frame is read from storage while the current one is on the wire.
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/crc.h>
+
+#include <aurora/lib/data_logger.h>
+
+LOG_MODULE_DECLARE(data_logger, CONFIG_DATA_LOGGER_LOG_LEVEL);
+
+static const struct device *const export_dev =
+	DEVICE_DT_GET(DT_CHOSEN(auxspace_data_export));
+
+/* Buffer the ISR is draining; only touched by the ISR while tx is on. */
+static const uint8_t *export_buf;
+static size_t export_left;
+static K_SEM_DEFINE(export_done, 0, 1);
+
+struct export_state {
+	uint32_t crc;
+	uint32_t frames;
+};
+
+static void export_isr(const struct device *dev, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	if (!uart_irq_update(dev) || !uart_irq_tx_ready(dev)) {
+		return;
+	}
+
+	if (export_left == 0U) {
+		uart_irq_tx_disable(dev);
+		k_sem_give(&export_done);
+		return;
+	}
+
+	int n = uart_fifo_fill(dev, export_buf, export_left);
+
+	if (n > 0) {
+		export_buf  += n;
+		export_left -= (size_t)n;
+	}
+}
+
+/* Send @p len bytes and wait until the FIFO has taken all of them. */
+static int export_send(const void *buf, size_t len)
+{
+	export_buf  = buf;
+	export_left = len;
+	k_sem_reset(&export_done);
+	uart_irq_tx_enable(export_dev);
+
+	if (k_sem_take(&export_done,
+		       K_MSEC(CONFIG_DATA_LOGGER_EXPORT_TIMEOUT_MS)) != 0) {
+		uart_irq_tx_disable(export_dev);
+		export_left = 0;
+		return -ETIMEDOUT;
+	}
+	return 0;
+}
+
+static int export_frame(const void *frame, size_t len, void *user_data)
+{
+	struct export_state *st = user_data;
+	int rc = export_send(frame, len);
+
+	if (rc != 0) {
+		return rc;
+	}
+	st->crc = crc32_ieee_update(st->crc, frame, len);
+	st->frames++;
+	return 0;
+}
+
+/* data_logger_export_uart – see data_logger.h */
+int data_logger_export_uart(void)
+{
+	static const struct aurora_bin_export_header hdr = {
+		.magic      = AURORA_BIN_EXPORT_MAGIC,
+		.version    = AURORA_BIN_EXPORT_VERSION,
+		.frame_size = CONFIG_DATA_LOGGER_BIN_FRAME_SIZE,
+	};
+	struct aurora_bin_export_trailer tail = {
+		.magic = AURORA_BIN_EXPORT_END_MAGIC,
+	};
+	struct export_state st = { .crc = 0, .frames = 0 };
+	int rc;
+
+	if (!device_is_ready(export_dev)) {
+		LOG_ERR("export: %s not ready", export_dev->name);
+		return -ENODEV;
+	}
+
+	rc = uart_irq_callback_user_data_set(export_dev, export_isr, NULL);
+	if (rc != 0) {
+		return rc;
+	}
+
+	rc = export_send(&hdr, sizeof(hdr));
+	if (rc == 0) {
+		rc = data_logger_export(export_frame, &st);
+	}
+	if (rc == -ETIMEDOUT) {
+		LOG_ERR("export: host stopped reading after %u frames",
+			st.frames);
+		return rc;
+	}
+	if (rc < 0) {
+		/* The trailer still goes out so the host sees where the
+		 * stream stopped; its CRC covers the frames that were sent.
+		 */
+		LOG_ERR("export: stopped after %u frames (%d)", st.frames, rc);
+	}
+
+	tail.frames = st.frames;
+	tail.crc32  = st.crc;
+
+	int rc_tail = export_send(&tail, sizeof(tail));
+
+	if (rc < 0) {
+		return rc;
+	}
+	if (rc_tail != 0) {
+		return rc_tail;
+	}
+
+	LOG_INF("export: sent %u frames", st.frames);
+	return (int)st.frames;
+}
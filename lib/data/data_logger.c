@@ -3,8 +3,10 @@
  * @brief Core data-logger logic and sensor-group name table.
  *
  * Implements data_logger_init / data_logger_write / data_logger_flush /
- * data_logger_close by dispatching through the formatter vtable, and
- * provides data_logger_type_name() for formatter backends.
+ * data_logger_close by dispatching through the formatter vtable (or
+ * straight to the binary backend's write path with
+ * CONFIG_DATA_LOGGER_BIN_STATIC_DISPATCH), and provides
+ * data_logger_type_name() for formatter backends.
  *
  * Copyright (c) 2026 Auxspace e.V.
  *
@@ -20,6 +22,15 @@
 #include <zephyr/fs/fs.h>
 
 #include <aurora/lib/data_logger.h>
+#include <aurora/lib/ram.h>
+
+#if defined(CONFIG_AURORA_TELEMETRY_SAMPLES)
+#include <aurora/lib/telemetry.h>
+#endif /* CONFIG_AURORA_TELEMETRY_SAMPLES */
+
+#if defined(CONFIG_DATA_LOGGER_BIN_STATIC_DISPATCH)
+#include "bin_live.h"
+#endif /* CONFIG_DATA_LOGGER_BIN_STATIC_DISPATCH */
 
 LOG_MODULE_REGISTER(data_logger, CONFIG_DATA_LOGGER_LOG_LEVEL);
 
@@ -83,6 +94,9 @@ static const char *const aurora_data_names[AURORA_DATA_COUNT] = {
 	[AURORA_DATA_SM_POSE]       = "sm_pose",
 	[AURORA_DATA_ORIENTATION]   = "orientation",
 	[AURORA_DATA_VBAT]          = "vbat",
+	[AURORA_DATA_SM_AUDIT]      = "sm_audit",
+	[AURORA_DATA_PYRO_FIRE]     = "pyro_fire",
+	[AURORA_DATA_THREAD_HEALTH] = "thread_health",
 };
 
 /* data_logger_type_name – see data_logger.h */
@@ -98,6 +112,246 @@ const char *data_logger_type_name(enum aurora_data type)
 /*  Public API                                                                */
 /* -------------------------------------------------------------------------- */
 
+/* -------------------------------------------------------------------------- */
+/*  Phase-aware decimation                                                    */
+/* -------------------------------------------------------------------------- */
+
+#if defined(CONFIG_DATA_LOGGER_DECIMATION)
+
+#define SV_MICRO 1000000LL
+
+/* Recompute the fast-path flag for the current phase and drop any
+ * half-filled windows, which belong to the previous policy.
+ */
+static void decimation_update(struct data_logger_state *st)
+{
+	st->decimating = false;
+	for (int t = 0; t < AURORA_DATA_COUNT; t++) {
+		if (st->policy[st->phase][t].factor > 1U) {
+			st->decimating = true;
+		}
+	}
+	memset(st->window, 0, sizeof(st->window));
+}
+
+static void decimation_init(struct data_logger_state *st)
+{
+	static const uint16_t imu_factor[DLP_COUNT] = {
+		[DLP_PAD]     = CONFIG_DATA_LOGGER_DECIMATE_PAD_IMU,
+		[DLP_ASCENT]  = 1,
+		[DLP_DESCENT] = CONFIG_DATA_LOGGER_DECIMATE_DESCENT_IMU,
+		[DLP_LANDED]  = CONFIG_DATA_LOGGER_DECIMATE_LANDED_IMU,
+	};
+
+	for (int p = 0; p < DLP_COUNT; p++) {
+		for (int t = 0; t < AURORA_DATA_COUNT; t++) {
+			struct data_logger_decimation *d = &st->policy[p][t];
+
+			switch (t) {
+			case AURORA_DATA_IMU_ACCEL:
+			case AURORA_DATA_IMU_GYRO:
+			case AURORA_DATA_IMU_MAG:
+				d->factor = imu_factor[p];
+				break;
+			case AURORA_DATA_BARO:
+				d->factor = p == DLP_DESCENT
+					? CONFIG_DATA_LOGGER_DECIMATE_DESCENT_BARO : 1;
+				break;
+			default:
+				d->factor = 1;
+				break;
+			}
+			d->average = IS_ENABLED(CONFIG_DATA_LOGGER_DECIMATE_AVERAGE);
+		}
+	}
+
+	st->phase = DLP_PAD;
+	decimation_update(st);
+}
+
+/* Run one sample of @p type through the current phase's policy.  Returns
+ * true when a sample is due; @p ch then holds the window mean if the
+ * policy averages.  Called under the logger mutex.
+ */
+static bool decimate(struct data_logger_state *st, unsigned int type,
+		     struct sensor_value *ch, uint8_t count)
+{
+	if (type >= AURORA_DATA_COUNT) {
+		return true;	/* the formatter rejects it */
+	}
+
+	const struct data_logger_decimation *d = &st->policy[st->phase][type];
+	struct data_logger_window *w = &st->window[type];
+
+	if (d->factor <= 1U) {
+		return true;
+	}
+
+	count = MIN(count, DP_MAX_CHANNELS);
+	if (d->average) {
+		for (uint8_t i = 0; i < count; i++) {
+			w->sum[i] += (int64_t)ch[i].val1 * SV_MICRO + ch[i].val2;
+		}
+	}
+
+	if (++w->n < d->factor) {
+		return false;
+	}
+
+	if (d->average) {
+		for (uint8_t i = 0; i < count; i++) {
+			int64_t mean = w->sum[i] / w->n;
+
+			ch[i].val1 = (int32_t)(mean / SV_MICRO);
+			ch[i].val2 = (int32_t)(mean % SV_MICRO);
+		}
+	}
+
+	memset(w, 0, sizeof(*w));
+	return true;
+}
+
+static void decimation_event(struct data_logger_state *st,
+			     enum data_logger_event ev)
+{
+	enum data_logger_phase next;
+
+	switch (ev) {
+	case DLE_BOOST:
+		next = DLP_ASCENT;
+		break;
+	case DLE_APOGEE:
+		next = DLP_DESCENT;
+		break;
+	case DLE_LANDED:
+		next = DLP_LANDED;
+		break;
+	default:
+		return;
+	}
+
+	if (next != st->phase) {
+		st->phase = next;
+		decimation_update(st);
+	}
+}
+
+/* data_logger_set_decimation – see data_logger.h */
+int data_logger_set_decimation(struct data_logger *logger,
+			       enum data_logger_phase phase,
+			       enum aurora_data type,
+			       const struct data_logger_decimation *d)
+{
+	int rc;
+
+	if (logger == NULL || logger->state == NULL || d == NULL ||
+	    (unsigned int)phase >= DLP_COUNT ||
+	    (unsigned int)type >= AURORA_DATA_COUNT)
+		return -EINVAL;
+
+	rc = k_mutex_lock(&logger->state->mutex, K_MSEC(100));
+	if (rc != 0)
+		return rc;
+
+	logger->state->policy[phase][type] = *d;
+	if (phase == logger->state->phase)
+		decimation_update(logger->state);
+
+	k_mutex_unlock(&logger->state->mutex);
+	return 0;
+}
+
+static inline bool decimating(const struct data_logger_state *st)
+{
+	return st->decimating;
+}
+#else
+static inline bool decimating(const struct data_logger_state *st)
+{
+	ARG_UNUSED(st);
+	return false;
+}
+#endif /* CONFIG_DATA_LOGGER_DECIMATION */
+
+/* -------------------------------------------------------------------------- */
+/*  Formatter dispatch                                                        */
+/* -------------------------------------------------------------------------- */
+
+/* The flight log's formatter is fixed at build time, so its write path
+ * is called directly; every other formatter goes through the vtable.
+ */
+#if defined(CONFIG_DATA_LOGGER_BIN_STATIC_DISPATCH)
+static inline bool fmt_is_bin(const struct data_logger *logger)
+{
+	return logger->fmt == &data_logger_bin_formatter;
+}
+#else
+static inline bool fmt_is_bin(const struct data_logger *logger)
+{
+	ARG_UNUSED(logger);
+	return false;
+}
+#endif /* CONFIG_DATA_LOGGER_BIN_STATIC_DISPATCH */
+
+static inline int fmt_write(struct data_logger *logger,
+			    const struct datapoint *dp)
+{
+#if defined(CONFIG_DATA_LOGGER_BIN_STATIC_DISPATCH)
+	if (fmt_is_bin(logger)) {
+		return bin_live_write(logger, dp);
+	}
+#endif /* CONFIG_DATA_LOGGER_BIN_STATIC_DISPATCH */
+	return logger->fmt->write_datapoint(logger, dp);
+}
+
+static inline bool fmt_has_batch(const struct data_logger *logger)
+{
+	return fmt_is_bin(logger) || logger->fmt->write_datapoints != NULL;
+}
+
+static inline int fmt_write_batch(struct data_logger *logger,
+				  const struct datapoint *dps, size_t n)
+{
+#if defined(CONFIG_DATA_LOGGER_BIN_STATIC_DISPATCH)
+	if (fmt_is_bin(logger)) {
+		return bin_live_write_batch(logger, dps, n);
+	}
+#endif /* CONFIG_DATA_LOGGER_BIN_STATIC_DISPATCH */
+	return logger->fmt->write_datapoints(logger, dps, n);
+}
+
+#if defined(CONFIG_DATA_LOGGER_BIN_STATIC_DISPATCH) && \
+	defined(CONFIG_DATA_LOGGER_BIN_ZERO_COPY)
+#define FMT_RESERVE(logger, ts, rec)					\
+	(fmt_is_bin(logger) ? bin_live_reserve(logger, ts, rec) :	\
+			      (logger)->fmt->reserve(logger, ts, rec))
+#define FMT_COMMIT(logger, rec)						\
+	(fmt_is_bin(logger) ? bin_live_commit(logger, rec) :		\
+			      (logger)->fmt->commit(logger, rec))
+#else
+#define FMT_RESERVE(logger, ts, rec) ((logger)->fmt->reserve(logger, ts, rec))
+#define FMT_COMMIT(logger, rec)      ((logger)->fmt->commit(logger, rec))
+#endif
+
+/* Hand one datapoint to the formatter through the decimation policy.
+ * Called under the logger mutex.
+ */
+static int write_locked(struct data_logger *logger, const struct datapoint *dp)
+{
+#if defined(CONFIG_DATA_LOGGER_DECIMATION)
+	if (decimating(logger->state)) {
+		struct datapoint tmp = *dp;
+
+		if (!decimate(logger->state, (unsigned int)tmp.type,
+			      tmp.channels, tmp.channel_count)) {
+			return 0;
+		}
+		return fmt_write(logger, &tmp);
+	}
+#endif
+	return fmt_write(logger, dp);
+}
+
 /* data_logger_init – see data_logger.h */
 int data_logger_init(struct data_logger *logger, const char *filename,
 		     const struct data_logger_formatter *fmt)
@@ -119,6 +373,9 @@ int data_logger_init(struct data_logger *logger, const char *filename,
 		LOG_ERR("failed to allocate logger state");
 		return -ENOMEM;
 	}
+#if defined(CONFIG_DATA_LOGGER_DECIMATION)
+	decimation_init(state);
+#endif
 
 	/* Build "<base_path>/<filename>_i.<file_ext>" */
 	for (int i = 0; i <= CONFIG_DATA_LOGGER_MAX_FILES; i++) {
@@ -226,6 +483,12 @@ int data_logger_log(const struct datapoint *dp)
 	return data_logger_write(default_logger, dp);
 }
 
+/* data_logger_log_batch – see data_logger.h */
+int data_logger_log_batch(const struct datapoint *dps, size_t n)
+{
+	return data_logger_write_batch(default_logger, dps, n);
+}
+
 /* data_logger_write – see data_logger.h */
 int data_logger_write(struct data_logger *logger, const struct datapoint *dp)
 {
@@ -247,7 +510,115 @@ int data_logger_write(struct data_logger *logger, const struct datapoint *dp)
 		return 0;
 	}
 
-	rc = logger->fmt->write_datapoint(logger, dp);
+	rc = write_locked(logger, dp);
+	k_mutex_unlock(&logger->state->mutex);
+	return rc;
+}
+
+/* data_logger_write_batch – see data_logger.h */
+int data_logger_write_batch(struct data_logger *logger,
+			    const struct datapoint *dps, size_t n)
+{
+	int rc;
+
+	if (logger == NULL || dps == NULL || logger->fmt == NULL ||
+		logger->state == NULL)
+		return -EINVAL;
+
+	if (n == 0 || atomic_get(&logger->state->running) == 0)
+		return 0;
+
+	rc = k_mutex_lock(&logger->state->mutex, K_MSEC(100));
+	if (rc != 0)
+		return rc;
+
+	if (atomic_get(&logger->state->running) == 0) {
+		k_mutex_unlock(&logger->state->mutex);
+		return 0;
+	}
+
+	/* A decimating phase runs below the sample rate anyway; only the
+	 * full-rate phases need the bulk hook.
+	 */
+	if (fmt_has_batch(logger) && !decimating(logger->state)) {
+		rc = fmt_write_batch(logger, dps, n);
+	} else {
+		for (size_t i = 0; i < n && rc == 0; i++)
+			rc = write_locked(logger, &dps[i]);
+	}
+
+	k_mutex_unlock(&logger->state->mutex);
+	return rc;
+}
+
+/* data_logger_reserve – see data_logger.h */
+int data_logger_reserve(struct data_logger *logger, uint64_t timestamp_ns,
+			struct aurora_bin_record **rec)
+{
+	int rc;
+
+	if (logger == NULL || rec == NULL || logger->fmt == NULL ||
+		logger->state == NULL)
+		return -EINVAL;
+
+	if (logger->fmt->reserve == NULL || logger->fmt->commit == NULL)
+		return -ENOTSUP;
+
+	if (atomic_get(&logger->state->running) == 0)
+		return -EAGAIN;
+
+	/* Hot-path callers must never wait behind a flush. */
+	if (k_mutex_lock(&logger->state->mutex, K_NO_WAIT) != 0)
+		return -EAGAIN;
+
+	if (atomic_get(&logger->state->running) == 0) {
+		k_mutex_unlock(&logger->state->mutex);
+		return -EAGAIN;
+	}
+
+	rc = FMT_RESERVE(logger, timestamp_ns, rec);
+	if (rc != 0)
+		k_mutex_unlock(&logger->state->mutex);
+
+	return rc;
+}
+
+/* data_logger_commit – see data_logger.h */
+int data_logger_commit(struct data_logger *logger,
+		       struct aurora_bin_record *rec)
+{
+	int rc;
+
+	if (logger == NULL || rec == NULL || logger->fmt == NULL ||
+		logger->state == NULL)
+		return -EINVAL;
+
+#if defined(CONFIG_DATA_LOGGER_DECIMATION)
+	if (decimating(logger->state) && rec->type < AURORA_DATA_COUNT) {
+		struct sensor_value ch[DP_MAX_CHANNELS];
+		uint8_t count = MIN(rec->channel_count, DP_MAX_CHANNELS);
+
+		for (uint8_t i = 0; i < count; i++) {
+			ch[i].val1 = rec->channels[i].val1;
+			ch[i].val2 = rec->channels[i].val2;
+		}
+
+		if (!decimate(logger->state, rec->type, ch, count)) {
+			/* An invalid type makes the formatter discard the slot. */
+			rec->type = 0xFF;
+			(void)FMT_COMMIT(logger, rec);
+			k_mutex_unlock(&logger->state->mutex);
+			return 0;
+		}
+
+		for (uint8_t i = 0; i < count; i++) {
+			rec->channels[i].val1 = ch[i].val1;
+			rec->channels[i].val2 = ch[i].val2;
+		}
+	}
+#endif
+
+	rc = FMT_COMMIT(logger, rec);
 	k_mutex_unlock(&logger->state->mutex);
 	return rc;
 }
@@ -312,6 +683,8 @@ int data_logger_stop(struct data_logger *logger)
 	if (logger == NULL || logger->fmt == NULL || logger->state == NULL)
 		return -EINVAL;
 
+	/* Also keeps a power-fail recovery from resuming it. */
+	atomic_set(&logger->state->pf_paused, 0);
 	atomic_set(&logger->state->running, 0);
 
 	rc = k_mutex_lock(&logger->state->mutex, K_MSEC(100));
@@ -371,7 +744,8 @@ int data_logger_event(struct data_logger *logger, enum data_logger_event ev)
 		return -EINVAL;
 	}
 
-	if (logger->fmt->on_event == NULL) {
+	if (logger->fmt->on_event == NULL &&
+	    !IS_ENABLED(CONFIG_DATA_LOGGER_DECIMATION)) {
 		return 0;
 	}
 
@@ -381,11 +755,45 @@ int data_logger_event(struct data_logger *logger, enum data_logger_event ev)
 		return rc;
 	}
 
-	rc = logger->fmt->on_event(logger, ev);
+#if defined(CONFIG_DATA_LOGGER_DECIMATION)
+	decimation_event(logger->state, ev);
+#endif
+	rc = logger->fmt->on_event != NULL ? logger->fmt->on_event(logger, ev) : 0;
 	k_mutex_unlock(&logger->state->mutex);
 	return rc;
 }
 
+/* data_logger_powerfail – see data_logger.h
+ *
+ * Runs in the power-fail ISR, so no mutex: clearing running keeps every
+ * producer out after its current call, and the formatter's writer picks
+ * up the live frame once that call has released the mutex.  Only loggers
+ * that were running are paused, and only those are resumed, so a supply
+ * dip never restarts a logger the application stopped.
+ */
+void data_logger_powerfail(bool asserted)
+{
+	for (int i = 0; i < CONFIG_DATA_LOGGER_MAX_LOGGERS; i++) {
+		struct data_logger *logger = registry[i];
+
+		if (logger == NULL || logger->state == NULL) {
+			continue;
+		}
+
+		if (asserted) {
+			if (atomic_cas(&logger->state->running, 1, 0)) {
+				atomic_set(&logger->state->pf_paused, 1);
+			}
+		} else if (atomic_cas(&logger->state->pf_paused, 1, 0)) {
+			atomic_set(&logger->state->running, 1);
+		}
+		if (logger->fmt != NULL && logger->fmt->powerfail != NULL &&
+		    logger->ctx != NULL) {
+			(void)logger->fmt->powerfail(logger, asserted);
+		}
+	}
+}
+
 /* convert_idle has one token whenever no conversion is in flight. The
  * converter thread holds it while running; SM→ARMED tries to acquire it
  * (with a short timeout) to verify the last flight has been fully
@@ -394,7 +802,8 @@ int data_logger_event(struct data_logger *logger, enum data_logger_event ev)
 K_SEM_DEFINE(convert_idle, 1, 1);
 
 /* Woken by SM→(IDLE|LANDED|ERROR) to kick off conversion of the just-
- * closed binary file.
+ * closed binary file.  With CONFIG_DATA_LOGGER_CONVERT_TRAIL also by
+ * SM→APOGEE, to start converting the still open one.
  */
 K_SEM_DEFINE(convert_request, 0, 1);
 
@@ -409,6 +818,8 @@ void pick_convert_out_base(char *out, size_t out_sz)
 	const char *probe_ext = data_logger_csv_formatter.file_ext;
 #elif defined(CONFIG_DATA_LOGGER_CONVERT_INFLUX)
 	const char *probe_ext = data_logger_influx_formatter.file_ext;
+#elif defined(CONFIG_DATA_LOGGER_CONVERT_AUDIT)
+	const char *probe_ext = data_logger_audit_formatter.file_ext;
 #else
 	const char *probe_ext = "out";
 #endif
@@ -431,65 +842,377 @@ void pick_convert_out_base(char *out, size_t out_sz)
 	(void)snprintf(out, out_sz, "%s/FLIGHT_0", CONFIG_DATA_LOGGER_BASE_PATH);
 }
 
+#if defined(CONFIG_DATA_LOGGER_CONVERT_CSV) || defined(CONFIG_DATA_LOGGER_CONVERT_INFLUX) || \
+	defined(CONFIG_DATA_LOGGER_CONVERT_AUDIT)
+static const struct data_logger_formatter *const convert_fmts[] = {
+#if defined(CONFIG_DATA_LOGGER_CONVERT_CSV)
+	&data_logger_csv_formatter,
+#endif
+#if defined(CONFIG_DATA_LOGGER_CONVERT_INFLUX)
+	&data_logger_influx_formatter,
+#endif
+#if defined(CONFIG_DATA_LOGGER_CONVERT_AUDIT)
+	&data_logger_audit_formatter,
+#endif
+};
+
+#define CONVERT_NFMTS ARRAY_SIZE(convert_fmts)
+
+/* Point outs[i] at "<base>.<file_ext>" of every enabled text format. */
+static void convert_outs_init(const char *base,
+			      char paths[][DATA_LOGGER_PATH_MAX],
+			      struct data_logger_convert_out *outs)
+{
+	for (size_t i = 0; i < CONVERT_NFMTS; i++) {
+		(void)snprintf(paths[i], DATA_LOGGER_PATH_MAX, "%s.%s", base, convert_fmts[i]->file_ext);
+		outs[i].fmt  = convert_fmts[i];
+		outs[i].path = paths[i];
+		outs[i].rc   = 0;
+	}
+}
+
+static void convert_outs_report(const struct data_logger_convert_out *outs)
+{
+	for (size_t i = 0; i < CONVERT_NFMTS; i++) {
+		if (outs[i].rc != 0) {
+			LOG_ERR("%s conversion => %s failed (%d)", outs[i].fmt->name, outs[i].path, outs[i].rc);
+		} else {
+			LOG_INF("converted flight_log => %s", outs[i].path);
+		}
+	}
+}
+
+#if defined(CONFIG_DATA_LOGGER_CONVERT_TRAIL)
+/* "<base>.cur" holds how many frames of the flight the outputs under
+ * <base> hold so far; it only exists while a trailing conversion is
+ * incomplete.
+ */
+static void convert_cursor_path(char *out, const char *base)
+{
+	(void)snprintf(out, DATA_LOGGER_PATH_MAX, "%s.cur", base);
+}
+
+static void convert_cursor_save(const char *base, uint64_t flight_id, int frames)
+{
+	char path[DATA_LOGGER_PATH_MAX];
+	char line[48];
+	struct fs_file_t f;
+	int n = snprintf(line, sizeof(line), "%llu %d\n", (unsigned long long)flight_id, frames);
+
+	convert_cursor_path(path, base);
+	fs_file_t_init(&f);
+	if (fs_open(&f, path, FS_O_CREATE | FS_O_WRITE | FS_O_TRUNC) != 0) {
+		return;
+	}
+	if (fs_write(&f, line, (size_t)n) == n) {
+		(void)fs_sync(&f);
+	}
+	(void)fs_close(&f);
+}
+
+static void convert_cursor_drop(const char *base)
+{
+	char path[DATA_LOGGER_PATH_MAX];
+
+	convert_cursor_path(path, base);
+	(void)fs_unlink(path);
+}
+
+/* Follow the open flight log with a trailing conversion into "<base>.*"
+ * until log_end_flight() requests the conversion proper, then finish it.
+ * Only returns once the flight is closed: 0 if it is converted,
+ * otherwise the caller converts it again in full into the same @p base
+ * (empty if the trail never got going).
+ */
+static int convert_trail_run(char *base, size_t base_sz)
+{
+	char paths[CONVERT_NFMTS][DATA_LOGGER_PATH_MAX];
+	struct data_logger_convert_out outs[CONVERT_NFMTS];
+	struct data_logger_session live;
+	int prio;
+	int rc;
+
+	base[0] = '\0';
+	rc = data_logger_live_session(&live);
+	if (rc != 0) {
+		goto out_wait;
+	}
+
+#if defined(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+	(void)snprintf(base, base_sz, "%s/FLIGHT_%u", CONFIG_DATA_LOGGER_BASE_PATH, live.number);
+#else
+	pick_convert_out_base(base, base_sz);
+#endif /* CONFIG_DATA_LOGGER_DISK_SESSIONS */
+	convert_outs_init(base, paths, outs);
+
+	rc = data_logger_convert_trail_begin(&live, outs, CONVERT_NFMTS);
+	if (rc != 0) {
+		LOG_ERR("convert: cannot trail the flight log (%d)", rc);
+		goto out_wait;
+	}
+
+	prio = k_thread_priority_get(k_current_get());
+	LOG_INF("convert: trailing flight log => %s", base);
+	k_thread_priority_set(k_current_get(), CONFIG_DATA_LOGGER_CONVERT_TRAIL_PRIO);
+	while (k_sem_take(&convert_request, K_MSEC(CONFIG_DATA_LOGGER_CONVERT_TRAIL_PERIOD_MS)) != 0) {
+		int frames = data_logger_convert_trail_step();
+
+		if (frames > 0) {
+			convert_cursor_save(base, live.flight_id, frames);
+		}
+	}
+	k_thread_priority_set(k_current_get(), prio);
+
+	rc = data_logger_convert_trail_end();
+	convert_outs_report(outs);
+	if (rc < 0) {
+		return rc;
+	}
+	convert_cursor_drop(base);
+	return 0;
+
+out_wait:
+	/* Every flight that was live here ends with this request. */
+	(void)k_sem_take(&convert_request, K_FOREVER);
+	return rc;
+}
+#endif /* CONFIG_DATA_LOGGER_CONVERT_TRAIL */
+
+/* Convert @p session (or the newest flight if NULL) to every enabled
+ * text format under "<base>.<file_ext>".  One read pass over the binary
+ * log feeds every target.
+ */
+static void convert_to_base(const char *base,
+			    const struct data_logger_session *session)
+{
+	char paths[CONVERT_NFMTS][DATA_LOGGER_PATH_MAX];
+	struct data_logger_convert_out outs[CONVERT_NFMTS];
+	int rc;
+
+	convert_outs_init(base, paths, outs);
+
+	if (session != NULL) {
+		rc = data_logger_convert_session(session, outs, CONVERT_NFMTS);
+	} else {
+		rc = data_logger_convert_multi(outs, CONVERT_NFMTS);
+	}
+
+	convert_outs_report(outs);
+#if defined(CONFIG_DATA_LOGGER_CONVERT_TRAIL)
+	if (rc == 0) {
+		/* Left behind by a trail that a reset cut short. */
+		convert_cursor_drop(base);
+	}
+#else
+	ARG_UNUSED(rc);
+#endif
+}
+#endif /* CONFIG_DATA_LOGGER_CONVERT_CSV || _INFLUX || _AUDIT */
+
 void converter_task(void *, void *, void *)
 {
 	while (1) {
 		k_sem_take(&convert_request, K_FOREVER);
 		k_sem_take(&convert_idle, K_FOREVER);
+#if defined(CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_ASYNC)
+		/* The outputs go to the FAT volume, which may still be
+		 * formatting when a flight lands right after boot.
+		 */
+		(void)flight_log_fat_wait(K_FOREVER);
+#endif /* CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_ASYNC */
 
 		/* DATA_LOGGER_PATH_MAX minus struct data_logger_formatter's member
-		 * "file_ext" */
-		char base[DATA_LOGGER_PATH_MAX - 8];
-
+		 * "file_ext" (up to "influx.lz4") and its dot */
+		char base[DATA_LOGGER_PATH_MAX - 12];
+
+#if defined(CONFIG_DATA_LOGGER_CONVERT_CSV) || defined(CONFIG_DATA_LOGGER_CONVERT_INFLUX) || \
+	defined(CONFIG_DATA_LOGGER_CONVERT_AUDIT)
+#if defined(CONFIG_DATA_LOGGER_CONVERT_TRAIL)
+		/* Woken at APOGEE with the log still open: convert behind
+		 * the writer until the flight is closed.  A flight the trail
+		 * failed to convert gets the full conversion below; with
+		 * sessions it is simply not marked converted yet.
+		 */
+		bool trailed = false;
+
+		if (atomic_get(&sm_logger_live)) {
+			trailed = convert_trail_run(base, sizeof(base)) == 0;
+		}
+#if defined(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+		ARG_UNUSED(trailed);
+#endif
+#endif /* CONFIG_DATA_LOGGER_CONVERT_TRAIL */
+#if defined(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+		/* The catalogue numbers every flight, so each one maps onto a
+		 * fixed FLIGHT_<number> and flights that were never converted
+		 * (e.g. power was cut on the pad) catch up here too.
+		 */
+		static struct data_logger_session sessions[CONFIG_DATA_LOGGER_DISK_SESSIONS_MAX];
+		int count = data_logger_sessions(sessions, ARRAY_SIZE(sessions));
+
+		if (count < 0) {
+			LOG_ERR("convert: cannot read session catalogue (%d)", count);
+		}
+		for (int i = 0; i < count; i++) {
+			if (sessions[i].converted) {
+				continue;
+			}
+			(void)snprintf(base, sizeof(base), "%s/FLIGHT_%u",
+				       CONFIG_DATA_LOGGER_BASE_PATH, sessions[i].number);
+			convert_to_base(base, &sessions[i]);
+		}
+#elif defined(CONFIG_DATA_LOGGER_CONVERT_TRAIL)
+		if (!trailed) {
+			if (base[0] == '\0') {
+				pick_convert_out_base(base, sizeof(base));
+			}
+			convert_to_base(base, NULL);
+		}
+#else
 		pick_convert_out_base(base, sizeof(base));
+		convert_to_base(base, NULL);
+#endif /* CONFIG_DATA_LOGGER_DISK_SESSIONS */
+#else
+		ARG_UNUSED(base);
+#endif /* CONFIG_DATA_LOGGER_CONVERT_CSV || _INFLUX || _AUDIT */
 
-#if defined(CONFIG_DATA_LOGGER_CONVERT_CSV)
-		{
-			char out_path[DATA_LOGGER_PATH_MAX];
+		k_sem_give(&convert_idle);
+	}
+}
 
-			(void)snprintf(out_path, sizeof(out_path), "%s.%s", base, data_logger_csv_formatter.file_ext);
-			int rc = data_logger_convert(&data_logger_csv_formatter, out_path);
+/* Multi-producer (SM and fusion threads) / single-consumer (logger_task)
+ * ring. A producer claims slot n by advancing log_ring_claim with a CAS,
+ * copies the sample in and then publishes it by setting the slot's seq
+ * to n + 1. The consumer only moves tail over slots whose seq matches,
+ * so a producer preempted between claim and publish holds the consumer
+ * back instead of handing it a torn sample; it never makes another
+ * producer wait. Nobody takes a lock; Zephyr's atomic_set/atomic_get
+ * are full barriers, which orders the slot copy against the publish.
+ * A producer wakes the consumer whenever the fill level is at or above
+ * the watermark, not only when it crosses it: a drain that stops at a
+ * claimed but unpublished slot can leave the ring above the watermark,
+ * and an exact match would then never fire again. The binary semaphore
+ * coalesces the extra gives. Below the watermark the consumer picks
+ * samples up on its flush-period timeout. With
+ * CONFIG_DATA_LOGGER_BIN_ZERO_COPY the first sample into an empty ring
+ * wakes it too: log_record() writes in place only while the ring is
+ * empty, so every queued sample holds the in-place path back. The slots
+ * sit with the writer's rings (__aurora_dma), away from the filter.
+ */
+BUILD_ASSERT(IS_POWER_OF_TWO(LOG_MSGQ_DEPTH),
+	     "LOG_MSGQ_DEPTH must be a power of two");
 
-			if (rc != 0) {
-				LOG_ERR("CSV conversion => %s failed (%d)", out_path, rc);
-			} else {
-				LOG_INF("converted flight_log => %s", out_path);
-			}
-		}
-#endif /* CONFIG_DATA_LOGGER_CONVERT_CSV */
+#define LOG_RING_MASK (LOG_MSGQ_DEPTH - 1U)
 
-#if defined(CONFIG_DATA_LOGGER_CONVERT_INFLUX)
-		{
-			char out_path[DATA_LOGGER_PATH_MAX];
+static struct datapoint log_ring[LOG_MSGQ_DEPTH] __aurora_dma;
+static atomic_t log_ring_seq[LOG_MSGQ_DEPTH] __aurora_dma;
+static atomic_t log_ring_claim;
+static atomic_t log_ring_tail;
+static atomic_t log_ring_dropped;
 
-			(void)snprintf(out_path, sizeof(out_path), "%s.%s", base, data_logger_influx_formatter.file_ext);
-			int rc = data_logger_convert(&data_logger_influx_formatter, out_path);
+K_SEM_DEFINE(log_ring_sem, 0, 1);
 
-			if (rc != 0) {
-				LOG_ERR("Influx conversion → %s failed (%d)", out_path, rc);
-			} else {
-				LOG_INF("converted flight_log → %s", out_path);
-			}
+void log_enqueue(const struct datapoint *dp)
+{
+	uint32_t n;
+	uint32_t used;
+
+	do {
+		n = (uint32_t)atomic_get(&log_ring_claim);
+		used = n - (uint32_t)atomic_get(&log_ring_tail);
+
+		/* Drop on overflow rather than stall the producer. */
+		if (used >= LOG_MSGQ_DEPTH) {
+			(void)atomic_inc(&log_ring_dropped);
+			return;
 		}
-#endif /* CONFIG_DATA_LOGGER_CONVERT_INFLUX */
+	} while (!atomic_cas(&log_ring_claim, (atomic_val_t)n,
+			     (atomic_val_t)(n + 1U)));
 
-		k_sem_give(&convert_idle);
+	log_ring[n & LOG_RING_MASK] = *dp;
+	atomic_set(&log_ring_seq[n & LOG_RING_MASK], (atomic_val_t)(n + 1U));
+
+	if (used + 1U >= LOG_QUEUE_WAKE_WATERMARK ||
+	    (IS_ENABLED(CONFIG_DATA_LOGGER_BIN_ZERO_COPY) && used == 0U)) {
+		k_sem_give(&log_ring_sem);
 	}
 }
 
-K_MSGQ_DEFINE(log_msgq, sizeof(struct datapoint), LOG_MSGQ_DEPTH, 4);
-void log_enqueue(const struct datapoint *dp)
+uint32_t log_queue_used(void)
+{
+	return (uint32_t)atomic_get(&log_ring_claim) -
+	       (uint32_t)atomic_get(&log_ring_tail);
+}
+
+uint32_t log_queue_dropped(void)
+{
+	return (uint32_t)atomic_get(&log_ring_dropped);
+}
+
+/* Published samples from tail on, stopping at the wrap, at
+ * LOG_DRAIN_BATCH and at the first slot still being written.
+ */
+static uint32_t log_ring_ready(uint32_t tail)
 {
-	/* Drop on overflow rather than stall the SM thread. */
-	(void)k_msgq_put(&log_msgq, dp, K_NO_WAIT);
+	uint32_t idx = tail & LOG_RING_MASK;
+	uint32_t max = MIN(LOG_DRAIN_BATCH, LOG_MSGQ_DEPTH - idx);
+	uint32_t n = 0;
+
+	while (n < max &&
+	       (uint32_t)atomic_get(&log_ring_seq[idx + n]) == tail + n + 1U) {
+		n++;
+	}
+	return n;
 }
 
 struct data_logger sm_logger;
 atomic_t sm_logger_live = ATOMIC_INIT(0);
 
+void log_record(enum aurora_data type, uint64_t timestamp_ns,
+		const struct sensor_value *channels, uint8_t channel_count)
+{
+	channel_count = MIN(channel_count, DP_MAX_CHANNELS);
+
+#if defined(CONFIG_AURORA_TELEMETRY_SAMPLES)
+	/* Both storage paths below start here, so this sees every sample. */
+	(void)telemetry_send_samples((uint8_t)type, timestamp_ns, channels,
+				     channel_count);
+#endif /* CONFIG_AURORA_TELEMETRY_SAMPLES */
+
+#if defined(CONFIG_DATA_LOGGER_BIN_ZERO_COPY)
+	struct aurora_bin_record *rec;
+
+	/* Only overtake the ring when nothing is queued.  A queued record
+	 * was captured before this sample; writing past it would let this
+	 * sample rotate in a frame whose base time is newer than the
+	 * queued record, which then loses its timestamp.  Queued behind
+	 * it, the sample keeps the log in capture order.
+	 */
+	if (atomic_get(&sm_logger_live) && log_queue_used() == 0U &&
+	    data_logger_reserve(&sm_logger, timestamp_ns, &rec) == 0) {
+		rec->type          = (uint8_t)type;
+		rec->channel_count = channel_count;
+		for (uint8_t i = 0; i < channel_count; i++) {
+			rec->channels[i].val1 = channels[i].val1;
+			rec->channels[i].val2 = channels[i].val2;
+		}
+		(void)data_logger_commit(&sm_logger, rec);
+		return;
+	}
+#endif /* CONFIG_DATA_LOGGER_BIN_ZERO_COPY */
+
+	struct datapoint dp = {
+		.timestamp_ns  = timestamp_ns,
+		.type          = type,
+		.channel_count = channel_count,
+	};
+
+	memcpy(dp.channels, channels, channel_count * sizeof(channels[0]));
+	log_enqueue(&dp);
+}
+
 void logger_task(void *, void *, void *)
 {
-	struct datapoint dp;
 	int64_t last_flush = k_uptime_get();
 
 	while (1) {
@@ -499,10 +1222,27 @@ void logger_task(void *, void *, void *)
 			wait_ms = 0;
 		}
 
-		if (k_msgq_get(&log_msgq, &dp, K_MSEC(wait_ms)) == 0) {
+		(void)k_sem_take(&log_ring_sem, K_MSEC(wait_ms));
+
+		/* Drain everything published so far.  Slots stay owned by
+		 * the consumer until tail moves past them, so they are
+		 * handed to the formatter in place, in contiguous runs of
+		 * at most LOG_DRAIN_BATCH that never straddle the wrap.
+		 * Releasing tail per run frees room for the producers early.
+		 * A slot that is claimed but not yet published ends the
+		 * drain; its producer is mid-copy and the next pass picks
+		 * it up.
+		 */
+		uint32_t tail = (uint32_t)atomic_get(&log_ring_tail);
+		uint32_t n;
+
+		while ((n = log_ring_ready(tail)) > 0U) {
 			if (atomic_get(&sm_logger_live)) {
-				data_logger_log(&dp);
+				data_logger_log_batch(
+					&log_ring[tail & LOG_RING_MASK], n);
 			}
+			tail += n;
+			atomic_set(&log_ring_tail, (atomic_val_t)tail);
 		}
 
 		if (k_uptime_get() - last_flush >= LOG_FLUSH_PERIOD_MS) {
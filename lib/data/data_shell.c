@@ -3,7 +3,16 @@
  * @brief Zephyr shell commands for data logger management.
  *
  * Provides "data_logger list|start|stop|status|flush" commands that
- * operate on loggers registered automatically by data_logger_init().
+ * operate on loggers registered automatically by data_logger_init(), and
+ * "data_logger queue" for the SM → logger-thread sample queue.  With
+ * the binary frame index, "data_logger seek" looks up lifecycle events
+ * in the flight log on storage, and with disk sessions
+ * "data_logger sessions" lists the flights kept on the card.
+ * "data_logger export" streams the raw flight log to the export port.
+ * "data_logger stats" shows the binary writer's latency histogram.
+ * "data_logger dump" prints a seq or time range of the flight log as
+ * hex or base64 lines for capture on the host.  "data_logger bench"
+ * qualifies the SD card under the flight-log region.
  *
  * Copyright (c) 2026 Auxspace e.V.
  *
@@ -14,6 +23,10 @@
 #include <string.h>
 
 #include <zephyr/shell/shell.h>
+#if defined(CONFIG_DATA_LOGGER_DUMP)
+#include <zephyr/sys/base64.h>
+#include <zephyr/sys/crc.h>
+#endif
 
 #include <aurora/lib/data_logger.h>
 
@@ -159,6 +172,376 @@ static int cmd_flush(const struct shell *sh, size_t argc, char **argv)
 	return 0;
 }
 
+static int cmd_queue(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "queued: %u/%u  dropped: %u",
+		    log_queue_used(), (unsigned int)LOG_MSGQ_DEPTH,
+		    log_queue_dropped());
+	return 0;
+}
+
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+static int cmd_seek(const struct shell *sh, size_t argc, char **argv)
+{
+	static const struct {
+		const char *name;
+		enum data_logger_event ev;
+	} events[] = {
+		{ "boost",  DLE_BOOST  },
+		{ "apogee", DLE_APOGEE },
+		{ "landed", DLE_LANDED },
+	};
+	struct data_logger_seek pos;
+
+	ARG_UNUSED(argc);
+
+	for (size_t i = 0; i < ARRAY_SIZE(events); i++) {
+		if (strcmp(argv[1], events[i].name) != 0) {
+			continue;
+		}
+
+		int rc = data_logger_seek_event(events[i].ev, &pos);
+
+		if (rc) {
+			shell_error(sh, "Seek failed: %d", rc);
+			return rc;
+		}
+
+		shell_print(sh, "%s: seq %u at offset %ld, t=%llu ns",
+			    argv[1], pos.seq, (long)pos.offset,
+			    (unsigned long long)pos.base_ts_ns);
+		return 0;
+	}
+
+	shell_error(sh, "Usage: data_logger seek <boost|apogee|landed>");
+	return -EINVAL;
+}
+#endif /* CONFIG_DATA_LOGGER_BIN_INDEX */
+
+#if defined(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+static int cmd_sessions(const struct shell *sh, size_t argc, char **argv)
+{
+	static struct data_logger_session list[CONFIG_DATA_LOGGER_DISK_SESSIONS_MAX];
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	int count = data_logger_sessions(list, ARRAY_SIZE(list));
+
+	if (count < 0) {
+		shell_error(sh, "Reading the catalogue failed: %d", count);
+		return count;
+	}
+
+	for (int i = 0; i < count; i++) {
+		if (list[i].frames == AURORA_BIN_SESSION_OPEN) {
+			shell_print(sh, "FLIGHT_%u  offset %ld  open%s",
+				    list[i].number, (long)list[i].offset,
+				    list[i].converted ? "  converted" : "");
+		} else {
+			shell_print(sh, "FLIGHT_%u  offset %ld  %u frames%s",
+				    list[i].number, (long)list[i].offset,
+				    list[i].frames,
+				    list[i].converted ? "  converted" : "");
+		}
+	}
+	shell_print(sh, "%d flight(s)", count);
+	return 0;
+}
+#endif /* CONFIG_DATA_LOGGER_DISK_SESSIONS */
+
+#if defined(CONFIG_DATA_LOGGER_EXPORT)
+static int cmd_export(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "Exporting flight log, run tools/aurora_export.py "
+		    "on the export port");
+
+	int rc = data_logger_export_uart();
+
+	if (rc < 0) {
+		shell_error(sh, "Export failed: %d", rc);
+		return rc;
+	}
+
+	shell_print(sh, "Exported %d frames", rc);
+	return 0;
+}
+#endif /* CONFIG_DATA_LOGGER_EXPORT */
+
+#if defined(CONFIG_DATA_LOGGER_BIN_STATS)
+static int cmd_stats(const struct shell *sh, size_t argc, char **argv)
+{
+	struct data_logger_bin_stats st;
+
+	if (argc > 1) {
+		if (strcmp(argv[1], "reset") != 0) {
+			shell_error(sh, "Usage: data_logger stats [reset]");
+			return -EINVAL;
+		}
+		data_logger_bin_stats_reset();
+		return 0;
+	}
+
+	(void)data_logger_bin_stats(&st);
+
+	shell_print(sh, "frames: %u  bytes: %llu  writes: %u",
+		    st.frames, (unsigned long long)st.bytes, st.writes);
+	shell_print(sh, "max latency: %u us  stalls: %u  queue peak: %u/%u",
+		    st.lat_max_us, st.stalls, st.ring_max, st.ring_size);
+
+	for (size_t i = 0; i < ARRAY_SIZE(st.lat_hist); i++) {
+		if (st.lat_hist[i] == 0U) {
+			continue;
+		}
+		if (i == 0U) {
+			shell_print(sh, "  < 1 us: %u", st.lat_hist[i]);
+		} else if (i == ARRAY_SIZE(st.lat_hist) - 1U) {
+			shell_print(sh, "  >= %u us: %u", 1U << (i - 1U),
+				    st.lat_hist[i]);
+		} else {
+			shell_print(sh, "  %u..%u us: %u", 1U << (i - 1U),
+				    (1U << i) - 1U, st.lat_hist[i]);
+		}
+	}
+
+#if defined(CONFIG_DATA_LOGGER_BIN_MIRROR)
+	struct data_logger_bin_mirror_stats ms;
+
+	(void)data_logger_bin_mirror_stats(&ms);
+	shell_print(sh, "mirror: frames: %u  decimated: %u  dropped: %u  "
+		    "queue peak: %u%s", ms.frames, ms.decimated, ms.dropped,
+		    ms.queue_max, ms.disk_lost ? "  (card lost)" : "");
+#endif
+	return 0;
+}
+#endif /* CONFIG_DATA_LOGGER_BIN_STATS */
+
+#if defined(CONFIG_DATA_LOGGER_DUMP)
+/* Input bytes per output line; both encode to 64 characters, and 48 is
+ * a multiple of 3 so the base64 lines join into one unpadded stream.
+ */
+#define DUMP_B64_LINE 48
+#define DUMP_HEX_LINE 32
+
+struct dump_ctx {
+	const struct shell *sh;
+	bool b64;
+	size_t line_len;
+	size_t fill;
+	uint32_t crc;
+	uint8_t line[DUMP_B64_LINE];
+};
+
+static void dump_line(struct dump_ctx *ctx)
+{
+	char text[2 * DUMP_HEX_LINE + 1];
+	size_t olen;
+
+	if (ctx->fill == 0U) {
+		return;
+	}
+	if (ctx->b64) {
+		(void)base64_encode((uint8_t *)text, sizeof(text), &olen,
+				    ctx->line, ctx->fill);
+		shell_print(ctx->sh, "AB64 %s", text);
+	} else {
+		(void)bin2hex(ctx->line, ctx->fill, text, sizeof(text));
+		shell_print(ctx->sh, "AHEX %s", text);
+	}
+	ctx->fill = 0;
+}
+
+static int dump_frames(const void *frames, size_t len, void *user_data)
+{
+	struct dump_ctx *ctx = user_data;
+	const uint8_t *p = frames;
+
+	ctx->crc = crc32_ieee_update(ctx->crc, p, len);
+	while (len > 0U) {
+		size_t n = MIN(len, ctx->line_len - ctx->fill);
+
+		memcpy(&ctx->line[ctx->fill], p, n);
+		ctx->fill += n;
+		p += n;
+		len -= n;
+		if (ctx->fill == ctx->line_len) {
+			dump_line(ctx);
+		}
+	}
+	return 0;
+}
+
+/* Fill @p range from the selector in argv[2..]; see the help text. */
+static int dump_parse(const struct shell *sh, size_t argc, char **argv,
+		      struct data_logger_dump_range *range)
+{
+	static const struct {
+		const char *name;
+		enum data_logger_event ev;
+	} events[] = {
+		{ "boost",  DLE_BOOST  },
+		{ "apogee", DLE_APOGEE },
+		{ "landed", DLE_LANDED },
+	};
+	unsigned long long a = 0;
+	unsigned long long b = 0;
+	int err = 0;
+
+	*range = (struct data_logger_dump_range){
+		.last_seq = UINT32_MAX,
+		.to_ns    = UINT64_MAX,
+	};
+	if (argc < 3) {
+		return 0;
+	}
+	if (argc > 3) {
+		a = shell_strtoull(argv[3], 0, &err);
+	}
+	if (err == 0 && argc > 4) {
+		b = shell_strtoull(argv[4], 0, &err);
+	}
+	if (err != 0) {
+		shell_error(sh, "Invalid number");
+		return -EINVAL;
+	}
+
+	if (strcmp(argv[2], "seq") == 0 && argc > 3) {
+		range->first_seq = (uint32_t)MIN(a, UINT32_MAX);
+		if (argc > 4) {
+			range->last_seq = (uint32_t)MIN(b, UINT32_MAX);
+		}
+		return 0;
+	}
+	if (strcmp(argv[2], "time") == 0 && argc > 3) {
+		range->from_ns = a * NSEC_PER_MSEC;
+		if (argc > 4) {
+			range->to_ns = b * NSEC_PER_MSEC;
+		}
+		return 0;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(events); i++) {
+		struct data_logger_seek pos;
+
+		if (strcmp(argv[2], events[i].name) != 0 || argc > 4) {
+			continue;
+		}
+
+		int rc = data_logger_seek_event(events[i].ev, &pos);
+
+		if (rc) {
+			shell_error(sh, "Seek failed: %d", rc);
+			return rc;
+		}
+		range->first_seq = pos.seq;
+		if (argc > 3 && a > 0U) {
+			range->last_seq = (uint32_t)MIN(pos.seq + a - 1U,
+							UINT32_MAX);
+		}
+		return 0;
+	}
+
+	shell_error(sh, "Usage: data_logger dump <hex|b64> [seq <first> "
+		    "[last] | time <from_ms> [to_ms] | "
+		    "boost|apogee|landed [frames]]");
+	return -EINVAL;
+}
+
+static int cmd_dump(const struct shell *sh, size_t argc, char **argv)
+{
+	struct data_logger_dump_range range;
+	struct dump_ctx ctx = { .sh = sh };
+	int rc;
+
+	if (strcmp(argv[1], "b64") == 0) {
+		ctx.b64      = true;
+		ctx.line_len = DUMP_B64_LINE;
+	} else if (strcmp(argv[1], "hex") == 0) {
+		ctx.line_len = DUMP_HEX_LINE;
+	} else {
+		shell_error(sh, "Encoding must be hex or b64");
+		return -EINVAL;
+	}
+
+	rc = dump_parse(sh, argc, argv, &range);
+	if (rc != 0) {
+		return rc;
+	}
+
+	shell_print(sh, "dump: frame size %u",
+		    (unsigned int)CONFIG_DATA_LOGGER_BIN_FRAME_SIZE);
+	rc = data_logger_dump(&range, dump_frames, &ctx);
+	dump_line(&ctx);
+	if (rc < 0) {
+		shell_error(sh, "Dump failed: %d", rc);
+		return rc;
+	}
+
+	shell_print(sh, "dump: %d frames, crc32 %08x", rc,
+		    (unsigned int)ctx.crc);
+	return 0;
+}
+#endif /* CONFIG_DATA_LOGGER_DUMP */
+
+#if defined(CONFIG_DATA_LOGGER_DISK_BENCH)
+static int cmd_bench(const struct shell *sh, size_t argc, char **argv)
+{
+	struct data_logger_disk_bench_result r;
+	unsigned long frames = 0;
+	unsigned long batch = 0;
+	int err = 0;
+	int rc;
+
+	if (argc > 1) {
+		frames = shell_strtoul(argv[1], 0, &err);
+	}
+	if (err == 0 && argc > 2) {
+		batch = shell_strtoul(argv[2], 0, &err);
+	}
+	if (err != 0) {
+		shell_error(sh, "Usage: data_logger bench [frames] [batch]");
+		return -EINVAL;
+	}
+
+	shell_print(sh, "bench: overwriting the end of the flight-log region");
+	rc = data_logger_disk_bench((uint32_t)MIN(frames, UINT32_MAX),
+				    (uint32_t)MIN(batch, UINT32_MAX), &r);
+	if (rc == -EBUSY) {
+		shell_error(sh, "Close the bin logger first");
+		return rc;
+	}
+	if (rc) {
+		shell_error(sh, "Bench failed: %d", rc);
+		return rc;
+	}
+
+	shell_print(sh, "bench: %u frames of %u B from sector %u, %u per write",
+		    r.frames, (unsigned int)CONFIG_DATA_LOGGER_BIN_FRAME_SIZE,
+		    r.first_sector, r.batch_frames);
+	shell_print(sh, "write: %u KiB/s  p99 %u us  max %u us",
+		    r.write_kibps, r.write_p99_us, r.write_max_us);
+	shell_print(sh, "read:  %u KiB/s  p99 %u us  max %u us  bad frames %u",
+		    r.read_kibps, r.read_p99_us, r.read_max_us, r.bad_frames);
+	shell_print(sh, "need:  %u KiB/s x %u%% at %u Hz, p99 <= %u us, "
+		    "max <= %u us", r.need_kibps,
+		    (unsigned int)CONFIG_DATA_LOGGER_DISK_BENCH_MARGIN_PCT,
+		    (unsigned int)CONFIG_DATA_LOGGER_DISK_BENCH_RATE_HZ,
+		    r.batch_us, r.ring_us);
+	if (!r.pass) {
+		shell_error(sh, "FAIL");
+		return -EIO;
+	}
+	shell_print(sh, "PASS");
+	return 0;
+}
+#endif /* CONFIG_DATA_LOGGER_DISK_BENCH */
+
 struct dynamic_ctx {
 	size_t idx;
 	size_t target;
@@ -200,6 +583,38 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		      "Show state of a data logger", cmd_status, 2, 0),
 	SHELL_CMD_ARG(flush, &dsub_logger_name,
 		      "Flush a data logger to storage", cmd_flush, 2, 0),
+	SHELL_CMD(queue, NULL, "Show sample queue fill and drop count",
+		  cmd_queue),
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+	SHELL_CMD_ARG(seek, NULL,
+		      "Locate an event in the flight log: boost|apogee|landed",
+		      cmd_seek, 2, 0),
+#endif
+#if defined(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+	SHELL_CMD(sessions, NULL, "List the flights kept on the disk raw region",
+		  cmd_sessions),
+#endif
+#if defined(CONFIG_DATA_LOGGER_BIN_STATS)
+	SHELL_CMD_ARG(stats, NULL,
+		      "Show binary writer latency and throughput [reset]",
+		      cmd_stats, 1, 1),
+#endif
+#if defined(CONFIG_DATA_LOGGER_DUMP)
+	SHELL_CMD_ARG(dump, NULL,
+		      "Print raw frames: <hex|b64> [seq <first> [last] | "
+		      "time <from_ms> [to_ms] | boost|apogee|landed [frames]]",
+		      cmd_dump, 2, 3),
+#endif
+#if defined(CONFIG_DATA_LOGGER_DISK_BENCH)
+	SHELL_CMD_ARG(bench, NULL,
+		      "Benchmark the SD card, overwriting the end of the "
+		      "flight-log region: [frames] [batch]",
+		      cmd_bench, 1, 2),
+#endif
+#if defined(CONFIG_DATA_LOGGER_EXPORT)
+	SHELL_CMD(export, NULL, "Stream the raw flight log to the export port",
+		  cmd_export),
+#endif
 	SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_REGISTER(data_logger, &sub_data_logger,
@@ -14,9 +14,15 @@
  * partition where fs_mkfs() cannot reach it.
  *
  * Repartitioning is done by writing a hand-built MBR (one partition
- * spanning [START_LBA, offset-bytes/sector_size)) and then calling
- * fs_mkfs() with FF_MULTI_PARTITION enabled, so FatFs forcibly formats
- * inside partition 1 instead of treating the whole disk as one volume.
+ * spanning [START_LBA, offset-bytes/sector_size)) and then formatting
+ * with FF_MULTI_PARTITION enabled, so FatFs forcibly formats inside
+ * partition 1 instead of treating the whole disk as one volume.
+ *
+ * The checks that latch flight_log_online() run in SYS_INIT.  With
+ * CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_ASYNC the FAT rebuild itself (MBR,
+ * mkfs, remount) then moves to a thread of its own: the raw region lies
+ * outside the FAT partition and is recordable straight away, and FAT
+ * users wait for flight_log_fat_wait().
  *
  * Copyright (c) 2026 Auxspace e.V.
  *
@@ -89,6 +95,15 @@ PARTITION VolToPart[FF_VOLUMES] = {
 	{0, 1},
 };
 
+#if defined(CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_ASYNC)
+K_THREAD_STACK_DEFINE(fat_rebuild_stack,
+		      CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_STACK_SIZE);
+static struct k_thread fat_rebuild_thread;
+#endif /* CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_ASYNC */
+
+/* Given (and left given) once the FAT volume has settled at boot. */
+static K_SEM_DEFINE(fat_settled, 0, 1);
+
 /* One sector of bounce buffer for the magic probe / MBR write.
  * Sized to FF_MAX_SS (4096) to cover any disk reporting a non-512
  * sector size; SD/MMC always reports 512 in practice.
@@ -265,50 +280,123 @@ bool flight_log_online(void)
 	return atomic_get(&flight_log_online_flag) != 0;
 }
 
+/* flight_log_fat_wait – see data_logger.h */
+int flight_log_fat_wait(k_timeout_t timeout)
+{
+	if (k_sem_take(&fat_settled, timeout) != 0) {
+		return -EAGAIN;
+	}
+	k_sem_give(&fat_settled);
+	return 0;
+}
+
+/* Where rebuild_fat_volume() puts partition 1. */
+struct fat_layout {
+	uint32_t sector_size;
+	uint32_t part_start;
+	uint32_t fat_end_lba;
+};
+
+/* Unmount the volume if fstab (or an earlier pass) mounted it. */
+static int fat_unmount(struct fs_mount_t *mp)
+{
+	struct fs_statvfs stat;
+	int rc = 0;
+
+	if (fs_statvfs(FS_MOUNT_POINT, &stat) == 0) {
+		rc = fs_unmount(mp);
+		if (rc != 0) {
+			LOG_ERR("auto-mkfs: fs_unmount(%s) failed (%d)",
+				FS_MOUNT_POINT, rc);
+		}
+	}
+	return rc;
+}
+
+#if defined(CONFIG_DATA_LOGGER_DISK_QUICK_MKFS)
+/* f_mkfs() clears the FAT and root directory through this buffer, so
+ * its size sets how many sectors go to the disk per write.
+ */
+static uint8_t mkfs_work[CONFIG_DATA_LOGGER_DISK_MKFS_BUF_SIZE] __aligned(4);
+
+/* Lay out the FAT in partition 1 with f_mkfs() directly: one FAT copy
+ * and a fixed cluster size keep the metadata small, and mkfs_work
+ * writes it in large blocks.  A cluster size the volume cannot take
+ * falls back to FatFs' own choice.
+ */
+static int fat_mkfs(const char *dev)
+{
+	MKFS_PARM opt = {
+		.fmt = FM_ANY,
+		.n_fat = 1,
+		.align = 0,
+		.n_root = CONFIG_FS_FATFS_MAX_ROOT_ENTRIES,
+		.au_size = CONFIG_DATA_LOGGER_DISK_MKFS_CLUSTER_SIZE,
+	};
+	FRESULT res = f_mkfs(dev, &opt, mkfs_work, sizeof(mkfs_work));
+
+	if (res == FR_MKFS_ABORTED && opt.au_size != 0U) {
+		LOG_WRN("auto-mkfs: %u B clusters do not fit %s, letting "
+			"FatFs choose", (unsigned int)opt.au_size, dev);
+		opt.au_size = 0;
+		res = f_mkfs(dev, &opt, mkfs_work, sizeof(mkfs_work));
+	}
+	if (res != FR_OK) {
+		LOG_ERR("auto-mkfs: f_mkfs(%s) failed (FRESULT %d)", dev, res);
+		return -EIO;
+	}
+	return 0;
+}
+#else
+static int fat_mkfs(const char *dev)
+{
+	int rc = fs_mkfs(FS_FATFS, (uintptr_t)dev, NULL, 0);
+
+	if (rc != 0) {
+		LOG_ERR("auto-mkfs: fs_mkfs(%s) failed (%d)", dev, rc);
+	}
+	return rc;
+}
+#endif /* CONFIG_DATA_LOGGER_DISK_QUICK_MKFS */
+
 /* One full FAT rebuild pass: unmount (if mounted), rewrite the MBR,
  * mkfs partition 1, remount.  Returns 0 with the volume mounted, or a
  * negative errno from the first failing step.
  */
-static int rebuild_fat_volume(struct fs_mount_t *mp, uint32_t sector_size,
-			      uint32_t part_start, uint32_t fat_end_lba)
+static int rebuild_fat_volume(struct fs_mount_t *mp,
+			      const struct fat_layout *fl)
 {
-	struct fs_statvfs stat;
 	int rc;
 
 	/* fstab may have automounted an existing FAT in partition 1; we
 	 * are about to rewrite the MBR underneath FatFs, so unmount first.
 	 */
-	if (fs_statvfs(FS_MOUNT_POINT, &stat) == 0) {
-		rc = fs_unmount(mp);
-		if (rc != 0) {
-			LOG_ERR("auto-mkfs: fs_unmount(%s) failed (%d)",
-				FS_MOUNT_POINT, rc);
-			return rc;
-		}
+	rc = fat_unmount(mp);
+	if (rc != 0) {
+		return rc;
 	}
 
-	rc = write_mbr_partition_1(sector_size, part_start,
-				   fat_end_lba - part_start);
+	rc = write_mbr_partition_1(fl->sector_size, fl->part_start,
+				   fl->fat_end_lba - fl->part_start);
 	if (rc != 0) {
 		LOG_ERR("auto-mkfs: MBR write failed (%d)", rc);
 		return rc;
 	}
 
 	LOG_WRN("auto-mkfs: formatting %s partition 1 [%u..%u) on %s",
-		FS_MOUNT_POINT, part_start, fat_end_lba, DISK_NAME);
+		FS_MOUNT_POINT, fl->part_start, fl->fat_end_lba, DISK_NAME);
 
 	const char *dev = mp->mnt_point;
 
-	/* fatfs_mkfs takes the f_mkfs() path string (e.g. "MMC:"), which is
-	 * the mount point without the leading slash.
+	/* f_mkfs() takes a path string (e.g. "MMC:"), which is the mount
+	 * point without the leading slash.
 	 */
 	if (dev[0] == '/') {
 		dev++;
 	}
 
-	rc = fs_mkfs(FS_FATFS, (uintptr_t)dev, NULL, 0);
+	rc = fat_mkfs(dev);
 	if (rc != 0) {
-		LOG_ERR("auto-mkfs: fs_mkfs(%s) failed (%d)", dev, rc);
 		return rc;
 	}
 
@@ -328,13 +416,36 @@ static int rebuild_fat_volume(struct fs_mount_t *mp, uint32_t sector_size,
  */
 #define FAT_REBUILD_ATTEMPTS 2
 
-/* Non-static so unit tests can re-invoke the entry point to simulate a
- * reboot without going through Zephyr's init system.  Production callers
- * should rely on the SYS_INIT registration below.
+/* Rebuild passes until one leaves the volume mounted. */
+static void fat_rebuild(struct fs_mount_t *mp, const struct fat_layout *fl)
+{
+	for (int attempt = 1; attempt <= FAT_REBUILD_ATTEMPTS; attempt++) {
+		int rc = rebuild_fat_volume(mp, fl);
+
+		if (rc == 0) {
+			LOG_INF("auto-mkfs: %s formatted and mounted (FAT in "
+				"[%u..%u), raw region preserved)",
+				mp->mnt_point, fl->part_start,
+				fl->fat_end_lba);
+			return;
+		}
+		LOG_WRN("auto-mkfs: rebuild attempt %d/%d failed (%d)",
+			attempt, FAT_REBUILD_ATTEMPTS, rc);
+	}
+
+	/* FAT is dead but the raw region passed its checks: binary flight
+	 * recording still works, only FS logging / on-card CSV conversion
+	 * are lost.  Don't block boot and don't inhibit arming.
+	 */
+	LOG_ERR("auto-mkfs: giving up on %s. Continuing with raw flight "
+		"recording only", FS_MOUNT_POINT);
+}
+
+/* Verify the disk and latch flight_log_online().  Returns 1 with @p fl
+ * filled in when the FAT volume has to be rebuilt, 0 otherwise.
  */
-int flight_log_disk_auto_format(void)
+static int flight_log_disk_check(struct fs_mount_t *mp, struct fat_layout *fl)
 {
-	struct fs_mount_t *mp = &FS_FSTAB_ENTRY(FS_NODE);
 	uint32_t sector_size = 0;
 	uint32_t sector_count = 0;
 	int rc;
@@ -436,25 +547,27 @@ int flight_log_disk_auto_format(void)
 		return 0;
 	}
 
-	for (int attempt = 1; attempt <= FAT_REBUILD_ATTEMPTS; attempt++) {
-		rc = rebuild_fat_volume(mp, sector_size, part_start,
-					fat_end_lba);
-		if (rc == 0) {
-			LOG_INF("auto-mkfs: %s formatted and mounted (FAT in "
-				"[%u..%u), raw region preserved)",
-				mp->mnt_point, part_start, fat_end_lba);
-			return 0;
-		}
-		LOG_WRN("auto-mkfs: rebuild attempt %d/%d failed (%d)",
-			attempt, FAT_REBUILD_ATTEMPTS, rc);
-	}
+	*fl = (struct fat_layout){
+		.sector_size = sector_size,
+		.part_start  = part_start,
+		.fat_end_lba = fat_end_lba,
+	};
+	return 1;
+}
 
-	/* FAT is dead but the raw region passed its checks: binary flight
-	 * recording still works, only FS logging / on-card CSV conversion
-	 * are lost.  Don't block boot and don't inhibit arming.
-	 */
-	LOG_ERR("auto-mkfs: giving up on %s. Continuing with raw flight "
-		"recording only", FS_MOUNT_POINT);
+/* Non-static so unit tests can re-invoke the entry point to simulate a
+ * reboot without going through Zephyr's init system.  Production callers
+ * should rely on the SYS_INIT registration below.  Always synchronous:
+ * the rebuild, if any, is done when this returns.
+ */
+int flight_log_disk_auto_format(void)
+{
+	struct fs_mount_t *mp = &FS_FSTAB_ENTRY(FS_NODE);
+	struct fat_layout fl;
+
+	if (flight_log_disk_check(mp, &fl) > 0) {
+		fat_rebuild(mp, &fl);
+	}
 	return 0;
 }
 
@@ -511,15 +624,58 @@ static void flight_log_fs_backend_start(void)
 static inline void flight_log_fs_backend_start(void) { }
 #endif /* CONFIG_LOG_BACKEND_FS */
 
+/* Publish the settled FAT volume: start disk logging and release
+ * flight_log_fat_wait().
+ */
+static void fat_settle(void)
+{
+	flight_log_fs_backend_start();
+	k_sem_give(&fat_settled);
+}
+
+#if defined(CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_ASYNC)
+static struct fat_layout boot_layout;
+
+static void fat_rebuild_task(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	fat_rebuild(p1, &boot_layout);
+	fat_settle();
+}
+#endif /* CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_ASYNC */
+
 /*
- * SYS_INIT entry point: verify the flight-log disk and format the FAT
- * volume if needed (this latches flight_log_online()), then start the
- * file-system log backend now that /MMC: is (or isn't) mounted.
+ * SYS_INIT entry point: verify the flight-log disk (this latches
+ * flight_log_online()) and format the FAT volume if needed, then start
+ * the file-system log backend now that /MMC: is (or isn't) mounted.
+ * With CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_ASYNC the format and the
+ * backend start run on fat_rebuild_thread instead.
  */
 static int flight_log_disk_bringup(void)
 {
+#if defined(CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_ASYNC)
+	struct fs_mount_t *mp = &FS_FSTAB_ENTRY(FS_NODE);
+
+	if (flight_log_disk_check(mp, &boot_layout) > 0) {
+		/* Nothing may open files on the volume about to be
+		 * reformatted once the application threads start.
+		 */
+		(void)fat_unmount(mp);
+		k_thread_create(&fat_rebuild_thread, fat_rebuild_stack,
+				K_THREAD_STACK_SIZEOF(fat_rebuild_stack),
+				fat_rebuild_task, mp, NULL, NULL,
+				CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_PRIORITY, 0,
+				K_NO_WAIT);
+		k_thread_name_set(&fat_rebuild_thread, "fat_rebuild");
+	} else {
+		fat_settle();
+	}
+#else
 	(void)flight_log_disk_auto_format();
-	flight_log_fs_backend_start();
+	fat_settle();
+#endif /* CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_ASYNC */
 
 	if (!flight_log_online()) {
 		LOG_WRN("flight-log disk %s offline at boot. "
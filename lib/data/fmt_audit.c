@@ -0,0 +1,196 @@
+/**
+ * @file fmt_audit.c
+ * @brief State machine audit trail conversion target.
+ *
+ * With CONFIG_AURORA_STATE_MACHINE_AUDIT_FLIGHT_LOG the audit trail is
+ * stored in the binary flight log as AURORA_DATA_SM_AUDIT records (see
+ * data_logger.h).  This formatter ignores every other type, reassembles
+ * the event text of multi-record entries and writes one line per entry
+ * in the same layout as the audit file and the shell listing:
+ *
+ *   <timestamp_ns> transition <from> <to>
+ *   <timestamp_ns> event      <state> <text>
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <aurora/lib/data_logger.h>
+#include <aurora/lib/state/audit.h>
+
+LOG_MODULE_DECLARE(data_logger, CONFIG_DATA_LOGGER_LOG_LEVEL);
+
+#define AUDIT_LINE_MAX 128
+
+/* -------------------------------------------------------------------------- */
+/*  Private context                                                           */
+/* -------------------------------------------------------------------------- */
+
+struct audit_ctx {
+	struct fs_file_t file;
+	/* Entry being reassembled; next_chunk == 0 when none is open. */
+	struct sm_audit_entry entry;
+	uint8_t next_chunk;
+	size_t len;
+	char text[AURORA_AUDIT_TEXT_MAX + 1];
+};
+
+/* -------------------------------------------------------------------------- */
+/*  Formatter callbacks                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int audit_init(struct data_logger *logger, const char *path)
+{
+	struct audit_ctx *ctx = k_calloc(1, sizeof(*ctx));
+
+	if (!ctx)
+		return -ENOMEM;
+
+	fs_file_t_init(&ctx->file);
+
+	int rc = fs_open(&ctx->file, path,
+			 FS_O_CREATE | FS_O_WRITE | FS_O_TRUNC);
+
+	if (rc != 0) {
+		LOG_ERR("failed to open %s (%d)", path, rc);
+		k_free(ctx);
+		return rc;
+	}
+
+	logger->ctx = ctx;
+	return 0;
+}
+
+static int write_line(struct audit_ctx *ctx, const char *line)
+{
+	ssize_t wr = fs_write(&ctx->file, line, strlen(line));
+
+	return wr < 0 ? (int)wr : 0;
+}
+
+static int audit_write_header(struct data_logger *logger)
+{
+	char header[AUDIT_LINE_MAX];
+
+	(void)snprintf(header, sizeof(header), "%-12.12s %-12.12s %-12.12s %-12.12s\n",
+		       "Time (ns)", "Type", "From", "To / Event");
+
+	int rc = write_line(logger->ctx, header);
+
+	if (rc != 0)
+		return rc;
+
+	return write_line(logger->ctx,
+			  "---------------------------------------------------\n");
+}
+
+static int emit_entry(struct audit_ctx *ctx)
+{
+	char line[AUDIT_LINE_MAX];
+	int n;
+
+	ctx->text[ctx->len] = '\0';
+	ctx->entry.event = ctx->text;
+	ctx->next_chunk = 0;
+
+	n = sm_audit_format(&ctx->entry, line, sizeof(line) - 1);
+	if (n < 0)
+		return n;
+
+	n = MIN(n, (int)sizeof(line) - 2);
+	line[n++] = '\n';
+	line[n] = '\0';
+
+	return write_line(ctx, line);
+}
+
+static int audit_write_datapoint(struct data_logger *logger,
+				 const struct datapoint *dp)
+{
+	struct audit_ctx *ctx = logger->ctx;
+
+	if (dp->type != AURORA_DATA_SM_AUDIT || dp->channel_count < DP_MAX_CHANNELS)
+		return 0;
+
+	const int32_t tag = dp->channels[0].val1;
+	const uint8_t chunk = AURORA_AUDIT_TAG_CHUNK(tag);
+	const size_t len = MIN((size_t)MAX(dp->channels[0].val2, 0),
+			       (size_t)AURORA_AUDIT_TEXT_MAX);
+
+	if (chunk == 0U) {
+		if (ctx->next_chunk != 0U) {
+			LOG_WRN("audit: entry at %llu is incomplete",
+				(unsigned long long)ctx->entry.timestamp_ns);
+		}
+		ctx->entry.timestamp_ns = dp->timestamp_ns;
+		ctx->entry.type = (enum sm_audit_type)AURORA_AUDIT_TAG_KIND(tag);
+		ctx->entry.from = (enum sm_state)AURORA_AUDIT_TAG_FROM(tag);
+		ctx->entry.to = (enum sm_state)AURORA_AUDIT_TAG_TO(tag);
+		ctx->len = len;
+	} else if (chunk != ctx->next_chunk) {
+		/* Continuation of an entry we did not see start. */
+		ctx->next_chunk = 0;
+		return 0;
+	}
+
+	const size_t off = (size_t)chunk * AURORA_AUDIT_TEXT_PER_RECORD;
+
+	if (off < ctx->len) {
+		uint8_t bytes[AURORA_AUDIT_TEXT_PER_RECORD];
+
+		sys_put_le32((uint32_t)dp->channels[1].val1, &bytes[0]);
+		sys_put_le32((uint32_t)dp->channels[1].val2, &bytes[4]);
+		sys_put_le32((uint32_t)dp->channels[2].val1, &bytes[8]);
+		sys_put_le32((uint32_t)dp->channels[2].val2, &bytes[12]);
+		memcpy(&ctx->text[off], bytes,
+		       MIN(ctx->len - off, sizeof(bytes)));
+	}
+
+	if (off + AURORA_AUDIT_TEXT_PER_RECORD < ctx->len) {
+		ctx->next_chunk = chunk + 1U;
+		return 0;
+	}
+
+	return emit_entry(ctx);
+}
+
+static int audit_flush(struct data_logger *logger)
+{
+	struct audit_ctx *ctx = logger->ctx;
+
+	return fs_sync(&ctx->file);
+}
+
+static int audit_close(struct data_logger *logger)
+{
+	struct audit_ctx *ctx = logger->ctx;
+	int rc = fs_close(&ctx->file);
+
+	k_free(ctx);
+	logger->ctx = NULL;
+
+	return rc;
+}
+
+/* -------------------------------------------------------------------------- */
+/*  Exported formatter                                                        */
+/* -------------------------------------------------------------------------- */
+
+const struct data_logger_formatter data_logger_audit_formatter = {
+	.init            = audit_init,
+	.write_header    = audit_write_header,
+	.write_datapoint = audit_write_datapoint,
+	.flush           = audit_flush,
+	.close           = audit_close,
+	.file_ext        = "audit",
+	.name            = "audit",
+};
@@ -42,7 +42,9 @@
  *
  * The converter walks frames by seq number rather than by physical
  * offset; the lowest seq still on flash is the start of the captured
- * window, the highest seq is the end. See convert.c.
+ * window, the highest seq is the end. See convert.c.  Because every
+ * flight starts at offset 0, bin_io_window_start_hint() can binary
+ * search for the lowest seq instead of reading every header.
  *
  * Producer side (called under the data_logger mutex by the upstream logger
  * thread) memcpys each record straight into a DMA-aligned RAM staging
@@ -52,6 +54,24 @@
  * @c flash_area_erase + @c flash_area_write per frame — so 1 kHz × ~5
  * records collapses from ~5000 tiny fs_writes/s into ~50 page-aligned
  * raw-flash writes/s, with no FATFS / littlefs overhead in the path.
+ * Whenever the flush queue is empty the writer also erases up to
+ * CONFIG_DATA_LOGGER_BIN_ERASE_AHEAD frames ahead of its write offset,
+ * so frames written during boost are usually program-only.
+ *
+ * With CONFIG_DATA_LOGGER_BIN_PRETRIGGER_FRAMES > 0, pre-boost frames
+ * are parked in a RAM history ring of extra staging buffers instead of
+ * being submitted.  Frames aging out of it are decimated to flash, and
+ * DLE_BOOST submits the whole history ahead of the live frames.  A
+ * frame's seq is therefore assigned when it is submitted to the writer,
+ * not when it is opened, so flash always holds a contiguous seq run.
+ *
+ * With CONFIG_DATA_LOGGER_BIN_INDEX the last frame of the partition is
+ * not part of the ring: it holds the frame index (bin_index.h), which the
+ * writer thread rewrites after each frame that gains an entry.
+ *
+ * On a power fail (data_logger_powerfail()) the writer raises its
+ * priority, submits the live frame behind the queued ones and stops
+ * starting new writes once CONFIG_DATA_LOGGER_POWERFAIL_BUDGET_MS is up.
  *
  * Records preserve the @c sensor_value channels losslessly (val1+val2),
  * so post-flight conversion can replay filters and the state machine
@@ -74,8 +94,15 @@
 #include <zephyr/logging/log.h>
 
 #include <aurora/lib/data_logger.h>
+#include <aurora/lib/ram.h>
 
+#include "bin_codec.h"
 #include "bin_io.h"
+#include "bin_live.h"
+#include "bin_stats.h"
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+#include "bin_index.h"
+#endif
 
 LOG_MODULE_DECLARE(data_logger, CONFIG_DATA_LOGGER_LOG_LEVEL);
 
@@ -100,29 +127,50 @@ LOG_MODULE_DECLARE(data_logger, CONFIG_DATA_LOGGER_LOG_LEVEL);
 #define BIN_FRAME_SIZE ((size_t)CONFIG_DATA_LOGGER_BIN_FRAME_SIZE)
 #define BIN_BUF_COUNT  CONFIG_DATA_LOGGER_BIN_BUF_COUNT
 #define BIN_BUF_ALIGN  CONFIG_DATA_LOGGER_BIN_BUF_ALIGN
+#define BIN_ERASE_AHEAD CONFIG_DATA_LOGGER_BIN_ERASE_AHEAD
+#define BIN_PRE_FRAMES  CONFIG_DATA_LOGGER_BIN_PRETRIGGER_FRAMES
+#define BIN_BUF_TOTAL   (BIN_BUF_COUNT + BIN_PRE_FRAMES)
+#define BIN_PAYLOAD_END (BIN_FRAME_SIZE - BIN_CODEC_CRC_SIZE)
+
+/* The index slot, if any, sits right after the ring. */
+#define BIN_RING_BYTES  (BIN_FLASH_AREA_SIZE - \
+			 (IS_ENABLED(CONFIG_DATA_LOGGER_BIN_INDEX) ? \
+			  BIN_FRAME_SIZE : 0))
 
-BUILD_ASSERT(BIN_FRAME_SIZE >= BIN_HDR_SIZE + BIN_REC_SIZE,
+BUILD_ASSERT(BIN_PAYLOAD_END >= BIN_HDR_SIZE + BIN_REC_SIZE,
 	     "frame must hold at least one header + one record");
+BUILD_ASSERT(BIN_PAYLOAD_END >= BIN_HDR_SIZE + BIN_CODEC_REC_MAX,
+	     "frame must hold at least one worst-case packed record");
 BUILD_ASSERT((BIN_FRAME_SIZE - BIN_HDR_SIZE) % BIN_REC_SIZE == 0,
 	     "frame payload should be a whole number of records");
 BUILD_ASSERT(BIN_BUF_COUNT >= 2, "BIN needs at least double-buffering");
 BUILD_ASSERT(BIN_FLASH_AREA_SIZE % BIN_FRAME_SIZE == 0,
 	     "flight_log partition size must be a multiple of the frame size");
+BUILD_ASSERT(BIN_ERASE_AHEAD + BIN_BUF_TOTAL <
+	     BIN_RING_BYTES / BIN_FRAME_SIZE,
+	     "erase-ahead reserve plus staging buffers must fit in the ring");
 
 struct bin_buf {
 	uint8_t data[BIN_FRAME_SIZE];
 	size_t  used;
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+	uint32_t crc;             /* payload CRC so far, sealed on submit */
+#endif
 };
 
-/* DMA-aligned static pool. Single live bin formatter is supported. */
-static struct bin_buf bin_bufs[BIN_BUF_COUNT] __aligned(BIN_BUF_ALIGN);
+/* DMA-aligned static pool, including the pre-boost history buffers.
+ * Single live bin formatter is supported. Lives in the DMA RAM region
+ * when the board has one (CONFIG_AURORA_RAM_DMA).
+ */
+static struct bin_buf bin_bufs[BIN_BUF_TOTAL] __aurora_dma __aligned(BIN_BUF_ALIGN);
 
 struct bin_ctx {
 	const struct flash_area *fa;
+	struct data_logger *owner; /* for the power-fail handover */
 	uint64_t flight_id;
-	uint32_t next_seq;        /* producer side */
+	uint32_t next_seq;        /* producer side: seq of the next submit */
 	off_t    write_offset;    /* writer side: next frame offset */
-	uint32_t ring_frames;     /* partition size in whole frames */
+	uint32_t ring_frames;     /* ring size in whole frames */
 	int      active_idx;      /* producer's currently-held buffer */
 	atomic_t sticky_err;      /* first error observed (writer or producer) */
 
@@ -132,6 +180,36 @@ struct bin_ctx {
 	 * writer reads it to decide whether the cap has been reached.
 	 */
 	atomic_t boost_seq_or_max;
+
+	/* Erase-ahead reserve (writer side): the erased_ahead slots from
+	 * write_offset on are known blank.  post_boost counts frames
+	 * written with seq >= boost_seq, so the reserve never reaches the
+	 * BOOST frame.  bin_close clears ahead_enabled before its final
+	 * drain, after which the writer leaves the partition alone.
+	 */
+	uint32_t erased_ahead;
+	uint32_t post_boost;
+	atomic_t ahead_enabled;
+
+#if BIN_PRE_FRAMES > 0
+	/* Pre-boost history (producer side): pre_count buffer indices,
+	 * oldest at pre_tail.  pre_evicted drives the decimation of frames
+	 * aging out; closing stops parking so close can drain everything.
+	 */
+	int      pre_ring[BIN_PRE_FRAMES];
+	uint32_t pre_tail;
+	uint32_t pre_count;
+	uint32_t pre_evicted;
+	bool     closing;
+#endif
+
+#if defined(CONFIG_DATA_LOGGER_BIN_PACKED)
+	struct bin_codec_state codec; /* delta state of the active frame */
+#endif
+
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+	bool     index_on;        /* index slot erased at init */
+#endif
 };
 
 #define BIN_BOOST_NOT_SEEN ((atomic_val_t)UINT32_MAX)
@@ -141,32 +219,145 @@ static struct bin_ctx g_bin_ctx;
 static atomic_t g_bin_open = ATOMIC_INIT(0);
 
 /* Free pool: indices of buffers ready to be filled by the producer.
- * Capacity = BIN_BUF_COUNT so every buffer can sit here at once.
+ * Capacity = BIN_BUF_TOTAL so every buffer can sit here at once.
  */
-K_MSGQ_DEFINE(bin_free_q, sizeof(int), BIN_BUF_COUNT, 4);
+K_MSGQ_DEFINE(bin_free_q, sizeof(int), BIN_BUF_TOTAL, 4);
 
-/* Submit pool: indices the writer should write. Capacity = BIN_BUF_COUNT
- * for buffers, plus one extra slot for the drain sentinel value (-1).
+/* Submit pool: indices the writer should write. Capacity = BIN_BUF_TOTAL
+ * for buffers, plus one slot each for the drain sentinel (-1) and the
+ * power-fail sentinel (BIN_PF_SENTINEL).
  */
-K_MSGQ_DEFINE(bin_flush_q, sizeof(int), BIN_BUF_COUNT + 1, 4);
+K_MSGQ_DEFINE(bin_flush_q, sizeof(int), BIN_BUF_TOTAL + 2, 4);
+
+#define BIN_PF_SENTINEL (-2)
 
 /* Writer signals this when it processes a drain sentinel; by FIFO ordering
  * every buffer submitted before the sentinel has already been written.
  */
 K_SEM_DEFINE(bin_drain_sem, 0, 1);
 
+/* Power-fail state, set by bin_powerfail() from the PFM interrupt.  While
+ * bin_pf is set the writer runs at POWERFAIL_WRITER_PRIO, and past
+ * bin_pf_deadline it parks on bin_pf_resume instead of writing.
+ */
+static atomic_t bin_pf = ATOMIC_INIT(0);
+static atomic_t bin_pf_ahead = ATOMIC_INIT(0);
+static int64_t bin_pf_deadline;
+K_SEM_DEFINE(bin_pf_resume, 0, 1);
+
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+static struct bin_index bin_ix;
+
+/* Rewrite the index slot.  Failures only cost the index, not the log. */
+static int bin_index_persist(const struct flash_area *fa)
+{
+	int rc = flash_area_erase(fa, BIN_RING_BYTES, BIN_FRAME_SIZE);
+
+	if (rc == 0) {
+		rc = flash_area_write(fa, BIN_RING_BYTES, bin_ix.buf,
+				      BIN_FRAME_SIZE);
+	}
+	if (rc != 0) {
+		LOG_WRN("bin: index write failed (%d)", rc);
+	}
+	return rc;
+}
+#endif
+
 /* -------------------------------------------------------------------------- */
 /*  Writer thread                                                             */
 /* -------------------------------------------------------------------------- */
 
+/* Number of frames the writer may currently hold pre-erased. */
+static uint32_t bin_erase_ahead_target(void)
+{
+	struct bin_ctx *ctx = &g_bin_ctx;
+
+	if (!atomic_get(&ctx->ahead_enabled)) {
+		return 0;
+	}
+
+	if (atomic_get(&ctx->boost_seq_or_max) == BIN_BOOST_NOT_SEEN) {
+		return BIN_ERASE_AHEAD;
+	}
+
+	/* Post-boost the slot ring_frames past the BOOST frame is the
+	 * BOOST frame itself; keep the reserve short of it.
+	 */
+	return MIN(BIN_ERASE_AHEAD,
+		   ctx->ring_frames - MIN(ctx->post_boost, ctx->ring_frames));
+}
+
+/* Erase the first slot past the current reserve. */
+static void bin_erase_ahead_step(void)
+{
+	struct bin_ctx *ctx = &g_bin_ctx;
+	uint32_t slot = ((uint32_t)(ctx->write_offset / BIN_FRAME_SIZE) +
+			 ctx->erased_ahead) % ctx->ring_frames;
+	off_t off = (off_t)slot * (off_t)BIN_FRAME_SIZE;
+	int rc = flash_area_erase(ctx->fa, off, BIN_FRAME_SIZE);
+
+	if (rc != 0) {
+		/* Not fatal: the write path still erases inline. */
+		LOG_WRN("bin: erase-ahead at %ld failed (%d)", (long)off, rc);
+		atomic_set(&ctx->ahead_enabled, 0);
+		return;
+	}
+
+	ctx->erased_ahead++;
+}
+
+/* Run at the power-fail priority for as long as the supply is down. */
+static void bin_pf_prio(bool *boosted)
+{
+	bool pf = atomic_get(&bin_pf) != 0;
+
+	if (pf != *boosted) {
+		k_thread_priority_set(k_current_get(), pf
+			? CONFIG_DATA_LOGGER_POWERFAIL_WRITER_PRIO
+			: CONFIG_DATA_LOGGER_BIN_WRITER_PRIO);
+		*boosted = pf;
+	}
+}
+
+/* Past the power-fail budget no new write is started: the flash stays
+ * idle until the supply recovers or the hold-up capacitor is empty.
+ */
+static void bin_pf_hold(void)
+{
+	while (atomic_get(&bin_pf) && k_uptime_get() >= bin_pf_deadline) {
+		(void)k_sem_take(&bin_pf_resume, K_FOREVER);
+	}
+}
+
+static void bin_pf_commit(void);
+
 static void bin_writer_fn(void *p1, void *p2, void *p3)
 {
 	ARG_UNUSED(p1); ARG_UNUSED(p2); ARG_UNUSED(p3);
 
 	int idx;
+	bool boosted = false;
 
 	for (;;) {
-		if (k_msgq_get(&bin_flush_q, &idx, K_FOREVER) != 0) {
+		/* Idle turns top up the erase-ahead reserve one frame at a
+		 * time, so a buffer submitted meanwhile waits for at most
+		 * one erase.
+		 */
+		bool top_up = g_bin_ctx.erased_ahead < bin_erase_ahead_target();
+
+		if (k_msgq_get(&bin_flush_q, &idx,
+			       top_up ? K_NO_WAIT : K_FOREVER) != 0) {
+			if (top_up) {
+				bin_erase_ahead_step();
+			}
+			continue;
+		}
+
+		bin_pf_prio(&boosted);
+
+		if (idx == BIN_PF_SENTINEL) {
+			bin_pf_commit();
 			continue;
 		}
 
@@ -190,11 +381,10 @@ static void bin_writer_fn(void *p1, void *p2, void *p3)
 			 * point so the BOOST frame and the post-boost capture
 			 * remain intact.
 			 *
-			 * Frames with seq < boost_seq are pre-boost in-flight
-			 * buffers (the active buffer at the moment of BOOST
-			 * still carries a pre-boost seq); they are written
-			 * normally at write_offset so the boundary lands
-			 * cleanly on flash.
+			 * Frames with seq < boost_seq are pre-boost buffers
+			 * that were already queued when BOOST fired; they
+			 * are written normally at write_offset so the
+			 * boundary lands cleanly on flash.
 			 */
 			bool capped = (boost != BIN_BOOST_NOT_SEEN) &&
 				      (buf_seq >= (uint32_t)boost) &&
@@ -206,6 +396,8 @@ static void bin_writer_fn(void *p1, void *p2, void *p3)
 				 * already on flash exactly as recorded.
 				 */
 			} else {
+				bin_pf_hold();
+
 				off_t off = g_bin_ctx.write_offset;
 
 				/* Circular wrap at partition end. Pre-boost
@@ -213,16 +405,32 @@ static void bin_writer_fn(void *p1, void *p2, void *p3)
 				 * the one we'd sacrifice anyway.
 				 */
 				if ((size_t)off + BIN_FRAME_SIZE >
-				    (size_t)BIN_FLASH_AREA_SIZE) {
+				    (size_t)BIN_RING_BYTES) {
 					off = 0;
 					g_bin_ctx.write_offset = 0;
 				}
 
-				int rc = flash_area_erase(g_bin_ctx.fa, off,
-							  BIN_FRAME_SIZE);
+				int rc = 0;
+				uint32_t t0 = bin_stats_begin();
+
+				if (g_bin_ctx.erased_ahead > 0U) {
+					g_bin_ctx.erased_ahead--;
+				} else {
+					rc = flash_area_erase(g_bin_ctx.fa, off,
+							      BIN_FRAME_SIZE);
+				}
+				/* Packed frames end on an arbitrary byte;
+				 * round up to the record grid so the write
+				 * stays block-aligned (the tail is 0xFF).
+				 * A CRC trailer sits at the very end.
+				 */
+				size_t len = IS_ENABLED(CONFIG_DATA_LOGGER_BIN_CRC)
+					? BIN_FRAME_SIZE
+					: ROUND_UP(b->used, BIN_REC_SIZE);
+
 				if (rc == 0) {
 					rc = flash_area_write(g_bin_ctx.fa, off,
-							      b->data, b->used);
+							      b->data, len);
 				}
 
 				if (rc != 0) {
@@ -230,9 +438,24 @@ static void bin_writer_fn(void *p1, void *p2, void *p3)
 							 (atomic_val_t)rc);
 					LOG_ERR("bin: flash write at %ld "
 						"failed (%d)", (long)off, rc);
+					/* The slot may be half-programmed. */
+					g_bin_ctx.erased_ahead = 0;
 				} else {
+					bin_stats_write(t0, 1, len);
 					g_bin_ctx.write_offset =
 						off + BIN_FRAME_SIZE;
+					if (boost != BIN_BOOST_NOT_SEEN &&
+					    buf_seq >= (uint32_t)boost) {
+						g_bin_ctx.post_boost++;
+					}
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+					if (g_bin_ctx.index_on &&
+					    bin_index_note(&bin_ix, bh,
+						(uint32_t)(off / BIN_FRAME_SIZE))) {
+						(void)bin_index_persist(
+							g_bin_ctx.fa);
+					}
+#endif
 				}
 			}
 		}
@@ -265,19 +488,28 @@ static void bin_frame_init(struct bin_ctx *ctx, struct bin_buf *b)
 	h->version     = AURORA_BIN_VERSION;
 	h->reserved0   = 0;
 	h->reserved1   = 0;
-	h->seq         = ctx->next_seq++;
 	h->flight_id   = ctx->flight_id;
 	h->base_ts_ns  = k_ticks_to_ns_floor64(k_uptime_ticks());
 
 	b->used = BIN_HDR_SIZE;
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+	b->crc = 0;
+#endif
+#if defined(CONFIG_DATA_LOGGER_BIN_PACKED)
+	bin_codec_reset(&ctx->codec);
+#endif
 }
 
 /* Take the next free buffer for the producer and start a new frame in it. */
 static int bin_take_free(struct bin_ctx *ctx, k_timeout_t to)
 {
 	int idx;
-	int rc = k_msgq_get(&bin_free_q, &idx, to);
+	int rc = k_msgq_get(&bin_free_q, &idx, K_NO_WAIT);
 
+	if (rc != 0 && !K_TIMEOUT_EQ(to, K_NO_WAIT)) {
+		bin_stats_stall();
+		rc = k_msgq_get(&bin_free_q, &idx, to);
+	}
 	if (rc != 0) {
 		return rc;
 	}
@@ -287,14 +519,100 @@ static int bin_take_free(struct bin_ctx *ctx, k_timeout_t to)
 	return 0;
 }
 
-/* Submit the active buffer (always non-empty, contains at least the header)
- * to the writer and pick up a fresh one.
+/* Stamp buffer @p idx with the next seq and queue it for the writer. */
+static int bin_submit(struct bin_ctx *ctx, int idx)
+{
+	struct bin_buf *b = &bin_bufs[idx];
+	struct aurora_bin_frame_header *h =
+		(struct aurora_bin_frame_header *)b->data;
+
+	h->seq = ctx->next_seq;
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+	bin_codec_crc_seal(b->data, BIN_FRAME_SIZE, b->used, b->crc);
+#endif
+	if (k_msgq_put(&bin_flush_q, &idx, K_NO_WAIT) != 0) {
+		return -EBUSY;
+	}
+	ctx->next_seq++;
+	bin_stats_queued(k_msgq_num_used_get(&bin_flush_q));
+	return 0;
+}
+
+#if BIN_PRE_FRAMES > 0
+static void bin_recycle(int idx)
+{
+	bin_bufs[idx].used = 0;
+	(void)k_msgq_put(&bin_free_q, &idx, K_NO_WAIT);
+}
+
+/* Whether filled frames go to the history ring instead of the writer. */
+static bool bin_pre_parking(const struct bin_ctx *ctx)
+{
+	return !ctx->closing &&
+	       atomic_get(&ctx->boost_seq_or_max) == BIN_BOOST_NOT_SEEN;
+}
+
+/* Park @p idx as the newest history frame.  A full ring first evicts
+ * its oldest frame, which is written if it is the first of every
+ * PRETRIGGER_DECIMATE evictions and recycled otherwise.
+ */
+static void bin_pre_park(struct bin_ctx *ctx, int idx)
+{
+	if (ctx->pre_count == BIN_PRE_FRAMES) {
+		int old = ctx->pre_ring[ctx->pre_tail];
+		bool keep = (ctx->pre_evicted++ %
+			     CONFIG_DATA_LOGGER_BIN_PRETRIGGER_DECIMATE) == 0U;
+
+		ctx->pre_tail = (ctx->pre_tail + 1U) % BIN_PRE_FRAMES;
+		ctx->pre_count--;
+		if (!keep || bin_submit(ctx, old) != 0) {
+			bin_recycle(old);
+		}
+	}
+
+	ctx->pre_ring[(ctx->pre_tail + ctx->pre_count) % BIN_PRE_FRAMES] = idx;
+	ctx->pre_count++;
+}
+
+/* Submit the whole history, oldest first. */
+static int bin_pre_release(struct bin_ctx *ctx)
+{
+	int rc = 0;
+
+	while (ctx->pre_count > 0U) {
+		int idx = ctx->pre_ring[ctx->pre_tail];
+
+		ctx->pre_tail = (ctx->pre_tail + 1U) % BIN_PRE_FRAMES;
+		ctx->pre_count--;
+		if (rc == 0) {
+			rc = bin_submit(ctx, idx);
+		}
+		if (rc != 0) {
+			bin_recycle(idx);
+		}
+	}
+
+	return rc;
+}
+#endif /* BIN_PRE_FRAMES > 0 */
+
+/* Hand off the active buffer (always non-empty, contains at least the
+ * header) — to the writer, or to the history ring pre-boost — and pick
+ * up a fresh one.
  */
 static int bin_rotate(struct bin_ctx *ctx)
 {
 	int idx = ctx->active_idx;
 
-	if (k_msgq_put(&bin_flush_q, &idx, K_NO_WAIT) != 0) {
+#if BIN_PRE_FRAMES > 0
+	if (bin_pre_parking(ctx)) {
+		bin_pre_park(ctx, idx);
+		return bin_take_free(ctx,
+			K_MSEC(CONFIG_DATA_LOGGER_BIN_PRODUCER_TIMEOUT_MS));
+	}
+#endif
+
+	if (bin_submit(ctx, idx) != 0) {
 		/* flush_q only fills if the writer is wedged. */
 		bin_bufs[idx].used = 0;
 		(void)atomic_cas(&g_bin_ctx.sticky_err, 0,
@@ -329,6 +647,42 @@ static int bin_drain_writer(void)
 	return 0;
 }
 
+/* Writer side of a power fail, reached once the backlog queued before
+ * the sentinel is on flash: submit the history (pre-boost) and the live
+ * frame behind it.  The producer has seen running == 0, so once it lets
+ * go of the mutex it stays away from the active buffer.
+ */
+static void bin_pf_commit(void)
+{
+	struct bin_ctx *ctx = &g_bin_ctx;
+
+	if (!atomic_get(&g_bin_open) || ctx->owner == NULL) {
+		return;
+	}
+
+	if (k_mutex_lock(&ctx->owner->state->mutex,
+			 K_MSEC(CONFIG_DATA_LOGGER_POWERFAIL_LOCK_MS)) != 0) {
+		LOG_WRN("bin: power fail, live frame still in use");
+		return;
+	}
+
+	if (ctx->active_idx >= 0 && atomic_get(&ctx->sticky_err) == 0) {
+#if BIN_PRE_FRAMES > 0
+		(void)bin_pre_release(ctx);
+#endif
+		if (bin_bufs[ctx->active_idx].used > BIN_HDR_SIZE &&
+		    bin_submit(ctx, ctx->active_idx) == 0 &&
+		    bin_take_free(ctx, K_NO_WAIT) != 0) {
+			/* Only reachable with every buffer in flight. */
+			ctx->active_idx = -1;
+			(void)atomic_cas(&ctx->sticky_err, 0,
+					 (atomic_val_t)-ENOBUFS);
+		}
+	}
+
+	k_mutex_unlock(&ctx->owner->state->mutex);
+}
+
 /* -------------------------------------------------------------------------- */
 /*  Formatter vtable                                                          */
 /* -------------------------------------------------------------------------- */
@@ -367,16 +721,33 @@ static int bin_init(struct data_logger *logger, const char *path)
 	ctx->flight_id    = k_ticks_to_ns_floor64(k_uptime_ticks());
 	ctx->next_seq     = 0;
 	ctx->write_offset = 0;
-	ctx->ring_frames  = (uint32_t)(BIN_FLASH_AREA_SIZE / BIN_FRAME_SIZE);
+	ctx->ring_frames  = (uint32_t)(BIN_RING_BYTES / BIN_FRAME_SIZE);
 	ctx->active_idx   = -1;
 	atomic_set(&ctx->boost_seq_or_max, BIN_BOOST_NOT_SEEN);
+	bin_stats_open(BIN_BUF_TOTAL);
+
+	atomic_set(&bin_pf, 0);
+	k_sem_reset(&bin_pf_resume);
+
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+	/* A stale index from the previous flight must never be trusted:
+	 * blank the slot now, the first entry rewrites it.
+	 */
+	bin_index_reset(&bin_ix, ctx->flight_id, ctx->ring_frames);
+	rc = flash_area_erase(ctx->fa, BIN_RING_BYTES, BIN_FRAME_SIZE);
+	ctx->index_on = (rc == 0);
+	if (rc != 0) {
+		LOG_WRN("bin: index slot erase failed (%d), "
+			"logging without index", rc);
+	}
+#endif
 
 	/* Drop any leftovers from a prior aborted session and re-prime the
 	 * free pool with every buffer.
 	 */
 	while (k_msgq_get(&bin_flush_q, &idx, K_NO_WAIT) == 0) { }
 	while (k_msgq_get(&bin_free_q,  &idx, K_NO_WAIT) == 0) { }
-	for (int i = 0; i < BIN_BUF_COUNT; i++) {
+	for (int i = 0; i < BIN_BUF_TOTAL; i++) {
 		bin_bufs[i].used = 0;
 		(void)k_msgq_put(&bin_free_q, &i, K_NO_WAIT);
 	}
@@ -389,6 +760,8 @@ static int bin_init(struct data_logger *logger, const char *path)
 		return rc;
 	}
 
+	atomic_set(&ctx->ahead_enabled, 1);
+	ctx->owner  = logger;
 	logger->ctx = ctx;
 	return 0;
 }
@@ -404,6 +777,63 @@ static int bin_write_header(struct data_logger *logger)
 	return 0;
 }
 
+#if defined(CONFIG_DATA_LOGGER_BIN_PACKED)
+#define BIN_REC_ROOM BIN_CODEC_REC_MAX
+#else
+#define BIN_REC_ROOM BIN_REC_SIZE
+#endif
+
+/* Append @p dp to @p b; the caller has checked for BIN_REC_ROOM bytes. */
+static int bin_put(struct bin_ctx *ctx, struct bin_buf *b,
+		   const struct datapoint *dp)
+{
+	const struct aurora_bin_frame_header *h =
+		(const struct aurora_bin_frame_header *)b->data;
+
+#if defined(CONFIG_DATA_LOGGER_BIN_PACKED)
+	int n = bin_codec_encode(&ctx->codec, h->base_ts_ns, dp,
+				 b->data + b->used);
+
+	if (n < 0) {
+		return n;
+	}
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+	b->crc = bin_codec_crc_add(b->crc, b->data + b->used, (size_t)n);
+#endif
+	b->used += (size_t)n;
+	return 0;
+#else
+	ARG_UNUSED(ctx);
+
+	struct aurora_bin_record *rec =
+		(struct aurora_bin_record *)(b->data + b->used);
+
+	uint64_t delta_ns = dp->timestamp_ns >= h->base_ts_ns
+		? dp->timestamp_ns - h->base_ts_ns : 0;
+
+	rec->type          = (uint8_t)dp->type;
+	rec->channel_count = dp->channel_count;
+	rec->reserved      = 0;
+	rec->ts_delta_us   = (uint32_t)(delta_ns / 1000U);
+
+	for (int i = 0; i < DP_MAX_CHANNELS; i++) {
+		if (i < dp->channel_count) {
+			rec->channels[i].val1 = dp->channels[i].val1;
+			rec->channels[i].val2 = dp->channels[i].val2;
+		} else {
+			rec->channels[i].val1 = 0;
+			rec->channels[i].val2 = 0;
+		}
+	}
+
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+	b->crc = bin_codec_crc_add(b->crc, rec, BIN_REC_SIZE);
+#endif
+	b->used += BIN_REC_SIZE;
+	return 0;
+#endif
+}
+
 static int bin_write_datapoint(struct data_logger *logger,
 			       const struct datapoint *dp)
 {
@@ -416,7 +846,7 @@ static int bin_write_datapoint(struct data_logger *logger,
 
 	struct bin_buf *b = &bin_bufs[ctx->active_idx];
 
-	if (b->used + BIN_REC_SIZE > BIN_FRAME_SIZE) {
+	if (b->used + BIN_REC_ROOM > BIN_PAYLOAD_END) {
 		int rc = bin_rotate(ctx);
 
 		if (rc != 0) {
@@ -425,32 +855,122 @@ static int bin_write_datapoint(struct data_logger *logger,
 		b = &bin_bufs[ctx->active_idx];
 	}
 
-	struct aurora_bin_frame_header *h =
-		(struct aurora_bin_frame_header *)b->data;
+	return bin_put(ctx, b, dp);
+}
+
+/* Batch path: the sticky error is sampled once per call and the active
+ * buffer is looked up once per frame, so the inner loop is a room
+ * compare plus the record copy.
+ */
+static int bin_write_datapoints(struct data_logger *logger,
+				const struct datapoint *dps, size_t n)
+{
+	struct bin_ctx *ctx = logger->ctx;
+	int err = (int)atomic_get(&ctx->sticky_err);
+	size_t i = 0;
+
+	if (err != 0) {
+		return err;
+	}
+
+	while (i < n) {
+		struct bin_buf *b = &bin_bufs[ctx->active_idx];
+
+		if (b->used + BIN_REC_ROOM > BIN_PAYLOAD_END) {
+			int rc = bin_rotate(ctx);
+
+			if (rc != 0) {
+				return rc;
+			}
+			continue;
+		}
+
+		do {
+			int rc = bin_put(ctx, b, &dps[i++]);
+
+			if (rc != 0) {
+				return rc;
+			}
+		} while (i < n && b->used + BIN_REC_ROOM <= BIN_PAYLOAD_END);
+	}
+
+	return 0;
+}
+
+#if !defined(CONFIG_DATA_LOGGER_BIN_PACKED)
+/* Zero-copy producer path: hand out the next record slot of the active
+ * buffer.  Never waits — if the frame is full and no free buffer is
+ * queued, the caller falls back to the copying path instead.
+ */
+static int bin_reserve(struct data_logger *logger, uint64_t timestamp_ns,
+		       struct aurora_bin_record **out)
+{
+	struct bin_ctx *ctx = logger->ctx;
+	int err = (int)atomic_get(&ctx->sticky_err);
+
+	if (err != 0) {
+		return err;
+	}
+
+	struct bin_buf *b = &bin_bufs[ctx->active_idx];
+
+	if (b->used + BIN_REC_SIZE > BIN_PAYLOAD_END) {
+		if (k_msgq_num_used_get(&bin_free_q) == 0U) {
+			return -EAGAIN;
+		}
+
+		int rc = bin_rotate(ctx);
+
+		if (rc != 0) {
+			return rc;
+		}
+		b = &bin_bufs[ctx->active_idx];
+	}
+
+	const struct aurora_bin_frame_header *h =
+		(const struct aurora_bin_frame_header *)b->data;
 	struct aurora_bin_record *rec =
 		(struct aurora_bin_record *)(b->data + b->used);
+	uint64_t delta_ns = timestamp_ns >= h->base_ts_ns
+		? timestamp_ns - h->base_ts_ns : 0;
 
-	uint64_t delta_ns = dp->timestamp_ns >= h->base_ts_ns
-		? dp->timestamp_ns - h->base_ts_ns : 0;
+	rec->reserved    = 0;
+	rec->ts_delta_us = (uint32_t)(delta_ns / 1000U);
 
-	rec->type          = (uint8_t)dp->type;
-	rec->channel_count = dp->channel_count;
-	rec->reserved      = 0;
-	rec->ts_delta_us   = (uint32_t)(delta_ns / 1000U);
+	*out = rec;
+	return 0;
+}
 
-	for (int i = 0; i < DP_MAX_CHANNELS; i++) {
-		if (i < dp->channel_count) {
-			rec->channels[i].val1 = dp->channels[i].val1;
-			rec->channels[i].val2 = dp->channels[i].val2;
-		} else {
-			rec->channels[i].val1 = 0;
-			rec->channels[i].val2 = 0;
-		}
+static int bin_commit(struct data_logger *logger, struct aurora_bin_record *rec)
+{
+	struct bin_ctx *ctx = logger->ctx;
+	struct bin_buf *b = &bin_bufs[ctx->active_idx];
+
+	if ((uint8_t *)rec != b->data + b->used) {
+		return -EINVAL;
+	}
+
+	if (rec->type >= AURORA_DATA_COUNT) {
+		/* Put the slot back to its erased state: it ends the frame. */
+		memset(rec, 0xFF, sizeof(*rec));
+		return -EINVAL;
 	}
 
+	if (rec->channel_count > DP_MAX_CHANNELS) {
+		rec->channel_count = DP_MAX_CHANNELS;
+	}
+	for (int i = rec->channel_count; i < DP_MAX_CHANNELS; i++) {
+		rec->channels[i].val1 = 0;
+		rec->channels[i].val2 = 0;
+	}
+
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+	b->crc = bin_codec_crc_add(b->crc, rec, BIN_REC_SIZE);
+#endif
 	b->used += BIN_REC_SIZE;
 	return 0;
 }
+#endif /* !CONFIG_DATA_LOGGER_BIN_PACKED */
 
 static int bin_flush(struct data_logger *logger)
 {
@@ -461,7 +981,8 @@ static int bin_flush(struct data_logger *logger)
 	 * pick up a fresh one. The partial frame's tail stays 0xFF so the
 	 * converter stops at the first unwritten record slot.
 	 */
-	if (bin_bufs[ctx->active_idx].used > BIN_HDR_SIZE) {
+	if (ctx->active_idx >= 0 &&
+	    bin_bufs[ctx->active_idx].used > BIN_HDR_SIZE) {
 		rc = bin_rotate(ctx);
 		if (rc != 0) {
 			LOG_ERR("bin_flush: rotate failed (%d)", rc);
@@ -480,6 +1001,19 @@ static int bin_flush(struct data_logger *logger)
 	return err;
 }
 
+/* Index the frame the producer is filling; it is submitted next, so it
+ * gets next_seq (after any history release).
+ */
+static inline void bin_mark(struct bin_ctx *ctx, enum aurora_bin_mark mark)
+{
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+	bin_index_mark(&bin_ix, mark, ctx->next_seq);
+#else
+	ARG_UNUSED(ctx);
+	ARG_UNUSED(mark);
+#endif
+}
+
 /* DLE_BOOST: capture the seq number of the next-to-be-written frame.
  * From here on the writer thread treats the partition as linear-with-cap
  * — it keeps wrapping forward until ring_frames post-boost frames have
@@ -503,27 +1037,91 @@ static int bin_on_event(struct data_logger *logger, enum data_logger_event ev)
 
 	switch (ev) {
 	case DLE_BOOST:
-		(void)atomic_cas(&ctx->boost_seq_or_max, BIN_BOOST_NOT_SEEN,
-				 (atomic_val_t)ctx->next_seq);
+		if (!atomic_cas(&ctx->boost_seq_or_max, BIN_BOOST_NOT_SEEN,
+				(atomic_val_t)ctx->next_seq)) {
+			break;
+		}
 		LOG_INF("bin: BOOST captured at seq=%u", ctx->next_seq);
+#if BIN_PRE_FRAMES > 0
+		/* The history goes out first, so it counts as post-boost
+		 * and sits under the cap's protection.
+		 */
+		if (bin_pre_release(ctx) != 0) {
+			LOG_WRN("bin: pre-trigger history partly dropped");
+		}
+#endif
+		bin_mark(ctx, AURORA_BIN_MARK_BOOST);
+		break;
+	case DLE_APOGEE:
+		LOG_INF("bin: APOGEE at seq=%u", ctx->next_seq);
+		bin_mark(ctx, AURORA_BIN_MARK_APOGEE);
 		break;
 	case DLE_LANDED:
 		LOG_INF("bin: LANDED at seq=%u", ctx->next_seq);
+		bin_mark(ctx, AURORA_BIN_MARK_LANDED);
 		break;
 	}
 
 	return 0;
 }
 
+/* PFM interrupt: stop erase-ahead, arm the write budget and queue the
+ * sentinel that makes the writer take over the live frame.  Frames
+ * already queued stay ahead of it, so flash still gets a contiguous seq
+ * run.  On recovery the writer resumes where it parked.
+ */
+static int bin_powerfail(struct data_logger *logger, bool asserted)
+{
+	struct bin_ctx *ctx = logger->ctx;
+	int sentinel = BIN_PF_SENTINEL;
+
+	if (!asserted) {
+		if (atomic_cas(&bin_pf, 1, 0)) {
+			if (atomic_get(&bin_pf_ahead)) {
+				atomic_set(&ctx->ahead_enabled, 1);
+			}
+			k_sem_give(&bin_pf_resume);
+		}
+		return 0;
+	}
+
+	if (atomic_get(&bin_pf)) {
+		return 0;
+	}
+
+	bin_pf_deadline = k_uptime_get() +
+			  CONFIG_DATA_LOGGER_POWERFAIL_BUDGET_MS;
+	k_sem_reset(&bin_pf_resume);
+	atomic_set(&bin_pf_ahead, atomic_set(&ctx->ahead_enabled, 0));
+	atomic_set(&bin_pf, 1);
+
+	return k_msgq_put(&bin_flush_q, &sentinel, K_NO_WAIT) == 0
+		? 0 : -EBUSY;
+}
+
 static int bin_close(struct data_logger *logger)
 {
 	struct bin_ctx *ctx = logger->ctx;
 
 	/* Drain whatever's still buffered. Keep going on flush errors so we
-	 * still close the partition and release the active buffer.
+	 * still close the partition and release the active buffer.  The
+	 * drain also waits out any erase-ahead step already in progress.
 	 */
+	atomic_set(&ctx->ahead_enabled, 0);
+#if BIN_PRE_FRAMES > 0
+	/* No BOOST is coming any more: write the history out too. */
+	ctx->closing = true;
+	(void)bin_pre_release(ctx);
+#endif
 	(void)bin_flush(logger);
 
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+	/* The writer is idle after the drain; record the final latest_seq. */
+	if (ctx->index_on) {
+		(void)bin_index_persist(ctx->fa);
+	}
+#endif
+
 	if (ctx->fa != NULL) {
 		flash_area_close(ctx->fa);
 		ctx->fa = NULL;
@@ -541,13 +1139,49 @@ static int bin_close(struct data_logger *logger)
 	return 0;
 }
 
+#if defined(CONFIG_DATA_LOGGER_BIN_STATIC_DISPATCH)
+/* bin_live_write – see bin_live.h */
+int bin_live_write(struct data_logger *logger, const struct datapoint *dp)
+{
+	return bin_write_datapoint(logger, dp);
+}
+
+/* bin_live_write_batch – see bin_live.h */
+int bin_live_write_batch(struct data_logger *logger,
+			 const struct datapoint *dps, size_t n)
+{
+	return bin_write_datapoints(logger, dps, n);
+}
+
+#if defined(CONFIG_DATA_LOGGER_BIN_ZERO_COPY)
+/* bin_live_reserve – see bin_live.h */
+int bin_live_reserve(struct data_logger *logger, uint64_t timestamp_ns,
+		     struct aurora_bin_record **rec)
+{
+	return bin_reserve(logger, timestamp_ns, rec);
+}
+
+/* bin_live_commit – see bin_live.h */
+int bin_live_commit(struct data_logger *logger, struct aurora_bin_record *rec)
+{
+	return bin_commit(logger, rec);
+}
+#endif /* CONFIG_DATA_LOGGER_BIN_ZERO_COPY */
+#endif /* CONFIG_DATA_LOGGER_BIN_STATIC_DISPATCH */
+
 const struct data_logger_formatter data_logger_bin_formatter = {
 	.init            = bin_init,
 	.write_header    = bin_write_header,
 	.write_datapoint = bin_write_datapoint,
+	.write_datapoints = bin_write_datapoints,
 	.flush           = bin_flush,
 	.close           = bin_close,
 	.on_event        = bin_on_event,
+	.powerfail       = bin_powerfail,
+#if !defined(CONFIG_DATA_LOGGER_BIN_PACKED)
+	.reserve         = bin_reserve,
+	.commit          = bin_commit,
+#endif
 	.file_ext        = "bin",
 	.name            = "bin",
 };
@@ -588,17 +1222,104 @@ int bin_io_read(off_t off, void *buf, size_t len)
 
 size_t bin_io_total_size(void)
 {
-	return (size_t)BIN_FLASH_AREA_SIZE;
+	return (size_t)BIN_RING_BYTES;
+}
+
+/* Returns 0 if ring slot @p slot holds frame @p seq of @p flight_id,
+ * positive if it holds anything else, negative on read error.
+ */
+static int bin_io_slot_is(uint32_t slot, uint64_t flight_id, uint32_t seq)
+{
+	struct aurora_bin_frame_header h;
+	int rc = flash_area_read(g_convert_fa,
+				 (off_t)slot * (off_t)BIN_FRAME_SIZE,
+				 &h, sizeof(h));
+
+	if (rc != 0) {
+		return rc;
+	}
+	return (memcmp(h.magic, AURORA_BIN_FRAME_MAGIC, sizeof(h.magic)) == 0 &&
+		bin_codec_version_supported(h.version) &&
+		h.flight_id == flight_id && h.seq == seq) ? 0 : 1;
+}
+
+/* First slot j in [lo, hi) whose "holds seq base + j" answer is @p want,
+ * for a run that flips that answer at most once.  *out = hi if none.
+ */
+static int bin_io_search(uint32_t lo, uint32_t hi, uint64_t flight_id,
+			 uint32_t base, bool want, uint32_t *out)
+{
+	while (lo < hi) {
+		uint32_t mid = lo + (hi - lo) / 2U;
+		int rc = bin_io_slot_is(mid, flight_id, base + mid);
+
+		if (rc < 0) {
+			return rc;
+		}
+		if ((rc == 0) == want) {
+			hi = mid;
+		} else {
+			lo = mid + 1U;
+		}
+	}
+
+	*out = lo;
+	return 0;
 }
 
+/* Every flight starts writing at slot 0, so slot 0 names the newest
+ * flight.  Once the ring has wrapped, slot j holds seq s0 + j up to the
+ * write head, then possibly a few erased-ahead slots, then seq
+ * s0 - ring + j up to the end: two binary searches over the headers
+ * find the oldest surviving frame in O(log ring) reads.
+ */
 int bin_io_window_start_hint(off_t *out_offset,
 			     uint32_t *out_seq,
 			     uint64_t *out_flight_id)
 {
-	ARG_UNUSED(out_offset);
-	ARG_UNUSED(out_seq);
-	ARG_UNUSED(out_flight_id);
+	const uint32_t ring = (uint32_t)(BIN_RING_BYTES / BIN_FRAME_SIZE);
+	struct aurora_bin_frame_header h0;
+	uint32_t head;
+	uint32_t start;
+	int rc;
 
-	/* Circular ring: window start can be anywhere in the partition. */
-	return -ENOTSUP;
+	if (g_convert_fa == NULL) {
+		return -ENODEV;
+	}
+
+	rc = flash_area_read(g_convert_fa, 0, &h0, sizeof(h0));
+	if (rc != 0) {
+		LOG_ERR("bin_io: hint read at 0 failed (%d)", rc);
+		return rc;
+	}
+
+	/* Nothing at slot 0 (or a layout this search can't explain):
+	 * let the converter look everywhere.
+	 */
+	if (memcmp(h0.magic, AURORA_BIN_FRAME_MAGIC, sizeof(h0.magic)) != 0 ||
+	    !bin_codec_version_supported(h0.version) || h0.seq % ring != 0U) {
+		return -ENOTSUP;
+	}
+
+	*out_offset    = 0;
+	*out_seq       = h0.seq;
+	*out_flight_id = h0.flight_id;
+	if (h0.seq == 0U) {
+		return 0; /* never wrapped */
+	}
+
+	rc = bin_io_search(1, ring, h0.flight_id, h0.seq, false, &head);
+	if (rc == 0) {
+		rc = bin_io_search(head, ring, h0.flight_id, h0.seq - ring,
+				   true, &start);
+	}
+	if (rc != 0) {
+		return rc;
+	}
+
+	if (start < ring) {
+		*out_offset = (off_t)start * (off_t)BIN_FRAME_SIZE;
+		*out_seq    = h0.seq - ring + start;
+	}
+	return 0;
 }
@@ -50,6 +50,55 @@
  * identical to the flash backend, so the converter walks both with
  * the same algorithm.
  *
+ * With CONFIG_DATA_LOGGER_BIN_ADAPTIVE_BATCH the batch cap moves at
+ * runtime: it halves after a write slower than the latency target and
+ * grows by one frame while the backlog keeps up with it.  Batches are
+ * also cut at the card's erase-block boundary (DISK_IOCTL_GET_ERASE_
+ * BLOCK_SZ), so the following writes start on one.
+ *
+ * With CONFIG_DATA_LOGGER_BIN_DISK_INFLIGHT = 2 a second writer thread
+ * (lane) issues the next batch while the first is still transferring.
+ * disk_access has no asynchronous write, so that request waits inside
+ * the driver and starts as soon as the bus is free, without a writer
+ * wake-up in between.  Ring slots are only released once every earlier
+ * batch has completed, so @c tail still moves strictly in order.
+ *
+ * On a power fail (data_logger_powerfail()) a lane commits the live
+ * frame into the ring without waiting for space, and no batch is issued
+ * once CONFIG_DATA_LOGGER_POWERFAIL_BUDGET_MS is up.
+ *
+ * With CONFIG_DATA_LOGGER_BIN_COLUMNAR the producer instead keeps one
+ * staging frame per data type and fills it column-wise; a staging
+ * frame is copied into the ring head slot (and assigned the next seq)
+ * only when it is full, its channel count changes, or on flush.  Every
+ * staging frame opened before it goes out first, so frames reach the
+ * ring in order of their first timestamp and the converter can merge
+ * the types back into time order holding one frame per type.
+ *
+ * With CONFIG_DATA_LOGGER_DISK_SESSIONS flights no longer start over at
+ * the region offset: frame slot 0 holds a catalogue of every flight
+ * kept, each new flight is appended after the previous one, and a
+ * flight cut short by a reset gets its length recovered on the next
+ * init.
+ *
+ * With CONFIG_DATA_LOGGER_BIN_INDEX the last frame of the region is
+ * reserved for the frame index (bin_index.h); the writer rewrites it
+ * after each batch that adds an entry, and once more on close.
+ *
+ * With CONFIG_DATA_LOGGER_BIN_MIRROR every committed frame is also
+ * offered to the flash mirror (bin_mirror.c), which has a queue and a
+ * writer thread of its own.  A failed card write then no longer stops
+ * the producer: the card is given up for the rest of the flight, its
+ * batches are retired unwritten, and the frames keep flowing to flash.
+ *
+ * With CONFIG_DATA_LOGGER_CONVERT_TRAIL, bin_io_live() reports how far
+ * the retired batches reach, so the converter can follow the flight
+ * while it is still being written.
+ *
+ * With CONFIG_DATA_LOGGER_DISK_BENCH, data_logger_disk_bench() writes
+ * and reads back the end of the region through the ring buffer, in the
+ * writer's batch size, while no logger is open.
+ *
  * Copyright (c) 2026 Auxspace e.V.
  *
  * SPDX-License-Identifier: Apache-2.0
@@ -67,8 +116,16 @@
 
 #include <aurora/lib/data_logger.h>
 #include <aurora/lib/disk_led.h>
+#include <aurora/lib/ram.h>
 
+#include "bin_codec.h"
 #include "bin_io.h"
+#include "bin_live.h"
+#include "bin_mirror.h"
+#include "bin_stats.h"
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+#include "bin_index.h"
+#endif
 
 LOG_MODULE_DECLARE(data_logger, CONFIG_DATA_LOGGER_LOG_LEVEL);
 
@@ -100,14 +157,18 @@ LOG_MODULE_DECLARE(data_logger, CONFIG_DATA_LOGGER_LOG_LEVEL);
 #define BIN_REC_SIZE         ((size_t)sizeof(struct aurora_bin_record))
 #define BIN_HDR_SIZE         ((size_t)sizeof(struct aurora_bin_frame_header))
 #define BIN_FRAME_SIZE       ((size_t)CONFIG_DATA_LOGGER_BIN_FRAME_SIZE)
+#define BIN_PAYLOAD_END      (BIN_FRAME_SIZE - BIN_CODEC_CRC_SIZE)
 #define BIN_BUF_ALIGN        CONFIG_DATA_LOGGER_BIN_BUF_ALIGN
 #define BIN_RING_FRAMES      ((uint32_t)CONFIG_DATA_LOGGER_BIN_RING_FRAMES)
 #define BIN_RING_MASK        (BIN_RING_FRAMES - 1U)
 #define BIN_RING_BYTES       (BIN_RING_FRAMES * BIN_FRAME_SIZE)
 #define BIN_MAX_BATCH_FRAMES ((uint32_t)CONFIG_DATA_LOGGER_BIN_MAX_BATCH_FRAMES)
+#define BIN_INDEX_FRAMES     (IS_ENABLED(CONFIG_DATA_LOGGER_BIN_INDEX) ? 1U : 0U)
 
-BUILD_ASSERT(BIN_FRAME_SIZE >= BIN_HDR_SIZE + BIN_REC_SIZE,
+BUILD_ASSERT(BIN_PAYLOAD_END >= BIN_HDR_SIZE + BIN_REC_SIZE,
 	     "frame must hold at least one header + one record");
+BUILD_ASSERT(BIN_PAYLOAD_END >= BIN_HDR_SIZE + BIN_CODEC_REC_MAX,
+	     "frame must hold at least one worst-case packed record");
 BUILD_ASSERT((BIN_FRAME_SIZE - BIN_HDR_SIZE) % BIN_REC_SIZE == 0,
 	     "frame payload should be a whole number of records");
 BUILD_ASSERT(BIN_RING_FRAMES >= 2U,
@@ -117,25 +178,68 @@ BUILD_ASSERT((BIN_RING_FRAMES & BIN_RING_MASK) == 0U,
 BUILD_ASSERT(BIN_MAX_BATCH_FRAMES >= 1U,
 	     "BIN_MAX_BATCH_FRAMES must be at least 1");
 
-static uint8_t bin_ring[BIN_RING_BYTES] __aligned(BIN_BUF_ALIGN);
+/* The ring the card DMA reads from; in the DMA RAM region when the
+ * board has one (CONFIG_AURORA_RAM_DMA).
+ */
+static uint8_t bin_ring[BIN_RING_BYTES] __aurora_dma __aligned(BIN_BUF_ALIGN);
 
 static inline uint8_t *frame_ptr(uint32_t idx)
 {
 	return &bin_ring[(idx & BIN_RING_MASK) * BIN_FRAME_SIZE];
 }
 
+#if defined(CONFIG_DATA_LOGGER_BIN_COLUMNAR)
+BUILD_ASSERT(AURORA_BIN_COL_CAPACITY(BIN_PAYLOAD_END, DP_MAX_CHANNELS) >= 1U,
+	     "frame must hold at least one full-width columnar record");
+BUILD_ASSERT(AURORA_BIN_COL_CAPACITY(BIN_FRAME_SIZE, 0) <= UINT16_MAX,
+	     "columnar record count must fit the 16-bit tag field");
+
+/* One open single-type frame per enum aurora_data. */
+static uint8_t bin_col_stage[AURORA_DATA_COUNT][BIN_FRAME_SIZE]
+	__aligned(4);
+#endif
+
 struct bin_disk_ctx {
+	struct data_logger *owner;  /* for the power-fail handover */
 	uint64_t flight_id;
 	uint32_t next_seq;          /* producer side */
 	uint32_t cur_sector_offset; /* writer side: sectors past disk offset */
+	uint32_t first_sec;         /* where this flight's first frame goes */
+	uint32_t issue;             /* writer side: next frame to hand a lane */
+	uint32_t issue_sec;         /* writer side: where that frame goes */
 	uint32_t sector_size;       /* queried at init from DISK_IOCTL */
 	uint32_t sectors_per_frame; /* BIN_FRAME_SIZE / sector_size */
 	uint32_t offset_sec;        /* derived: BIN_DISK_OFFSET_BYTES / sector_size */
-	uint32_t size_sec;          /* derived: BIN_DISK_SIZE_BYTES / sector_size */
+	uint32_t size_sec;          /* derived: data sectors, less the index frame */
 	size_t   prod_used;         /* bytes filled in the slot at head */
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+	uint32_t prod_crc;          /* payload CRC of the head frame so far */
+#endif
 	atomic_t head;              /* next frame to commit (producer-owned slot) */
 	atomic_t tail;              /* next frame to write to disk */
 	atomic_t sticky_err;
+#if defined(CONFIG_DATA_LOGGER_BIN_PACKED)
+	struct bin_codec_state codec; /* delta state of the head frame */
+#endif
+#if defined(CONFIG_DATA_LOGGER_BIN_COLUMNAR)
+	uint16_t col_count[AURORA_DATA_COUNT];    /* 0 = stage not open */
+	uint16_t col_cap[AURORA_DATA_COUNT];
+	uint8_t  col_channels[AURORA_DATA_COUNT];
+#endif
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+	bool     index_on;          /* index slot blanked at init */
+#endif
+#if defined(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+	uint16_t session;           /* catalogue entry of this flight */
+#endif
+#if defined(CONFIG_DATA_LOGGER_BIN_ADAPTIVE_BATCH)
+	uint32_t batch_limit;       /* writer side: current batch cap */
+	uint32_t unit_sec;          /* erase block in sectors, 0 = ignore */
+#endif
+#if defined(CONFIG_DATA_LOGGER_BIN_MIRROR)
+	bool     mirror_critical;   /* head frame holds a critical record */
+	atomic_t disk_lost;         /* a card write failed, flash only */
+#endif
 };
 
 static struct bin_disk_ctx g_bin_ctx;
@@ -149,14 +253,475 @@ K_SEM_DEFINE(bin_space_sem, 0, K_SEM_MAX_LIMIT);
 K_SEM_DEFINE(bin_drain_sem, 0, 1);
 static atomic_t bin_drain_req = ATOMIC_INIT(0);
 
+#define BIN_LANES CONFIG_DATA_LOGGER_BIN_DISK_INFLIGHT
+
+/* Power-fail state, set by bin_powerfail() from the PFM interrupt.  While
+ * bin_pf is set the lanes run at POWERFAIL_WRITER_PRIO, the first lane
+ * to see bin_pf_req commits the live frame, and past bin_pf_deadline no
+ * lane issues another batch until bin_pf_resume is given.
+ */
+static atomic_t bin_pf = ATOMIC_INIT(0);
+static atomic_t bin_pf_req = ATOMIC_INIT(0);
+static int64_t bin_pf_deadline;
+K_SEM_DEFINE(bin_pf_resume, 0, BIN_LANES);
+
+/* A run of ring frames handed to one disk_access_write(). */
+struct bin_batch {
+	uint32_t first;             /* ring counter of its first frame */
+	uint32_t frames;
+	uint32_t sec;               /* sectors past the region offset */
+#if defined(CONFIG_DATA_LOGGER_BIN_ADAPTIVE_BATCH)
+	uint32_t lat_us;
+#endif
+	int      rc;
+	bool     done;
+};
+
+/* Batches in flight, oldest at bin_batch_tail; guarded by bin_lane_lock. */
+static struct bin_batch bin_batches[BIN_LANES];
+static uint32_t bin_batch_head;
+static uint32_t bin_batch_tail;
+static K_MUTEX_DEFINE(bin_lane_lock);
+
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+static struct bin_index bin_ix;
+
+/* The index slot follows the data sectors.  Failures only cost the
+ * index, not the log.
+ */
+static int bin_index_persist(const struct bin_disk_ctx *ctx, const void *buf)
+{
+	int rc = disk_access_write(BIN_DISK_NAME, buf,
+				   ctx->offset_sec + ctx->size_sec,
+				   ctx->sectors_per_frame);
+
+	if (rc != 0) {
+		LOG_WRN("bin_disk: index write failed (%d)", rc);
+	}
+	return rc;
+}
+
+/* Writer side: frames [tail, tail + batch) landed at sector @p sec. */
+static void bin_index_batch(uint32_t tail, uint32_t batch, uint32_t sec)
+{
+	uint32_t slot  = sec / g_bin_ctx.sectors_per_frame;
+	bool     dirty = false;
+
+	if (!g_bin_ctx.index_on) {
+		return;
+	}
+
+	for (uint32_t i = 0; i < batch; i++) {
+		dirty |= bin_index_note(&bin_ix,
+			(const struct aurora_bin_frame_header *)
+			frame_ptr(tail + i), slot + i);
+	}
+	if (dirty) {
+		(void)bin_index_persist(&g_bin_ctx, bin_ix.buf);
+	}
+}
+#endif
+
+#if defined(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+#define BIN_SESS_SECTOR 512U
+#define BIN_SESS_MAX    CONFIG_DATA_LOGGER_DISK_SESSIONS_MAX
+
+BUILD_ASSERT(sizeof(struct aurora_bin_session_header) +
+	     BIN_SESS_MAX * sizeof(struct aurora_bin_session_entry) <=
+	     BIN_SESS_SECTOR, "session catalogue must fit one sector");
+
+/* Writer-side catalogue image. */
+static uint8_t bin_sess_buf[BIN_SESS_SECTOR] __aligned(BIN_BUF_ALIGN);
+
+static inline struct aurora_bin_session_header *sess_hdr(uint8_t *buf)
+{
+	return (struct aurora_bin_session_header *)buf;
+}
+
+static inline struct aurora_bin_session_entry *sess_entries(uint8_t *buf)
+{
+	return (struct aurora_bin_session_entry *)
+		(buf + sizeof(struct aurora_bin_session_header));
+}
+
+static bool bin_sess_valid(const uint8_t *buf)
+{
+	const struct aurora_bin_session_header *h =
+		(const struct aurora_bin_session_header *)buf;
+
+	return memcmp(h->magic, AURORA_BIN_SESSION_MAGIC,
+		      sizeof(h->magic)) == 0 &&
+	       h->version == AURORA_BIN_SESSION_VERSION &&
+	       h->count <= BIN_SESS_MAX;
+}
+
+/* Read the catalogue at @p sector into @p buf.  A blank or foreign
+ * sector reads as an empty catalogue.
+ */
+static int bin_sess_load(uint32_t sector, uint8_t *buf)
+{
+	struct aurora_bin_session_header *h = sess_hdr(buf);
+	int rc = disk_access_read(BIN_DISK_NAME, buf, sector, 1);
+
+	if (rc != 0) {
+		LOG_ERR("bin_disk: catalogue read failed (%d)", rc);
+		return rc;
+	}
+
+	if (!bin_sess_valid(buf)) {
+		memset(buf, 0xFF, BIN_SESS_SECTOR);
+		memset(h, 0, sizeof(*h));
+		memcpy(h->magic, AURORA_BIN_SESSION_MAGIC, sizeof(h->magic));
+		h->version = AURORA_BIN_SESSION_VERSION;
+	}
+	return 0;
+}
+
+/* Returns 0 if slot @p slot holds frame @p seq of @p flight_id, positive
+ * if not, negative on read error.  Reads into ring slot 0, which is free
+ * until bin_init() opens the first frame in it.
+ */
+static int bin_disk_slot_is(const struct bin_disk_ctx *ctx, uint32_t slot,
+			    uint64_t flight_id, uint32_t seq)
+{
+	uint8_t *scratch = frame_ptr(0);
+	const struct aurora_bin_frame_header *h =
+		(const struct aurora_bin_frame_header *)scratch;
+	int rc = disk_access_read(BIN_DISK_NAME, scratch,
+				  ctx->offset_sec +
+				  slot * ctx->sectors_per_frame, 1);
+
+	if (rc != 0) {
+		return rc;
+	}
+	return (memcmp(h->magic, AURORA_BIN_FRAME_MAGIC,
+		       sizeof(h->magic)) == 0 &&
+		h->flight_id == flight_id && h->seq == seq) ? 0 : 1;
+}
+
+/* A flight cut short by a reset never recorded its length.  Its frames
+ * are the run of slots holding seq slot - first_slot; flight_ids only
+ * grow, so nothing after the run can match.
+ */
+static int bin_sess_recover(const struct bin_disk_ctx *ctx,
+			    struct aurora_bin_session_entry *e)
+{
+	uint32_t lo = e->first_slot;
+	uint32_t hi = ctx->size_sec / ctx->sectors_per_frame;
+
+	while (lo < hi) {
+		uint32_t mid = lo + (hi - lo) / 2U;
+		int rc = bin_disk_slot_is(ctx, mid, e->flight_id,
+					  mid - e->first_slot);
+
+		if (rc < 0) {
+			return rc;
+		}
+		if (rc == 0) {
+			lo = mid + 1U;
+		} else {
+			hi = mid;
+		}
+	}
+
+	e->frames = lo > e->first_slot ? lo - e->first_slot : 0U;
+	LOG_WRN("bin_disk: flight %u was not closed, recovered %u frames",
+		e->number, e->frames);
+	return 0;
+}
+
+/* Append this flight to the catalogue and point the writer at the first
+ * slot after the previous flight.
+ */
+static int bin_sess_open(struct bin_disk_ctx *ctx)
+{
+	struct aurora_bin_session_header *h = sess_hdr(bin_sess_buf);
+	struct aurora_bin_session_entry *e = sess_entries(bin_sess_buf);
+	const uint32_t slots = ctx->size_sec / ctx->sectors_per_frame;
+	uint32_t first = 1;
+	int rc;
+
+	if (ctx->sector_size != BIN_SESS_SECTOR) {
+		LOG_ERR("bin_disk: sessions need %u-byte sectors, not %u",
+			BIN_SESS_SECTOR, ctx->sector_size);
+		return -ENOTSUP;
+	}
+
+	rc = bin_sess_load(ctx->offset_sec, bin_sess_buf);
+	if (rc != 0) {
+		return rc;
+	}
+
+	if (h->count > 0U) {
+		struct aurora_bin_session_entry *last = &e[h->count - 1U];
+
+		if (last->frames == AURORA_BIN_SESSION_OPEN) {
+			rc = bin_sess_recover(ctx, last);
+			if (rc != 0) {
+				return rc;
+			}
+		}
+		first = last->first_slot + last->frames;
+		/* flight_id is an uptime stamp; keep it unique per region. */
+		if (ctx->flight_id <= last->flight_id) {
+			ctx->flight_id = last->flight_id + 1U;
+		}
+	}
+
+	if (h->count == BIN_SESS_MAX ||
+	    (uint64_t)first + CONFIG_DATA_LOGGER_DISK_SESSION_MIN_FRAMES >
+	    slots) {
+		LOG_WRN("bin_disk: no room for flight %u, dropping %u "
+			"older flight(s)", h->next_number, h->count);
+		memset(e, 0xFF, (size_t)h->count * sizeof(*e));
+		h->count = 0;
+		first = 1;
+	}
+
+	e = &e[h->count];
+	memset(e, 0, sizeof(*e));
+	e->flight_id  = ctx->flight_id;
+	e->number     = h->next_number++;
+	e->first_slot = first;
+	e->frames     = AURORA_BIN_SESSION_OPEN;
+	ctx->session  = h->count++;
+	ctx->cur_sector_offset = first * ctx->sectors_per_frame;
+
+	rc = disk_access_write(BIN_DISK_NAME, bin_sess_buf, ctx->offset_sec, 1);
+	if (rc != 0) {
+		LOG_ERR("bin_disk: catalogue write failed (%d)", rc);
+	}
+	return rc;
+}
+
+/* Record the flight's length.  The writer has drained. */
+static void bin_sess_close(const struct bin_disk_ctx *ctx)
+{
+	struct aurora_bin_session_entry *e =
+		&sess_entries(bin_sess_buf)[ctx->session];
+
+	e->frames = ctx->cur_sector_offset / ctx->sectors_per_frame -
+		    e->first_slot;
+	if (disk_access_write(BIN_DISK_NAME, bin_sess_buf,
+			      ctx->offset_sec, 1) != 0) {
+		LOG_WRN("bin_disk: catalogue update failed, flight %u is "
+			"recovered on the next init", e->number);
+	}
+}
+#endif /* CONFIG_DATA_LOGGER_DISK_SESSIONS */
+
 /* -------------------------------------------------------------------------- */
 /*  Writer thread                                                             */
 /* -------------------------------------------------------------------------- */
 
+#if defined(CONFIG_DATA_LOGGER_BIN_ADAPTIVE_BATCH)
+/* Cap @p batch at the current limit, and end it at the next erase-block
+ * boundary if it would cross one.
+ */
+static uint32_t bin_batch_trim(const struct bin_disk_ctx *ctx, uint32_t batch)
+{
+	batch = MIN(batch, ctx->batch_limit);
+
+	if (ctx->unit_sec != 0U) {
+		uint32_t abs_sec = ctx->offset_sec + ctx->issue_sec;
+		uint32_t to_edge = (ctx->unit_sec - abs_sec % ctx->unit_sec) /
+				   ctx->sectors_per_frame;
+
+		if (to_edge > 0U && batch > to_edge) {
+			batch = to_edge;
+		}
+	}
+	return batch;
+}
+
+/* Halve the cap after a slow write; grow it while the frames left
+ * behind would fill another batch.
+ */
+static void bin_batch_adapt(struct bin_disk_ctx *ctx, uint32_t lat_us,
+			    uint32_t backlog)
+{
+	if (lat_us > CONFIG_DATA_LOGGER_BIN_BATCH_LATENCY_US) {
+		ctx->batch_limit = MAX(ctx->batch_limit / 2U, 1U);
+	} else if (backlog >= ctx->batch_limit &&
+		   ctx->batch_limit < BIN_MAX_BATCH_FRAMES) {
+		ctx->batch_limit++;
+	}
+}
+#endif /* CONFIG_DATA_LOGGER_BIN_ADAPTIVE_BATCH */
+
+/* Take the next run of committed frames for a write lane.  Called with
+ * bin_lane_lock held; returns NULL if nothing is waiting or every lane
+ * already has a batch in flight.
+ */
+static struct bin_batch *bin_batch_issue(struct bin_disk_ctx *ctx)
+{
+	uint32_t head  = (uint32_t)atomic_get(&ctx->head);
+	uint32_t avail = head - ctx->issue;
+
+	if (avail == 0U || bin_batch_head - bin_batch_tail == BIN_LANES) {
+		return NULL;
+	}
+
+	uint32_t to_wrap = BIN_RING_FRAMES - (ctx->issue & BIN_RING_MASK);
+	uint32_t batch   = MIN(avail, to_wrap);
+
+#if defined(CONFIG_DATA_LOGGER_BIN_ADAPTIVE_BATCH)
+	batch = bin_batch_trim(ctx, batch);
+#else
+	batch = MIN(batch, BIN_MAX_BATCH_FRAMES);
+#endif
+
+	struct bin_batch *b = &bin_batches[bin_batch_head % BIN_LANES];
+	uint32_t n_sec = batch * ctx->sectors_per_frame;
+
+	b->first  = ctx->issue;
+	b->frames = batch;
+	b->sec    = ctx->issue_sec;
+	b->done   = false;
+	b->rc     = 0;
+
+	if (ctx->issue_sec + n_sec > ctx->size_sec) {
+		/* Linear region exhausted. Drop the batch so the producer
+		 * doesn't hang; sticky_err will propagate and the rest of
+		 * the flight is silently discarded.
+		 */
+		b->rc = -ENOSPC;
+	} else {
+		ctx->issue_sec += n_sec;
+	}
+	ctx->issue += batch;
+	bin_batch_head++;
+	return b;
+}
+
+/* Release every finished batch at the front, in ring order, so tail
+ * only ever moves over frames that are on the card (or dropped).
+ * Called with bin_lane_lock held.
+ */
+static void bin_batch_retire(struct bin_disk_ctx *ctx)
+{
+	while (bin_batch_tail != bin_batch_head) {
+		struct bin_batch *b = &bin_batches[bin_batch_tail % BIN_LANES];
+
+		if (!b->done) {
+			break;
+		}
+
+		if (b->rc != -ENOSPC) {
+			/* A failed write leaves a hole; the converter stops
+			 * at it, just as it stops at any seq gap.
+			 */
+			ctx->cur_sector_offset = b->sec +
+				b->frames * ctx->sectors_per_frame;
+		}
+		if (b->rc == 0) {
+			disk_led_activity();
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+			bin_index_batch(b->first, b->frames, b->sec);
+#endif
+		}
+
+		(void)atomic_add(&ctx->tail, (atomic_val_t)b->frames);
+		for (uint32_t i = 0; i < b->frames; i++) {
+			k_sem_give(&bin_space_sem);
+		}
+		bin_batch_tail++;
+	}
+}
+
+/* A batch could not go to the card.  Without a mirror the error is
+ * sticky and the producer stops; with one, later batches are retired
+ * without a write and the flight goes on on flash.
+ */
+static void bin_disk_fail(struct bin_disk_ctx *ctx, int rc)
+{
+#if defined(CONFIG_DATA_LOGGER_BIN_MIRROR)
+	if (!atomic_set(&ctx->disk_lost, 1)) {
+		bin_mirror_disk_lost();
+		LOG_ERR("bin_disk: card lost (%d), logging to the flash mirror "
+			"only", rc);
+	}
+#else
+	(void)atomic_cas(&ctx->sticky_err, 0, (atomic_val_t)rc);
+#endif
+}
+
+/* Write one issued batch.  Runs without bin_lane_lock, so with two
+ * lanes the next batch is already queued in the disk driver while this
+ * one transfers.
+ */
+static void bin_batch_write(struct bin_disk_ctx *ctx, struct bin_batch *b)
+{
+#if defined(CONFIG_DATA_LOGGER_BIN_MIRROR)
+	if (atomic_get(&ctx->disk_lost)) {
+		/* Keep -ENOSPC, retire must not move past the region. */
+		if (b->rc == 0) {
+			b->rc = -EIO;
+		}
+		return;
+	}
+#endif
+
+	if (b->rc == -ENOSPC) {
+		bin_disk_fail(ctx, -ENOSPC);
+		LOG_ERR("bin_disk: region full at sector %u",
+			ctx->offset_sec + b->sec);
+		return;
+	}
+
+	uint32_t n_sec = b->frames * ctx->sectors_per_frame;
+	uint32_t t0 = bin_stats_begin();
+#if defined(CONFIG_DATA_LOGGER_BIN_ADAPTIVE_BATCH)
+	uint32_t t_adapt = k_cycle_get_32();
+#endif
+
+	b->rc = disk_access_write(BIN_DISK_NAME, frame_ptr(b->first),
+				  ctx->offset_sec + b->sec, n_sec);
+	if (b->rc != 0) {
+		bin_disk_fail(ctx, b->rc);
+		LOG_ERR("bin_disk: write at sector %u (n=%u) failed (%d)",
+			ctx->offset_sec + b->sec, n_sec, b->rc);
+		return;
+	}
+
+	bin_stats_write(t0, b->frames, (size_t)b->frames * BIN_FRAME_SIZE);
+#if defined(CONFIG_DATA_LOGGER_BIN_ADAPTIVE_BATCH)
+	b->lat_us = k_cyc_to_us_floor32(k_cycle_get_32() - t_adapt);
+#endif
+}
+
+/* Run at the power-fail priority for as long as the supply is down. */
+static void bin_pf_prio(bool *boosted)
+{
+	bool pf = atomic_get(&bin_pf) != 0;
+
+	if (pf != *boosted) {
+		k_thread_priority_set(k_current_get(), pf
+			? CONFIG_DATA_LOGGER_POWERFAIL_WRITER_PRIO
+			: CONFIG_DATA_LOGGER_BIN_WRITER_PRIO);
+		*boosted = pf;
+	}
+}
+
+/* Past the power-fail budget no new batch is issued: the card finishes
+ * what it has and stays idle until the supply recovers.
+ */
+static void bin_pf_hold(void)
+{
+	while (atomic_get(&bin_pf) && k_uptime_get() >= bin_pf_deadline) {
+		(void)k_sem_take(&bin_pf_resume, K_FOREVER);
+	}
+}
+
+static void bin_pf_commit(struct bin_disk_ctx *ctx);
+
 static void bin_writer_fn(void *p1, void *p2, void *p3)
 {
 	ARG_UNUSED(p1); ARG_UNUSED(p2); ARG_UNUSED(p3);
 
+	struct bin_disk_ctx *ctx = &g_bin_ctx;
+	bool boosted = false;
+
 	for (;;) {
 		(void)k_sem_take(&bin_data_sem, K_FOREVER);
 
@@ -164,71 +729,45 @@ static void bin_writer_fn(void *p1, void *p2, void *p3)
 			continue;
 		}
 
-		uint32_t head  = (uint32_t)atomic_get(&g_bin_ctx.head);
-		uint32_t tail  = (uint32_t)atomic_get(&g_bin_ctx.tail);
-		uint32_t avail = head - tail;
-
-		if (avail > 0U) {
-			uint32_t to_wrap = BIN_RING_FRAMES - (tail & BIN_RING_MASK);
-			uint32_t batch   = MIN(avail, to_wrap);
-
-			batch = MIN(batch, BIN_MAX_BATCH_FRAMES);
-
-			uint32_t sec      = g_bin_ctx.cur_sector_offset;
-			uint32_t n_sec    = batch * g_bin_ctx.sectors_per_frame;
-
-			if (sec + n_sec > g_bin_ctx.size_sec) {
-				/* Linear region exhausted. Drop the batch so
-				 * the producer doesn't hang; sticky_err will
-				 * propagate and the rest of the flight is
-				 * silently discarded.
-				 */
-				(void)atomic_cas(&g_bin_ctx.sticky_err, 0,
-						 (atomic_val_t)-ENOSPC);
-				LOG_ERR("bin_disk: region full at sector %u",
-					g_bin_ctx.offset_sec + sec);
-			} else {
-				int rc = disk_access_write(BIN_DISK_NAME,
-					frame_ptr(tail),
-					g_bin_ctx.offset_sec + sec,
-					n_sec);
-
-				if (rc != 0) {
-					(void)atomic_cas(&g_bin_ctx.sticky_err, 0,
-							 (atomic_val_t)rc);
-					LOG_ERR("bin_disk: write at sector %u "
-						"(n=%u) failed (%d)",
-						g_bin_ctx.offset_sec + sec,
-						n_sec, rc);
-				} else {
-					g_bin_ctx.cur_sector_offset = sec + n_sec;
-					disk_led_activity();
-				}
-			}
+		bin_pf_prio(&boosted);
+		if (atomic_get(&bin_pf_req) && atomic_cas(&bin_pf_req, 1, 0)) {
+			bin_pf_commit(ctx);
+		}
+		bin_pf_hold();
+
+		(void)k_mutex_lock(&bin_lane_lock, K_FOREVER);
+		struct bin_batch *b = bin_batch_issue(ctx);
+		k_mutex_unlock(&bin_lane_lock);
 
-			(void)atomic_add(&g_bin_ctx.tail, (atomic_val_t)batch);
+		if (b != NULL) {
+			bin_batch_write(ctx, b);
 
-			for (uint32_t i = 0; i < batch; i++) {
-				k_sem_give(&bin_space_sem);
+			(void)k_mutex_lock(&bin_lane_lock, K_FOREVER);
+#if defined(CONFIG_DATA_LOGGER_BIN_ADAPTIVE_BATCH)
+			if (b->rc == 0) {
+				bin_batch_adapt(ctx, b->lat_us,
+					(uint32_t)atomic_get(&ctx->head) -
+					ctx->issue);
 			}
+#endif
+			b->done = true;
+			bin_batch_retire(ctx);
+			bool more = (uint32_t)atomic_get(&ctx->head) !=
+				    ctx->issue;
+			k_mutex_unlock(&bin_lane_lock);
 
 			/* If more frames are queued (or remained after wrap),
 			 * keep the writer hot.
 			 */
-			head = (uint32_t)atomic_get(&g_bin_ctx.head);
-			tail = (uint32_t)atomic_get(&g_bin_ctx.tail);
-			if (head != tail) {
+			if (more) {
 				k_sem_give(&bin_data_sem);
 			}
 		}
 
-		if (atomic_get(&bin_drain_req)) {
-			head = (uint32_t)atomic_get(&g_bin_ctx.head);
-			tail = (uint32_t)atomic_get(&g_bin_ctx.tail);
-			if (head == tail) {
-				atomic_set(&bin_drain_req, 0);
-				k_sem_give(&bin_drain_sem);
-			}
+		if (atomic_get(&bin_drain_req) &&
+		    atomic_get(&ctx->head) == atomic_get(&ctx->tail) &&
+		    atomic_cas(&bin_drain_req, 1, 0)) {
+			k_sem_give(&bin_drain_sem);
 		}
 	}
 }
@@ -237,10 +776,18 @@ K_THREAD_DEFINE(bin_writer_th, CONFIG_DATA_LOGGER_BIN_WRITER_STACK_SIZE,
 		bin_writer_fn, NULL, NULL, NULL,
 		CONFIG_DATA_LOGGER_BIN_WRITER_PRIO, 0, 0);
 
+#if BIN_LANES > 1
+/* Second lane: issues the next batch while the first one is on the bus. */
+K_THREAD_DEFINE(bin_writer_th2, CONFIG_DATA_LOGGER_BIN_WRITER_STACK_SIZE,
+		bin_writer_fn, NULL, NULL, NULL,
+		CONFIG_DATA_LOGGER_BIN_WRITER_PRIO, 0, 0);
+#endif
+
 /* -------------------------------------------------------------------------- */
 /*  Producer-side helpers                                                     */
 /* -------------------------------------------------------------------------- */
 
+#if !defined(CONFIG_DATA_LOGGER_BIN_COLUMNAR)
 static void bin_frame_init(struct bin_disk_ctx *ctx, uint8_t *frame)
 {
 	memset(frame, 0xFF, BIN_FRAME_SIZE);
@@ -257,10 +804,30 @@ static void bin_frame_init(struct bin_disk_ctx *ctx, uint8_t *frame)
 	h->base_ts_ns = k_ticks_to_ns_floor64(k_uptime_ticks());
 
 	ctx->prod_used = BIN_HDR_SIZE;
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+	ctx->prod_crc = 0;
+#endif
+#if defined(CONFIG_DATA_LOGGER_BIN_PACKED)
+	bin_codec_reset(&ctx->codec);
+#endif
+}
+#endif /* !CONFIG_DATA_LOGGER_BIN_COLUMNAR */
+
+/* The head frame gains a record of @p type. */
+static inline void bin_note_type(struct bin_disk_ctx *ctx, uint8_t type)
+{
+#if defined(CONFIG_DATA_LOGGER_BIN_MIRROR)
+	ctx->mirror_critical |= bin_mirror_critical(type);
+#else
+	ARG_UNUSED(ctx);
+	ARG_UNUSED(type);
+#endif
 }
 
 static int bin_wait_space(struct bin_disk_ctx *ctx, k_timeout_t to)
 {
+	bool stalled = false;
+
 	for (;;) {
 		uint32_t head = (uint32_t)atomic_get(&ctx->head);
 		uint32_t tail = (uint32_t)atomic_get(&ctx->tail);
@@ -272,6 +839,11 @@ static int bin_wait_space(struct bin_disk_ctx *ctx, k_timeout_t to)
 			return 0;
 		}
 
+		if (!stalled) {
+			bin_stats_stall();
+			stalled = true;
+		}
+
 		int rc = k_sem_take(&bin_space_sem, to);
 
 		if (rc != 0) {
@@ -280,28 +852,186 @@ static int bin_wait_space(struct bin_disk_ctx *ctx, k_timeout_t to)
 	}
 }
 
-static int bin_rotate(struct bin_disk_ctx *ctx)
+/* Commit the current head frame and wait for room to reserve the next
+ * head slot.
+ */
+static int bin_commit_head(struct bin_disk_ctx *ctx)
 {
-	/* Commit the current head frame. */
+#if defined(CONFIG_DATA_LOGGER_BIN_MIRROR)
+	bin_mirror_put(frame_ptr((uint32_t)atomic_get(&ctx->head)),
+		       ctx->mirror_critical);
+	ctx->mirror_critical = false;
+#endif
 	(void)atomic_inc(&ctx->head);
 	k_sem_give(&bin_data_sem);
+	bin_stats_queued((uint32_t)atomic_get(&ctx->head) -
+			 (uint32_t)atomic_get(&ctx->tail));
 
-	/* Wait for room to reserve the next head slot. */
 	int rc = bin_wait_space(ctx,
 		K_MSEC(CONFIG_DATA_LOGGER_BIN_PRODUCER_TIMEOUT_MS));
 
 	if (rc != 0) {
 		(void)atomic_cas(&ctx->sticky_err, 0,
 				 (atomic_val_t)-EBUSY);
-		ctx->prod_used = 0;
 		return -EBUSY;
 	}
 
+	return 0;
+}
+
+#if !defined(CONFIG_DATA_LOGGER_BIN_COLUMNAR)
+static int bin_rotate(struct bin_disk_ctx *ctx)
+{
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+	bin_codec_crc_seal(frame_ptr((uint32_t)atomic_get(&ctx->head)),
+			   BIN_FRAME_SIZE, ctx->prod_used, ctx->prod_crc);
+#endif
+
+	int rc = bin_commit_head(ctx);
+
+	if (rc != 0) {
+		ctx->prod_used = 0;
+		return rc;
+	}
+
 	uint32_t head = (uint32_t)atomic_get(&ctx->head);
 
 	bin_frame_init(ctx, frame_ptr(head));
 	return 0;
 }
+#else
+/* Open the staging frame for @p type; seq is assigned at commit time so
+ * frames reach the disk with contiguous seq in commit order.
+ */
+static void bin_col_open(struct bin_disk_ctx *ctx, uint8_t type,
+			 uint8_t channels, uint64_t base_ts_ns)
+{
+	uint8_t *frame = bin_col_stage[type];
+
+	memset(frame, 0xFF, BIN_FRAME_SIZE);
+
+	struct aurora_bin_frame_header *h =
+		(struct aurora_bin_frame_header *)frame;
+
+	memcpy(h->magic, AURORA_BIN_FRAME_MAGIC, sizeof(h->magic));
+	h->version    = AURORA_BIN_VERSION;
+	h->reserved0  = 0;
+	h->flight_id  = ctx->flight_id;
+	h->base_ts_ns = base_ts_ns;
+
+	ctx->col_channels[type] = channels;
+	ctx->col_cap[type] = (uint16_t)AURORA_BIN_COL_CAPACITY(BIN_PAYLOAD_END,
+							       channels);
+}
+
+/* Move the staging frame for @p type into the ring and close it. */
+static int bin_col_commit(struct bin_disk_ctx *ctx, uint8_t type)
+{
+	uint8_t *frame = frame_ptr((uint32_t)atomic_get(&ctx->head));
+	struct aurora_bin_frame_header *h =
+		(struct aurora_bin_frame_header *)frame;
+
+	memcpy(frame, bin_col_stage[type], BIN_FRAME_SIZE);
+	h->seq       = ctx->next_seq++;
+	h->reserved1 = AURORA_BIN_COL_TAG(type, ctx->col_channels[type],
+					  ctx->col_count[type]);
+	ctx->col_count[type] = 0;
+	bin_note_type(ctx, type);
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+	/* Columns fill out of order, so the CRC is one pass here. */
+	bin_codec_crc_seal(frame, BIN_FRAME_SIZE, BIN_HDR_SIZE, 0);
+#endif
+
+	return bin_commit_head(ctx);
+}
+
+/* Open staging frame with the oldest first sample before @p before_ns,
+ * or AURORA_DATA_COUNT if there is none.
+ */
+static uint8_t bin_col_oldest(const struct bin_disk_ctx *ctx,
+			      uint64_t before_ns)
+{
+	uint8_t oldest = AURORA_DATA_COUNT;
+	uint64_t oldest_ns = before_ns;
+
+	for (uint8_t t = 0; t < AURORA_DATA_COUNT; t++) {
+		const struct aurora_bin_frame_header *h =
+			(const struct aurora_bin_frame_header *)bin_col_stage[t];
+
+		if (ctx->col_count[t] != 0U && h->base_ts_ns < oldest_ns) {
+			oldest    = t;
+			oldest_ns = h->base_ts_ns;
+		}
+	}
+	return oldest;
+}
+
+/* Commit @p type after every staging frame opened before it. */
+static int bin_col_commit_ordered(struct bin_disk_ctx *ctx, uint8_t type)
+{
+	const struct aurora_bin_frame_header *h =
+		(const struct aurora_bin_frame_header *)bin_col_stage[type];
+	uint8_t t;
+
+	while ((t = bin_col_oldest(ctx, h->base_ts_ns)) < AURORA_DATA_COUNT) {
+		int rc = bin_col_commit(ctx, t);
+
+		if (rc != 0) {
+			return rc;
+		}
+	}
+	return bin_col_commit(ctx, type);
+}
+
+static int bin_col_write(struct bin_disk_ctx *ctx, const struct datapoint *dp)
+{
+	if ((unsigned int)dp->type >= AURORA_DATA_COUNT) {
+		return -EINVAL;
+	}
+
+	const uint8_t type     = (uint8_t)dp->type;
+	const uint8_t channels = MIN(dp->channel_count, DP_MAX_CHANNELS);
+	int rc;
+
+	if (ctx->col_count[type] != 0U &&
+	    (ctx->col_channels[type] != channels ||
+	     ctx->col_count[type] == ctx->col_cap[type])) {
+		rc = bin_col_commit_ordered(ctx, type);
+		if (rc != 0) {
+			return rc;
+		}
+	}
+
+	/* Anchor the frame on its first sample so that one is exact. */
+	if (ctx->col_count[type] == 0U) {
+		bin_col_open(ctx, type, channels, dp->timestamp_ns);
+	}
+
+	uint8_t *frame = bin_col_stage[type];
+	const struct aurora_bin_frame_header *h =
+		(const struct aurora_bin_frame_header *)frame;
+	const size_t cap = ctx->col_cap[type];
+	const size_t i   = ctx->col_count[type];
+	uint32_t *ts     = (uint32_t *)(frame + AURORA_BIN_COL_OFFSET(cap, 0));
+	uint64_t delta_ns = dp->timestamp_ns >= h->base_ts_ns
+		? dp->timestamp_ns - h->base_ts_ns : 0;
+
+	ts[i] = (uint32_t)(delta_ns / 1000U);
+
+	for (uint8_t c = 0; c < channels; c++) {
+		int32_t *v1 = (int32_t *)(frame +
+			AURORA_BIN_COL_OFFSET(cap, 1U + 2U * c));
+		int32_t *v2 = (int32_t *)(frame +
+			AURORA_BIN_COL_OFFSET(cap, 2U + 2U * c));
+
+		v1[i] = dp->channels[c].val1;
+		v2[i] = dp->channels[c].val2;
+	}
+
+	ctx->col_count[type]++;
+	return 0;
+}
+#endif /* CONFIG_DATA_LOGGER_BIN_COLUMNAR */
 
 static int bin_drain_writer(void)
 {
@@ -318,6 +1048,48 @@ static int bin_drain_writer(void)
 	return 0;
 }
 
+/* Whether one more frame can be committed without waiting for space. */
+static bool bin_pf_room(const struct bin_disk_ctx *ctx)
+{
+	return (uint32_t)atomic_get(&ctx->head) -
+	       (uint32_t)atomic_get(&ctx->tail) + 1U < BIN_RING_FRAMES - 1U;
+}
+
+/* Writer side of a power fail: commit the live frame(s) behind the ring
+ * backlog.  The producer has seen running == 0, so once it lets go of
+ * the mutex it stays away from the head slot.  Commits only happen
+ * while the ring has room, so the writer never waits on itself.
+ */
+static void bin_pf_commit(struct bin_disk_ctx *ctx)
+{
+	if (ctx->owner == NULL) {
+		return;
+	}
+
+	if (k_mutex_lock(&ctx->owner->state->mutex,
+			 K_MSEC(CONFIG_DATA_LOGGER_POWERFAIL_LOCK_MS)) != 0) {
+		LOG_WRN("bin_disk: power fail, live frame still in use");
+		return;
+	}
+
+	if (atomic_get(&ctx->sticky_err) == 0) {
+#if defined(CONFIG_DATA_LOGGER_BIN_COLUMNAR)
+		uint8_t t;
+
+		while (bin_pf_room(ctx) &&
+		       (t = bin_col_oldest(ctx, UINT64_MAX)) < AURORA_DATA_COUNT) {
+			(void)bin_col_commit(ctx, t);
+		}
+#else
+		if (ctx->prod_used > BIN_HDR_SIZE && bin_pf_room(ctx)) {
+			(void)bin_rotate(ctx);
+		}
+#endif
+	}
+
+	k_mutex_unlock(&ctx->owner->state->mutex);
+}
+
 /* -------------------------------------------------------------------------- */
 /*  Formatter vtable                                                          */
 /* -------------------------------------------------------------------------- */
@@ -396,54 +1168,251 @@ static int bin_init(struct data_logger *logger, const char *path)
 		return -EINVAL;
 	}
 
-	uint64_t size_sec64 = BIN_DISK_HAS_SIZE
-		? (BIN_DISK_SIZE_BYTES / sector_size)
-		: ((uint64_t)total_sec - offset_sec64);
+	uint64_t size_sec64 = BIN_DISK_HAS_SIZE
+		? (BIN_DISK_SIZE_BYTES / sector_size)
+		: ((uint64_t)total_sec - offset_sec64);
+
+	if (size_sec64 == 0 || offset_sec64 + size_sec64 > total_sec) {
+		LOG_ERR("bin_disk: region [%llu..%llu) exceeds disk (%u "
+			"sectors)", (unsigned long long)offset_sec64,
+			(unsigned long long)(offset_sec64 + size_sec64),
+			total_sec);
+		atomic_set(&g_bin_open, 0);
+		return -EINVAL;
+	}
+
+	ctx->sector_size       = sector_size;
+	ctx->sectors_per_frame = (uint32_t)(BIN_FRAME_SIZE / sector_size);
+	ctx->offset_sec        = (uint32_t)offset_sec64;
+	ctx->size_sec          = (uint32_t)size_sec64;
+
+	if ((ctx->size_sec % ctx->sectors_per_frame) != 0 ||
+	    ctx->size_sec <= BIN_INDEX_FRAMES * ctx->sectors_per_frame) {
+		LOG_ERR("bin_disk: size sectors %u not a multiple of frame "
+			"sectors %u", ctx->size_sec, ctx->sectors_per_frame);
+		atomic_set(&g_bin_open, 0);
+		return -EINVAL;
+	}
+	ctx->size_sec -= BIN_INDEX_FRAMES * ctx->sectors_per_frame;
+
+#if defined(CONFIG_DATA_LOGGER_BIN_ADAPTIVE_BATCH)
+	/* Not every driver knows its erase block; batches then only follow
+	 * the latency target.
+	 */
+	uint32_t unit_sec = 0;
+
+	ctx->batch_limit = BIN_MAX_BATCH_FRAMES;
+	ctx->unit_sec    = 0;
+	if (disk_access_ioctl(BIN_DISK_NAME, DISK_IOCTL_GET_ERASE_BLOCK_SZ,
+			      &unit_sec) == 0 &&
+	    unit_sec > ctx->sectors_per_frame &&
+	    unit_sec % ctx->sectors_per_frame == 0U) {
+		ctx->unit_sec = unit_sec;
+	}
+#endif
+
+	ctx->flight_id         = k_ticks_to_ns_floor64(k_uptime_ticks());
+	ctx->next_seq          = 0;
+	ctx->cur_sector_offset = 0;
+	bin_stats_open(BIN_RING_FRAMES - 1U);
+
+#if defined(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+	rc = bin_sess_open(ctx);
+	if (rc != 0) {
+		atomic_set(&g_bin_open, 0);
+		return rc;
+	}
+#endif
+	ctx->first_sec = ctx->cur_sector_offset;
+	ctx->issue_sec = ctx->cur_sector_offset;
+	bin_batch_head = 0;
+	bin_batch_tail = 0;
+
+	k_sem_reset(&bin_data_sem);
+	k_sem_reset(&bin_space_sem);
+	k_sem_reset(&bin_drain_sem);
+	atomic_set(&bin_drain_req, 0);
+	atomic_set(&bin_pf, 0);
+	atomic_set(&bin_pf_req, 0);
+	k_sem_reset(&bin_pf_resume);
+
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+	/* Blank the previous flight's index; ring slot 0 is free scratch
+	 * until the first frame is opened in it.  A linear log is never
+	 * overwritten, so nothing is ever pruned.
+	 */
+	bin_index_reset(&bin_ix, ctx->flight_id, UINT32_MAX);
+	memset(frame_ptr(0), 0xFF, BIN_FRAME_SIZE);
+	rc = bin_index_persist(ctx, frame_ptr(0));
+	ctx->index_on = (rc == 0);
+	if (rc != 0) {
+		LOG_WRN("bin_disk: logging without index");
+	}
+#endif
+
+#if !defined(CONFIG_DATA_LOGGER_BIN_COLUMNAR)
+	bin_frame_init(ctx, frame_ptr(0));
+#endif
+
+	if (bin_mirror_open() != 0) {
+		LOG_WRN("bin_disk: logging without flash mirror");
+	}
+
+	ctx->owner  = logger;
+	logger->ctx = ctx;
+	return 0;
+}
+
+static int bin_write_header(struct data_logger *logger)
+{
+	ARG_UNUSED(logger);
+	return 0;
+}
+
+#if !defined(CONFIG_DATA_LOGGER_BIN_COLUMNAR)
+#if defined(CONFIG_DATA_LOGGER_BIN_PACKED)
+#define BIN_REC_ROOM BIN_CODEC_REC_MAX
+#else
+#define BIN_REC_ROOM BIN_REC_SIZE
+#endif
+
+/* Append @p dp to @p frame (the head slot); the caller has checked for
+ * BIN_REC_ROOM bytes.
+ */
+static int bin_put(struct bin_disk_ctx *ctx, uint8_t *frame,
+		   const struct datapoint *dp)
+{
+	const struct aurora_bin_frame_header *h =
+		(const struct aurora_bin_frame_header *)frame;
+
+	bin_note_type(ctx, (uint8_t)dp->type);
+
+#if defined(CONFIG_DATA_LOGGER_BIN_PACKED)
+	int n = bin_codec_encode(&ctx->codec, h->base_ts_ns, dp,
+				 frame + ctx->prod_used);
+
+	if (n < 0) {
+		return n;
+	}
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+	ctx->prod_crc = bin_codec_crc_add(ctx->prod_crc,
+					  frame + ctx->prod_used, (size_t)n);
+#endif
+	ctx->prod_used += (size_t)n;
+	return 0;
+#else
+	struct aurora_bin_record *rec =
+		(struct aurora_bin_record *)(frame + ctx->prod_used);
+
+	uint64_t delta_ns = dp->timestamp_ns >= h->base_ts_ns
+		? dp->timestamp_ns - h->base_ts_ns : 0;
+
+	rec->type          = (uint8_t)dp->type;
+	rec->channel_count = dp->channel_count;
+	rec->reserved      = 0;
+	rec->ts_delta_us   = (uint32_t)(delta_ns / 1000U);
+
+	for (int i = 0; i < DP_MAX_CHANNELS; i++) {
+		if (i < dp->channel_count) {
+			rec->channels[i].val1 = dp->channels[i].val1;
+			rec->channels[i].val2 = dp->channels[i].val2;
+		} else {
+			rec->channels[i].val1 = 0;
+			rec->channels[i].val2 = 0;
+		}
+	}
+
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+	ctx->prod_crc = bin_codec_crc_add(ctx->prod_crc, rec, BIN_REC_SIZE);
+#endif
+	ctx->prod_used += BIN_REC_SIZE;
+	return 0;
+#endif /* CONFIG_DATA_LOGGER_BIN_PACKED */
+}
+#endif /* !CONFIG_DATA_LOGGER_BIN_COLUMNAR */
+
+static int bin_write_datapoint(struct data_logger *logger,
+			       const struct datapoint *dp)
+{
+	struct bin_disk_ctx *ctx = logger->ctx;
+	int err = (int)atomic_get(&ctx->sticky_err);
+
+	if (err != 0) {
+		return err;
+	}
+
+#if defined(CONFIG_DATA_LOGGER_BIN_COLUMNAR)
+	return bin_col_write(ctx, dp);
+#else
+	if (ctx->prod_used + BIN_REC_ROOM > BIN_PAYLOAD_END) {
+		int rc = bin_rotate(ctx);
+
+		if (rc != 0) {
+			return rc;
+		}
+	}
+
+	return bin_put(ctx, frame_ptr((uint32_t)atomic_get(&ctx->head)), dp);
+#endif /* CONFIG_DATA_LOGGER_BIN_COLUMNAR */
+}
+
+/* Batch path: the sticky error is sampled once per call and the head
+ * slot is resolved once per frame rather than once per record.
+ */
+static int bin_write_datapoints(struct data_logger *logger,
+				const struct datapoint *dps, size_t n)
+{
+	struct bin_disk_ctx *ctx = logger->ctx;
+	int err = (int)atomic_get(&ctx->sticky_err);
+	size_t i = 0;
 
-	if (size_sec64 == 0 || offset_sec64 + size_sec64 > total_sec) {
-		LOG_ERR("bin_disk: region [%llu..%llu) exceeds disk (%u "
-			"sectors)", (unsigned long long)offset_sec64,
-			(unsigned long long)(offset_sec64 + size_sec64),
-			total_sec);
-		atomic_set(&g_bin_open, 0);
-		return -EINVAL;
+	if (err != 0) {
+		return err;
 	}
 
-	ctx->sector_size       = sector_size;
-	ctx->sectors_per_frame = (uint32_t)(BIN_FRAME_SIZE / sector_size);
-	ctx->offset_sec        = (uint32_t)offset_sec64;
-	ctx->size_sec          = (uint32_t)size_sec64;
+#if defined(CONFIG_DATA_LOGGER_BIN_COLUMNAR)
+	for (; i < n; i++) {
+		int rc = bin_col_write(ctx, &dps[i]);
 
-	if ((ctx->size_sec % ctx->sectors_per_frame) != 0) {
-		LOG_ERR("bin_disk: size sectors %u not a multiple of frame "
-			"sectors %u", ctx->size_sec, ctx->sectors_per_frame);
-		atomic_set(&g_bin_open, 0);
-		return -EINVAL;
+		if (rc != 0) {
+			return rc;
+		}
 	}
+#else
+	while (i < n) {
+		if (ctx->prod_used + BIN_REC_ROOM > BIN_PAYLOAD_END) {
+			int rc = bin_rotate(ctx);
 
-	ctx->flight_id         = k_ticks_to_ns_floor64(k_uptime_ticks());
-	ctx->next_seq          = 0;
-	ctx->cur_sector_offset = 0;
+			if (rc != 0) {
+				return rc;
+			}
+			continue;
+		}
 
-	k_sem_reset(&bin_data_sem);
-	k_sem_reset(&bin_space_sem);
-	k_sem_reset(&bin_drain_sem);
-	atomic_set(&bin_drain_req, 0);
+		uint8_t *frame = frame_ptr((uint32_t)atomic_get(&ctx->head));
 
-	bin_frame_init(ctx, frame_ptr(0));
+		do {
+			int rc = bin_put(ctx, frame, &dps[i++]);
 
-	logger->ctx = ctx;
-	return 0;
-}
+			if (rc != 0) {
+				return rc;
+			}
+		} while (i < n &&
+			 ctx->prod_used + BIN_REC_ROOM <= BIN_PAYLOAD_END);
+	}
+#endif /* CONFIG_DATA_LOGGER_BIN_COLUMNAR */
 
-static int bin_write_header(struct data_logger *logger)
-{
-	ARG_UNUSED(logger);
 	return 0;
 }
 
-static int bin_write_datapoint(struct data_logger *logger,
-			       const struct datapoint *dp)
+#if !defined(CONFIG_DATA_LOGGER_BIN_PACKED) && \
+	!defined(CONFIG_DATA_LOGGER_BIN_COLUMNAR)
+/* Zero-copy producer path: hand out the next record slot of the head
+ * frame.  Never waits — if the frame is full and committing it would
+ * leave no slot to reserve, the caller falls back to the copying path.
+ */
+static int bin_reserve(struct data_logger *logger, uint64_t timestamp_ns,
+		       struct aurora_bin_record **out)
 {
 	struct bin_disk_ctx *ctx = logger->ctx;
 	int err = (int)atomic_get(&ctx->sticky_err);
@@ -452,7 +1421,14 @@ static int bin_write_datapoint(struct data_logger *logger,
 		return err;
 	}
 
-	if (ctx->prod_used + BIN_REC_SIZE > BIN_FRAME_SIZE) {
+	if (ctx->prod_used + BIN_REC_SIZE > BIN_PAYLOAD_END) {
+		uint32_t head = (uint32_t)atomic_get(&ctx->head);
+		uint32_t tail = (uint32_t)atomic_get(&ctx->tail);
+
+		if ((head + 1U - tail) >= (BIN_RING_FRAMES - 1U)) {
+			return -EAGAIN;
+		}
+
 		int rc = bin_rotate(ctx);
 
 		if (rc != 0) {
@@ -460,40 +1436,71 @@ static int bin_write_datapoint(struct data_logger *logger,
 		}
 	}
 
-	uint32_t head    = (uint32_t)atomic_get(&ctx->head);
-	uint8_t *frame   = frame_ptr(head);
-	struct aurora_bin_frame_header *h =
-		(struct aurora_bin_frame_header *)frame;
+	uint8_t *frame = frame_ptr((uint32_t)atomic_get(&ctx->head));
+	const struct aurora_bin_frame_header *h =
+		(const struct aurora_bin_frame_header *)frame;
 	struct aurora_bin_record *rec =
 		(struct aurora_bin_record *)(frame + ctx->prod_used);
+	uint64_t delta_ns = timestamp_ns >= h->base_ts_ns
+		? timestamp_ns - h->base_ts_ns : 0;
 
-	uint64_t delta_ns = dp->timestamp_ns >= h->base_ts_ns
-		? dp->timestamp_ns - h->base_ts_ns : 0;
+	rec->reserved    = 0;
+	rec->ts_delta_us = (uint32_t)(delta_ns / 1000U);
 
-	rec->type          = (uint8_t)dp->type;
-	rec->channel_count = dp->channel_count;
-	rec->reserved      = 0;
-	rec->ts_delta_us   = (uint32_t)(delta_ns / 1000U);
+	*out = rec;
+	return 0;
+}
 
-	for (int i = 0; i < DP_MAX_CHANNELS; i++) {
-		if (i < dp->channel_count) {
-			rec->channels[i].val1 = dp->channels[i].val1;
-			rec->channels[i].val2 = dp->channels[i].val2;
-		} else {
-			rec->channels[i].val1 = 0;
-			rec->channels[i].val2 = 0;
-		}
+static int bin_commit(struct data_logger *logger, struct aurora_bin_record *rec)
+{
+	struct bin_disk_ctx *ctx = logger->ctx;
+	uint8_t *frame = frame_ptr((uint32_t)atomic_get(&ctx->head));
+
+	if ((uint8_t *)rec != frame + ctx->prod_used) {
+		return -EINVAL;
+	}
+
+	if (rec->type >= AURORA_DATA_COUNT) {
+		/* The whole frame goes to disk; leave no half-filled slot. */
+		memset(rec, 0xFF, sizeof(*rec));
+		return -EINVAL;
 	}
 
+	if (rec->channel_count > DP_MAX_CHANNELS) {
+		rec->channel_count = DP_MAX_CHANNELS;
+	}
+	for (int i = rec->channel_count; i < DP_MAX_CHANNELS; i++) {
+		rec->channels[i].val1 = 0;
+		rec->channels[i].val2 = 0;
+	}
+	bin_note_type(ctx, rec->type);
+
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+	ctx->prod_crc = bin_codec_crc_add(ctx->prod_crc, rec, BIN_REC_SIZE);
+#endif
 	ctx->prod_used += BIN_REC_SIZE;
 	return 0;
 }
+#endif /* !CONFIG_DATA_LOGGER_BIN_PACKED && !CONFIG_DATA_LOGGER_BIN_COLUMNAR */
 
 static int bin_flush(struct data_logger *logger)
 {
 	struct bin_disk_ctx *ctx = logger->ctx;
 	int rc;
 
+#if defined(CONFIG_DATA_LOGGER_BIN_COLUMNAR)
+	/* Every open staging frame goes out, oldest first sample first. */
+	uint8_t t;
+
+	while ((t = bin_col_oldest(ctx, UINT64_MAX)) < AURORA_DATA_COUNT) {
+		rc = bin_col_commit(ctx, t);
+		if (rc != 0) {
+			LOG_ERR("bin_disk_flush: commit of type %u failed (%d)",
+				t, rc);
+			return rc;
+		}
+	}
+#else
 	if (ctx->prod_used > BIN_HDR_SIZE) {
 		rc = bin_rotate(ctx);
 		if (rc != 0) {
@@ -501,8 +1508,10 @@ static int bin_flush(struct data_logger *logger)
 			return rc;
 		}
 	}
+#endif
 
 	rc = bin_drain_writer();
+	(void)bin_mirror_drain();
 	if (rc != 0) {
 		LOG_ERR("bin_disk_flush: drain failed (%d)", rc);
 		return rc;
@@ -513,6 +1522,23 @@ static int bin_flush(struct data_logger *logger)
 	return err;
 }
 
+/* Index the frame the producer is filling: the head frame already holds
+ * next_seq - 1, a columnar frame gets next_seq when it is committed.
+ */
+static inline void bin_mark(struct bin_disk_ctx *ctx, enum aurora_bin_mark mark)
+{
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+#if defined(CONFIG_DATA_LOGGER_BIN_COLUMNAR)
+	bin_index_mark(&bin_ix, mark, ctx->next_seq);
+#else
+	bin_index_mark(&bin_ix, mark, ctx->next_seq - 1U);
+#endif
+#else
+	ARG_UNUSED(ctx);
+	ARG_UNUSED(mark);
+#endif
+}
+
 static int bin_on_event(struct data_logger *logger, enum data_logger_event ev)
 {
 	struct bin_disk_ctx *ctx = logger->ctx;
@@ -524,31 +1550,116 @@ static int bin_on_event(struct data_logger *logger, enum data_logger_event ev)
 	switch (ev) {
 	case DLE_BOOST:
 		LOG_INF("bin_disk: BOOST at seq=%u", ctx->next_seq);
+		bin_mark(ctx, AURORA_BIN_MARK_BOOST);
+		bin_mirror_boost();
+		break;
+	case DLE_APOGEE:
+		LOG_INF("bin_disk: APOGEE at seq=%u", ctx->next_seq);
+		bin_mark(ctx, AURORA_BIN_MARK_APOGEE);
 		break;
 	case DLE_LANDED:
 		LOG_INF("bin_disk: LANDED at seq=%u", ctx->next_seq);
+		bin_mark(ctx, AURORA_BIN_MARK_LANDED);
 		break;
 	}
 
 	return 0;
 }
 
+/* PFM interrupt: arm the write budget and wake a lane to take over the
+ * live frame.  On recovery the parked lanes carry on with the backlog.
+ */
+static int bin_powerfail(struct data_logger *logger, bool asserted)
+{
+	ARG_UNUSED(logger);
+
+	if (!asserted) {
+		if (atomic_cas(&bin_pf, 1, 0)) {
+			for (int i = 0; i < BIN_LANES; i++) {
+				k_sem_give(&bin_pf_resume);
+			}
+		}
+		return 0;
+	}
+
+	if (atomic_get(&bin_pf)) {
+		return 0;
+	}
+
+	bin_pf_deadline = k_uptime_get() +
+			  CONFIG_DATA_LOGGER_POWERFAIL_BUDGET_MS;
+	k_sem_reset(&bin_pf_resume);
+	atomic_set(&bin_pf, 1);
+	atomic_set(&bin_pf_req, 1);
+	k_sem_give(&bin_data_sem);
+	return 0;
+}
+
 static int bin_close(struct data_logger *logger)
 {
 	(void)bin_flush(logger);
 
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+	/* The writer is idle after the drain; record the final latest_seq. */
+	if (g_bin_ctx.index_on) {
+		(void)bin_index_persist(&g_bin_ctx, bin_ix.buf);
+	}
+#endif
+#if defined(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+	bin_sess_close(&g_bin_ctx);
+#endif
+	bin_mirror_close();
+
 	logger->ctx = NULL;
+	g_bin_ctx.owner = NULL;
 	atomic_set(&g_bin_open, 0);
 	return 0;
 }
 
+#if defined(CONFIG_DATA_LOGGER_BIN_STATIC_DISPATCH)
+/* bin_live_write – see bin_live.h */
+int bin_live_write(struct data_logger *logger, const struct datapoint *dp)
+{
+	return bin_write_datapoint(logger, dp);
+}
+
+/* bin_live_write_batch – see bin_live.h */
+int bin_live_write_batch(struct data_logger *logger,
+			 const struct datapoint *dps, size_t n)
+{
+	return bin_write_datapoints(logger, dps, n);
+}
+
+#if defined(CONFIG_DATA_LOGGER_BIN_ZERO_COPY)
+/* bin_live_reserve – see bin_live.h */
+int bin_live_reserve(struct data_logger *logger, uint64_t timestamp_ns,
+		     struct aurora_bin_record **rec)
+{
+	return bin_reserve(logger, timestamp_ns, rec);
+}
+
+/* bin_live_commit – see bin_live.h */
+int bin_live_commit(struct data_logger *logger, struct aurora_bin_record *rec)
+{
+	return bin_commit(logger, rec);
+}
+#endif /* CONFIG_DATA_LOGGER_BIN_ZERO_COPY */
+#endif /* CONFIG_DATA_LOGGER_BIN_STATIC_DISPATCH */
+
 const struct data_logger_formatter data_logger_bin_formatter = {
 	.init            = bin_init,
 	.write_header    = bin_write_header,
 	.write_datapoint = bin_write_datapoint,
+	.write_datapoints = bin_write_datapoints,
 	.flush           = bin_flush,
 	.close           = bin_close,
 	.on_event        = bin_on_event,
+	.powerfail       = bin_powerfail,
+#if !defined(CONFIG_DATA_LOGGER_BIN_PACKED) && \
+	!defined(CONFIG_DATA_LOGGER_BIN_COLUMNAR)
+	.reserve         = bin_reserve,
+	.commit          = bin_commit,
+#endif
 	.file_ext        = "bin",
 	.name            = "bin",
 };
@@ -620,8 +1731,17 @@ int bin_io_open(void)
 		return -EINVAL;
 	}
 
+	/* The index frame, if any, is not part of the data region. */
+	uint64_t index_sec64 = BIN_INDEX_FRAMES *
+			       (BIN_FRAME_SIZE / g_io_sector_size);
+
+	if (size_sec64 <= index_sec64) {
+		g_io_sector_size = 0;
+		return -EINVAL;
+	}
+
 	g_io_offset_sec = (uint32_t)offset_sec64;
-	g_io_size_sec   = (uint32_t)size_sec64;
+	g_io_size_sec   = (uint32_t)(size_sec64 - index_sec64);
 
 	return 0;
 }
@@ -682,12 +1802,29 @@ int bin_io_window_start_hint(off_t *out_offset,
 		return rc;
 	}
 
+#if defined(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+	/* Slot 0 is the catalogue; the newest flight is its last entry. */
+	const struct aurora_bin_session_header *sh =
+		(const struct aurora_bin_session_header *)hint_buf;
+
+	if (!bin_sess_valid(hint_buf) || sh->count == 0U) {
+		return -ENOENT;
+	}
+
+	const struct aurora_bin_session_entry *last =
+		&sess_entries(hint_buf)[sh->count - 1U];
+
+	*out_offset    = (off_t)last->first_slot * (off_t)BIN_FRAME_SIZE;
+	*out_seq       = 0;
+	*out_flight_id = last->flight_id;
+	return 0;
+#else
 	const struct aurora_bin_frame_header *h =
 		(const struct aurora_bin_frame_header *)hint_buf;
 
 	if (memcmp(h->magic, AURORA_BIN_FRAME_MAGIC,
 		   sizeof(h->magic)) != 0 ||
-	    h->version != AURORA_BIN_VERSION) {
+	    !bin_codec_version_supported(h->version)) {
 		return -ENOENT;
 	}
 
@@ -695,4 +1832,326 @@ int bin_io_window_start_hint(off_t *out_offset,
 	*out_seq       = h->seq;
 	*out_flight_id = h->flight_id;
 	return 0;
+#endif /* CONFIG_DATA_LOGGER_DISK_SESSIONS */
+}
+
+#if defined(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+/* Catalogue reads share hint_buf; 512-byte sectors only. */
+static int bin_io_sess_load(void)
+{
+	if (g_io_sector_size == 0) {
+		return -ENODEV;
+	}
+	if (g_io_sector_size != BIN_SESS_SECTOR) {
+		return -ENOTSUP;
+	}
+	return bin_sess_load(g_io_offset_sec, hint_buf);
+}
+
+int bin_io_sessions(struct data_logger_session *out, size_t max)
+{
+	int rc = bin_io_sess_load();
+
+	if (rc != 0) {
+		return rc;
+	}
+
+	const struct aurora_bin_session_header *h = sess_hdr(hint_buf);
+	const struct aurora_bin_session_entry *e = sess_entries(hint_buf);
+
+	for (size_t i = 0; i < MIN((size_t)h->count, max); i++) {
+		out[i].number    = e[i].number;
+		out[i].flight_id = e[i].flight_id;
+		out[i].offset    = (off_t)e[i].first_slot *
+				   (off_t)BIN_FRAME_SIZE;
+		out[i].frames    = e[i].frames;
+		out[i].converted =
+			(e[i].flags & AURORA_BIN_SESSION_CONVERTED) != 0U;
+	}
+	return (int)MIN((size_t)h->count, max);
+}
+
+int bin_io_session_set_converted(uint32_t number)
+{
+	int rc = bin_io_sess_load();
+
+	if (rc != 0) {
+		return rc;
+	}
+
+	struct aurora_bin_session_header *h = sess_hdr(hint_buf);
+	struct aurora_bin_session_entry *e = sess_entries(hint_buf);
+
+	for (size_t i = 0; i < h->count; i++) {
+		if (e[i].number == number) {
+			e[i].flags |= AURORA_BIN_SESSION_CONVERTED;
+			return disk_access_write(BIN_DISK_NAME, hint_buf,
+						 g_io_offset_sec, 1);
+		}
+	}
+	return -ENOENT;
+}
+#endif /* CONFIG_DATA_LOGGER_DISK_SESSIONS */
+
+#if defined(CONFIG_DATA_LOGGER_CONVERT_TRAIL)
+int bin_io_live(struct data_logger_session *out, size_t *out_written)
+{
+	const struct bin_disk_ctx *ctx = &g_bin_ctx;
+	int rc = 0;
+
+	(void)k_mutex_lock(&bin_lane_lock, K_FOREVER);
+	if (!atomic_get(&g_bin_open) || ctx->owner == NULL) {
+		/* Closed, or bin_init() has not finished yet. */
+		rc = -ENODEV;
+	} else {
+		memset(out, 0, sizeof(*out));
+#if defined(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+		out->number = sess_entries(bin_sess_buf)[ctx->session].number;
+#endif
+		out->flight_id = ctx->flight_id;
+		out->offset    = (off_t)ctx->first_sec * (off_t)ctx->sector_size;
+		out->frames    = AURORA_BIN_SESSION_OPEN;
+		/* Retired batches only, so every frame below is complete. */
+		*out_written   = (size_t)ctx->cur_sector_offset *
+				 (size_t)ctx->sector_size;
+	}
+	k_mutex_unlock(&bin_lane_lock);
+	return rc;
+}
+#endif /* CONFIG_DATA_LOGGER_CONVERT_TRAIL */
+
+/* -------------------------------------------------------------------------- */
+/*  Card benchmark                                                            */
+/* -------------------------------------------------------------------------- */
+
+#if defined(CONFIG_DATA_LOGGER_DISK_BENCH)
+#define BENCH_MAX_WRITES ((uint32_t)CONFIG_DATA_LOGGER_DISK_BENCH_MAX_WRITES)
+
+/* Bytes per second the configured sample rate puts into the log. */
+#define BENCH_NEED_BPS                                                      \
+	((uint64_t)CONFIG_DATA_LOGGER_DISK_BENCH_RATE_HZ *                  \
+	 CONFIG_DATA_LOGGER_DISK_BENCH_RECORDS * BIN_REC_SIZE)
+
+static uint32_t bench_lat[BENCH_MAX_WRITES];
+
+/* Every word depends on the frame number, so a card that maps two
+ * addresses onto one block reads back the wrong frame.
+ */
+static inline uint32_t bench_word(uint32_t frame, uint32_t i)
+{
+	return (frame * 0x9E3779B9U) ^ (i * 0x85EBCA6BU) ^ 0xA5A5A5A5U;
+}
+
+static void bench_fill(uint8_t *buf, uint32_t first, uint32_t frames)
+{
+	for (uint32_t f = 0; f < frames; f++) {
+		uint32_t *w = (uint32_t *)(buf + f * BIN_FRAME_SIZE);
+
+		for (uint32_t i = 0; i < BIN_FRAME_SIZE / 4U; i++) {
+			w[i] = bench_word(first + f, i);
+		}
+	}
+}
+
+static uint32_t bench_check(const uint8_t *buf, uint32_t first,
+			    uint32_t frames)
+{
+	uint32_t bad = 0;
+
+	for (uint32_t f = 0; f < frames; f++) {
+		const uint32_t *w = (const uint32_t *)(buf + f * BIN_FRAME_SIZE);
+
+		for (uint32_t i = 0; i < BIN_FRAME_SIZE / 4U; i++) {
+			if (w[i] != bench_word(first + f, i)) {
+				bad++;
+				break;
+			}
+		}
+	}
+	return bad;
+}
+
+/* Sorts bench_lat[0..n) and returns its 99th percentile. */
+static uint32_t bench_p99(uint32_t n)
+{
+	for (uint32_t i = 1; i < n; i++) {
+		uint32_t v = bench_lat[i];
+		uint32_t j = i;
+
+		for (; j > 0U && bench_lat[j - 1U] > v; j--) {
+			bench_lat[j] = bench_lat[j - 1U];
+		}
+		bench_lat[j] = v;
+	}
+	return n > 0U ? bench_lat[(n * 99U + 99U) / 100U - 1U] : 0U;
+}
+
+static uint32_t bench_kibps(uint64_t bytes, uint64_t us)
+{
+	if (us == 0U) {
+		return UINT32_MAX;
+	}
+	return (uint32_t)MIN(bytes * USEC_PER_SEC / 1024U / us, UINT32_MAX);
+}
+
+/* Longest the sample rate takes to fill @p frames frames, in µs. */
+static uint32_t bench_fill_us(uint32_t frames)
+{
+	return (uint32_t)MIN((uint64_t)frames * BIN_FRAME_SIZE * USEC_PER_SEC /
+			     BENCH_NEED_BPS, UINT32_MAX);
+}
+
+/* One pass over the test frames; latencies land in bench_lat. */
+static int bench_pass(bool write, uint32_t first, uint32_t frames,
+		      uint32_t batch, uint32_t spf, uint64_t *total_us,
+		      uint32_t *bad)
+{
+	uint32_t n = 0;
+
+	*total_us = 0;
+	for (uint32_t done = 0; done < frames; done += batch, n++) {
+		const uint32_t k = MIN(batch, frames - done);
+		const uint32_t sec = g_io_offset_sec + (first + done) * spf;
+		uint32_t t0;
+		int rc;
+
+		if (write) {
+			bench_fill(bin_ring, first + done, k);
+		}
+
+		t0 = k_cycle_get_32();
+		rc = write ? disk_access_write(BIN_DISK_NAME, bin_ring, sec,
+					       k * spf)
+			   : disk_access_read(BIN_DISK_NAME, bin_ring, sec,
+					      k * spf);
+		bench_lat[n] = k_cyc_to_us_floor32(k_cycle_get_32() - t0);
+		*total_us += bench_lat[n];
+		if (rc != 0) {
+			LOG_ERR("bin_disk: bench %s at sector %u failed (%d)",
+				write ? "write" : "read", sec, rc);
+			return rc;
+		}
+
+		if (!write) {
+			*bad += bench_check(bin_ring, first + done, k);
+		}
+		disk_led_activity();
+	}
+	return 0;
+}
+
+/* data_logger_disk_bench – see data_logger.h */
+int data_logger_disk_bench(uint32_t frames, uint32_t batch_frames,
+			   struct data_logger_disk_bench_result *out)
+{
+	const uint32_t batch = batch_frames != 0U
+		? MIN(batch_frames, BIN_RING_FRAMES - 1U)
+		: MIN(BIN_MAX_BATCH_FRAMES, BIN_RING_FRAMES - 1U);
+	uint64_t write_us;
+	uint64_t read_us;
+	uint32_t slots;
+	uint32_t spf;
+	uint32_t writes;
+	int rc;
+
+	if (out == NULL) {
+		return -EINVAL;
+	}
+	if (frames == 0U) {
+		frames = CONFIG_DATA_LOGGER_DISK_BENCH_FRAMES;
+	}
+
+	/* The ring is the transfer buffer, and no flight may be written
+	 * meanwhile.
+	 */
+	if (!atomic_cas(&g_bin_open, 0, 1)) {
+		return -EBUSY;
+	}
+
+	rc = bin_io_open();
+	if (rc != 0) {
+		goto out;
+	}
+
+	spf   = (uint32_t)(BIN_FRAME_SIZE / g_io_sector_size);
+	slots = g_io_size_sec / spf;
+	if (slots < 2U) {
+		rc = -ENOSPC;
+		goto out_io;
+	}
+	/* Keep slot 0; it is the session catalogue or a flight's start. */
+	frames = MIN(frames, MIN(BENCH_MAX_WRITES * batch, slots - 1U));
+
+	memset(out, 0, sizeof(*out));
+	out->frames       = frames;
+	out->batch_frames = batch;
+	out->first_sector = g_io_offset_sec + (slots - frames) * spf;
+
+#if defined(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+	/* Test the end of the region, behind every kept flight. */
+	if (g_io_sector_size == BIN_SESS_SECTOR) {
+		const struct aurora_bin_session_header *h = sess_hdr(bin_ring);
+		const struct aurora_bin_session_entry *e;
+
+		rc = bin_sess_load(g_io_offset_sec, bin_ring);
+		if (rc != 0) {
+			goto out_io;
+		}
+		if (h->count > 0U) {
+			e = &sess_entries(bin_ring)[h->count - 1U];
+			if (e->frames == AURORA_BIN_SESSION_OPEN ||
+			    e->first_slot + e->frames > slots - frames) {
+				LOG_WRN("bin_disk: bench would overwrite "
+					"flight %u", e->number);
+				rc = -ENOSPC;
+				goto out_io;
+			}
+		}
+	}
+#endif /* CONFIG_DATA_LOGGER_DISK_SESSIONS */
+
+	writes = DIV_ROUND_UP(frames, batch);
+	out->writes = writes;
+
+	rc = bench_pass(true, slots - frames, frames, batch, spf, &write_us,
+			NULL);
+	if (rc != 0) {
+		goto out_io;
+	}
+	out->write_kibps  = bench_kibps((uint64_t)frames * BIN_FRAME_SIZE,
+					write_us);
+	out->write_p99_us = bench_p99(writes);
+	out->write_max_us = bench_lat[writes - 1U];
+
+	rc = bench_pass(false, slots - frames, frames, batch, spf, &read_us,
+			&out->bad_frames);
+	if (rc != 0) {
+		goto out_io;
+	}
+	out->read_kibps  = bench_kibps((uint64_t)frames * BIN_FRAME_SIZE,
+				       read_us);
+	out->read_p99_us = bench_p99(writes);
+	out->read_max_us = bench_lat[writes - 1U];
+
+	/* While a batch is written the producer fills the slots left, so
+	 * the slowest write must fit in the time they take to fill, and
+	 * a typical one in the time one batch takes.
+	 */
+	out->need_kibps = (uint32_t)DIV_ROUND_UP(BENCH_NEED_BPS, 1024U);
+	out->batch_us   = bench_fill_us(batch);
+	out->ring_us    = bench_fill_us(BIN_RING_FRAMES - batch);
+	out->pass = out->bad_frames == 0U &&
+		    (write_us == 0U ||
+		     (uint64_t)frames * BIN_FRAME_SIZE * USEC_PER_SEC /
+		     write_us * 100U >=
+		     BENCH_NEED_BPS * CONFIG_DATA_LOGGER_DISK_BENCH_MARGIN_PCT) &&
+		    out->write_p99_us <= out->batch_us &&
+		    out->write_max_us <= out->ring_us;
+
+out_io:
+	(void)bin_io_close();
+out:
+	atomic_set(&g_bin_open, 0);
+	return rc;
 }
+#endif /* CONFIG_DATA_LOGGER_DISK_BENCH */
@@ -19,6 +19,10 @@
  * (Zephyr sensor_value convention). The timestamp is the first sample in
  * the cluster, in nanoseconds.
  *
+ * With CONFIG_DATA_LOGGER_CONVERT_LZ4 the file is an LZ4 frame
+ * (FLIGHT_<n>.csv.lz4): each staging-buffer drain is compressed on its
+ * way out, see fmt_lz4.h.
+ *
  * Copyright (c) 2026 Auxspace e.V.
  *
  * SPDX-License-Identifier: Apache-2.0
@@ -26,9 +30,7 @@
 
 #include <errno.h>
 #include <stdbool.h>
-#include <stdio.h>
 #include <string.h>
-#include <inttypes.h>
 
 #include <zephyr/kernel.h>
 #include <zephyr/fs/fs.h>
@@ -36,6 +38,9 @@
 
 #include <aurora/lib/data_logger.h>
 
+#include "fmt_lz4.h"
+#include "fmt_num.h"
+
 LOG_MODULE_DECLARE(data_logger, CONFIG_DATA_LOGGER_LOG_LEVEL);
 
 #ifndef CONFIG_DATA_LOGGER_CSV_WINDOW_NS
@@ -68,6 +73,9 @@ static const struct csv_column csv_columns[] = {
 	{ AURORA_DATA_IMU_MAG,       0, "mag_x" },
 	{ AURORA_DATA_IMU_MAG,       1, "mag_y" },
 	{ AURORA_DATA_IMU_MAG,       2, "mag_z" },
+	{ AURORA_DATA_PYRO_FIRE,     0, "pyro_fire_channel" },
+	{ AURORA_DATA_PYRO_FIRE,     2, "pyro_fire_delay_ms" },
+	{ AURORA_DATA_PYRO_FIRE,     1, "pyro_fire_latency_ms" },
 	{ AURORA_DATA_SM_KINEMATICS, 0, "sm_kinematics_accel" },
 	{ AURORA_DATA_SM_KINEMATICS, 1, "sm_kinematics_accel_vert" },
 	{ AURORA_DATA_SM_KINEMATICS, 2, "sm_kinematics_velocity" },
@@ -122,7 +130,7 @@ static int buf_drain(struct csv_ctx *ctx)
 	if (ctx->used == 0) {
 		return 0;
 	}
-	ssize_t wr = fs_write(&ctx->file, ctx->buf, ctx->used);
+	ssize_t wr = fmt_out_write(&ctx->file, ctx->buf, ctx->used);
 
 	if (wr < 0) {
 		return (int)wr;
@@ -139,7 +147,7 @@ static int write_all(struct csv_ctx *ctx, const char *src, size_t len)
 		if (rc != 0) {
 			return rc;
 		}
-		ssize_t wr = fs_write(&ctx->file, src, len);
+		ssize_t wr = fmt_out_write(&ctx->file, src, len);
 
 		return wr < 0 ? (int)wr : 0;
 	}
@@ -155,58 +163,41 @@ static int write_all(struct csv_ctx *ctx, const char *src, size_t len)
 	return 0;
 }
 
-static int format_sensor_value(char *buf, size_t bufsz,
-			       const struct sensor_value *sv)
-{
-	if (sv->val1 < 0 || sv->val2 < 0) {
-		return snprintf(buf, bufsz, "-%d.%06d",
-				-(int)sv->val1, -(int)sv->val2);
-	}
-	return snprintf(buf, bufsz, "%d.%06d",
-			(int)sv->val1, (int)sv->val2);
-}
+/* Worst-case row: timestamp, then a separator and a value per column. */
+#define CSV_ROW_MAX \
+	(FMT_NUM_U64_MAX + CSV_COLUMN_COUNT * (1U + FMT_NUM_SV_MAX) + 1U)
+
+BUILD_ASSERT(CONFIG_DATA_LOGGER_CSV_BUF_SIZE >= CSV_ROW_MAX,
+	     "CSV staging buffer must hold at least one worst-case row");
 
+/* Rows are formatted straight into the staging buffer; it is drained
+ * first whenever less than a worst-case row of room is left.
+ */
 static int flush_row(struct csv_ctx *ctx)
 {
 	if (!ctx->group_active) {
 		return 0;
 	}
 
-	char buf[32];
-	int len;
-	int rc;
-
-	len = snprintf(buf, sizeof(buf), "%" PRIu64, ctx->group_start_ns);
-	if (len < 0 || len >= (int)sizeof(buf)) {
-		return -ENOMEM;
-	}
-	rc = write_all(ctx, buf, len);
-	if (rc != 0) {
-		return rc;
-	}
+	if (CONFIG_DATA_LOGGER_CSV_BUF_SIZE - ctx->used < CSV_ROW_MAX) {
+		int rc = buf_drain(ctx);
 
-	for (size_t i = 0; i < CSV_COLUMN_COUNT; i++) {
-		rc = write_all(ctx, ",", 1);
 		if (rc != 0) {
 			return rc;
 		}
-		if (ctx->present[i]) {
-			len = format_sensor_value(buf, sizeof(buf),
-						  &ctx->values[i]);
-			if (len < 0 || len >= (int)sizeof(buf)) {
-				return -ENOMEM;
-			}
-			rc = write_all(ctx, buf, len);
-			if (rc != 0) {
-				return rc;
-			}
-		}
 	}
 
-	rc = write_all(ctx, "\n", 1);
-	if (rc != 0) {
-		return rc;
+	char *dst = ctx->buf + ctx->used;
+	size_t len = fmt_num_u64(dst, ctx->group_start_ns);
+
+	for (size_t i = 0; i < CSV_COLUMN_COUNT; i++) {
+		dst[len++] = ',';
+		if (ctx->present[i]) {
+			len += fmt_num_sensor_value(dst + len, &ctx->values[i]);
+		}
 	}
+	dst[len++] = '\n';
+	ctx->used += len;
 
 	ctx->group_active = false;
 	memset(ctx->present, 0, sizeof(ctx->present));
@@ -236,6 +227,13 @@ static int csv_init(struct data_logger *logger, const char *path)
 		return rc;
 	}
 
+	rc = fmt_lz4_begin(&ctx->file);
+	if (rc != 0) {
+		(void)fs_close(&ctx->file);
+		k_free(ctx);
+		return rc;
+	}
+
 	ctx->buf = csv_write_buf;
 	ctx->used = 0;
 	logger->ctx = ctx;
@@ -272,6 +270,14 @@ static int csv_write_datapoint(struct data_logger *logger,
 	struct csv_ctx *ctx = logger->ctx;
 	int rc;
 
+	/* The audit trail has its own conversion target, and thread
+	 * health is one record per thread, which has no column.
+	 */
+	if (dp->type == AURORA_DATA_SM_AUDIT ||
+	    dp->type == AURORA_DATA_THREAD_HEALTH) {
+		return 0;
+	}
+
 	/* Close out the current row if this datapoint falls outside the
 	 * grouping window. Comparing as uint64_t handles the (unexpected)
 	 * case of timestamps moving backwards by wrapping to a huge delta,
@@ -305,6 +311,20 @@ static int csv_write_datapoint(struct data_logger *logger,
 	return 0;
 }
 
+static int csv_write_datapoints(struct data_logger *logger,
+				const struct datapoint *dps, size_t n)
+{
+	for (size_t i = 0; i < n; i++) {
+		int rc = csv_write_datapoint(logger, &dps[i]);
+
+		if (rc != 0) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
 static int csv_flush(struct data_logger *logger)
 {
 	struct csv_ctx *ctx = logger->ctx;
@@ -326,6 +346,7 @@ static int csv_close(struct data_logger *logger)
 
 	(void)flush_row(ctx);
 	(void)buf_drain(ctx);
+	(void)fmt_lz4_end(&ctx->file);
 
 	int rc = fs_close(&ctx->file);
 
@@ -343,8 +364,9 @@ const struct data_logger_formatter data_logger_csv_formatter = {
 	.init            = csv_init,
 	.write_header    = csv_write_header,
 	.write_datapoint = csv_write_datapoint,
+	.write_datapoints = csv_write_datapoints,
 	.flush           = csv_flush,
 	.close           = csv_close,
-	.file_ext        = "csv",
+	.file_ext        = FMT_OUT_EXT("csv"),
 	.name            = "csv",
 };
@@ -18,22 +18,32 @@
  *   gyro  → x, y, z
  *   mag   → x, y, z
  *
+ * Thread-health records name their thread in a tag instead:
+ *   telemetry,type=thread_health,thread=imu_polling load=0.012345,stack_used=812 ...
+ *
+ * With CONFIG_DATA_LOGGER_CONVERT_LZ4 the file is an LZ4 frame
+ * (FLIGHT_<n>.influx.lz4), compressed one staging buffer at a time; see
+ * fmt_lz4.h.
+ *
  * Copyright (c) 2026 Auxspace e.V.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <ctype.h>
 #include <errno.h>
-#include <stdio.h>
 #include <string.h>
-#include <inttypes.h>
 
 #include <zephyr/kernel.h>
 #include <zephyr/fs/fs.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
 
 #include <aurora/lib/data_logger.h>
 
+#include "fmt_lz4.h"
+#include "fmt_num.h"
+
 LOG_MODULE_DECLARE(data_logger, CONFIG_DATA_LOGGER_LOG_LEVEL);
 
 /* -------------------------------------------------------------------------- */
@@ -51,6 +61,8 @@ static const char *field_names_for(enum aurora_data type, int channel)
 						   NULL};
 	static const char *const or_fields[]  = {"yaw", "pitch", "roll"};
 	static const char *const vbat_fields[]  = {"voltage"};
+	static const char *const pyro_fields[]  = {"channel", "latency_ms",
+						   "delay_ms"};
 
 	switch (type) {
 	case AURORA_DATA_BARO:
@@ -67,6 +79,8 @@ static const char *field_names_for(enum aurora_data type, int channel)
 		return (channel < 3) ? or_fields[channel] : "unknown";
 	case AURORA_DATA_VBAT:
 		return (channel < 1) ? vbat_fields[channel] : "unknown";
+	case AURORA_DATA_PYRO_FIRE:
+		return (channel < 3) ? pyro_fields[channel] : "unknown";
 	default:
 		return "unknown";
 	}
@@ -78,6 +92,9 @@ static const char *field_names_for(enum aurora_data type, int channel)
 
 static char influx_write_buf[CONFIG_DATA_LOGGER_INFLUX_BUF_SIZE];
 
+/* Longest line influx_format_line() may produce; longer ones are dropped. */
+#define INFLUX_LINE_MAX 256
+
 struct influx_ctx {
 	struct fs_file_t file;
 	char *buf;
@@ -108,6 +125,13 @@ static int influx_init(struct data_logger *logger, const char *path)
 		return rc;
 	}
 
+	rc = fmt_lz4_begin(&ctx->file);
+	if (rc != 0) {
+		(void)fs_close(&ctx->file);
+		k_free(ctx);
+		return rc;
+	}
+
 	logger->ctx = ctx;
 	return 0;
 }
@@ -119,64 +143,140 @@ static int influx_write_header(struct data_logger *logger)
 	return 0;
 }
 
+/* Append @p len bytes of @p src at @p *off, or fail if they don't fit. */
+static inline int put_bytes(char *dst, size_t dst_size, size_t *off,
+			    const char *src, size_t len)
+{
+	if (dst_size - *off < len) {
+		return -ENOMEM;
+	}
+	memcpy(dst + *off, src, len);
+	*off += len;
+	return 0;
+}
+
+static const char measurement[] = CONFIG_DATA_LOGGER_INFLUX_MEASUREMENT;
+
+/* Append " <timestamp_ns>\n". */
+static int put_timestamp(char *dst, size_t dst_size, size_t *off,
+			 uint64_t timestamp_ns)
+{
+	if (dst_size - *off < 1U + FMT_NUM_U64_MAX + 1U) {
+		return -ENOMEM;
+	}
+	dst[(*off)++] = ' ';
+	*off += fmt_num_u64(dst + *off, timestamp_ns);
+	dst[(*off)++] = '\n';
+	return 0;
+}
+
+/* Thread-health record (layout in data_logger.h). Name bytes other than
+ * letters, digits and '_' become '_', so the tag needs no escaping.
+ */
+static int influx_format_health(char *dst, size_t dst_size,
+				const struct datapoint *dp)
+{
+	static const char head[] = ",type=thread_health,thread=";
+	uint8_t name[AURORA_HEALTH_NAME_MAX];
+	const int32_t ppm = dp->channels[2].val2;
+	const struct sensor_value load = {
+		.val1 = ppm / 1000000,
+		.val2 = ppm % 1000000,
+	};
+	size_t len = 0;
+	size_t off = 0;
+
+	if (dp->channel_count < DP_MAX_CHANNELS) {
+		return 0;
+	}
+
+	sys_put_le32((uint32_t)dp->channels[0].val1, &name[0]);
+	sys_put_le32((uint32_t)dp->channels[0].val2, &name[4]);
+	sys_put_le32((uint32_t)dp->channels[1].val1, &name[8]);
+	sys_put_le32((uint32_t)dp->channels[1].val2, &name[12]);
+	while (len < sizeof(name) && name[len] != '\0') {
+		if (!isalnum(name[len]) && name[len] != '_') {
+			name[len] = '_';
+		}
+		len++;
+	}
+	if (len == 0) {
+		name[len++] = '_';
+	}
+
+	if (put_bytes(dst, dst_size, &off, measurement,
+		      sizeof(measurement) - 1U) != 0 ||
+	    put_bytes(dst, dst_size, &off, head, sizeof(head) - 1U) != 0 ||
+	    put_bytes(dst, dst_size, &off, (const char *)name, len) != 0 ||
+	    put_bytes(dst, dst_size, &off, " load=", 6) != 0 ||
+	    dst_size - off < FMT_NUM_SV_MAX) {
+		return -ENOMEM;
+	}
+	off += fmt_num_sensor_value(dst + off, &load);
+	if (put_bytes(dst, dst_size, &off, ",stack_used=", 12) != 0 ||
+	    dst_size - off < FMT_NUM_U32_MAX) {
+		return -ENOMEM;
+	}
+	off += fmt_num_u32(dst + off, (uint32_t)dp->channels[2].val1);
+
+	if (put_timestamp(dst, dst_size, &off, dp->timestamp_ns) != 0) {
+		return -ENOMEM;
+	}
+	return (int)off;
+}
+
 static int influx_format_line(char *dst, size_t dst_size,
 			      const struct datapoint *dp)
 {
-	int offset = 0;
-	int n;
+	const char *type_name = data_logger_type_name(dp->type);
+	size_t off = 0;
+
+	/* The audit trail has its own conversion target. */
+	if (dp->type == AURORA_DATA_SM_AUDIT) {
+		return 0;
+	}
+	if (dp->type == AURORA_DATA_THREAD_HEALTH) {
+		return influx_format_health(dst, dst_size, dp);
+	}
 
 	/* measurement,type=<name> */
-	n = snprintf(dst + offset, dst_size - offset,
-		     "%s,type=%s ",
-		     CONFIG_DATA_LOGGER_INFLUX_MEASUREMENT,
-		     data_logger_type_name(dp->type));
-	if (n < 0 || n >= (int)(dst_size - offset)) {
+	if (put_bytes(dst, dst_size, &off, measurement,
+		      sizeof(measurement) - 1U) != 0 ||
+	    put_bytes(dst, dst_size, &off, ",type=", 6) != 0 ||
+	    put_bytes(dst, dst_size, &off, type_name, strlen(type_name)) != 0 ||
+	    put_bytes(dst, dst_size, &off, " ", 1) != 0) {
 		return -ENOMEM;
 	}
-	offset += n;
 
 	/* fields: name=val1.val2 (comma-separated, six decimal places) */
 	for (int i = 0; i < dp->channel_count && i < DP_MAX_CHANNELS; i++) {
-		const struct sensor_value *sv = &dp->channels[i];
 		const char *fname = field_names_for(dp->type, i);
-		int32_t v1 = sv->val1;
-		int32_t v2 = sv->val2;
-
-		if (v1 < 0 || v2 < 0) {
-			n = snprintf(dst + offset, dst_size - offset,
-				     "%s%s=-%d.%06d",
-				     i > 0 ? "," : "",
-				     fname, -v1, -v2);
-		} else {
-			n = snprintf(dst + offset, dst_size - offset,
-				     "%s%s=%d.%06d",
-				     i > 0 ? "," : "",
-				     fname, v1, v2);
-		}
 
-		if (n < 0 || n >= (int)(dst_size - offset)) {
+		if (fname == NULL) {
+			fname = "unknown";
+		}
+		if ((i > 0 && put_bytes(dst, dst_size, &off, ",", 1) != 0) ||
+		    put_bytes(dst, dst_size, &off, fname, strlen(fname)) != 0 ||
+		    put_bytes(dst, dst_size, &off, "=", 1) != 0 ||
+		    dst_size - off < FMT_NUM_SV_MAX) {
 			return -ENOMEM;
 		}
-
-		offset += n;
+		off += fmt_num_sensor_value(dst + off, &dp->channels[i]);
 	}
 
 	/* timestamp in nanoseconds */
-	n = snprintf(dst + offset, dst_size - offset,
-		     " %" PRIu64 "\n", dp->timestamp_ns);
-	if (n < 0 || n >= (int)(dst_size - offset)) {
+	if (put_timestamp(dst, dst_size, &off, dp->timestamp_ns) != 0) {
 		return -ENOMEM;
 	}
-	offset += n;
 
-	return offset;
+	return (int)off;
 }
 
 static int influx_write_datapoint(struct data_logger *logger,
 				  const struct datapoint *dp)
 {
 	struct influx_ctx *ctx = logger->ctx;
-	char line[256];
+	char line[INFLUX_LINE_MAX];
 
 	int len = influx_format_line(line, sizeof(line), dp);
 
@@ -188,7 +288,7 @@ static int influx_write_datapoint(struct data_logger *logger,
 
 	/* Flush the RAM buffer to disk if the new line would not fit */
 	if (ctx->used + len > CONFIG_DATA_LOGGER_INFLUX_BUF_SIZE) {
-		ssize_t wr = fs_write(&ctx->file, ctx->buf, ctx->used);
+		ssize_t wr = fmt_out_write(&ctx->file, ctx->buf, ctx->used);
 
 		if (wr < 0) {
 			return (int)wr;
@@ -198,7 +298,7 @@ static int influx_write_datapoint(struct data_logger *logger,
 
 	/* If a single line exceeds the entire buffer, write it directly */
 	if (len > (int)CONFIG_DATA_LOGGER_INFLUX_BUF_SIZE) {
-		ssize_t wr = fs_write(&ctx->file, line, len);
+		ssize_t wr = fmt_out_write(&ctx->file, line, len);
 
 		return wr < 0 ? (int)wr : 0;
 	}
@@ -208,12 +308,57 @@ static int influx_write_datapoint(struct data_logger *logger,
 	return 0;
 }
 
+/* Batch path: lines are formatted straight into the staging buffer
+ * instead of bouncing through a stack copy.  The buffer is drained
+ * whenever less than a worst-case line of room is left.
+ */
+static int influx_write_datapoints(struct data_logger *logger,
+				   const struct datapoint *dps, size_t n)
+{
+	struct influx_ctx *ctx = logger->ctx;
+
+	if (CONFIG_DATA_LOGGER_INFLUX_BUF_SIZE < INFLUX_LINE_MAX) {
+		for (size_t i = 0; i < n; i++) {
+			int rc = influx_write_datapoint(logger, &dps[i]);
+
+			if (rc != 0) {
+				return rc;
+			}
+		}
+		return 0;
+	}
+
+	for (size_t i = 0; i < n; i++) {
+		if (CONFIG_DATA_LOGGER_INFLUX_BUF_SIZE - ctx->used <
+		    INFLUX_LINE_MAX) {
+			ssize_t wr = fmt_out_write(&ctx->file, ctx->buf, ctx->used);
+
+			if (wr < 0) {
+				return (int)wr;
+			}
+			ctx->used = 0;
+		}
+
+		int len = influx_format_line(ctx->buf + ctx->used,
+					     INFLUX_LINE_MAX, &dps[i]);
+
+		if (len < 0) {
+			LOG_WRN("influx line truncated for type %s",
+				data_logger_type_name(dps[i].type));
+			return len;
+		}
+		ctx->used += len;
+	}
+
+	return 0;
+}
+
 static int influx_flush(struct data_logger *logger)
 {
 	struct influx_ctx *ctx = logger->ctx;
 
 	if (ctx->used > 0) {
-		ssize_t wr = fs_write(&ctx->file, ctx->buf, ctx->used);
+		ssize_t wr = fmt_out_write(&ctx->file, ctx->buf, ctx->used);
 
 		if (wr < 0) {
 			return (int)wr;
@@ -230,9 +375,10 @@ static int influx_close(struct data_logger *logger)
 
 	/* Drain remaining buffered data before closing */
 	if (ctx->used > 0) {
-		fs_write(&ctx->file, ctx->buf, ctx->used);
+		fmt_out_write(&ctx->file, ctx->buf, ctx->used);
 		ctx->used = 0;
 	}
+	(void)fmt_lz4_end(&ctx->file);
 
 	int rc = fs_close(&ctx->file);
 
@@ -250,8 +396,9 @@ const struct data_logger_formatter data_logger_influx_formatter = {
 	.init            = influx_init,
 	.write_header    = influx_write_header,
 	.write_datapoint = influx_write_datapoint,
+	.write_datapoints = influx_write_datapoints,
 	.flush           = influx_flush,
 	.close           = influx_close,
-	.file_ext        = "influx",
+	.file_ext        = FMT_OUT_EXT("influx"),
 	.name            = "influx",
 };
@@ -0,0 +1,214 @@
+/**
+ * @file fmt_lz4.c
+ * @brief Bounded-RAM LZ4 frame writer for the text formatters.
+ *
+ * See fmt_lz4.h.  The block compressor is the greedy single-probe LZ4
+ * scheme: a 4-byte hash of the input points at the last position with
+ * the same hash, a hit is extended both ways, and misses advance faster
+ * the longer no match has been found.  CSV and line-protocol text is
+ * mostly repeated tags, field names and leading digits, which this
+ * catches well enough to shrink the files several times over.
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "fmt_lz4.h"
+
+#define LZ4_FRAME_MAGIC  0x184D2204U
+#define LZ4_BLOCK_RAW    0x80000000U
+
+/* Format limits from the LZ4 block specification: a match is at least
+ * four bytes, the last five bytes are always literals, and the last
+ * match starts at least twelve bytes before the end of the block.
+ */
+#define LZ4_MINMATCH     4
+#define LZ4_LASTLITERALS 5
+#define LZ4_MFLIMIT      12
+
+#define LZ4_HASH_LOG     12
+
+#define LZ4_BLOCK_SIZE   CONFIG_DATA_LOGGER_LZ4_BLOCK_SIZE
+#define LZ4_BOUND(n)     ((n) + (n) / 255U + 16U)
+
+/* Table entries are 16-bit block offsets, so every match is in range. */
+BUILD_ASSERT(LZ4_BLOCK_SIZE <= 65536, "LZ4 block offsets must fit 16 bits");
+
+static uint16_t lz4_table[1U << LZ4_HASH_LOG];
+static uint8_t lz4_out[4U + LZ4_BOUND(LZ4_BLOCK_SIZE)];
+
+/* CSV and Influx may be converted from different threads. */
+static K_MUTEX_DEFINE(lz4_lock);
+
+static inline uint32_t get32(const uint8_t *p)
+{
+	return sys_get_le32(p);
+}
+
+static inline uint32_t lz4_hash(uint32_t v)
+{
+	return (v * 2654435761U) >> (32 - LZ4_HASH_LOG);
+}
+
+static uint8_t *put_len(uint8_t *op, size_t len)
+{
+	while (len >= 255U) {
+		*op++ = 255U;
+		len -= 255U;
+	}
+	*op++ = (uint8_t)len;
+	return op;
+}
+
+static uint8_t *put_sequence(uint8_t *op, const uint8_t *lit, size_t lit_len,
+			     size_t offset, size_t match_len)
+{
+	uint8_t *token = op++;
+
+	*token = (uint8_t)((lit_len >= 15U ? 15U : lit_len) << 4);
+	if (lit_len >= 15U) {
+		op = put_len(op, lit_len - 15U);
+	}
+	memcpy(op, lit, lit_len);
+	op += lit_len;
+
+	if (offset == 0) {
+		/* Last literals: no match follows. */
+		return op;
+	}
+
+	sys_put_le16((uint16_t)offset, op);
+	op += 2;
+	match_len -= LZ4_MINMATCH;
+	*token |= (uint8_t)(match_len >= 15U ? 15U : match_len);
+	if (match_len >= 15U) {
+		op = put_len(op, match_len - 15U);
+	}
+	return op;
+}
+
+/* Compress @p n bytes into @p dst (room for LZ4_BOUND(n)); returns the
+ * compressed size.
+ */
+static size_t compress_block(const uint8_t *src, size_t n, uint8_t *dst)
+{
+	const uint8_t *const iend = src + n;
+	const uint8_t *ip = src;
+	const uint8_t *anchor = src;
+	uint8_t *op = dst;
+
+	if (n > LZ4_MFLIMIT) {
+		const uint8_t *const mflimit = iend - LZ4_MFLIMIT;
+		const uint8_t *const matchlimit = iend - LZ4_LASTLITERALS;
+
+		memset(lz4_table, 0, sizeof(lz4_table));
+
+		while (ip <= mflimit) {
+			const uint32_t seq = get32(ip);
+			const uint32_t h = lz4_hash(seq);
+			const uint8_t *ref = src + lz4_table[h];
+
+			lz4_table[h] = (uint16_t)(ip - src);
+			if (ref >= ip || get32(ref) != seq) {
+				ip += 1 + ((ip - anchor) >> 6);
+				continue;
+			}
+
+			while (ip > anchor && ref > src && ip[-1] == ref[-1]) {
+				ip--;
+				ref--;
+			}
+
+			const uint8_t *end = ip + LZ4_MINMATCH;
+			const uint8_t *r = ref + LZ4_MINMATCH;
+
+			while (end < matchlimit && *end == *r) {
+				end++;
+				r++;
+			}
+
+			op = put_sequence(op, anchor, (size_t)(ip - anchor),
+					  (size_t)(ip - ref), (size_t)(end - ip));
+			anchor = ip = end;
+		}
+	}
+
+	op = put_sequence(op, anchor, (size_t)(iend - anchor), 0, 0);
+	return (size_t)(op - dst);
+}
+
+/* fmt_lz4_begin – see fmt_lz4.h */
+int fmt_lz4_begin(struct fs_file_t *file)
+{
+	/* Version 1, independent blocks, no checksums, no content size,
+	 * 64 KiB maximum block; the last byte is the header checksum
+	 * (xxh32 of FLG BD, second byte).
+	 */
+	uint8_t hdr[7] = { 0, 0, 0, 0, 0x60, 0x40, 0x82 };
+	ssize_t wr;
+
+	sys_put_le32(LZ4_FRAME_MAGIC, hdr);
+	wr = fs_write(file, hdr, sizeof(hdr));
+	if (wr < 0) {
+		return (int)wr;
+	}
+	return wr == sizeof(hdr) ? 0 : -EIO;
+}
+
+/* fmt_lz4_write – see fmt_lz4.h */
+ssize_t fmt_lz4_write(struct fs_file_t *file, const void *src, size_t len)
+{
+	const uint8_t *in = src;
+	size_t left = len;
+	ssize_t rc = (ssize_t)len;
+
+	k_mutex_lock(&lz4_lock, K_FOREVER);
+	while (left > 0) {
+		const size_t n = MIN(left, (size_t)LZ4_BLOCK_SIZE);
+		size_t clen = compress_block(in, n, lz4_out + 4);
+		uint32_t word = (uint32_t)clen;
+
+		if (clen >= n) {
+			memcpy(lz4_out + 4, in, n);
+			clen = n;
+			word = (uint32_t)n | LZ4_BLOCK_RAW;
+		}
+		sys_put_le32(word, lz4_out);
+
+		ssize_t wr = fs_write(file, lz4_out, 4 + clen);
+
+		if (wr < 0) {
+			rc = wr;
+			break;
+		}
+		if ((size_t)wr != 4 + clen) {
+			rc = -EIO;
+			break;
+		}
+		in += n;
+		left -= n;
+	}
+	k_mutex_unlock(&lz4_lock);
+
+	return rc;
+}
+
+/* fmt_lz4_end – see fmt_lz4.h */
+int fmt_lz4_end(struct fs_file_t *file)
+{
+	static const uint8_t end_mark[4];
+	ssize_t wr = fs_write(file, end_mark, sizeof(end_mark));
+
+	if (wr < 0) {
+		return (int)wr;
+	}
+	return wr == sizeof(end_mark) ? 0 : -EIO;
+}
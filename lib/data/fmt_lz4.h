@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Backend-private LZ4 frame output shared by the text formatters
+ * (fmt_csv.c / fmt_influx.c).  With CONFIG_DATA_LOGGER_CONVERT_LZ4 their
+ * staging buffers are compressed on the way to the file instead of being
+ * written as-is; the result is a standard LZ4 frame (independent blocks,
+ * no checksums) that the stock lz4 tool and tools/aurora_lz4.py unpack.
+ *
+ * Every block is compressed on its own, so the only RAM is one hash
+ * table and one worst-case output block, both static and independent
+ * of the file length.  A file cut short by a power loss still decodes
+ * up to its last complete block.
+ */
+
+#ifndef AURORA_LIB_DATA_FMT_LZ4_H_
+#define AURORA_LIB_DATA_FMT_LZ4_H_
+
+#include <stddef.h>
+#include <sys/types.h>
+
+#include <zephyr/fs/fs.h>
+
+#if defined(CONFIG_DATA_LOGGER_CONVERT_LZ4)
+
+/** Append ".lz4" to a formatter's file extension. */
+#define FMT_OUT_EXT(ext) ext ".lz4"
+
+/** Write the LZ4 frame header to the freshly opened @p file. */
+int fmt_lz4_begin(struct fs_file_t *file);
+
+/**
+ * Compress @p len bytes into one or more blocks of at most
+ * CONFIG_DATA_LOGGER_LZ4_BLOCK_SIZE and append them to @p file.
+ *
+ * @return @p len, or negative errno.
+ */
+ssize_t fmt_lz4_write(struct fs_file_t *file, const void *src, size_t len);
+
+/** Write the frame end mark; call before fs_close(). */
+int fmt_lz4_end(struct fs_file_t *file);
+
+#else
+
+#define FMT_OUT_EXT(ext) ext
+
+static inline int fmt_lz4_begin(struct fs_file_t *file)
+{
+	(void)file;
+	return 0;
+}
+
+static inline int fmt_lz4_end(struct fs_file_t *file)
+{
+	(void)file;
+	return 0;
+}
+
+#endif /* CONFIG_DATA_LOGGER_CONVERT_LZ4 */
+
+/** fs_write() for the text formatters, through LZ4 when enabled. */
+static inline ssize_t fmt_out_write(struct fs_file_t *file, const void *src,
+				    size_t len)
+{
+#if defined(CONFIG_DATA_LOGGER_CONVERT_LZ4)
+	return fmt_lz4_write(file, src, len);
+#else
+	return fs_write(file, src, len);
+#endif
+}
+
+#endif /* AURORA_LIB_DATA_FMT_LZ4_H_ */
@@ -0,0 +1,109 @@
+/**
+ * @file fmt_num.c
+ * @brief Table-driven integer and sensor_value to decimal conversion.
+ *
+ * See fmt_num.h.  Every digit pair comes from one 200-byte table, so a
+ * six-digit fraction costs three 32-bit divisions by 100 instead of a
+ * trip through the printf machinery.
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "fmt_num.h"
+
+static const char digit_pairs[200] = {
+	"0001020304050607080910111213141516171819"
+	"2021222324252627282930313233343536373839"
+	"4041424344454647484950515253545556575859"
+	"6061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899"
+};
+
+static const uint32_t pow10_u32[FMT_NUM_U32_MAX] = {
+	1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U,
+	100000000U, 1000000000U,
+};
+
+static inline size_t u32_digits(uint32_t v)
+{
+	size_t n = 1;
+
+	while (n < FMT_NUM_U32_MAX && v >= pow10_u32[n]) {
+		n++;
+	}
+	return n;
+}
+
+/* Write exactly @p width digits of @p v (v < 10^width), back to front. */
+static void put_fixed(char *dst, uint32_t v, size_t width)
+{
+	char *p = dst + width;
+
+	while (width >= 2U) {
+		const char *d = &digit_pairs[(v % 100U) * 2U];
+
+		v /= 100U;
+		*--p = d[1];
+		*--p = d[0];
+		width -= 2U;
+	}
+	if (width != 0U) {
+		*--p = (char)('0' + v);
+	}
+}
+
+size_t fmt_num_u32(char *dst, uint32_t v)
+{
+	size_t n = u32_digits(v);
+
+	put_fixed(dst, v, n);
+	return n;
+}
+
+size_t fmt_num_u64(char *dst, uint64_t v)
+{
+	uint32_t low[2];
+	int groups = 0;
+
+	/* Peel off 8-digit groups until the rest fits 32 bits; UINT64_MAX
+	 * needs two.
+	 */
+	while (v > UINT32_MAX) {
+		uint64_t q = v / 100000000ULL;
+
+		low[groups++] = (uint32_t)(v - q * 100000000ULL);
+		v = q;
+	}
+
+	size_t n = fmt_num_u32(dst, (uint32_t)v);
+
+	while (groups > 0) {
+		put_fixed(dst + n, low[--groups], 8U);
+		n += 8U;
+	}
+	return n;
+}
+
+size_t fmt_num_sensor_value(char *dst, const struct sensor_value *sv)
+{
+	/* Magnitudes via unsigned negation so INT32_MIN cannot overflow. */
+	uint32_t ip = sv->val1 < 0 ? 0U - (uint32_t)sv->val1 : (uint32_t)sv->val1;
+	uint32_t fp = sv->val2 < 0 ? 0U - (uint32_t)sv->val2 : (uint32_t)sv->val2;
+	size_t n = 0;
+
+	if (sv->val1 < 0 || sv->val2 < 0) {
+		dst[n++] = '-';
+	}
+	n += fmt_num_u32(dst + n, ip);
+	dst[n++] = '.';
+
+	if (fp < 1000000U) {
+		put_fixed(dst + n, fp, 6U);
+		n += 6U;
+	} else {
+		n += fmt_num_u32(dst + n, fp);
+	}
+	return n;
+}
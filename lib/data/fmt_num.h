@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Backend-private decimal formatting shared by the text formatters
+ * (fmt_csv.c / fmt_influx.c).  Replaces the per-channel snprintf() calls
+ * on the conversion hot path: digits are emitted two at a time from a
+ * lookup table straight into the caller's buffer, and 64-bit values
+ * cost at most two 64-bit divisions.
+ *
+ * None of the functions NUL-terminate; they return the number of
+ * characters written, and the caller must provide the documented
+ * worst-case room.
+ */
+
+#ifndef AURORA_LIB_DATA_FMT_NUM_H_
+#define AURORA_LIB_DATA_FMT_NUM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/drivers/sensor.h>
+
+/** Longest output of @ref fmt_num_u32 (UINT32_MAX). */
+#define FMT_NUM_U32_MAX 10U
+
+/** Longest output of @ref fmt_num_u64 (UINT64_MAX). */
+#define FMT_NUM_U64_MAX 20U
+
+/** Longest output of @ref fmt_num_sensor_value: sign, int, '.', fraction. */
+#define FMT_NUM_SV_MAX  (1U + FMT_NUM_U32_MAX + 1U + FMT_NUM_U32_MAX)
+
+/** Write @p v in decimal to @p dst. */
+size_t fmt_num_u32(char *dst, uint32_t v);
+
+/** Write @p v in decimal to @p dst. */
+size_t fmt_num_u64(char *dst, uint64_t v);
+
+/**
+ * Write @p sv as "[-]val1.val2" with val2 zero-padded to six digits
+ * (the Zephyr sensor_value convention, same as "%d.%06d").  A negative
+ * val1 or val2 makes the whole value negative.
+ */
+size_t fmt_num_sensor_value(char *dst, const struct sensor_value *sv);
+
+#endif /* AURORA_LIB_DATA_FMT_NUM_H_ */
@@ -0,0 +1,81 @@
+/**
+ * @file filter.c
+ * @brief Backend-independent parts of the filter API.
+ *
+ * The multi-rate step and the apogee vote only touch altitude, velocity
+ * and their variances, which every backend keeps in state[0..1] and the
+ * top-left corner of the covariance.
+ *
+ * Copyright (c) 2026, Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <aurora/lib/filter.h>
+
+#include "filter_internal.h"
+
+/* filter_step – see filter.h */
+int filter_step(struct filter *filter, const struct filter_sample *samples,
+		size_t count, filter_real_t z)
+{
+	int ret = filter_predict_batch(filter, samples, count);
+
+	if (ret != 0)
+	return ret;
+
+	return filter_update(filter, z);
+}
+
+/* filter_velocity_variance – see filter.h */
+filter_real_t filter_velocity_variance(const struct filter *filter)
+{
+	if (filter == NULL)
+	return FR(-1.0);
+
+	return filter->covariance[1][1];
+}
+
+/* filter_detect_apogee – see filter.h */
+int filter_detect_apogee(struct filter *filter)
+{
+	if (filter == NULL)
+	return -EINVAL;
+
+	const filter_real_t altitude = filter->state[0];
+	const filter_real_t velocity = filter->state[1];
+
+	/* Always track peak, even after latching, so a re-init starts fresh. */
+	if (altitude > filter->peak_altitude)
+	filter->peak_altitude = altitude;
+
+	if (filter->apogee_latched)
+	return 0;
+
+	/* Velocity is the leading indicator at apogee, so fire as soon as
+	 * the filter's velocity estimate goes non-positive and altitude
+	 * has dropped below the tracked peak.  Debounce + the inertial
+	 * sanity band handle noise rejection without adding a hysteresis
+	 * band that would delay detection during coast.
+	 */
+	const int velocity_ok = velocity <= FR(0.0) &&
+	velocity * velocity >= FILTER_APOGEE_VEL_SIGMA2 * filter->covariance[1][1];
+	const int descent_ok = altitude < filter->peak_altitude;
+	const int inertial_ok =
+	fr_fabs(filter->last_accel_vert) < FILTER_APOGEE_ACCEL_BAND;
+
+	if (velocity_ok && descent_ok && inertial_ok) {
+	filter->consecutive_apogee++;
+	} else {
+	filter->consecutive_apogee = 0;
+	}
+
+	if (filter->consecutive_apogee >= CONFIG_FILTER_APOGEE_DEBOUNCE_SAMPLES) {
+	filter->apogee_latched = 1;
+	return 1;
+	}
+
+	return 0;
+}
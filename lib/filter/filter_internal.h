@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Helpers shared by the filter backends.  Not part of the public API.
+ */
+
+#ifndef APP_LIB_FILTER_INTERNAL_H_
+#define APP_LIB_FILTER_INTERNAL_H_
+
+#include <math.h>
+
+#include <aurora/lib/filter.h>
+
+/* Literal in the filter's arithmetic type, so float builds never
+ * promote to double.
+ */
+#define FR(x) ((filter_real_t)(x))
+
+#if defined(CONFIG_FILTER_FLOAT)
+#define fr_fabs fabsf
+#else
+#define fr_fabs fabs
+#endif /* CONFIG_FILTER_FLOAT */
+
+/* Normalized-innovation-squared (Mahalanobis) gate for baro updates.
+ * y*y/S above this is treated as a sensor glitch and the update is
+ * skipped.  25 ~= 5-sigma; self-scaling via S, so no Kconfig knob.
+ */
+#define FILTER_NIS_GATE FR(25.0)
+
+/* Updates to ignore before the NIS gate arms.  Protects the initial
+ * transient where the prior may be grossly wrong but P shrinks below
+ * R quickly.  At 10 Hz this is ~3 s of pad time.
+ */
+#define FILTER_NIS_WARMUP 30
+
+/* Inertial sanity band on world-frame vertical accel at the apogee
+ * decision point.  Coast/drag is small; boost is tens of g.  Rejects
+ * obviously non-apogee kinematics without a tuning parameter.
+ */
+#define FILTER_APOGEE_ACCEL_BAND FR(20.0)
+
+/* Squared velocity confidence for the apogee vote, in sigma^2. */
+#define FILTER_APOGEE_VEL_SIGMA2 \
+	FR((CONFIG_FILTER_APOGEE_VEL_SIGMA_MILLISCALE / FILTER_SCALE_DIVISOR) * \
+	   (CONFIG_FILTER_APOGEE_VEL_SIGMA_MILLISCALE / FILTER_SCALE_DIVISOR))
+
+#endif /* APP_LIB_FILTER_INTERNAL_H_ */
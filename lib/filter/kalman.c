@@ -3,7 +3,8 @@
  * @brief Kalman filter for apogee detection.
  *
  * Implements a 2-state (altitude, vertical velocity) Kalman filter that
- * tracks barometric altitude and detects apogee via a velocity zero-crossing.
+ * tracks barometric altitude.  Apogee detection is shared with the other
+ * backends in filter.c.
  *
  * Copyright (c) 2026, Auxspace e.V.
  *
@@ -18,25 +19,9 @@
 
 #include <aurora/lib/filter.h>
 
-LOG_MODULE_REGISTER(kalman, CONFIG_AURORA_FILTER_LOG_LEVEL);
-
-/* Normalized-innovation-squared (Mahalanobis) gate for baro updates.
- * y*y/S above this is treated as a sensor glitch and the update is
- * skipped.  25 ~= 5-sigma; self-scaling via S, so no Kconfig knob.
- */
-#define FILTER_NIS_GATE 25.0
+#include "filter_internal.h"
 
-/* Updates to ignore before the NIS gate arms.  Protects the initial
- * transient where the prior may be grossly wrong but P shrinks below
- * R quickly.  At 10 Hz this is ~3 s of pad time.
- */
-#define FILTER_NIS_WARMUP 30
-
-/* Inertial sanity band on world-frame vertical accel at the apogee
- * decision point.  Coast/drag is small; boost is tens of g.  Rejects
- * obviously non-apogee kinematics without a tuning parameter.
- */
-#define FILTER_APOGEE_ACCEL_BAND 20.0
+LOG_MODULE_REGISTER(kalman, CONFIG_AURORA_FILTER_LOG_LEVEL);
 
 /* filter_init – see filter.h */
 int filter_init(struct filter *filter)
@@ -44,32 +29,32 @@ int filter_init(struct filter *filter)
 	if (filter == NULL)
 	return -EINVAL;
 
-	const double q_alt =
-	((double)CONFIG_FILTER_Q_ALT_MILLISCALE) / FILTER_SCALE_DIVISOR;
+	const filter_real_t q_alt =
+	FR(CONFIG_FILTER_Q_ALT_MILLISCALE / FILTER_SCALE_DIVISOR);
 
-	const double q_vel =
-	((double)CONFIG_FILTER_Q_VEL_MILLISCALE) / FILTER_SCALE_DIVISOR;
+	const filter_real_t q_vel =
+	FR(CONFIG_FILTER_Q_VEL_MILLISCALE / FILTER_SCALE_DIVISOR);
 
-	const double r_meas =
-	((double)CONFIG_FILTER_R_MILLISCALE) / FILTER_SCALE_DIVISOR;
+	const filter_real_t r_meas =
+	FR(CONFIG_FILTER_R_MILLISCALE / FILTER_SCALE_DIVISOR);
 
-	filter->state[0] = 0.0;
-	filter->state[1] = 0.0;
+	filter->state[0] = FR(0.0);
+	filter->state[1] = FR(0.0);
 
-	filter->covariance[0][0] = 10.0;
-	filter->covariance[0][1] = 0.0;
-	filter->covariance[1][0] = 0.0;
-	filter->covariance[1][1] = 10.0;
+	filter->covariance[0][0] = FR(10.0);
+	filter->covariance[0][1] = FR(0.0);
+	filter->covariance[1][0] = FR(0.0);
+	filter->covariance[1][1] = FR(10.0);
 
 	filter->noise_p[0][0] = q_alt;
-	filter->noise_p[0][1] = 0.0;
-	filter->noise_p[1][0] = 0.0;
+	filter->noise_p[0][1] = FR(0.0);
+	filter->noise_p[1][0] = FR(0.0);
 	filter->noise_p[1][1] = q_vel;
 
 	filter->noise_m = r_meas;
 
-	filter->peak_altitude = 0.0;
-	filter->last_accel_vert = 0.0;
+	filter->peak_altitude = FR(0.0);
+	filter->last_accel_vert = FR(0.0);
 	filter->consecutive_apogee = 0;
 	filter->apogee_latched = 0;
 	filter->updates_since_init = 0;
@@ -78,35 +63,36 @@ int filter_init(struct filter *filter)
 }
 
 /* filter_predict – see filter.h */
-int filter_predict(struct filter *filter, int64_t dt, double a_vert)
+int filter_predict(struct filter *filter, int64_t dt, filter_real_t a_vert)
 {
 	if (filter == NULL || dt <= 0)
 	return -EINVAL;
 
-	const double dt_s = (double)dt / 1e9;
-
 	/* Clamp dt to prevent filter explosion */
-	if (dt_s > 1.0)
+	if (dt > NSEC_PER_SEC)
 	return -EINVAL;
 
+	/* dt fits 32 bits once clamped, which keeps the conversion cheap. */
+	const filter_real_t dt_s = (filter_real_t)(int32_t)dt / FR(NSEC_PER_SEC);
+
 	/* State prediction with a_vert as control input
 	 * (F unchanged; B = [0.5*dt^2, dt]^T applied to a_vert) */
-	const double altitude = filter->state[0];
-	const double velocity = filter->state[1];
+	const filter_real_t altitude = filter->state[0];
+	const filter_real_t velocity = filter->state[1];
 
-	filter->state[0] = altitude + velocity * dt_s + 0.5 * a_vert * dt_s * dt_s;
+	filter->state[0] = altitude + velocity * dt_s + FR(0.5) * a_vert * dt_s * dt_s;
 	filter->state[1] = velocity + a_vert * dt_s;
 	filter->last_accel_vert = a_vert;
 
 	/* Scale process noise with dt */
-	const double Q00 = filter->noise_p[0][0] * dt_s;
-	const double Q11 = filter->noise_p[1][1] * dt_s;
+	const filter_real_t Q00 = filter->noise_p[0][0] * dt_s;
+	const filter_real_t Q11 = filter->noise_p[1][1] * dt_s;
 
 	/* Covariance prediction */
-	const double P00 = filter->covariance[0][0];
-	const double P01 = filter->covariance[0][1];
-	const double P10 = filter->covariance[1][0];
-	const double P11 = filter->covariance[1][1];
+	const filter_real_t P00 = filter->covariance[0][0];
+	const filter_real_t P01 = filter->covariance[0][1];
+	const filter_real_t P10 = filter->covariance[1][0];
+	const filter_real_t P11 = filter->covariance[1][1];
 
 	filter->covariance[0][0] = P00 + dt_s*(P10 + P01) + dt_s*dt_s*P11 + Q00;
 	filter->covariance[0][1] = P01 + dt_s*P11;
@@ -116,19 +102,86 @@ int filter_predict(struct filter *filter, int64_t dt, double a_vert)
 	return 0;
 }
 
+/* filter_predict_batch – see filter.h */
+int filter_predict_batch(struct filter *filter,
+			 const struct filter_sample *samples, size_t count)
+{
+	if (filter == NULL || samples == NULL || count == 0)
+	return -EINVAL;
+
+	int64_t total = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		if (samples[i].dt <= 0)
+		return -EINVAL;
+		total += samples[i].dt;
+		if (total > NSEC_PER_SEC)
+		return -EINVAL;
+	}
+
+	/* Step the state per sample.  For the covariance, sample i adds
+	 * Q_i = diag(q_alt, q_vel) * dt_i, which the remaining transitions
+	 * F(tau_i) = [1 tau_i; 0 1] carry to the end of the batch:
+	 *   F Q_i F^T = dt_i * [q_alt + tau_i^2 q_vel, tau_i q_vel;
+	 *                       tau_i q_vel,           q_vel      ]
+	 * with tau_i = T - t_i.  Expanding tau_i leaves three running sums
+	 * over dt_i, dt_i t_i and dt_i t_i^2.
+	 */
+	filter_real_t altitude = filter->state[0];
+	filter_real_t velocity = filter->state[1];
+	filter_real_t t = FR(0.0);
+	filter_real_t sum_t = FR(0.0);
+	filter_real_t sum_t2 = FR(0.0);
+
+	for (size_t i = 0; i < count; i++) {
+		const filter_real_t dt_s =
+			(filter_real_t)(int32_t)samples[i].dt / FR(NSEC_PER_SEC);
+		const filter_real_t a = samples[i].a_vert;
+
+		altitude += velocity * dt_s + FR(0.5) * a * dt_s * dt_s;
+		velocity += a * dt_s;
+		t += dt_s;
+		sum_t += dt_s * t;
+		sum_t2 += dt_s * t * t;
+	}
+
+	const filter_real_t T = t;
+	const filter_real_t s_tau = T * T - sum_t;
+	const filter_real_t s_tau2 = T * T * T - FR(2.0) * T * sum_t + sum_t2;
+	const filter_real_t q_alt = filter->noise_p[0][0];
+	const filter_real_t q_vel = filter->noise_p[1][1];
+
+	filter->state[0] = altitude;
+	filter->state[1] = velocity;
+	filter->last_accel_vert = samples[count - 1].a_vert;
+
+	const filter_real_t P00 = filter->covariance[0][0];
+	const filter_real_t P01 = filter->covariance[0][1];
+	const filter_real_t P10 = filter->covariance[1][0];
+	const filter_real_t P11 = filter->covariance[1][1];
+
+	filter->covariance[0][0] = P00 + T*(P10 + P01) + T*T*P11 +
+				   q_alt * T + q_vel * s_tau2;
+	filter->covariance[0][1] = P01 + T*P11 + q_vel * s_tau;
+	filter->covariance[1][0] = P10 + T*P11 + q_vel * s_tau;
+	filter->covariance[1][1] = P11 + q_vel * T;
+
+	return 0;
+}
+
 /* filter_update – see filter.h */
-int filter_update(struct filter *filter, double z)
+int filter_update(struct filter *filter, filter_real_t z)
 {
 	if (filter == NULL)
 	return -EINVAL;
 
 	/* Innovation */
-	double y = z - filter->state[0];
+	filter_real_t y = z - filter->state[0];
 
 	/* Innovation covariance */
-	double S = filter->covariance[0][0] + filter->noise_m;
+	filter_real_t S = filter->covariance[0][0] + filter->noise_m;
 
-	if (fabs(S) < 1e-12)
+	if (fr_fabs(S) < FR(1e-12))
 	return -EDOM;
 
 	filter->updates_since_init++;
@@ -146,18 +199,18 @@ int filter_update(struct filter *filter, double z)
 	}
 
 	/* Kalman gain */
-	const double K0 = filter->covariance[0][0] / S;
-	const double K1 = filter->covariance[1][0] / S;
+	const filter_real_t K0 = filter->covariance[0][0] / S;
+	const filter_real_t K1 = filter->covariance[1][0] / S;
 
 	/* State update */
 	filter->state[0] += K0 * y;
 	filter->state[1] += K1 * y;
 
 	/* Covariance update */
-	const double P00 = filter->covariance[0][0];
-	const double P01 = filter->covariance[0][1];
-	const double P10 = filter->covariance[1][0];
-	const double P11 = filter->covariance[1][1];
+	const filter_real_t P00 = filter->covariance[0][0];
+	const filter_real_t P01 = filter->covariance[0][1];
+	const filter_real_t P10 = filter->covariance[1][0];
+	const filter_real_t P11 = filter->covariance[1][1];
 
 	filter->covariance[0][0] = P00 - K0 * P00;
 	filter->covariance[0][1] = P01 - K0 * P01;
@@ -166,44 +219,3 @@ int filter_update(struct filter *filter, double z)
 
 	return 0;
 }
-
-/* filter_detect_apogee – see filter.h */
-int filter_detect_apogee(struct filter *filter)
-{
-	if (filter == NULL)
-	return -EINVAL;
-
-	const double altitude = filter->state[0];
-	const double velocity = filter->state[1];
-
-	/* Always track peak, even after latching, so a re-init starts fresh. */
-	if (altitude > filter->peak_altitude)
-	filter->peak_altitude = altitude;
-
-	if (filter->apogee_latched)
-	return 0;
-
-	/* Velocity is the leading indicator at apogee, so fire as soon as
-	 * the filter's velocity estimate goes non-positive and altitude
-	 * has dropped below the tracked peak.  Debounce + the inertial
-	 * sanity band handle noise rejection without adding a hysteresis
-	 * band that would delay detection during coast.
-	 */
-	const int velocity_ok = velocity <= 0.0;
-	const int descent_ok = altitude < filter->peak_altitude;
-	const int inertial_ok =
-	fabs(filter->last_accel_vert) < FILTER_APOGEE_ACCEL_BAND;
-
-	if (velocity_ok && descent_ok && inertial_ok) {
-	filter->consecutive_apogee++;
-	} else {
-	filter->consecutive_apogee = 0;
-	}
-
-	if (filter->consecutive_apogee >= CONFIG_FILTER_APOGEE_DEBOUNCE_SAMPLES) {
-	filter->apogee_latched = 1;
-	return 1;
-	}
-
-	return 0;
-}
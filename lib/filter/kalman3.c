@@ -0,0 +1,277 @@
+/**
+ * @file kalman3.c
+ * @brief 3-state Kalman filter with accelerometer bias estimation.
+ *
+ * Implements a 3-state (altitude, vertical velocity, vertical accel bias)
+ * Kalman filter.  The bias is modelled as a random walk and subtracted
+ * from the control input, so a constant accelerometer offset no longer
+ * integrates into a velocity drift between baro updates.  All matrix
+ * math is unrolled by hand; the filter keeps no state outside struct
+ * filter.  Apogee detection is shared with the other backends in
+ * filter.c.
+ *
+ * Copyright (c) 2026, Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <math.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+#include <aurora/lib/filter.h>
+
+#include "filter_internal.h"
+
+LOG_MODULE_REGISTER(kalman3, CONFIG_AURORA_FILTER_LOG_LEVEL);
+
+/* P <- F(T) P F(T)^T for the constant-acceleration model with bias,
+ *   F(T) = [1 T -T^2/2; 0 1 -T; 0 0 1]
+ * F composes additively in T, so this serves a single step and a whole
+ * batch alike.
+ */
+static void kalman3_propagate(struct filter *filter, filter_real_t T)
+{
+	const filter_real_t d = T;
+	const filter_real_t e = FR(-0.5) * T * T;
+	const filter_real_t g = -T;
+	filter_real_t (*P)[FILTER_NUM_STATES] = filter->covariance;
+
+	/* A = F P */
+	const filter_real_t A00 = P[0][0] + d * P[1][0] + e * P[2][0];
+	const filter_real_t A01 = P[0][1] + d * P[1][1] + e * P[2][1];
+	const filter_real_t A02 = P[0][2] + d * P[1][2] + e * P[2][2];
+	const filter_real_t A10 = P[1][0] + g * P[2][0];
+	const filter_real_t A11 = P[1][1] + g * P[2][1];
+	const filter_real_t A12 = P[1][2] + g * P[2][2];
+	const filter_real_t A20 = P[2][0];
+	const filter_real_t A21 = P[2][1];
+	const filter_real_t A22 = P[2][2];
+
+	/* P = A F^T */
+	P[0][0] = A00 + d * A01 + e * A02;
+	P[0][1] = A01 + g * A02;
+	P[0][2] = A02;
+	P[1][0] = A10 + d * A11 + e * A12;
+	P[1][1] = A11 + g * A12;
+	P[1][2] = A12;
+	P[2][0] = A20 + d * A21 + e * A22;
+	P[2][1] = A21 + g * A22;
+	P[2][2] = A22;
+}
+
+/* filter_init – see filter.h */
+int filter_init(struct filter *filter)
+{
+	if (filter == NULL)
+	return -EINVAL;
+
+	const filter_real_t q_alt =
+	FR(CONFIG_FILTER_Q_ALT_MILLISCALE / FILTER_SCALE_DIVISOR);
+
+	const filter_real_t q_vel =
+	FR(CONFIG_FILTER_Q_VEL_MILLISCALE / FILTER_SCALE_DIVISOR);
+
+	const filter_real_t q_bias =
+	FR(CONFIG_FILTER_Q_BIAS_MILLISCALE / FILTER_SCALE_DIVISOR);
+
+	const filter_real_t r_meas =
+	FR(CONFIG_FILTER_R_MILLISCALE / FILTER_SCALE_DIVISOR);
+
+	for (int i = 0; i < FILTER_NUM_STATES; i++) {
+		filter->state[i] = FR(0.0);
+		for (int j = 0; j < FILTER_NUM_STATES; j++) {
+			filter->covariance[i][j] = FR(0.0);
+			filter->noise_p[i][j] = FR(0.0);
+		}
+	}
+
+	filter->covariance[0][0] = FR(10.0);
+	filter->covariance[1][1] = FR(10.0);
+	/* ~0.3 m/s^2 prior on the bias: a calibrated IMU, not a free
+	 * parameter the first baro innovations can swing around.
+	 */
+	filter->covariance[2][2] = FR(0.1);
+
+	filter->noise_p[0][0] = q_alt;
+	filter->noise_p[1][1] = q_vel;
+	filter->noise_p[2][2] = q_bias;
+
+	filter->noise_m = r_meas;
+
+	filter->peak_altitude = FR(0.0);
+	filter->last_accel_vert = FR(0.0);
+	filter->consecutive_apogee = 0;
+	filter->apogee_latched = 0;
+	filter->updates_since_init = 0;
+
+	return 0;
+}
+
+/* filter_predict – see filter.h */
+int filter_predict(struct filter *filter, int64_t dt, filter_real_t a_vert)
+{
+	if (filter == NULL || dt <= 0)
+	return -EINVAL;
+
+	/* Clamp dt to prevent filter explosion */
+	if (dt > NSEC_PER_SEC)
+	return -EINVAL;
+
+	/* dt fits 32 bits once clamped, which keeps the conversion cheap. */
+	const filter_real_t dt_s = (filter_real_t)(int32_t)dt / FR(NSEC_PER_SEC);
+
+	/* Bias-corrected acceleration drives the kinematics; the bias
+	 * itself is constant over the step.
+	 */
+	const filter_real_t u = a_vert - filter->state[2];
+
+	filter->state[0] += filter->state[1] * dt_s + FR(0.5) * u * dt_s * dt_s;
+	filter->state[1] += u * dt_s;
+
+	/* The apogee sanity band judges the raw measurement. */
+	filter->last_accel_vert = a_vert;
+
+	kalman3_propagate(filter, dt_s);
+
+	/* Scale process noise with dt */
+	filter->covariance[0][0] += filter->noise_p[0][0] * dt_s;
+	filter->covariance[1][1] += filter->noise_p[1][1] * dt_s;
+	filter->covariance[2][2] += filter->noise_p[2][2] * dt_s;
+
+	return 0;
+}
+
+/* filter_predict_batch – see filter.h */
+int filter_predict_batch(struct filter *filter,
+			 const struct filter_sample *samples, size_t count)
+{
+	if (filter == NULL || samples == NULL || count == 0)
+	return -EINVAL;
+
+	int64_t total = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		if (samples[i].dt <= 0)
+		return -EINVAL;
+		total += samples[i].dt;
+		if (total > NSEC_PER_SEC)
+		return -EINVAL;
+	}
+
+	/* Step the state per sample.  Sample i adds Q_i = diag(q_alt,
+	 * q_vel, q_bias) * dt_i, which the remaining transitions carry to
+	 * the end of the batch as F(tau_i) Q_i F(tau_i)^T with
+	 * tau_i = T - t_i.  T is known from the validation pass, so the
+	 * four moments sum(dt_i tau_i^k) are accumulated directly.
+	 */
+	const filter_real_t T = (filter_real_t)(int32_t)total / FR(NSEC_PER_SEC);
+	const filter_real_t bias = filter->state[2];
+	filter_real_t altitude = filter->state[0];
+	filter_real_t velocity = filter->state[1];
+	filter_real_t t = FR(0.0);
+	filter_real_t s1 = FR(0.0);
+	filter_real_t s2 = FR(0.0);
+	filter_real_t s3 = FR(0.0);
+	filter_real_t s4 = FR(0.0);
+
+	for (size_t i = 0; i < count; i++) {
+		const filter_real_t dt_s =
+			(filter_real_t)(int32_t)samples[i].dt / FR(NSEC_PER_SEC);
+		const filter_real_t u = samples[i].a_vert - bias;
+
+		altitude += velocity * dt_s + FR(0.5) * u * dt_s * dt_s;
+		velocity += u * dt_s;
+		t += dt_s;
+
+		const filter_real_t tau = T - t;
+		const filter_real_t tau2 = tau * tau;
+
+		s1 += dt_s * tau;
+		s2 += dt_s * tau2;
+		s3 += dt_s * tau2 * tau;
+		s4 += dt_s * tau2 * tau2;
+	}
+
+	const filter_real_t q_alt = filter->noise_p[0][0];
+	const filter_real_t q_vel = filter->noise_p[1][1];
+	const filter_real_t q_bias = filter->noise_p[2][2];
+
+	filter->state[0] = altitude;
+	filter->state[1] = velocity;
+	filter->last_accel_vert = samples[count - 1].a_vert;
+
+	kalman3_propagate(filter, T);
+
+	const filter_real_t M01 = q_vel * s1 + FR(0.5) * q_bias * s3;
+	const filter_real_t M02 = FR(-0.5) * q_bias * s2;
+	const filter_real_t M12 = -q_bias * s1;
+
+	filter->covariance[0][0] += q_alt * T + q_vel * s2 + FR(0.25) * q_bias * s4;
+	filter->covariance[0][1] += M01;
+	filter->covariance[1][0] += M01;
+	filter->covariance[0][2] += M02;
+	filter->covariance[2][0] += M02;
+	filter->covariance[1][1] += q_vel * T + q_bias * s2;
+	filter->covariance[1][2] += M12;
+	filter->covariance[2][1] += M12;
+	filter->covariance[2][2] += q_bias * T;
+
+	return 0;
+}
+
+/* filter_update – see filter.h */
+int filter_update(struct filter *filter, filter_real_t z)
+{
+	if (filter == NULL)
+	return -EINVAL;
+
+	/* Innovation, H = [1 0 0] */
+	filter_real_t y = z - filter->state[0];
+
+	/* Innovation covariance */
+	filter_real_t S = filter->covariance[0][0] + filter->noise_m;
+
+	if (fr_fabs(S) < FR(1e-12))
+	return -EDOM;
+
+	filter->updates_since_init++;
+
+	/* Same innovation gate as the 2-state backend, see kalman.c. */
+	if (filter->updates_since_init > FILTER_NIS_WARMUP &&
+	    filter->covariance[0][0] <= filter->noise_m &&
+	    (y * y) > FILTER_NIS_GATE * S) {
+		return 1;
+	}
+
+	filter_real_t (*P)[FILTER_NUM_STATES] = filter->covariance;
+
+	/* Kalman gain */
+	const filter_real_t K0 = P[0][0] / S;
+	const filter_real_t K1 = P[1][0] / S;
+	const filter_real_t K2 = P[2][0] / S;
+
+	/* State update */
+	filter->state[0] += K0 * y;
+	filter->state[1] += K1 * y;
+	filter->state[2] += K2 * y;
+
+	/* Covariance update, P -= K H P with H P = first row of P */
+	const filter_real_t P00 = P[0][0];
+	const filter_real_t P01 = P[0][1];
+	const filter_real_t P02 = P[0][2];
+
+	P[0][0] -= K0 * P00;
+	P[0][1] -= K0 * P01;
+	P[0][2] -= K0 * P02;
+	P[1][0] -= K1 * P00;
+	P[1][1] -= K1 * P01;
+	P[1][2] -= K1 * P02;
+	P[2][0] -= K2 * P00;
+	P[2][1] -= K2 * P01;
+	P[2][2] -= K2 * P02;
+
+	return 0;
+}
@@ -0,0 +1,289 @@
+/**
+ * @file health.c
+ * @brief Periodic thread CPU and stack usage sampler.
+ *
+ * A low-priority thread walks the kernel's thread list once per
+ * CONFIG_AURORA_HEALTH_PERIOD_MS.  The CPU share of a thread is the
+ * growth of its execution cycles since the previous sample over the
+ * growth of all cycles, idle included, so the loads of one sample add
+ * up to about one million.  The stack figure is the high-water mark
+ * found by scanning the stack for the INIT_STACKS fill pattern.
+ *
+ * The walk runs with the thread list unlocked (the stack scans take
+ * too long to hold it), so a thread created during a walk may be
+ * missed until the next one.  Threads are matched to their previous
+ * cycle count by address; a thread seen for the first time is charged
+ * everything it has run so far.
+ *
+ * The latest sample is kept under a spinlock for health_get(); with
+ * CONFIG_AURORA_HEALTH_FLIGHT_LOG it also goes to the live flight log
+ * as AURORA_DATA_THREAD_HEALTH records, see data_logger.h.
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+
+#include <aurora/lib/health.h>
+#if defined(CONFIG_AURORA_HEALTH_FLIGHT_LOG)
+#include <zephyr/sys/byteorder.h>
+#include <aurora/lib/data_logger.h>
+#endif /* CONFIG_AURORA_HEALTH_FLIGHT_LOG */
+
+LOG_MODULE_REGISTER(health, CONFIG_AURORA_HEALTH_LOG_LEVEL);
+
+#define MAX_THREADS CONFIG_AURORA_HEALTH_MAX_THREADS
+#define PPM         1000000U
+
+/* Execution cycles of one thread at the previous sample. */
+struct cycles_mark {
+	const struct k_thread *thread;
+	uint64_t cycles;
+};
+
+/* One walk over the thread list. */
+struct walk {
+	const struct cycles_mark *prev;
+	size_t prev_n;
+	struct cycles_mark *next;
+	struct health_thread *out;
+	size_t n;
+	uint32_t skipped;
+	uint64_t all_delta;
+};
+
+/* Sampler state, owned by whoever set `sampling`. marks[cur] holds the
+ * previous sample's counts, the walk fills the other one.
+ */
+static atomic_t sampling;
+static struct cycles_mark marks[2][MAX_THREADS];
+static size_t marks_n[2];
+static uint8_t marks_cur;
+static uint64_t all_cycles_prev;
+static struct health_thread walk_out[MAX_THREADS];
+
+/* Latest sample, for health_get(). */
+static struct k_spinlock latest_lock;
+static struct health_thread latest[MAX_THREADS];
+static size_t latest_n;
+static int64_t latest_ms;
+static uint32_t latest_skipped;
+
+/* Threads mostly keep their place in the list, so try the same slot
+ * first.
+ */
+static uint64_t prev_cycles(const struct walk *w, const struct k_thread *thread)
+{
+	if (w->n < w->prev_n && w->prev[w->n].thread == thread) {
+		return w->prev[w->n].cycles;
+	}
+	for (size_t i = 0; i < w->prev_n; i++) {
+		if (w->prev[i].thread == thread) {
+			return w->prev[i].cycles;
+		}
+	}
+	return 0;
+}
+
+static uint32_t load_ppm(uint64_t cycles, uint64_t all)
+{
+	if (all == 0) {
+		return 0;
+	}
+	return (uint32_t)MIN(cycles * PPM / all, PPM);
+}
+
+static void walk_thread(const struct k_thread *thread, void *user_data)
+{
+	struct walk *w = user_data;
+	struct k_thread *t = (struct k_thread *)thread;
+	struct health_thread *h;
+	k_thread_runtime_stats_t stats;
+	const char *name;
+	size_t unused;
+
+	if (w->n == MAX_THREADS) {
+		w->skipped++;
+		return;
+	}
+
+	if (k_thread_runtime_stats_get(t, &stats) != 0) {
+		stats.execution_cycles = 0;
+	}
+
+	h = &w->out[w->n];
+	name = k_thread_name_get(t);
+	if (name != NULL && name[0] != '\0') {
+		strncpy(h->name, name, HEALTH_NAME_LEN);
+		h->name[HEALTH_NAME_LEN] = '\0';
+	} else {
+		snprintk(h->name, sizeof(h->name), "%p", thread);
+	}
+
+	h->load_ppm   = load_ppm(stats.execution_cycles - prev_cycles(w, thread),
+				 w->all_delta);
+	h->stack_size = (uint32_t)t->stack_info.size;
+	h->stack_used = k_thread_stack_space_get(t, &unused) == 0 ?
+			(uint32_t)(t->stack_info.size - unused) : 0;
+
+	w->next[w->n].thread = thread;
+	w->next[w->n].cycles = stats.execution_cycles;
+	w->n++;
+}
+
+#if defined(CONFIG_AURORA_HEALTH_FLIGHT_LOG)
+BUILD_ASSERT(HEALTH_NAME_LEN == AURORA_HEALTH_NAME_MAX,
+	     "health names must fill the record name field");
+
+/* Records handed to the flight log per write. */
+#define LOG_BATCH 8
+
+/* Layout in data_logger.h. */
+static void to_datapoint(const struct health_thread *t, uint64_t ts,
+			 struct datapoint *dp)
+{
+	uint8_t name[AURORA_HEALTH_NAME_MAX] = { 0 };
+
+	memcpy(name, t->name, strnlen(t->name, sizeof(name)));
+
+	dp->timestamp_ns  = ts;
+	dp->type          = AURORA_DATA_THREAD_HEALTH;
+	dp->channel_count = DP_MAX_CHANNELS;
+	dp->channels[0].val1 = (int32_t)sys_get_le32(&name[0]);
+	dp->channels[0].val2 = (int32_t)sys_get_le32(&name[4]);
+	dp->channels[1].val1 = (int32_t)sys_get_le32(&name[8]);
+	dp->channels[1].val2 = (int32_t)sys_get_le32(&name[12]);
+	dp->channels[2].val1 = (int32_t)t->stack_used;
+	dp->channels[2].val2 = (int32_t)t->load_ppm;
+}
+
+/* Samples taken while the flight log is closed are not kept. */
+static void log_sample(const struct health_thread *t, size_t n, uint64_t ts)
+{
+	struct datapoint dps[LOG_BATCH];
+	int rc;
+
+	if (!atomic_get(&sm_logger_live)) {
+		return;
+	}
+
+	for (size_t i = 0; i < n; i += LOG_BATCH) {
+		const size_t k = MIN(n - i, LOG_BATCH);
+
+		for (size_t j = 0; j < k; j++) {
+			to_datapoint(&t[i + j], ts, &dps[j]);
+		}
+
+		rc = data_logger_write_batch(&sm_logger, dps, k);
+		if (rc == -EAGAIN || rc == -EBUSY) {
+			return;
+		}
+		if (rc) {
+			LOG_WRN("Failed to write thread health to the flight log (%d)",
+				rc);
+			return;
+		}
+	}
+}
+#else
+static void log_sample(const struct health_thread *t, size_t n, uint64_t ts)
+{
+	ARG_UNUSED(t);
+	ARG_UNUSED(n);
+	ARG_UNUSED(ts);
+}
+#endif /* CONFIG_AURORA_HEALTH_FLIGHT_LOG */
+
+/* health_sample – see health.h */
+int health_sample(void)
+{
+	k_thread_runtime_stats_t all;
+	struct walk w;
+	uint64_t ts;
+	int64_t now;
+
+	if (!atomic_cas(&sampling, 0, 1)) {
+		return -EAGAIN;
+	}
+
+	ts = k_ticks_to_ns_floor64(k_uptime_ticks());
+	if (k_thread_runtime_stats_all_get(&all) != 0) {
+		all.execution_cycles = all_cycles_prev;
+	}
+
+	w = (struct walk){
+		.prev      = marks[marks_cur],
+		.prev_n    = marks_n[marks_cur],
+		.next      = marks[marks_cur ^ 1U],
+		.out       = walk_out,
+		.all_delta = all.execution_cycles - all_cycles_prev,
+	};
+	k_thread_foreach_unlocked(walk_thread, &w);
+
+	all_cycles_prev = all.execution_cycles;
+	marks_cur ^= 1U;
+	marks_n[marks_cur] = w.n;
+
+	now = k_uptime_get();
+	K_SPINLOCK(&latest_lock) {
+		memcpy(latest, walk_out, w.n * sizeof(walk_out[0]));
+		latest_n       = w.n;
+		latest_ms      = now;
+		latest_skipped = w.skipped;
+	}
+
+	log_sample(walk_out, w.n, ts);
+
+	atomic_clear(&sampling);
+	return 0;
+}
+
+/* health_get – see health.h */
+size_t health_get(struct health_thread *out, size_t max, int64_t *uptime_ms)
+{
+	size_t n = 0;
+
+	K_SPINLOCK(&latest_lock) {
+		n = MIN(max, latest_n);
+		memcpy(out, latest, n * sizeof(out[0]));
+		if (uptime_ms != NULL) {
+			*uptime_ms = latest_ms;
+		}
+	}
+	return n;
+}
+
+/* health_skipped – see health.h */
+uint32_t health_skipped(void)
+{
+	uint32_t skipped = 0;
+
+	K_SPINLOCK(&latest_lock) {
+		skipped = latest_skipped;
+	}
+	return skipped;
+}
+
+static void health_task(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (1) {
+		k_sleep(K_MSEC(CONFIG_AURORA_HEALTH_PERIOD_MS));
+		(void)health_sample();
+	}
+}
+
+K_THREAD_DEFINE(health_th, CONFIG_AURORA_HEALTH_STACK_SIZE,
+		health_task, NULL, NULL, NULL,
+		CONFIG_AURORA_HEALTH_PRIORITY, 0, 0);
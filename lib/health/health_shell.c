@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+
+#include <aurora/lib/health.h>
+
+/* Shared by both commands; the shell runs one command at a time. */
+static struct health_thread threads[CONFIG_AURORA_HEALTH_MAX_THREADS];
+
+static void print_sample(const struct shell *sh)
+{
+	int64_t uptime_ms;
+	const size_t n = health_get(threads, ARRAY_SIZE(threads), &uptime_ms);
+	const uint32_t skipped = health_skipped();
+
+	if (n == 0) {
+		shell_print(sh, "no sample yet");
+		return;
+	}
+
+	shell_print(sh, "sample at %lld ms, %u threads", (long long)uptime_ms,
+		    (unsigned int)n);
+	shell_print(sh, "%-16s %8s %8s %8s %5s", "Thread", "CPU %", "Stack",
+		    "Used", "Used%");
+	shell_print(sh, "------------------------------------------------");
+	for (size_t i = 0; i < n; i++) {
+		const struct health_thread *t = &threads[i];
+		const uint32_t pct = t->stack_size ?
+				     (uint32_t)((uint64_t)t->stack_used * 100U /
+						t->stack_size) : 0;
+
+		shell_print(sh, "%-16s %5u.%02u %8u %8u %4u%%", t->name,
+			    (unsigned int)(t->load_ppm / 10000U),
+			    (unsigned int)((t->load_ppm / 100U) % 100U),
+			    (unsigned int)t->stack_size,
+			    (unsigned int)t->stack_used, (unsigned int)pct);
+	}
+	if (skipped) {
+		shell_warn(sh, "%u threads not tracked, raise "
+			   "CONFIG_AURORA_HEALTH_MAX_THREADS",
+			   (unsigned int)skipped);
+	}
+}
+
+static int cmd_health_show(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	print_sample(sh);
+	return 0;
+}
+
+static int cmd_health_sample(const struct shell *sh, size_t argc, char **argv)
+{
+	int rc;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	rc = health_sample();
+	if (rc) {
+		shell_error(sh, "sample failed (%d)", rc);
+		return rc;
+	}
+
+	print_sample(sh);
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_health,
+	SHELL_CMD(show, NULL, "Print the latest thread CPU and stack sample",
+		  cmd_health_show),
+	SHELL_CMD(sample, NULL,
+		  "Take a sample now and print it; loads cover the time "
+		  "since the previous one",
+		  cmd_health_sample),
+	SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(health, &sub_health, "Thread CPU and stack usage",
+		   cmd_health_show);
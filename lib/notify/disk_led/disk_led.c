@@ -11,6 +11,7 @@
  */
 
 #include <aurora/lib/disk_led.h>
+#include <aurora/lib/notify.h>
 
 #include <zephyr/device.h>
 #include <zephyr/drivers/gpio.h>
@@ -30,7 +31,9 @@ static const struct gpio_dt_spec disk_led =
  */
 static atomic_t disk_led_ready = ATOMIC_INIT(0);
 
-/* Deferred switch-off, run on the system wrkq when the hold timer fires. */
+/* Deferred switch-off, run when the hold timer fires: on the notify work
+ * queue with CONFIG_AURORA_NOTIFY_ASYNC, else on the system work queue.
+ */
 static void disk_led_off_fn(struct k_work *work)
 {
 	ARG_UNUSED(work);
@@ -50,8 +53,13 @@ void disk_led_activity(void)
 	/* Reschedule pushes the off-point forward, so sustained activity keeps
 	 * the LED lit and a pause switches it off.
 	 */
+#if defined(CONFIG_AURORA_NOTIFY_ASYNC)
+	(void)k_work_reschedule_for_queue(notify_work_q(), &disk_led_off_work,
+					  K_MSEC(CONFIG_AURORA_NOTIFY_DISK_LED_HOLD_MS));
+#else
 	(void)k_work_reschedule(&disk_led_off_work,
 				K_MSEC(CONFIG_AURORA_NOTIFY_DISK_LED_HOLD_MS));
+#endif /* CONFIG_AURORA_NOTIFY_ASYNC */
 }
 
 static int disk_led_init(void)
@@ -4,35 +4,18 @@
  */
 
 #include <aurora/lib/notify.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/iterable_sections.h>
 
 LOG_MODULE_REGISTER(notify, CONFIG_AURORA_NOTIFY_LOG_LEVEL);
 
-int notify_init(void)
-{
-	int rc = 0;
+/* -------------------------------------------------------------------------- */
+/*  Backend fan-out                                                           */
+/* -------------------------------------------------------------------------- */
 
-	STRUCT_SECTION_FOREACH(notify_backend, backend) {
-		if (!backend->api) {
-			LOG_ERR("Backend with NULL api pointer: %p", backend);
-			continue;
-		}
-		if (backend->api->init) {
-			int ret = backend->api->init();
-
-			if (ret) {
-				LOG_ERR("notify backend init failed (%d)", ret);
-				if (!rc) {
-					rc = ret;
-				}
-			}
-		}
-	}
-	return rc;
-}
-
-int notify_boot(void)
+static int dispatch_boot(void)
 {
 	int rc = 0;
 
@@ -55,7 +38,7 @@ int notify_boot(void)
 	return rc;
 }
 
-int notify_state_change(enum sm_state prev, enum sm_state next)
+static int dispatch_state_change(enum sm_state prev, enum sm_state next)
 {
 	int rc = 0;
 
@@ -78,7 +61,7 @@ int notify_state_change(enum sm_state prev, enum sm_state next)
 	return rc;
 }
 
-int notify_calibration_complete(void)
+static int dispatch_calibration_complete(void)
 {
 	int rc = 0;
 
@@ -101,7 +84,7 @@ int notify_calibration_complete(void)
 	return rc;
 }
 
-int notify_error(void)
+static int dispatch_error(void)
 {
 	int rc = 0;
 
@@ -124,7 +107,8 @@ int notify_error(void)
 	return rc;
 }
 
-void notify_powerfail(int recover) {
+static void dispatch_powerfail(int recover)
+{
 	STRUCT_SECTION_FOREACH(notify_backend, backend) {
 		if (!backend->api) {
 			LOG_ERR("Backend with NULL api pointer: %p", backend);
@@ -134,3 +118,268 @@ void notify_powerfail(int recover) {
 			backend->api->on_powerfail(recover);
 	}
 }
+
+#if defined(CONFIG_AURORA_NOTIFY_ASYNC)
+
+/* -------------------------------------------------------------------------- */
+/*  Deferred dispatch                                                         */
+/* -------------------------------------------------------------------------- */
+
+enum notify_evt_type {
+	NOTIFY_EVT_BOOT,
+	NOTIFY_EVT_STATE_CHANGE,
+	NOTIFY_EVT_CALIBRATION_COMPLETE,
+	NOTIFY_EVT_ERROR,
+	NOTIFY_EVT_POWERFAIL,
+};
+
+struct notify_evt {
+	uint8_t type;
+	/* STATE_CHANGE: prev/next state. POWERFAIL: arg = recover. */
+	uint8_t prev;
+	uint8_t arg;
+};
+
+#define EVT_QUEUE_SIZE CONFIG_AURORA_NOTIFY_ASYNC_QUEUE_SIZE
+
+/* Pending events, oldest first. Posted from any context (the powerfail
+ * hook runs in an ISR), drained by notify_dispatch_fn on notify_wq.
+ */
+static struct notify_evt evt_queue[EVT_QUEUE_SIZE];
+static uint8_t evt_head;
+static uint8_t evt_count;
+static uint32_t evt_dropped;
+static struct k_spinlock evt_lock;
+
+K_THREAD_STACK_DEFINE(notify_wq_stack, CONFIG_AURORA_NOTIFY_ASYNC_STACK_SIZE);
+static struct k_work_q notify_wq;
+
+static void notify_dispatch_fn(struct k_work *work);
+static K_WORK_DEFINE(notify_dispatch_work, notify_dispatch_fn);
+
+static struct notify_evt *evt_at(uint8_t i)
+{
+	return &evt_queue[(evt_head + i) % EVT_QUEUE_SIZE];
+}
+
+static bool evt_equal(const struct notify_evt *a, const struct notify_evt *b)
+{
+	return a->type == b->type && a->prev == b->prev && a->arg == b->arg;
+}
+
+/* Queue @p evt unless an equivalent event is still pending. Called with
+ * evt_lock held.
+ */
+static void evt_push_locked(const struct notify_evt *evt)
+{
+	struct notify_evt *tail = evt_count ? evt_at(evt_count - 1) : NULL;
+
+	/* Boot, calibration and error patterns carry no payload: one pending
+	 * instance covers every repeat, as long as no transition or powerfail
+	 * edge queued after it would have overridden its pattern.
+	 */
+	if (evt->type != NOTIFY_EVT_STATE_CHANGE &&
+	    evt->type != NOTIFY_EVT_POWERFAIL) {
+		for (uint8_t i = evt_count; i > 0; i--) {
+			const struct notify_evt *p = evt_at(i - 1);
+
+			if (p->type == evt->type)
+				return;
+			if (p->type == NOTIFY_EVT_STATE_CHANGE ||
+			    p->type == NOTIFY_EVT_POWERFAIL)
+				break;
+		}
+	}
+
+	/* Back-to-back identical transitions or powerfail edges. */
+	if (tail && evt_equal(tail, evt))
+		return;
+
+	if (evt_count < EVT_QUEUE_SIZE) {
+		*evt_at(evt_count++) = *evt;
+		return;
+	}
+
+	/* Full: fold a transition into a pending one so the backends still
+	 * end up showing the latest state, skipping the intermediate ones.
+	 */
+	if (evt->type == NOTIFY_EVT_STATE_CHANGE &&
+	    tail->type == NOTIFY_EVT_STATE_CHANGE) {
+		tail->arg = evt->arg;
+		return;
+	}
+
+	evt_dropped++;
+}
+
+static void evt_post(const struct notify_evt *evt)
+{
+	k_spinlock_key_t key = k_spin_lock(&evt_lock);
+
+	evt_push_locked(evt);
+	k_spin_unlock(&evt_lock, key);
+
+	/* Already queued or running is fine: the handler drains everything. */
+	(void)k_work_submit_to_queue(&notify_wq, &notify_dispatch_work);
+}
+
+static void notify_dispatch_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	for (;;) {
+		struct notify_evt evt;
+		uint32_t dropped;
+		k_spinlock_key_t key = k_spin_lock(&evt_lock);
+
+		if (evt_count == 0) {
+			k_spin_unlock(&evt_lock, key);
+			return;
+		}
+		evt = evt_queue[evt_head];
+		evt_head = (evt_head + 1) % EVT_QUEUE_SIZE;
+		evt_count--;
+		dropped = evt_dropped;
+		evt_dropped = 0;
+		k_spin_unlock(&evt_lock, key);
+
+		if (dropped)
+			LOG_WRN("notify queue full, dropped %u event(s)", dropped);
+
+		switch (evt.type) {
+		case NOTIFY_EVT_BOOT:
+			(void)dispatch_boot();
+			break;
+		case NOTIFY_EVT_STATE_CHANGE:
+			(void)dispatch_state_change((enum sm_state)evt.prev,
+						    (enum sm_state)evt.arg);
+			break;
+		case NOTIFY_EVT_CALIBRATION_COMPLETE:
+			(void)dispatch_calibration_complete();
+			break;
+		case NOTIFY_EVT_ERROR:
+			(void)dispatch_error();
+			break;
+		case NOTIFY_EVT_POWERFAIL:
+			dispatch_powerfail(evt.arg);
+			break;
+		}
+	}
+}
+
+/* notify_work_q – see notify.h */
+struct k_work_q *notify_work_q(void)
+{
+	return &notify_wq;
+}
+
+/* Started before the application level so that events posted from early
+ * hooks (powerfail ISR, disk_led) find a running queue.
+ */
+static int notify_wq_start(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "notify_wq",
+	};
+
+	k_work_queue_start(&notify_wq, notify_wq_stack,
+			   K_THREAD_STACK_SIZEOF(notify_wq_stack),
+			   CONFIG_AURORA_NOTIFY_ASYNC_THREAD_PRIORITY, &cfg);
+	return 0;
+}
+
+SYS_INIT(notify_wq_start, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+#endif /* CONFIG_AURORA_NOTIFY_ASYNC */
+
+/* -------------------------------------------------------------------------- */
+/*  Public API                                                                */
+/* -------------------------------------------------------------------------- */
+
+int notify_init(void)
+{
+	int rc = 0;
+
+	STRUCT_SECTION_FOREACH(notify_backend, backend) {
+		if (!backend->api) {
+			LOG_ERR("Backend with NULL api pointer: %p", backend);
+			continue;
+		}
+		if (backend->api->init) {
+			int ret = backend->api->init();
+
+			if (ret) {
+				LOG_ERR("notify backend init failed (%d)", ret);
+				if (!rc) {
+					rc = ret;
+				}
+			}
+		}
+	}
+	return rc;
+}
+
+int notify_boot(void)
+{
+#if defined(CONFIG_AURORA_NOTIFY_ASYNC)
+	const struct notify_evt evt = { .type = NOTIFY_EVT_BOOT };
+
+	evt_post(&evt);
+	return 0;
+#else
+	return dispatch_boot();
+#endif /* CONFIG_AURORA_NOTIFY_ASYNC */
+}
+
+int notify_state_change(enum sm_state prev, enum sm_state next)
+{
+#if defined(CONFIG_AURORA_NOTIFY_ASYNC)
+	const struct notify_evt evt = {
+		.type = NOTIFY_EVT_STATE_CHANGE,
+		.prev = (uint8_t)prev,
+		.arg = (uint8_t)next,
+	};
+
+	evt_post(&evt);
+	return 0;
+#else
+	return dispatch_state_change(prev, next);
+#endif /* CONFIG_AURORA_NOTIFY_ASYNC */
+}
+
+int notify_calibration_complete(void)
+{
+#if defined(CONFIG_AURORA_NOTIFY_ASYNC)
+	const struct notify_evt evt = { .type = NOTIFY_EVT_CALIBRATION_COMPLETE };
+
+	evt_post(&evt);
+	return 0;
+#else
+	return dispatch_calibration_complete();
+#endif /* CONFIG_AURORA_NOTIFY_ASYNC */
+}
+
+int notify_error(void)
+{
+#if defined(CONFIG_AURORA_NOTIFY_ASYNC)
+	const struct notify_evt evt = { .type = NOTIFY_EVT_ERROR };
+
+	evt_post(&evt);
+	return 0;
+#else
+	return dispatch_error();
+#endif /* CONFIG_AURORA_NOTIFY_ASYNC */
+}
+
+void notify_powerfail(int recover) {
+#if defined(CONFIG_AURORA_NOTIFY_ASYNC)
+	const struct notify_evt evt = {
+		.type = NOTIFY_EVT_POWERFAIL,
+		.arg = (uint8_t)(recover != 0),
+	};
+
+	evt_post(&evt);
+#else
+	dispatch_powerfail(recover);
+#endif /* CONFIG_AURORA_NOTIFY_ASYNC */
+}
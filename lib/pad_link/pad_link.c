@@ -25,6 +25,9 @@
 #if defined(CONFIG_BARO)
 #include <aurora/lib/baro.h>
 #endif
+#if defined(CONFIG_AURORA_HEALTH)
+#include <aurora/lib/health.h>
+#endif
 
 #include "pad_link_wire.h"
 
@@ -37,6 +40,7 @@ LOG_MODULE_REGISTER(pad_link, CONFIG_AURORA_PAD_LINK_LOG_LEVEL);
  * e8a591xx-7c0e-4b5b-9a4c-1f1b6f7c4d70
  *   xx = 00 service,    01 board,      02 sm_state,
  *        03 raw sensor, 04 computed,   05 sm_type
+ *        06 bundle,     07 thread health
  *        a0 boardcap,   a1 baro,       a2 accel,
  *        a3 gyro,       a4 6-DoF IMU,  a5 9-DoF IMU (planned),
  *        a6 GPS/GNSS (planned),        a7 inner_temp,
@@ -54,6 +58,10 @@ LOG_MODULE_REGISTER(pad_link, CONFIG_AURORA_PAD_LINK_LOG_LEVEL);
 	BT_UUID_128_ENCODE(0xe8a59104, 0x7c0e, 0x4b5b, 0x9a4c, 0x1f1b6f7c4d70)
 #define PL_UUID_SMTYPE_VAL \
 	BT_UUID_128_ENCODE(0xe8a59105, 0x7c0e, 0x4b5b, 0x9a4c, 0x1f1b6f7c4d70)
+#define PL_UUID_BUNDLE_VAL \
+	BT_UUID_128_ENCODE(0xe8a59106, 0x7c0e, 0x4b5b, 0x9a4c, 0x1f1b6f7c4d70)
+#define PL_UUID_HEALTH_VAL \
+	BT_UUID_128_ENCODE(0xe8a59107, 0x7c0e, 0x4b5b, 0x9a4c, 0x1f1b6f7c4d70)
 
 #define PL_UUID_BOARDCAP_VAL \
 	BT_UUID_128_ENCODE(0xe8a591a0, 0x7c0e, 0x4b5b, 0x9a4c, 0x1f1b6f7c4d70)
@@ -77,6 +85,8 @@ LOG_MODULE_REGISTER(pad_link, CONFIG_AURORA_PAD_LINK_LOG_LEVEL);
 	BT_UUID_128_ENCODE(0xe8a591a8, 0x7c0e, 0x4b5b, 0x9a4c, 0x1f1b6f7c4d70)
 #define PL_UUID_HULL_TEMP_VAL \
 	BT_UUID_128_ENCODE(0xe8a591a9, 0x7c0e, 0x4b5b, 0x9a4c, 0x1f1b6f7c4d70)
+#define PL_UUID_PYRO_VAL \
+	BT_UUID_128_ENCODE(0xe8a591aa, 0x7c0e, 0x4b5b, 0x9a4c, 0x1f1b6f7c4d70)
 
 static const struct bt_uuid_128 pl_uuid_svc =
 	BT_UUID_INIT_128(PL_UUID_SVC_VAL);
@@ -90,6 +100,11 @@ static const struct bt_uuid_128 pl_uuid_comp =
 	BT_UUID_INIT_128(PL_UUID_COMP_VAL);
 static const struct bt_uuid_128 pl_uuid_smtype =
 	BT_UUID_INIT_128(PL_UUID_SMTYPE_VAL);
+static const struct bt_uuid_128 pl_uuid_bundle =
+	BT_UUID_INIT_128(PL_UUID_BUNDLE_VAL);
+
+static const struct bt_uuid_128 pl_uuid_health =
+	BT_UUID_INIT_128(PL_UUID_HEALTH_VAL);
 
 static const struct bt_uuid_128 pl_uuid_boardcap =
 	BT_UUID_INIT_128(PL_UUID_BOARDCAP_VAL);
@@ -103,13 +118,15 @@ static const struct bt_uuid_128 pl_uuid_imu6 =
 	BT_UUID_INIT_128(PL_UUID_IMU6_VAL);
 static const struct bt_uuid_128 pl_uuid_inner_temp =
 	BT_UUID_INIT_128(PL_UUID_INNER_TEMP_VAL);
+static const struct bt_uuid_128 pl_uuid_pyro =
+	BT_UUID_INIT_128(PL_UUID_PYRO_VAL);
 
 /* Wire-format payloads (pl_raw_payload, pl_computed_payload) live in
  * pad_link_wire.h so the unit tests can include them directly.
  */
 
-static struct {
-	struct k_spinlock lock;
+/* Snapshot fields, as copied out by snap_copy() for the notify pass. */
+struct pl_snapshot {
 	uint8_t sm_type;
 	uint8_t sm_state;
 	struct pl_raw_payload raw;
@@ -119,18 +136,201 @@ static struct {
 	struct pl_accel_payload accel;
 	struct pl_gyro_payload gyro;
 	struct pl_inner_temp_payload inner_temp;
+	struct pl_pyro_payload pyro;
+};
+
+/* Two-copy seqcount latch. The writer bumps seq to odd and updates
+ * copy 0, then bumps it to even and updates copy 1; a reader copies
+ * slot (seq & 1), which the writer is not touching, and retries only
+ * if seq moved meanwhile. A writer preempted half-way therefore never
+ * stalls a reader, and neither side masks interrupts. Writers of one
+ * latch must be serialised: the zbus channel lock does that for the
+ * sensor listeners, the SM thread is the only caller of the publish
+ * functions. Zephyr's atomic_inc/atomic_get are full barriers.
+ */
+struct pl_latch {
+	atomic_t seq;
+};
+
+static void latch_store(struct pl_latch *l, void *slots, const void *src,
+			size_t sz)
+{
+	uint8_t *slot = slots;
+
+	(void)atomic_inc(&l->seq);
+	memcpy(slot, src, sz);
+	(void)atomic_inc(&l->seq);
+	memcpy(slot + sz, src, sz);
+}
+
+static void latch_load(const struct pl_latch *l, const void *slots,
+		       void *dst, size_t sz)
+{
+	const uint8_t *slot = slots;
+	atomic_val_t seq;
+
+	do {
+		seq = atomic_get(&l->seq);
+		memcpy(dst, slot + (size_t)(seq & 1) * sz, sz);
+	} while (atomic_get(&l->seq) != seq);
+}
+
+#define SNAP_STORE(group, src)						\
+	latch_store(&snap.group##_seq, snap.group, (src),		\
+		    sizeof(snap.group[0]))
+#define SNAP_LOAD(group, dst)						\
+	latch_load(&snap.group##_seq, snap.group, (dst),		\
+		   sizeof(snap.group[0]))
+
+/* What each producer owns. raw and inner_temp are composed from these
+ * at read time, like imu6.
+ */
+struct pl_imu_snap {
+	struct pl_accel_payload accel;
+	struct pl_gyro_payload gyro;
+};
+
+struct pl_sm_snap {
+	uint8_t sm_type;
+	uint8_t sm_state;
+	struct pl_computed_payload comp;
+};
+
+static struct {
+	struct pl_latch imu_seq;
+	struct pl_imu_snap imu[2];
+	struct pl_latch baro_seq;
+	struct pl_baro_payload baro[2];
+	struct pl_latch sm_seq;
+	struct pl_sm_snap sm[2];
+	struct pl_latch pyro_seq;
+	struct pl_pyro_payload pyro[2];
+	atomic_t boardcap;
+
+	/* Notify scheduling, see notify_mark_due(). */
+	struct k_spinlock lock;
+	int64_t due_ms[PL_N_COUNT];
+	int64_t baro_sent_press_us;
+	int64_t baro_sent_ms;
 } snap;
 
+/* The raw payload (a3) carries the IMU and baro samples as val1.val2
+ * pairs; its uptime is that of the later of the two.
+ */
+static void compose_raw(struct pl_raw_payload *out,
+			const struct pl_imu_snap *imu,
+			const struct pl_baro_payload *baro)
+{
+	out->uptime_ms = (int32_t)(imu->accel.uptime_ms - baro->uptime_ms) >= 0 ?
+			 imu->accel.uptime_ms : baro->uptime_ms;
+	for (int i = 0; i < 3; i++) {
+		sample_to_raw((aurora_sample_t)imu->accel.accel_us[i],
+			      &out->accel_val1[i], &out->accel_val2[i]);
+		sample_to_raw((aurora_sample_t)imu->gyro.gyro_us[i],
+			      &out->gyro_val1[i], &out->gyro_val2[i]);
+	}
+	sample_to_raw((aurora_sample_t)baro->temp_us, &out->temp_val1,
+		      &out->temp_val2);
+	sample_to_raw((aurora_sample_t)baro->press_us, &out->press_val1,
+		      &out->press_val2);
+}
+
+/* The board's inner temperature (a7) is the barometer's. */
+static void compose_inner_temp(struct pl_inner_temp_payload *out,
+			       const struct pl_baro_payload *baro)
+{
+	out->uptime_ms = baro->uptime_ms;
+	out->temp_us   = baro->temp_us;
+}
+
+/* Every group is consistent on its own; groups may be from different
+ * publishes, as each producer writes only its own.
+ */
+static void snap_copy(struct pl_snapshot *out)
+{
+	struct pl_imu_snap imu;
+	struct pl_sm_snap sm;
+
+	SNAP_LOAD(imu, &imu);
+	SNAP_LOAD(baro, &out->baro);
+	SNAP_LOAD(sm, &sm);
+	SNAP_LOAD(pyro, &out->pyro);
+
+	out->sm_type    = sm.sm_type;
+	out->sm_state   = sm.sm_state;
+	out->comp       = sm.comp;
+	out->boardcap   = (uint32_t)atomic_get(&snap.boardcap);
+	out->accel      = imu.accel;
+	out->gyro       = imu.gyro;
+	compose_raw(&out->raw, &imu, &out->baro);
+	compose_inner_temp(&out->inner_temp, &out->baro);
+}
+
 /* The 6-DoF IMU payload (a4) carries the same data as accel (a2) +
  * gyro (a3); compose it from those snapshots instead of maintaining a
- * third copy. Caller must hold snap.lock. Both snapshots are stamped
- * together in on_imu(), so accel's uptime is the payload's uptime.
+ * third copy. Both are stamped together in on_imu(), so accel's uptime
+ * is the payload's uptime.
+ */
+static void compose_imu6(struct pl_imu6_payload *out,
+			 const struct pl_accel_payload *accel,
+			 const struct pl_gyro_payload *gyro)
+{
+	out->uptime_ms = accel->uptime_ms;
+	memcpy(out->accel_us, accel->accel_us, sizeof(out->accel_us));
+	memcpy(out->gyro_us, gyro->gyro_us, sizeof(out->gyro_us));
+}
+
+static size_t bundle_put(uint8_t *buf, size_t cap, size_t len,
+			 uint8_t flag, const void *sec, size_t sec_len,
+			 struct pl_bundle_hdr *hdr)
+{
+	if (len + sec_len > cap) {
+		return len;
+	}
+	memcpy(&buf[len], sec, sec_len);
+	hdr->fields |= flag;
+	return len + sec_len;
+}
+
+/* Pack the telemetry bundle (see pad_link_wire.h) from a snapshot copy.
+ * Sections follow the board capabilities; whatever does not fit in
+ * `cap` is left out. Returns the bundle length.
  */
-static void snap_compose_imu6(struct pl_imu6_payload *out)
+static size_t bundle_build(const struct pl_snapshot *s, uint8_t *buf,
+			   size_t cap)
 {
-	out->uptime_ms = snap.accel.uptime_ms;
-	memcpy(out->accel_us, snap.accel.accel_us, sizeof(out->accel_us));
-	memcpy(out->gyro_us, snap.gyro.gyro_us, sizeof(out->gyro_us));
+	struct pl_bundle_hdr hdr = {
+		.version  = PL_BUNDLE_VERSION,
+		.sm_type  = s->sm_type,
+		.sm_state = s->sm_state,
+	};
+	size_t len = sizeof(hdr);
+
+	if (cap < sizeof(hdr)) {
+		return 0;
+	}
+
+	len = bundle_put(buf, cap, len, PL_BUNDLE_F_COMP,
+			 &s->comp, sizeof(s->comp), &hdr);
+	if (s->boardcap & PL_CAP_ACCEL) {
+		len = bundle_put(buf, cap, len, PL_BUNDLE_F_ACCEL,
+				 &s->accel, sizeof(s->accel), &hdr);
+	}
+	if (s->boardcap & PL_CAP_GYRO) {
+		len = bundle_put(buf, cap, len, PL_BUNDLE_F_GYRO,
+				 &s->gyro, sizeof(s->gyro), &hdr);
+	}
+	if (s->boardcap & PL_CAP_BARO) {
+		len = bundle_put(buf, cap, len, PL_BUNDLE_F_BARO,
+				 &s->baro, sizeof(s->baro), &hdr);
+	}
+	if (s->boardcap & PL_CAP_TEMP_INNER) {
+		len = bundle_put(buf, cap, len, PL_BUNDLE_F_INNER_TEMP,
+				 &s->inner_temp, sizeof(s->inner_temp), &hdr);
+	}
+
+	memcpy(buf, &hdr, sizeof(hdr));
+	return len;
 }
 
 static const char board_id[] = CONFIG_AURORA_PAD_LINK_BOARD_ID;
@@ -138,35 +338,80 @@ static const char board_id[] = CONFIG_AURORA_PAD_LINK_BOARD_ID;
 /* Single-central peripheral. */
 static struct bt_conn *current_conn;
 
-static bool sm_state_notify_enabled;
-static bool raw_notify_enabled;
-static bool comp_notify_enabled;
-static bool baro_notify_enabled;
-static bool accel_notify_enabled;
-static bool gyro_notify_enabled;
-static bool imu6_notify_enabled;
-static bool inner_temp_notify_enabled;
+/* Subscribed characteristics (CCC written by the central), one
+ * BIT(PL_N_*) each. Written from the host's context, read everywhere.
+ */
+static atomic_t pl_subscribed;
+
+/* Characteristics due for a notification. The producers (zbus
+ * listeners, pad_link_publish_sm) set bits, notify_work_handler()
+ * clears them, so a pass only sends values that are both new and due.
+ */
+static atomic_t pl_pending;
+
+/* Minimum spacing between notifications of each characteristic. The
+ * state byte is change-driven: it goes out on every transition and
+ * never on its own otherwise. Faster than the BLE link could drain
+ * them, per-tick pushes left the ATT pool permanently empty.
+ */
+static const uint16_t notify_period_ms[PL_N_COUNT] = {
+	[PL_N_STATE]      = 0,
+	[PL_N_RAW]        = CONFIG_AURORA_PAD_LINK_IMU_PERIOD_MS,
+	[PL_N_COMP]       = CONFIG_AURORA_PAD_LINK_COMP_PERIOD_MS,
+	[PL_N_BARO]       = CONFIG_AURORA_PAD_LINK_BARO_PERIOD_MS,
+	[PL_N_ACCEL]      = CONFIG_AURORA_PAD_LINK_IMU_PERIOD_MS,
+	[PL_N_GYRO]       = CONFIG_AURORA_PAD_LINK_IMU_PERIOD_MS,
+	[PL_N_IMU6]       = CONFIG_AURORA_PAD_LINK_IMU_PERIOD_MS,
+	[PL_N_INNER_TEMP] = CONFIG_AURORA_PAD_LINK_TEMP_PERIOD_MS,
+	[PL_N_BUNDLE]     = CONFIG_AURORA_PAD_LINK_BUNDLE_PERIOD_MS,
+	[PL_N_PYRO]       = CONFIG_AURORA_PAD_LINK_PYRO_PERIOD_MS,
+};
+
+/* A value held inside its deadband still goes out this often, so the
+ * central can tell a quiet sensor from a dead link.
+ */
+#define NOTIFY_REFRESH_MS 1000
+
+/* Sensor pressure is in kPa; snapshots hold micro-kPa. */
+#define BARO_DEADBAND_US ((int64_t)CONFIG_AURORA_PAD_LINK_BARO_DEADBAND_PA * 1000)
 
 /* Back-off gate for bt_gatt_notify. The LL link can die (timeout, RF
  * loss) well before disconnected() fires; in that gap conn is
  * non-NULL, bt_conn_get_info still reports CONNECTED, but ATT has no
  * bearer. Calling bt_gatt_notify in that state makes the host log
  * "No ATT channel for MTU N" at every SM tick (100 Hz). When a notify
- * fails we sit out for NOTIFY_BACKOFF_MS before retrying;
- * disconnected() clears the timer on the next real teardown so a
- * fresh connection isn't penalised.
+ * fails for any reason other than a drained ATT pool we sit out for
+ * NOTIFY_BACKOFF_MS before retrying; disconnected() clears the timer
+ * on the next real teardown so a fresh connection isn't penalised.
  */
 #define NOTIFY_BACKOFF_MS 1000
 static int64_t notify_backoff_until_ms;
 
-/* Telemetry push rate cap. The SM loop ticks at the Sensor ODR (over 100 Hz)
- * and each pass notifies several characteristics; far more than any BLE link
- * can carry (a ~30 ms connection interval moves ~100-150 packets/s), so the
- * ATT pool would sit permanently drained (-ENOMEM at every tick). The
- * snapshot is still updated every tick (GATT reads stay fresh); only the
- * notify push is throttled to this period.
+static void notify_kick(void);
+
+/* Mark `ch` pending if a central subscribed to it and its period has
+ * elapsed. Caller must hold snap.lock. Returns true when marked.
  */
-#define NOTIFY_MIN_INTERVAL_MS 100
+static bool notify_mark_due(enum pl_notify ch, int64_t now)
+{
+	if (!atomic_test_bit(&pl_subscribed, ch) || now < snap.due_ms[ch]) {
+		return false;
+	}
+	snap.due_ms[ch] = now + notify_period_ms[ch];
+	atomic_set_bit(&pl_pending, ch);
+	return true;
+}
+
+/* Like notify_mark_due(), ignoring the period. For transitions. */
+static bool notify_mark_now(enum pl_notify ch, int64_t now)
+{
+	if (!atomic_test_bit(&pl_subscribed, ch)) {
+		return false;
+	}
+	snap.due_ms[ch] = now + notify_period_ms[ch];
+	atomic_set_bit(&pl_pending, ch);
+	return true;
+}
 
 /* ------------------------------------------------------------------ */
 /* GATT read handlers                                                  */
@@ -184,24 +429,22 @@ static ssize_t read_smtype(struct bt_conn *conn,
 			   const struct bt_gatt_attr *attr,
 			   void *buf, uint16_t len, uint16_t offset)
 {
-	uint8_t v;
-	K_SPINLOCK(&snap.lock) {
-		v = snap.sm_type;
-	}
+	struct pl_sm_snap sm;
+
+	SNAP_LOAD(sm, &sm);
 	return bt_gatt_attr_read(conn, attr, buf, len, offset,
-				 &v, sizeof(v));
+				 &sm.sm_type, sizeof(sm.sm_type));
 }
 
 static ssize_t read_state(struct bt_conn *conn,
 			  const struct bt_gatt_attr *attr,
 			  void *buf, uint16_t len, uint16_t offset)
 {
-	uint8_t v;
-	K_SPINLOCK(&snap.lock) {
-		v = snap.sm_state;
-	}
+	struct pl_sm_snap sm;
+
+	SNAP_LOAD(sm, &sm);
 	return bt_gatt_attr_read(conn, attr, buf, len, offset,
-				 &v, sizeof(v));
+				 &sm.sm_state, sizeof(sm.sm_state));
 }
 
 static ssize_t read_raw(struct bt_conn *conn,
@@ -209,9 +452,12 @@ static ssize_t read_raw(struct bt_conn *conn,
 			void *buf, uint16_t len, uint16_t offset)
 {
 	struct pl_raw_payload v;
-	K_SPINLOCK(&snap.lock) {
-		v = snap.raw;
-	}
+	struct pl_imu_snap imu;
+	struct pl_baro_payload baro;
+
+	SNAP_LOAD(imu, &imu);
+	SNAP_LOAD(baro, &baro);
+	compose_raw(&v, &imu, &baro);
 	return bt_gatt_attr_read(conn, attr, buf, len, offset,
 				 &v, sizeof(v));
 }
@@ -220,22 +466,19 @@ static ssize_t read_comp(struct bt_conn *conn,
 			 const struct bt_gatt_attr *attr,
 			 void *buf, uint16_t len, uint16_t offset)
 {
-	struct pl_computed_payload v;
-	K_SPINLOCK(&snap.lock) {
-		v = snap.comp;
-	}
+	struct pl_sm_snap sm;
+
+	SNAP_LOAD(sm, &sm);
 	return bt_gatt_attr_read(conn, attr, buf, len, offset,
-				 &v, sizeof(v));
+				 &sm.comp, sizeof(sm.comp));
 }
 
 static ssize_t read_boardcap(struct bt_conn *conn,
 			 const struct bt_gatt_attr *attr,
 			 void *buf, uint16_t len, uint16_t offset)
 {
-	uint32_t v;
-	K_SPINLOCK(&snap.lock) {
-		v = snap.boardcap;
-	}
+	uint32_t v = (uint32_t)atomic_get(&snap.boardcap);
+
 	return bt_gatt_attr_read(conn, attr, buf, len, offset,
 				 &v, sizeof(v));
 }
@@ -245,9 +488,8 @@ static ssize_t read_baro(struct bt_conn *conn,
 			 void *buf, uint16_t len, uint16_t offset)
 {
 	struct pl_baro_payload v;
-	K_SPINLOCK(&snap.lock) {
-		v = snap.baro;
-	}
+
+	SNAP_LOAD(baro, &v);
 	return bt_gatt_attr_read(conn, attr, buf, len, offset,
 				 &v, sizeof(v));
 }
@@ -256,24 +498,22 @@ static ssize_t read_accel(struct bt_conn *conn,
 			  const struct bt_gatt_attr *attr,
 			  void *buf, uint16_t len, uint16_t offset)
 {
-	struct pl_accel_payload v;
-	K_SPINLOCK(&snap.lock) {
-		v = snap.accel;
-	}
+	struct pl_imu_snap imu;
+
+	SNAP_LOAD(imu, &imu);
 	return bt_gatt_attr_read(conn, attr, buf, len, offset,
-				 &v, sizeof(v));
+				 &imu.accel, sizeof(imu.accel));
 }
 
 static ssize_t read_gyro(struct bt_conn *conn,
 			 const struct bt_gatt_attr *attr,
 			 void *buf, uint16_t len, uint16_t offset)
 {
-	struct pl_gyro_payload v;
-	K_SPINLOCK(&snap.lock) {
-		v = snap.gyro;
-	}
+	struct pl_imu_snap imu;
+
+	SNAP_LOAD(imu, &imu);
 	return bt_gatt_attr_read(conn, attr, buf, len, offset,
-				 &v, sizeof(v));
+				 &imu.gyro, sizeof(imu.gyro));
 }
 
 static ssize_t read_imu6(struct bt_conn *conn,
@@ -281,9 +521,10 @@ static ssize_t read_imu6(struct bt_conn *conn,
 			 void *buf, uint16_t len, uint16_t offset)
 {
 	struct pl_imu6_payload v;
-	K_SPINLOCK(&snap.lock) {
-		snap_compose_imu6(&v);
-	}
+	struct pl_imu_snap imu;
+
+	SNAP_LOAD(imu, &imu);
+	compose_imu6(&v, &imu.accel, &imu.gyro);
 	return bt_gatt_attr_read(conn, attr, buf, len, offset,
 				 &v, sizeof(v));
 }
@@ -293,59 +534,200 @@ static ssize_t read_inner_temp(struct bt_conn *conn,
 			       void *buf, uint16_t len, uint16_t offset)
 {
 	struct pl_inner_temp_payload v;
-	K_SPINLOCK(&snap.lock) {
-		v = snap.inner_temp;
-	}
+	struct pl_baro_payload baro;
+
+	SNAP_LOAD(baro, &baro);
+	compose_inner_temp(&v, &baro);
+	return bt_gatt_attr_read(conn, attr, buf, len, offset,
+				 &v, sizeof(v));
+}
+
+static ssize_t read_pyro(struct bt_conn *conn,
+			 const struct bt_gatt_attr *attr,
+			 void *buf, uint16_t len, uint16_t offset)
+{
+	struct pl_pyro_payload v;
+
+	SNAP_LOAD(pyro, &v);
 	return bt_gatt_attr_read(conn, attr, buf, len, offset,
 				 &v, sizeof(v));
 }
 
+/* Long reads (offset > 0) rebuild the bundle each time; a central on
+ * the default MTU may see fields from two snapshots. Notifications are
+ * always one snapshot.
+ */
+static ssize_t read_bundle(struct bt_conn *conn,
+			   const struct bt_gatt_attr *attr,
+			   void *buf, uint16_t len, uint16_t offset)
+{
+	struct pl_snapshot s;
+	uint8_t v[PL_BUNDLE_MAX_LEN];
+	size_t n;
+
+	snap_copy(&s);
+	n = bundle_build(&s, v, sizeof(v));
+	return bt_gatt_attr_read(conn, attr, buf, len, offset, v, n);
+}
+
+BUILD_ASSERT(PL_HEALTH_MAX_LEN <= 512,
+	     "health payload exceeds the ATT attribute limit");
+
+#if defined(CONFIG_AURORA_HEALTH)
+BUILD_ASSERT(HEALTH_NAME_LEN == PL_HEALTH_NAME_LEN,
+	     "health names must fill the payload name field");
+
+static K_MUTEX_DEFINE(health_mutex);
+static struct health_thread health_buf[CONFIG_AURORA_HEALTH_MAX_THREADS];
+
+/* Pack the thread health payload (see pad_link_wire.h) from the
+ * latest lib/health sample. Returns the payload length.
+ */
+static size_t health_build(uint8_t *buf, size_t cap)
+{
+	struct pl_health_hdr hdr = { 0 };
+	size_t len = sizeof(hdr);
+	uint32_t skipped;
+	int64_t uptime_ms;
+	size_t n;
+
+	if (cap < sizeof(hdr)) {
+		return 0;
+	}
+
+	k_mutex_lock(&health_mutex, K_FOREVER);
+	n = health_get(health_buf, ARRAY_SIZE(health_buf), &uptime_ms);
+	skipped = health_skipped();
+	hdr.uptime_ms = (uint32_t)uptime_ms;
+	for (size_t i = 0; i < n; i++) {
+		struct pl_health_entry e = {
+			.load_ppm   = health_buf[i].load_ppm,
+			.stack_size = health_buf[i].stack_size,
+			.stack_used = health_buf[i].stack_used,
+		};
+
+		if (hdr.n_threads == PL_HEALTH_MAX_THREADS ||
+		    len + sizeof(e) > cap) {
+			skipped += n - i;
+			break;
+		}
+		strncpy(e.name, health_buf[i].name, sizeof(e.name));
+		memcpy(&buf[len], &e, sizeof(e));
+		len += sizeof(e);
+		hdr.n_threads++;
+	}
+	k_mutex_unlock(&health_mutex);
+
+	hdr.skipped = (uint8_t)MIN(skipped, UINT8_MAX);
+	memcpy(buf, &hdr, sizeof(hdr));
+	return len;
+}
+#else
+static size_t health_build(uint8_t *buf, size_t cap)
+{
+	const struct pl_health_hdr hdr = { 0 };
+
+	if (cap < sizeof(hdr)) {
+		return 0;
+	}
+	memcpy(buf, &hdr, sizeof(hdr));
+	return sizeof(hdr);
+}
+#endif /* CONFIG_AURORA_HEALTH */
+
+/* Rebuilt on every read, so a long read on the default MTU may mix
+ * two samples.
+ */
+static ssize_t read_health(struct bt_conn *conn,
+			   const struct bt_gatt_attr *attr,
+			   void *buf, uint16_t len, uint16_t offset)
+{
+	static uint8_t v[PL_HEALTH_MAX_LEN];
+	size_t n;
+
+	/* Only the host's RX thread serves reads. */
+	n = health_build(v, sizeof(v));
+	return bt_gatt_attr_read(conn, attr, buf, len, offset, v, n);
+}
+
+static void link_tune_schedule(void);
+
+/* A new subscriber gets the current value straight away; the period
+ * starts from there.
+ */
+static void ccc_set(enum pl_notify ch, uint16_t value)
+{
+	if (value == BT_GATT_CCC_NOTIFY) {
+		K_SPINLOCK(&snap.lock) {
+			snap.due_ms[ch] = 0;
+		}
+		atomic_set_bit(&pl_subscribed, ch);
+		atomic_set_bit(&pl_pending, ch);
+		notify_kick();
+	} else {
+		atomic_clear_bit(&pl_subscribed, ch);
+	}
+	link_tune_schedule();
+}
+
 static void state_ccc_cfg(const struct bt_gatt_attr *attr, uint16_t value)
 {
 	ARG_UNUSED(attr);
-	sm_state_notify_enabled = (value == BT_GATT_CCC_NOTIFY);
+	ccc_set(PL_N_STATE, value);
 }
 
 static void raw_ccc_cfg(const struct bt_gatt_attr *attr, uint16_t value)
 {
 	ARG_UNUSED(attr);
-	raw_notify_enabled = (value == BT_GATT_CCC_NOTIFY);
+	ccc_set(PL_N_RAW, value);
 }
 
 static void comp_ccc_cfg(const struct bt_gatt_attr *attr, uint16_t value)
 {
 	ARG_UNUSED(attr);
-	comp_notify_enabled = (value == BT_GATT_CCC_NOTIFY);
+	ccc_set(PL_N_COMP, value);
 }
 
 static void baro_ccc_cfg(const struct bt_gatt_attr *attr, uint16_t value)
 {
 	ARG_UNUSED(attr);
-	baro_notify_enabled = (value == BT_GATT_CCC_NOTIFY);
+	ccc_set(PL_N_BARO, value);
 }
 
 static void accel_ccc_cfg(const struct bt_gatt_attr *attr, uint16_t value)
 {
 	ARG_UNUSED(attr);
-	accel_notify_enabled = (value == BT_GATT_CCC_NOTIFY);
+	ccc_set(PL_N_ACCEL, value);
 }
 
 static void gyro_ccc_cfg(const struct bt_gatt_attr *attr, uint16_t value)
 {
 	ARG_UNUSED(attr);
-	gyro_notify_enabled = (value == BT_GATT_CCC_NOTIFY);
+	ccc_set(PL_N_GYRO, value);
 }
 
 static void imu6_ccc_cfg(const struct bt_gatt_attr *attr, uint16_t value)
 {
 	ARG_UNUSED(attr);
-	imu6_notify_enabled = (value == BT_GATT_CCC_NOTIFY);
+	ccc_set(PL_N_IMU6, value);
 }
 
 static void inner_temp_ccc_cfg(const struct bt_gatt_attr *attr, uint16_t value)
 {
 	ARG_UNUSED(attr);
-	inner_temp_notify_enabled = (value == BT_GATT_CCC_NOTIFY);
+	ccc_set(PL_N_INNER_TEMP, value);
+}
+
+static void bundle_ccc_cfg(const struct bt_gatt_attr *attr, uint16_t value)
+{
+	ARG_UNUSED(attr);
+	ccc_set(PL_N_BUNDLE, value);
+}
+
+static void pyro_ccc_cfg(const struct bt_gatt_attr *attr, uint16_t value)
+{
+	ARG_UNUSED(attr);
+	ccc_set(PL_N_PYRO, value);
 }
 
 /* Service layout. Keep the value-attribute indices in sync with
@@ -367,6 +749,9 @@ static void inner_temp_ccc_cfg(const struct bt_gatt_attr *attr, uint16_t value)
  *   [28] inner_temp declaration   [29] inner_temp val  [30]  inner_temp CCC
  *   [ -] motor_temp (planned, a8) [ -] motor_temp val  [ -]  motor_temp CCC
  *   [ -] hull_temp  (planned, a9) [ -] hull_temp val   [ -]  hull_temp CCC
+ *   [31] bundle declaration       [32] bundle value    [33]  bundle CCC
+ *   [34] pyro declaration         [35] pyro value      [36]  pyro CCC
+ *   [37] health declaration       [38] health value
  */
 #define PL_ATTR_STATE_VALUE      6
 #define PL_ATTR_RAW_VALUE        9
@@ -376,6 +761,8 @@ static void inner_temp_ccc_cfg(const struct bt_gatt_attr *attr, uint16_t value)
 #define PL_ATTR_GYRO_VALUE      23
 #define PL_ATTR_IMU6_VALUE      26
 #define PL_ATTR_INNER_TEMP_VALUE 29
+#define PL_ATTR_BUNDLE_VALUE    32
+#define PL_ATTR_PYRO_VALUE      35
 
 BT_GATT_SERVICE_DEFINE(pad_link_svc,
 	BT_GATT_PRIMARY_SERVICE(&pl_uuid_svc),
@@ -454,6 +841,25 @@ BT_GATT_SERVICE_DEFINE(pad_link_svc,
 		BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),
 
 	/* TODO: a8 motor_temp, a9 hull_temp — add read handler, snap field and CCC when source exists. */
+
+	BT_GATT_CHARACTERISTIC(&pl_uuid_bundle.uuid,
+		BT_GATT_CHRC_READ | BT_GATT_CHRC_NOTIFY,
+		BT_GATT_PERM_READ,
+		read_bundle, NULL, NULL),
+	BT_GATT_CCC(bundle_ccc_cfg,
+		BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),
+
+	BT_GATT_CHARACTERISTIC(&pl_uuid_pyro.uuid,
+		BT_GATT_CHRC_READ | BT_GATT_CHRC_NOTIFY,
+		BT_GATT_PERM_READ,
+		read_pyro, NULL, NULL),
+	BT_GATT_CCC(pyro_ccc_cfg,
+		BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),
+
+	BT_GATT_CHARACTERISTIC(&pl_uuid_health.uuid,
+		BT_GATT_CHRC_READ,
+		BT_GATT_PERM_READ,
+		read_health, NULL, NULL),
 );
 
 /* ------------------------------------------------------------------ */
@@ -465,22 +871,28 @@ static void on_imu(const struct zbus_channel *chan)
 {
 	const struct imu_data *d = zbus_chan_const_msg(chan);
 	uint32_t now = k_uptime_get_32();
+	struct pl_imu_snap imu = {
+		.accel.uptime_ms = now,
+		.gyro.uptime_ms  = now,
+	};
+	bool kick = false;
+
+	for (int i = 0; i < 3; i++) {
+		imu.accel.accel_us[i] = d->accel[i];
+		imu.gyro.gyro_us[i]   = d->gyro[i];
+	}
+	SNAP_STORE(imu, &imu);
 
 	K_SPINLOCK(&snap.lock) {
-		snap.raw.uptime_ms = now;
-		for (int i = 0; i < 3; i++) {
-			snap.raw.accel_val1[i] = d->accel[i].val1;
-			snap.raw.accel_val2[i] = d->accel[i].val2;
-			snap.raw.gyro_val1[i]  = d->gyro[i].val1;
-			snap.raw.gyro_val2[i]  = d->gyro[i].val2;
-		}
+		kick |= notify_mark_due(PL_N_RAW, now);
+		kick |= notify_mark_due(PL_N_ACCEL, now);
+		kick |= notify_mark_due(PL_N_GYRO, now);
+		kick |= notify_mark_due(PL_N_IMU6, now);
+		kick |= notify_mark_due(PL_N_BUNDLE, now);
+	}
 
-		snap.accel.uptime_ms = now;
-		snap.gyro.uptime_ms  = now;
-		for (int i = 0; i < 3; i++) {
-			snap.accel.accel_us[i] = sv_to_i64(&d->accel[i]);
-			snap.gyro.gyro_us[i]   = sv_to_i64(&d->gyro[i]);
-		}
+	if (kick) {
+		notify_kick();
 	}
 }
 ZBUS_LISTENER_DEFINE(pl_imu_lis, on_imu);
@@ -492,21 +904,36 @@ static void on_baro(const struct zbus_channel *chan)
 {
 	const struct baro_data *d = zbus_chan_const_msg(chan);
 	uint32_t now = k_uptime_get_32();
-	int64_t temp_us = sv_to_i64(&d->temperature);
-	int64_t press_us = sv_to_i64(&d->pressure);
+	const int64_t press_us = d->pressure;
+	const struct pl_baro_payload baro = {
+		.uptime_ms = now,
+		.temp_us   = d->temperature,
+		.press_us  = press_us,
+	};
+	bool kick = false;
+
+	SNAP_STORE(baro, &baro);
 
 	K_SPINLOCK(&snap.lock) {
-		snap.raw.uptime_ms   = now;
-		snap.raw.temp_val1   = d->temperature.val1;
-		snap.raw.temp_val2   = d->temperature.val2;
-		snap.raw.press_val1  = d->pressure.val1;
-		snap.raw.press_val2  = d->pressure.val2;
+		/* Pressure inside the deadband is not news, until the
+		 * refresh interval runs out.
+		 */
+		const int64_t dp = press_us - snap.baro_sent_press_us;
+
+		if ((dp >= BARO_DEADBAND_US || -dp >= BARO_DEADBAND_US ||
+		     now - snap.baro_sent_ms >= NOTIFY_REFRESH_MS) &&
+		    notify_mark_due(PL_N_BARO, now)) {
+			snap.baro_sent_press_us = press_us;
+			snap.baro_sent_ms = now;
+			kick = true;
+		}
+		kick |= notify_mark_due(PL_N_RAW, now);
+		kick |= notify_mark_due(PL_N_INNER_TEMP, now);
+		kick |= notify_mark_due(PL_N_BUNDLE, now);
+	}
 
-		snap.baro.uptime_ms       = now;
-		snap.baro.temp_us         = temp_us;
-		snap.baro.press_us        = press_us;
-		snap.inner_temp.uptime_ms = now;
-		snap.inner_temp.temp_us   = temp_us;
+	if (kick) {
+		notify_kick();
 	}
 }
 ZBUS_LISTENER_DEFINE(pl_baro_lis, on_baro);
@@ -577,6 +1004,126 @@ static void adv_start_schedule(void)
 	k_work_reschedule(&adv_start_work, K_NO_WAIT);
 }
 
+/* Link tuning. A central's default link (23-byte MTU, 27-byte LL
+ * payloads, 1M PHY, 30-50 ms interval) fragments every sensor payload
+ * and caps the notify rate well below the snapshot rate. Once per
+ * connection ask for 2M PHY, maximum data length and a large ATT MTU;
+ * then request a short connection interval while any high-rate
+ * characteristic is subscribed and a long, low-latency-tolerant one
+ * otherwise. All requests are hints: the central may refuse any of
+ * them and the link keeps working on whatever it grants.
+ */
+#if defined(CONFIG_AURORA_PAD_LINK_LINK_TUNING)
+static const struct bt_le_conn_param link_fast_param = BT_LE_CONN_PARAM_INIT(
+	CONFIG_AURORA_PAD_LINK_FAST_INTERVAL_MIN,
+	CONFIG_AURORA_PAD_LINK_FAST_INTERVAL_MAX, 0,
+	CONFIG_AURORA_PAD_LINK_SUPERVISION_TIMEOUT);
+static const struct bt_le_conn_param link_idle_param = BT_LE_CONN_PARAM_INIT(
+	CONFIG_AURORA_PAD_LINK_IDLE_INTERVAL_MIN,
+	CONFIG_AURORA_PAD_LINK_IDLE_INTERVAL_MAX,
+	CONFIG_AURORA_PAD_LINK_IDLE_LATENCY,
+	CONFIG_AURORA_PAD_LINK_SUPERVISION_TIMEOUT);
+
+/* Reset in connected(), otherwise only touched from the system
+ * workqueue.
+ */
+static bool link_setup_done;
+static int link_fast; /* -1 unknown, 0 idle, 1 fast */
+
+#if defined(CONFIG_BT_GATT_CLIENT)
+static void link_mtu_cb(struct bt_conn *conn, uint8_t err,
+			struct bt_gatt_exchange_params *params)
+{
+	ARG_UNUSED(params);
+	LOG_INF("ATT MTU %u (err %u)", bt_gatt_get_mtu(conn), err);
+}
+
+static struct bt_gatt_exchange_params link_mtu_params = {
+	.func = link_mtu_cb,
+};
+#endif /* CONFIG_BT_GATT_CLIENT */
+
+static void link_setup(struct bt_conn *conn)
+{
+	int rc;
+
+#if defined(CONFIG_BT_USER_PHY_UPDATE)
+	rc = bt_conn_le_phy_update(conn, BT_CONN_LE_PHY_PARAM_2M);
+	if (rc != 0) {
+		LOG_DBG("2M PHY request rc=%d", rc);
+	}
+#endif
+#if defined(CONFIG_BT_USER_DATA_LEN_UPDATE)
+	rc = bt_conn_le_data_len_update(conn, BT_LE_DATA_LEN_PARAM_MAX);
+	if (rc != 0) {
+		LOG_DBG("data length request rc=%d", rc);
+	}
+#endif
+#if defined(CONFIG_BT_GATT_CLIENT)
+	rc = bt_gatt_exchange_mtu(conn, &link_mtu_params);
+	if (rc != 0) {
+		LOG_DBG("MTU exchange rc=%d", rc);
+	}
+#endif
+	ARG_UNUSED(rc);
+}
+
+static void link_tune_work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	struct bt_conn *conn = current_conn;
+	if (!conn) {
+		return;
+	}
+	conn = bt_conn_ref(conn);
+	if (!conn) {
+		return;
+	}
+
+	if (!link_setup_done) {
+		link_setup(conn);
+		link_setup_done = true;
+	}
+
+	/* The state byte changes a handful of times per flight; every
+	 * other notifying characteristic moves at the snapshot rate.
+	 */
+	const int want = (atomic_get(&pl_subscribed) & ~BIT(PL_N_STATE)) != 0;
+
+	if (want != link_fast) {
+		int rc = bt_conn_le_param_update(conn, want ? &link_fast_param
+							    : &link_idle_param);
+		if (rc == 0 || rc == -EALREADY) {
+			link_fast = want;
+		} else {
+			LOG_DBG("conn param request rc=%d", rc);
+		}
+	}
+
+	bt_conn_unref(conn);
+}
+static K_WORK_DEFINE(link_tune_work, link_tune_work_handler);
+
+static void link_tune_schedule(void)
+{
+	k_work_submit(&link_tune_work);
+}
+
+static void le_param_updated(struct bt_conn *conn, uint16_t interval,
+			     uint16_t latency, uint16_t timeout)
+{
+	ARG_UNUSED(conn);
+	LOG_INF("conn interval %u.%02u ms, latency %u, timeout %u ms",
+		interval * 5U / 4U, (interval * 125U) % 100U, latency,
+		timeout * 10U);
+}
+#else
+static void link_tune_schedule(void)
+{
+}
+#endif /* CONFIG_AURORA_PAD_LINK_LINK_TUNING */
+
 static void connected(struct bt_conn *conn, uint8_t err)
 {
 	if (err) {
@@ -588,6 +1135,12 @@ static void connected(struct bt_conn *conn, uint8_t err)
 		current_conn = bt_conn_ref(conn);
 	}
 	LOG_INF("central connected");
+
+#if defined(CONFIG_AURORA_PAD_LINK_LINK_TUNING)
+	link_setup_done = false;
+	link_fast = -1;
+#endif
+	link_tune_schedule();
 }
 
 static void disconnected(struct bt_conn *conn, uint8_t reason)
@@ -598,22 +1151,19 @@ static void disconnected(struct bt_conn *conn, uint8_t reason)
 		bt_conn_unref(current_conn);
 		current_conn = NULL;
 	}
-	sm_state_notify_enabled  = false;
-	raw_notify_enabled       = false;
-	comp_notify_enabled      = false;
-	baro_notify_enabled      = false;
-	accel_notify_enabled     = false;
-	gyro_notify_enabled      = false;
-	imu6_notify_enabled      = false;
-	inner_temp_notify_enabled = false;
-	notify_backoff_until_ms  = 0;
+	atomic_clear(&pl_subscribed);
+	atomic_clear(&pl_pending);
+	notify_backoff_until_ms = 0;
 
 	adv_start_schedule();
 }
 
 BT_CONN_CB_DEFINE(pad_link_conn_cb) = {
-	.connected    = connected,
-	.disconnected = disconnected,
+	.connected        = connected,
+	.disconnected     = disconnected,
+#if defined(CONFIG_AURORA_PAD_LINK_LINK_TUNING)
+	.le_param_updated = le_param_updated,
+#endif
 };
 
 /* ------------------------------------------------------------------ */
@@ -622,9 +1172,7 @@ BT_CONN_CB_DEFINE(pad_link_conn_cb) = {
 
 void pad_link_set_caps(uint32_t caps)
 {
-	K_SPINLOCK(&snap.lock) {
-		snap.boardcap = caps;
-	}
+	atomic_set(&snap.boardcap, (atomic_val_t)caps);
 }
 
 int pad_link_init(void)
@@ -640,12 +1188,80 @@ int pad_link_init(void)
 	return 0;
 }
 
+/* Value attribute of each notifying characteristic. */
+static const uint8_t notify_attr[PL_N_COUNT] = {
+	[PL_N_STATE]      = PL_ATTR_STATE_VALUE,
+	[PL_N_RAW]        = PL_ATTR_RAW_VALUE,
+	[PL_N_COMP]       = PL_ATTR_COMP_VALUE,
+	[PL_N_BARO]       = PL_ATTR_BARO_VALUE,
+	[PL_N_ACCEL]      = PL_ATTR_ACCEL_VALUE,
+	[PL_N_GYRO]       = PL_ATTR_GYRO_VALUE,
+	[PL_N_IMU6]       = PL_ATTR_IMU6_VALUE,
+	[PL_N_INNER_TEMP] = PL_ATTR_INNER_TEMP_VALUE,
+	[PL_N_BUNDLE]     = PL_ATTR_BUNDLE_VALUE,
+	[PL_N_PYRO]       = PL_ATTR_PYRO_VALUE,
+};
+
+/* Send order within a pass: the state first, bulk sensor data last. */
+static const uint8_t notify_order[] = {
+	PL_N_STATE, PL_N_PYRO, PL_N_BUNDLE, PL_N_COMP, PL_N_IMU6,
+	PL_N_ACCEL, PL_N_GYRO, PL_N_BARO, PL_N_INNER_TEMP, PL_N_RAW,
+};
+BUILD_ASSERT(ARRAY_SIZE(notify_order) == PL_N_COUNT);
+BUILD_ASSERT(sizeof(struct pl_raw_payload) <= PL_BUNDLE_MAX_LEN);
+BUILD_ASSERT(sizeof(struct pl_pyro_payload) <= PL_BUNDLE_MAX_LEN);
+
+/* Serialise characteristic `ch` from a snapshot copy. `cap` only
+ * limits the bundle; every other payload fits PL_BUNDLE_MAX_LEN.
+ */
+static size_t notify_payload(enum pl_notify ch, const struct pl_snapshot *s,
+			     uint8_t *buf, size_t cap)
+{
+	switch (ch) {
+	case PL_N_STATE:
+		buf[0] = s->sm_state;
+		return 1;
+	case PL_N_RAW:
+		memcpy(buf, &s->raw, sizeof(s->raw));
+		return sizeof(s->raw);
+	case PL_N_COMP:
+		memcpy(buf, &s->comp, sizeof(s->comp));
+		return sizeof(s->comp);
+	case PL_N_BARO:
+		memcpy(buf, &s->baro, sizeof(s->baro));
+		return sizeof(s->baro);
+	case PL_N_ACCEL:
+		memcpy(buf, &s->accel, sizeof(s->accel));
+		return sizeof(s->accel);
+	case PL_N_GYRO:
+		memcpy(buf, &s->gyro, sizeof(s->gyro));
+		return sizeof(s->gyro);
+	case PL_N_IMU6: {
+		struct pl_imu6_payload imu6;
+
+		compose_imu6(&imu6, &s->accel, &s->gyro);
+		memcpy(buf, &imu6, sizeof(imu6));
+		return sizeof(imu6);
+	}
+	case PL_N_INNER_TEMP:
+		memcpy(buf, &s->inner_temp, sizeof(s->inner_temp));
+		return sizeof(s->inner_temp);
+	case PL_N_BUNDLE:
+		return bundle_build(s, buf, cap);
+	case PL_N_PYRO:
+		memcpy(buf, &s->pyro, sizeof(s->pyro));
+		return sizeof(s->pyro);
+	default:
+		return 0;
+	}
+}
+
 /* Runs on the system workqueue. That context is load-bearing: att.c only
  * allocates the ATT buffer with K_NO_WAIT when the caller is the sysworkq
  * thread (see bt_att_chan_create_pdu); from any other thread it uses
  * K_FOREVER and blocks once the ATT pool is drained. Calling bt_gatt_notify
  * straight from the state-machine thread is what wedged it. Here a drained
- * pool just returns -ENOMEM and trips the back-off below.
+ * pool just returns -ENOMEM and ends the pass.
  */
 static void notify_work_handler(struct k_work *work)
 {
@@ -667,124 +1283,61 @@ static void notify_work_handler(struct k_work *work)
 		return;
 	}
 
-	/* Back-off gate, see notify_backoff_until_ms file-scope decl. */
+	/* Back-off gate, see notify_backoff_until_ms file-scope decl.
+	 * Pending bits stay set for the first pass after it.
+	 */
 	int64_t now_ms = k_uptime_get();
 	if (now_ms < notify_backoff_until_ms) {
 		goto out;
 	}
 
-	int rc;
-	if (sm_state_notify_enabled) {
-		uint8_t s;
-		K_SPINLOCK(&snap.lock) {
-			s = snap.sm_state;
-		}
-		rc = bt_gatt_notify(conn,
-				    &pad_link_svc.attrs[PL_ATTR_STATE_VALUE],
-				    &s, sizeof(s));
-		if (rc != 0) {
-			LOG_WRN("notify state rc=%d len=%u", rc, sizeof(s));
-			notify_backoff_until_ms = now_ms + NOTIFY_BACKOFF_MS;
-			goto out;
-		}
-	}
-	if (comp_notify_enabled) {
-		struct pl_computed_payload comp;
-		K_SPINLOCK(&snap.lock) {
-			comp = snap.comp;
-		}
-		rc = bt_gatt_notify(conn,
-				    &pad_link_svc.attrs[PL_ATTR_COMP_VALUE],
-				    &comp, sizeof(comp));
-		if (rc != 0) {
-			LOG_WRN("notify comp rc=%d len=%u", rc, sizeof(comp));
-			notify_backoff_until_ms = now_ms + NOTIFY_BACKOFF_MS;
-			goto out;
-		}
-	}
-	if (raw_notify_enabled) {
-		struct pl_raw_payload raw;
-		K_SPINLOCK(&snap.lock) {
-			raw = snap.raw;
-		}
-		rc = bt_gatt_notify(conn,
-				    &pad_link_svc.attrs[PL_ATTR_RAW_VALUE],
-				    &raw, sizeof(raw));
-		if (rc != 0) {
-			LOG_WRN("notify raw rc=%d len=%u", rc, sizeof(raw));
-			notify_backoff_until_ms = now_ms + NOTIFY_BACKOFF_MS;
-			goto out;
-		}
-	}
-	if (baro_notify_enabled) {
-		struct pl_baro_payload baro;
-		K_SPINLOCK(&snap.lock) {
-			baro = snap.baro;
-		}
-		rc = bt_gatt_notify(conn,
-				    &pad_link_svc.attrs[PL_ATTR_BARO_VALUE],
-				    &baro, sizeof(baro));
-		if (rc != 0) {
-			LOG_WRN("notify baro rc=%d", rc);
-			notify_backoff_until_ms = now_ms + NOTIFY_BACKOFF_MS;
-			goto out;
-		}
-	}
-	if (accel_notify_enabled) {
-		struct pl_accel_payload accel;
-		K_SPINLOCK(&snap.lock) {
-			accel = snap.accel;
-		}
-		rc = bt_gatt_notify(conn,
-				    &pad_link_svc.attrs[PL_ATTR_ACCEL_VALUE],
-				    &accel, sizeof(accel));
-		if (rc != 0) {
-			LOG_WRN("notify accel rc=%d", rc);
-			notify_backoff_until_ms = now_ms + NOTIFY_BACKOFF_MS;
-			goto out;
-		}
-	}
-	if (gyro_notify_enabled) {
-		struct pl_gyro_payload gyro;
-		K_SPINLOCK(&snap.lock) {
-			gyro = snap.gyro;
-		}
-		rc = bt_gatt_notify(conn,
-				    &pad_link_svc.attrs[PL_ATTR_GYRO_VALUE],
-				    &gyro, sizeof(gyro));
-		if (rc != 0) {
-			LOG_WRN("notify gyro rc=%d", rc);
-			notify_backoff_until_ms = now_ms + NOTIFY_BACKOFF_MS;
-			goto out;
-		}
+	atomic_val_t due = atomic_clear(&pl_pending) & atomic_get(&pl_subscribed);
+	if (!due) {
+		goto out;
 	}
-	if (imu6_notify_enabled) {
-		struct pl_imu6_payload imu6;
-		K_SPINLOCK(&snap.lock) {
-			snap_compose_imu6(&imu6);
+
+	/* One copy for the whole pass: every notification below comes
+	 * from the same snapshot.
+	 */
+	struct pl_snapshot s;
+	snap_copy(&s);
+
+	/* The bundle is sized to the negotiated MTU, minus the 3-byte
+	 * notification header.
+	 */
+	const uint16_t mtu = bt_gatt_get_mtu(conn);
+	const size_t cap = MIN((size_t)PL_BUNDLE_MAX_LEN,
+			       mtu > 3U ? mtu - 3U : 0U);
+	uint8_t buf[PL_BUNDLE_MAX_LEN];
+	atomic_val_t sent = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(notify_order); i++) {
+		const enum pl_notify ch = notify_order[i];
+
+		if (!(due & BIT(ch))) {
+			continue;
 		}
-		rc = bt_gatt_notify(conn,
-				    &pad_link_svc.attrs[PL_ATTR_IMU6_VALUE],
-				    &imu6, sizeof(imu6));
-		if (rc != 0) {
-			LOG_WRN("notify imu6 rc=%d", rc);
-			notify_backoff_until_ms = now_ms + NOTIFY_BACKOFF_MS;
-			goto out;
+
+		size_t n = notify_payload(ch, &s, buf, cap);
+		if (n == 0) {
+			continue;
 		}
-	}
-	if (inner_temp_notify_enabled) {
-		struct pl_inner_temp_payload inner_temp;
-		K_SPINLOCK(&snap.lock) {
-			inner_temp = snap.inner_temp;
+
+		int rc = bt_gatt_notify(conn, &pad_link_svc.attrs[notify_attr[ch]],
+					buf, n);
+		if (rc == -ENOMEM) {
+			/* ATT pool drained: the link is fine, just busy.
+			 * Hand the unsent values back to the next pass.
+			 */
+			atomic_or(&pl_pending, due & ~sent);
+			break;
 		}
-		rc = bt_gatt_notify(conn,
-				    &pad_link_svc.attrs[PL_ATTR_INNER_TEMP_VALUE],
-				    &inner_temp, sizeof(inner_temp));
 		if (rc != 0) {
-			LOG_WRN("notify inner_temp rc=%d", rc);
+			LOG_WRN("notify ch %d rc=%d len=%u", ch, rc, (unsigned int)n);
 			notify_backoff_until_ms = now_ms + NOTIFY_BACKOFF_MS;
-			goto out;
+			break;
 		}
+		sent |= BIT(ch);
 	}
 
 out:
@@ -809,25 +1362,85 @@ void pad_link_publish_sm(enum sm_state state, enum sm_type type,
 		.accel_vert = (float)inputs->accel_vert,
 	};
 
+	const int64_t now = k_uptime_get();
+	struct pl_sm_snap sm;
+	bool kick = false;
+	bool changed;
+
+	/* The SM thread is the only writer, so its last store is current. */
+	SNAP_LOAD(sm, &sm);
+	changed = sm.sm_state != (uint8_t)state;
+	sm.sm_type  = (uint8_t)type;
+	sm.sm_state = (uint8_t)state;
+	sm.comp     = comp;
+	SNAP_STORE(sm, &sm);
+
 	K_SPINLOCK(&snap.lock) {
-		snap.sm_type  = (uint8_t)type;
-		snap.sm_state = (uint8_t)state;
-		snap.comp     = comp;
+		/* A transition goes out at once, in the state byte and in
+		 * the bundle; otherwise only kinematics are due.
+		 */
+		if (changed) {
+			kick |= notify_mark_now(PL_N_STATE, now);
+			kick |= notify_mark_now(PL_N_BUNDLE, now);
+		}
+		kick |= notify_mark_due(PL_N_COMP, now);
+		kick |= notify_mark_due(PL_N_BUNDLE, now);
 	}
 
-	/* Push cap for fast messages */
-	static int64_t next_notify_ms;
-	int64_t now = k_uptime_get();
-	if (now < next_notify_ms) {
+	if (kick) {
+		notify_kick();
+	}
+}
+
+void pad_link_publish_pyro(const struct pad_link_pyro_channel *ch, size_t n)
+{
+	struct pl_pyro_payload pyro = {
+		.uptime_ms = k_uptime_get_32(),
+	};
+
+	if (!ch) {
 		return;
 	}
-	next_notify_ms = now + NOTIFY_MIN_INTERVAL_MS;
 
-	/* Hand the actual bt_gatt_notify() work to the system workqueue; see
-	 * notify_work_handler for why that context is required to stay
-	 * non-blocking. Re-submitting an already-pending item is a no-op, so
-	 * at the SM tick rate we coalesce to at most one in-flight pass.
-	 */
+	n = MIN(n, (size_t)PL_PYRO_MAX_CHANNELS);
+	pyro.n_channels = (uint8_t)n;
+	for (size_t i = 0; i < n; i++) {
+		pyro.flags[i]    = ch[i].flags;
+		pyro.cap_mv[i]   = (uint16_t)MIN(ch[i].cap_mv, UINT16_MAX);
+		pyro.sense_mv[i] = (uint16_t)MIN(ch[i].sense_mv, UINT16_MAX);
+	}
+
+	const int64_t now = k_uptime_get();
+	struct pl_pyro_payload prev;
+	bool kick = false;
+
+	SNAP_LOAD(pyro, &prev);
+	SNAP_STORE(pyro, &pyro);
+
+	K_SPINLOCK(&snap.lock) {
+		/* Arming, firing or losing a reading is news at once;
+		 * voltages follow the period.
+		 */
+		if (prev.n_channels != pyro.n_channels ||
+		    memcmp(prev.flags, pyro.flags, sizeof(pyro.flags)) != 0) {
+			kick |= notify_mark_now(PL_N_PYRO, now);
+		} else {
+			kick |= notify_mark_due(PL_N_PYRO, now);
+		}
+	}
+
+	if (kick) {
+		notify_kick();
+	}
+}
+
+/* Hand the actual bt_gatt_notify() work to the system workqueue; see
+ * notify_work_handler for why that context is required to stay
+ * non-blocking. Re-submitting an already-pending item is a no-op, so
+ * producers coalesce to at most one in-flight pass.
+ */
+static void notify_kick(void)
+{
 	k_work_submit(&notify_work);
 }
 
@@ -842,38 +1455,75 @@ void pad_link_test_get_snapshot(uint8_t *sm_type,
 				struct pl_gyro_payload *gyro,
 				struct pl_imu6_payload *imu6,
 				struct pl_inner_temp_payload *inner_temp)
+{
+	struct pl_snapshot s;
+	struct pl_imu6_payload v6;
+
+	snap_copy(&s);
+	compose_imu6(&v6, &s.accel, &s.gyro);
+	if (sm_type) {
+		*sm_type = s.sm_type;
+	}
+	if (sm_state) {
+		*sm_state = s.sm_state;
+	}
+	if (raw) {
+		*raw = s.raw;
+	}
+	if (comp) {
+		*comp = s.comp;
+	}
+	if (boardcap) {
+		*boardcap = s.boardcap;
+	}
+	if (baro) {
+		*baro = s.baro;
+	}
+	if (accel) {
+		*accel = s.accel;
+	}
+	if (gyro) {
+		*gyro = s.gyro;
+	}
+	if (imu6) {
+		*imu6 = v6;
+	}
+	if (inner_temp) {
+		*inner_temp = s.inner_temp;
+	}
+}
+
+void pad_link_test_set_subscribed(uint32_t mask)
 {
 	K_SPINLOCK(&snap.lock) {
-		if (sm_type) {
-			*sm_type = snap.sm_type;
-		}
-		if (sm_state) {
-			*sm_state = snap.sm_state;
-		}
-		if (raw) {
-			*raw = snap.raw;
-		}
-		if (comp) {
-			*comp = snap.comp;
-		}
-		if (boardcap) {
-			*boardcap = snap.boardcap;
-		}
-		if (baro) {
-			*baro = snap.baro;
-		}
-		if (accel) {
-			*accel = snap.accel;
-		}
-		if (gyro) {
-			*gyro = snap.gyro;
-		}
-		if (imu6) {
-			snap_compose_imu6(imu6);
-		}
-		if (inner_temp) {
-			*inner_temp = snap.inner_temp;
-		}
+		memset(snap.due_ms, 0, sizeof(snap.due_ms));
+		snap.baro_sent_press_us = 0;
+		snap.baro_sent_ms = 0;
 	}
+	atomic_set(&pl_subscribed, (atomic_val_t)mask);
+	atomic_clear(&pl_pending);
+}
+
+uint32_t pad_link_test_take_pending(void)
+{
+	return (uint32_t)atomic_clear(&pl_pending);
+}
+
+void pad_link_test_get_pyro(struct pl_pyro_payload *pyro)
+{
+	SNAP_LOAD(pyro, pyro);
+}
+
+size_t pad_link_test_build_bundle(uint8_t *buf, size_t cap)
+{
+	struct pl_snapshot s;
+
+	snap_copy(&s);
+	return bundle_build(&s, buf, cap);
+}
+
+size_t pad_link_test_build_health(uint8_t *buf, size_t cap)
+{
+	return health_build(buf, cap);
 }
 #endif
@@ -7,9 +7,14 @@
 #define AURORA_LIB_PAD_LINK_WIRE_H_
 
 #include <stdint.h>
+#include <stddef.h>
 #include <zephyr/drivers/sensor.h>
+#include <zephyr/sys/util.h>
 #include <zephyr/toolchain.h>
 
+#include <aurora/lib/pad_link.h>
+#include <aurora/lib/sample.h>
+
 /* Private to the pad_link implementation and its unit tests.
  *
  * Wire layouts pinned by tests/lib/pad_link. Any field reorder, type
@@ -22,12 +27,16 @@
  * <aurora/lib/pad_link.h>.
  */
 
-/* Combine a Zephyr sensor_value into a single micro-unit int64.
- * physical = result / 1_000_000  (e.g. µ°C, µPa, µm/s², µrad/s)
+/* Split a z-bus sample (micro-units, e.g. µ°C, µkPa, µm/s², µrad/s)
+ * into the val1.val2 pair of the raw payload.
  */
-static inline int64_t sv_to_i64(const struct sensor_value *sv)
+static inline void sample_to_raw(aurora_sample_t s, int32_t *val1, int32_t *val2)
 {
-	return (int64_t)sv->val1 * 1000000LL + sv->val2;
+	struct sensor_value sv;
+
+	aurora_sample_to_sensor_value(s, &sv);
+	*val1 = sv.val1;
+	*val2 = sv.val2;
 }
 
 /* Raw sensor snapshot (deprecated a3). sensor_value (val1.val2) preserved
@@ -101,6 +110,93 @@ struct __packed pl_inner_temp_payload {
 	int64_t  temp_us;    /* offset  4 — micro-°C */
 };
 
+/* Pyro status (aa): per-channel flags, cap voltage and sense reading.
+ * 25 bytes. Entries past n_channels are zero. Millivolts saturate at
+ * 65535.
+ * Python: struct.unpack("<IB4B4H4H", data[:25])
+ *         → uptime_ms, n_channels, flags[4], cap_mv[4], sense_mv[4]
+ */
+struct __packed pl_pyro_payload {
+	uint32_t uptime_ms;                          /* offset  0 */
+	uint8_t  n_channels;                         /* offset  4 */
+	uint8_t  flags[PL_PYRO_MAX_CHANNELS];        /* offset  5 — PL_PYRO_F_* */
+	uint16_t cap_mv[PL_PYRO_MAX_CHANNELS];       /* offset  9 */
+	uint16_t sense_mv[PL_PYRO_MAX_CHANNELS];     /* offset 17 */
+};
+
+/* Telemetry bundle (06): every field the board carries in one
+ * notification. A header, then the sections flagged in `fields`, in
+ * flag order, each in the layout of its own characteristic. A section
+ * that does not fit the negotiated MTU is left out with its flag
+ * clear, so the central always decodes by `fields`.
+ * Python: ver, sm_type, sm_state, fields = struct.unpack("<BBBB", data[:4])
+ */
+#define PL_BUNDLE_VERSION 1
+
+#define PL_BUNDLE_F_COMP       BIT(0) /* pl_computed_payload,   28 bytes */
+#define PL_BUNDLE_F_ACCEL      BIT(1) /* pl_accel_payload,      28 bytes */
+#define PL_BUNDLE_F_GYRO       BIT(2) /* pl_gyro_payload,       28 bytes */
+#define PL_BUNDLE_F_BARO       BIT(3) /* pl_baro_payload,       20 bytes */
+#define PL_BUNDLE_F_INNER_TEMP BIT(4) /* pl_inner_temp_payload, 12 bytes */
+
+struct __packed pl_bundle_hdr {
+	uint8_t version;   /* offset 0 — PL_BUNDLE_VERSION */
+	uint8_t sm_type;   /* offset 1 */
+	uint8_t sm_state;  /* offset 2 */
+	uint8_t fields;    /* offset 3 — PL_BUNDLE_F_* present */
+};
+
+#define PL_BUNDLE_MAX_LEN                                                \
+	(sizeof(struct pl_bundle_hdr) + sizeof(struct pl_computed_payload) + \
+	 sizeof(struct pl_accel_payload) + sizeof(struct pl_gyro_payload) +  \
+	 sizeof(struct pl_baro_payload) + sizeof(struct pl_inner_temp_payload))
+
+/* Thread health (07): the latest lib/health sample. A header, then
+ * n_threads entries of 28 bytes in the board's thread-list order;
+ * threads past PL_HEALTH_MAX_THREADS are counted in `skipped`
+ * (saturating). Read only; n_threads is 0 on boards without
+ * CONFIG_AURORA_HEALTH or before the first sample.
+ * Python: uptime_ms, n, skipped = struct.unpack("<IBB", data[:6])
+ *         name, load_ppm, stack_size, stack_used =
+ *                 struct.unpack_from("<16sIII", data, 6 + 28 * i)
+ */
+#define PL_HEALTH_MAX_THREADS 16
+#define PL_HEALTH_NAME_LEN    16
+
+struct __packed pl_health_hdr {
+	uint32_t uptime_ms;  /* offset 0 — time of the sample */
+	uint8_t  n_threads;  /* offset 4 */
+	uint8_t  skipped;    /* offset 5 */
+};
+
+struct __packed pl_health_entry {
+	char     name[PL_HEALTH_NAME_LEN]; /* offset  0 — zero padded */
+	uint32_t load_ppm;                 /* offset 16 — CPU share, millionths */
+	uint32_t stack_size;               /* offset 20 — bytes */
+	uint32_t stack_used;               /* offset 24 — high-water mark, bytes */
+};
+
+#define PL_HEALTH_MAX_LEN                                                \
+	(sizeof(struct pl_health_hdr) +                                  \
+	 PL_HEALTH_MAX_THREADS * sizeof(struct pl_health_entry))
+
+/* Notifying characteristics, one bit each in the subscription and
+ * pending masks.
+ */
+enum pl_notify {
+	PL_N_STATE,
+	PL_N_RAW,
+	PL_N_COMP,
+	PL_N_BARO,
+	PL_N_ACCEL,
+	PL_N_GYRO,
+	PL_N_IMU6,
+	PL_N_INNER_TEMP,
+	PL_N_BUNDLE,
+	PL_N_PYRO,
+	PL_N_COUNT,
+};
+
 #if defined(CONFIG_ZTEST)
 /* Test-only window into the internal snapshot. Each pointer may be
  * NULL to skip that field. Takes the spinlock; safe to call from any
@@ -116,6 +212,29 @@ void pad_link_test_get_snapshot(uint8_t *sm_type,
 				struct pl_gyro_payload *gyro,
 				struct pl_imu6_payload *imu6,
 				struct pl_inner_temp_payload *inner_temp);
+
+/* Test-only: copy the pyro characteristic snapshot. */
+void pad_link_test_get_pyro(struct pl_pyro_payload *pyro);
+
+/* Test-only: build the bundle from the current snapshot into at most
+ * `cap` bytes. Returns the bundle length.
+ */
+size_t pad_link_test_build_bundle(uint8_t *buf, size_t cap);
+
+/* Test-only: build the thread health payload into at most `cap` bytes.
+ * Returns the payload length.
+ */
+size_t pad_link_test_build_health(uint8_t *buf, size_t cap);
+
+/* Test-only: pretend a central subscribed to BIT(PL_N_*) `mask` and
+ * restart every rate limit. Clears the pending mask.
+ */
+void pad_link_test_set_subscribed(uint32_t mask);
+
+/* Test-only: return and clear the characteristics marked due. Nothing
+ * else consumes them while no central is connected.
+ */
+uint32_t pad_link_test_take_pending(void);
 #endif
 
 #endif /* AURORA_LIB_PAD_LINK_WIRE_H_ */
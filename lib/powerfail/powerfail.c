@@ -24,20 +24,6 @@
 
 LOG_MODULE_REGISTER(powerfail, CONFIG_AURORA_POWERFAIL_LOG_LEVEL);
 
-#if defined(CONFIG_DATA_LOGGER)
-static inline void emergency_stop_data_logger(struct data_logger *logger,
-					      void *argv)
-{
-	atomic_set(&logger->state->running, 0);
-}
-
-static inline void emergency_recover_data_logger(struct data_logger *logger,
-						 void *argv)
-{
-	atomic_set(&logger->state->running, 1);
-}
-#endif /* CONFIG_DATA_LOGGER */
-
 /* Build-time dependency: AURORA_POWERFAIL needs the board/app to select the
  * power-fail monitor input (a "gpios" property) via the 'auxspace,pfm' chosen
  * node. */
@@ -59,7 +45,7 @@ static atomic_t pfail_state = ATOMIC_INIT(0);
 static inline void emergency_state_save(void)
 {
 #if defined(CONFIG_DATA_LOGGER)
-	data_logger_foreach(emergency_stop_data_logger, NULL);
+	data_logger_powerfail(true);
 #endif /* CONFIG_DATA_LOGGER */
 
 #if defined(CONFIG_AURORA_NOTIFY)
@@ -70,7 +56,7 @@ static inline void emergency_state_save(void)
 static inline void emergency_state_recover(void)
 {
 #if defined(CONFIG_DATA_LOGGER)
-	data_logger_foreach(emergency_recover_data_logger, NULL);
+	data_logger_powerfail(false);
 #endif /* CONFIG_DATA_LOGGER */
 
 #if defined(CONFIG_AURORA_NOTIFY)
@@ -0,0 +1,45 @@
+/**
+ * @file ram.c
+ * @brief Boot-time clearing of the RAM placement sections.
+ *
+ * The sections declared by ram_fast.ld and ram_dma.ld are NOLOAD and
+ * outside the kernel's .bss, so nothing zeroes them. Clear them at the
+ * EARLY init level, before any driver or thread can touch the objects
+ * placed there. DTCM and CCM placement needs none of this; the kernel
+ * clears those sections itself.
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+
+#include <aurora/lib/ram.h>
+
+#if defined(CONFIG_AURORA_RAM_FAST_REGION)
+extern char __aurora_fast_bss_start[];
+extern char __aurora_fast_bss_end[];
+#endif /* CONFIG_AURORA_RAM_FAST_REGION */
+
+#if defined(CONFIG_AURORA_RAM_DMA)
+extern char __aurora_dma_bss_start[];
+extern char __aurora_dma_bss_end[];
+#endif /* CONFIG_AURORA_RAM_DMA */
+
+static int aurora_ram_init(void)
+{
+#if defined(CONFIG_AURORA_RAM_FAST_REGION)
+	memset(__aurora_fast_bss_start, 0,
+	       __aurora_fast_bss_end - __aurora_fast_bss_start);
+#endif /* CONFIG_AURORA_RAM_FAST_REGION */
+#if defined(CONFIG_AURORA_RAM_DMA)
+	memset(__aurora_dma_bss_start, 0,
+	       __aurora_dma_bss_end - __aurora_dma_bss_start);
+#endif /* CONFIG_AURORA_RAM_DMA */
+	return 0;
+}
+
+SYS_INIT(aurora_ram_init, EARLY, 0);
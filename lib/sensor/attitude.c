@@ -4,7 +4,9 @@
  *
  * Tracks gravity direction in IMU body frame by integrating gyro
  * measurements, anchored to an initial direction set from the
- * mounting-axis Kconfig after a stationary calibration window.
+ * mounting-axis Kconfig after a stationary calibration window.  This
+ * file holds the calibration shared by both backends; attitude_update()
+ * lives in attitude_gravity.c or attitude_quat.c.
  *
  * Copyright (c) 2026, Auxspace e.V.
  *
@@ -20,19 +22,9 @@
 
 #include <aurora/lib/attitude.h>
 
-LOG_MODULE_REGISTER(attitude, CONFIG_AURORA_SENSORS_LOG_LEVEL);
-
-static inline void vec3_zero(double v[3])
-{
-	v[0] = 0.0;
-	v[1] = 0.0;
-	v[2] = 0.0;
-}
+#include "attitude_internal.h"
 
-static inline double vec3_norm(const double v[3])
-{
-	return sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
-}
+LOG_MODULE_REGISTER(attitude, CONFIG_AURORA_SENSORS_LOG_LEVEL);
 
 /* attitude_init – see attitude.h */
 int attitude_init(struct attitude *att)
@@ -48,18 +40,22 @@ int attitude_init(struct attitude *att)
 	const int idx = CONFIG_IMU_UP_AXIS_INDEX;
 	const int sign = CONFIG_IMU_UP_AXIS_SIGN;
 
-	att->g_b[idx] = (double)(-sign);
+	att->g_b[idx] = (attitude_real_t)(-sign);
 
 	/* Provisional gravity magnitude; overwritten by calibration. */
-	att->g_mag = 9.80665;
+	att->g_mag = ATTITUDE_G0;
+
+#if defined(CONFIG_ATTITUDE_QUATERNION)
+	att->q[0] = AR(1.0);
+#endif /* CONFIG_ATTITUDE_QUATERNION */
 
 	return 0;
 }
 
 /* attitude_calibrate_sample – see attitude.h */
 int attitude_calibrate_sample(struct attitude *att,
-			      const double accel[ATTITUDE_NUM_AXES],
-			      const double gyro[ATTITUDE_NUM_AXES])
+			      const attitude_real_t accel[ATTITUDE_NUM_AXES],
+			      const attitude_real_t gyro[ATTITUDE_NUM_AXES])
 {
 	if (att == NULL || accel == NULL || gyro == NULL)
 		return -EINVAL;
@@ -85,8 +81,8 @@ int attitude_calibrate_finish(struct attitude *att)
 	if (att->cal_samples <= 0)
 		return -ENODATA;
 
-	const double n = (double)att->cal_samples;
-	double accel_mean[ATTITUDE_NUM_AXES];
+	const attitude_real_t n = (attitude_real_t)att->cal_samples;
+	attitude_real_t accel_mean[ATTITUDE_NUM_AXES];
 
 	for (int i = 0; i < ATTITUDE_NUM_AXES; i++) {
 		accel_mean[i] = att->cal_accel_sum[i] / n;
@@ -96,11 +92,11 @@ int attitude_calibrate_finish(struct attitude *att)
 	/* Gravity magnitude is the norm of the averaged accelerometer
 	 * reading (specific force = -g when stationary).
 	 */
-	double g_mag = vec3_norm(accel_mean);
-	if (g_mag < 1e-6) {
+	attitude_real_t g_mag = vec3_norm(accel_mean);
+	if (g_mag < AR(1e-6)) {
 		LOG_WRN("Calibration accel magnitude near zero (%f); "
-			"falling back to 9.80665", g_mag);
-		g_mag = 9.80665;
+			"falling back to 9.80665", (double)g_mag);
+		g_mag = ATTITUDE_G0;
 	}
 	att->g_mag = g_mag;
 
@@ -112,94 +108,29 @@ int attitude_calibrate_finish(struct attitude *att)
 	vec3_zero(att->g_b);
 	const int idx = CONFIG_IMU_UP_AXIS_INDEX;
 	const int sign = CONFIG_IMU_UP_AXIS_SIGN;
-	att->g_b[idx] = (double)(-sign);
+	att->g_b[idx] = (attitude_real_t)(-sign);
 
 	for (int i = 0; i < ATTITUDE_NUM_AXES; i++) {
 		att->accel_bias[i] = accel_mean[i] + g_mag * att->g_b[i];
 	}
 
+#if defined(CONFIG_ATTITUDE_QUATERNION)
+	/* The calibration pose defines the world frame. */
+	att->q[0] = AR(1.0);
+	att->q[1] = AR(0.0);
+	att->q[2] = AR(0.0);
+	att->q[3] = AR(0.0);
+#endif /* CONFIG_ATTITUDE_QUATERNION */
+
 	att->calibrated = 1;
 
 	LOG_INF("Attitude calibrated: n=%d g_mag=%.3f g_b=[%.2f %.2f %.2f]",
-		att->cal_samples, g_mag, att->g_b[0], att->g_b[1], att->g_b[2]);
+		att->cal_samples, (double)g_mag, (double)att->g_b[0],
+		(double)att->g_b[1], (double)att->g_b[2]);
 	LOG_DBG("gyro_bias=[%.4f %.4f %.4f] accel_bias=[%.4f %.4f %.4f]",
-		att->gyro_bias[0], att->gyro_bias[1], att->gyro_bias[2],
-		att->accel_bias[0], att->accel_bias[1], att->accel_bias[2]);
-
-	return 0;
-}
-
-/* attitude_update – see attitude.h */
-int attitude_update(struct attitude *att,
-		    const double accel[ATTITUDE_NUM_AXES],
-		    const double gyro[ATTITUDE_NUM_AXES],
-		    double dt_s,
-		    double *accel_vert_out)
-{
-	if (att == NULL || accel == NULL || gyro == NULL ||
-	    accel_vert_out == NULL || dt_s <= 0.0)
-		return -EINVAL;
-
-	if (!att->calibrated)
-		return -ENODATA;
-
-	/* Bias-correct inputs. */
-	const double ax = accel[0] - att->accel_bias[0];
-	const double ay = accel[1] - att->accel_bias[1];
-	const double az = accel[2] - att->accel_bias[2];
-
-	const double wx = (gyro[0] - att->gyro_bias[0]) * dt_s;
-	const double wy = (gyro[1] - att->gyro_bias[1]) * dt_s;
-	const double wz = (gyro[2] - att->gyro_bias[2]) * dt_s;
-
-	/* Small-angle rotation of gravity vector: dg_b/dt = -omega x g_b.
-	 * Increment: g_b_new = g_b - (omega x g_b) * dt.
-	 */
-	const double gx = att->g_b[0];
-	const double gy = att->g_b[1];
-	const double gz = att->g_b[2];
-
-	double nx = gx - (wy * gz - wz * gy);
-	double ny = gy - (wz * gx - wx * gz);
-	double nz = gz - (wx * gy - wy * gx);
-
-	/* Complementary correction toward -a/|a|.  The correction is weighted
-	 * by a Gaussian in (|a| - g_mag)/g_mag so the anchor is strong during
-	 * quasi-static phases (pad, coast, terminal descent) and smoothly
-	 * vanishes during boost and deployment shocks — no hard gate to fall
-	 * off.  Gain is dt/tau so behavior is independent of sample rate.
-	 */
-	const double a_norm = sqrt(ax * ax + ay * ay + az * az);
-	if (a_norm > 1e-6) {
-		static const double tau_s = 0.5;     /* anchor time constant */
-		static const double sigma_r = 0.20;  /* 1-sigma mag band, x g_mag */
-		const double r = (a_norm - att->g_mag) / att->g_mag;
-		const double w = exp(-0.5 * r * r / (sigma_r * sigma_r));
-		const double gain = w * dt_s / tau_s;
-		const double inv = 1.0 / a_norm;
-		const double gmx = -ax * inv;
-		const double gmy = -ay * inv;
-		const double gmz = -az * inv;
-		nx += gain * (gmx - nx);
-		ny += gain * (gmy - ny);
-		nz += gain * (gmz - nz);
-	}
-
-	/* Renormalize to unit length. */
-	const double n = sqrt(nx * nx + ny * ny + nz * nz);
-	if (n < 1e-9) {
-		/* Numerical collapse – refuse to update. */
-		return -EDOM;
-	}
-	att->g_b[0] = nx / n;
-	att->g_b[1] = ny / n;
-	att->g_b[2] = nz / n;
-
-	/* Project body specific force onto world up: f_vert = -dot(a_b, g_b).
-	 * Subtract gravity magnitude to get gravity-removed vertical accel.
-	 */
-	const double f_vert = -(ax * att->g_b[0] + ay * att->g_b[1] + az * att->g_b[2]);
-	*accel_vert_out = f_vert - att->g_mag;
+		(double)att->gyro_bias[0], (double)att->gyro_bias[1],
+		(double)att->gyro_bias[2], (double)att->accel_bias[0],
+		(double)att->accel_bias[1], (double)att->accel_bias[2]);
 
 	return 0;
 }
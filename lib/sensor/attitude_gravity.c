@@ -0,0 +1,90 @@
+/**
+ * @file attitude_gravity.c
+ * @brief Gravity-vector attitude backend.
+ *
+ * Propagates the body-frame gravity unit vector with a small-angle
+ * Rodrigues step per gyro sample and anchors it to the accelerometer.
+ * Calibration and the rest of the API are shared in attitude.c.
+ *
+ * Copyright (c) 2026, Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <math.h>
+
+#include <zephyr/kernel.h>
+
+#include <aurora/lib/attitude.h>
+
+#include "attitude_internal.h"
+
+/* attitude_update – see attitude.h */
+int attitude_update(struct attitude *att,
+		    const attitude_real_t accel[ATTITUDE_NUM_AXES],
+		    const attitude_real_t gyro[ATTITUDE_NUM_AXES],
+		    attitude_real_t dt_s,
+		    attitude_real_t *accel_vert_out)
+{
+	if (att == NULL || accel == NULL || gyro == NULL ||
+	    accel_vert_out == NULL || dt_s <= AR(0.0))
+		return -EINVAL;
+
+	if (!att->calibrated)
+		return -ENODATA;
+
+	/* Bias-correct inputs. */
+	const attitude_real_t ax = accel[0] - att->accel_bias[0];
+	const attitude_real_t ay = accel[1] - att->accel_bias[1];
+	const attitude_real_t az = accel[2] - att->accel_bias[2];
+
+	const attitude_real_t wx = (gyro[0] - att->gyro_bias[0]) * dt_s;
+	const attitude_real_t wy = (gyro[1] - att->gyro_bias[1]) * dt_s;
+	const attitude_real_t wz = (gyro[2] - att->gyro_bias[2]) * dt_s;
+
+	/* Small-angle rotation of gravity vector: dg_b/dt = -omega x g_b.
+	 * Increment: g_b_new = g_b - (omega x g_b) * dt.
+	 */
+	const attitude_real_t gx = att->g_b[0];
+	const attitude_real_t gy = att->g_b[1];
+	const attitude_real_t gz = att->g_b[2];
+
+	attitude_real_t nx = gx - (wy * gz - wz * gy);
+	attitude_real_t ny = gy - (wz * gx - wx * gz);
+	attitude_real_t nz = gz - (wx * gy - wy * gx);
+
+	/* Complementary correction toward -a/|a|, weighted by
+	 * attitude_anchor_rate().  Gain is rate * dt so behavior is
+	 * independent of sample rate.
+	 */
+	const attitude_real_t a_norm = ar_sqrt(ax * ax + ay * ay + az * az);
+	if (a_norm > AR(1e-6)) {
+		const attitude_real_t gain = attitude_anchor_rate(att, a_norm) * dt_s;
+		const attitude_real_t inv = AR(1.0) / a_norm;
+		const attitude_real_t gmx = -ax * inv;
+		const attitude_real_t gmy = -ay * inv;
+		const attitude_real_t gmz = -az * inv;
+		nx += gain * (gmx - nx);
+		ny += gain * (gmy - ny);
+		nz += gain * (gmz - nz);
+	}
+
+	/* Renormalize to unit length. */
+	const attitude_real_t n = ar_sqrt(nx * nx + ny * ny + nz * nz);
+	if (n < AR(1e-9)) {
+		/* Numerical collapse – refuse to update. */
+		return -EDOM;
+	}
+	att->g_b[0] = nx / n;
+	att->g_b[1] = ny / n;
+	att->g_b[2] = nz / n;
+
+	/* Project body specific force onto world up: f_vert = -dot(a_b, g_b).
+	 * Subtract gravity magnitude to get gravity-removed vertical accel.
+	 */
+	const attitude_real_t f_vert = -(ax * att->g_b[0] + ay * att->g_b[1] + az * att->g_b[2]);
+	*accel_vert_out = f_vert - att->g_mag;
+
+	return 0;
+}
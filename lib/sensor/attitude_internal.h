@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Helpers shared by the attitude backends.  Not part of the public API.
+ */
+
+#ifndef APP_LIB_ATTITUDE_INTERNAL_H_
+#define APP_LIB_ATTITUDE_INTERNAL_H_
+
+#include <math.h>
+
+#include <aurora/lib/attitude.h>
+
+/* Literal in the tracker's arithmetic type, so float builds never
+ * promote to double.
+ */
+#define AR(x) ((attitude_real_t)(x))
+
+#if defined(CONFIG_ATTITUDE_FLOAT)
+#define ar_sqrt sqrtf
+#define ar_exp expf
+#define ar_atan2 atan2f
+#else
+#define ar_sqrt sqrt
+#define ar_exp exp
+#define ar_atan2 atan2
+#endif /* CONFIG_ATTITUDE_FLOAT */
+
+/** Nominal gravity, used until calibration measures the real one. */
+#define ATTITUDE_G0 AR(9.80665)
+
+static inline void vec3_zero(attitude_real_t v[3])
+{
+	v[0] = AR(0.0);
+	v[1] = AR(0.0);
+	v[2] = AR(0.0);
+}
+
+static inline attitude_real_t vec3_norm(const attitude_real_t v[3])
+{
+	return ar_sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+}
+
+/** Time constant of the accelerometer anchor (s). */
+#define ATTITUDE_ANCHOR_TAU_S AR(0.5)
+
+/** 1-sigma band of |a| around g_mag for the anchor weight, x g_mag. */
+#define ATTITUDE_ANCHOR_SIGMA_R AR(0.20)
+
+/* Anchor rate (1/s) for a bias-corrected specific force of norm
+ * @p a_norm.  The weight is a Gaussian in (|a| - g_mag)/g_mag so the
+ * anchor is strong during quasi-static phases (pad, coast, terminal
+ * descent) and smoothly vanishes during boost and deployment shocks —
+ * no hard gate to fall off.
+ */
+static inline attitude_real_t attitude_anchor_rate(const struct attitude *att,
+						  attitude_real_t a_norm)
+{
+	const attitude_real_t r = (a_norm - att->g_mag) / att->g_mag;
+	const attitude_real_t w =
+		ar_exp(AR(-0.5) * r * r /
+		       (ATTITUDE_ANCHOR_SIGMA_R * ATTITUDE_ANCHOR_SIGMA_R));
+
+	return w / ATTITUDE_ANCHOR_TAU_S;
+}
+
+#endif /* APP_LIB_ATTITUDE_INTERNAL_H_ */
@@ -0,0 +1,163 @@
+/**
+ * @file attitude_quat.c
+ * @brief Quaternion attitude backend.
+ *
+ * Integrates the body-to-world rotation as a unit quaternion with a
+ * Mahony-style accelerometer correction fed into the gyro rate.  The
+ * body-frame gravity vector is read back out of the quaternion, so the
+ * vertical projection and the orientation angles come from the same
+ * estimate instead of a second, accelerometer-only solution.
+ * Calibration and the rest of the API are shared in attitude.c.
+ *
+ * Copyright (c) 2026, Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <math.h>
+
+#include <zephyr/kernel.h>
+
+#include <aurora/lib/attitude.h>
+
+#include "attitude_internal.h"
+
+#define ATTITUDE_RAD2DEG AR(180.0 / M_PI)
+
+/* g_b = R(q)^T * g_world, with g_world = -sign * e_idx: minus the up row
+ * of the rotation matrix.
+ */
+static void attitude_quat_gravity(struct attitude *att)
+{
+	const attitude_real_t w = att->q[0];
+	const attitude_real_t x = att->q[1];
+	const attitude_real_t y = att->q[2];
+	const attitude_real_t z = att->q[3];
+	const attitude_real_t s = AR(-CONFIG_IMU_UP_AXIS_SIGN);
+
+#if CONFIG_IMU_UP_AXIS_INDEX == 0
+	att->g_b[0] = s * (AR(1.0) - AR(2.0) * (y * y + z * z));
+	att->g_b[1] = s * AR(2.0) * (x * y - w * z);
+	att->g_b[2] = s * AR(2.0) * (x * z + w * y);
+#elif CONFIG_IMU_UP_AXIS_INDEX == 1
+	att->g_b[0] = s * AR(2.0) * (x * y + w * z);
+	att->g_b[1] = s * (AR(1.0) - AR(2.0) * (x * x + z * z));
+	att->g_b[2] = s * AR(2.0) * (y * z - w * x);
+#else
+	att->g_b[0] = s * AR(2.0) * (x * z - w * y);
+	att->g_b[1] = s * AR(2.0) * (y * z + w * x);
+	att->g_b[2] = s * (AR(1.0) - AR(2.0) * (x * x + y * y));
+#endif /* CONFIG_IMU_UP_AXIS_INDEX */
+}
+
+/* attitude_update – see attitude.h */
+int attitude_update(struct attitude *att,
+		    const attitude_real_t accel[ATTITUDE_NUM_AXES],
+		    const attitude_real_t gyro[ATTITUDE_NUM_AXES],
+		    attitude_real_t dt_s,
+		    attitude_real_t *accel_vert_out)
+{
+	if (att == NULL || accel == NULL || gyro == NULL ||
+	    accel_vert_out == NULL || dt_s <= AR(0.0))
+		return -EINVAL;
+
+	if (!att->calibrated)
+		return -ENODATA;
+
+	/* Bias-correct inputs. */
+	const attitude_real_t ax = accel[0] - att->accel_bias[0];
+	const attitude_real_t ay = accel[1] - att->accel_bias[1];
+	const attitude_real_t az = accel[2] - att->accel_bias[2];
+
+	attitude_real_t wx = gyro[0] - att->gyro_bias[0];
+	attitude_real_t wy = gyro[1] - att->gyro_bias[1];
+	attitude_real_t wz = gyro[2] - att->gyro_bias[2];
+
+	/* Mahony correction: rotate the estimated up vector -g_b toward
+	 * the measured a/|a| by adding rate * (a/|a| x -g_b) to the body
+	 * rate.  Same weighting as the gravity backend, so both anchor
+	 * equally hard in each flight phase.
+	 */
+	const attitude_real_t a_norm = ar_sqrt(ax * ax + ay * ay + az * az);
+	if (a_norm > AR(1e-6)) {
+		const attitude_real_t k = attitude_anchor_rate(att, a_norm) / a_norm;
+		const attitude_real_t ux = -att->g_b[0];
+		const attitude_real_t uy = -att->g_b[1];
+		const attitude_real_t uz = -att->g_b[2];
+
+		wx += k * (ay * uz - az * uy);
+		wy += k * (az * ux - ax * uz);
+		wz += k * (ax * uy - ay * ux);
+	}
+
+	/* q <- q + 1/2 q (x) (0, w) dt, then renormalize. */
+	const attitude_real_t h = AR(0.5) * dt_s;
+	const attitude_real_t qw = att->q[0];
+	const attitude_real_t qx = att->q[1];
+	const attitude_real_t qy = att->q[2];
+	const attitude_real_t qz = att->q[3];
+
+	const attitude_real_t nw = qw - h * (qx * wx + qy * wy + qz * wz);
+	const attitude_real_t nx = qx + h * (qw * wx + qy * wz - qz * wy);
+	const attitude_real_t ny = qy + h * (qw * wy - qx * wz + qz * wx);
+	const attitude_real_t nz = qz + h * (qw * wz + qx * wy - qy * wx);
+
+	const attitude_real_t n = ar_sqrt(nw * nw + nx * nx + ny * ny + nz * nz);
+	if (n < AR(1e-9)) {
+		/* Numerical collapse – refuse to update. */
+		return -EDOM;
+	}
+	att->q[0] = nw / n;
+	att->q[1] = nx / n;
+	att->q[2] = ny / n;
+	att->q[3] = nz / n;
+
+	attitude_quat_gravity(att);
+
+	/* Project body specific force onto world up: f_vert = -dot(a_b, g_b).
+	 * Subtract gravity magnitude to get gravity-removed vertical accel.
+	 */
+	const attitude_real_t f_vert = -(ax * att->g_b[0] + ay * att->g_b[1] + az * att->g_b[2]);
+	*accel_vert_out = f_vert - att->g_mag;
+
+	return 0;
+}
+
+/* attitude_orientation – see attitude.h */
+int attitude_orientation(const struct attitude *att,
+			 attitude_real_t orientation[ATTITUDE_NUM_AXES])
+{
+	if (att == NULL || orientation == NULL)
+		return -EINVAL;
+
+	if (!att->calibrated)
+		return -ENODATA;
+
+	const int idx = CONFIG_IMU_UP_AXIS_INDEX;
+	const attitude_real_t sign = AR(CONFIG_IMU_UP_AXIS_SIGN);
+
+	/* Estimated up direction, remapped like
+	 * imu_sensor_value_to_orientation() remaps the accelerometer.
+	 */
+	const attitude_real_t ux = -att->g_b[(idx + 1) % 3];
+	const attitude_real_t uy = -att->g_b[(idx + 2) % 3];
+	const attitude_real_t uz = -sign * att->g_b[idx];
+
+	orientation[0] = ar_atan2(uy, uz) * ATTITUDE_RAD2DEG;
+	orientation[1] = ar_atan2(-ux, ar_sqrt(uy * uy + uz * uz)) * ATTITUDE_RAD2DEG;
+
+	/* Roll is the twist of q about the up axis (swing-twist split). */
+	attitude_real_t roll = AR(2.0) * ar_atan2(sign * att->q[1 + idx], att->q[0]) *
+			       ATTITUDE_RAD2DEG;
+
+	/* Wrap to [-180, 180]. */
+	if (roll > AR(180.0)) {
+		roll -= AR(360.0);
+	} else if (roll < AR(-180.0)) {
+		roll += AR(360.0);
+	}
+	orientation[2] = roll;
+
+	return 0;
+}
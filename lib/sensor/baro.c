@@ -3,7 +3,8 @@
  * @brief Barometric pressure sensor library implementation.
  *
  * Wraps the Zephyr sensor API for the MS5607 barometric sensor, providing
- * measurement, altitude computation, and initialization helpers.
+ * measurement and initialization helpers.  Altitude conversion lives in
+ * baro_altitude.c.
  *
  * Copyright (c) 2025-2026, Auxspace e.V.
  *
@@ -12,7 +13,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
-#include <math.h>
+#include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/device.h>
 #include <zephyr/drivers/sensor.h>
@@ -30,16 +31,35 @@ ZBUS_CHAN_DEFINE(baro_data_chan,
 		 ZBUS_OBSERVERS_EMPTY,
 		 ZBUS_MSG_INIT(0));
 
+/* Device of each instance, filled in by baro_init_instance(). */
+static const struct device *baro_devs[CONFIG_BARO_INSTANCES];
+
+/** @brief Instance number of @p dev, 0 if it was never registered. */
+static uint8_t instance_of(const struct device *dev)
+{
+	for (uint8_t i = 1; i < CONFIG_BARO_INSTANCES; i++) {
+		if (baro_devs[i] == dev) {
+			return i;
+		}
+	}
+	return 0;
+}
+
 /**
- * @brief Fetch and log accelerometer and gyroscope readings.
+ * @brief Fetch and log temperature and pressure readings.
  *
- * @param dev Pointer to the IMU device.
+ * @param dev          Pointer to the baro device.
+ * @param timestamp_ns Capture time of the sample.
  *
  * @return 0 on success, -errno on failure.
  */
-static int fetch_and_send(const struct device *dev)
+static int fetch_and_send(const struct device *dev, uint64_t timestamp_ns)
 {
-	struct baro_data msg;
+	struct baro_data msg = {
+		.timestamp_ns = timestamp_ns,
+		.instance     = instance_of(dev),
+	};
+	struct sensor_value val;
 	int ret;
 
 	ret = sensor_sample_fetch(dev);
@@ -48,17 +68,19 @@ static int fetch_and_send(const struct device *dev)
 		return ret;
 	}
 
-	ret = sensor_channel_get(dev, SENSOR_CHAN_AMBIENT_TEMP, &(msg.temperature));
+	ret = sensor_channel_get(dev, SENSOR_CHAN_AMBIENT_TEMP, &val);
 	if (ret != 0) {
 		LOG_ERR("Failed to get baro temperature");
 		return ret;
 	}
+	msg.temperature = aurora_sample_from_sensor_value(&val);
 
-	ret = sensor_channel_get(dev, SENSOR_CHAN_PRESS, &(msg.pressure));
+	ret = sensor_channel_get(dev, SENSOR_CHAN_PRESS, &val);
 	if (ret != 0) {
 		LOG_ERR("Failed to get baro pressure");
 		return ret;
 	}
+	msg.pressure = aurora_sample_from_sensor_value(&val);
 
 	/* Publish the baro data to the z-bus channel */
 	ret = zbus_chan_pub(&baro_data_chan, &msg, K_NO_WAIT);
@@ -70,18 +92,63 @@ static int fetch_and_send(const struct device *dev)
 
 
 #if defined(CONFIG_BARO_TRIGGER)
+/* Instances whose data-ready fired since the reader last ran, and the
+ * time each one fired.
+ */
+static atomic_t baro_ready;
+static uint64_t baro_ready_ns[CONFIG_BARO_INSTANCES];
+K_SEM_DEFINE(baro_ready_sem, 0, 1);
+
 /**
  * @brief Data-ready trigger callback for the baro.
  *
+ * Runs in the driver's trigger context, so it only stamps the sample
+ * and wakes the reader thread; the bus transfer and the publish happen
+ * there.
+ *
  * @param dev  Pointer to the baro device.
  * @param trig Pointer to the sensor trigger descriptor.
  */
 static void trigger_handler(const struct device *dev,
-							const struct sensor_trigger *trig)
+			    const struct sensor_trigger *trig)
 {
-	fetch_and_send(dev);
+	const uint8_t i = instance_of(dev);
+
+	ARG_UNUSED(trig);
+
+	baro_ready_ns[i] = k_ticks_to_ns_floor64(k_uptime_ticks());
+	atomic_set_bit(&baro_ready, i);
+	k_sem_give(&baro_ready_sem);
 }
 
+/**
+ * @brief Read every baro whose data-ready fired.
+ *
+ * A second interrupt before the read only moves the timestamp forward,
+ * the read then returns the newer sample.
+ */
+static void baro_reader_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1); ARG_UNUSED(p2); ARG_UNUSED(p3);
+
+	for (;;) {
+		(void)k_sem_take(&baro_ready_sem, K_FOREVER);
+
+		atomic_val_t ready = atomic_clear(&baro_ready);
+
+		for (uint8_t i = 0; i < CONFIG_BARO_INSTANCES; i++) {
+			if ((ready & BIT(i)) != 0 && baro_devs[i] != NULL) {
+				(void)fetch_and_send(baro_devs[i],
+						     baro_ready_ns[i]);
+			}
+		}
+	}
+}
+
+K_THREAD_DEFINE(baro_reader, CONFIG_BARO_READER_STACK_SIZE,
+		baro_reader_fn, NULL, NULL, NULL,
+		CONFIG_BARO_READER_PRIO, 0, 0);
+
 /**
  * @brief Configure the baro to run in data-ready trigger mode.
  *
@@ -106,13 +173,22 @@ int baro_measure(const struct device *dev)
 	if (dev == NULL)
 		return -EINVAL;
 
-	return fetch_and_send(dev);
+	return fetch_and_send(dev, k_ticks_to_ns_floor64(k_uptime_ticks()));
 }
 #endif /* CONFIG_BARO_TRIGGER */
 
 /* baro_init – see baro.h */
 int baro_init(const struct device *dev)
 {
+	return baro_init_instance(dev, 0);
+}
+
+/* baro_init_instance – see baro.h */
+int baro_init_instance(const struct device *dev, uint8_t instance)
+{
+	if (instance >= CONFIG_BARO_INSTANCES) {
+		return -EINVAL;
+	}
 	if (dev == NULL) {
 		LOG_ERR("Baro device is NULL");
 		return -ENODEV;
@@ -121,6 +197,7 @@ int baro_init(const struct device *dev)
 		LOG_ERR("Baro device %s is not ready", dev->name);
 		return -ETIMEDOUT;
 	}
+	baro_devs[instance] = dev;
 
 #if defined(CONFIG_BARO_TRIGGER)
 	run_trigger_mode(dev);
@@ -130,80 +207,13 @@ int baro_init(const struct device *dev)
 	return 0;
 }
 
-/*-----------------------------------------------------------
- * Pressure-to-altitude conversion (ISA troposphere)
- *----------------------------------------------------------*/
-
-/** ISA sea-level temperature (K). */
-#define ISA_T0 288.15
-
-/** ISA temperature lapse rate (K/m). */
-#define ISA_L  0.0065
-
-/** g·M / (R·L) exponent for the barometric formula. */
-#define ISA_GMR_OVER_L 5.25588
-
-/** R·L / (g·M) exponent for the hypsometric formula. */
-#define ISA_RL_OVER_GM 0.190263
-
-/** Ground-level reference pressure in kPa (0 = not set). */
-static double ref_pressure_kpa;
-
-/* baro_pressure_to_altitude – see baro.h */
-static double baro_pressure_to_altitude(double press_kpa)
-{
-	/*
-	 * Hypsometric formula (ISA troposphere):
-	 *   h = (T0 / L) * (1 - (P / P_ref) ^ (R·L / (g·M)))
-	 */
-	return (ISA_T0 / ISA_L) *
-	       (1.0 - pow(press_kpa / ref_pressure_kpa, ISA_RL_OVER_GM));
-}
-
-/* baro_set_reference – see baro.h */
-int baro_set_reference(double ref_kpa)
-{
-	static bool ref_set = false;
-
-	if (ref_kpa <= 0.0)
-		return -EINVAL;
-
-	if (!ref_set)
-	{
-		ref_pressure_kpa = ref_kpa;
-		ref_set = true;
-	}
-
-	/* Success even if reference is already set */
-	return 0;
-}
-
-/* baro_sensor_value_to_altitude – see baro.h */
-int baro_sensor_value_to_altitude(const struct sensor_value *press, double *altitude_out)
-{
-	if (press == NULL || altitude_out == NULL)
-		return -EINVAL;
-
-	double press_kpa = (double)press->val1 + (double)press->val2 / 1e6;
-
-	if (baro_set_reference(press_kpa) != 0) {
-		return -EINVAL;
-	}
-
-	*altitude_out = baro_pressure_to_altitude(press_kpa);
-	return 0;
-}
-
 #if defined(CONFIG_DATA_LOGGER_BIN)
 void log_baro_data(const struct baro_data *baro)
 {
-	uint64_t ts = k_ticks_to_ns_floor64(k_uptime_ticks());
-	struct datapoint dp = {
-		.timestamp_ns = ts,
-		.type = AURORA_DATA_BARO,
-		.channel_count = 2,
-		.channels = {baro->temperature, baro->pressure},
-	};
-	log_enqueue(&dp);
+	struct sensor_value ch[2];
+
+	aurora_sample_to_sensor_value(baro->temperature, &ch[0]);
+	aurora_sample_to_sensor_value(baro->pressure, &ch[1]);
+	log_record(AURORA_DATA_BARO, baro->timestamp_ns, ch, ARRAY_SIZE(ch));
 }
 #endif
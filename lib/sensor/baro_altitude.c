@@ -0,0 +1,185 @@
+/**
+ * @file baro_altitude.c
+ * @brief Pressure-to-altitude conversion for the barometer library.
+ *
+ * Converts pressure readings to altitude above the ground reference with
+ * the ISA hypsometric formula.  With CONFIG_BARO_ALTITUDE_LUT the
+ * formula is tabulated once when the reference is set and each sample
+ * is a linear interpolation in integer micro-kPa and float, so no pow()
+ * or double math runs per sample.
+ *
+ * Copyright (c) 2025-2026, Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/drivers/sensor.h>
+
+#include <aurora/lib/baro.h>
+
+LOG_MODULE_REGISTER(baro_altitude, CONFIG_AURORA_SENSORS_LOG_LEVEL);
+
+/*-----------------------------------------------------------
+ * Pressure-to-altitude conversion (ISA troposphere)
+ *----------------------------------------------------------*/
+
+/** ISA sea-level temperature (K). */
+#define ISA_T0 288.15
+
+/** ISA temperature lapse rate (K/m). */
+#define ISA_L  0.0065
+
+/** g·M / (R·L) exponent for the barometric formula. */
+#define ISA_GMR_OVER_L 5.25588
+
+/** R·L / (g·M) exponent for the hypsometric formula. */
+#define ISA_RL_OVER_GM 0.190263
+
+/** Micro-kPa per kPa, the resolution of sensor_value and baro samples. */
+#define UKPA_PER_KPA 1000000
+
+/** Ground-level reference pressure in kPa (0 = not set). */
+static double ref_pressure_kpa;
+
+/** Set once by the first valid baro_set_reference() call. */
+static bool ref_set;
+
+/* baro_pressure_to_altitude – see baro.h */
+static double baro_pressure_to_altitude(double press_kpa)
+{
+	/*
+	 * Hypsometric formula (ISA troposphere):
+	 *   h = (T0 / L) * (1 - (P / P_ref) ^ (R·L / (g·M)))
+	 */
+	return (ISA_T0 / ISA_L) *
+	       (1.0 - pow(press_kpa / ref_pressure_kpa, ISA_RL_OVER_GM));
+}
+
+#if defined(CONFIG_BARO_ALTITUDE_LUT)
+
+/** Lowest altitude the table covers, below the reference (m). */
+#define BARO_LUT_FLOOR_M (-200.0)
+
+#define BARO_LUT_SIZE CONFIG_BARO_ALTITUDE_LUT_SIZE
+
+/** Altitude at lut_base_ukpa + i * lut_step_ukpa. */
+static float lut[BARO_LUT_SIZE];
+
+/** Pressure of lut[0], at the ceiling (micro-kPa). */
+static int64_t lut_base_ukpa;
+
+/** Pressure step between entries (micro-kPa). */
+static uint32_t lut_step_ukpa;
+
+/** 1 / lut_step_ukpa, so the lookup multiplies instead of dividing. */
+static float lut_inv_step;
+
+/* Inverse of the hypsometric formula, only used to place the grid. */
+static double altitude_to_pressure_kpa(double alt_m)
+{
+	return ref_pressure_kpa *
+	       pow(1.0 - alt_m * ISA_L / ISA_T0, ISA_GMR_OVER_L);
+}
+
+static void baro_lut_build(void)
+{
+	const int64_t lo = (int64_t)(altitude_to_pressure_kpa(
+		CONFIG_BARO_ALTITUDE_LUT_CEILING_M) * UKPA_PER_KPA);
+	const int64_t hi = (int64_t)ceil(altitude_to_pressure_kpa(
+		BARO_LUT_FLOOR_M) * UKPA_PER_KPA);
+
+	lut_base_ukpa = lo;
+	lut_step_ukpa = (uint32_t)DIV_ROUND_UP(hi - lo, BARO_LUT_SIZE - 1);
+	lut_inv_step = 1.0f / (float)lut_step_ukpa;
+
+	for (int i = 0; i < BARO_LUT_SIZE; i++) {
+		const double p = (double)(lo + (int64_t)i * lut_step_ukpa) /
+				 UKPA_PER_KPA;
+
+		lut[i] = (float)baro_pressure_to_altitude(p);
+	}
+
+	LOG_DBG("altitude table: %d entries, %u ukPa step",
+		BARO_LUT_SIZE, lut_step_ukpa);
+}
+
+/* Interpolate @p press_ukpa in the table.  Returns false outside of it. */
+static bool baro_lut_lookup(int64_t press_ukpa, double *alt)
+{
+	const int64_t off = press_ukpa - lut_base_ukpa;
+
+	if (off < 0 || off >= (int64_t)lut_step_ukpa * (BARO_LUT_SIZE - 1))
+		return false;
+
+	/* The table spans well under 2^32 micro-kPa. */
+	const uint32_t i = (uint32_t)off / lut_step_ukpa;
+	const uint32_t rem = (uint32_t)off - i * lut_step_ukpa;
+	const float frac = (float)rem * lut_inv_step;
+
+	*alt = lut[i] + frac * (lut[i + 1] - lut[i]);
+	return true;
+}
+
+#endif /* CONFIG_BARO_ALTITUDE_LUT */
+
+/* baro_set_reference – see baro.h */
+int baro_set_reference(double ref_kpa)
+{
+	if (ref_kpa <= 0.0)
+		return -EINVAL;
+
+	if (!ref_set)
+	{
+		ref_pressure_kpa = ref_kpa;
+		ref_set = true;
+#if defined(CONFIG_BARO_ALTITUDE_LUT)
+		baro_lut_build();
+#endif /* CONFIG_BARO_ALTITUDE_LUT */
+	}
+
+	/* Success even if reference is already set */
+	return 0;
+}
+
+/* Altitude of a pressure in micro-kPa, both exported forms end here. */
+static int baro_ukpa_to_altitude(int64_t press_ukpa, double *altitude_out)
+{
+#if defined(CONFIG_BARO_ALTITUDE_LUT)
+	/* Pressures outside the table fall through to the formula. */
+	if (ref_set && baro_lut_lookup(press_ukpa, altitude_out))
+		return 0;
+#endif /* CONFIG_BARO_ALTITUDE_LUT */
+
+	double press_kpa = (double)press_ukpa / UKPA_PER_KPA;
+
+	if (baro_set_reference(press_kpa) != 0) {
+		return -EINVAL;
+	}
+
+	*altitude_out = baro_pressure_to_altitude(press_kpa);
+	return 0;
+}
+
+/* baro_sensor_value_to_altitude – see baro.h */
+int baro_sensor_value_to_altitude(const struct sensor_value *press, double *altitude_out)
+{
+	if (press == NULL || altitude_out == NULL)
+		return -EINVAL;
+
+	return baro_ukpa_to_altitude((int64_t)press->val1 * UKPA_PER_KPA + press->val2,
+				     altitude_out);
+}
+
+/* baro_sample_to_altitude – see baro.h */
+int baro_sample_to_altitude(aurora_sample_t press, double *altitude_out)
+{
+	if (altitude_out == NULL)
+		return -EINVAL;
+
+	return baro_ukpa_to_altitude(press, altitude_out);
+}
@@ -2,8 +2,9 @@
  * @file imu.c
  * @brief IMU (LSM6DSO32) sensor library implementation.
  *
- * Provides polling and trigger-based interfaces for acceleration and
- * gyroscope data, plus initialization and sampling frequency configuration.
+ * Provides polling, trigger-based and FIFO stream interfaces for
+ * acceleration and gyroscope data, plus initialization and sampling
+ * frequency configuration.
  *
  * Copyright (c) 2025-2026, Auxspace e.V.
  *
@@ -17,6 +18,10 @@
 #include <zephyr/drivers/sensor.h>
 #include <zephyr/zbus/zbus.h>
 
+#if defined(CONFIG_IMU_STREAM)
+#include <zephyr/rtio/rtio.h>
+#endif /* CONFIG_IMU_STREAM */
+
 #include <aurora/lib/data_logger.h>
 #include <aurora/lib/imu.h>
 
@@ -33,27 +38,35 @@ ZBUS_CHAN_DEFINE(imu_data_chan,
 		 ZBUS_OBSERVERS_EMPTY,
 		 ZBUS_MSG_INIT(0));
 
-/**
- * @brief Convert a Zephyr sensor_value to a double.
- *
- * @param val Pointer to the sensor value.
- * @return Floating-point representation.
- */
-static inline double out_ev(const struct sensor_value *val)
+/* Device of each instance, filled in by imu_init_instance(). */
+static const struct device *imu_devs[CONFIG_IMU_INSTANCES];
+
+/** @brief Instance number of @p dev, 0 if it was never registered. */
+static uint8_t instance_of(const struct device *dev)
 {
-	return (val->val1 + (double)val->val2 / 1000000);
+	for (uint8_t i = 1; i < CONFIG_IMU_INSTANCES; i++) {
+		if (imu_devs[i] == dev) {
+			return i;
+		}
+	}
+	return 0;
 }
 
 /**
  * @brief Fetch and log accelerometer and gyroscope readings.
  *
- * @param dev Pointer to the IMU device.
+ * @param dev          Pointer to the IMU device.
+ * @param timestamp_ns Capture time of the sample.
  *
  * @return 0 on success, -errno on failure.
  */
-static int fetch_and_send(const struct device *dev)
+static int fetch_and_send(const struct device *dev, uint64_t timestamp_ns)
 {
-	struct imu_data msg;
+	struct imu_data msg = {
+		.timestamp_ns = timestamp_ns,
+		.instance     = instance_of(dev),
+	};
+	struct sensor_value val[IMU_NUM_AXES];
 	int ret;
 
 	ret = sensor_sample_fetch(dev);
@@ -62,17 +75,23 @@ static int fetch_and_send(const struct device *dev)
 		return ret;
 	}
 
-	ret = sensor_channel_get(dev, SENSOR_CHAN_ACCEL_XYZ, msg.accel);
+	ret = sensor_channel_get(dev, SENSOR_CHAN_ACCEL_XYZ, val);
 	if (ret != 0) {
 		LOG_ERR("Failed to get accelerometer data");
 		return ret;
 	}
+	for (int i = 0; i < IMU_NUM_AXES; i++) {
+		msg.accel[i] = aurora_sample_from_sensor_value(&val[i]);
+	}
 
-	ret = sensor_channel_get(dev, SENSOR_CHAN_GYRO_XYZ, msg.gyro);
+	ret = sensor_channel_get(dev, SENSOR_CHAN_GYRO_XYZ, val);
 	if (ret != 0) {
 		LOG_ERR("Failed to get gyroscope data");
 		return ret;
 	}
+	for (int i = 0; i < IMU_NUM_AXES; i++) {
+		msg.gyro[i] = aurora_sample_from_sensor_value(&val[i]);
+	}
 
 	/* Publish the IMU data to the z-bus channel */
 	ret = zbus_chan_pub(&imu_data_chan, &msg, K_NO_WAIT);
@@ -83,18 +102,63 @@ static int fetch_and_send(const struct device *dev)
 }
 
 #if defined(CONFIG_IMU_TRIGGER)
+/* Instances whose data-ready fired since the reader last ran, and the
+ * time each one fired.
+ */
+static atomic_t imu_ready;
+static uint64_t imu_ready_ns[CONFIG_IMU_INSTANCES];
+K_SEM_DEFINE(imu_ready_sem, 0, 1);
+
 /**
  * @brief Data-ready trigger callback for the IMU.
  *
+ * Runs in the driver's trigger context, so it only stamps the sample
+ * and wakes the reader thread; the bus transfer and the publish happen
+ * there.
+ *
  * @param dev  Pointer to the IMU device.
  * @param trig Pointer to the sensor trigger descriptor.
  */
 static void trigger_handler(const struct device *dev,
 			    const struct sensor_trigger *trig)
 {
-	fetch_and_send(dev);
+	const uint8_t i = instance_of(dev);
+
+	ARG_UNUSED(trig);
+
+	imu_ready_ns[i] = k_ticks_to_ns_floor64(k_uptime_ticks());
+	atomic_set_bit(&imu_ready, i);
+	k_sem_give(&imu_ready_sem);
+}
+
+/**
+ * @brief Read every IMU whose data-ready fired.
+ *
+ * A second interrupt before the read only moves the timestamp forward,
+ * the read then returns the newer sample.
+ */
+static void imu_reader_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1); ARG_UNUSED(p2); ARG_UNUSED(p3);
+
+	for (;;) {
+		(void)k_sem_take(&imu_ready_sem, K_FOREVER);
+
+		atomic_val_t ready = atomic_clear(&imu_ready);
+
+		for (uint8_t i = 0; i < CONFIG_IMU_INSTANCES; i++) {
+			if ((ready & BIT(i)) != 0 && imu_devs[i] != NULL) {
+				(void)fetch_and_send(imu_devs[i],
+						     imu_ready_ns[i]);
+			}
+		}
+	}
 }
 
+K_THREAD_DEFINE(imu_reader, CONFIG_IMU_READER_STACK_SIZE,
+		imu_reader_fn, NULL, NULL, NULL,
+		CONFIG_IMU_READER_PRIO, 0, 0);
+
 /**
  * @brief Configure the IMU to run in data-ready trigger mode.
  *
@@ -120,21 +184,225 @@ int imu_poll(const struct device *dev)
 	if (dev == NULL)
 		return -EINVAL;
 
-	return fetch_and_send(dev);
+	return fetch_and_send(dev, k_ticks_to_ns_floor64(k_uptime_ticks()));
 }
 #endif /* CONFIG_IMU_TRIGGER */
 
+#if defined(CONFIG_IMU_STREAM)
+/** Samples decoded per decoder call; a block is walked in these chunks. */
+#define IMU_DECODE_CHUNK 8
+
+static struct sensor_stream_trigger imu_stream_trigs[] = {
+	{ SENSOR_TRIG_FIFO_WATERMARK, SENSOR_STREAM_DATA_INCLUDE },
+};
+
+/* The device is filled in by imu_init(), the library has no devicetree
+ * node of its own. */
+static struct sensor_read_config imu_stream_cfg = {
+	.sensor = NULL,
+	.is_streaming = true,
+	.triggers = imu_stream_trigs,
+	.count = ARRAY_SIZE(imu_stream_trigs),
+	.max = ARRAY_SIZE(imu_stream_trigs),
+};
+
+RTIO_IODEV_DEFINE(imu_iodev, &__sensor_iodev_api, &imu_stream_cfg);
+RTIO_DEFINE_WITH_MEMPOOL(imu_rtio, 4, 4, CONFIG_IMU_STREAM_BLOCKS,
+			 CONFIG_IMU_STREAM_BLOCK_SIZE, sizeof(void *));
+
+static struct rtio_sqe *imu_stream_handle;
+
+/** Decoder output for one chunk of a three-axis channel. */
+struct imu_decoded {
+	struct sensor_three_axis_data data;
+	struct sensor_three_axis_sample_data more[IMU_DECODE_CHUNK - 1];
+};
+
+/**
+ * @brief Convert a decoded q31 reading to a sample.
+ *
+ * @param q     Raw q31 value.
+ * @param shift Decoder shift, the value is @p q * 2^(shift - 31).
+ * @return The reading in millionths.
+ */
+static aurora_sample_t q31_to_sample(q31_t q, int8_t shift)
+{
+	int64_t micro = (int64_t)q * AURORA_SAMPLE_SCALE;
+
+	micro = shift >= 0 ? (micro << shift) >> 31 : micro >> (31 - shift);
+	return aurora_sample_from_micro(micro);
+}
+
+/**
+ * @brief (Re)arm the multishot FIFO stream.
+ *
+ * @retval 0 on success.
+ * @retval -errno Negative errno on failure.
+ */
+static int imu_stream_start(void)
+{
+	int ret = sensor_stream(&imu_iodev, &imu_rtio, NULL, &imu_stream_handle);
+
+	if (ret != 0) {
+		LOG_ERR("Failed to start IMU stream (%d)", ret);
+	}
+	return ret;
+}
+
+/**
+ * @brief Decode one FIFO block and publish every sample.
+ *
+ * Accelerometer and gyroscope frames are decoded side by side and paired
+ * by index; a channel with fewer frames ends the walk. Each sample is
+ * stamped with its accelerometer frame time from the driver.
+ *
+ * @param dev Pointer to the IMU device.
+ * @param buf Encoded block from the driver.
+ *
+ * @return Number of samples published, or -errno on failure.
+ */
+static int publish_block(const struct device *dev, const uint8_t *buf)
+{
+	const struct sensor_chan_spec accel_spec = { SENSOR_CHAN_ACCEL_XYZ, 0 };
+	const struct sensor_chan_spec gyro_spec = { SENSOR_CHAN_GYRO_XYZ, 0 };
+	const struct sensor_decoder_api *decoder;
+	struct imu_decoded accel, gyro;
+	uint32_t accel_fit = 0;
+	uint32_t gyro_fit = 0;
+	int published = 0;
+	int ret;
+
+	ret = sensor_get_decoder(dev, &decoder);
+	if (ret != 0) {
+		return ret;
+	}
+
+	while (1) {
+		int na = decoder->decode(buf, accel_spec, &accel_fit,
+					 IMU_DECODE_CHUNK, &accel);
+		int ng = decoder->decode(buf, gyro_spec, &gyro_fit,
+					 IMU_DECODE_CHUNK, &gyro);
+		int n = MIN(na, ng);
+
+		if (n < 0 && published == 0) {
+			return n;
+		}
+		if (n <= 0) {
+			return published;
+		}
+
+		for (int i = 0; i < n; i++) {
+			struct imu_data msg = {
+				.timestamp_ns = accel.data.header.base_timestamp_ns +
+						accel.data.readings[i].timestamp_delta,
+			};
+
+			for (int axis = 0; axis < IMU_NUM_AXES; axis++) {
+				msg.accel[axis] = q31_to_sample(accel.data.readings[i].values[axis],
+								accel.data.shift);
+				msg.gyro[axis]  = q31_to_sample(gyro.data.readings[i].values[axis],
+								gyro.data.shift);
+			}
+
+			ret = zbus_chan_pub(&imu_data_chan, &msg, K_NO_WAIT);
+			if (ret != 0) {
+				LOG_ERR("Failed to publish IMU data");
+				return ret;
+			}
+			published++;
+		}
+	}
+}
+
+/* imu_read_batch – see imu.h */
+int imu_read_batch(const struct device *dev)
+{
+	struct rtio_cqe *cqe;
+	uint8_t *buf;
+	uint32_t len;
+	int ret;
+
+	if (dev == NULL)
+		return -EINVAL;
+
+	cqe = rtio_cqe_consume_block(&imu_rtio);
+	ret = cqe->result;
+	if (ret < 0) {
+		rtio_cqe_release(&imu_rtio, cqe);
+		LOG_ERR("IMU FIFO read failed (%d)", ret);
+		/* A failed multishot read ends the stream. */
+		(void)imu_stream_start();
+		return ret;
+	}
+
+	ret = rtio_cqe_get_mempool_buffer(&imu_rtio, cqe, &buf, &len);
+	rtio_cqe_release(&imu_rtio, cqe);
+	if (ret != 0) {
+		LOG_ERR("IMU FIFO block unavailable (%d)", ret);
+		return ret;
+	}
+
+	ret = publish_block(dev, buf);
+	rtio_release_buffer(&imu_rtio, buf, len);
+	return ret;
+}
+#endif /* CONFIG_IMU_STREAM */
+
+/* imu_set_sampling_freq – see imu.h */
+int imu_set_sampling_freq(const struct device *dev, int sampling_rate_hz)
+{
+	const struct sensor_value odr = { .val1 = sampling_rate_hz };
+	int ret;
+
+	if (dev == NULL || sampling_rate_hz <= 0)
+		return -EINVAL;
+
+	ret = sensor_attr_set(dev, SENSOR_CHAN_ACCEL_XYZ,
+			      SENSOR_ATTR_SAMPLING_FREQUENCY, &odr);
+	if (ret != 0) {
+		LOG_ERR("Failed to set accelerometer rate (%d)", ret);
+		return ret;
+	}
+
+	ret = sensor_attr_set(dev, SENSOR_CHAN_GYRO_XYZ,
+			      SENSOR_ATTR_SAMPLING_FREQUENCY, &odr);
+	if (ret != 0) {
+		LOG_ERR("Failed to set gyroscope rate (%d)", ret);
+	}
+	return ret;
+}
+
 /* imu_init – see imu.h */
 int imu_init(const struct device *dev)
 {
+	return imu_init_instance(dev, 0);
+}
+
+/* imu_init_instance – see imu.h */
+int imu_init_instance(const struct device *dev, uint8_t instance)
+{
+	if (instance >= CONFIG_IMU_INSTANCES) {
+		return -EINVAL;
+	}
 	if (!device_is_ready(dev)) {
 		LOG_ERR("%s: device not ready", dev->name);
 		return -ENODEV;
 	}
+	imu_devs[instance] = dev;
 
 #if defined(CONFIG_IMU_TRIGGER)
 	LOG_DBG("Enabling IMU in trigger mode");
 	run_trigger_mode(dev);
+#elif defined(CONFIG_IMU_STREAM)
+	int ret = imu_set_sampling_freq(dev, CONFIG_IMU_FREQUENCY);
+
+	if (ret != 0) {
+		return ret;
+	}
+
+	LOG_DBG("Enabling IMU in FIFO stream mode");
+	imu_stream_cfg.sensor = dev;
+	return imu_stream_start();
 #endif
 
 	return 0;
@@ -146,9 +414,9 @@ int imu_sensor_value_to_acceleration(const struct imu_data *data, double *acc_ou
 	if (data == NULL || acc_out == NULL)
 		return -EINVAL;
 
-	double x = out_ev(&data->accel[0]);
-	double y = out_ev(&data->accel[1]);
-	double z = out_ev(&data->accel[2]);
+	double x = aurora_sample_to_double(data->accel[0]);
+	double y = aurora_sample_to_double(data->accel[1]);
+	double z = aurora_sample_to_double(data->accel[2]);
 	*acc_out = sqrt(x*x + y*y + z*z);
 	return 0;
 }
@@ -166,9 +434,9 @@ int imu_sensor_value_to_orientation(const struct imu_data *data,
 	const int sign = CONFIG_IMU_UP_AXIS_SIGN;
 
 	double a[3] = {
-		out_ev(&data->accel[0]),
-		out_ev(&data->accel[1]),
-		out_ev(&data->accel[2]),
+		aurora_sample_to_double(data->accel[0]),
+		aurora_sample_to_double(data->accel[1]),
+		aurora_sample_to_double(data->accel[2]),
 	};
 
 	/* Re-map body axes so the configured "up" axis becomes Z-up.  The two
@@ -192,7 +460,7 @@ int imu_sensor_value_to_orientation(const struct imu_data *data,
 	 * the up axis (with mounting sign) into orientation[2].
 	 */
 	if (dt_s > 0.0) {
-		double w_up = out_ev(&data->gyro[idx]);
+		double w_up = aurora_sample_to_double(data->gyro[idx]);
 		if (gyro_bias != NULL) {
 			w_up -= gyro_bias[idx];
 		}
@@ -212,19 +480,14 @@ int imu_sensor_value_to_orientation(const struct imu_data *data,
 #if defined(CONFIG_DATA_LOGGER_BIN)
 void log_imu_data(const struct imu_data *imu)
 {
-	uint64_t ts = k_ticks_to_ns_floor64(k_uptime_ticks());
-	struct datapoint dp = {
-		.timestamp_ns = ts,
-		.type = AURORA_DATA_IMU_ACCEL,
-		.channel_count = 3,
-		.channels = {imu->accel[0], imu->accel[1], imu->accel[2]},
-	};
-	log_enqueue(&dp);
+	struct sensor_value accel[IMU_NUM_AXES];
+	struct sensor_value gyro[IMU_NUM_AXES];
 
-	dp.type = AURORA_DATA_IMU_GYRO;
-	dp.channels[0] = imu->gyro[0];
-	dp.channels[1] = imu->gyro[1];
-	dp.channels[2] = imu->gyro[2];
-	log_enqueue(&dp);
+	for (int i = 0; i < IMU_NUM_AXES; i++) {
+		aurora_sample_to_sensor_value(imu->accel[i], &accel[i]);
+		aurora_sample_to_sensor_value(imu->gyro[i], &gyro[i]);
+	}
+	log_record(AURORA_DATA_IMU_ACCEL, imu->timestamp_ns, accel, IMU_NUM_AXES);
+	log_record(AURORA_DATA_IMU_GYRO, imu->timestamp_ns, gyro, IMU_NUM_AXES);
 }
 #endif
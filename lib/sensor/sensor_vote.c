@@ -0,0 +1,216 @@
+/**
+ * @file sensor_vote.c
+ * @brief Median and consistency voting across redundant sensors.
+ *
+ * Copyright (c) 2026, Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+#include <zephyr/sys/util.h>
+
+#include <aurora/lib/sensor_vote.h>
+
+/* New sample, the other instances and the previous output. */
+#define VOTE_MAX_CANDIDATES (SENSOR_VOTE_MAX_INSTANCES + 1)
+
+static double median(double *x, size_t n)
+{
+	/* n is at most VOTE_MAX_CANDIDATES, insertion sort is plenty. */
+	for (size_t i = 1; i < n; i++) {
+		const double key = x[i];
+		size_t j = i;
+
+		while (j > 0 && x[j - 1] > key) {
+			x[j] = x[j - 1];
+			j--;
+		}
+		x[j] = key;
+	}
+	return (n & 1) ? x[n / 2] : (x[n / 2 - 1] + x[n / 2]) / 2.0;
+}
+
+static bool is_healthy(const struct sensor_vote *v, uint8_t i)
+{
+	return v->faults[i] < CONFIG_SENSOR_VOTE_FAULT_LIMIT;
+}
+
+/* Healthy, has reported and not too long before @p now_ns. */
+static bool is_fresh(const struct sensor_vote *v, uint8_t i, uint64_t now_ns)
+{
+	if (!is_healthy(v, i) || v->last_ns[i] == 0) {
+		return false;
+	}
+	const uint64_t age = now_ns > v->last_ns[i] ? now_ns - v->last_ns[i]
+						    : v->last_ns[i] - now_ns;
+
+	return age <= v->max_age_ns;
+}
+
+/* sensor_vote_init – see sensor_vote.h */
+int sensor_vote_init(struct sensor_vote *v, enum sensor_vote_mode mode,
+		     uint8_t instances, uint8_t channels,
+		     const double *tolerance, uint64_t max_age_ns)
+{
+	if (v == NULL || tolerance == NULL ||
+	    instances == 0 || instances > SENSOR_VOTE_MAX_INSTANCES ||
+	    channels == 0 || channels > SENSOR_VOTE_MAX_CHANNELS) {
+		return -EINVAL;
+	}
+
+	memset(v, 0, sizeof(*v));
+	v->mode       = mode;
+	v->instances  = instances;
+	v->channels   = channels;
+	v->tolerance  = tolerance;
+	v->max_age_ns = max_age_ns;
+	return 0;
+}
+
+/* Does @p x agree with the fresh samples of the other instances? */
+static bool consistent(const struct sensor_vote *v, uint8_t instance,
+		       uint64_t timestamp_ns, const double *x)
+{
+	uint8_t others[SENSOR_VOTE_MAX_INSTANCES];
+	size_t n_others = 0;
+
+	for (uint8_t i = 0; i < v->instances; i++) {
+		if (i != instance && is_fresh(v, i, timestamp_ns)) {
+			others[n_others++] = i;
+		}
+	}
+
+	/* Nothing to compare against: a lone sensor always wins. */
+	if (n_others == 0) {
+		return true;
+	}
+
+	for (uint8_t c = 0; c < v->channels; c++) {
+		double cand[VOTE_MAX_CANDIDATES];
+		size_t n = 0;
+
+		cand[n++] = x[c];
+		for (size_t k = 0; k < n_others; k++) {
+			cand[n++] = v->last[others[k]][c];
+		}
+		/* Break a two-way tie with the previous output. */
+		if (n == 2 && v->have_out) {
+			cand[n++] = v->out[c];
+		}
+
+		if (fabs(x[c] - median(cand, n)) > v->tolerance[c]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/* Median of the pending instances, which all agreed when they came in. */
+static void round_output(struct sensor_vote *v, double *out)
+{
+	for (uint8_t c = 0; c < v->channels; c++) {
+		double cand[SENSOR_VOTE_MAX_INSTANCES];
+		size_t n = 0;
+
+		for (uint8_t i = 0; i < v->instances; i++) {
+			if (v->pending & BIT(i)) {
+				cand[n++] = v->last[i][c];
+			}
+		}
+		v->out[c] = median(cand, n);
+	}
+	memcpy(out, v->out, v->channels * sizeof(*out));
+	v->have_out = true;
+	v->pending = 0;
+}
+
+/* Is the open round still waiting for @p i? */
+static bool is_expected(const struct sensor_vote *v, uint8_t i, uint64_t now_ns)
+{
+	if ((v->pending & BIT(i)) || v->faults[i] != 0) {
+		return false;
+	}
+	/* Right after start every instance gets one max_age to show up. */
+	if (v->last_ns[i] == 0) {
+		return now_ns - v->start_ns <= v->max_age_ns;
+	}
+	return is_fresh(v, i, now_ns);
+}
+
+static void store(struct sensor_vote *v, uint8_t instance,
+		  uint64_t timestamp_ns, const double *x)
+{
+	memcpy(v->last[instance], x, v->channels * sizeof(*x));
+	v->last_ns[instance] = timestamp_ns;
+}
+
+/* sensor_vote_submit – see sensor_vote.h */
+int sensor_vote_submit(struct sensor_vote *v, uint8_t instance,
+		       uint64_t timestamp_ns, const double *x, double *out)
+{
+	bool closed = false;
+
+	if (instance >= v->instances) {
+		return -EINVAL;
+	}
+	if (v->start_ns == 0) {
+		v->start_ns = timestamp_ns;
+	}
+
+	if (!consistent(v, instance, timestamp_ns, x)) {
+		/* Even a rejected sample is this instance's latest word: it
+		 * only votes again while the instance is still healthy. An
+		 * accepted sample waiting for the round keeps its slot, or
+		 * round_output() would take the median over the glitch.
+		 */
+		if (!(v->pending & BIT(instance))) {
+			store(v, instance, timestamp_ns, x);
+		}
+		v->rejected[instance]++;
+		if (is_healthy(v, instance)) {
+			v->faults[instance]++;
+		}
+		return -EBADMSG;
+	}
+	v->faults[instance] = 0;
+
+	if (v->mode == SENSOR_VOTE_PASS) {
+		store(v, instance, timestamp_ns, x);
+		memcpy(v->out, x, v->channels * sizeof(*x));
+		memcpy(out, x, v->channels * sizeof(*x));
+		v->have_out = true;
+		return 1;
+	}
+
+	/* A second sample before the others reported closes the round
+	 * without them, so a slow instance never stalls the output. The
+	 * new sample opens the next round.
+	 */
+	if (v->pending & BIT(instance)) {
+		round_output(v, out);
+		closed = true;
+	}
+	store(v, instance, timestamp_ns, x);
+	v->pending |= BIT(instance);
+	if (closed) {
+		return 1;
+	}
+
+	for (uint8_t i = 0; i < v->instances; i++) {
+		if (is_expected(v, i, timestamp_ns)) {
+			return 0;
+		}
+	}
+	round_output(v, out);
+	return 1;
+}
+
+/* sensor_vote_healthy – see sensor_vote.h */
+bool sensor_vote_healthy(const struct sensor_vote *v, uint8_t instance)
+{
+	return instance < v->instances && is_healthy(v, instance);
+}
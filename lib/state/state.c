@@ -22,6 +22,8 @@
 #include <zephyr/spinlock.h>
 
 #include <aurora/lib/state/state.h>
+#include <aurora/lib/state/profile.h>
+#include <aurora/lib/ram.h>
 #include "state_internal.h"
 
 #if defined(CONFIG_AURORA_STATE_MACHINE_AUDIT)
@@ -30,7 +32,7 @@
 
 #if defined(CONFIG_FILTER)
 #include <aurora/lib/filter.h>
-static struct filter filter;
+static struct filter filter __aurora_fast;
 #endif /* CONFIG_FILTER */
 
 LOG_MODULE_REGISTER(state_machine, CONFIG_STATE_MACHINE_LOG_LEVEL);
@@ -52,7 +54,15 @@ static int fallback_sm_error_handler(enum sm_error_reason reason, void *args);
  * Internal State
  *----------------------------------------------------------*/
 static enum sm_state current_state = SM_IDLE; /**< Active flight state. */
-static struct sm_inputs last_inputs; /**< Last inputs evaluated by the backend. */
+static struct sm_inputs last_inputs __aurora_fast; /**< Last inputs evaluated by the backend. */
+#if defined(CONFIG_FILTER)
+static uint64_t filter_last_ns; /**< Capture time of the last filtered input (0 = none). */
+/** Serialises the filter between a fusion thread (sm_fuse()) and sm_update().
+ * A mutex rather than a spinlock: the filter step is long in soft float and
+ * must not hold interrupts off; both sides are threads.
+ */
+static K_MUTEX_DEFINE(filter_lock);
+#endif /* CONFIG_FILTER */
 
 static struct k_spinlock err_lock; /**< Spinlock protecting error callback invocation. */
 static struct sm_error_handling_args err_hdl = {
@@ -143,7 +153,12 @@ void sm_error_retry(void)
 /* sm_filter_detect_apogee – see state_internal.h */
 int sm_filter_detect_apogee(void)
 {
-	return filter_detect_apogee(&filter);
+	int ret;
+
+	k_mutex_lock(&filter_lock, K_FOREVER);
+	ret = filter_detect_apogee(&filter);
+	k_mutex_unlock(&filter_lock);
+	return ret;
 }
 #endif /* CONFIG_FILTER */
 
@@ -161,6 +176,7 @@ void sm_init(const struct sm_thresholds *cfg,
 		LOG_ERR("Could not initialize filter (%d).", ret);
 		return;
 	}
+	filter_last_ns = 0;
 #endif /* CONFIG_FILTER */
 
 	sm_backend_init(cfg);
@@ -188,33 +204,73 @@ void sm_deinit(void)
  * Update
  *----------------------------------------------------------*/
 
+#if defined(CONFIG_FILTER)
+/**
+ * @brief Feed one measurement into the input filter.
+ *
+ * Predicts across the time between measurements, not between calls,
+ * so a late, batched or skipped sm_update() does not skew the filter.
+ * A repeated capture time carries no new measurement and is skipped,
+ * which also makes feeding the same inputs twice harmless.
+ */
+static void sm_filter_feed(const struct sm_inputs *inputs)
+{
+	uint64_t current_time_ns = inputs->timestamp_ns != 0 ?
+		inputs->timestamp_ns : k_ticks_to_ns_floor64(k_uptime_ticks());
+
+	k_mutex_lock(&filter_lock, K_FOREVER);
+
+	if (filter_last_ns != 0 && current_time_ns > filter_last_ns) {
+		uint32_t t = sm_prof_begin();
+
+		filter_predict(&filter, (int64_t)(current_time_ns - filter_last_ns),
+			       inputs->accel_vert);
+		filter_update(&filter, inputs->altitude);
+		sm_prof_end(SM_PROF_FILTER, t);
+	}
+	if (current_time_ns > filter_last_ns) {
+		filter_last_ns = current_time_ns;
+	}
+	k_mutex_unlock(&filter_lock);
+}
+#endif /* CONFIG_FILTER */
+
+/* sm_fuse – see state.h */
+void sm_fuse(const struct sm_inputs *inputs)
+{
+#if defined(CONFIG_FILTER)
+	sm_filter_feed(inputs);
+#else
+	ARG_UNUSED(inputs);
+#endif /* CONFIG_FILTER */
+}
+
 /* sm_update – see state.h */
 void sm_update(const struct sm_inputs *inputs)
 {
 	static double previous_altitude = 0.0;
+	uint32_t t;
 
 #if defined(CONFIG_FILTER)
-	static uint64_t last_time_ns = 0;
 	struct sm_inputs filtered_inputs;
 
-	uint64_t current_time_ns = k_ticks_to_ns_floor64(k_uptime_ticks());
-
-	if (last_time_ns != 0) {
-		filter_predict(&filter, current_time_ns - last_time_ns,
-			       inputs->accel_vert);
-		filter_update(&filter, inputs->altitude);
-	}
-	last_time_ns = current_time_ns;
+	sm_filter_feed(inputs);
 
 	filtered_inputs = *inputs;
+	k_mutex_lock(&filter_lock, K_FOREVER);
 	filtered_inputs.altitude = filter.state[0];
 	filtered_inputs.velocity = filter.state[1];
+	k_mutex_unlock(&filter_lock);
 
+	t = sm_prof_begin();
 	sm_backend_step(&filtered_inputs, previous_altitude);
+	sm_prof_end(SM_PROF_SM_UPDATE, t);
 	previous_altitude = filtered_inputs.altitude;
 	last_inputs = filtered_inputs;
 #else
+	t = sm_prof_begin();
 	sm_backend_step(inputs, previous_altitude);
+	sm_prof_end(SM_PROF_SM_UPDATE, t);
 	previous_altitude = inputs->altitude;
 	last_inputs = *inputs;
 #endif /* CONFIG_FILTER */
@@ -3,11 +3,20 @@
  * @brief Ring-buffer audit log for state machine transitions and events.
  *
  * Producers (the state machine) call sm_audit_transition / sm_audit_event
- * from the SM hot path. Each call updates the in-RAM ring synchronously
- * (so the shell sees fresh entries immediately) and then hands a copy to
- * an internal k_msgq with K_NO_WAIT. A dedicated writer thread drains
- * the queue and performs all filesystem I/O. Keeping FS calls off the SM
- * thread avoids ever blocking a flight-critical task on SD-card latency.
+ * from the SM hot path. Each call stores a compact binary record in a
+ * lock-free ring: no mutex, no string handling, one atomic increment to
+ * claim a slot and two sequence stores around the copy. A dedicated
+ * writer thread drains the ring behind the producers, renders the text
+ * and performs all filesystem I/O; the shell renders on demand. Keeping
+ * FS calls and formatting off the SM thread avoids ever blocking a
+ * flight-critical task on SD-card latency.
+ *
+ * With CONFIG_AURORA_STATE_MACHINE_AUDIT_FLIGHT_LOG the writer keeps no
+ * file of its own: it hands every entry to the binary flight log as
+ * AURORA_DATA_SM_AUDIT records, so the SD card sees one sequential
+ * writer and the trail sits time-aligned with the sensor data.  The
+ * post-flight converter renders it to FLIGHT_<n>.audit.  Entries
+ * recorded while the flight log is closed wait in the ring.
  *
  * Copyright (c) 2025-2026 Auxspace e.V.
  *
@@ -20,13 +29,21 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/fs/fs.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/barrier.h>
 
 #include <aurora/lib/state/audit.h>
+#include <aurora/lib/ram.h>
+#if defined(CONFIG_AURORA_STATE_MACHINE_AUDIT_FLIGHT_LOG)
+#include <zephyr/sys/byteorder.h>
+#include <aurora/lib/data_logger.h>
+#elif defined(CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_ASYNC)
+#include <aurora/lib/data_logger.h>
+#endif
 
 LOG_MODULE_REGISTER(state_audit, CONFIG_STATE_MACHINE_LOG_LEVEL);
 
 #define AUDIT_SIZE       CONFIG_AURORA_STATE_MACHINE_AUDIT_LOG_SIZE
-#define AUDIT_MSGQ_DEPTH AUDIT_SIZE
 /* 4096 not 2048: the writer chains fs_write through FATFS + deferred
  * logging, and 2048 overflowed once BT_HCI_HOST pulled in extra log
  * filter overhead (observed as ZEPHYR FATAL ERROR 2 on ESP32-S3).
@@ -35,26 +52,122 @@ LOG_MODULE_REGISTER(state_audit, CONFIG_STATE_MACHINE_LOG_LEVEL);
 #define AUDIT_WRITER_PRIO  10
 #define MAX_F_RETRIES 3
 #define AUDOT_SEPARATOR_STR "---------------------------------------------------\n"
+/* Poll period for entries waiting on the flight log to open. */
+#define AUDIT_RETRY_MS 100
 
-/* Ring buffer state (queryable from the shell). All access is serialised
- * by ring_mutex — producers (sm_audit_transition / sm_audit_event) and
- * shell readers (sm_audit_get / count / clear) all hold it briefly. The
- * critical section never makes blocking calls, so the SM thread can take
- * it without back-pressure from the FS.
+/* Binary ring record. Events keep the caller's string pointer: the
+ * strings are literals (or generated const tables), so the pointer is
+ * already the index into a const string table, and nothing is copied.
+ */
+struct audit_rec {
+	uint64_t timestamp_ns;
+	const char *event;
+	uint8_t type;
+	uint8_t from;
+	uint8_t to;
+};
+
+/* Lock-free ring (queryable from the shell). Every record has a
+ * logical index n, handed out by atomic_inc(&ring_head), and lives in
+ * slot n % AUDIT_SIZE. The slot's seq is 2n + 1 while record n is
+ * being written and 2n + 2 once it is complete, so a reader that
+ * wants record n copies the slot and accepts it only if seq read
+ * 2n + 2 both before and after the copy. Producers never wait;
+ * readers that lose a race against a wrapping producer report the
+ * record as gone. Wrap-around of the 32-bit sequence after 2^31
+ * records is not a concern for a flight. Placed with the other log
+ * rings (__aurora_dma).
  */
-static struct sm_audit_entry ring[AUDIT_SIZE];
-static uint32_t head;
-static uint32_t count;
-static K_MUTEX_DEFINE(ring_mutex);
+static struct {
+	atomic_t seq;
+	struct audit_rec rec;
+} ring[AUDIT_SIZE] __aurora_dma;
+static atomic_t ring_head;   /* records ever claimed */
+static atomic_t ring_base;   /* first record the shell shows (clear) */
 
+/* Writer wake-up. Given by every producer, drained by the writer. */
+static K_SEM_DEFINE(audit_sem, 0, 1);
+
+#if !defined(CONFIG_AURORA_STATE_MACHINE_AUDIT_FLIGHT_LOG)
 /* File state — only touched by the writer thread, no locking needed. */
 static struct fs_file_t audit_file;
 static int audit_file_exists;
 static int audit_file_retry_cnt;
+#endif
 
-K_MSGQ_DEFINE(audit_msgq, sizeof(struct sm_audit_entry),
-	      AUDIT_MSGQ_DEPTH, 4);
+static void ring_push(const struct audit_rec *r)
+{
+	const uint32_t n = (uint32_t)atomic_inc(&ring_head);
+	const uint32_t slot = n % AUDIT_SIZE;
+
+	atomic_set(&ring[slot].seq, (atomic_val_t)(2U * n + 1U));
+	barrier_dmem_fence_full();
+	ring[slot].rec = *r;
+	barrier_dmem_fence_full();
+	atomic_set(&ring[slot].seq, (atomic_val_t)(2U * n + 2U));
+}
 
+/* Copy record n. -EAGAIN if it is not complete yet, -ENOENT if it has
+ * already been overwritten.
+ */
+static int ring_read(uint32_t n, struct audit_rec *out)
+{
+	const uint32_t slot = n % AUDIT_SIZE;
+	const uint32_t want = 2U * n + 2U;
+	uint32_t seq = (uint32_t)atomic_get(&ring[slot].seq);
+
+	if (seq != want) {
+		return (int32_t)(seq - want) > 0 ? -ENOENT : -EAGAIN;
+	}
+	barrier_dmem_fence_full();
+	*out = ring[slot].rec;
+	barrier_dmem_fence_full();
+	seq = (uint32_t)atomic_get(&ring[slot].seq);
+
+	return seq == want ? 0 : -ENOENT;
+}
+
+static void rec_to_entry(const struct audit_rec *r, struct sm_audit_entry *e)
+{
+	e->timestamp_ns = r->timestamp_ns;
+	e->type = (enum sm_audit_type)r->type;
+	e->from = (enum sm_state)r->from;
+	e->to = (enum sm_state)r->to;
+	e->event = r->event;
+}
+
+/* First record still in the ring that the shell may show. */
+static uint32_t ring_first(uint32_t head)
+{
+	const uint32_t base = (uint32_t)atomic_get(&ring_base);
+	const uint32_t oldest = head > AUDIT_SIZE ? head - AUDIT_SIZE : 0;
+
+	return MAX(base, oldest);
+}
+
+/* sm_audit_format – see audit.h */
+int sm_audit_format(const struct sm_audit_entry *e, char *buf, size_t len)
+{
+	if (e == NULL || buf == NULL) {
+		return -EINVAL;
+	}
+
+	if (e->type == SM_AUDIT_TRANSITION) {
+		return snprintf(buf, len, "%-12llu %-12s %-12s %s",
+				(unsigned long long)e->timestamp_ns,
+				"transition",
+				sm_state_str(e->from),
+				sm_state_str(e->to));
+	}
+
+	return snprintf(buf, len, "%-12llu %-12s %-12s %s",
+			(unsigned long long)e->timestamp_ns,
+			"event",
+			sm_state_str(e->from),
+			e->event ? e->event : "");
+}
+
+#if !defined(CONFIG_AURORA_STATE_MACHINE_AUDIT_FLIGHT_LOG)
 static int sm_audit_file_write_header(void)
 {
 	char header[53];
@@ -152,19 +265,7 @@ static int write_entry(const struct sm_audit_entry *e)
 	if (!audit_file_exists)
 		return -ENOENT;
 
-	if (e->type == SM_AUDIT_TRANSITION) {
-		snprintf(buf, sizeof(buf), "%-12llu %-12s %-12s %s",
-			(unsigned long long)e->timestamp_ns,
-			"transition",
-			sm_state_str(e->from),
-			sm_state_str(e->to));
-	} else {
-		snprintf(buf, sizeof(buf), "%-12llu %-12s %-12s %s",
-			(unsigned long long)e->timestamp_ns,
-			"event",
-			sm_state_str(e->from),
-			e->event ? e->event : "");
-	}
+	(void)sm_audit_format(e, buf, sizeof(buf));
 
 	wr = fs_write(&audit_file, buf, strlen(buf));
 	if (wr < 0)
@@ -176,20 +277,128 @@ static int write_entry(const struct sm_audit_entry *e)
 
 	LOG_INF("%s", buf);
 
-	return fs_sync(&audit_file);
+	return 0;
 }
 
-static void ring_push(const struct sm_audit_entry *e)
+static void persist_open(void)
 {
-	k_mutex_lock(&ring_mutex, K_FOREVER);
-	ring[head] = *e;
-	head = (head + 1) % AUDIT_SIZE;
-	if (count < AUDIT_SIZE) {
-		count++;
+	int rc;
+
+#if defined(CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_ASYNC)
+	/* Not a failed attempt yet: the volume is still being formatted. */
+	if (!audit_file_exists && flight_log_fat_wait(K_NO_WAIT) != 0)
+		return;
+#endif /* CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_ASYNC */
+
+	if (audit_file_exists || audit_file_retry_cnt++ >= MAX_F_RETRIES)
+		return;
+
+	rc = sm_audit_file_create();
+	if (rc) {
+		LOG_ERR("Could not create audit file (%d)", rc);
+		return;
+	}
+
+	rc = sm_audit_file_write_header();
+	if (rc) {
+		LOG_ERR("Could not create header (%d)", rc);
 	}
-	k_mutex_unlock(&ring_mutex);
 }
 
+/* Returns -EAGAIN to keep @p e in the ring for a later pass. */
+static int persist(const struct sm_audit_entry *e)
+{
+#if defined(CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_ASYNC)
+	if (!audit_file_exists && flight_log_fat_wait(K_NO_WAIT) != 0)
+		return -EAGAIN;
+#endif /* CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_ASYNC */
+
+	int rc = write_entry(e);
+
+	if (rc && rc != -ENOENT) {
+		LOG_ERR("Failed to write to audit file (%d)", rc);
+	}
+	return rc;
+}
+
+static void persist_sync(void)
+{
+	int rc = fs_sync(&audit_file);
+
+	if (rc) {
+		LOG_ERR("Failed to sync audit file (%d)", rc);
+	}
+}
+#else
+static void persist_open(void)
+{
+}
+
+/* Split @p e into AURORA_DATA_SM_AUDIT records, see data_logger.h. */
+static size_t audit_to_datapoints(const struct sm_audit_entry *e,
+				  struct datapoint *dps)
+{
+	const char *text = e->type == SM_AUDIT_EVENT && e->event ? e->event : "";
+	const size_t len = strnlen(text, AURORA_AUDIT_TEXT_MAX);
+	const size_t n = MAX(DIV_ROUND_UP(len, AURORA_AUDIT_TEXT_PER_RECORD), 1);
+
+	for (size_t i = 0; i < n; i++) {
+		struct datapoint *dp = &dps[i];
+		uint8_t chunk[AURORA_AUDIT_TEXT_PER_RECORD] = { 0 };
+		const size_t off = i * AURORA_AUDIT_TEXT_PER_RECORD;
+
+		memcpy(chunk, text + off,
+		       MIN(len - off, AURORA_AUDIT_TEXT_PER_RECORD));
+
+		dp->timestamp_ns  = e->timestamp_ns;
+		dp->type          = AURORA_DATA_SM_AUDIT;
+		dp->channel_count = DP_MAX_CHANNELS;
+		dp->channels[0].val1 = AURORA_AUDIT_TAG(e->type, e->from,
+							e->to, i);
+		dp->channels[0].val2 = (int32_t)len;
+		dp->channels[1].val1 = (int32_t)sys_get_le32(&chunk[0]);
+		dp->channels[1].val2 = (int32_t)sys_get_le32(&chunk[4]);
+		dp->channels[2].val1 = (int32_t)sys_get_le32(&chunk[8]);
+		dp->channels[2].val2 = (int32_t)sys_get_le32(&chunk[12]);
+	}
+
+	return n;
+}
+
+/* Returns -EAGAIN to keep @p e in the ring until the flight log is open. */
+static int persist(const struct sm_audit_entry *e)
+{
+	struct datapoint dps[AURORA_AUDIT_RECORDS_MAX];
+	const size_t n = audit_to_datapoints(e, dps);
+	int rc;
+
+	if (!atomic_get(&sm_logger_live))
+		return -EAGAIN;
+
+	rc = data_logger_write_batch(&sm_logger, dps, n);
+	if (rc == -EAGAIN || rc == -EBUSY) {
+		return -EAGAIN;
+	}
+	if (rc) {
+		LOG_ERR("Failed to write audit entry to the flight log (%d)", rc);
+		return rc;
+	}
+
+	if (IS_ENABLED(CONFIG_LOG)) {
+		char buf[128];
+
+		(void)sm_audit_format(e, buf, sizeof(buf));
+		LOG_INF("%s", buf);
+	}
+	return 0;
+}
+
+static void persist_sync(void)
+{
+	/* The flight log flushes on its own schedule. */
+}
+#endif /* !CONFIG_AURORA_STATE_MACHINE_AUDIT_FLIGHT_LOG */
+
 static void audit_writer_task(void *p1, void *p2, void *p3)
 {
 	ARG_UNUSED(p1);
@@ -197,29 +406,53 @@ static void audit_writer_task(void *p1, void *p2, void *p3)
 	ARG_UNUSED(p3);
 
 	struct sm_audit_entry e;
+	struct audit_rec r;
+	uint32_t next = 0;
 	int rc;
 
 	while (1) {
-		if (k_msgq_get(&audit_msgq, &e, K_FOREVER) != 0) {
-			continue;
-		}
+		const uint32_t pending = (uint32_t)atomic_get(&ring_head) - next;
+
+		(void)k_sem_take(&audit_sem,
+				 pending ? K_MSEC(AUDIT_RETRY_MS) : K_FOREVER);
+
+		persist_open();
+
+		/* Drain everything published so far, then sync once. */
+		bool wrote = false;
+		uint32_t head = (uint32_t)atomic_get(&ring_head);
 
-		if (!audit_file_exists &&
-		    audit_file_retry_cnt++ < MAX_F_RETRIES) {
-			rc = sm_audit_file_create();
-			if (rc) {
-				LOG_ERR("Could not create audit file (%d)", rc);
-			} else {
-				rc = sm_audit_file_write_header();
-				if (rc) {
-					LOG_ERR("Could not create header (%d)", rc);
-				}
+		while (next != head) {
+			if (head - next > AUDIT_SIZE) {
+				LOG_WRN("audit writer fell behind, %u entries not persisted",
+					head - next - AUDIT_SIZE);
+				next = head - AUDIT_SIZE;
 			}
+
+			rc = ring_read(next, &r);
+			if (rc == -EAGAIN) {
+				/* Claimed but still being written; its
+				 * producer gives the semaphore again.
+				 */
+				break;
+			}
+			if (rc == -ENOENT) {
+				next++;
+				LOG_WRN("audit entry overwritten, not persisted");
+				continue;
+			}
+
+			rec_to_entry(&r, &e);
+			rc = persist(&e);
+			if (rc == -EAGAIN) {
+				break;
+			}
+			next++;
+			wrote = wrote || rc == 0;
 		}
 
-		rc = write_entry(&e);
-		if (rc && rc != -ENOENT) {
-			LOG_ERR("Failed to write to audit file (%d)", rc);
+		if (wrote) {
+			persist_sync();
 		}
 	}
 }
@@ -228,85 +461,72 @@ K_THREAD_DEFINE(audit_writer_th, AUDIT_WRITER_STACK,
 		audit_writer_task, NULL, NULL, NULL,
 		AUDIT_WRITER_PRIO, 0, 0);
 
-static void publish(const struct sm_audit_entry *e)
+static void publish(const struct audit_rec *r)
 {
-	/* Update the in-RAM ring synchronously so the shell sees the entry
-	 * immediately, then hand a copy to the writer thread for FS I/O.
-	 * Drop on queue overflow rather than block the SM hot path; the
-	 * ring still reflects the entry for live diagnostics.
+	/* The ring is the only copy: the shell reads it directly and the
+	 * writer thread persists it behind the producers. If the writer
+	 * falls a whole ring behind, the oldest entries are not persisted;
+	 * it logs how many.
 	 */
-	ring_push(e);
-
-	if (k_msgq_put(&audit_msgq, e, K_NO_WAIT) != 0) {
-		LOG_WRN("audit queue full, entry not persisted");
-	}
+	ring_push(r);
+	k_sem_give(&audit_sem);
 }
 
 void sm_audit_transition(enum sm_state from, enum sm_state to)
 {
-	struct sm_audit_entry e = {
+	const struct audit_rec r = {
 		.timestamp_ns = k_ticks_to_ns_floor64(k_uptime_ticks()),
 		.type = SM_AUDIT_TRANSITION,
-		.from = from,
-		.to = to,
+		.from = (uint8_t)from,
+		.to = (uint8_t)to,
 		.event = NULL,
 	};
 
-	publish(&e);
+	publish(&r);
 }
 
 void sm_audit_event(enum sm_state state, const char *event)
 {
-	struct sm_audit_entry e = {
+	const struct audit_rec r = {
 		.timestamp_ns = k_ticks_to_ns_floor64(k_uptime_ticks()),
 		.type = SM_AUDIT_EVENT,
-		.from = state,
-		.to = state,
+		.from = (uint8_t)state,
+		.to = (uint8_t)state,
 		.event = event,
 	};
 
-	publish(&e);
+	publish(&r);
 }
 
 uint32_t sm_audit_count(void)
 {
-	uint32_t c;
-
-	k_mutex_lock(&ring_mutex, K_FOREVER);
-	c = count;
-	k_mutex_unlock(&ring_mutex);
+	const uint32_t head = (uint32_t)atomic_get(&ring_head);
 
-	return c;
+	return head - ring_first(head);
 }
 
 int sm_audit_get(uint32_t idx, struct sm_audit_entry *entry)
 {
-	uint32_t pos;
+	const uint32_t head = (uint32_t)atomic_get(&ring_head);
+	const uint32_t first = ring_first(head);
+	struct audit_rec r;
+	int rc;
 
-	if (entry == NULL) {
+	if (entry == NULL || idx >= head - first) {
 		return -EINVAL;
 	}
 
-	k_mutex_lock(&ring_mutex, K_FOREVER);
-
-	if (idx >= count) {
-		k_mutex_unlock(&ring_mutex);
-		return -EINVAL;
+	rc = ring_read(first + idx, &r);
+	if (rc) {
+		return -EAGAIN;
 	}
 
-	/* oldest entry is at (head - count) mod AUDIT_SIZE */
-	pos = (head + AUDIT_SIZE - count + idx) % AUDIT_SIZE;
-	*entry = ring[pos];
-
-	k_mutex_unlock(&ring_mutex);
+	rec_to_entry(&r, entry);
 
 	return 0;
 }
 
 void sm_audit_clear(void)
 {
-	k_mutex_lock(&ring_mutex, K_FOREVER);
-	head = 0;
-	count = 0;
-	k_mutex_unlock(&ring_mutex);
+	atomic_set(&ring_base, atomic_get(&ring_head));
 }
@@ -2,8 +2,9 @@
  * @file state_shell.c
  * @brief Zephyr shell commands for the state machine.
  *
- * Provides "state_machine status|transition|audit|audit_clear" commands
- * for inspecting and controlling the flight state machine.
+ * Provides "state_machine status|transition|audit|audit_clear|profile|
+ * profile_reset" commands for inspecting and controlling the flight
+ * state machine.
  *
  * Copyright (c) 2025-2026 Auxspace e.V.
  *
@@ -13,6 +14,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <errno.h>
 
 #include <zephyr/shell/shell.h>
 
@@ -22,11 +24,17 @@
 #include <aurora/lib/state/audit.h>
 #endif /* CONFIG_AURORA_STATE_MACHINE_AUDIT */
 
+#if defined(CONFIG_AURORA_STATE_MACHINE_PROFILE)
+#include <aurora/lib/state/profile.h>
+#endif /* CONFIG_AURORA_STATE_MACHINE_PROFILE */
+
 /*-----------------------------------------------------------
  * State machine type name (derived from Kconfig)
  *----------------------------------------------------------*/
 #if defined(CONFIG_SIMPLE_STATE)
 #define SM_TYPE_NAME "simple"
+#elif defined(CONFIG_TABLE_STATE)
+#define SM_TYPE_NAME "table"
 #else
 #define SM_TYPE_NAME "unknown"
 #endif
@@ -175,23 +183,19 @@ static int cmd_audit(const struct shell *sh, size_t argc, char **argv)
 	shell_print(sh, "------------------------------------------------");
 
 	for (uint32_t i = 0; i < n; i++) {
-		if (sm_audit_get(i, &e) != 0) {
+		char line[128];
+		int rc = sm_audit_get(i, &e);
+
+		if (rc == -EAGAIN) {
+			/* Overwritten by the producer while listing. */
+			continue;
+		}
+		if (rc != 0) {
 			break;
 		}
 
-		if (e.type == SM_AUDIT_TRANSITION) {
-			shell_print(sh, "%-12llu %-12s %-12s %s",
-				    (unsigned long long)e.timestamp_ns,
-				    "transition",
-				    sm_state_str(e.from),
-				    sm_state_str(e.to));
-		} else {
-			shell_print(sh, "%-12llu %-12s %-12s %s",
-				    (unsigned long long)e.timestamp_ns,
-				    "event",
-				    sm_state_str(e.from),
-				    e.event ? e.event : "");
-		}
+		(void)sm_audit_format(&e, line, sizeof(line));
+		shell_print(sh, "%s", line);
 	}
 
 	return 0;
@@ -211,6 +215,52 @@ static int cmd_audit_clear(const struct shell *sh, size_t argc, char **argv)
 
 #endif /* CONFIG_AURORA_STATE_MACHINE_AUDIT */
 
+#if defined(CONFIG_AURORA_STATE_MACHINE_PROFILE)
+
+/** @brief Show per-stage run times of the fusion and control loops. */
+static int cmd_profile(const struct shell *sh, size_t argc, char **argv)
+{
+	const uint64_t hz = sm_prof_cycles_per_sec();
+	struct sm_prof_stats st;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "Counter: %llu Hz", (unsigned long long)hz);
+	shell_print(sh, "%-10s %10s %10s %10s %10s %10s",
+		    "Stage", "Count", "Min", "Avg", "Max", "Avg (us)");
+	shell_print(sh, "------------------------------------------------------------------");
+
+	for (int i = 0; i < SM_PROF_COUNT; i++) {
+		if (sm_prof_get((enum sm_prof_stage)i, &st) != 0 || st.count == 0U) {
+			continue;
+		}
+
+		const uint64_t avg = st.total / st.count;
+
+		shell_print(sh, "%-10s %10u %10u %10llu %10u %10llu",
+			    sm_prof_stage_str((enum sm_prof_stage)i), st.count,
+			    st.min, (unsigned long long)avg, st.max,
+			    (unsigned long long)(hz ? avg * 1000000ULL / hz : 0));
+	}
+
+	return 0;
+}
+
+/** @brief Clear the per-stage statistics. */
+static int cmd_profile_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	sm_prof_reset();
+	shell_print(sh, "Profile cleared");
+
+	return 0;
+}
+
+#endif /* CONFIG_AURORA_STATE_MACHINE_PROFILE */
+
 /*-----------------------------------------------------------
  * Dynamic completion for state names
  *----------------------------------------------------------*/
@@ -246,6 +296,13 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 	SHELL_CMD(audit_clear, NULL,
 		  "Clear the audit log", cmd_audit_clear),
 #endif /* CONFIG_AURORA_STATE_MACHINE_AUDIT */
+#if defined(CONFIG_AURORA_STATE_MACHINE_PROFILE)
+	SHELL_CMD(profile, NULL,
+		  "Show per-stage cycle counts of the state machine loops",
+		  cmd_profile),
+	SHELL_CMD(profile_reset, NULL,
+		  "Clear the per-stage cycle counts", cmd_profile_reset),
+#endif /* CONFIG_AURORA_STATE_MACHINE_PROFILE */
 	SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_REGISTER(state_machine, &sub_state_machine,
@@ -0,0 +1,415 @@
+/**
+ * @file table.c
+ * @brief Table-driven flight state machine backend.
+ *
+ * Runs the same states as the simple backend, but the transitions come
+ * from const rule tables that tools/gen_sm_table.py generates at build
+ * time from a flight profile (CONFIG_TABLE_STATE_PROFILE).  This file
+ * only holds the guard predicates and a fixed evaluation loop: a step
+ * visits at most SM_TABLE_MAX_RULES rules and keeps no kernel timers.
+ * Dwells and timeouts are deadlines against a free-running counter,
+ * converted from the threshold milliseconds once in sm_backend_init().
+ *
+ * The common lifecycle, update entry point and error handling are
+ * provided by the state core (state.c), as for every backend.
+ *
+ * Copyright (c) 2026, Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+#include <aurora/lib/state/state.h>
+#include "state_internal.h"
+
+#ifndef M_PI
+#define M_PI ((double)3.1415926535)
+#endif
+
+LOG_MODULE_DECLARE(state_machine, CONFIG_STATE_MACHINE_LOG_LEVEL);
+
+/*-----------------------------------------------------------
+ * Table types (filled in by the generated header)
+ *----------------------------------------------------------*/
+
+#define SM_TABLE_NUM_STATES (SM_ERROR + 1)
+
+BUILD_ASSERT(SM_TABLE_NUM_STATES <= 32, "state masks are 32 bits wide");
+
+/** @brief Per-step view of the inputs handed to each guard. */
+struct sm_table_ctx {
+	const struct sm_inputs *in; /**< Current inputs. */
+	double previous_altitude;   /**< Altitude from the previous step (m). */
+	double elevation;           /**< Up-axis elevation (deg), NAN until needed. */
+};
+
+/** @brief Guard predicate: true if the rule's condition holds this step. */
+typedef bool (*sm_table_guard_t)(struct sm_table_ctx *ctx);
+
+/** @brief How a rule's guard is confirmed before it fires. */
+enum sm_table_timer {
+	SM_TABLE_NONE = 0, /**< Fires as soon as the guard holds. */
+	SM_TABLE_DWELL,    /**< Guard must hold for a threshold (ms). */
+	SM_TABLE_COUNT,    /**< Guard must hold for a threshold (steps). */
+	SM_TABLE_TIMEOUT,  /**< Threshold (ms) since entering the state. */
+};
+
+/** @brief What a rule does when it fires. */
+enum sm_table_action {
+	SM_TABLE_GOTO = 0, /**< Transition to @c to. */
+	SM_TABLE_ERROR,    /**< Raise @c reason through the error path. */
+	SM_TABLE_RETRY,    /**< Re-run the error handler. */
+};
+
+/** @brief One transition rule. */
+struct sm_table_rule {
+	sm_table_guard_t guard;   /**< Condition, NULL = always. */
+	enum sm_table_timer timer;/**< Confirmation of the guard. */
+	uint16_t threshold;       /**< offsetof() the sm_thresholds field for @c timer. */
+	bool hold;                /**< Skip lower rules while pending. */
+	uint32_t skip;            /**< Global rules: states (bit mask) it ignores. */
+	const char *start_event;  /**< Audit event when a dwell starts, or NULL. */
+	const char *event;        /**< Audit event when the rule fires, or NULL. */
+	enum sm_table_action action; /**< What firing does. */
+	enum sm_state to;         /**< Target of SM_TABLE_GOTO. */
+	enum sm_error_reason reason; /**< Cause for SM_TABLE_ERROR. */
+};
+
+/** @brief Slice of sm_table_rules[] evaluated for one state. */
+struct sm_table_range {
+	uint8_t first; /**< Index of the first rule. */
+	uint8_t count; /**< Number of rules. */
+};
+
+/*-----------------------------------------------------------
+ * Guards
+ *----------------------------------------------------------*/
+
+/**
+ * @brief Elevation of the configured up axis from horizontal (degrees).
+ *
+ * Same derivation as in simple.c: gz/|g| = cos(pitch) * cos(yaw).
+ * Computed at most once per step, and only by guards that need it.
+ */
+static double sm_table_elevation_deg(struct sm_table_ctx *ctx)
+{
+	if (isnan(ctx->elevation)) {
+		const double deg2rad = M_PI / 180.0;
+		double s = cos(ctx->in->orientation[1] * deg2rad) *
+			   cos(ctx->in->orientation[0] * deg2rad);
+		if (s > 1.0)  s = 1.0;
+		if (s < -1.0) s = -1.0;
+		ctx->elevation = asin(s) * (180.0 / M_PI);
+	}
+	return ctx->elevation;
+}
+
+static struct sm_thresholds th; /**< Loaded threshold configuration. */
+
+static bool sm_guard_disarmed(struct sm_table_ctx *ctx)
+{
+	return !ctx->in->armed;
+}
+
+static bool sm_guard_arm_ready(struct sm_table_ctx *ctx)
+{
+	return ctx->in->armed && ctx->in->log_ready &&
+	       sm_table_elevation_deg(ctx) >= th.T_OA;
+}
+
+static bool sm_guard_arm_log_offline(struct sm_table_ctx *ctx)
+{
+	return ctx->in->armed && !ctx->in->log_ready &&
+	       sm_table_elevation_deg(ctx) >= th.T_OA;
+}
+
+static bool sm_guard_log_offline(struct sm_table_ctx *ctx)
+{
+	return !ctx->in->log_ready;
+}
+
+static bool sm_guard_orientation_low(struct sm_table_ctx *ctx)
+{
+	return sm_table_elevation_deg(ctx) < th.T_OI;
+}
+
+static bool sm_guard_boost(struct sm_table_ctx *ctx)
+{
+	return ctx->in->acceleration >= th.T_AB && ctx->in->altitude >= th.T_H;
+}
+
+static bool sm_guard_burnout(struct sm_table_ctx *ctx)
+{
+	return ctx->in->acceleration < th.T_BB;
+}
+
+static bool sm_guard_apogee(struct sm_table_ctx *ctx)
+{
+#if defined(CONFIG_FILTER)
+	ARG_UNUSED(ctx);
+	return sm_filter_detect_apogee() == 1;
+#else
+	return ctx->in->velocity <= 0.0 &&
+	       ctx->in->altitude < ctx->previous_altitude;
+#endif /* CONFIG_FILTER */
+}
+
+static bool sm_guard_below_main(struct sm_table_ctx *ctx)
+{
+	return ctx->in->altitude < th.T_M;
+}
+
+static bool sm_guard_landed(struct sm_table_ctx *ctx)
+{
+	return fabs(ctx->in->velocity) <= (double)th.T_L;
+}
+
+#include "sm_table_gen.h"
+
+BUILD_ASSERT(SM_TABLE_NUM_RULES <= UINT8_MAX, "rule index must fit a uint8_t");
+
+/*-----------------------------------------------------------
+ * Internal State
+ *----------------------------------------------------------*/
+
+/** Dwell/timeout length in counter units, or the N of a count rule. */
+static uint64_t rule_limit[SM_TABLE_NUM_RULES];
+
+/** Counter value a dwell started at, or consecutive count so far. */
+static uint64_t rule_since[SM_TABLE_NUM_RULES];
+
+/** Set while a rule's dwell or count is in progress. */
+static bool rule_pending[SM_TABLE_NUM_RULES];
+
+static enum sm_state entered_state; /**< State the entry time belongs to. */
+static uint64_t entered_at;         /**< Counter value on entering it. */
+
+/*-----------------------------------------------------------
+ * Local Helpers
+ *----------------------------------------------------------*/
+
+/**
+ * @brief Free-running time base for dwells and timeouts.
+ *
+ * The 64-bit cycle counter when the timer driver has one, kernel ticks
+ * otherwise; either never wraps within a flight.
+ */
+static inline uint64_t sm_table_now(void)
+{
+#if defined(CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER)
+	return k_cycle_get_64();
+#else
+	return (uint64_t)k_uptime_ticks();
+#endif /* CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER */
+}
+
+static inline uint64_t sm_table_ms_to_units(uint32_t ms)
+{
+#if defined(CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER)
+	return k_ms_to_cyc_ceil64(ms);
+#else
+	return k_ms_to_ticks_ceil64(ms);
+#endif /* CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER */
+}
+
+static inline int th_field(uint16_t offset)
+{
+	int v;
+
+	memcpy(&v, (const uint8_t *)&th + offset, sizeof(v));
+	return v;
+}
+
+static void sm_table_enter(enum sm_state state, uint64_t now)
+{
+	entered_state = state;
+	entered_at = now;
+	memset(rule_pending, 0, sizeof(rule_pending));
+}
+
+/* sm_backend_stop_timers – see state_internal.h */
+void sm_backend_stop_timers(void)
+{
+	sm_table_enter(sm_get_state(), sm_table_now());
+}
+
+/*-----------------------------------------------------------
+ * Initialization / Deinitialization (see state_internal.h)
+ *----------------------------------------------------------*/
+
+/* sm_backend_init – see state_internal.h */
+void sm_backend_init(const struct sm_thresholds *cfg)
+{
+	th = *cfg;
+
+	for (size_t i = 0; i < SM_TABLE_NUM_RULES; i++) {
+		const struct sm_table_rule *r = &sm_table_rules[i];
+		const int v = r->timer != SM_TABLE_NONE ? th_field(r->threshold) : 0;
+
+		rule_limit[i] = r->timer == SM_TABLE_COUNT ?
+			(uint64_t)MAX(v, 1) : sm_table_ms_to_units((uint32_t)MAX(v, 0));
+	}
+
+	sm_table_enter(SM_IDLE, sm_table_now());
+}
+
+/* sm_backend_deinit – see state_internal.h */
+void sm_backend_deinit(void)
+{
+	memset(&th, 0, sizeof(th));
+	memset(rule_limit, 0, sizeof(rule_limit));
+	sm_backend_stop_timers();
+}
+
+/*-----------------------------------------------------------
+ * State Machine Update (see state_internal.h)
+ *----------------------------------------------------------*/
+
+/**
+ * @brief Confirm rule @p i's guard against its timer.
+ *
+ * @return true if the rule fires this step.
+ */
+static bool sm_table_confirm(size_t i, uint64_t now)
+{
+	const struct sm_table_rule *r = &sm_table_rules[i];
+
+	switch (r->timer) {
+	case SM_TABLE_DWELL:
+		if (!rule_pending[i]) {
+			rule_pending[i] = true;
+			rule_since[i] = now;
+			if (r->start_event != NULL) {
+				sm_event(r->start_event);
+			}
+			return rule_limit[i] == 0;
+		}
+		return now - rule_since[i] >= rule_limit[i];
+	case SM_TABLE_COUNT:
+		if (!rule_pending[i]) {
+			rule_pending[i] = true;
+			rule_since[i] = 0;
+		}
+		return ++rule_since[i] >= rule_limit[i];
+	case SM_TABLE_TIMEOUT:
+		return now - entered_at >= rule_limit[i];
+	default:
+		return true;
+	}
+}
+
+static void sm_table_fire(const struct sm_table_rule *r, uint64_t now)
+{
+	if (r->event != NULL) {
+		sm_event(r->event);
+	}
+
+	switch (r->action) {
+	case SM_TABLE_GOTO:
+		sm_transition(r->to);
+		break;
+	case SM_TABLE_ERROR:
+		sm_do_error_handling(r->reason);
+		break;
+	case SM_TABLE_RETRY:
+		sm_error_retry();
+		break;
+	}
+
+	/* The error path may have moved on to SM_IDLE as well. */
+	if (sm_get_state() != entered_state) {
+		sm_table_enter(sm_get_state(), now);
+	}
+}
+
+/**
+ * @brief Evaluate one rule range in priority order.
+ *
+ * @return true if a rule fired.
+ */
+static bool sm_table_eval(const struct sm_table_range *range,
+			  struct sm_table_ctx *ctx, uint64_t now)
+{
+	const uint32_t state_bit = BIT(sm_get_state());
+
+	for (size_t i = range->first; i < (size_t)range->first + range->count; i++) {
+		const struct sm_table_rule *r = &sm_table_rules[i];
+
+		if ((r->skip & state_bit) != 0U) {
+			continue;
+		}
+
+		if (r->guard != NULL && !r->guard(ctx)) {
+			if (rule_pending[i] && r->timer == SM_TABLE_DWELL) {
+				LOG_INF("%s: dwell reset, conditions not met",
+					sm_state_str(sm_get_state()));
+			}
+			rule_pending[i] = false;
+			continue;
+		}
+
+		if (sm_table_confirm(i, now)) {
+			rule_pending[i] = false;
+			sm_table_fire(r, now);
+			return true;
+		}
+
+		if (r->hold) {
+			break;
+		}
+	}
+
+	return false;
+}
+
+/* sm_backend_step – see state_internal.h */
+void sm_backend_step(const struct sm_inputs *in, double previous_altitude)
+{
+	const uint64_t now = sm_table_now();
+	struct sm_table_ctx ctx = {
+		.in = in,
+		.previous_altitude = previous_altitude,
+		.elevation = NAN,
+	};
+
+	/* Forced transitions and error recovery bypass this file. */
+	if (sm_get_state() != entered_state) {
+		sm_table_enter(sm_get_state(), now);
+	}
+
+	/* A global rule hands over to the new state within the same step. */
+	(void)sm_table_eval(&sm_table_global, &ctx, now);
+	(void)sm_table_eval(&sm_table_states[sm_get_state()], &ctx, now);
+}
+
+/*-----------------------------------------------------------
+ * Getters
+ *----------------------------------------------------------*/
+
+/* sm_get_type - see state.h */
+enum sm_type sm_get_type(void)
+{
+	return SM_TYPE_TABLE;
+}
+
+/* sm_state_str – see state.h */
+const char *sm_state_str(enum sm_state state)
+{
+	switch (state) {
+	case SM_IDLE:		return "IDLE";
+	case SM_ARMED:		return "ARMED";
+	case SM_BOOST:		return "BOOST";
+	case SM_BURNOUT:	return "BURNOUT";
+	case SM_APOGEE:		return "APOGEE";
+	case SM_MAIN:		return "MAIN";
+	case SM_REDUNDANT:	return "REDUNDANT";
+	case SM_LANDED:		return "LANDED";
+	case SM_ERROR:		return "ERROR";
+	default:		return "UNKNOWN";
+	}
+}
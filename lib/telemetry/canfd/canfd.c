@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * CAN-FD backend: SM snapshots from the telemetry dispatcher and the
+ * local imu_data_chan / baro_data_chan samples go out as 64-byte CAN FD
+ * frames (see canfd_internal.h for the layout), and frames from the
+ * other boards are republished on the remote_* zbus channels.
+ *
+ * Producers only fill a batch and queue a finished frame; one worker
+ * thread feeds the controller, urgent SM frames first.  Reception runs
+ * through a hardware ID filter into a message queue drained by a
+ * second thread, so neither direction ever blocks a sensor thread.
+ */
+
+#include <string.h>
+
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/can.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/zbus/zbus.h>
+
+#include <aurora/lib/telemetry.h>
+#include <aurora/lib/telemetry_canfd.h>
+
+#if defined(CONFIG_IMU) || defined(CONFIG_AURORA_TELEMETRY_CANFD_RX)
+#include <aurora/lib/imu.h>
+#endif
+#if defined(CONFIG_BARO) || defined(CONFIG_AURORA_TELEMETRY_CANFD_RX)
+#include <aurora/lib/baro.h>
+#endif
+
+#include "canfd_internal.h"
+
+LOG_MODULE_REGISTER(telemetry_canfd, CONFIG_AURORA_TELEMETRY_LOG_LEVEL);
+
+#define CANFD_NODE    CONFIG_AURORA_TELEMETRY_CANFD_NODE_ID
+#define CANFD_ID_BASE CONFIG_AURORA_TELEMETRY_CANFD_ID_BASE
+
+BUILD_ASSERT((CANFD_ID_BASE & ~CANFD_ID_BASE_MASK) == 0,
+	     "CONFIG_AURORA_TELEMETRY_CANFD_ID_BASE must be a multiple of 0x40");
+
+/* A frame that cannot get onto the bus in this long is dropped. */
+#define CANFD_TX_TIMEOUT K_MSEC(100)
+
+static const struct device *const can_dev =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_canbus));
+
+K_MSGQ_DEFINE(canfd_tx_msgq, sizeof(struct can_frame),
+	      CONFIG_AURORA_TELEMETRY_CANFD_QUEUE_DEPTH, 4);
+
+/* Urgent SM frames skip ahead of the routine queue. */
+K_MSGQ_DEFINE(canfd_prio_msgq, sizeof(struct can_frame),
+	      CONFIG_AURORA_TELEMETRY_CANFD_PRIO_QUEUE_DEPTH, 4);
+
+/* One count per frame in either queue. */
+static K_SEM_DEFINE(canfd_tx_avail, 0,
+		    CONFIG_AURORA_TELEMETRY_CANFD_QUEUE_DEPTH +
+		    CONFIG_AURORA_TELEMETRY_CANFD_PRIO_QUEUE_DEPTH);
+
+static atomic_t ready = ATOMIC_INIT(0);
+static atomic_t sm_seq;
+
+/* Queue one payload of @p kind. Never blocks. */
+static int canfd_queue(uint8_t kind, const uint8_t *payload, bool urgent)
+{
+	struct can_frame f = {
+		.id    = CANFD_ID(CANFD_ID_BASE, kind, CANFD_NODE),
+		.dlc   = can_bytes_to_dlc(CANFD_FRAME_LEN),
+		.flags = CAN_FRAME_FDF | CAN_FRAME_BRS,
+	};
+
+	memcpy(f.data, payload, CANFD_FRAME_LEN);
+	if (k_msgq_put(urgent ? &canfd_prio_msgq : &canfd_tx_msgq, &f,
+		       K_NO_WAIT) != 0) {
+		return -ENOMEM;
+	}
+	k_sem_give(&canfd_tx_avail);
+	return CANFD_FRAME_LEN;
+}
+
+static int canfd_send_sm_update(enum telemetry_class cls, enum sm_state state,
+				enum sm_type type,
+				const struct sm_inputs *inputs)
+{
+	uint8_t payload[CANFD_FRAME_LEN];
+
+	if (!atomic_get(&ready)) {
+		return -ENODEV;
+	}
+
+	canfd_sm_encode(payload, (uint8_t)atomic_inc(&sm_seq),
+			k_uptime_get_32(), state, type, inputs);
+	return canfd_queue(CANFD_KIND_SM, payload, TELEMETRY_CLASS_URGENT(cls));
+}
+
+#if defined(CONFIG_AURORA_TELEMETRY_CANFD_SAMPLES)
+
+#if defined(CONFIG_IMU)
+static struct canfd_batch imu_batch;
+static struct k_spinlock imu_lock;
+
+static void canfd_on_imu(const struct zbus_channel *chan)
+{
+	const struct imu_data *d = zbus_chan_const_msg(chan);
+	aurora_sample_t ch[CANFD_IMU_CHANNELS];
+	uint8_t frame[CANFD_FRAME_LEN];
+	size_t n = 0;
+
+	/* Frames carry no instance; redundant IMUs stay local. */
+	if (!atomic_get(&ready) || d->instance != 0) {
+		return;
+	}
+
+	for (int i = 0; i < IMU_NUM_AXES; i++) {
+		ch[i] = d->accel[i];
+		ch[IMU_NUM_AXES + i] = d->gyro[i];
+	}
+
+	K_SPINLOCK(&imu_lock) {
+		n = canfd_batch_add(&imu_batch, d->timestamp_ns, ch, frame);
+	}
+	if (n > 0) {
+		/* A full routine queue drops the batch, never an SM frame. */
+		(void)canfd_queue(CANFD_KIND_IMU, frame, false);
+	}
+}
+ZBUS_LISTENER_DEFINE(canfd_imu_lis, canfd_on_imu);
+ZBUS_CHAN_ADD_OBS(imu_data_chan, canfd_imu_lis, 5);
+#endif /* CONFIG_IMU */
+
+#if defined(CONFIG_BARO)
+static struct canfd_batch baro_batch;
+static struct k_spinlock baro_lock;
+
+static void canfd_on_baro(const struct zbus_channel *chan)
+{
+	const struct baro_data *d = zbus_chan_const_msg(chan);
+	const aurora_sample_t ch[CANFD_BARO_CHANNELS] = {
+		d->temperature, d->pressure,
+	};
+	uint8_t frame[CANFD_FRAME_LEN];
+	size_t n = 0;
+
+	if (!atomic_get(&ready) || d->instance != 0) {
+		return;
+	}
+
+	K_SPINLOCK(&baro_lock) {
+		n = canfd_batch_add(&baro_batch, d->timestamp_ns, ch, frame);
+	}
+	if (n > 0) {
+		(void)canfd_queue(CANFD_KIND_BARO, frame, false);
+	}
+}
+ZBUS_LISTENER_DEFINE(canfd_baro_lis, canfd_on_baro);
+ZBUS_CHAN_ADD_OBS(baro_data_chan, canfd_baro_lis, 5);
+#endif /* CONFIG_BARO */
+
+#endif /* CONFIG_AURORA_TELEMETRY_CANFD_SAMPLES */
+
+static void canfd_tx_task(void *, void *, void *)
+{
+	struct can_frame f;
+
+	while (1) {
+		(void)k_sem_take(&canfd_tx_avail, K_FOREVER);
+		if (k_msgq_get(&canfd_prio_msgq, &f, K_NO_WAIT) != 0 &&
+		    k_msgq_get(&canfd_tx_msgq, &f, K_NO_WAIT) != 0) {
+			continue;
+		}
+
+		int rc = can_send(can_dev, &f, CANFD_TX_TIMEOUT, NULL, NULL);
+
+		if (rc) {
+			LOG_WRN("can_send 0x%03x failed (%d), frame dropped",
+				f.id, rc);
+		}
+	}
+}
+
+K_THREAD_DEFINE(canfd_tx, CONFIG_AURORA_TELEMETRY_CANFD_STACK_SIZE,
+		canfd_tx_task, NULL, NULL, NULL,
+		CONFIG_AURORA_TELEMETRY_CANFD_THREAD_PRIORITY, 0, 0);
+
+#if defined(CONFIG_AURORA_TELEMETRY_CANFD_RX)
+
+ZBUS_CHAN_DEFINE(remote_sm_chan,
+		 struct telemetry_remote_sm,
+		 NULL,
+		 NULL,
+		 ZBUS_OBSERVERS_EMPTY,
+		 ZBUS_MSG_INIT(0));
+
+ZBUS_CHAN_DEFINE(remote_imu_data_chan,
+		 struct imu_data,
+		 NULL,
+		 NULL,
+		 ZBUS_OBSERVERS_EMPTY,
+		 ZBUS_MSG_INIT(0));
+
+ZBUS_CHAN_DEFINE(remote_baro_data_chan,
+		 struct baro_data,
+		 NULL,
+		 NULL,
+		 ZBUS_OBSERVERS_EMPTY,
+		 ZBUS_MSG_INIT(0));
+
+CAN_MSGQ_DEFINE(canfd_rx_msgq, CONFIG_AURORA_TELEMETRY_CANFD_RX_QUEUE_DEPTH);
+
+/* Local subscribers must not stall the bus reader for long. */
+#define CANFD_PUB_TIMEOUT K_MSEC(5)
+
+static void republish_imu(uint64_t timestamp_ns,
+			  const aurora_sample_t *ch, void *user_data)
+{
+	struct imu_data msg = { .timestamp_ns = timestamp_ns };
+
+	ARG_UNUSED(user_data);
+
+	for (int i = 0; i < IMU_NUM_AXES; i++) {
+		msg.accel[i] = ch[i];
+		msg.gyro[i]  = ch[IMU_NUM_AXES + i];
+	}
+	(void)zbus_chan_pub(&remote_imu_data_chan, &msg, CANFD_PUB_TIMEOUT);
+}
+
+static void republish_baro(uint64_t timestamp_ns,
+			   const aurora_sample_t *ch, void *user_data)
+{
+	const struct baro_data msg = {
+		.temperature  = ch[0],
+		.pressure     = ch[1],
+		.timestamp_ns = timestamp_ns,
+	};
+
+	ARG_UNUSED(user_data);
+
+	(void)zbus_chan_pub(&remote_baro_data_chan, &msg, CANFD_PUB_TIMEOUT);
+}
+
+static void canfd_rx_task(void *, void *, void *)
+{
+	struct can_frame f;
+
+	while (1) {
+		(void)k_msgq_get(&canfd_rx_msgq, &f, K_FOREVER);
+
+		/* Classic CAN frames on our IDs are not ours. */
+		if ((f.flags & CAN_FRAME_FDF) == 0 ||
+		    can_dlc_to_bytes(f.dlc) != CANFD_FRAME_LEN) {
+			continue;
+		}
+
+		switch (CANFD_ID_KIND(f.id)) {
+		case CANFD_KIND_SM: {
+			struct telemetry_remote_sm msg;
+
+			canfd_sm_decode(f.data, CANFD_ID_NODE(f.id), &msg);
+			(void)zbus_chan_pub(&remote_sm_chan, &msg,
+					    CANFD_PUB_TIMEOUT);
+			break;
+		}
+		case CANFD_KIND_IMU:
+			(void)canfd_samples_decode(f.data, CANFD_IMU_CHANNELS,
+						   republish_imu, NULL);
+			break;
+		case CANFD_KIND_BARO:
+			(void)canfd_samples_decode(f.data, CANFD_BARO_CHANNELS,
+						   republish_baro, NULL);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+K_THREAD_DEFINE(canfd_rx, CONFIG_AURORA_TELEMETRY_CANFD_STACK_SIZE,
+		canfd_rx_task, NULL, NULL, NULL,
+		CONFIG_AURORA_TELEMETRY_CANFD_THREAD_PRIORITY, 0, 0);
+
+/* Accept every kind from the configured peer, or from any node. */
+static int canfd_rx_start(void)
+{
+	const int peer = CONFIG_AURORA_TELEMETRY_CANFD_PEER_ID;
+	const struct can_filter filter = {
+		.id    = CANFD_ID_BASE | (peer >= 0 ? (uint32_t)peer : 0U),
+		.mask  = CANFD_ID_BASE_MASK | (peer >= 0 ? 0xFU : 0U),
+		.flags = 0,
+	};
+	int rc = can_add_rx_filter_msgq(can_dev, &canfd_rx_msgq, &filter);
+
+	if (rc < 0) {
+		LOG_ERR("RX filter on %s failed (%d)", can_dev->name, rc);
+		return rc;
+	}
+	return 0;
+}
+#else
+static inline int canfd_rx_start(void)
+{
+	return 0;
+}
+#endif /* CONFIG_AURORA_TELEMETRY_CANFD_RX */
+
+static int canfd_init(void)
+{
+	can_mode_t mode = CAN_MODE_FD;
+	int rc;
+
+	/* telemetry_init() may run again; the RX filter is added once. */
+	if (atomic_get(&ready)) {
+		return 0;
+	}
+
+	if (!device_is_ready(can_dev)) {
+		LOG_ERR("CAN %s not ready", can_dev->name);
+		return -ENODEV;
+	}
+
+	if (IS_ENABLED(CONFIG_AURORA_TELEMETRY_CANFD_LOOPBACK)) {
+		mode |= CAN_MODE_LOOPBACK;
+	}
+
+	/* Another user may already have started the controller. */
+	rc = can_set_mode(can_dev, mode);
+	if (rc != 0 && rc != -EBUSY) {
+		LOG_ERR("CAN %s has no FD mode (%d)", can_dev->name, rc);
+		return rc;
+	}
+
+	rc = canfd_rx_start();
+	if (rc != 0) {
+		return rc;
+	}
+
+	rc = can_start(can_dev);
+	if (rc != 0 && rc != -EALREADY) {
+		LOG_ERR("CAN %s start failed (%d)", can_dev->name, rc);
+		return rc;
+	}
+
+#if defined(CONFIG_AURORA_TELEMETRY_CANFD_SAMPLES)
+#if defined(CONFIG_IMU)
+	canfd_batch_init(&imu_batch, CANFD_IMU_CHANNELS,
+			 CONFIG_AURORA_TELEMETRY_CANFD_IMU_DECIMATION);
+#endif /* CONFIG_IMU */
+#if defined(CONFIG_BARO)
+	canfd_batch_init(&baro_batch, CANFD_BARO_CHANNELS,
+			 CONFIG_AURORA_TELEMETRY_CANFD_BARO_DECIMATION);
+#endif /* CONFIG_BARO */
+#endif /* CONFIG_AURORA_TELEMETRY_CANFD_SAMPLES */
+
+	atomic_set(&ready, 1);
+	LOG_INF("CAN-FD backend up on %s as node %d", can_dev->name,
+		CANFD_NODE);
+	return 0;
+}
+
+static const struct telemetry_backend_api canfd_api = {
+	.init           = canfd_init,
+	.send_sm_update = canfd_send_sm_update,
+};
+
+TELEMETRY_BACKEND_DEFINE_BUDGET(canfd, &canfd_api,
+				CONFIG_AURORA_TELEMETRY_CANFD_BUDGET_BPS);
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef AURORA_LIB_TELEMETRY_CANFD_INTERNAL_H_
+#define AURORA_LIB_TELEMETRY_CANFD_INTERNAL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/sys/util.h>
+
+#include <aurora/lib/sample.h>
+#include <aurora/lib/state/state.h>
+#include <aurora/lib/telemetry_canfd.h>
+
+/* Every frame is a full 64-byte CAN FD payload. */
+#define CANFD_FRAME_LEN 64
+
+/* Standard 11-bit identifier: base | kind << 4 | node. A lower kind
+ * wins arbitration, so SM snapshots go ahead of samples.
+ */
+#define CANFD_KIND_SM   0U
+#define CANFD_KIND_IMU  1U
+#define CANFD_KIND_BARO 2U
+
+#define CANFD_ID(base, kind, node) \
+	((uint32_t)(base) | ((uint32_t)(kind) << 4) | (uint32_t)(node))
+#define CANFD_ID_KIND(id) (((id) >> 4) & 0x3U)
+#define CANFD_ID_NODE(id) ((id) & 0xFU)
+
+/* Mask of the base bits an ID filter has to match. */
+#define CANFD_ID_BASE_MASK 0x7C0U
+
+/* Channels per sample record. */
+#define CANFD_IMU_CHANNELS  6 /**< accel x/y/z, then gyro x/y/z */
+#define CANFD_BARO_CHANNELS 2 /**< temperature, then pressure */
+
+/** @brief SM snapshot wire payload (little-endian, packed, 64 B).
+ *
+ * Same field order as the HC-12 SM_UPDATE payload; @c seq counts
+ * snapshots so the receiver can tell a lost frame.
+ */
+struct __packed canfd_sm_payload {
+	uint32_t timestamp_ms;
+	uint8_t  state;
+	uint8_t  armed;
+	uint8_t  sm_type;
+	uint8_t  seq;
+	double   altitude;
+	double   acceleration;
+	double   accel_vert;
+	double   velocity;
+	double   orientation[3];
+};
+
+BUILD_ASSERT(sizeof(struct canfd_sm_payload) == CANFD_FRAME_LEN,
+	     "SM snapshot must fill one CAN FD frame");
+
+/* Sample frame: header, then records of
+ *   u16 dt_us since base_ns
+ *   i32 channels[n], aurora_sample_t millionths as on the z-bus
+ * IMU frames hold two records, baro frames five.
+ */
+struct __packed canfd_samples_hdr {
+	uint64_t base_ns;
+	uint8_t  count;
+	uint8_t  seq;
+	uint16_t reserved;
+};
+
+#define CANFD_SAMPLES_HDR sizeof(struct canfd_samples_hdr)
+#define CANFD_SAMPLES_REC(channels) (2U + 4U * (channels))
+
+/** @brief Sender-side decimation and batching of one sample stream. */
+struct canfd_batch {
+	uint8_t  frame[CANFD_FRAME_LEN]; /**< Frame being filled. */
+	uint8_t  len;        /**< Bytes used, 0 = empty batch. */
+	uint8_t  channels;   /**< Channels per record. */
+	uint8_t  seq;        /**< Sequence number of the next frame. */
+	uint16_t decimation; /**< Keep every Nth sample. */
+	uint32_t seen;       /**< Decimation counter. */
+	uint64_t base_ns;    /**< Timestamp of the first record. */
+};
+
+/**
+ * @brief Start an empty batch.
+ *
+ * @param b           Batch state.
+ * @param channels    Channels per sample.
+ * @param decimation  Keep every Nth sample (1 = all).
+ */
+void canfd_batch_init(struct canfd_batch *b, uint8_t channels,
+		      uint16_t decimation);
+
+/**
+ * @brief Decimate one sample and append it to the batch.
+ *
+ * A batch is closed into @p frame as soon as no further record fits;
+ * a sample more than 65535 us after the batch's first one closes the
+ * batch first and starts the next one.
+ *
+ * @param b            Batch state.
+ * @param timestamp_ns Capture time of the sample.
+ * @param ch           @c b->channels readings.
+ * @param frame        Receives a closed batch, CANFD_FRAME_LEN bytes.
+ *
+ * @return CANFD_FRAME_LEN if @p frame holds a closed batch, else 0.
+ */
+size_t canfd_batch_add(struct canfd_batch *b, uint64_t timestamp_ns,
+		       const aurora_sample_t *ch, uint8_t *frame);
+
+/** @brief Called by canfd_samples_decode() for every record. */
+typedef void (*canfd_sample_cb_t)(uint64_t timestamp_ns,
+				  const aurora_sample_t *ch,
+				  void *user_data);
+
+/**
+ * @brief Walk the records of a received sample frame.
+ *
+ * @param frame     CANFD_FRAME_LEN bytes of payload.
+ * @param channels  Channels per record for the frame's kind.
+ * @param cb        Receives each record, oldest first.
+ * @param user_data Passed to @p cb.
+ *
+ * @return Number of records, or -EINVAL if the header's count does
+ *         not fit the frame.
+ */
+int canfd_samples_decode(const uint8_t *frame, uint8_t channels,
+			 canfd_sample_cb_t cb, void *user_data);
+
+/**
+ * @brief Encode one SM snapshot.
+ *
+ * @param frame   Receives CANFD_FRAME_LEN bytes.
+ * @param seq     Snapshot counter.
+ * @param ts_ms   Sender uptime.
+ * @param state   Current flight state.
+ * @param type    Active state machine implementation ID.
+ * @param inputs  SM inputs snapshot.
+ */
+void canfd_sm_encode(uint8_t *frame, uint8_t seq, uint32_t ts_ms,
+		     enum sm_state state, enum sm_type type,
+		     const struct sm_inputs *inputs);
+
+/**
+ * @brief Decode one SM snapshot received from @p node.
+ *
+ * @param frame  CANFD_FRAME_LEN bytes of payload.
+ * @param node   Sender, from the frame's identifier.
+ * @param out    Filled with the snapshot.
+ */
+void canfd_sm_decode(const uint8_t *frame, uint8_t node,
+		     struct telemetry_remote_sm *out);
+
+#endif /* AURORA_LIB_TELEMETRY_CANFD_INTERNAL_H_ */
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include "canfd_internal.h"
+
+BUILD_ASSERT(CANFD_SAMPLES_HDR == 12, "sample header layout changed");
+BUILD_ASSERT(CANFD_SAMPLES_HDR + 2 * CANFD_SAMPLES_REC(CANFD_IMU_CHANNELS) <=
+	     CANFD_FRAME_LEN, "an IMU frame must hold two records");
+
+void canfd_batch_init(struct canfd_batch *b, uint8_t channels,
+		      uint16_t decimation)
+{
+	memset(b, 0, sizeof(*b));
+	b->channels   = channels;
+	b->decimation = MAX(decimation, 1);
+}
+
+/* Finish the header and hand the frame over. */
+static size_t batch_close(struct canfd_batch *b, uint8_t *frame)
+{
+	const size_t rec = CANFD_SAMPLES_REC(b->channels);
+
+	sys_put_le64(b->base_ns, &b->frame[0]);
+	b->frame[8] = (uint8_t)((b->len - CANFD_SAMPLES_HDR) / rec);
+	b->frame[9] = b->seq++;
+	/* Unused tail bytes go out as zeros, not as an older batch. */
+	memset(&b->frame[b->len], 0, CANFD_FRAME_LEN - b->len);
+	memcpy(frame, b->frame, CANFD_FRAME_LEN);
+	b->len = 0;
+	return CANFD_FRAME_LEN;
+}
+
+size_t canfd_batch_add(struct canfd_batch *b, uint64_t timestamp_ns,
+		       const aurora_sample_t *ch, uint8_t *frame)
+{
+	const size_t rec = CANFD_SAMPLES_REC(b->channels);
+	size_t n = 0;
+
+	if (b->seen++ % b->decimation != 0) {
+		return 0;
+	}
+
+	if (b->len > 0 &&
+	    (timestamp_ns < b->base_ns ||
+	     (timestamp_ns - b->base_ns) / NSEC_PER_USEC > UINT16_MAX)) {
+		n = batch_close(b, frame);
+	}
+
+	if (b->len == 0) {
+		b->base_ns = timestamp_ns;
+		b->len = CANFD_SAMPLES_HDR;
+	}
+
+	uint8_t *p = &b->frame[b->len];
+
+	sys_put_le16((uint16_t)((timestamp_ns - b->base_ns) / NSEC_PER_USEC), p);
+	for (uint8_t i = 0; i < b->channels; i++) {
+		sys_put_le32((uint32_t)ch[i], &p[2U + 4U * i]);
+	}
+	b->len += rec;
+
+	/* Close at once when full rather than on the next sample. */
+	if (n == 0 && b->len + rec > CANFD_FRAME_LEN) {
+		n = batch_close(b, frame);
+	}
+	return n;
+}
+
+int canfd_samples_decode(const uint8_t *frame, uint8_t channels,
+			 canfd_sample_cb_t cb, void *user_data)
+{
+	const size_t rec = CANFD_SAMPLES_REC(channels);
+	const uint64_t base_ns = sys_get_le64(&frame[0]);
+	const uint8_t count = frame[8];
+	aurora_sample_t ch[CANFD_IMU_CHANNELS];
+
+	if (channels > ARRAY_SIZE(ch) ||
+	    CANFD_SAMPLES_HDR + (size_t)count * rec > CANFD_FRAME_LEN) {
+		return -EINVAL;
+	}
+
+	for (uint8_t r = 0; r < count; r++) {
+		const uint8_t *p = &frame[CANFD_SAMPLES_HDR + r * rec];
+
+		for (uint8_t i = 0; i < channels; i++) {
+			ch[i] = (aurora_sample_t)sys_get_le32(&p[2U + 4U * i]);
+		}
+		cb(base_ns + (uint64_t)sys_get_le16(p) * NSEC_PER_USEC, ch,
+		   user_data);
+	}
+	return count;
+}
+
+void canfd_sm_encode(uint8_t *frame, uint8_t seq, uint32_t ts_ms,
+		     enum sm_state state, enum sm_type type,
+		     const struct sm_inputs *inputs)
+{
+	const struct canfd_sm_payload p = {
+		.timestamp_ms = sys_cpu_to_le32(ts_ms),
+		.state        = (uint8_t)state,
+		.armed        = inputs->armed ? 1 : 0,
+		.sm_type      = (uint8_t)type,
+		.seq          = seq,
+		.altitude     = inputs->altitude,
+		.acceleration = inputs->acceleration,
+		.accel_vert   = inputs->accel_vert,
+		.velocity     = inputs->velocity,
+		.orientation  = {
+			inputs->orientation[0],
+			inputs->orientation[1],
+			inputs->orientation[2],
+		},
+	};
+
+	memcpy(frame, &p, sizeof(p));
+}
+
+void canfd_sm_decode(const uint8_t *frame, uint8_t node,
+		     struct telemetry_remote_sm *out)
+{
+	struct canfd_sm_payload p;
+
+	memcpy(&p, frame, sizeof(p));
+	*out = (struct telemetry_remote_sm){
+		.node         = node,
+		.seq          = p.seq,
+		.state        = (enum sm_state)p.state,
+		.type         = (enum sm_type)p.sm_type,
+		.timestamp_ms = sys_le32_to_cpu(p.timestamp_ms),
+		.inputs = {
+			.armed        = p.armed,
+			.altitude     = p.altitude,
+			.acceleration = p.acceleration,
+			.accel_vert   = p.accel_vert,
+			.velocity     = p.velocity,
+			.orientation  = {
+				p.orientation[0],
+				p.orientation[1],
+				p.orientation[2],
+			},
+		},
+	};
+}
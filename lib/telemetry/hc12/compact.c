@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <math.h>
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+
+#include "hc12_internal.h"
+
+BUILD_ASSERT(sizeof(struct hc12_sm_key_payload) == 24,
+	     "SM_KEY payload size is part of the wire format");
+BUILD_ASSERT(sizeof(struct hc12_sm_delta_payload) == 18,
+	     "SM_DELTA payload size is part of the wire format");
+
+static int16_t to_q16(double v, double scale)
+{
+	const double r = round(v * scale);
+
+	if (!(r > INT16_MIN)) {
+		/* Also catches NaN. */
+		return r < 0.0 ? INT16_MIN : 0;
+	}
+	if (r > INT16_MAX) {
+		return INT16_MAX;
+	}
+	return (int16_t)r;
+}
+
+static int32_t to_q32(double v, double scale)
+{
+	const double r = round(v * scale);
+
+	if (!(r > INT32_MIN)) {
+		return r < 0.0 ? INT32_MIN : 0;
+	}
+	if (r > INT32_MAX) {
+		return INT32_MAX;
+	}
+	return (int32_t)r;
+}
+
+void hc12_compact_reset(struct hc12_compact_enc *enc)
+{
+	enc->since_key = 0;
+	enc->need_key = true;
+}
+
+size_t hc12_compact_encode(struct hc12_compact_enc *enc,
+			   uint8_t *buf, size_t buf_sz,
+			   uint8_t key_interval, uint32_t ts_ms,
+			   enum sm_state state, enum sm_type type,
+			   const struct sm_inputs *inputs)
+{
+	const int32_t altitude = to_q32(inputs->altitude, HC12_COMPACT_ALT_SCALE);
+	const int64_t d_alt = (int64_t)altitude - enc->altitude;
+	const uint32_t dt_ms = ts_ms - enc->last_ms;
+	size_t n;
+
+	if (enc->need_key || enc->since_key + 1 >= key_interval ||
+	    dt_ms > UINT16_MAX || d_alt < INT16_MIN || d_alt > INT16_MAX) {
+		struct hc12_sm_key_payload k = {
+			.timestamp_ms = ts_ms,
+			.state        = (uint8_t)state,
+			.armed        = inputs->armed ? 1 : 0,
+			.sm_type      = (uint8_t)type,
+			.seq          = enc->seq,
+			.altitude     = altitude,
+			.acceleration = to_q16(inputs->acceleration, HC12_COMPACT_ACCEL_SCALE),
+			.accel_vert   = to_q16(inputs->accel_vert, HC12_COMPACT_ACCEL_SCALE),
+			.velocity     = to_q16(inputs->velocity, HC12_COMPACT_VEL_SCALE),
+			.orientation  = {
+				to_q16(inputs->orientation[0], HC12_COMPACT_ORIENT_SCALE),
+				to_q16(inputs->orientation[1], HC12_COMPACT_ORIENT_SCALE),
+				to_q16(inputs->orientation[2], HC12_COMPACT_ORIENT_SCALE),
+			},
+		};
+
+		n = hc12_frame_finalise(buf, buf_sz, HC12_TYPE_SM_KEY, &k,
+					(uint8_t)sizeof(k));
+		if (n == 0) {
+			return 0;
+		}
+		enc->since_key = 0;
+		enc->need_key = false;
+	} else {
+		struct hc12_sm_delta_payload d = {
+			.seq          = enc->seq,
+			.state        = (uint8_t)state |
+					(inputs->armed ? HC12_COMPACT_ARMED : 0),
+			.dt_ms        = (uint16_t)dt_ms,
+			.d_altitude   = (int16_t)d_alt,
+			.acceleration = to_q16(inputs->acceleration, HC12_COMPACT_ACCEL_SCALE),
+			.accel_vert   = to_q16(inputs->accel_vert, HC12_COMPACT_ACCEL_SCALE),
+			.velocity     = to_q16(inputs->velocity, HC12_COMPACT_VEL_SCALE),
+			.orientation  = {
+				to_q16(inputs->orientation[0], HC12_COMPACT_ORIENT_SCALE),
+				to_q16(inputs->orientation[1], HC12_COMPACT_ORIENT_SCALE),
+				to_q16(inputs->orientation[2], HC12_COMPACT_ORIENT_SCALE),
+			},
+		};
+
+		n = hc12_frame_finalise(buf, buf_sz, HC12_TYPE_SM_DELTA, &d,
+					(uint8_t)sizeof(d));
+		if (n == 0) {
+			return 0;
+		}
+		enc->since_key++;
+	}
+
+	enc->last_ms = ts_ms;
+	enc->altitude = altitude;
+	enc->seq++;
+	return n;
+}
@@ -45,7 +45,12 @@ K_MUTEX_DEFINE(hc12_uart_lock);
 #define HC12_HDR    4
 #define HC12_CRC    2
 
+#if defined(CONFIG_AURORA_TELEMETRY_HC12_SAMPLES)
+#define MAX_PAYLOAD MAX(sizeof(struct hc12_sm_update_payload), \
+			CONFIG_AURORA_TELEMETRY_HC12_SAMPLES_PAYLOAD)
+#else
 #define MAX_PAYLOAD sizeof(struct hc12_sm_update_payload)
+#endif /* CONFIG_AURORA_TELEMETRY_HC12_SAMPLES */
 #define MAX_FRAME   (HC12_HDR + MAX_PAYLOAD + HC12_CRC)
 
 struct hc12_frame {
@@ -56,6 +61,17 @@ struct hc12_frame {
 K_MSGQ_DEFINE(tx_msgq, sizeof(struct hc12_frame),
 	      CONFIG_AURORA_TELEMETRY_HC12_QUEUE_DEPTH, 4);
 
+/* Urgent frames (transitions, events) skip ahead of the routine queue
+ * and never compete with it for space.
+ */
+K_MSGQ_DEFINE(prio_msgq, sizeof(struct hc12_frame),
+	      CONFIG_AURORA_TELEMETRY_HC12_PRIO_QUEUE_DEPTH, 4);
+
+/* One count per frame in either queue. */
+static K_SEM_DEFINE(tx_avail, 0,
+		    CONFIG_AURORA_TELEMETRY_HC12_QUEUE_DEPTH +
+		    CONFIG_AURORA_TELEMETRY_HC12_PRIO_QUEUE_DEPTH);
+
 static atomic_t ready = ATOMIC_INIT(0);
 
 size_t hc12_frame_finalise(uint8_t *buf, size_t buf_sz, uint8_t type,
@@ -80,9 +96,23 @@ size_t hc12_frame_finalise(uint8_t *buf, size_t buf_sz, uint8_t type,
 	return total;
 }
 
-static int hc12_send_sm_update(enum sm_state state, enum sm_type type,
-			       const struct sm_inputs *inputs)
+/* Next frame to send, urgent first. Blocks up to @p timeout. */
+static int hc12_next_frame(struct hc12_frame *f, k_timeout_t timeout)
+{
+	if (k_sem_take(&tx_avail, timeout) != 0) {
+		return -EAGAIN;
+	}
+	if (k_msgq_get(&prio_msgq, f, K_NO_WAIT) == 0) {
+		return 0;
+	}
+	return k_msgq_get(&tx_msgq, f, K_NO_WAIT);
+}
+
+static int hc12_send_sm_update(enum telemetry_class cls, enum sm_state state,
+			       enum sm_type type, const struct sm_inputs *inputs)
 {
+	const bool urgent = TELEMETRY_CLASS_URGENT(cls);
+
 	if (!atomic_get(&ready)) {
 		return -ENODEV;
 	}
@@ -93,7 +123,8 @@ static int hc12_send_sm_update(enum sm_state state, enum sm_type type,
 
 	int64_t now_ms = k_uptime_get();
 	k_spinlock_key_t key = k_spin_lock(&rl_lock);
-	if (now_ms - last_send_ms <
+	/* Urgent frames are never throttled but still restart the window. */
+	if (!urgent && now_ms - last_send_ms <
 	    CONFIG_AURORA_TELEMETRY_HC12_MIN_INTERVAL_MS) {
 		k_spin_unlock(&rl_lock, key);
 		return -EAGAIN;
@@ -102,6 +133,29 @@ static int hc12_send_sm_update(enum sm_state state, enum sm_type type,
 	k_spin_unlock(&rl_lock, key);
 #endif
 
+	struct hc12_frame f;
+
+#if defined(CONFIG_AURORA_TELEMETRY_HC12_COMPACT)
+	static struct hc12_compact_enc enc = { .need_key = true };
+	static struct k_spinlock enc_lock;
+
+	k_spinlock_key_t enc_key = k_spin_lock(&enc_lock);
+	if (urgent) {
+		/* Self-contained, so it decodes even after a lost delta. */
+		hc12_compact_reset(&enc);
+	}
+	size_t n = hc12_compact_encode(&enc, f.buf, sizeof(f.buf),
+				       CONFIG_AURORA_TELEMETRY_HC12_KEYFRAME_INTERVAL,
+				       (uint32_t)k_uptime_get(), state, type,
+				       inputs);
+	if (urgent) {
+		/* This key overtakes queued deltas, which the receiver then
+		 * rejects as out of sequence: rebase on another key.
+		 */
+		hc12_compact_reset(&enc);
+	}
+	k_spin_unlock(&enc_lock, enc_key);
+#else
 	struct hc12_sm_update_payload p = {
 		.timestamp_ms = (uint32_t)k_uptime_get(),
 		.state        = (uint8_t)state,
@@ -118,24 +172,115 @@ static int hc12_send_sm_update(enum sm_state state, enum sm_type type,
 		},
 	};
 
-	struct hc12_frame f;
 	size_t n = hc12_frame_finalise(f.buf, sizeof(f.buf),
 				       HC12_TYPE_SM_UPDATE, &p,
 				       (uint8_t)sizeof(p));
+#endif /* CONFIG_AURORA_TELEMETRY_HC12_COMPACT */
 	f.len = (uint8_t)n;
 
+	if (k_msgq_put(urgent ? &prio_msgq : &tx_msgq, &f, K_NO_WAIT) != 0) {
+#if defined(CONFIG_AURORA_TELEMETRY_HC12_COMPACT)
+		/* The receiver never sees this frame: resync on a key. */
+		enc_key = k_spin_lock(&enc_lock);
+		hc12_compact_reset(&enc);
+		k_spin_unlock(&enc_lock, enc_key);
+#endif /* CONFIG_AURORA_TELEMETRY_HC12_COMPACT */
+		return -ENOMEM;
+	}
+	k_sem_give(&tx_avail);
+	return (int)n;
+}
+
+#if defined(CONFIG_AURORA_TELEMETRY_HC12_SAMPLES)
+static int hc12_send_samples(uint8_t type, uint64_t timestamp_ns,
+			     const struct sensor_value *channels,
+			     uint8_t channel_count)
+{
+	static struct hc12_samples_batch batch;
+	static bool batch_init;
+	static struct k_spinlock batch_lock;
+	struct hc12_frame f;
+
+	if (!atomic_get(&ready)) {
+		return -ENODEV;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&batch_lock);
+	if (!batch_init) {
+		hc12_samples_init(&batch,
+				  CONFIG_AURORA_TELEMETRY_HC12_SAMPLES_DECIMATION,
+				  CONFIG_AURORA_TELEMETRY_HC12_SAMPLES_MAX_AGE_MS);
+		batch_init = true;
+	}
+	size_t n = hc12_samples_add(&batch, type, timestamp_ns, channels,
+				    channel_count, f.buf, sizeof(f.buf));
+	k_spin_unlock(&batch_lock, key);
+
+	if (n == 0) {
+		return 0;
+	}
+	f.len = (uint8_t)n;
+	/* Routine queue: a full queue drops the batch, never an SM frame. */
 	if (k_msgq_put(&tx_msgq, &f, K_NO_WAIT) != 0) {
 		return -ENOMEM;
 	}
-	return 0;
+	k_sem_give(&tx_avail);
+	return (int)n;
+}
+#endif /* CONFIG_AURORA_TELEMETRY_HC12_SAMPLES */
+
+#if defined(CONFIG_AURORA_TELEMETRY_HC12_ASYNC_TX)
+/* Two static frame buffers: the UART (DMA or TX IRQ) sends one while
+ * the worker dequeues the next, so back-to-back frames leave the line
+ * idle only for a context switch. Static so DMA can reach them.
+ */
+static struct hc12_frame tx_buf[2];
+static K_SEM_DEFINE(tx_done, 0, 1);
+
+/* Set by hc12_init() once the driver accepted our callback; drivers
+ * without the async API keep the uart_poll_out() path.
+ */
+static bool async_tx;
+
+/* Longest frame at 1200 baud is ~600 ms; anything past this is a stuck
+ * transfer, not a slow line.
+ */
+#define HC12_TX_TIMEOUT K_SECONDS(1)
+
+static void hc12_uart_cb(const struct device *dev, struct uart_event *evt,
+			 void *user_data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(user_data);
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+		k_sem_give(&tx_done);
+		break;
+	default:
+		break;
+	}
+}
+#endif /* CONFIG_AURORA_TELEMETRY_HC12_ASYNC_TX */
+
+static void hc12_tx_poll(const struct hc12_frame *f)
+{
+	for (uint8_t i = 0; i < f->len; i++) {
+		uart_poll_out(hc12_uart_dev, f->buf[i]);
+	}
 }
 
 static void hc12_tx_task(void *, void *, void *)
 {
-	struct hc12_frame f;
+#if defined(CONFIG_AURORA_TELEMETRY_HC12_ASYNC_TX)
+	uint8_t cur = 0;
+	bool pending = false;
 
 	while (1) {
-		(void)k_msgq_get(&tx_msgq, &f, K_FOREVER);
+		if (!pending && hc12_next_frame(&tx_buf[cur], K_FOREVER) != 0) {
+			continue;
+		}
 
 		/* Hold the UART lock for the whole frame: an in-flight
 		 * AT exchange has reconfigured the line to 9600 baud
@@ -143,11 +288,55 @@ static void hc12_tx_task(void *, void *, void *)
 		 * both the frame and the AT command.
 		 */
 		k_mutex_lock(&hc12_uart_lock, K_FOREVER);
-		for (uint8_t i = 0; i < f.len; i++) {
-			uart_poll_out(hc12_uart_dev, f.buf[i]);
+		if (!async_tx) {
+			hc12_tx_poll(&tx_buf[cur]);
+			k_mutex_unlock(&hc12_uart_lock);
+			pending = false;
+			continue;
 		}
+
+		/* Drop a late completion from an earlier aborted frame. */
+		k_sem_reset(&tx_done);
+		int rc = uart_tx(hc12_uart_dev, tx_buf[cur].buf,
+				 tx_buf[cur].len, SYS_FOREVER_US);
+
+		/* Fetch the next frame while this one is on the wire. */
+		pending = hc12_next_frame(&tx_buf[cur ^ 1], K_NO_WAIT) == 0;
+
+		if (rc == 0 && k_sem_take(&tx_done, HC12_TX_TIMEOUT) != 0) {
+			(void)uart_tx_abort(hc12_uart_dev);
+			/* Wait for the UART_TX_ABORTED the abort raises. */
+			(void)k_sem_take(&tx_done, HC12_TX_TIMEOUT);
+			rc = -ETIMEDOUT;
+		}
+		/* Unlock between frames so a waiting AT exchange gets
+		 * the line before the next one starts.
+		 */
+		k_mutex_unlock(&hc12_uart_lock);
+
+		if (rc) {
+			LOG_WRN("uart_tx failed (%d), frame dropped", rc);
+		}
+		cur ^= 1;
+	}
+#else
+	struct hc12_frame f;
+
+	while (1) {
+		if (hc12_next_frame(&f, K_FOREVER) != 0) {
+			continue;
+		}
+
+		/* Hold the UART lock for the whole frame: an in-flight
+		 * AT exchange has reconfigured the line to 9600 baud
+		 * and pulled SET low, so writing here would garble
+		 * both the frame and the AT command.
+		 */
+		k_mutex_lock(&hc12_uart_lock, K_FOREVER);
+		hc12_tx_poll(&f);
 		k_mutex_unlock(&hc12_uart_lock);
 	}
+#endif /* CONFIG_AURORA_TELEMETRY_HC12_ASYNC_TX */
 }
 
 K_THREAD_DEFINE(hc12_tx, CONFIG_AURORA_TELEMETRY_HC12_STACK_SIZE,
@@ -177,6 +366,16 @@ static int hc12_init(void)
 		LOG_INF("HC-12 SET pin not wired: runtime AT disabled");
 	}
 
+#if defined(CONFIG_AURORA_TELEMETRY_HC12_ASYNC_TX)
+	int cb_rc = uart_callback_set(hc12_uart_dev, hc12_uart_cb, NULL);
+	if (cb_rc == 0) {
+		async_tx = true;
+	} else {
+		LOG_WRN("UART %s has no async API (%d), polling TX",
+			hc12_uart_dev->name, cb_rc);
+	}
+#endif /* CONFIG_AURORA_TELEMETRY_HC12_ASYNC_TX */
+
 	atomic_set(&ready, 1);
 	LOG_INF("HC-12 backend up on %s", hc12_uart_dev->name);
 	return 0;
@@ -185,6 +384,10 @@ static int hc12_init(void)
 static const struct telemetry_backend_api hc12_api = {
 	.init           = hc12_init,
 	.send_sm_update = hc12_send_sm_update,
+#if defined(CONFIG_AURORA_TELEMETRY_HC12_SAMPLES)
+	.send_samples   = hc12_send_samples,
+#endif /* CONFIG_AURORA_TELEMETRY_HC12_SAMPLES */
 };
 
-TELEMETRY_BACKEND_DEFINE(hc12, &hc12_api);
+TELEMETRY_BACKEND_DEFINE_BUDGET(hc12, &hc12_api,
+				CONFIG_AURORA_TELEMETRY_HC12_BUDGET_BPS);
@@ -6,11 +6,16 @@
 #ifndef AURORA_LIB_TELEMETRY_HC12_INTERNAL_H_
 #define AURORA_LIB_TELEMETRY_HC12_INTERNAL_H_
 
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include <zephyr/device.h>
+#include <zephyr/drivers/sensor.h>
 #include <zephyr/kernel.h>
 
+#include <aurora/lib/state/state.h>
+
 /* The HC-12 always speaks 9600 baud while SET is held low, regardless
  * of the configured air-side rate. The AT helper switches the host
  * UART to this rate for the duration of an exchange and restores the
@@ -23,6 +28,9 @@
 
 /* Wire frame packet types. */
 #define HC12_TYPE_SM_UPDATE 0x01
+#define HC12_TYPE_SM_KEY    0x02
+#define HC12_TYPE_SM_DELTA  0x03
+#define HC12_TYPE_SAMPLES   0x04
 
 /** @brief HC-12 SM_UPDATE wire payload (little-endian, packed, 64 B).
  *
@@ -44,6 +52,143 @@ struct __packed hc12_sm_update_payload {
 	double   orientation[3];
 };
 
+/* Fixed-point scales of the compact frames (value = raw / scale). */
+#define HC12_COMPACT_ALT_SCALE    100 /**< altitude: cm */
+#define HC12_COMPACT_ACCEL_SCALE  100 /**< accelerations: 0.01 m/s^2 */
+#define HC12_COMPACT_VEL_SCALE    10  /**< velocity: 0.1 m/s */
+#define HC12_COMPACT_ORIENT_SCALE 100 /**< orientation: 0.01 deg */
+
+/* Bit 7 of the delta frame's state byte carries the armed flag. */
+#define HC12_COMPACT_ARMED BIT(7)
+
+/** @brief HC-12 SM_KEY wire payload (little-endian, packed, 24 B).
+ *
+ * Self-contained compact snapshot. Receivers resynchronise on it and
+ * apply the following SM_DELTA frames on top. Fields beyond their
+ * int16 range saturate.
+ */
+struct __packed hc12_sm_key_payload {
+	uint32_t timestamp_ms;
+	uint8_t  state;
+	uint8_t  armed;
+	uint8_t  sm_type;
+	uint8_t  seq;
+	int32_t  altitude;
+	int16_t  acceleration;
+	int16_t  accel_vert;
+	int16_t  velocity;
+	int16_t  orientation[3];
+};
+
+/** @brief HC-12 SM_DELTA wire payload (little-endian, packed, 18 B).
+ *
+ * Time and altitude are deltas against the previous frame, the rest
+ * is absolute. Only valid when @c seq follows the previous frame's
+ * sequence number; on a gap the receiver waits for the next SM_KEY.
+ */
+struct __packed hc12_sm_delta_payload {
+	uint8_t  seq;
+	uint8_t  state;
+	uint16_t dt_ms;
+	int16_t  d_altitude;
+	int16_t  acceleration;
+	int16_t  accel_vert;
+	int16_t  velocity;
+	int16_t  orientation[3];
+};
+
+/** @brief Sender-side state of the compact SM frame encoder. */
+struct hc12_compact_enc {
+	uint32_t last_ms;     /**< Timestamp of the previous frame. */
+	int32_t  altitude;    /**< Altitude the receiver holds (cm). */
+	uint8_t  seq;         /**< Sequence number of the next frame. */
+	uint8_t  since_key;   /**< Delta frames since the last key frame. */
+	bool     need_key;    /**< Force a key frame next. */
+};
+
+/**
+ * @brief Reset @p enc so the next frame is a key frame.
+ *
+ * @param enc Encoder state.
+ */
+void hc12_compact_reset(struct hc12_compact_enc *enc);
+
+/**
+ * @brief Encode one SM update as a complete compact wire frame.
+ *
+ * Emits an SM_KEY frame on the first call after hc12_compact_reset(),
+ * every @p key_interval frames, and whenever the time or altitude step
+ * does not fit a delta. Otherwise emits an SM_DELTA frame. Call
+ * hc12_compact_reset() when a frame is dropped before reaching the
+ * UART so the receiver is not left applying deltas to a stale base.
+ *
+ * @param enc          Encoder state.
+ * @param buf          Output buffer, see hc12_frame_finalise().
+ * @param buf_sz       Size of @p buf in bytes.
+ * @param key_interval Frames per key frame (1 = key frames only).
+ * @param ts_ms        Frame timestamp (ms).
+ * @param state        Current flight state.
+ * @param type         Active state machine implementation ID.
+ * @param inputs       SM inputs snapshot.
+ *
+ * @return Total frame length written, or 0 if @p buf is too small.
+ */
+size_t hc12_compact_encode(struct hc12_compact_enc *enc,
+			   uint8_t *buf, size_t buf_sz,
+			   uint8_t key_interval, uint32_t ts_ms,
+			   enum sm_state state, enum sm_type type,
+			   const struct sm_inputs *inputs);
+
+#if defined(CONFIG_AURORA_TELEMETRY_HC12_SAMPLES)
+
+/* SAMPLES payload: u32 base_ms, then records of
+ *   u8  type | (channel_count << 6)
+ *   u16 dt_ms since base_ms
+ *   f32 channels[channel_count]
+ */
+#define HC12_SAMPLES_HDR        4
+#define HC12_SAMPLES_REC_HDR    3
+#define HC12_SAMPLES_MAX_CHANS  3
+#define HC12_SAMPLES_MAX_TYPES  64
+
+/** @brief Sender-side decimation and batching of raw samples. */
+struct hc12_samples_batch {
+	uint8_t  payload[CONFIG_AURORA_TELEMETRY_HC12_SAMPLES_PAYLOAD];
+	uint8_t  len;        /**< Payload bytes used, 0 = empty batch. */
+	uint32_t base_ms;    /**< Timestamp of the first record. */
+	uint16_t decimation; /**< Keep every Nth sample of each type. */
+	uint16_t max_age_ms; /**< Flush once a batch spans this long. */
+	uint16_t seen[HC12_SAMPLES_MAX_TYPES]; /**< Decimation counters. */
+};
+
+/**
+ * @brief Start an empty batch.
+ *
+ * @param b           Batch state.
+ * @param decimation  Keep every Nth sample of each type (1 = all).
+ * @param max_age_ms  Close a batch once its records span this long.
+ */
+void hc12_samples_init(struct hc12_samples_batch *b, uint16_t decimation,
+		       uint16_t max_age_ms);
+
+/**
+ * @brief Decimate one sample and append it to the batch.
+ *
+ * When the sample does not fit the current batch (payload full, time
+ * span too long for @c dt_ms, or older than @c max_age_ms), the batch
+ * is closed into a SAMPLES frame in @p frame first and the sample
+ * starts the next one.
+ *
+ * @return Length of the frame written to @p frame, or 0 if none.
+ */
+size_t hc12_samples_add(struct hc12_samples_batch *b, uint8_t type,
+			uint64_t timestamp_ns,
+			const struct sensor_value *channels,
+			uint8_t channel_count,
+			uint8_t *frame, size_t frame_sz);
+
+#endif /* CONFIG_AURORA_TELEMETRY_HC12_SAMPLES */
+
 /**
  * @brief Build a complete HC-12 wire frame in @p buf.
  *
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "hc12_internal.h"
+
+BUILD_ASSERT(CONFIG_AURORA_TELEMETRY_HC12_SAMPLES_PAYLOAD >=
+	     HC12_SAMPLES_HDR + HC12_SAMPLES_REC_HDR + 4 * HC12_SAMPLES_MAX_CHANS,
+	     "SAMPLES payload must hold at least one full record");
+
+void hc12_samples_init(struct hc12_samples_batch *b, uint16_t decimation,
+		       uint16_t max_age_ms)
+{
+	memset(b, 0, sizeof(*b));
+	b->decimation = MAX(decimation, 1);
+	b->max_age_ms = max_age_ms;
+}
+
+static size_t samples_flush(struct hc12_samples_batch *b,
+			    uint8_t *frame, size_t frame_sz)
+{
+	size_t n = hc12_frame_finalise(frame, frame_sz, HC12_TYPE_SAMPLES,
+				       b->payload, b->len);
+
+	b->len = 0;
+	return n;
+}
+
+size_t hc12_samples_add(struct hc12_samples_batch *b, uint8_t type,
+			uint64_t timestamp_ns,
+			const struct sensor_value *channels,
+			uint8_t channel_count,
+			uint8_t *frame, size_t frame_sz)
+{
+	const uint32_t ts_ms = (uint32_t)(timestamp_ns / 1000000ULL);
+	size_t n = 0;
+
+	if (type >= HC12_SAMPLES_MAX_TYPES || !channels) {
+		return 0;
+	}
+	channel_count = MIN(channel_count, HC12_SAMPLES_MAX_CHANS);
+
+	/* Per-type decimation: keep the first of every N. */
+	if (b->seen[type]++ % b->decimation != 0) {
+		return 0;
+	}
+
+	const size_t rec = HC12_SAMPLES_REC_HDR + 4U * channel_count;
+
+	if (b->len > 0) {
+		const uint32_t dt = ts_ms - b->base_ms;
+
+		if (b->len + rec > sizeof(b->payload) || dt > UINT16_MAX ||
+		    dt >= b->max_age_ms) {
+			n = samples_flush(b, frame, frame_sz);
+		}
+	}
+
+	if (b->len == 0) {
+		b->base_ms = ts_ms;
+		sys_put_le32(ts_ms, b->payload);
+		b->len = HC12_SAMPLES_HDR;
+	}
+
+	uint8_t *p = &b->payload[b->len];
+
+	p[0] = type | (uint8_t)(channel_count << 6);
+	sys_put_le16((uint16_t)(ts_ms - b->base_ms), &p[1]);
+	for (uint8_t i = 0; i < channel_count; i++) {
+		const float v = (float)sensor_value_to_double(&channels[i]);
+
+		memcpy(&p[HC12_SAMPLES_REC_HDR + 4U * i], &v, sizeof(v));
+	}
+	b->len += rec;
+
+	return n;
+}
@@ -3,13 +3,24 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <errno.h>
+
+#include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/spinlock.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/util.h>
 
 #include <aurora/lib/telemetry.h>
 
 LOG_MODULE_REGISTER(telemetry, CONFIG_AURORA_TELEMETRY_LOG_LEVEL);
 
+/* Guards every backend's token bucket and the transition tracker. */
+static struct k_spinlock sched_lock;
+
+static bool have_last_state;
+static enum sm_state last_state;
+
 int telemetry_init(void)
 {
 	int rc = 0;
@@ -29,19 +40,151 @@ int telemetry_init(void)
 	return rc;
 }
 
-int telemetry_send_sm_update(enum sm_state state, enum sm_type type,
-			     const struct sm_inputs *inputs)
+static int32_t budget_capacity(const struct telemetry_backend *backend)
+{
+	return (int32_t)MAX(1, (int64_t)backend->budget_bps *
+			       CONFIG_AURORA_TELEMETRY_BURST_MS / 1000);
+}
+
+/* Refill the bucket and decide whether @p cls may use the link now.
+ * Urgent classes always may; kinematics needs a positive balance and
+ * health and samples need half a bucket, so they only ride on spare
+ * bandwidth.
+ */
+static bool budget_admit(const struct telemetry_backend *backend,
+			 enum telemetry_class cls)
+{
+	struct telemetry_budget *b = backend->budget;
+	const int32_t cap = budget_capacity(backend);
+	const int64_t now_ms = k_uptime_get();
+
+	if (!b->primed) {
+		b->tokens = cap;
+		b->refill_ms = now_ms;
+		b->primed = true;
+	}
+
+	const int64_t refill = (now_ms - b->refill_ms) * backend->budget_bps / 1000;
+
+	if (refill > 0) {
+		b->tokens = (int32_t)MIN((int64_t)cap, b->tokens + refill);
+		/* Advance by the time actually converted to whole bytes. */
+		b->refill_ms += refill * 1000 / backend->budget_bps;
+	}
+
+	switch (cls) {
+	case TELEMETRY_CLASS_KINEMATICS:
+		return b->tokens > 0;
+	case TELEMETRY_CLASS_HEALTH:
+	case TELEMETRY_CLASS_SAMPLES:
+		return b->tokens > cap / 2;
+	default:
+		return true;
+	}
+}
+
+/* Charge @p bytes after the backend accepted a message. Urgent traffic
+ * may push the balance negative down to one bucket of debt; routine
+ * traffic then waits until it has been paid back.
+ */
+static void budget_charge(const struct telemetry_backend *backend, int bytes)
+{
+	struct telemetry_budget *b = backend->budget;
+
+	b->tokens = MAX(-budget_capacity(backend), b->tokens - bytes);
+}
+
+static bool sched_admit(const struct telemetry_backend *backend,
+			enum telemetry_class cls)
+{
+	if (!backend->budget) {
+		return true;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&sched_lock);
+	bool admit = budget_admit(backend, cls);
+
+	k_spin_unlock(&sched_lock, key);
+	return admit;
+}
+
+/* Charge what the backend queued and fold its result into @p rc. */
+static void sched_account(const struct telemetry_backend *backend, int ret,
+			  int *rc)
+{
+	if (ret > 0 && backend->budget) {
+		k_spinlock_key_t key = k_spin_lock(&sched_lock);
+
+		budget_charge(backend, ret);
+		k_spin_unlock(&sched_lock, key);
+	}
+	if (ret < 0 && !*rc) {
+		*rc = ret;
+	}
+}
+
+int telemetry_send_sm_class(enum telemetry_class cls, enum sm_state state,
+			    enum sm_type type, const struct sm_inputs *inputs)
 {
 	int rc = 0;
 
+	if ((unsigned int)cls >= TELEMETRY_CLASS_COUNT) {
+		return -EINVAL;
+	}
+
 	STRUCT_SECTION_FOREACH(telemetry_backend, backend) {
 		if (!backend->api || !backend->api->send_sm_update) {
 			continue;
 		}
-		int ret = backend->api->send_sm_update(state, type, inputs);
-		if (ret && !rc) {
-			rc = ret;
+		if (!sched_admit(backend, cls)) {
+			if (!rc) {
+				rc = -EAGAIN;
+			}
+			continue;
 		}
+		sched_account(backend,
+			      backend->api->send_sm_update(cls, state, type, inputs),
+			      &rc);
 	}
 	return rc;
 }
+
+int telemetry_send_samples(uint8_t type, uint64_t timestamp_ns,
+			   const struct sensor_value *channels,
+			   uint8_t channel_count)
+{
+	int rc = 0;
+
+	STRUCT_SECTION_FOREACH(telemetry_backend, backend) {
+		if (!backend->api || !backend->api->send_samples) {
+			continue;
+		}
+		if (!sched_admit(backend, TELEMETRY_CLASS_SAMPLES)) {
+			if (!rc) {
+				rc = -EAGAIN;
+			}
+			continue;
+		}
+		sched_account(backend,
+			      backend->api->send_samples(type, timestamp_ns,
+							 channels, channel_count),
+			      &rc);
+	}
+	return rc;
+}
+
+int telemetry_send_sm_update(enum sm_state state, enum sm_type type,
+			     const struct sm_inputs *inputs)
+{
+	enum telemetry_class cls = TELEMETRY_CLASS_KINEMATICS;
+	k_spinlock_key_t key = k_spin_lock(&sched_lock);
+
+	if (!have_last_state || state != last_state) {
+		cls = TELEMETRY_CLASS_TRANSITION;
+		last_state = state;
+		have_last_state = true;
+	}
+	k_spin_unlock(&sched_lock, key);
+
+	return telemetry_send_sm_class(cls, state, type, inputs);
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Runner-side half of the native_sim replay file input.  Built against
+ * the host C library into the native simulator runner, so it can map a
+ * host file the embedded image has no access to.
+ */
+
+#include <fcntl.h>
+#include <stddef.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+int replay_file_host_map(const char *path, const void **base, size_t *len)
+{
+	struct stat st;
+	void *p;
+	int fd = open(path, O_RDONLY);
+
+	if (fd < 0) {
+		return -1;
+	}
+	if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+		close(fd);
+		return -1;
+	}
+
+	p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (p == MAP_FAILED) {
+		return -1;
+	}
+
+	(void)madvise(p, (size_t)st.st_size, MADV_SEQUENTIAL);
+	*base = p;
+	*len = (size_t)st.st_size;
+	return 0;
+}
+
+void replay_file_host_drop(const void *base, size_t from, size_t to)
+{
+	size_t page = (size_t)sysconf(_SC_PAGESIZE);
+
+	from &= ~(page - 1);
+	to &= ~(page - 1);
+	if (to > from) {
+		(void)madvise((char *)base + from, to - from, MADV_DONTNEED);
+	}
+}
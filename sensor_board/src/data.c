@@ -25,6 +25,14 @@
 #include <aurora/lib/pad_link.h>
 #endif /* CONFIG_AURORA_PAD_LINK */
 
+#if defined(CONFIG_PYRO)
+#include <aurora/drivers/pyro.h>
+#endif /* CONFIG_PYRO */
+
+#if defined(CONFIG_AURORA_TELEMETRY)
+#include <aurora/lib/telemetry.h>
+#endif /* CONFIG_AURORA_TELEMETRY */
+
 #if defined(CONFIG_DATA_LOGGER_BIN)
 LOG_MODULE_DECLARE(main, CONFIG_SENSOR_BOARD_LOG_LEVEL);
 
@@ -125,6 +133,10 @@ void log_handle_flight_lifecycle(const enum sm_state prev_state, const enum sm_s
 	 *                 previous flight first).
 	 *  - ARMED→BOOST: hand the formatter a BOOST event so
 	 *                 the circular ring freezes forward.
+	 *  - →APOGEE:     hand an APOGEE event so the logger
+	 *                 switches to its descent decimation,
+	 *                 and with CONVERT_TRAIL start converting
+	 *                 behind the writer.
 	 *  - →LANDED:     hand a LANDED event and schedule the
 	 *                 close POST_LANDED_PAD_MS later so the
 	 *                 tail of the flight gets captured.
@@ -136,6 +148,11 @@ void log_handle_flight_lifecycle(const enum sm_state prev_state, const enum sm_s
 		log_begin_flight();
 	} else if (prev_state == SM_ARMED && state == SM_BOOST) {
 		(void)data_logger_event(&sm_logger, DLE_BOOST);
+	} else if (state == SM_APOGEE) {
+		(void)data_logger_event(&sm_logger, DLE_APOGEE);
+#if defined(CONFIG_DATA_LOGGER_CONVERT_TRAIL)
+		k_sem_give(&convert_request);
+#endif /* CONFIG_DATA_LOGGER_CONVERT_TRAIL */
 	} else if (state == SM_LANDED) {
 		(void)data_logger_event(&sm_logger, DLE_LANDED);
 		(void)k_work_schedule(&log_end_work, K_MSEC(CONFIG_DATA_LOGGER_BIN_POST_LANDED_PAD_MS));
@@ -221,15 +238,86 @@ void log_vbat_telemetry(void)
 /* No battery-sense node in the devicetree — nothing to log. */
 void log_vbat_telemetry(void) {}
 #endif /* DT_HAS_CHOSEN(auxspace_vbat) */
+
+#if defined(CONFIG_PYRO)
+/* Nanoseconds as milliseconds, losslessly: val2 counts millionths of a ms. */
+static void ns_to_ms_value(struct sensor_value *val, uint64_t ns)
+{
+	val->val1 = (int32_t)(ns / NSEC_PER_MSEC);
+	val->val2 = (int32_t)(ns % NSEC_PER_MSEC);
+}
+
+void log_pyro_fire(uint32_t channel, const struct pyro_fire_timing *timing)
+{
+	struct datapoint dp = {
+		.timestamp_ns = timing->fire_ns,
+		.type = AURORA_DATA_PYRO_FIRE,
+		.channel_count = 3,
+		.channels = {{ .val1 = (int32_t)channel }},
+	};
+
+	ns_to_ms_value(&dp.channels[1], timing->fire_ns - timing->command_ns);
+	ns_to_ms_value(&dp.channels[2], (uint64_t)timing->delay_us * NSEC_PER_USEC);
+	log_enqueue(&dp);
+}
+#endif /* CONFIG_PYRO */
 #endif
 
 #if defined(CONFIG_AURORA_PAD_LINK)
 
+#if defined(CONFIG_PYRO)
+/* Cached pyro status only: never waits for an ADC conversion. */
+static void update_pad_link_pyro(void)
+{
+	const struct device *pyro0 = DEVICE_DT_GET(DT_CHOSEN(auxspace_pyro));
+	struct pad_link_pyro_channel ch[PL_PYRO_MAX_CHANNELS] = { 0 };
+	int n;
+
+	if (!device_is_ready(pyro0))
+		return;
+
+	n = pyro_get_nchannels(pyro0);
+	n = CLAMP(n, 0, PL_PYRO_MAX_CHANNELS);
+	for (int i = 0; i < n; i++) {
+		struct pyro_channel_status st;
+
+		if (pyro_get_status(pyro0, i, &st) != 0)
+			return;
+
+		ch[i].cap_mv = st.cap_mv;
+		ch[i].sense_mv = st.sense_mv;
+		ch[i].flags = ((st.flags & PYRO_STATUS_CAP_VALID) ? PL_PYRO_F_CAP_VALID : 0) |
+			      ((st.flags & PYRO_STATUS_SENSE_VALID) ? PL_PYRO_F_SENSE_VALID : 0) |
+			      ((st.flags & PYRO_STATUS_ARMED) ? PL_PYRO_F_ARMED : 0) |
+			      ((st.flags & PYRO_STATUS_TRIGGERED) ? PL_PYRO_F_FIRED : 0);
+	}
+
+	pad_link_publish_pyro(ch, n);
+}
+#endif /* CONFIG_PYRO */
+
 void update_pad_link_data(void)
 {
 	struct sm_inputs sm_snap;
 
 	sm_get_inputs(&sm_snap);
 	pad_link_publish_sm(sm_get_state(), sm_get_type(), &sm_snap);
+#if defined(CONFIG_PYRO)
+	update_pad_link_pyro();
+#endif /* CONFIG_PYRO */
 }
 #endif /* CONFIG_AURORA_PAD_LINK */
+
+#if defined(CONFIG_AURORA_TELEMETRY)
+
+void update_telemetry_data(void)
+{
+	struct sm_inputs sm_snap;
+
+	sm_get_inputs(&sm_snap);
+	/* The scheduler turns state changes into never-dropped transition
+	 * frames and fits the routine updates into each link's budget.
+	 */
+	(void)telemetry_send_sm_update(sm_get_state(), sm_get_type(), &sm_snap);
+}
+#endif /* CONFIG_AURORA_TELEMETRY */
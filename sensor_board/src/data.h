@@ -10,6 +10,7 @@
 #define DATA_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #include <aurora/lib/baro.h>
 #include <aurora/lib/state/state.h>
@@ -24,12 +25,32 @@ static inline void log_flight_telemetry(void) {}
 static inline void log_vbat_telemetry(void) {}
 #endif /* CONFIG_DATA_LOGGER_BIN */
 
+struct pyro_fire_timing;
+
+/**
+ * @brief Log a completed timed pyro fire as an AURORA_DATA_PYRO_FIRE record.
+ *
+ * @param channel Pyro channel that fired.
+ * @param timing  Command and fire stamps from pyro_fire_timing().
+ */
+#if defined(CONFIG_DATA_LOGGER_BIN) && defined(CONFIG_PYRO)
+void log_pyro_fire(uint32_t channel, const struct pyro_fire_timing *timing);
+#else
+static inline void log_pyro_fire(uint32_t channel, const struct pyro_fire_timing *timing) {}
+#endif /* CONFIG_DATA_LOGGER_BIN && CONFIG_PYRO */
+
 #if defined(CONFIG_AURORA_PAD_LINK)
 void update_pad_link_data(void);
 #else
 static inline void update_pad_link_data(void) {}
 #endif /*CONFIG_AURORA_PAD_LINK*/
 
+#if defined(CONFIG_AURORA_TELEMETRY)
+void update_telemetry_data(void);
+#else
+static inline void update_telemetry_data(void) {}
+#endif /* CONFIG_AURORA_TELEMETRY */
+
 /**
  * @brief Arming precondition: is flight-time data logging available?
  *
@@ -169,12 +169,6 @@ static double altitude_to_pressure_kpa(double h_m)
 	return SEA_LEVEL_PRESSURE_KPA * pow(ratio, ISA_GMR_OVER_L);
 }
 
-static void set_sensor_value_double(struct sensor_value *sv, double v)
-{
-	sv->val1 = (int32_t)v;
-	sv->val2 = (int32_t)((v - (double)sv->val1) * 1000000.0);
-}
-
 static double flight_time_seconds(void)
 {
 	uint64_t launch = profile_launch_get();
@@ -212,13 +206,13 @@ static void fake_imu_task(void *, void *, void *)
 				(double)CONFIG_IMU_UP_AXIS_SIGN;
 		}
 
-		struct imu_data msg = {0};
-		set_sensor_value_double(&msg.accel[0], 0.0);
-		set_sensor_value_double(&msg.accel[1], accel_vert);
-		set_sensor_value_double(&msg.accel[2], 0.0);
-		set_sensor_value_double(&msg.gyro[0], gyro_axes[0]);
-		set_sensor_value_double(&msg.gyro[1], gyro_axes[1]);
-		set_sensor_value_double(&msg.gyro[2], gyro_axes[2]);
+		struct imu_data msg = {.timestamp_ns = start};
+		msg.accel[0] = aurora_sample_from_double(0.0);
+		msg.accel[1] = aurora_sample_from_double(accel_vert);
+		msg.accel[2] = aurora_sample_from_double(0.0);
+		msg.gyro[0] = aurora_sample_from_double(gyro_axes[0]);
+		msg.gyro[1] = aurora_sample_from_double(gyro_axes[1]);
+		msg.gyro[2] = aurora_sample_from_double(gyro_axes[2]);
 
 		(void)zbus_chan_pub(&imu_data_chan, &msg, K_NO_WAIT);
 		uint64_t delta = k_ticks_to_ns_floor64(k_uptime_ticks()) - start;
@@ -245,10 +239,9 @@ static void fake_baro_task(void *, void *, void *)
 		double altitude, accel_vert;
 		profile_sample(flight_time_seconds(), &altitude, &accel_vert);
 
-		struct baro_data msg = {0};
-		set_sensor_value_double(&msg.temperature, 20.0);
-		set_sensor_value_double(&msg.pressure,
-				       altitude_to_pressure_kpa(altitude));
+		struct baro_data msg = {.timestamp_ns = start};
+		msg.temperature = aurora_sample_from_double(20.0);
+		msg.pressure = aurora_sample_from_double(altitude_to_pressure_kpa(altitude));
 
 		(void)zbus_chan_pub(&baro_data_chan, &msg, K_NO_WAIT);
 
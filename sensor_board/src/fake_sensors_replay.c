@@ -19,6 +19,15 @@
  * thread fires the launch automatically once attitude calibration
  * completes and exits the simulator on SM_LANDED / SM_ERROR.
  *
+ * With CONFIG_AURORA_FAKE_SENSORS_REPLAY_FAST=y a single thread merges
+ * the three streams in timestamp order and stamps every message with
+ * its recorded time instead of the uptime at publish, so a run with
+ * native_sim's real-time pacing off finishes as fast as the host allows
+ * and the same recording always yields the same output.
+ *
+ * CONFIG_AURORA_FAKE_SENSORS_REPLAY_FILE feeds that thread from a file
+ * mapped at runtime (see replay_file.c) instead of the generated tables.
+ *
  * Copyright (c) 2025-2026 Auxspace e.V.
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -33,6 +42,7 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/logging/log_ctrl.h>
 #include <zephyr/shell/shell.h>
+#include <zephyr/sys/util.h>
 #include <zephyr/zbus/zbus.h>
 
 #include <aurora/lib/baro.h>
@@ -78,41 +88,200 @@ static void launch_set(uint64_t v)
 
 /* -------- Helpers -------- */
 
-static void set_sensor_value_double(struct sensor_value *sv, double v)
+static uint64_t uptime_ns(void)
 {
-	sv->val1 = (int32_t)v;
-	sv->val2 = (int32_t)((v - (double)sv->val1) * 1000000.0);
+	return k_ticks_to_ns_floor64(k_uptime_ticks());
 }
 
 static void publish_imu(const struct replay_imu_sample *a,
-			const struct replay_imu_sample *g)
+			const struct replay_imu_sample *g, uint64_t t_ns)
 {
-	struct imu_data msg = {0};
-	set_sensor_value_double(&msg.accel[0], a->x);
-	set_sensor_value_double(&msg.accel[1], a->y);
-	set_sensor_value_double(&msg.accel[2], a->z);
-	set_sensor_value_double(&msg.gyro[0], g->x);
-	set_sensor_value_double(&msg.gyro[1], g->y);
-	set_sensor_value_double(&msg.gyro[2], g->z);
+	struct imu_data msg = {
+		.timestamp_ns = t_ns,
+	};
+	msg.accel[0] = aurora_sample_from_double(a->x);
+	msg.accel[1] = aurora_sample_from_double(a->y);
+	msg.accel[2] = aurora_sample_from_double(a->z);
+	msg.gyro[0] = aurora_sample_from_double(g->x);
+	msg.gyro[1] = aurora_sample_from_double(g->y);
+	msg.gyro[2] = aurora_sample_from_double(g->z);
 	(void)zbus_chan_pub(&imu_data_chan, &msg, K_NO_WAIT);
 }
 
-static void publish_baro(const struct replay_baro_sample *b)
+static void publish_baro(const struct replay_baro_sample *b, uint64_t t_ns)
 {
-	struct baro_data msg = {0};
-	set_sensor_value_double(&msg.temperature, b->temp_c);
-	set_sensor_value_double(&msg.pressure, b->pres_kpa);
+	struct baro_data msg = {
+		.timestamp_ns = t_ns,
+	};
+	msg.temperature = aurora_sample_from_double(b->temp_c);
+	msg.pressure = aurora_sample_from_double(b->pres_kpa);
 	(void)zbus_chan_pub(&baro_data_chan, &msg, K_NO_WAIT);
 }
 
 static void sleep_until(uint64_t target_ns)
 {
-	uint64_t now = k_ticks_to_ns_floor64(k_uptime_ticks());
+	uint64_t now = uptime_ns();
 	if (target_ns > now) {
 		k_sleep(K_NSEC(target_ns - now));
 	}
 }
 
+#if defined(CONFIG_AURORA_FAKE_SENSORS_REPLAY_MERGED)
+/* -------- Merged replay stream -------- */
+
+#if !defined(CONFIG_AURORA_FAKE_SENSORS_REPLAY_FILE)
+/* Cursors into the generated tables. */
+static size_t ai, gi, bi;
+
+/* replay_source_open – see fake_sensors_replay.h */
+int replay_source_open(void)
+{
+	LOG_INF("Replay: %zu accel + %zu gyro + %zu baro samples, merged",
+		replay_accel_len, replay_gyro_len, replay_baro_len);
+	return 0;
+}
+
+/* replay_source_rewind – see fake_sensors_replay.h */
+void replay_source_rewind(void)
+{
+	ai = 0;
+	gi = 0;
+	bi = 0;
+}
+
+/* replay_source_next – see fake_sensors_replay.h */
+bool replay_source_next(struct replay_event *ev)
+{
+	if (ai < replay_accel_len &&
+	    (bi >= replay_baro_len || replay_accel[ai].t_ns <= replay_baro[bi].t_ns)) {
+		const struct replay_imu_sample *a = &replay_accel[ai++];
+
+		while (gi + 1 < replay_gyro_len &&
+		       replay_gyro[gi + 1].t_ns <= a->t_ns) {
+			gi++;
+		}
+		ev->t_ns = a->t_ns;
+		ev->is_baro = false;
+		ev->accel = *a;
+		ev->gyro = replay_gyro[gi];
+		return true;
+	}
+	if (bi < replay_baro_len) {
+		ev->baro = replay_baro[bi++];
+		ev->t_ns = ev->baro.t_ns;
+		ev->is_baro = true;
+		return true;
+	}
+	return false;
+}
+
+/* replay_source_duration_ns – see fake_sensors_replay.h */
+uint64_t replay_source_duration_ns(void)
+{
+	return MAX(replay_accel[replay_accel_len - 1].t_ns,
+		   replay_baro[replay_baro_len - 1].t_ns);
+}
+#endif /* !CONFIG_AURORA_FAKE_SENSORS_REPLAY_FILE */
+
+/* -------- Merged replay thread -------- */
+
+/**
+ * @brief Publish the IMU and baro streams from one thread in timestamp
+ *        order.
+ *
+ * Sleeping to each sample's time lets native_sim jump its clock straight
+ * to the next event when real-time pacing is off; the recorded
+ * timestamps keep the filter's dt independent of tick rounding.  On the
+ * pad and after the recording both streams share one timeline too.
+ */
+static void replay_task(void *, void *, void *)
+{
+	const uint64_t imu_period_ns = 1000000000ULL / CONFIG_IMU_FREQUENCY;
+	const uint64_t baro_period_ns = 1000000000ULL / CONFIG_BARO_FREQUENCY;
+	struct replay_event ev, pad_imu = {0}, pad_baro = {0};
+	bool have_imu = false, have_baro = false;
+
+	if (replay_source_open() != 0) {
+		LOG_ERR("Replay: no input, sensors stay silent");
+#if defined(CONFIG_AURORA_SIM_AUTOTEST)
+		log_flush();
+		exit(1);
+#endif /* CONFIG_AURORA_SIM_AUTOTEST */
+		return;
+	}
+
+	/* The first sample of each stream is what the pad republishes. */
+	replay_source_rewind();
+	while ((!have_imu || !have_baro) && replay_source_next(&ev)) {
+		if (ev.is_baro && !have_baro) {
+			pad_baro = ev;
+			have_baro = true;
+		} else if (!ev.is_baro && !have_imu) {
+			pad_imu = ev;
+			have_imu = true;
+		}
+	}
+	if (!have_imu || !have_baro) {
+		LOG_ERR("Replay: input lacks IMU or baro samples");
+#if defined(CONFIG_AURORA_SIM_AUTOTEST)
+		log_flush();
+		exit(1);
+#endif /* CONFIG_AURORA_SIM_AUTOTEST */
+		return;
+	}
+
+	LOG_INF("Replay: pad-stationary, awaiting `sim launch`");
+	imu_active = true;
+	baro_active = true;
+
+	while (1) {
+		uint64_t origin = launch_get();
+		struct replay_event hold_imu = pad_imu, hold_baro = pad_baro;
+
+		if (origin != 0) {
+			replay_source_rewind();
+			while (launch_get() == origin && replay_source_next(&ev)) {
+				sleep_until(origin + ev.t_ns);
+				if (ev.is_baro) {
+					publish_baro(&ev.baro, origin + ev.t_ns);
+					hold_baro = ev;
+				} else {
+					publish_imu(&ev.accel, &ev.gyro,
+						    origin + ev.t_ns);
+					hold_imu = ev;
+				}
+			}
+
+			if (launch_get() != origin) {
+				continue; /* sim reset / re-launch */
+			}
+			LOG_INF("Replay: end of recording, holding final sample");
+		}
+
+		/* Pad-stationary (or holding the last sample): republish at
+		 * the configured cadences until the launch state changes.
+		 */
+		uint64_t next_imu = uptime_ns();
+		uint64_t next_baro = next_imu;
+
+		while (launch_get() == origin) {
+			if (next_imu <= next_baro) {
+				sleep_until(next_imu);
+				publish_imu(&hold_imu.accel, &hold_imu.gyro, next_imu);
+				next_imu += imu_period_ns;
+			} else {
+				sleep_until(next_baro);
+				publish_baro(&hold_baro.baro, next_baro);
+				next_baro += baro_period_ns;
+			}
+		}
+	}
+}
+
+K_THREAD_DEFINE(replay_polling, 2048, replay_task, NULL, NULL, NULL,
+		5, 0, 0);
+
+#else
 /* -------- Replay IMU thread -------- */
 
 static void replay_imu_task(void *, void *, void *)
@@ -131,7 +300,7 @@ static void replay_imu_task(void *, void *, void *)
 			 * sample at the configured cadence so attitude
 			 * calibration sees a valid stationary signal.
 			 */
-			publish_imu(&replay_accel[0], &replay_gyro[0]);
+			publish_imu(&replay_accel[0], &replay_gyro[0], uptime_ns());
 			k_sleep(K_NSEC(period_ns));
 			continue;
 		}
@@ -148,14 +317,15 @@ static void replay_imu_task(void *, void *, void *)
 				gi++;
 			}
 			sleep_until(origin + a->t_ns);
-			publish_imu(a, &replay_gyro[gi]);
+			publish_imu(a, &replay_gyro[gi], uptime_ns());
 		}
 
 		if (launch_get() == origin) {
 			LOG_INF("Replay IMU: end of recording, holding final sample");
 			while (launch_get() == origin) {
 				publish_imu(&replay_accel[replay_accel_len - 1],
-					    &replay_gyro[replay_gyro_len - 1]);
+					    &replay_gyro[replay_gyro_len - 1],
+					    uptime_ns());
 				k_sleep(K_NSEC(period_ns));
 			}
 		}
@@ -179,7 +349,7 @@ static void replay_baro_task(void *, void *, void *)
 	while (1) {
 		uint64_t origin = launch_get();
 		if (origin == 0) {
-			publish_baro(&replay_baro[0]);
+			publish_baro(&replay_baro[0], uptime_ns());
 			k_sleep(K_NSEC(period_ns));
 			continue;
 		}
@@ -190,13 +360,13 @@ static void replay_baro_task(void *, void *, void *)
 			}
 			const struct replay_baro_sample *b = &replay_baro[i];
 			sleep_until(origin + b->t_ns);
-			publish_baro(b);
+			publish_baro(b, uptime_ns());
 		}
 
 		if (launch_get() == origin) {
 			LOG_INF("Replay baro: end of recording, holding final sample");
 			while (launch_get() == origin) {
-				publish_baro(&replay_baro[replay_baro_len - 1]);
+				publish_baro(&replay_baro[replay_baro_len - 1], uptime_ns());
 				k_sleep(K_NSEC(period_ns));
 			}
 		}
@@ -205,6 +375,7 @@ static void replay_baro_task(void *, void *, void *)
 
 K_THREAD_DEFINE(baro_polling, 2048, replay_baro_task, NULL, NULL, NULL,
 		5, 0, 0);
+#endif /* CONFIG_AURORA_FAKE_SENSORS_REPLAY_MERGED */
 
 /* -------- Shell interface -------- */
 
@@ -213,9 +384,13 @@ static int cmd_sim_launch(const struct shell *sh, size_t argc, char **argv)
 	ARG_UNUSED(argc);
 	ARG_UNUSED(argv);
 
-	launch_set(k_ticks_to_ns_floor64(k_uptime_ticks()));
+	launch_set(uptime_ns());
+#if defined(CONFIG_AURORA_FAKE_SENSORS_REPLAY_FILE)
+	shell_print(sh, "sim: replay started");
+#else
 	shell_print(sh, "sim: replay started (%zu accel / %zu gyro / %zu baro samples)",
 		    replay_accel_len, replay_gyro_len, replay_baro_len);
+#endif /* CONFIG_AURORA_FAKE_SENSORS_REPLAY_FILE */
 	return 0;
 }
 
@@ -238,9 +413,19 @@ static int cmd_sim_status(const struct shell *sh, size_t argc, char **argv)
 	if (origin == 0) {
 		shell_print(sh, "sim: pad-stationary");
 	} else {
-		uint64_t now = k_ticks_to_ns_floor64(k_uptime_ticks());
+		uint64_t now = uptime_ns();
 		double t_s = (double)(now - origin) / 1e9;
+#if defined(CONFIG_AURORA_FAKE_SENSORS_REPLAY_MERGED)
+		uint64_t total_ns = replay_source_duration_ns();
+
+		if (total_ns == 0) {
+			shell_print(sh, "sim: replay t=%.2fs", t_s);
+			return 0;
+		}
+		double total_s = (double)total_ns / 1e9;
+#else
 		double total_s = (double)replay_accel[replay_accel_len - 1].t_ns / 1e9;
+#endif /* CONFIG_AURORA_FAKE_SENSORS_REPLAY_MERGED */
 		shell_print(sh, "sim: replay t=%.2fs / %.2fs", t_s, total_s);
 	}
 	return 0;
@@ -248,7 +433,7 @@ static int cmd_sim_status(const struct shell *sh, size_t argc, char **argv)
 
 SHELL_STATIC_SUBCMD_SET_CREATE(sim_subcmds,
 	SHELL_CMD(launch, NULL,
-		  "Start replay of the embedded flight recording",
+		  "Start replay of the flight recording",
 		  cmd_sim_launch),
 	SHELL_CMD(reset, NULL,
 		  "Reset replay back to pad-stationary",
@@ -282,7 +467,7 @@ static void autolaunch_task(void *, void *, void *)
 	}
 
 	LOG_INF("replay autolaunch: launching replay");
-	launch_set(k_ticks_to_ns_floor64(k_uptime_ticks()));
+	launch_set(uptime_ns());
 
 	int64_t deadline = k_uptime_get() + CONFIG_AURORA_SIM_AUTOLAUNCH_TIMEOUT_MS;
 
@@ -6,6 +6,7 @@
 #ifndef FAKE_SENSORS_REPLAY_H_
 #define FAKE_SENSORS_REPLAY_H_
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -19,11 +20,41 @@ struct replay_baro_sample {
 	float pres_kpa, temp_c;
 };
 
+#if !defined(CONFIG_AURORA_FAKE_SENSORS_REPLAY_FILE)
 extern const struct replay_imu_sample replay_accel[];
 extern const size_t replay_accel_len;
 extern const struct replay_imu_sample replay_gyro[];
 extern const size_t replay_gyro_len;
 extern const struct replay_baro_sample replay_baro[];
 extern const size_t replay_baro_len;
+#endif /* !CONFIG_AURORA_FAKE_SENSORS_REPLAY_FILE */
+
+#if defined(CONFIG_AURORA_FAKE_SENSORS_REPLAY_MERGED)
+/** One step of the merged replay stream. */
+struct replay_event {
+	uint64_t t_ns;			 /**< Since the start of the recording. */
+	bool is_baro;			 /**< @c baro is valid, else accel/gyro. */
+	struct replay_imu_sample accel;
+	struct replay_imu_sample gyro;	 /**< Latest gyro at @c t_ns. */
+	struct replay_baro_sample baro;
+};
+
+/*
+ * The merged engine reads its samples through these; fake_sensors_replay.c
+ * backs them with the compiled-in tables, replay_file.c with a mapped file.
+ */
+
+/** Prepare the input; 0 on success or a negative errno. */
+int replay_source_open(void);
+
+/** Start over from the first sample. */
+void replay_source_rewind(void);
+
+/** Next sample in timestamp order; false at the end of the recording. */
+bool replay_source_next(struct replay_event *ev);
+
+/** Length of the recording in ns, 0 if it is not known up front. */
+uint64_t replay_source_duration_ns(void);
+#endif /* CONFIG_AURORA_FAKE_SENSORS_REPLAY_MERGED */
 
 #endif /* FAKE_SENSORS_REPLAY_H_ */
@@ -2,8 +2,9 @@
  * @file main.c
  * @brief Sensor board application entry point.
  *
- * Defines three Zephyr threads (IMU, barometer, state machine) that run
- * concurrently to collect sensor data and drive the flight state machine.
+ * Defines four Zephyr threads (IMU, barometer, fusion, state machine) that
+ * run concurrently to collect sensor data and drive the flight state
+ * machine.
  *
  * Copyright (c) 2025-2026 Auxspace e.V.
  * SPDX-License-Identifier: Apache-2.0
@@ -16,9 +17,12 @@
 #include <zephyr/devicetree.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/zbus/zbus.h>
 
 #include <app_version.h>
+#include <aurora/lib/ram.h>
 
 #if defined(CONFIG_IMU)
 #include <aurora/lib/attitude.h>
@@ -29,6 +33,12 @@
 #include <aurora/lib/baro.h>
 #endif /* CONFIG_BARO */
 
+#if defined(CONFIG_SENSOR_VOTE)
+#include <math.h>
+
+#include <aurora/lib/sensor_vote.h>
+#endif /* CONFIG_SENSOR_VOTE */
+
 #if defined(CONFIG_PYRO)
 #include <aurora/drivers/pyro.h>
 /* Build-time dependency: the state machine fires a pyro device selected via the
@@ -62,6 +72,7 @@ BUILD_ASSERT(DT_NODE_HAS_STATUS(DT_CHOSEN(auxspace_pyro), okay),
 
 #if defined(CONFIG_AURORA_STATE_MACHINE)
 #include <aurora/lib/state/state.h>
+#include <aurora/lib/state/profile.h>
 static int armed = 0;
 
 /** @brief Flight state machine thresholds loaded from Kconfig. */
@@ -118,44 +129,120 @@ bool baro_active = false; /**< True once the barometer thread has initialized. *
 bool imu_active = false;  /**< True once the IMU thread has initialized. */
 static bool sm_active = false; /**< True once the state machine thread has initialized. */
 
+#if defined(CONFIG_SENSOR_IDLE_RATES)
+/* Nonzero while the state machine is in SM_IDLE, where it boots: the
+ * sensors then run at the *_IDLE_FREQUENCY rates (see sensor_rates_set()).
+ */
+static atomic_t sensors_idle = ATOMIC_INIT(1);
+#endif /* CONFIG_SENSOR_IDLE_RATES */
+
 /* ============================================================
  *                     IMU TASK
  * ============================================================ */
 #if defined(CONFIG_IMU) && !defined(CONFIG_AURORA_FAKE_SENSORS)
-/* Build-time dependency: the IMU task fetches its device from the
- * 'auxspace,imu' chosen node. */
+/* Build-time dependency: the IMU task fetches its devices from the
+ * 'auxspace,imu' chosen node and, for redundant IMUs, 'auxspace,imu<n>'. */
 #if !DT_HAS_CHOSEN(auxspace_imu)
 #error "CONFIG_IMU requires DT chosen 'auxspace,imu' to point at an IMU sensor node."
 #endif
 BUILD_ASSERT(DT_NODE_HAS_STATUS(DT_CHOSEN(auxspace_imu), okay),
 	     "the 'auxspace,imu' chosen node must have status \"okay\"");
+#if CONFIG_IMU_INSTANCES > 1 && !DT_HAS_CHOSEN(auxspace_imu1)
+#error "CONFIG_IMU_INSTANCES > 1 requires DT chosen 'auxspace,imu1'."
+#endif
+#if CONFIG_IMU_INSTANCES > 2 && !DT_HAS_CHOSEN(auxspace_imu2)
+#error "CONFIG_IMU_INSTANCES > 2 requires DT chosen 'auxspace,imu2'."
+#endif
+#if CONFIG_IMU_INSTANCES > 3 && !DT_HAS_CHOSEN(auxspace_imu3)
+#error "CONFIG_IMU_INSTANCES > 3 requires DT chosen 'auxspace,imu3'."
+#endif
+
+static const struct device *const imu_devs[CONFIG_IMU_INSTANCES] = {
+	DEVICE_DT_GET(DT_CHOSEN(auxspace_imu)),
+#if CONFIG_IMU_INSTANCES > 1
+	DEVICE_DT_GET(DT_CHOSEN(auxspace_imu1)),
+#endif
+#if CONFIG_IMU_INSTANCES > 2
+	DEVICE_DT_GET(DT_CHOSEN(auxspace_imu2)),
+#endif
+#if CONFIG_IMU_INSTANCES > 3
+	DEVICE_DT_GET(DT_CHOSEN(auxspace_imu3)),
+#endif
+};
+
+#if !defined(CONFIG_IMU_STREAM) && !defined(CONFIG_IMU_TRIGGER)
+/* Paces imu_task(); sensor_rates_set() restarts it on a rate change. */
+static K_TIMER_DEFINE(imu_pace, NULL, NULL);
+
+/** @brief Polling period for the current sensor rate. */
+static k_timeout_t imu_period(void)
+{
+#if defined(CONFIG_SENSOR_IDLE_RATES)
+	if (atomic_get(&sensors_idle)) {
+		return K_USEC(USEC_PER_SEC / CONFIG_IMU_IDLE_FREQUENCY);
+	}
+#endif /* CONFIG_SENSOR_IDLE_RATES */
+	return K_USEC(USEC_PER_SEC / CONFIG_IMU_FREQUENCY);
+}
+#endif /* !CONFIG_IMU_STREAM && !CONFIG_IMU_TRIGGER */
+
 /**
  * @brief IMU polling thread.
  *
- * Initializes the IMU and continuously polls orientation and acceleration
+ * Initializes the IMUs and continuously polls orientation and acceleration
  * at the configured frequency, updating the global sensor variables.
+ * Polling is paced by a periodic timer so the rate does not drift with
+ * the time spent on the bus; redundant IMUs are read back to back on
+ * each tick. With CONFIG_IMU_STREAM the sensor's FIFO paces the thread
+ * instead and each wakeup publishes a whole block. With
+ * CONFIG_SENSOR_IDLE_RATES the rate drops to IMU_IDLE_FREQUENCY in IDLE.
  */
 void imu_task(void *, void *, void *)
 {
-	const struct device *imu0 = DEVICE_DT_GET(DT_CHOSEN(auxspace_imu));
+	uint32_t present = 0;
 
-	if (imu_init(imu0)) {
-		LOG_ERR("IMU not ready!");
+	for (uint8_t i = 0; i < CONFIG_IMU_INSTANCES; i++) {
+		if (imu_init_instance(imu_devs[i], i)) {
+			LOG_ERR("IMU %u not ready!", i);
+			continue;
+		}
+		present |= BIT(i);
+	}
+	if (present == 0) {
 		return;
 	}
 	imu_active = true;
 
-#if !defined(CONFIG_IMU_TRIGGER)
-	const int imu_hz = CONFIG_IMU_FREQUENCY;
+#if defined(CONFIG_IMU_STREAM)
+#if defined(CONFIG_SENSOR_IDLE_RATES)
+	/* imu_init_instance() armed the stream at the flight rate. */
+	if (atomic_get(&sensors_idle)) {
+		(void)imu_set_sampling_freq(imu_devs[0], CONFIG_IMU_IDLE_FREQUENCY);
+	}
+#endif /* CONFIG_SENSOR_IDLE_RATES */
 	while (1) {
-		int rc = imu_poll(imu0);
-		if (rc != 0) {
-			LOG_ERR("IMU polling failed (%d)", rc);
-			continue;
+		int rc = imu_read_batch(imu_devs[0]);
+		if (rc < 0) {
+			LOG_ERR("IMU FIFO readout failed (%d)", rc);
+		}
+	}
+#elif !defined(CONFIG_IMU_TRIGGER)
+	const k_timeout_t period = imu_period();
+
+	k_timer_start(&imu_pace, period, period);
+	while (1) {
+		for (uint8_t i = 0; i < CONFIG_IMU_INSTANCES; i++) {
+			if (!(present & BIT(i))) {
+				continue;
+			}
+			int rc = imu_poll(imu_devs[i]);
+			if (rc != 0) {
+				LOG_ERR("IMU %u polling failed (%d)", i, rc);
+			}
 		}
-		k_sleep(K_MSEC(1000 / imu_hz));
+		k_timer_status_sync(&imu_pace);
 	}
-#endif /* !CONFIG_IMU_TRIGGER */
+#endif /* CONFIG_IMU_STREAM */
 
 	LOG_INF("IMU ready");
 }
@@ -168,31 +255,88 @@ K_THREAD_DEFINE(imu_polling, 2048, imu_task, NULL, NULL, NULL, 7, 0, 0);
  *                     BARO TASK
  * ============================================================ */
 #if defined(CONFIG_BARO) && !defined(CONFIG_AURORA_FAKE_SENSORS)
+#if CONFIG_BARO_INSTANCES > 1 && !DT_HAS_CHOSEN(auxspace_baro1)
+#error "CONFIG_BARO_INSTANCES > 1 requires DT chosen 'auxspace,baro1'."
+#endif
+#if CONFIG_BARO_INSTANCES > 2 && !DT_HAS_CHOSEN(auxspace_baro2)
+#error "CONFIG_BARO_INSTANCES > 2 requires DT chosen 'auxspace,baro2'."
+#endif
+#if CONFIG_BARO_INSTANCES > 3 && !DT_HAS_CHOSEN(auxspace_baro3)
+#error "CONFIG_BARO_INSTANCES > 3 requires DT chosen 'auxspace,baro3'."
+#endif
+
+static const struct device *const baro_devs[CONFIG_BARO_INSTANCES] = {
+	DEVICE_DT_GET(DT_CHOSEN(auxspace_baro)),
+#if CONFIG_BARO_INSTANCES > 1
+	DEVICE_DT_GET(DT_CHOSEN(auxspace_baro1)),
+#endif
+#if CONFIG_BARO_INSTANCES > 2
+	DEVICE_DT_GET(DT_CHOSEN(auxspace_baro2)),
+#endif
+#if CONFIG_BARO_INSTANCES > 3
+	DEVICE_DT_GET(DT_CHOSEN(auxspace_baro3)),
+#endif
+};
+
+#if !defined(CONFIG_BARO_TRIGGER)
+/* Paces baro_task(); sensor_rates_set() restarts it on a rate change. */
+static K_TIMER_DEFINE(baro_pace, NULL, NULL);
+
+/** @brief One barometer's slot for the current sensor rate. */
+static k_timeout_t baro_slot(void)
+{
+	int hz = CONFIG_BARO_FREQUENCY;
+
+#if defined(CONFIG_SENSOR_IDLE_RATES)
+	if (atomic_get(&sensors_idle)) {
+		hz = CONFIG_BARO_IDLE_FREQUENCY;
+	}
+#endif /* CONFIG_SENSOR_IDLE_RATES */
+	return K_USEC(USEC_PER_SEC / (hz * CONFIG_BARO_INSTANCES));
+}
+#endif /* !CONFIG_BARO_TRIGGER */
+
 /**
  * @brief Barometer polling thread.
  *
- * Initializes the barometric sensor and continuously measures temperature,
- * pressure at the configured frequency.
+ * Initializes the barometric sensors and continuously measures
+ * temperature, pressure at the configured frequency.  Redundant
+ * barometers are measured in turn, one per 1/(BARO_FREQUENCY *
+ * BARO_INSTANCES) s slot, so their samples interleave evenly. With
+ * CONFIG_SENSOR_IDLE_RATES each runs at BARO_IDLE_FREQUENCY in IDLE.
  */
 void baro_task(void *, void *, void *)
 {
-	const struct device *baro0 = DEVICE_DT_GET(DT_CHOSEN(auxspace_baro));
+	uint32_t present = 0;
 
-	if (baro_init(baro0)) {
-		LOG_ERR("Baro not ready!");
+	for (uint8_t i = 0; i < CONFIG_BARO_INSTANCES; i++) {
+		if (baro_init_instance(baro_devs[i], i)) {
+			LOG_ERR("Baro %u not ready!", i);
+			continue;
+		}
+		present |= BIT(i);
+	}
+	if (present == 0) {
 		return;
 	}
 	baro_active = true;
 
 #if !defined(CONFIG_BARO_TRIGGER)
-	const int baro_hz = CONFIG_BARO_FREQUENCY;
+	const k_timeout_t slot = baro_slot();
+	uint8_t next = 0;
+
+	k_timer_start(&baro_pace, slot, slot);
 	while (1) {
-		if (baro_measure(baro0)) {
-			LOG_ERR("Failed to measure baro0");
-			continue;
-		}
+		const uint8_t i = next;
 
-		k_sleep(K_MSEC(1000 / baro_hz));
+		next = (next + 1) % CONFIG_BARO_INSTANCES;
+		/* A missing barometer keeps its slot empty, so the others
+		 * stay at their phase.
+		 */
+		if ((present & BIT(i)) && baro_measure(baro_devs[i])) {
+			LOG_ERR("Failed to measure baro%u", i);
+		}
+		k_timer_status_sync(&baro_pace);
 	}
 #endif /* !CONFIG_BARO_TRIGGER */
 
@@ -203,6 +347,53 @@ void baro_task(void *, void *, void *)
 K_THREAD_DEFINE(baro_polling, 2048, baro_task, NULL, NULL, NULL, 7, 0, 0);
 #endif /* CONFIG_BARO && !CONFIG_AURORA_FAKE_SENSORS */
 
+/* ============================================================
+ *                     SENSOR RATES
+ * ============================================================ */
+#if defined(CONFIG_SENSOR_IDLE_RATES)
+#if defined(CONFIG_IMU) && !defined(CONFIG_IMU_TRIGGER)
+#define IDLE_RATE_IMU 1
+#endif
+#if defined(CONFIG_BARO) && !defined(CONFIG_BARO_TRIGGER)
+#define IDLE_RATE_BARO 1
+#endif
+
+/**
+ * @brief Switches the sensors between the IDLE and the flight rates.
+ *
+ * A polling thread is re-paced by restarting its timer with an
+ * immediate first expiry, so the next sample already follows the new
+ * period instead of waiting out a slow idle one. With CONFIG_IMU_STREAM
+ * the IMU output data rate is changed. Sensors in trigger mode keep
+ * their rate.
+ *
+ * @param idle true for the *_IDLE_FREQUENCY rates, false for flight.
+ */
+static void sensor_rates_set(bool idle)
+{
+	if ((atomic_set(&sensors_idle, idle) != 0) == idle) {
+		return;
+	}
+
+#if defined(IDLE_RATE_IMU)
+	if (imu_active) {
+#if defined(CONFIG_IMU_STREAM)
+		(void)imu_set_sampling_freq(imu_devs[0], idle ? CONFIG_IMU_IDLE_FREQUENCY
+							     : CONFIG_IMU_FREQUENCY);
+#else
+		k_timer_start(&imu_pace, K_NO_WAIT, imu_period());
+#endif /* CONFIG_IMU_STREAM */
+	}
+#endif /* IDLE_RATE_IMU */
+#if defined(IDLE_RATE_BARO)
+	if (baro_active) {
+		k_timer_start(&baro_pace, K_NO_WAIT, baro_slot());
+	}
+#endif /* IDLE_RATE_BARO */
+	LOG_INF("Sensors at %s rate", idle ? "idle" : "flight");
+}
+#endif /* CONFIG_SENSOR_IDLE_RATES */
+
 /* ============================================================
  *                     State machine TASK
  * ============================================================ */
@@ -296,10 +487,73 @@ int state_machine_error_handler(enum sm_error_reason reason, void *args)
 	return 0;
 }
 
+/*
+ * Fused inputs handed from fusion_task() to state_machine_task().  A
+ * seqlock: the single writer bumps @c seq to odd, copies, bumps it to
+ * even again; a reader retries until it saw the same even value on both
+ * sides of its copy.  Neither side ever blocks the other, and the
+ * semaphore (max count 1) coalesces snapshots the reader has not got to.
+ */
+static struct {
+	atomic_t seq;
+	struct sm_inputs in;
+} fused;
+static K_SEM_DEFINE(fused_sem, 0, 1);
+
+#if defined(CONFIG_IMU)
+/** Set by the control thread to have fusion_task() drop the calibration. */
+static atomic_t attitude_reset_req = ATOMIC_INIT(0);
+#if defined(CONFIG_AURORA_NOTIFY)
+/** Set by fusion_task() once calibrated; the control thread notifies. */
+static atomic_t calibration_notify_req = ATOMIC_INIT(0);
+#endif /* CONFIG_AURORA_NOTIFY */
+#endif /* CONFIG_IMU */
+
+/** @brief Publish @p in as the latest fused snapshot (fusion thread only). */
+static void fused_publish(const struct sm_inputs *in)
+{
+	atomic_inc(&fused.seq);
+	barrier_dmem_fence_full();
+	fused.in = *in;
+	barrier_dmem_fence_full();
+	atomic_inc(&fused.seq);
+
+	k_sem_give(&fused_sem);
+}
+
+/** @brief Copy the latest fused snapshot into @p out. */
+static void fused_read(struct sm_inputs *out)
+{
+	atomic_val_t seq;
+
+	do {
+		seq = atomic_get(&fused.seq);
+		if (seq & 1) {
+			/* Writer is mid-copy on another CPU. */
+			arch_spin_relax();
+			continue;
+		}
+		barrier_dmem_fence_full();
+		*out = fused.in;
+		barrier_dmem_fence_full();
+	} while ((seq & 1) || atomic_get(&fused.seq) != seq);
+}
+
+/**
+ * @brief Convert a sample to the attitude tracker's arithmetic type.
+ *
+ * Avoids a round trip through double when CONFIG_ATTITUDE_FLOAT is set.
+ */
+static inline attitude_real_t sample_to_real(aurora_sample_t s)
+{
+	return (attitude_real_t)s / (attitude_real_t)AURORA_SAMPLE_SCALE;
+}
+
 /**
  * @brief Processes raw IMU data to update orientation, acceleration, and attitude filtering.
  *
- * Calculates delta-time since the last sample, converts raw sensor data to double precision,
+ * Calculates delta-time from the capture timestamps of consecutive samples, converts raw
+ * sensor data to double precision,
  * and updates the attitude estimation filter. Handles sensor calibration tracking while the
  * system is in the ARMED state, and computes vertical acceleration once calibrated.
  *
@@ -315,8 +569,8 @@ int state_machine_error_handler(enum sm_error_reason reason, void *args)
 static void handle_imu(int64_t *last_imu_ns, struct attitude *attitude_state, struct imu_data *imu_data,
 	double orientation[3], double *acceleration, double *accel_vert, bool *imu_ready, bool *calibration_notified)
 {
-	int64_t now_ns = (k_uptime_ticks() * NSEC_PER_SEC) / CONFIG_SYS_CLOCK_TICKS_PER_SEC;
-	/* Delta-time since the last sample, clamped to a sane range; 0.0 on the
+	int64_t now_ns = (int64_t)imu_data->timestamp_ns;
+	/* Delta-time between sample captures, clamped to a sane range; 0.0 on the
 	 * first sample or after a discontinuity. Shared by orientation
 	 * integration and the attitude update below.
 	 */
@@ -325,22 +579,40 @@ static void handle_imu(int64_t *last_imu_ns, struct attitude *attitude_state, st
 		dt_s = 0.0;
 	}
 
-	const double *bias_for_orient = attitude_is_calibrated(attitude_state) ? attitude_state->gyro_bias : NULL;
+	double gyro_bias[ATTITUDE_NUM_AXES];
+	const double *bias_for_orient = NULL;
+
+	if (attitude_is_calibrated(attitude_state)) {
+		for (int i = 0; i < ATTITUDE_NUM_AXES; i++) {
+			gyro_bias[i] = attitude_state->gyro_bias[i];
+		}
+		bias_for_orient = gyro_bias;
+	}
+
+#if defined(CONFIG_ATTITUDE_QUATERNION)
+	/* Once calibrated, orientation comes from the quaternion estimate
+	 * after attitude_update() below instead of a second solve here.
+	 */
+	const bool orient_from_imu = bias_for_orient == NULL;
+#else
+	const bool orient_from_imu = true;
+#endif /* CONFIG_ATTITUDE_QUATERNION */
 
-	if (imu_sensor_value_to_orientation(imu_data, dt_s, bias_for_orient, orientation) == 0
+	if ((!orient_from_imu ||
+	     imu_sensor_value_to_orientation(imu_data, dt_s, bias_for_orient, orientation) == 0)
 		&& imu_sensor_value_to_acceleration(imu_data, acceleration) == 0) {
 		*imu_ready = true;
 	}
 
-	double accel_b[ATTITUDE_NUM_AXES] = {
-		sensor_value_to_double(&imu_data->accel[0]),
-		sensor_value_to_double(&imu_data->accel[1]),
-		sensor_value_to_double(&imu_data->accel[2]),
+	attitude_real_t accel_b[ATTITUDE_NUM_AXES] = {
+		sample_to_real(imu_data->accel[0]),
+		sample_to_real(imu_data->accel[1]),
+		sample_to_real(imu_data->accel[2]),
 	};
-	double gyro_b[ATTITUDE_NUM_AXES] = {
-		sensor_value_to_double(&imu_data->gyro[0]),
-		sensor_value_to_double(&imu_data->gyro[1]),
-		sensor_value_to_double(&imu_data->gyro[2]),
+	attitude_real_t gyro_b[ATTITUDE_NUM_AXES] = {
+		sample_to_real(imu_data->gyro[0]),
+		sample_to_real(imu_data->gyro[1]),
+		sample_to_real(imu_data->gyro[2]),
 	};
 
 	if (!attitude_is_calibrated(attitude_state)) {
@@ -349,8 +621,11 @@ static void handle_imu(int64_t *last_imu_ns, struct attitude *attitude_state, st
 			if (attitude_state->cal_samples >= CONFIG_IMU_CALIBRATION_SAMPLES) {
 				if (attitude_calibrate_finish(attitude_state) == 0) {
 #if defined(CONFIG_AURORA_NOTIFY)
+					/* Keep the notification backends off
+					 * the fusion thread.
+					 */
 					if (!(*calibration_notified)) {
-						notify_calibration_complete();
+						atomic_set(&calibration_notify_req, 1);
 						*calibration_notified = true;
 					}
 #endif /* CONFIG_AURORA_NOTIFY */
@@ -362,20 +637,135 @@ static void handle_imu(int64_t *last_imu_ns, struct attitude *attitude_state, st
 		}
 		*accel_vert = 0.0;
 	} else if (dt_s > 0.0) {
-		double a_v;
-		if (attitude_update(attitude_state, accel_b, gyro_b, dt_s, &a_v) == 0) {
+		attitude_real_t a_v;
+		uint32_t t = sm_prof_begin();
+		int rc = attitude_update(attitude_state, accel_b, gyro_b, dt_s, &a_v);
+
+		sm_prof_end(SM_PROF_ATTITUDE, t);
+		if (rc == 0) {
 			*accel_vert = a_v;
+#if defined(CONFIG_ATTITUDE_QUATERNION)
+			attitude_real_t o[ATTITUDE_NUM_AXES];
+
+			if (attitude_orientation(attitude_state, o) == 0) {
+				for (int i = 0; i < ATTITUDE_NUM_AXES; i++) {
+					orientation[i] = o[i];
+				}
+			}
+#endif /* CONFIG_ATTITUDE_QUATERNION */
 		}
 	}
 	*last_imu_ns = now_ns;
 }
 
+#if CONFIG_SM_DECISION_RATE_HZ > 0
+#if defined(CONFIG_SM_DECISION_ON_CROSSING)
+/** @brief True if @p threshold lies between @p a and @p b (either way). */
+static inline bool crossed(double a, double b, int threshold)
+{
+	return (a < threshold) != (b < threshold);
+}
+#endif /* CONFIG_SM_DECISION_ON_CROSSING */
+
+/**
+ * @brief Decides whether this batch of inputs runs the state machine.
+ *
+ * Due once per CONFIG_SM_DECISION_RATE_HZ period and, with
+ * CONFIG_SM_DECISION_ON_CROSSING, as soon as arm/log status changes or
+ * a flight threshold is crossed relative to the last decided inputs.
+ *
+ * @param[in] in Inputs assembled for this batch.
+ * @return true to call sm_update(), false to only fuse the inputs.
+ */
+static bool sm_decision_due(const struct sm_inputs *in)
+{
+	static const int64_t period = (int64_t)DIV_ROUND_UP(CONFIG_SYS_CLOCK_TICKS_PER_SEC,
+							     CONFIG_SM_DECISION_RATE_HZ);
+	static int64_t next_ticks;
+	static struct sm_inputs decided;
+	const int64_t now = k_uptime_ticks();
+	bool due = now >= next_ticks;
+
+#if defined(CONFIG_SM_DECISION_ON_CROSSING)
+	due = due || in->armed != decided.armed || in->log_ready != decided.log_ready ||
+	      crossed(decided.acceleration, in->acceleration, state_cfg.T_AB) ||
+	      crossed(decided.acceleration, in->acceleration, state_cfg.T_BB) ||
+	      crossed(decided.altitude, in->altitude, state_cfg.T_H) ||
+	      crossed(decided.altitude, in->altitude, state_cfg.T_M);
+#endif /* CONFIG_SM_DECISION_ON_CROSSING */
+
+	if (due) {
+		next_ticks = now + period;
+		decided = *in;
+	}
+	return due;
+}
+#endif /* CONFIG_SM_DECISION_RATE_HZ > 0 */
+
+#if defined(CONFIG_PYRO)
+/* Channels with a pyro_fire_at() whose timing is not logged yet. */
+static uint32_t pyro_fire_pending;
+
+/**
+ * @brief Fires @p ch of @p pyro0 @p delay_us from now, from a timer ISR.
+ *
+ * Drivers without timed fires trigger inline for a zero delay.
+ *
+ * @retval 0 once the fire is scheduled or done, negative errno otherwise.
+ */
+static int pyro_fire(const struct device *pyro0, uint32_t ch, uint32_t delay_us)
+{
+	int rc = pyro_fire_at(pyro0, ch, delay_us);
+
+	if (rc == -ENOSYS && delay_us == 0U)
+		return pyro_trigger_channel(pyro0, ch);
+	if (rc == 0)
+		pyro_fire_pending |= BIT(ch);
+	return rc;
+}
+
+static int pyro_fire_now(const struct device *pyro0, uint32_t ch)
+{
+	return pyro_fire(pyro0, ch, 0);
+}
+
+/**
+ * @brief Logs the command-to-fire timing of completed timed fires.
+ *
+ * @param[in] pyro0 Pointer to the Zephyr device structure for the pyro hardware.
+ */
+static void pyro_log_fires(const struct device *pyro0)
+{
+	struct pyro_fire_timing t;
+
+	for (uint32_t ch = 0; ch < 32 && pyro_fire_pending; ch++) {
+		if (!(pyro_fire_pending & BIT(ch)))
+			continue;
+
+		int rc = pyro_fire_timing(pyro0, ch, &t);
+
+		if (rc == -EINPROGRESS)
+			continue;
+		pyro_fire_pending &= ~BIT(ch);
+		/* -ENODATA: cancelled by a disarm. */
+		if (rc != 0)
+			continue;
+
+		LOG_INF("pyro0 channel %u fired %llu us after command (delay %u us)",
+			ch, (unsigned long long)((t.fire_ns - t.command_ns) / NSEC_PER_USEC),
+			t.delay_us);
+		log_pyro_fire(ch, &t);
+	}
+}
+#endif /* CONFIG_PYRO */
+
 /**
  * @brief Handles pyrotechnic channel actions based on flight state transitions.
  *
  * Checks if a state change occurred, and triggers, arms, charges, or disarms
  * the pyro channels accordingly. Tracks the internal pyro subsystem state
- * to avoid redundant hardware calls.
+ * to avoid redundant hardware calls. Fires go through pyro_fire_at(), so
+ * their command-to-fire latency ends up in the flight log.
  *
  * @param[in]     state      The current state of the flight state machine.
  * @param[in,out] pyro_state Pointer to the previously processed pyro state.
@@ -384,6 +774,11 @@ static void handle_imu(int64_t *last_imu_ns, struct attitude *attitude_state, st
 static void handle_pyro(enum sm_state state, enum sm_state *pyro_state, const struct device *pyro0)
 {
 #if defined(CONFIG_PYRO)
+	/* The REDUNDANT re-trigger is already scheduled. */
+	static bool redundant_prearmed;
+
+	pyro_log_fires(pyro0);
+
 	if (state == *pyro_state)
 		return;
 
@@ -401,24 +796,40 @@ static void handle_pyro(enum sm_state state, enum sm_state *pyro_state, const st
 	 * channels safe while the operator sorts out the error condition.
 	 */
 	case SM_ERROR:
+		/* Disarming also cancels a pre-armed fire. */
 		PYRO_ACT(pyro_disarm, 0, "Disarmed", "disarm");
 		PYRO_ACT(pyro_disarm, 1, "Disarmed", "disarm");
+		redundant_prearmed = false;
 		break;
 	case SM_ARMED:
 		PYRO_ACT(pyro_arm, 0, "Armed", "arm");
 		PYRO_ACT(pyro_arm, 1, "Armed", "arm");
 		break;
 	case SM_APOGEE:
-		PYRO_ACT(pyro_trigger_channel, 0, "Triggered", "trigger");
+		PYRO_ACT(pyro_fire_now, 0, "Triggered", "trigger");
 			/* Capacitors are empty after trigger. Recharge! */
 		PYRO_ACT(pyro_charge_channel, 1, "Charging", "charge");
 		break;
 	case SM_MAIN:
-		PYRO_ACT(pyro_trigger_channel, 1, "Triggered", "trigger");
+		PYRO_ACT(pyro_fire_now, 1, "Triggered", "trigger");
+		/* Log this fire before the channel is scheduled again. */
+		pyro_log_fires(pyro0);
 			/* Capacitors are empty after trigger. Recharge! */
 		PYRO_ACT(pyro_charge_channel, 1, "Recharging", "recharge");
+#if defined(CONFIG_PYRO_PREARM_REDUNDANT)
+		/* MAIN always ends in REDUNDANT after TO_M. */
+		redundant_prearmed = pyro_fire(pyro0, 1, (uint32_t)state_cfg.TO_M * USEC_PER_MSEC) == 0;
+		if (redundant_prearmed)
+			LOG_INF("Re-trigger of pyro0 channel 1 pre-armed in %d ms", state_cfg.TO_M);
+		else
+			LOG_WRN("Could not pre-arm pyro0 channel 1, re-triggering on REDUNDANT");
+#endif /* CONFIG_PYRO_PREARM_REDUNDANT */
+		break;
+	case SM_REDUNDANT:
+		if (!redundant_prearmed)
+			PYRO_ACT(pyro_fire_now, 1, "Re-triggered", "re-trigger");
+		redundant_prearmed = false;
 		break;
-	case SM_REDUNDANT: PYRO_ACT(pyro_trigger_channel, 1, "Re-triggered", "re-trigger"); break;
 	default: break;
 	}
 #undef PYRO_ACT
@@ -426,8 +837,7 @@ static void handle_pyro(enum sm_state state, enum sm_state *pyro_state, const st
 #endif /* CONFIG_PYRO */
 }
 
-static void handle_state_transition(enum sm_state prev_state, enum sm_state state, struct attitude *attitude_state,
-	int64_t *last_imu_ns, bool *calibration_notified, double orientation[3])
+static void handle_state_transition(enum sm_state prev_state, enum sm_state state)
 {
 #if defined(CONFIG_AURORA_FAKE_SENSORS)
 	__ASSERT(is_valid_transition(prev_state, state),
@@ -435,82 +845,181 @@ static void handle_state_transition(enum sm_state prev_state, enum sm_state stat
 		sm_state_str(prev_state),
 		sm_state_str(state));
 #endif /* CONFIG_AURORA_FAKE_SENSORS */
+#if defined(CONFIG_SENSOR_IDLE_RATES)
+	/* Ramp up before anything else on ARMED: calibration starts now. */
+	sensor_rates_set(state == SM_IDLE);
+#endif /* CONFIG_SENSOR_IDLE_RATES */
 #if defined(CONFIG_AURORA_NOTIFY)
 	notify_state_change(prev_state, state);
 #endif /* CONFIG_AURORA_NOTIFY */
 #if defined(CONFIG_IMU)
-			/* On return to IDLE, discard calibration so a re-arm
-			 * triggers a fresh stationary calibration window.
-			 */
+	/* On return to IDLE, discard calibration so a re-arm triggers a
+	 * fresh stationary calibration window.  The tracker belongs to the
+	 * fusion thread, which performs the reset before its next sample.
+	 */
 	if (state == SM_IDLE) {
-		attitude_init(attitude_state);
-		*last_imu_ns = 0;
-		*calibration_notified = false;
-		orientation[2] = 0.0;
+		atomic_set(&attitude_reset_req, 1);
 	}
 #endif /* CONFIG_IMU */
 	log_handle_flight_lifecycle(prev_state, state);
 }
 
+#if defined(CONFIG_IMU) && CONFIG_IMU_INSTANCES > 1
+#define VOTE_IMU 1
+#endif
+#if defined(CONFIG_BARO) && CONFIG_BARO_INSTANCES > 1
+#define VOTE_BARO 1
+#endif
+
+#if (defined(VOTE_IMU) || defined(VOTE_BARO)) && !defined(CONFIG_SENSOR_VOTE)
+#error "Redundant IMUs or barometers need CONFIG_SENSOR_VOTE."
+#endif
+
+#if defined(VOTE_IMU) || defined(VOTE_BARO)
 /**
- * @brief State machine thread.
+ * @brief Reports instances that dropped out of or rejoined the vote.
  *
- * Waits for IMU and barometer readiness, then runs the flight state machine
- * at 10 Hz. Fires pyro channels on the appropriate state transitions.
+ * @param[in]     v       Voting state after the last submit.
+ * @param[in]     what    Sensor type for the log line.
+ * @param[in,out] healthy Instances that were healthy on the last call.
  */
-void state_machine_task(void *, void *, void *)
+static void vote_report(const struct sensor_vote *v, const char *what, uint32_t *healthy)
+{
+	for (uint8_t i = 0; i < SENSOR_VOTE_MAX_INSTANCES; i++) {
+		const bool now = sensor_vote_healthy(v, i);
+
+		if (now == ((*healthy & BIT(i)) != 0)) {
+			continue;
+		}
+		if (now) {
+			LOG_INF("%s %u agrees again, back in the vote", what, i);
+		} else {
+			LOG_WRN("%s %u disagrees with the others, voted out", what, i);
+		}
+		*healthy ^= BIT(i);
+	}
+}
+#endif /* VOTE_IMU || VOTE_BARO */
+
+#if defined(VOTE_IMU)
+/** Per-channel tolerance: accel x/y/z in m/s^2, then gyro x/y/z in rad/s. */
+static const double imu_vote_tol[2 * IMU_NUM_AXES] = {
+	CONFIG_SENSOR_VOTE_IMU_ACCEL_TOL,
+	CONFIG_SENSOR_VOTE_IMU_ACCEL_TOL,
+	CONFIG_SENSOR_VOTE_IMU_ACCEL_TOL,
+	CONFIG_SENSOR_VOTE_IMU_GYRO_TOL * (M_PI / 180.0),
+	CONFIG_SENSOR_VOTE_IMU_GYRO_TOL * (M_PI / 180.0),
+	CONFIG_SENSOR_VOTE_IMU_GYRO_TOL * (M_PI / 180.0),
+};
+
+/**
+ * @brief Votes on one IMU sample.
+ *
+ * @param[in,out] v   IMU voting state.
+ * @param[in,out] imu Sample of any instance; replaced by the median of
+ *                    the round when true is returned.
+ * @return true if @p imu now holds a voted sample for the filter.
+ */
+static bool vote_imu(struct sensor_vote *v, struct imu_data *imu)
+{
+	double x[2 * IMU_NUM_AXES];
+	double out[2 * IMU_NUM_AXES];
+
+	for (int i = 0; i < IMU_NUM_AXES; i++) {
+		x[i] = aurora_sample_to_double(imu->accel[i]);
+		x[IMU_NUM_AXES + i] = aurora_sample_to_double(imu->gyro[i]);
+	}
+
+	if (sensor_vote_submit(v, imu->instance, imu->timestamp_ns, x, out) != 1) {
+		return false;
+	}
+
+	for (int i = 0; i < IMU_NUM_AXES; i++) {
+		imu->accel[i] = aurora_sample_from_double(out[i]);
+		imu->gyro[i]  = aurora_sample_from_double(out[IMU_NUM_AXES + i]);
+	}
+	return true;
+}
+#endif /* VOTE_IMU */
+
+#if defined(VOTE_BARO)
+/** Pressure tolerance in kPa; temperature is not voted on. */
+static const double baro_vote_tol[1] = {
+	CONFIG_SENSOR_VOTE_BARO_TOL_PA / 1000.0,
+};
+
+/**
+ * @brief Votes on one barometer sample.
+ *
+ * @param[in,out] v    Barometer voting state.
+ * @param[in]     baro Sample of any instance.
+ * @return true if @p baro agrees with the other barometers.
+ */
+static bool vote_baro(struct sensor_vote *v, const struct baro_data *baro)
+{
+	const double x = aurora_sample_to_double(baro->pressure);
+	double out;
+
+	return sensor_vote_submit(v, baro->instance, baro->timestamp_ns, &x, &out) == 1;
+}
+#endif /* VOTE_BARO */
+
+/**
+ * @brief Fusion thread.
+ *
+ * Owns the sensor subscription and everything that has to run per
+ * sample: attitude tracking, altitude conversion, raw logging and the
+ * input filter (sm_fuse()).  Each batch of fresh IMU and baro data is
+ * published as one sm_inputs snapshot for the control thread, so a slow
+ * notification, audit write or pyro action there never delays fusion.
+ *
+ * With redundant sensors every sample is voted on first (see
+ * sensor_vote.h): IMUs give one median sample per polling round,
+ * barometers pass each sample that agrees with the others, so
+ * interleaved barometers multiply the altitude rate.  Only voted
+ * samples are logged and reach the attitude tracker and the filter.
+ */
+void fusion_task(void *, void *, void *)
 {
-	enum sm_state state;
-	enum sm_state prev_state = SM_IDLE;
 	const struct zbus_channel *data_chan;
 	union {
 		struct imu_data imu;
 		struct baro_data baro;
 	} msg_buf;
 	double altitude = 0.0;
+	uint64_t altitude_ns = 0;
 	double acceleration = 0.0;
 	double accel_vert = 0.0;
 	double orientation[] = {0.0, 0.0, 0.0};
 	bool baro_ready = false;
 	bool imu_ready = false;
-
-	struct sm_error_handling_args sm_error_handler = {
-		.cb = &state_machine_error_handler,
-		.args = NULL,
-	};
-
-	struct sm_inputs inputs = {
-		.armed = armed,
-		.acceleration = acceleration,
-		.accel_vert = accel_vert,
-	};
-	memcpy(inputs.orientation, orientation, sizeof(inputs.orientation));
+	struct sm_inputs inputs;
 #if defined(CONFIG_IMU)
-	static struct attitude attitude_state;
+	static struct attitude attitude_state __aurora_fast;
 	int64_t last_imu_ns = 0;
 	bool calibration_notified = false;
 
 	attitude_init(&attitude_state);
 #endif /* CONFIG_IMU */
-
-#if defined(CONFIG_PYRO)
-	const struct device *pyro0 = DEVICE_DT_GET(DT_CHOSEN(auxspace_pyro));
-	enum sm_state pyro_state = SM_IDLE;
-
-	while (!device_is_ready(pyro0)) {
-		LOG_ERR("Pyro device %s is not ready, trying again ...", pyro0->name);
-		k_sleep(K_SECONDS(1));
-	}
-#else
-	const struct device *pyro0 = NULL;
-	enum sm_state pyro_state = SM_IDLE;
-#endif /*.CONFIG_PYRO */
-
-	sm_init(&state_cfg, &sm_error_handler);
-	sm_active = true;
-
-	/* TODO: Add idling */
-	while (!baro_active || !imu_active) {
+#if defined(VOTE_IMU)
+	static struct sensor_vote imu_vote;
+	uint32_t imu_healthy = BIT_MASK(CONFIG_IMU_INSTANCES);
+
+	(void)sensor_vote_init(&imu_vote, SENSOR_VOTE_MEDIAN, CONFIG_IMU_INSTANCES,
+			       ARRAY_SIZE(imu_vote_tol), imu_vote_tol,
+			       (uint64_t)CONFIG_SENSOR_VOTE_MAX_AGE_MS * NSEC_PER_MSEC);
+#endif /* VOTE_IMU */
+#if defined(VOTE_BARO)
+	static struct sensor_vote baro_vote;
+	uint32_t baro_healthy = BIT_MASK(CONFIG_BARO_INSTANCES);
+
+	(void)sensor_vote_init(&baro_vote, SENSOR_VOTE_PASS, CONFIG_BARO_INSTANCES,
+			       ARRAY_SIZE(baro_vote_tol), baro_vote_tol,
+			       (uint64_t)CONFIG_SENSOR_VOTE_MAX_AGE_MS * NSEC_PER_MSEC);
+#endif /* VOTE_BARO */
+
+	/* sm_fuse() needs the filter that sm_init() sets up. */
+	while (!sm_active || !baro_active || !imu_active) {
 		k_sleep(K_MSEC(100));
 	}
 
@@ -520,12 +1029,33 @@ void state_machine_task(void *, void *, void *)
 			continue;
 		}
 
+#if defined(CONFIG_IMU)
+		if (atomic_cas(&attitude_reset_req, 1, 0)) {
+			attitude_init(&attitude_state);
+			last_imu_ns = 0;
+			calibration_notified = false;
+			orientation[2] = 0.0;
+		}
+#endif /* CONFIG_IMU */
+
+		const uint32_t t_batch = sm_prof_begin();
+
 		/* Process the first message, then drain any queued messages
 		 * so we always work with the latest sensor data.
 		 */
 		do {
 			if (data_chan == &imu_data_chan) {
 #if defined(CONFIG_IMU)
+#if defined(VOTE_IMU)
+				const bool voted = vote_imu(&imu_vote, &msg_buf.imu);
+
+				vote_report(&imu_vote, "IMU", &imu_healthy);
+				if (!voted) {
+					continue;
+				}
+#endif /* VOTE_IMU */
+				uint32_t t = sm_prof_begin();
+
 				handle_imu(&last_imu_ns,
 					&attitude_state,
 					&msg_buf.imu,
@@ -534,13 +1064,28 @@ void state_machine_task(void *, void *, void *)
 					&accel_vert,
 					&imu_ready,
 					&calibration_notified);
+				sm_prof_end(SM_PROF_IMU, t);
+				t = sm_prof_begin();
 				log_imu_data(&msg_buf.imu);
+				sm_prof_end(SM_PROF_LOG, t);
 #endif
 #if defined(CONFIG_BARO)
 			} else if (data_chan == &baro_data_chan) {
+#if defined(VOTE_BARO)
+				const bool voted = vote_baro(&baro_vote, &msg_buf.baro);
+
+				vote_report(&baro_vote, "Baro", &baro_healthy);
+				if (!voted) {
+					continue;
+				}
+#endif /* VOTE_BARO */
+				uint32_t t = sm_prof_begin();
+
 				log_baro_data(&msg_buf.baro);
+				sm_prof_end(SM_PROF_LOG, t);
 
-				if (baro_sensor_value_to_altitude(&msg_buf.baro.pressure, &altitude) == 0) {
+				if (baro_sample_to_altitude(msg_buf.baro.pressure, &altitude) == 0) {
+					altitude_ns = msg_buf.baro.timestamp_ns;
 					baro_ready = true;
 				}
 #endif
@@ -568,41 +1113,108 @@ void state_machine_task(void *, void *, void *)
 			.acceleration = acceleration,
 			.accel_vert = accel_vert,
 			.altitude = altitude,
+			.timestamp_ns = altitude_ns,
 		};
 		memcpy(inputs.orientation, orientation, sizeof(inputs.orientation));
 
+		sm_fuse(&inputs);
+		fused_publish(&inputs);
+		sm_prof_end(SM_PROF_FUSION, t_batch);
+
+		/* reset the measurements */
+		baro_ready = false;
+		imu_ready = false;
+	}
+}
+
+/**
+ * @brief State machine (control) thread.
+ *
+ * Waits for fused snapshots from fusion_task() and runs the flight
+ * decisions on the latest one: sm_update(), state publishing, transition
+ * side effects and the pyro channels.  Snapshots that arrive while this
+ * thread is busy are coalesced, never queued.
+ */
+void state_machine_task(void *, void *, void *)
+{
+	enum sm_state state;
+	enum sm_state prev_state = SM_IDLE;
+	struct sm_inputs inputs;
+
+	struct sm_error_handling_args sm_error_handler = {
+		.cb = &state_machine_error_handler,
+		.args = NULL,
+	};
+
+#if defined(CONFIG_PYRO)
+	const struct device *pyro0 = DEVICE_DT_GET(DT_CHOSEN(auxspace_pyro));
+	enum sm_state pyro_state = SM_IDLE;
+
+	while (!device_is_ready(pyro0)) {
+		LOG_ERR("Pyro device %s is not ready, trying again ...", pyro0->name);
+		k_sleep(K_SECONDS(1));
+	}
+#else
+	const struct device *pyro0 = NULL;
+	enum sm_state pyro_state = SM_IDLE;
+#endif /*.CONFIG_PYRO */
+
+	sm_init(&state_cfg, &sm_error_handler);
+	sm_active = true;
+
+	while (1) {
+		k_sem_take(&fused_sem, K_FOREVER);
+		fused_read(&inputs);
+
+#if defined(CONFIG_IMU) && defined(CONFIG_AURORA_NOTIFY)
+		if (atomic_cas(&calibration_notify_req, 1, 0)) {
+			notify_calibration_complete();
+		}
+#endif /* CONFIG_IMU && CONFIG_AURORA_NOTIFY */
+
+#if CONFIG_SM_DECISION_RATE_HZ > 0
+		/* Fusion already ran; decide and publish at the decision rate. */
+		if (!sm_decision_due(&inputs)) {
+			continue;
+		}
+#endif /* CONFIG_SM_DECISION_RATE_HZ > 0 */
+
+		const uint32_t t_step = sm_prof_begin();
+		uint32_t t;
+
 		sm_update(&inputs);
 		state = sm_get_state();
 		LOG_DBG("STATE = %d", state);
 
+		/* Pyro first: nothing else on this step may delay a fire. */
+		t = sm_prof_begin();
+		handle_pyro(state, &pyro_state, pyro0);
+		sm_prof_end(SM_PROF_PYRO, t);
+
 		/*update pad link data*/
+		t = sm_prof_begin();
 		update_pad_link_data();
+		sm_prof_end(SM_PROF_PAD_LINK, t);
+		t = sm_prof_begin();
+		update_telemetry_data();
+		sm_prof_end(SM_PROF_TELEMETRY, t);
 
+		t = sm_prof_begin();
 		log_flight_telemetry();
 		log_vbat_telemetry();
+		sm_prof_end(SM_PROF_LOG, t);
 
 		if (state != prev_state) {
-#if defined(CONFIG_IMU)
-			handle_state_transition(prev_state,
-				state,
-				&attitude_state,
-				&last_imu_ns,
-				&calibration_notified,
-				orientation);
-#else
-			handle_state_transition(prev_state, state, NULL, NULL, NULL, orientation);
-#endif
+			handle_state_transition(prev_state, state);
 			prev_state = state;
 		}
-
-		/* reset the measurements */
-		baro_ready = false;
-		imu_ready = false;
-
-		handle_pyro(state, &pyro_state, pyro0);
+		sm_prof_end(SM_PROF_CONTROL, t_step);
 	}
 }
 
+/* Fusion outranks control so a busy decision never delays a sample. */
+K_THREAD_DEFINE(fusion, 4096, fusion_task, NULL, NULL, NULL, 5, 0, 0);
+
 /* Create the State machine task */
 K_THREAD_DEFINE(state_machine, 4096, state_machine_task, NULL, NULL, NULL, 6, 0, 0);
 #endif /* CONFIG_AURORA_STATE_MACHINE */
@@ -651,6 +1263,15 @@ int main(void)
 #if defined(CONFIG_BARO)
 	pl_caps |= PL_CAP_BARO | PL_CAP_TEMP_INNER;
 #endif /* CONFIG_BARO */
+#if defined(CONFIG_PYRO)
+	/* Continuity and charge, from the driver's cached ADC samples. */
+	const struct device *pl_pyro = DEVICE_DT_GET(DT_CHOSEN(auxspace_pyro));
+	struct pyro_channel_status pl_pyro_st;
+
+	if (device_is_ready(pl_pyro) &&
+	    pyro_get_status(pl_pyro, 0, &pl_pyro_st) != -ENOSYS)
+		pl_caps |= PL_CAP_PYRO;
+#endif /* CONFIG_PYRO */
 	pad_link_set_caps(pl_caps);
 	(void)pad_link_init();
 #endif /* CONFIG_AURORA_PAD_LINK */
@@ -0,0 +1,371 @@
+/**
+ * @file replay_file.c
+ * @brief Replay input mapped from a host file on native_sim.
+ *
+ * With CONFIG_AURORA_FAKE_SENSORS_REPLAY_FILE the merged replay thread
+ * (see fake_sensors_replay.c) reads its samples from the file passed as
+ * `--replay-file=<path>` instead of tables compiled into the image, so
+ * swapping flights needs no rebuild. Two layouts are accepted:
+ *
+ *  - a replay file written by `gen_flight_replay.py --format bin`: a
+ *    struct replay_file_header followed by struct replay_file_record
+ *    samples in timestamp order;
+ *  - a raw aurora_bin flight log, i.e. an image of the disk backend's
+ *    flight-log region, with fixed (v2) frames. The flight in slot 0
+ *    is walked in seq order; the frame size is detected from the
+ *    second frame unless `--replay-frame-size` is given.
+ *
+ * Samples are read straight from the mapping and pages behind the read
+ * cursor are handed back to the host every REPLAY_DROP_STEP bytes, so
+ * memory use stays flat however large the file is.
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "fake_sensors_replay.h"
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+#include <aurora/lib/data_logger.h>
+
+#include "cmdline.h"
+#include <posix_native_task.h>
+
+LOG_MODULE_DECLARE(fake_sensors_replay, CONFIG_SENSOR_BOARD_LOG_LEVEL);
+
+/* native/replay_file_bottom.c, linked into the runner. */
+int replay_file_host_map(const char *path, const void **base, size_t *len);
+void replay_file_host_drop(const void *base, size_t from, size_t to);
+
+/** Magic of a replay file written by gen_flight_replay.py. */
+#define REPLAY_FILE_MAGIC "ARPL"
+#define REPLAY_FILE_VERSION 1U
+
+/** Replay file header (24 bytes). */
+struct replay_file_header {
+	char     magic[4];	/**< @ref REPLAY_FILE_MAGIC */
+	uint16_t version;	/**< @ref REPLAY_FILE_VERSION */
+	uint16_t reserved0;	/**< Zero */
+	uint32_t count;		/**< Records after the header */
+	uint32_t reserved1;	/**< Zero */
+	uint64_t span_ns;	/**< Time of the last record */
+};
+
+/** One sample (24 bytes), rebased so the first one is at t=0. */
+struct replay_file_record {
+	uint64_t t_ns;
+	uint8_t  type;		/**< AURORA_DATA_BARO, _IMU_ACCEL or _IMU_GYRO */
+	uint8_t  reserved[3];	/**< Zero */
+	float    v[3];		/**< Channels in data logger order */
+};
+
+BUILD_ASSERT(sizeof(struct replay_file_header) == 24 &&
+	     sizeof(struct replay_file_record) == 24,
+	     "layout shared with tools/gen_flight_replay.py");
+
+/** Bytes consumed between two releases of the pages behind the cursor. */
+#define REPLAY_DROP_STEP (1U << 20)
+
+/** Frame sizes tried when detecting the layout of an aurora_bin log. */
+#define REPLAY_FRAME_MIN 64U
+#define REPLAY_FRAME_MAX 65536U
+
+static char *replay_path;
+static uint32_t replay_frame_size;
+
+static const uint8_t *map;
+static size_t map_len;
+static size_t dropped;
+static bool is_bin;
+
+/* Replay file */
+static const struct replay_file_record *recs;
+static size_t rec_count;
+static uint64_t rec_span_ns;
+
+/* Both layouts */
+static size_t rec_idx;
+static struct replay_imu_sample last_gyro;
+
+/* aurora_bin log */
+static uint64_t bin_flight_id;
+static uint32_t bin_seq0;
+static size_t frame_off;
+static uint32_t frame_seq;
+static uint64_t bin_t0;
+static bool bin_t0_set;
+
+static void replay_file_options(void)
+{
+	static struct args_struct_t opts[] = {
+		{
+			.option = "replay-file",
+			.name = "path",
+			.type = 's',
+			.dest = (void *)&replay_path,
+			.descript = "Replay file or aurora_bin flight log "
+				    "to feed the fake sensors from",
+		},
+		{
+			.option = "replay-frame-size",
+			.name = "bytes",
+			.type = 'u',
+			.dest = (void *)&replay_frame_size,
+			.descript = "Frame size of an aurora_bin replay log "
+				    "(default: detected)",
+		},
+		ARG_TABLE_ENDMARKER
+	};
+
+	native_add_command_line_opts(opts);
+}
+
+NATIVE_TASK(replay_file_options, PRE_BOOT_1, 1);
+
+/* Hand the pages before @p off back to the host once enough piled up. */
+static void release_upto(size_t off)
+{
+	if (off >= dropped + REPLAY_DROP_STEP) {
+		replay_file_host_drop(map, dropped, off);
+		dropped = off;
+	}
+}
+
+static float sv_float(int32_t val1, int32_t val2)
+{
+	return (float)val1 + (float)val2 / 1000000.0f;
+}
+
+/*
+ * Turn one sample of @p type at @p t_ns into @p ev. Gyro samples only
+ * update the rate the next accel sample is published with, so they
+ * yield no event; neither do types the replay does not publish.
+ */
+static bool sample_to_event(uint8_t type, uint64_t t_ns, const float v[3],
+			    struct replay_event *ev)
+{
+	struct replay_imu_sample s = {
+		.t_ns = t_ns, .x = v[0], .y = v[1], .z = v[2],
+	};
+
+	switch (type) {
+	case AURORA_DATA_IMU_GYRO:
+		last_gyro = s;
+		return false;
+	case AURORA_DATA_IMU_ACCEL:
+		ev->is_baro = false;
+		ev->accel = s;
+		ev->gyro = last_gyro;
+		break;
+	case AURORA_DATA_BARO:
+		/* Channels: [0] temperature, [1] pressure. */
+		ev->is_baro = true;
+		ev->baro.t_ns = t_ns;
+		ev->baro.temp_c = v[0];
+		ev->baro.pres_kpa = v[1];
+		break;
+	default:
+		return false;
+	}
+	ev->t_ns = t_ns;
+	return true;
+}
+
+static int file_open(void)
+{
+	const struct replay_file_header *h = (const void *)map;
+
+	if (h->version != REPLAY_FILE_VERSION) {
+		LOG_ERR("Replay: %s has version %u, expected %u", replay_path,
+			h->version, REPLAY_FILE_VERSION);
+		return -ENOTSUP;
+	}
+	if (h->count == 0U ||
+	    (map_len - sizeof(*h)) / sizeof(*recs) < h->count) {
+		LOG_ERR("Replay: %s is truncated or empty", replay_path);
+		return -EINVAL;
+	}
+
+	recs = (const void *)(map + sizeof(*h));
+	rec_count = h->count;
+	rec_span_ns = h->span_ns;
+	LOG_INF("Replay: %s, %zu samples over %.2f s", replay_path, rec_count,
+		(double)rec_span_ns / 1e9);
+	return 0;
+}
+
+static bool file_next(struct replay_event *ev)
+{
+	while (rec_idx < rec_count) {
+		const struct replay_file_record *r = &recs[rec_idx++];
+
+		release_upto((size_t)((const uint8_t *)r - map));
+		if (sample_to_event(r->type, r->t_ns, r->v, ev)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/* Whether @p fh is the frame the walk of the slot-0 flight expects. */
+static bool bin_frame_follows(const struct aurora_bin_frame_header *fh,
+			      uint32_t seq)
+{
+	return memcmp(fh->magic, AURORA_BIN_FRAME_MAGIC,
+		      sizeof(fh->magic)) == 0 &&
+	       fh->flight_id == bin_flight_id && fh->seq == seq;
+}
+
+static int bin_open(void)
+{
+	const struct aurora_bin_frame_header *fh = (const void *)map;
+
+	if (fh->version != AURORA_BIN_VERSION_FIXED) {
+		LOG_ERR("Replay: %s holds v%u frames, only v%u is mapped "
+			"directly; convert it to a replay file first",
+			replay_path, fh->version, AURORA_BIN_VERSION_FIXED);
+		return -ENOTSUP;
+	}
+	bin_flight_id = fh->flight_id;
+	bin_seq0 = fh->seq;
+
+	if (replay_frame_size == 0U) {
+		for (size_t fs = REPLAY_FRAME_MIN;
+		     fs <= REPLAY_FRAME_MAX && fs + sizeof(*fh) <= map_len;
+		     fs <<= 1) {
+			if (bin_frame_follows((const void *)(map + fs),
+					      bin_seq0 + 1U)) {
+				replay_frame_size = fs;
+				break;
+			}
+		}
+	}
+	if (replay_frame_size <= sizeof(*fh) || replay_frame_size > map_len) {
+		LOG_ERR("Replay: cannot tell the frame size of %s, "
+			"pass --replay-frame-size", replay_path);
+		return -EINVAL;
+	}
+
+	is_bin = true;
+	LOG_INF("Replay: %s, aurora_bin flight %llu, %u-byte frames",
+		replay_path, (unsigned long long)bin_flight_id,
+		replay_frame_size);
+	return 0;
+}
+
+/* Rebase @p rec like gen_flight_replay.py and hand it to sample_to_event(). */
+static bool bin_record_to_event(const struct aurora_bin_frame_header *fh,
+				const struct aurora_bin_record *rec,
+				struct replay_event *ev)
+{
+	uint64_t ts = fh->base_ts_ns + (uint64_t)rec->ts_delta_us * 1000ULL;
+	float v[3];
+
+	if (rec->type != AURORA_DATA_IMU_ACCEL &&
+	    rec->type != AURORA_DATA_IMU_GYRO &&
+	    rec->type != AURORA_DATA_BARO) {
+		return false;
+	}
+	if (!bin_t0_set) {
+		bin_t0 = ts;
+		bin_t0_set = true;
+	}
+	for (int i = 0; i < 3; i++) {
+		v[i] = sv_float(rec->channels[i].val1, rec->channels[i].val2);
+	}
+	return sample_to_event(rec->type, ts > bin_t0 ? ts - bin_t0 : 0, v, ev);
+}
+
+static bool bin_next(struct replay_event *ev)
+{
+	const size_t fs = replay_frame_size;
+
+	while (frame_off + fs <= map_len) {
+		const struct aurora_bin_frame_header *fh =
+			(const void *)(map + frame_off);
+
+		if (!bin_frame_follows(fh, frame_seq) ||
+		    fh->version != AURORA_BIN_VERSION_FIXED) {
+			return false; /* end of the flight */
+		}
+
+		const size_t end = fs - ((fh->reserved0 & AURORA_BIN_FLAG_CRC) != 0U ?
+					 AURORA_BIN_CRC_SIZE : 0U);
+		const size_t n = (end - sizeof(*fh)) / sizeof(struct aurora_bin_record);
+		const struct aurora_bin_record *recs =
+			(const void *)(map + frame_off + sizeof(*fh));
+
+		while (rec_idx < n) {
+			const struct aurora_bin_record *rec = &recs[rec_idx++];
+
+			if (rec->type == 0xFFU) {
+				rec_idx = n;
+				break;
+			}
+			if (bin_record_to_event(fh, rec, ev)) {
+				return true;
+			}
+		}
+
+		frame_off += fs;
+		frame_seq++;
+		rec_idx = 0;
+		release_upto(frame_off);
+	}
+	return false;
+}
+
+/* replay_source_open – see fake_sensors_replay.h */
+int replay_source_open(void)
+{
+	if (replay_path == NULL) {
+		LOG_ERR("Replay: no input, pass --replay-file=<path>");
+		return -EINVAL;
+	}
+	if (replay_file_host_map(replay_path, (const void **)&map,
+				 &map_len) != 0) {
+		LOG_ERR("Replay: cannot map %s", replay_path);
+		return -ENOENT;
+	}
+
+	if (map_len >= sizeof(struct replay_file_header) &&
+	    memcmp(map, REPLAY_FILE_MAGIC, 4) == 0) {
+		return file_open();
+	}
+	if (map_len >= sizeof(struct aurora_bin_frame_header) &&
+	    memcmp(map, AURORA_BIN_FRAME_MAGIC, 4) == 0) {
+		return bin_open();
+	}
+
+	LOG_ERR("Replay: %s is neither a replay file nor an aurora_bin log",
+		replay_path);
+	return -EINVAL;
+}
+
+/* replay_source_rewind – see fake_sensors_replay.h */
+void replay_source_rewind(void)
+{
+	rec_idx = 0;
+	frame_off = 0;
+	frame_seq = bin_seq0;
+	memset(&last_gyro, 0, sizeof(last_gyro));
+	dropped = 0;
+}
+
+/* replay_source_next – see fake_sensors_replay.h */
+bool replay_source_next(struct replay_event *ev)
+{
+	return is_bin ? bin_next(ev) : file_next(ev);
+}
+
+/* replay_source_duration_ns – see fake_sensors_replay.h */
+uint64_t replay_source_duration_ns(void)
+{
+	return is_bin ? 0 : rec_span_ns;
+}
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Runner-side half of the native_sim benchmark clock.  Built against the
+ * host C library into the native simulator runner, so it can read the
+ * host's monotonic clock that the embedded image has no access to.
+ */
+
+#include <stdint.h>
+#include <time.h>
+
+uint64_t bench_clock_host_ns(void)
+{
+	struct timespec ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
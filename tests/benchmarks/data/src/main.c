@@ -0,0 +1,432 @@
+/**
+ * @file main.c
+ * @brief Throughput benchmarks for the data logger pipeline.
+ *
+ * Every case pushes the same synthetic sensor stream of
+ * CONFIG_BENCH_DATA_SAMPLES datapoints (1 ms apart, accel and gyro
+ * alternating, every tenth one a baro reading) through one stage of the pipeline against mock
+ * storage — the flash simulator or a RAM disk for the live log, a FatFS
+ * RAM disk for the text outputs — and prints one result line:
+ *
+ *   BENCH {"case":"logger_write","backend":"disk","layout":"fixed",...}
+ *
+ * The JSON object carries the sample and byte counts, the timed calls,
+ * mean cycles per call and per sample, the slowest call in µs, the
+ * derived samples/s and bytes/s and the clock rate the cycles are in.
+ * Pick them out of the twister handler.log with a plain
+ * @c grep '^BENCH ' and strip the prefix.
+ *
+ * Cases:
+ *
+ *  - **logger_write** — data_logger_write() into the bin backend.  The
+ *    final close is added to the total time (not to the per-call
+ *    latency) so the writer thread's storage time counts; bytes are the
+ *    frames it stored.
+ *  - **logger_write_batch** — the same through data_logger_write_batch().
+ *  - **bin_write_datapoint** — the bin formatter's write_datapoint hook
+ *    called directly, i.e. the record codec without the core layer.
+ *  - **convert_csv**, **convert_influx**, **convert_multi** —
+ *    data_logger_convert() / data_logger_convert_multi() of a full log.
+ *  - **fmt_csv**, **fmt_influx** — the text formatters driven directly
+ *    through data_logger_write(), as a live logger would.
+ *
+ * On native_sim simulated time does not advance while code runs, so the
+ * clock is the host's monotonic nanosecond counter; on hardware it is
+ * the kernel cycle counter.
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <errno.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/fs/fs.h>
+
+#include <aurora/lib/data_logger.h>
+
+#if defined(CONFIG_DATA_LOGGER_BIN_BACKEND_FLASH)
+#include <zephyr/storage/flash_map.h>
+#define BENCH_BACKEND "flash"
+#define BENCH_FLIGHT_LOG_ID DT_FIXED_PARTITION_ID(DT_CHOSEN(auxspace_flight_log))
+#else
+#include <zephyr/storage/disk_access.h>
+#define BENCH_BACKEND "disk"
+#define BENCH_DISK_NAME DT_PROP(DT_CHOSEN(auxspace_flight_log_disk), disk_name)
+#endif /* CONFIG_DATA_LOGGER_BIN_BACKEND_FLASH */
+
+#if defined(CONFIG_DATA_LOGGER_BIN_PACKED)
+#define BENCH_LAYOUT "packed"
+#elif defined(CONFIG_DATA_LOGGER_BIN_COLUMNAR)
+#define BENCH_LAYOUT "columnar"
+#else
+#define BENCH_LAYOUT "fixed"
+#endif
+
+#define BENCH_SAMPLES CONFIG_BENCH_DATA_SAMPLES
+#define BENCH_BATCH   CONFIG_BENCH_DATA_BATCH
+#define CSV_PATH      CONFIG_DATA_LOGGER_BASE_PATH "/bench.csv"
+#define INFLUX_PATH   CONFIG_DATA_LOGGER_BASE_PATH "/bench.lp"
+
+/* ========================================================================== */
+/*  Clock                                                                     */
+/* ========================================================================== */
+
+#if defined(CONFIG_NATIVE_LIBRARY)
+/* native/bench_clock_bottom.c, linked into the runner. */
+uint64_t bench_clock_host_ns(void);
+#endif
+
+/* Free-running counter; spans are taken modulo 2^32, so a single timed
+ * call must stay below one wrap (4.29 s on native_sim).
+ */
+static inline uint32_t bench_now(void)
+{
+#if defined(CONFIG_NATIVE_LIBRARY)
+	return (uint32_t)bench_clock_host_ns();
+#else
+	return k_cycle_get_32();
+#endif
+}
+
+static inline uint64_t bench_hz(void)
+{
+#if defined(CONFIG_NATIVE_LIBRARY)
+	return 1000000000ULL;
+#else
+	return (uint64_t)sys_clock_hw_cycles_per_sec();
+#endif
+}
+
+/* ========================================================================== */
+/*  Result accounting                                                         */
+/* ========================================================================== */
+
+struct bench_result {
+	uint32_t samples;     /* datapoints processed */
+	uint64_t bytes;       /* bytes the stage produced */
+	uint32_t calls;       /* timed calls */
+	uint64_t cycles;      /* sum of all timed spans */
+	uint32_t max_cycles;  /* slowest single call */
+};
+
+static struct bench_result res;
+
+static void bench_span(uint32_t start)
+{
+	uint32_t span = bench_now() - start;
+
+	res.calls++;
+	res.cycles += span;
+	res.max_cycles = MAX(res.max_cycles, span);
+}
+
+/* Time spent outside the timed calls, e.g. draining the writer queue:
+ * counts towards the throughput but not the per-call latency.
+ */
+static void bench_drain(uint32_t start)
+{
+	res.cycles += bench_now() - start;
+}
+
+static uint64_t per_second(uint64_t count, uint64_t cycles)
+{
+	return cycles ? count * bench_hz() / cycles : 0;
+}
+
+static void bench_report(const char *name)
+{
+	const uint64_t hz = bench_hz();
+
+	printk("BENCH {\"case\":\"%s\",\"backend\":\"%s\",\"layout\":\"%s\","
+	       "\"samples\":%u,\"bytes\":%llu,\"calls\":%u,"
+	       "\"cycles_per_call\":%llu,\"cycles_per_sample\":%llu,"
+	       "\"max_latency_us\":%llu,\"samples_per_s\":%llu,"
+	       "\"bytes_per_s\":%llu,\"clock_hz\":%llu}\n",
+	       name, BENCH_BACKEND, BENCH_LAYOUT, res.samples,
+	       (unsigned long long)res.bytes, res.calls,
+	       (unsigned long long)(res.calls ? res.cycles / res.calls : 0),
+	       (unsigned long long)(res.samples ? res.cycles / res.samples : 0),
+	       (unsigned long long)((uint64_t)res.max_cycles * 1000000ULL / hz),
+	       (unsigned long long)per_second(res.samples, res.cycles),
+	       (unsigned long long)per_second(res.bytes, res.cycles),
+	       (unsigned long long)hz);
+}
+
+/* ========================================================================== */
+/*  Synthetic stream                                                          */
+/* ========================================================================== */
+
+static struct datapoint stream[BENCH_SAMPLES];
+
+/* Slowly drifting values with a little noise, so the packed layout sees
+ * the small deltas of a real flight rather than constants or white noise.
+ */
+static void stream_fill(uint64_t t0)
+{
+	uint32_t lcg = 0x2545f491U;
+
+	for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+		struct datapoint *dp = &stream[i];
+
+		lcg = lcg * 1664525U + 1013904223U;
+
+		const int32_t noise = (int32_t)(lcg >> 22) - 512;
+
+		dp->timestamp_ns = t0 + (uint64_t)i * 1000000ULL;
+		if (i % 10U == 0U) {
+			dp->type = AURORA_DATA_BARO;
+			dp->channel_count = 2;
+			dp->channels[0] = (struct sensor_value){
+				.val1 = 21, .val2 = (int32_t)((i * 97U) % 1000000U),
+			};
+			dp->channels[1] = (struct sensor_value){
+				.val1 = 101325 - (int32_t)(i / 10U),
+				.val2 = 500000 + noise * 100,
+			};
+			dp->channels[2] = (struct sensor_value){ 0 };
+		} else {
+			dp->type = (i & 1U) ? AURORA_DATA_IMU_ACCEL
+					    : AURORA_DATA_IMU_GYRO;
+			dp->channel_count = 3;
+			for (uint8_t c = 0; c < 3; c++) {
+				dp->channels[c] = (struct sensor_value){
+					.val1 = (c == 2U) ? 9 : 0,
+					.val2 = (int32_t)((i * (c + 1U) * 131U) % 800000U) +
+						noise * (c + 1),
+				};
+			}
+		}
+	}
+}
+
+/* ========================================================================== */
+/*  Mock storage                                                              */
+/* ========================================================================== */
+
+/* Blank the whole flight-log region so every case starts a fresh flight
+ * and the converters see exactly the samples of that case.
+ */
+static void storage_wipe(void)
+{
+#if defined(CONFIG_DATA_LOGGER_BIN_BACKEND_FLASH)
+	const struct flash_area *fa;
+
+	zassert_ok(flash_area_open(BENCH_FLIGHT_LOG_ID, &fa), NULL);
+	zassert_ok(flash_area_erase(fa, 0, fa->fa_size), NULL);
+	flash_area_close(fa);
+#else
+	static uint8_t blank[512] __aligned(4);
+	uint32_t sectors = 0;
+
+	zassert_ok(disk_access_init(BENCH_DISK_NAME), NULL);
+	zassert_ok(disk_access_ioctl(BENCH_DISK_NAME, DISK_IOCTL_GET_SECTOR_COUNT,
+				     &sectors), NULL);
+	memset(blank, 0xFF, sizeof(blank));
+	for (uint32_t s = 0; s < sectors; s++) {
+		zassert_ok(disk_access_write(BENCH_DISK_NAME, blank, s, 1), NULL);
+	}
+#endif /* CONFIG_DATA_LOGGER_BIN_BACKEND_FLASH */
+}
+
+static uint64_t file_size(const char *path)
+{
+	struct fs_dirent entry;
+
+	return fs_stat(path, &entry) == 0 ? entry.size : 0;
+}
+
+static uint64_t bin_stored_bytes(void)
+{
+	struct data_logger_bin_stats st;
+
+	return data_logger_bin_stats(&st) == 0 ? st.bytes : 0;
+}
+
+/* ========================================================================== */
+/*  Suite                                                                     */
+/* ========================================================================== */
+
+static struct data_logger logger;
+
+static void *bench_setup(void)
+{
+	/* Same offset as the disk tests: clear of the boot-time uptime so
+	 * no record predates the frame it opens.
+	 */
+	stream_fill(k_ticks_to_ns_floor64(k_uptime_ticks()) + 10000000ULL);
+	return NULL;
+}
+
+static void bench_before(void *fixture)
+{
+	(void)fixture;
+	memset(&logger, 0, sizeof(logger));
+	memset(&res, 0, sizeof(res));
+	fs_unlink(CSV_PATH);
+	fs_unlink(INFLUX_PATH);
+	storage_wipe();
+}
+
+ZTEST_SUITE(data_bench, NULL, bench_setup, bench_before, NULL, NULL);
+
+static void bin_open(void)
+{
+	zassert_ok(data_logger_init(&logger, "bench",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&logger), NULL);
+}
+
+/* Close the logger, timing the drain of everything it still buffers. */
+static void close_timed(void)
+{
+	uint32_t t = bench_now();
+
+	zassert_ok(data_logger_close(&logger), NULL);
+	bench_drain(t);
+}
+
+/* Record the whole stream, untimed, as input for the converters. */
+static void bin_record_stream(void)
+{
+	bin_open();
+	zassert_ok(data_logger_write_batch(&logger, stream, BENCH_SAMPLES), NULL);
+	zassert_ok(data_logger_close(&logger), NULL);
+}
+
+ZTEST(data_bench, test_logger_write)
+{
+	bin_open();
+	for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+		uint32_t t = bench_now();
+
+		zassert_ok(data_logger_write(&logger, &stream[i]), NULL);
+		bench_span(t);
+	}
+	close_timed();
+
+	res.samples = BENCH_SAMPLES;
+	res.bytes = bin_stored_bytes();
+	bench_report("logger_write");
+}
+
+ZTEST(data_bench, test_logger_write_batch)
+{
+	bin_open();
+	for (uint32_t i = 0; i < BENCH_SAMPLES; i += BENCH_BATCH) {
+		const size_t n = MIN((size_t)BENCH_BATCH,
+				     (size_t)(BENCH_SAMPLES - i));
+		uint32_t t = bench_now();
+
+		zassert_ok(data_logger_write_batch(&logger, &stream[i], n), NULL);
+		bench_span(t);
+	}
+	close_timed();
+
+	res.samples = BENCH_SAMPLES;
+	res.bytes = bin_stored_bytes();
+	bench_report("logger_write_batch");
+}
+
+/* The formatter hook runs under the logger mutex, as the core calls it. */
+ZTEST(data_bench, test_bin_write_datapoint)
+{
+	bin_open();
+	zassert_ok(k_mutex_lock(&logger.state->mutex, K_FOREVER), NULL);
+	for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+		uint32_t t = bench_now();
+		int rc = logger.fmt->write_datapoint(&logger, &stream[i]);
+
+		bench_span(t);
+		zassert_ok(rc, "write_datapoint failed at %u", i);
+	}
+	k_mutex_unlock(&logger.state->mutex);
+	zassert_ok(data_logger_close(&logger), NULL);
+
+	res.samples = BENCH_SAMPLES;
+	res.bytes = bin_stored_bytes();
+	bench_report("bin_write_datapoint");
+}
+
+static void convert_one(const struct data_logger_formatter *fmt,
+			const char *path, const char *name)
+{
+	bin_record_stream();
+
+	uint32_t t = bench_now();
+
+	zassert_ok(data_logger_convert(fmt, path), NULL);
+	bench_span(t);
+
+	res.samples = BENCH_SAMPLES;
+	res.bytes = file_size(path);
+	zassert_true(res.bytes > 0, "%s must not be empty", path);
+	bench_report(name);
+}
+
+ZTEST(data_bench, test_convert_csv)
+{
+	convert_one(&data_logger_csv_formatter, CSV_PATH, "convert_csv");
+}
+
+ZTEST(data_bench, test_convert_influx)
+{
+	convert_one(&data_logger_influx_formatter, INFLUX_PATH,
+		    "convert_influx");
+}
+
+ZTEST(data_bench, test_convert_multi)
+{
+	struct data_logger_convert_out outs[] = {
+		{ .fmt = &data_logger_csv_formatter, .path = CSV_PATH },
+		{ .fmt = &data_logger_influx_formatter, .path = INFLUX_PATH },
+	};
+
+	bin_record_stream();
+
+	uint32_t t = bench_now();
+
+	zassert_ok(data_logger_convert_multi(outs, ARRAY_SIZE(outs)), NULL);
+	bench_span(t);
+
+	res.samples = BENCH_SAMPLES;
+	res.bytes = file_size(CSV_PATH) + file_size(INFLUX_PATH);
+	bench_report("convert_multi");
+}
+
+static void fmt_direct(const struct data_logger_formatter *fmt,
+		       const char *name)
+{
+	zassert_ok(data_logger_init(&logger, "bfmt", fmt), NULL);
+	zassert_ok(data_logger_start(&logger), NULL);
+	for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+		uint32_t t = bench_now();
+
+		zassert_ok(data_logger_write(&logger, &stream[i]), NULL);
+		bench_span(t);
+	}
+	close_timed();
+
+	res.samples = BENCH_SAMPLES;
+	res.bytes = file_size(logger.path);
+	zassert_true(res.bytes > 0, "%s must not be empty", logger.path);
+	bench_report(name);
+
+	/* The rotation index makes every name unique; drop the file so the
+	 * next case starts on the same free space.
+	 */
+	fs_unlink(logger.path);
+}
+
+ZTEST(data_bench, test_fmt_csv)
+{
+	fmt_direct(&data_logger_csv_formatter, "fmt_csv");
+}
+
+ZTEST(data_bench, test_fmt_influx)
+{
+	fmt_direct(&data_logger_influx_formatter, "fmt_influx");
+}
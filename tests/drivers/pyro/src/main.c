@@ -0,0 +1,131 @@
+/**
+ * @file main.c
+ * @brief Unit tests for the timed fires of the basic pyro driver.
+ *
+ * Runs on native_sim against the emulated GPIO controller, so the
+ * trigger pins can be read back. Covers the pyro_fire_at() /
+ * pyro_fire_timing() states, the double-schedule guard and the
+ * cancellation of a pending fire on disarm and secure.
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/gpio/gpio_emul.h>
+
+#include <aurora/drivers/pyro.h>
+
+#define PYRO_NODE DT_NODELABEL(pyro0)
+#define FIRE_DELAY_US 20000U
+
+static const struct device *const pyro = DEVICE_DT_GET(PYRO_NODE);
+static const struct gpio_dt_spec trig[] = {
+	GPIO_DT_SPEC_GET_BY_IDX(PYRO_NODE, trigger_gpios, 0),
+	GPIO_DT_SPEC_GET_BY_IDX(PYRO_NODE, trigger_gpios, 1),
+};
+
+/* Level of @p channel's trigger pin. */
+static int trig_level(uint32_t channel)
+{
+	return gpio_emul_output_get(trig[channel].port, trig[channel].pin);
+}
+
+static void pyro_before(void *f)
+{
+	ARG_UNUSED(f);
+
+	zassert_true(device_is_ready(pyro), "pyro device not ready");
+	for (uint32_t i = 0; i < ARRAY_SIZE(trig); i++) {
+		zassert_ok(pyro_secure(pyro, i), NULL);
+		zassert_equal(trig_level(i), 0, NULL);
+	}
+}
+
+ZTEST(basic_pyro_fire, test_fire_at_rejects_unarmed)
+{
+	struct pyro_fire_timing timing;
+
+	zassert_equal(pyro_fire_at(pyro, 0, FIRE_DELAY_US), -EACCES, NULL);
+	zassert_equal(pyro_fire_at(pyro, ARRAY_SIZE(trig), 0), -EINVAL, NULL);
+	zassert_equal(pyro_fire_timing(pyro, ARRAY_SIZE(trig), &timing),
+		      -EINVAL, NULL);
+}
+
+/**
+ * @brief A scheduled fire is in progress until its timer ISR drives the
+ *        trigger, refuses a second schedule, then reports its stamps.
+ */
+ZTEST(basic_pyro_fire, test_fire_at_timing_states)
+{
+	struct pyro_fire_timing timing;
+
+	zassert_ok(pyro_arm(pyro, 0), NULL);
+	zassert_ok(pyro_fire_at(pyro, 0, FIRE_DELAY_US), NULL);
+	zassert_equal(pyro_fire_timing(pyro, 0, &timing), -EINPROGRESS, NULL);
+	zassert_equal(pyro_fire_at(pyro, 0, FIRE_DELAY_US), -EBUSY,
+		      "a pending fire must not be scheduled twice");
+	zassert_equal(trig_level(0), 0, "fired before its delay");
+
+	k_sleep(K_USEC(2 * FIRE_DELAY_US));
+
+	zassert_equal(trig_level(0), 1, "timer ISR did not fire");
+	zassert_ok(pyro_fire_timing(pyro, 0, &timing), NULL);
+	zassert_equal(timing.delay_us, FIRE_DELAY_US, NULL);
+	zassert_true(timing.fire_ns - timing.command_ns >=
+		     (uint64_t)FIRE_DELAY_US * NSEC_PER_USEC / 2U,
+		     "fired after %llu ns",
+		     timing.fire_ns - timing.command_ns);
+	zassert_equal(trig_level(1), 0, "other channel touched");
+}
+
+/** @brief A zero delay fires from pyro_fire_at() itself. */
+ZTEST(basic_pyro_fire, test_fire_at_zero_delay)
+{
+	struct pyro_fire_timing timing;
+
+	zassert_ok(pyro_arm(pyro, 1), NULL);
+	zassert_ok(pyro_fire_at(pyro, 1, 0), NULL);
+	zassert_equal(trig_level(1), 1, NULL);
+	zassert_ok(pyro_fire_timing(pyro, 1, &timing), NULL);
+	zassert_equal(timing.delay_us, 0U, NULL);
+	zassert_true(timing.fire_ns >= timing.command_ns, NULL);
+}
+
+/** @brief Disarming cancels a pending fire; the trigger never moves. */
+ZTEST(basic_pyro_fire, test_disarm_cancels_pending)
+{
+	struct pyro_fire_timing timing;
+
+	zassert_ok(pyro_arm(pyro, 1), NULL);
+	zassert_ok(pyro_fire_at(pyro, 1, FIRE_DELAY_US), NULL);
+	zassert_ok(pyro_disarm(pyro, 1), NULL);
+	zassert_equal(pyro_fire_timing(pyro, 1, &timing), -ENODATA,
+		      "cancelled fire must read as no data");
+
+	k_sleep(K_USEC(2 * FIRE_DELAY_US));
+
+	zassert_equal(trig_level(1), 0, "disarmed channel fired");
+	zassert_equal(pyro_fire_at(pyro, 1, FIRE_DELAY_US), -EACCES, NULL);
+}
+
+/** @brief Securing a channel cancels its pending fire as well. */
+ZTEST(basic_pyro_fire, test_secure_cancels_pending)
+{
+	struct pyro_fire_timing timing;
+
+	zassert_ok(pyro_arm(pyro, 0), NULL);
+	zassert_ok(pyro_fire_at(pyro, 0, FIRE_DELAY_US), NULL);
+	zassert_ok(pyro_secure(pyro, 0), NULL);
+
+	k_sleep(K_USEC(2 * FIRE_DELAY_US));
+
+	zassert_equal(trig_level(0), 0, "secured channel fired");
+	zassert_equal(pyro_fire_timing(pyro, 0, &timing), -ENODATA, NULL);
+}
+
+ZTEST_SUITE(basic_pyro_fire, NULL, NULL, pyro_before, NULL, NULL);
@@ -44,9 +44,9 @@ ZTEST(attitude_tests, test_init_seeds_gravity_down_axis)
 
 ZTEST(attitude_tests, test_update_before_calibration_errors)
 {
-	double accel[3] = {0.0, 0.0, 9.81};
-	double gyro[3]  = {0.0, 0.0, 0.0};
-	double a_v;
+	attitude_real_t accel[3] = {0.0, 0.0, 9.81};
+	attitude_real_t gyro[3]  = {0.0, 0.0, 0.0};
+	attitude_real_t a_v;
 
 	int ret = attitude_update(&att, accel, gyro, 0.01, &a_v);
 	zassert_equal(ret, -ENODATA, "update without calibration must fail");
@@ -55,8 +55,8 @@ ZTEST(attitude_tests, test_update_before_calibration_errors)
 ZTEST(attitude_tests, test_calibrate_stationary_produces_zero_bias)
 {
 	/* Perfect +Z-up stationary sample: accel = [0,0,+g]. */
-	double accel[3] = {0.0, 0.0, 9.81};
-	double gyro[3]  = {0.0, 0.0, 0.0};
+	attitude_real_t accel[3] = {0.0, 0.0, 9.81};
+	attitude_real_t gyro[3]  = {0.0, 0.0, 0.0};
 
 	for (int i = 0; i < 100; i++) {
 		zassert_equal(attitude_calibrate_sample(&att, accel, gyro), 0,
@@ -77,8 +77,8 @@ ZTEST(attitude_tests, test_calibrate_stationary_produces_zero_bias)
 ZTEST(attitude_tests, test_calibrate_captures_gyro_bias)
 {
 	/* Stationary +Z-up but with a constant gyro offset of +0.05 rad/s on X. */
-	double accel[3] = {0.0, 0.0, 9.81};
-	double gyro[3]  = {0.05, 0.0, 0.0};
+	attitude_real_t accel[3] = {0.0, 0.0, 9.81};
+	attitude_real_t gyro[3]  = {0.05, 0.0, 0.0};
 
 	for (int i = 0; i < 200; i++) {
 		attitude_calibrate_sample(&att, accel, gyro);
@@ -90,9 +90,9 @@ ZTEST(attitude_tests, test_calibrate_captures_gyro_bias)
 
 ZTEST(attitude_tests, test_update_stationary_returns_zero_accel_vert)
 {
-	double accel[3] = {0.0, 0.0, 9.81};
-	double gyro[3]  = {0.0, 0.0, 0.0};
-	double a_v;
+	attitude_real_t accel[3] = {0.0, 0.0, 9.81};
+	attitude_real_t gyro[3]  = {0.0, 0.0, 0.0};
+	attitude_real_t a_v;
 
 	for (int i = 0; i < 100; i++) {
 		attitude_calibrate_sample(&att, accel, gyro);
@@ -107,10 +107,10 @@ ZTEST(attitude_tests, test_update_stationary_returns_zero_accel_vert)
 ZTEST(attitude_tests, test_update_positive_boost_along_up_axis)
 {
 	/* Calibrate at rest, then apply +20 m/s^2 along +Z (up). */
-	double rest[3]  = {0.0, 0.0, 9.81};
-	double gyro[3]  = {0.0, 0.0, 0.0};
-	double boost[3] = {0.0, 0.0, 9.81 + 20.0};
-	double a_v;
+	attitude_real_t rest[3]  = {0.0, 0.0, 9.81};
+	attitude_real_t gyro[3]  = {0.0, 0.0, 0.0};
+	attitude_real_t boost[3] = {0.0, 0.0, 9.81 + 20.0};
+	attitude_real_t a_v;
 
 	for (int i = 0; i < 100; i++) {
 		attitude_calibrate_sample(&att, rest, gyro);
@@ -123,10 +123,10 @@ ZTEST(attitude_tests, test_update_positive_boost_along_up_axis)
 
 ZTEST(attitude_tests, test_update_freefall_returns_negative_g)
 {
-	double rest[3]     = {0.0, 0.0, 9.81};
-	double gyro[3]     = {0.0, 0.0, 0.0};
-	double freefall[3] = {0.0, 0.0, 0.0};
-	double a_v;
+	attitude_real_t rest[3]     = {0.0, 0.0, 9.81};
+	attitude_real_t gyro[3]     = {0.0, 0.0, 0.0};
+	attitude_real_t freefall[3] = {0.0, 0.0, 0.0};
+	attitude_real_t a_v;
 
 	for (int i = 0; i < 100; i++) {
 		attitude_calibrate_sample(&att, rest, gyro);
@@ -146,8 +146,8 @@ ZTEST(attitude_tests, test_update_rotation_redirects_gravity_vector)
 	 *
 	 * Apply 100 small steps of dt=0.01s, omega_y = pi/2 rad/s.
 	 */
-	double rest[3] = {0.0, 0.0, 9.81};
-	double gyro0[3] = {0.0, 0.0, 0.0};
+	attitude_real_t rest[3] = {0.0, 0.0, 9.81};
+	attitude_real_t gyro0[3] = {0.0, 0.0, 0.0};
 
 	for (int i = 0; i < 100; i++) {
 		attitude_calibrate_sample(&att, rest, gyro0);
@@ -156,7 +156,7 @@ ZTEST(attitude_tests, test_update_rotation_redirects_gravity_vector)
 
 	double omega = M_PI / 2.0;
 	double dt = 0.01;
-	double gyro[3] = {0.0, omega, 0.0};
+	attitude_real_t gyro[3] = {0.0, omega, 0.0};
 
 	/* Under a pure rotation, the accelerometer reading in body frame must
 	 * rotate with the body: a_b = -g_mag * g_b_expected. Feed a consistent
@@ -165,10 +165,10 @@ ZTEST(attitude_tests, test_update_rotation_redirects_gravity_vector)
 	 * starting g_b = [0,0,-1], omega_y > 0 sweeps g_b toward [+1,0,0], so
 	 * g_b(t) = [sin(theta), 0, -cos(theta)] and a_b = [-g sin, 0, g cos].
 	 */
-	double a_v;
+	attitude_real_t a_v;
 	for (int i = 0; i < 100; i++) {
 		double theta = omega * dt * (double)(i + 1);
-		double accel[3] = {
+		attitude_real_t accel[3] = {
 			-9.81 * sin(theta),
 			0.0,
 			 9.81 * cos(theta),
@@ -193,8 +193,8 @@ ZTEST(attitude_tests, test_update_rotation_redirects_gravity_vector)
 
 ZTEST(attitude_tests, test_null_pointers_rejected)
 {
-	double v[3] = {0.0, 0.0, 0.0};
-	double a_v;
+	attitude_real_t v[3] = {0.0, 0.0, 0.0};
+	attitude_real_t a_v;
 
 	zassert_equal(attitude_init(NULL), -EINVAL, "init NULL rejected");
 	zassert_equal(attitude_calibrate_sample(NULL, v, v), -EINVAL, "sample NULL rejected");
@@ -208,3 +208,227 @@ ZTEST(attitude_tests, test_finish_without_samples_returns_enodata)
 	zassert_equal(attitude_calibrate_finish(&att), -ENODATA,
 		      "finish with zero samples must fail");
 }
+
+/* Double-precision reference of attitude_update() for a tracker
+ * calibrated at rest with +Z up (zero biases, g_b = [0, 0, -1]).  Kept
+ * independent of the library so a float build can be checked against it.
+ */
+struct ref_attitude {
+	double g_b[3];
+	double g_mag;
+};
+
+static double ref_update(struct ref_attitude *r, const double a[3],
+			 const double w[3], double dt)
+{
+	const double wx = w[0] * dt, wy = w[1] * dt, wz = w[2] * dt;
+	const double gx = r->g_b[0], gy = r->g_b[1], gz = r->g_b[2];
+	double nx = gx - (wy * gz - wz * gy);
+	double ny = gy - (wz * gx - wx * gz);
+	double nz = gz - (wx * gy - wy * gx);
+	const double a_norm = sqrt(a[0] * a[0] + a[1] * a[1] + a[2] * a[2]);
+
+	if (a_norm > 1e-6) {
+		const double q = (a_norm - r->g_mag) / r->g_mag;
+		const double gain = exp(-0.5 * q * q / (0.20 * 0.20)) * dt / 0.5;
+
+		nx += gain * (-a[0] / a_norm - nx);
+		ny += gain * (-a[1] / a_norm - ny);
+		nz += gain * (-a[2] / a_norm - nz);
+	}
+
+	const double n = sqrt(nx * nx + ny * ny + nz * nz);
+
+	r->g_b[0] = nx / n;
+	r->g_b[1] = ny / n;
+	r->g_b[2] = nz / n;
+	return -(a[0] * r->g_b[0] + a[1] * r->g_b[1] + a[2] * r->g_b[2]) - r->g_mag;
+}
+
+ZTEST(attitude_tests, test_update_tracks_double_reference)
+{
+	/* 20 s at 100 Hz: pad, 3 s boost with a slow pitch-over and roll,
+	 * then coast.  In the double build this matches to rounding; with
+	 * CONFIG_ATTITUDE_FLOAT it bounds the single-precision drift.  The
+	 * reference is the gravity-vector update, so the quaternion
+	 * backend is checked by the orientation suite instead.
+	 */
+	Z_TEST_SKIP_IFDEF(CONFIG_ATTITUDE_QUATERNION);
+
+	struct ref_attitude ref = { .g_b = {0.0, 0.0, -1.0}, .g_mag = 9.81 };
+	attitude_real_t rest[3] = {0.0, 0.0, 9.81};
+	attitude_real_t zero[3] = {0.0, 0.0, 0.0};
+	const double dt = 0.01;
+	double max_av = 0.0;
+	double max_gb = 0.0;
+
+	for (int i = 0; i < 100; i++) {
+		attitude_calibrate_sample(&att, rest, zero);
+	}
+	zassert_equal(attitude_calibrate_finish(&att), 0, "finish ok");
+
+	for (int i = 0; i < 2000; i++) {
+		const double t = dt * (double)i;
+		const double thrust = (t >= 1.0 && t < 4.0) ? 60.0 : 0.0;
+		const double w[3] = {
+			0.02 * sin(0.7 * t),
+			t >= 1.0 ? 0.05 : 0.0,
+			t >= 1.0 ? 3.0 : 0.0,
+		};
+		const double a[3] = {
+			0.3 * sin(2.1 * t),
+			0.2 * cos(1.3 * t),
+			thrust + (t < 1.0 ? 9.81 : 0.5),
+		};
+		attitude_real_t a_r[3] = {a[0], a[1], a[2]};
+		attitude_real_t w_r[3] = {w[0], w[1], w[2]};
+		attitude_real_t a_v;
+
+		zassert_equal(attitude_update(&att, a_r, w_r, dt, &a_v), 0,
+			      "update ok");
+		const double ref_av = ref_update(&ref, a, w, dt);
+
+		max_av = MAX(max_av, fabs(a_v - ref_av));
+		for (int k = 0; k < 3; k++) {
+			max_gb = MAX(max_gb, fabs(att.g_b[k] - ref.g_b[k]));
+		}
+	}
+
+	zassert_true(max_av < FLOAT_TOL, "a_vert diverged from reference by %f",
+		     max_av);
+	zassert_true(max_gb < 1e-4, "g_b diverged from reference by %f",
+		     max_gb);
+}
+
+ZTEST_SUITE(attitude_quat_tests, NULL, NULL, setup, NULL, NULL);
+
+#if defined(CONFIG_ATTITUDE_QUATERNION)
+static void calibrate_at_rest(void)
+{
+	attitude_real_t rest[3] = {0.0, 0.0, 9.81};
+	attitude_real_t zero[3] = {0.0, 0.0, 0.0};
+
+	for (int i = 0; i < 100; i++) {
+		attitude_calibrate_sample(&att, rest, zero);
+	}
+	zassert_equal(attitude_calibrate_finish(&att), 0, "finish ok");
+}
+
+/* Spin about the up axis at @p rate rad/s for @p steps of 10 ms. */
+static void spin_about_up(double rate, int steps)
+{
+	attitude_real_t rest[3] = {0.0, 0.0, 9.81};
+	attitude_real_t gyro[3] = {0.0, 0.0, rate};
+	attitude_real_t a_v;
+
+	for (int i = 0; i < steps; i++) {
+		zassert_equal(attitude_update(&att, rest, gyro, 0.01, &a_v), 0,
+			      "update ok");
+	}
+}
+#endif /* CONFIG_ATTITUDE_QUATERNION */
+
+ZTEST(attitude_quat_tests, test_orientation_argument_checks)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_ATTITUDE_QUATERNION);
+
+#if defined(CONFIG_ATTITUDE_QUATERNION)
+	attitude_real_t o[3];
+
+	zassert_equal(attitude_orientation(NULL, o), -EINVAL, "NULL state");
+	zassert_equal(attitude_orientation(&att, NULL), -EINVAL, "NULL output");
+	zassert_equal(attitude_orientation(&att, o), -ENODATA,
+		      "uncalibrated tracker has no orientation");
+#endif /* CONFIG_ATTITUDE_QUATERNION */
+}
+
+ZTEST(attitude_quat_tests, test_orientation_level_at_calibration)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_ATTITUDE_QUATERNION);
+
+#if defined(CONFIG_ATTITUDE_QUATERNION)
+	attitude_real_t o[3];
+
+	calibrate_at_rest();
+	spin_about_up(0.0, 100);
+
+	zassert_equal(attitude_orientation(&att, o), 0, "orientation ok");
+	zassert_near(o[0], 0.0, FLOAT_TOL, "yaw ~0 at rest");
+	zassert_near(o[1], 0.0, FLOAT_TOL, "pitch ~0 at rest");
+	zassert_near(o[2], 0.0, FLOAT_TOL, "roll ~0 at rest");
+#endif /* CONFIG_ATTITUDE_QUATERNION */
+}
+
+ZTEST(attitude_quat_tests, test_orientation_roll_follows_spin)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_ATTITUDE_QUATERNION);
+
+#if defined(CONFIG_ATTITUDE_QUATERNION)
+	attitude_real_t o[3];
+	attitude_real_t a_v;
+	attitude_real_t rest[3] = {0.0, 0.0, 9.81};
+	attitude_real_t zero[3] = {0.0, 0.0, 0.0};
+
+	calibrate_at_rest();
+
+	/* 1 rad/s for 1 s: one radian of roll, level the whole time. */
+	spin_about_up(1.0, 100);
+	zassert_equal(attitude_orientation(&att, o), 0, "orientation ok");
+	zassert_near(o[2], 180.0 / M_PI, 0.05, "roll should be one radian");
+	zassert_near(o[0], 0.0, FLOAT_TOL, "spin leaves yaw level");
+	zassert_near(o[1], 0.0, FLOAT_TOL, "spin leaves pitch level");
+
+	/* Three more seconds: 4 rad total wraps past 180 deg. */
+	spin_about_up(1.0, 300);
+	zassert_equal(attitude_orientation(&att, o), 0, "orientation ok");
+	zassert_near(o[2], 4.0 * 180.0 / M_PI - 360.0, 0.2,
+		     "roll should wrap into [-180, 180]");
+
+	/* The spin must not leak into vertical acceleration. */
+	zassert_equal(attitude_update(&att, rest, zero, 0.01, &a_v), 0,
+		      "update ok");
+	zassert_near(a_v, 0.0, FLOAT_TOL, "level after spin: a_vert ~0");
+#endif /* CONFIG_ATTITUDE_QUATERNION */
+}
+
+ZTEST(attitude_quat_tests, test_orientation_tilt_matches_accel_solution)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_ATTITUDE_QUATERNION);
+
+#if defined(CONFIG_ATTITUDE_QUATERNION)
+	/* Tilt 30 deg about +Y with a consistent accelerometer reading, as
+	 * in test_update_rotation_redirects_gravity_vector.  Pitch must
+	 * then agree with the accelerometer-only solution.
+	 */
+	const double omega = M_PI / 6.0;
+	const double dt = 0.01;
+	attitude_real_t gyro[3] = {0.0, omega, 0.0};
+	attitude_real_t o[3];
+	attitude_real_t a_v;
+
+	calibrate_at_rest();
+
+	for (int i = 0; i < 100; i++) {
+		double theta = omega * dt * (double)(i + 1);
+		attitude_real_t accel[3] = {
+			-9.81 * sin(theta),
+			0.0,
+			 9.81 * cos(theta),
+		};
+		zassert_equal(attitude_update(&att, accel, gyro, dt, &a_v), 0,
+			      "update ok");
+	}
+
+	const double pitch = atan2(9.81 * sin(M_PI / 6.0),
+				   9.81 * cos(M_PI / 6.0)) * 180.0 / M_PI;
+
+	zassert_equal(attitude_orientation(&att, o), 0, "orientation ok");
+	/* The anchor pulls toward the end-of-step reading, so allow one
+	 * step of rotation (0.3 deg).
+	 */
+	zassert_near(o[1], pitch, 0.5, "pitch should match the accelerometer");
+	zassert_near(o[0], 0.0, 0.05, "no tilt about the lateral axis");
+	zassert_near(o[2], 0.0, 0.05, "no twist about the up axis");
+	zassert_near(a_v, 0.0, 0.01, "tilted at rest: a_vert ~0");
+#endif /* CONFIG_ATTITUDE_QUATERNION */
+}
@@ -0,0 +1,171 @@
+/**
+ * @file main.c
+ * @brief Unit tests for the barometer pressure-to-altitude conversion.
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <math.h>
+#include <errno.h>
+#include <zephyr/ztest.h>
+#include <aurora/lib/baro.h>
+
+/* ISA constants, kept independent of baro_altitude.c. */
+#define ISA_T0 288.15
+#define ISA_L  0.0065
+#define ISA_GMR_OVER_L 5.25588
+#define ISA_RL_OVER_GM 0.190263
+#define ISA_P0_KPA 101.325
+
+/** Tolerance where the library evaluates the formula itself. */
+#define EXACT_TOL 1e-6
+
+static double altitude_to_pressure(double alt_m)
+{
+	return ISA_P0_KPA * pow(1.0 - alt_m * ISA_L / ISA_T0, ISA_GMR_OVER_L);
+}
+
+static double pressure_to_altitude(double press_kpa)
+{
+	return (ISA_T0 / ISA_L) *
+	       (1.0 - pow(press_kpa / ISA_P0_KPA, ISA_RL_OVER_GM));
+}
+
+/* Truncate to the micro-kPa resolution of a sensor reading. */
+static struct sensor_value kpa_to_sensor_value(double press_kpa)
+{
+	const int64_t ukpa = (int64_t)(press_kpa * 1000000.0);
+
+	return (struct sensor_value){
+		.val1 = (int32_t)(ukpa / 1000000),
+		.val2 = (int32_t)(ukpa % 1000000),
+	};
+}
+
+static double sensor_value_to_kpa(const struct sensor_value *v)
+{
+	return (double)v->val1 + (double)v->val2 / 1e6;
+}
+
+/**
+ * @brief Allowed error against the formula over the table range.
+ *
+ * The Kconfig bound for linear interpolation, h'' * dp^2 / 8 at the
+ * ceiling, plus a few millimetres for the float table.
+ */
+static double altitude_tolerance(void)
+{
+#if defined(CONFIG_BARO_ALTITUDE_LUT)
+	const double k = ISA_RL_OVER_GM;
+	const double p = altitude_to_pressure(CONFIG_BARO_ALTITUDE_LUT_CEILING_M);
+	const double dp = (altitude_to_pressure(-200.0) - p) /
+			  (CONFIG_BARO_ALTITUDE_LUT_SIZE - 1);
+	const double h2 = (ISA_T0 / ISA_L) * k * (1.0 - k) *
+			  pow(p / ISA_P0_KPA, k) / (p * p);
+
+	return h2 * dp * dp / 8.0 + 0.005;
+#else
+	return EXACT_TOL;
+#endif /* CONFIG_BARO_ALTITUDE_LUT */
+}
+
+static void *baro_setup(void)
+{
+	zassert_equal(baro_set_reference(ISA_P0_KPA), 0, "reference accepted");
+	return NULL;
+}
+
+ZTEST_SUITE(baro_altitude_tests, NULL, baro_setup, NULL, NULL, NULL);
+
+ZTEST(baro_altitude_tests, test_reference_rejects_non_positive)
+{
+	zassert_equal(baro_set_reference(0.0), -EINVAL, "zero reference");
+	zassert_equal(baro_set_reference(-1.0), -EINVAL, "negative reference");
+}
+
+ZTEST(baro_altitude_tests, test_null_arguments)
+{
+	struct sensor_value press = kpa_to_sensor_value(ISA_P0_KPA);
+	double alt;
+
+	zassert_equal(baro_sensor_value_to_altitude(NULL, &alt), -EINVAL,
+		      "NULL pressure");
+	zassert_equal(baro_sensor_value_to_altitude(&press, NULL), -EINVAL,
+		      "NULL output");
+}
+
+ZTEST(baro_altitude_tests, test_zero_pressure_rejected)
+{
+	const struct sensor_value press = { .val1 = 0, .val2 = 0 };
+	double alt;
+
+	zassert_equal(baro_sensor_value_to_altitude(&press, &alt), -EINVAL,
+		      "zero pressure has no altitude");
+}
+
+ZTEST(baro_altitude_tests, test_ground_level)
+{
+	struct sensor_value press = kpa_to_sensor_value(ISA_P0_KPA);
+	double alt;
+
+	zassert_equal(baro_sensor_value_to_altitude(&press, &alt), 0,
+		      "conversion ok");
+	zassert_true(fabs(alt) < altitude_tolerance(),
+		     "reference pressure is 0 m, got %f", alt);
+}
+
+/**
+ * @brief Error against the hypsometric formula stays within the bound.
+ *
+ * Sweeps 200 m below the reference up to 10 km on an odd step so the
+ * samples land between table entries.
+ */
+ZTEST(baro_altitude_tests, test_matches_hypsometric_formula)
+{
+	const double tol = altitude_tolerance();
+	double worst = 0.0;
+
+	for (double h = -199.0; h < 10000.0; h += 3.7) {
+		struct sensor_value press = kpa_to_sensor_value(altitude_to_pressure(h));
+		double alt;
+
+		zassert_equal(baro_sensor_value_to_altitude(&press, &alt), 0,
+			      "conversion ok at %f m", h);
+		worst = MAX(worst, fabs(alt - pressure_to_altitude(
+			sensor_value_to_kpa(&press))));
+	}
+
+	zassert_true(worst < tol, "max error %f m exceeds %f m", worst, tol);
+}
+
+/**
+ * @brief A z-bus pressure sample converts like the same sensor_value.
+ */
+ZTEST(baro_altitude_tests, test_sample_matches_sensor_value)
+{
+	struct sensor_value press = kpa_to_sensor_value(altitude_to_pressure(1234.5));
+	double alt_sv, alt_sample;
+
+	zassert_equal(baro_sensor_value_to_altitude(&press, &alt_sv), 0,
+		      "conversion ok");
+	zassert_equal(baro_sample_to_altitude(aurora_sample_from_sensor_value(&press),
+					      &alt_sample), 0, "conversion ok");
+	zassert_equal(alt_sample, alt_sv, "got %f, expected %f", alt_sample, alt_sv);
+	zassert_equal(baro_sample_to_altitude(0, NULL), -EINVAL, "NULL output");
+}
+
+/**
+ * @brief Pressures below the table floor still use the formula.
+ */
+ZTEST(baro_altitude_tests, test_below_table_uses_formula)
+{
+	struct sensor_value press = kpa_to_sensor_value(altitude_to_pressure(-500.0));
+	double alt;
+
+	zassert_equal(baro_sensor_value_to_altitude(&press, &alt), 0,
+		      "conversion ok");
+	zassert_true(fabs(alt - pressure_to_altitude(sensor_value_to_kpa(&press))) <
+		     EXACT_TOL, "exact below the table, got %f", alt);
+}
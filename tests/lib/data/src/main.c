@@ -16,6 +16,10 @@
  *  3. **data_logger_influx** (CONFIG_DATA_LOGGER_CONVERT_INFLUX) — same as above
  *     for the InfluxDB Line Protocol formatter.
  *
+ * With CONFIG_DATA_LOGGER_CONVERT_LZ4 the text files are LZ4 frames;
+ * read_file() decodes them, so the same suites cover the compressed
+ * output.
+ *
  * Copyright (c) 2026 Auxspace e.V.
  *
  * SPDX-License-Identifier: Apache-2.0
@@ -27,6 +31,7 @@
 
 #include <zephyr/ztest.h>
 #include <zephyr/fs/fs.h>
+#include <zephyr/sys/byteorder.h>
 
 #include <aurora/lib/data_logger.h>
 
@@ -40,8 +45,107 @@
 
 #if defined(CONFIG_DATA_LOGGER_CONVERT_CSV) || defined(CONFIG_DATA_LOGGER_CONVERT_INFLUX)
 
+#if defined(CONFIG_DATA_LOGGER_CONVERT_LZ4)
+
+#define LZ4_EXT ".lz4"
+#define LZ4_FRAME_MAGIC 0x184D2204U
+#define LZ4_HDR_SIZE 7
+
+/* Raw (compressed) file contents; room for the largest read_file() call. */
+static uint8_t lz4_raw[16384 + 256];
+
+static size_t lz4_len(const uint8_t *src, size_t *i, size_t len)
+{
+	uint8_t b;
+
+	if (len == 15) {
+		do {
+			b = src[(*i)++];
+			len += b;
+		} while (b == 255);
+	}
+	return len;
+}
+
+/* Reference LZ4 frame decoder for the independent-block frames written
+ * by fmt_lz4.c.  Returns the decoded size, or -EBADMSG.
+ */
+static int lz4_decode(const uint8_t *src, size_t n, char *dst, size_t size)
+{
+	size_t pos = LZ4_HDR_SIZE;
+	size_t out = 0;
+
+	if (n < LZ4_HDR_SIZE || sys_get_le32(src) != LZ4_FRAME_MAGIC) {
+		return -EBADMSG;
+	}
+
+	while (pos + 4 <= n) {
+		uint32_t word = sys_get_le32(&src[pos]);
+		size_t blen = word & 0x7FFFFFFFU;
+
+		pos += 4;
+		if (word == 0) {
+			return (int)out;
+		}
+		if (pos + blen > n) {
+			return -EBADMSG;
+		}
+		if (word & 0x80000000U) {
+			if (out + blen > size) {
+				return -EBADMSG;
+			}
+			memcpy(&dst[out], &src[pos], blen);
+			out += blen;
+			pos += blen;
+			continue;
+		}
+
+		const uint8_t *blk = &src[pos];
+		size_t i = 0;
+
+		while (i < blen) {
+			uint8_t token = blk[i++];
+			size_t lit = lz4_len(blk, &i, token >> 4);
+
+			if (out + lit > size || i + lit > blen) {
+				return -EBADMSG;
+			}
+			memcpy(&dst[out], &blk[i], lit);
+			out += lit;
+			i += lit;
+			if (i >= blen) {
+				break;
+			}
+
+			size_t off = sys_get_le16(&blk[i]);
+
+			i += 2;
+			size_t mlen = lz4_len(blk, &i, token & 15U) + 4;
+
+			if (off == 0 || off > out || out + mlen > size) {
+				return -EBADMSG;
+			}
+			for (size_t k = 0; k < mlen; k++, out++) {
+				dst[out] = dst[out - off];
+			}
+		}
+		pos += blen;
+	}
+
+	/* Missing end mark. */
+	return -EBADMSG;
+}
+
+#else
+
+#define LZ4_EXT ""
+
+#endif /* CONFIG_DATA_LOGGER_CONVERT_LZ4 */
+
 /**
- * Read an entire file into @p buf (null-terminated).
+ * Read an entire file into @p buf (null-terminated).  With
+ * CONFIG_DATA_LOGGER_CONVERT_LZ4, LZ4 frames are decoded first so the
+ * text suites check the same content either way.
  * @return number of bytes read, or negative errno.
  */
 static int read_file(const char *path, char *buf, size_t size)
@@ -56,9 +160,27 @@ static int read_file(const char *path, char *buf, size_t size)
 		return rc;
 	}
 
+#if defined(CONFIG_DATA_LOGGER_CONVERT_LZ4)
+	ssize_t n = fs_read(&f, lz4_raw, sizeof(lz4_raw));
+
+	fs_close(&f);
+
+	if (n < 0) {
+		return (int)n;
+	}
+
+	/* The audit target is never compressed. */
+	if (n >= 4 && sys_get_le32(lz4_raw) == LZ4_FRAME_MAGIC) {
+		n = lz4_decode(lz4_raw, n, buf, size - 1);
+	} else {
+		n = MIN((size_t)n, size - 1);
+		memcpy(buf, lz4_raw, n);
+	}
+#else
 	ssize_t n = fs_read(&f, buf, size - 1);
 
 	fs_close(&f);
+#endif /* CONFIG_DATA_LOGGER_CONVERT_LZ4 */
 
 	if (n < 0) {
 		return (int)n;
@@ -351,6 +473,189 @@ ZTEST(data_logger_core, test_log_error_propagated)
 	zassert_ok(data_logger_close(&logger), NULL);
 }
 
+/* ---- data_logger_write_batch --------------------------------------------- */
+
+/**
+ * @brief Without a write_datapoints hook the batch is written one
+ *        datapoint at a time, and the first error stops it.
+ */
+ZTEST(data_logger_core, test_write_batch_falls_back)
+{
+	struct datapoint dps[3] = {
+		{.timestamp_ns = 1, .type = AURORA_DATA_BARO},
+		{.timestamp_ns = 2, .type = AURORA_DATA_IMU_ACCEL},
+		{.timestamp_ns = 3, .type = AURORA_DATA_IMU_GYRO},
+	};
+
+	zassert_ok(data_logger_init(&logger, "test",
+				    &data_logger_mock_formatter), NULL);
+	zassert_ok(data_logger_write_batch(&logger, dps, ARRAY_SIZE(dps)),
+		   "Batch on a stopped logger is a silent no-op");
+	zassert_equal(mock_state.write_datapoint_calls, 0, NULL);
+
+	zassert_ok(data_logger_start(&logger), NULL);
+	zassert_ok(data_logger_write_batch(&logger, dps, ARRAY_SIZE(dps)),
+		   NULL);
+	zassert_equal(mock_state.write_datapoint_calls, 3, NULL);
+	zassert_equal(mock_state.last_dp.timestamp_ns, 3ULL,
+		      "Datapoints must be written in order");
+
+	mock_state.fail_write_datapoint = 1;
+	zassert_equal(data_logger_write_batch(&logger, dps, ARRAY_SIZE(dps)),
+		      -EIO, NULL);
+	zassert_equal(mock_state.write_datapoint_calls, 4,
+		      "The batch must stop at the first error");
+
+	zassert_equal(data_logger_write_batch(NULL, dps, 1), -EINVAL, NULL);
+	zassert_ok(data_logger_close(&logger), NULL);
+}
+
+/* ---- decimation ---------------------------------------------------------- */
+
+#if defined(CONFIG_DATA_LOGGER_DECIMATION)
+
+static struct datapoint baro_sample(int32_t val1)
+{
+	struct datapoint dp = {
+		.timestamp_ns  = (uint64_t)val1,
+		.type          = AURORA_DATA_BARO,
+		.channel_count = 2,
+		.channels = {
+			{.val1 = val1, .val2 = 0},
+			{.val1 = 101000, .val2 = 250000},
+		},
+	};
+
+	return dp;
+}
+
+/**
+ * @brief An averaging policy writes one mean per window, and only once
+ *        the logger has entered the phase it belongs to.
+ */
+ZTEST(data_logger_core, test_decimation_average_by_phase)
+{
+	const struct data_logger_decimation avg3 = {.factor = 3, .average = true};
+	const struct data_logger_decimation full = {.factor = 1};
+
+	zassert_ok(data_logger_init(&logger, "test",
+				    &data_logger_mock_formatter), NULL);
+	zassert_ok(data_logger_set_decimation(&logger, DLP_PAD,
+					      AURORA_DATA_BARO, &full), NULL);
+	zassert_ok(data_logger_set_decimation(&logger, DLP_DESCENT,
+					      AURORA_DATA_BARO, &avg3), NULL);
+	zassert_ok(data_logger_start(&logger), NULL);
+
+	for (int32_t i = 1; i <= 3; i++) {
+		struct datapoint dp = baro_sample(i);
+
+		zassert_ok(data_logger_write(&logger, &dp), NULL);
+	}
+	zassert_equal(mock_state.write_datapoint_calls, 3,
+		      "Pad may not decimate with a factor of 1");
+
+	mock_state.write_datapoint_calls = 0;
+	zassert_ok(data_logger_event(&logger, DLE_APOGEE), NULL);
+
+	for (int32_t i = 1; i <= 6; i++) {
+		struct datapoint dp = baro_sample(i);
+
+		zassert_ok(data_logger_write(&logger, &dp), NULL);
+		if (i == 3) {
+			zassert_equal(mock_state.last_dp.channels[0].val1, 2,
+				      "First window mean is (1+2+3)/3");
+		}
+	}
+
+	zassert_equal(mock_state.write_datapoint_calls, 2,
+		      "Six samples at factor 3 must yield two");
+	zassert_equal(mock_state.last_dp.channels[0].val1, 5, NULL);
+	zassert_equal(mock_state.last_dp.channels[1].val1, 101000, NULL);
+	zassert_equal(mock_state.last_dp.channels[1].val2, 250000,
+		      "The mean must keep the fractional part");
+	zassert_ok(data_logger_close(&logger), NULL);
+}
+
+/**
+ * @brief Without averaging every factor-th sample passes unchanged,
+ *        through the batch path as well.
+ */
+ZTEST(data_logger_core, test_decimation_pick_in_batch)
+{
+	const struct data_logger_decimation pick2 = {.factor = 2};
+	struct datapoint dps[5];
+
+	for (int32_t i = 0; i < (int32_t)ARRAY_SIZE(dps); i++) {
+		dps[i] = baro_sample(i + 1);
+	}
+
+	zassert_ok(data_logger_init(&logger, "test",
+				    &data_logger_mock_formatter), NULL);
+	zassert_ok(data_logger_set_decimation(&logger, DLP_PAD,
+					      AURORA_DATA_BARO, &pick2), NULL);
+	zassert_ok(data_logger_start(&logger), NULL);
+
+	zassert_ok(data_logger_write_batch(&logger, dps, ARRAY_SIZE(dps)),
+		   NULL);
+	zassert_equal(mock_state.write_datapoint_calls, 2, NULL);
+	zassert_equal(mock_state.last_dp.channels[0].val1, 4,
+		      "The 2nd and 4th samples are kept as-is");
+
+	zassert_equal(data_logger_set_decimation(&logger, DLP_COUNT,
+						 AURORA_DATA_BARO, &pick2),
+		      -EINVAL, NULL);
+	zassert_equal(data_logger_set_decimation(&logger, DLP_PAD,
+						 AURORA_DATA_COUNT, &pick2),
+		      -EINVAL, NULL);
+	zassert_equal(data_logger_set_decimation(&logger, DLP_PAD,
+						 AURORA_DATA_BARO, NULL),
+		      -EINVAL, NULL);
+	zassert_ok(data_logger_close(&logger), NULL);
+}
+
+#endif /* CONFIG_DATA_LOGGER_DECIMATION */
+
+/* ---- data_logger_reserve ------------------------------------------------- */
+
+/**
+ * @brief Formatters without an in-place record layout reject reserve.
+ */
+ZTEST(data_logger_core, test_reserve_not_supported)
+{
+	struct aurora_bin_record *rec;
+
+	zassert_ok(data_logger_init(&logger, "test",
+				    &data_logger_mock_formatter), NULL);
+	zassert_ok(data_logger_start(&logger), NULL);
+	zassert_equal(data_logger_reserve(&logger, 0, &rec), -ENOTSUP, NULL);
+	zassert_equal(data_logger_reserve(NULL, 0, &rec), -EINVAL, NULL);
+	zassert_ok(data_logger_close(&logger), NULL);
+}
+
+/* ---- log_enqueue --------------------------------------------------------- */
+
+/**
+ * @brief With no logger thread draining it, the sample queue fills to
+ *        LOG_MSGQ_DEPTH and counts every further sample as dropped.
+ */
+ZTEST(data_logger_core, test_log_queue_drops_on_overflow)
+{
+	struct datapoint dp = {.type = AURORA_DATA_BARO, .channel_count = 2};
+	uint32_t dropped = log_queue_dropped();
+
+	while (log_queue_used() < LOG_MSGQ_DEPTH) {
+		log_enqueue(&dp);
+	}
+	zassert_equal(log_queue_dropped(), dropped,
+		      "Nothing may be dropped while there is room");
+
+	for (int i = 0; i < 3; i++) {
+		log_enqueue(&dp);
+	}
+	zassert_equal(log_queue_used(), LOG_MSGQ_DEPTH, NULL);
+	zassert_equal(log_queue_dropped(), dropped + 3, NULL);
+}
+
 /* ---- data_logger_flush --------------------------------------------------- */
 
 ZTEST(data_logger_core, test_flush_null_logger)
@@ -459,6 +764,49 @@ ZTEST(data_logger_core, test_start_error_propagated)
 	zassert_ok(data_logger_close(&logger), NULL);
 }
 
+/* ---- data_logger_powerfail ---------------------------------------------- */
+
+/** @brief A supply dip pauses a running logger and resumes it afterwards. */
+ZTEST(data_logger_core, test_powerfail_pauses_running_logger)
+{
+	data_logger_init(&logger, "test", &data_logger_mock_formatter);
+	zassert_ok(data_logger_start(&logger), NULL);
+
+	data_logger_powerfail(true);
+	zassert_equal(atomic_get(&logger.state->running), 0, NULL);
+	data_logger_powerfail(false);
+	zassert_equal(atomic_get(&logger.state->running), 1, NULL);
+
+	zassert_ok(data_logger_close(&logger), NULL);
+}
+
+/**
+ * @brief A logger stopped before or during the dip stays stopped, and
+ *        recovery does not go through the formatter's start.
+ */
+ZTEST(data_logger_core, test_powerfail_keeps_stopped_logger_stopped)
+{
+	data_logger_init(&logger, "test", &data_logger_mock_formatter);
+	zassert_ok(data_logger_start(&logger), NULL);
+	zassert_ok(data_logger_stop(&logger), NULL);
+	int starts = mock_state.start_calls;
+
+	data_logger_powerfail(true);
+	data_logger_powerfail(false);
+	zassert_equal(atomic_get(&logger.state->running), 0,
+		      "recovery restarted a stopped logger");
+
+	zassert_ok(data_logger_start(&logger), NULL);
+	data_logger_powerfail(true);
+	zassert_ok(data_logger_stop(&logger), NULL);
+	data_logger_powerfail(false);
+	zassert_equal(atomic_get(&logger.state->running), 0,
+		      "recovery restarted a logger stopped during the dip");
+	zassert_equal(mock_state.start_calls, starts + 1, NULL);
+
+	zassert_ok(data_logger_close(&logger), NULL);
+}
+
 /* ---- Registry: data_logger_get ------------------------------------------ */
 
 ZTEST(data_logger_core, test_registry_get_after_init)
@@ -638,7 +986,7 @@ ZTEST(data_logger_core, test_full_lifecycle)
 
 #if defined(CONFIG_DATA_LOGGER_CONVERT_CSV)
 
-#define CSV_FILE_PATH CONFIG_DATA_LOGGER_BASE_PATH "/test_0.csv"
+#define CSV_FILE_PATH CONFIG_DATA_LOGGER_BASE_PATH "/test_0.csv" LZ4_EXT
 #define CSV_BUF_SIZE 512
 
 static struct data_logger csv_logger;
@@ -866,7 +1214,7 @@ ZTEST(data_logger_csv, test_csv_multiple_rows)
 
 #if defined(CONFIG_DATA_LOGGER_CONVERT_INFLUX)
 
-#define INFLUX_FILE_PATH CONFIG_DATA_LOGGER_BASE_PATH "/test_0.influx"
+#define INFLUX_FILE_PATH CONFIG_DATA_LOGGER_BASE_PATH "/test_0.influx" LZ4_EXT
 #define INFLUX_BUF_SIZE 512
 
 static struct data_logger influx_logger;
@@ -1008,6 +1356,73 @@ ZTEST(data_logger_influx, test_influx_negative_value)
 			 "Negative value must appear with leading '-'");
 }
 
+/**
+ * @brief Zero padding, the int32 extremes and a 20-digit timestamp are
+ *        written exactly as "%d.%06d" / PRIu64 would.
+ */
+ZTEST(data_logger_influx, test_influx_number_edge_cases)
+{
+	char buf[INFLUX_BUF_SIZE];
+
+	struct datapoint dp = {
+		.timestamp_ns  = UINT64_MAX,
+		.type          = AURORA_DATA_IMU_MAG,
+		.channel_count = 3,
+		.channels = {
+			{.val1 = 0, .val2 = 7},
+			{.val1 = INT32_MAX, .val2 = 999999},
+			{.val1 = 0, .val2 = -5},
+		},
+	};
+
+	zassert_ok(data_logger_init(&influx_logger, "test",
+				    &data_logger_influx_formatter), NULL);
+	zassert_ok(data_logger_start(&influx_logger), NULL);
+	zassert_ok(data_logger_write(&influx_logger, &dp), NULL);
+	zassert_ok(data_logger_close(&influx_logger), NULL);
+
+	read_file(INFLUX_FILE_PATH, buf, sizeof(buf));
+
+	zassert_str_equal(buf, CONFIG_DATA_LOGGER_INFLUX_MEASUREMENT
+			  ",type=mag x=0.000007,y=2147483647.999999,"
+			  "z=-0.000005 18446744073709551615\n", NULL);
+}
+
+/**
+ * @brief Thread-health records name their thread in a tag and carry the
+ *        load as a fraction and the stack high-water mark in bytes.
+ */
+ZTEST(data_logger_influx, test_influx_thread_health)
+{
+	static const uint8_t name[AURORA_HEALTH_NAME_MAX] = "bin writer,2";
+	char buf[INFLUX_BUF_SIZE];
+
+	struct datapoint dp = {
+		.timestamp_ns  = 400ULL,
+		.type          = AURORA_DATA_THREAD_HEALTH,
+		.channel_count = 3,
+		.channels = {
+			{.val1 = (int32_t)sys_get_le32(&name[0]),
+			 .val2 = (int32_t)sys_get_le32(&name[4])},
+			{.val1 = (int32_t)sys_get_le32(&name[8]),
+			 .val2 = (int32_t)sys_get_le32(&name[12])},
+			{.val1 = 812, .val2 = 12345},
+		},
+	};
+
+	zassert_ok(data_logger_init(&influx_logger, "test",
+				    &data_logger_influx_formatter), NULL);
+	zassert_ok(data_logger_start(&influx_logger), NULL);
+	zassert_ok(data_logger_write(&influx_logger, &dp), NULL);
+	zassert_ok(data_logger_close(&influx_logger), NULL);
+
+	read_file(INFLUX_FILE_PATH, buf, sizeof(buf));
+
+	zassert_str_equal(buf, CONFIG_DATA_LOGGER_INFLUX_MEASUREMENT
+			  ",type=thread_health,thread=bin_writer_2 "
+			  "load=0.012345,stack_used=812 400\n", NULL);
+}
+
 /**
  * @brief Multiple datapoints produce one line each (no blank lines).
  */
@@ -1055,6 +1470,100 @@ ZTEST(data_logger_influx, test_influx_multiple_lines)
 		      "Expected exactly 4 lines (one per datapoint)");
 }
 
+/**
+ * @brief A batch produces byte-identical output to the same datapoints
+ *        written one at a time.
+ */
+ZTEST(data_logger_influx, test_influx_batch_matches_single)
+{
+	char single[INFLUX_BUF_SIZE];
+	char batch[INFLUX_BUF_SIZE];
+	struct datapoint dps[3] = {
+		{
+			.timestamp_ns  = 10,
+			.type          = AURORA_DATA_BARO,
+			.channel_count = 2,
+			.channels = {
+				{.val1 = 21, .val2 = 250000},
+				{.val1 = 99000, .val2 = 0},
+			},
+		},
+		{
+			.timestamp_ns  = 20,
+			.type          = AURORA_DATA_IMU_GYRO,
+			.channel_count = 3,
+			.channels = {
+				{.val1 = -1, .val2 = -500000},
+			},
+		},
+		{.timestamp_ns = 30, .type = AURORA_DATA_VBAT,
+		 .channel_count = 1},
+	};
+
+	zassert_ok(data_logger_init(&influx_logger, "test",
+				    &data_logger_influx_formatter), NULL);
+	zassert_ok(data_logger_start(&influx_logger), NULL);
+	for (size_t i = 0; i < ARRAY_SIZE(dps); i++) {
+		zassert_ok(data_logger_write(&influx_logger, &dps[i]), NULL);
+	}
+	zassert_ok(data_logger_close(&influx_logger), NULL);
+
+	int n_single = read_file(INFLUX_FILE_PATH, single, sizeof(single));
+
+	fs_unlink(INFLUX_FILE_PATH);
+	memset(&influx_logger, 0, sizeof(influx_logger));
+
+	zassert_ok(data_logger_init(&influx_logger, "test",
+				    &data_logger_influx_formatter), NULL);
+	zassert_ok(data_logger_start(&influx_logger), NULL);
+	zassert_ok(data_logger_write_batch(&influx_logger, dps,
+					   ARRAY_SIZE(dps)), NULL);
+	zassert_ok(data_logger_close(&influx_logger), NULL);
+
+	int n_batch = read_file(INFLUX_FILE_PATH, batch, sizeof(batch));
+
+	zassert_true(n_single > 0, NULL);
+	zassert_equal(n_batch, n_single, NULL);
+	zassert_mem_equal(batch, single, n_single, NULL);
+}
+
+#if defined(CONFIG_DATA_LOGGER_CONVERT_LZ4)
+/**
+ * @brief The file is an LZ4 frame, and repetitive lines compress.
+ */
+ZTEST(data_logger_influx, test_influx_lz4_frame)
+{
+	static char buf[4096];
+	struct fs_dirent ent;
+	struct datapoint dp = {
+		.type          = AURORA_DATA_BARO,
+		.channel_count = 2,
+		.channels = {
+			{.val1 = 23, .val2 = 500000},
+			{.val1 = 101325, .val2 = 0},
+		},
+	};
+
+	zassert_ok(data_logger_init(&influx_logger, "test",
+				    &data_logger_influx_formatter), NULL);
+	zassert_ok(data_logger_start(&influx_logger), NULL);
+	for (int i = 0; i < 32; i++) {
+		dp.timestamp_ns = 1000000ULL * i;
+		zassert_ok(data_logger_write(&influx_logger, &dp), NULL);
+	}
+	zassert_ok(data_logger_close(&influx_logger), NULL);
+
+	int n = read_file(INFLUX_FILE_PATH, buf, sizeof(buf));
+
+	zassert_true(n > 0, "frame must decode (%d)", n);
+	zassert_not_null(strstr(buf, "telemetry,type=baro"), NULL);
+	zassert_equal(sys_get_le32(lz4_raw), LZ4_FRAME_MAGIC, NULL);
+	zassert_ok(fs_stat(INFLUX_FILE_PATH, &ent), NULL);
+	zassert_true(ent.size * 2 < (size_t)n,
+		     "%u bytes compressed to %u", n, (unsigned int)ent.size);
+}
+#endif /* CONFIG_DATA_LOGGER_CONVERT_LZ4 */
+
 #endif /* CONFIG_DATA_LOGGER_CONVERT_INFLUX */
 
 /* ================================================================== */
@@ -1152,24 +1661,280 @@ ZTEST(data_logger_convert, test_bin_to_csv_roundtrip)
 }
 
 /**
- * @brief Conversion of a freshly-erased partition produces a header-only
- *        CSV (no records) and returns success.
+ * @brief Values that fall, change sign and interleave across types survive
+ *        the round-trip; exercises negative deltas in the packed payload.
  */
-ZTEST(data_logger_convert, test_convert_empty_partition)
+ZTEST(data_logger_convert, test_bin_to_csv_signed_deltas)
 {
-	char buf[256];
-
-	zassert_ok(data_logger_convert(&data_logger_csv_formatter,
-				       RT_CSV_PATH),
-		   "convert on empty partition must succeed");
-
-	int n = read_file(RT_CSV_PATH, buf, sizeof(buf));
-
-	zassert_true(n > 0, "CSV must at least carry the header row");
-	zassert_not_null(strstr(buf, "timestamp_ns"), NULL);
-}
+	char buf[1024];
+	const uint64_t t0 = k_ticks_to_ns_floor64(k_uptime_ticks()) +
+			    10000000ULL;
 
-#endif /* CONFIG_DATA_LOGGER_BIN && CONFIG_DATA_LOGGER_CONVERT_CSV */
+	zassert_ok(data_logger_init(&rt_logger, "rt",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&rt_logger), NULL);
+
+	const struct datapoint dps[] = {
+		{
+			.timestamp_ns  = t0,
+			.type          = AURORA_DATA_BARO,
+			.channel_count = 2,
+			.channels = {
+				{.val1 = 20, .val2 = 0},
+				{.val1 = 101500, .val2 = 0},
+			},
+		},
+		{
+			.timestamp_ns  = t0 + 5000000ULL,
+			.type          = AURORA_DATA_IMU_GYRO,
+			.channel_count = 1,
+			.channels = {
+				{.val1 = -5, .val2 = -250000},
+			},
+		},
+		{
+			.timestamp_ns  = t0 + 10000000ULL,
+			.type          = AURORA_DATA_BARO,
+			.channel_count = 2,
+			.channels = {
+				{.val1 = 19, .val2 = 0},
+				{.val1 = 99000, .val2 = 0},
+			},
+		},
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(dps); i++) {
+		zassert_ok(data_logger_write(&rt_logger, &dps[i]), NULL);
+	}
+	zassert_ok(data_logger_close(&rt_logger), NULL);
+
+	zassert_ok(data_logger_convert(&data_logger_csv_formatter,
+				       RT_CSV_PATH), NULL);
+
+	int n = read_file(RT_CSV_PATH, buf, sizeof(buf));
+
+	zassert_true(n > 0, NULL);
+	zassert_not_null(strstr(buf, "101500.000000"), NULL);
+	zassert_not_null(strstr(buf, "-5.250000"), NULL);
+	zassert_not_null(strstr(buf, "99000.000000"), NULL);
+}
+
+#if defined(CONFIG_DATA_LOGGER_CONVERT_INFLUX)
+#define RT_INFLUX_PATH CONFIG_DATA_LOGGER_BASE_PATH "/rt.txt"
+
+/**
+ * @brief One multi-output pass writes the same samples to CSV and
+ *        Influx, and reports success per output.
+ */
+ZTEST(data_logger_convert, test_convert_multi_single_pass)
+{
+	char buf[1024];
+	struct data_logger_convert_out outs[] = {
+		{.fmt = &data_logger_csv_formatter,    .path = RT_CSV_PATH},
+		{.fmt = &data_logger_influx_formatter, .path = RT_INFLUX_PATH},
+	};
+
+	fs_unlink(RT_INFLUX_PATH);
+	zassert_ok(data_logger_init(&rt_logger, "rt",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&rt_logger), NULL);
+
+	struct datapoint dp = {
+		.timestamp_ns  = 1234ULL,
+		.type          = AURORA_DATA_BARO,
+		.channel_count = 2,
+		.channels = {
+			{.val1 = 25, .val2 = 500000},
+			{.val1 = 101500, .val2 = 0},
+		},
+	};
+
+	zassert_ok(data_logger_write(&rt_logger, &dp), NULL);
+	zassert_ok(data_logger_close(&rt_logger), NULL);
+
+	outs[0].rc = outs[1].rc = -1;
+	zassert_ok(data_logger_convert_multi(outs, ARRAY_SIZE(outs)), NULL);
+	zassert_ok(outs[0].rc, NULL);
+	zassert_ok(outs[1].rc, NULL);
+
+	zassert_true(read_file(RT_CSV_PATH, buf, sizeof(buf)) > 0, NULL);
+	zassert_not_null(strstr(buf, "timestamp_ns"), NULL);
+	zassert_not_null(strstr(buf, "101500.000000"), NULL);
+
+	zassert_true(read_file(RT_INFLUX_PATH, buf, sizeof(buf)) > 0, NULL);
+	zassert_not_null(strstr(buf, "telemetry,type=baro"), NULL);
+	zassert_not_null(strstr(buf, "101500.000000"), NULL);
+
+	zassert_equal(data_logger_convert_multi(outs, 0), -EINVAL, NULL);
+	zassert_equal(data_logger_convert_multi(
+			outs, DATA_LOGGER_CONVERT_MAX_OUT + 1), -EINVAL, NULL);
+}
+
+#if defined(CONFIG_DATA_LOGGER_CONVERT_AUDIT)
+#include <aurora/lib/state/audit.h>
+
+#define RT_AUDIT_PATH CONFIG_DATA_LOGGER_BASE_PATH "/rt.aud"
+
+/* Text bytes 4 * @p w .. 4 * @p w + 3 of an audit record, little-endian. */
+static int32_t audit_word(const char *text, size_t w)
+{
+	uint8_t b[4] = { 0 };
+
+	strncpy((char *)b, text + MIN(strlen(text), 4U * w), sizeof(b));
+	return (int32_t)sys_get_le32(b);
+}
+
+/**
+ * @brief Audit records in the binary log come out as the audit text
+ *        trail and stay out of the sensor outputs.
+ */
+ZTEST(data_logger_convert, test_convert_audit_trail)
+{
+	static const char text[] = "apogee timeout expired";
+	char buf[1024];
+	struct data_logger_convert_out outs[] = {
+		{.fmt = &data_logger_influx_formatter, .path = RT_INFLUX_PATH},
+		{.fmt = &data_logger_audit_formatter,  .path = RT_AUDIT_PATH},
+	};
+	const struct datapoint dps[] = {
+		{
+			.timestamp_ns  = 1000ULL,
+			.type          = AURORA_DATA_SM_AUDIT,
+			.channel_count = 3,
+			.channels = {
+				{.val1 = AURORA_AUDIT_TAG(SM_AUDIT_TRANSITION,
+							  SM_IDLE, SM_ARMED, 0)},
+			},
+		},
+		{
+			.timestamp_ns  = 2000ULL,
+			.type          = AURORA_DATA_BARO,
+			.channel_count = 2,
+			.channels = {
+				{.val1 = 25, .val2 = 500000},
+				{.val1 = 101500, .val2 = 0},
+			},
+		},
+		{
+			.timestamp_ns  = 3000ULL,
+			.type          = AURORA_DATA_SM_AUDIT,
+			.channel_count = 3,
+			.channels = {
+				{.val1 = AURORA_AUDIT_TAG(SM_AUDIT_EVENT, SM_APOGEE,
+							  SM_APOGEE, 0),
+				 .val2 = sizeof(text) - 1},
+				{.val1 = audit_word(text, 0), .val2 = audit_word(text, 1)},
+				{.val1 = audit_word(text, 2), .val2 = audit_word(text, 3)},
+			},
+		},
+		{
+			.timestamp_ns  = 3000ULL,
+			.type          = AURORA_DATA_SM_AUDIT,
+			.channel_count = 3,
+			.channels = {
+				{.val1 = AURORA_AUDIT_TAG(SM_AUDIT_EVENT, SM_APOGEE,
+							  SM_APOGEE, 1),
+				 .val2 = sizeof(text) - 1},
+				{.val1 = audit_word(text, 4), .val2 = audit_word(text, 5)},
+				{.val1 = audit_word(text, 6), .val2 = audit_word(text, 7)},
+			},
+		},
+	};
+
+	fs_unlink(RT_INFLUX_PATH);
+	fs_unlink(RT_AUDIT_PATH);
+	zassert_ok(data_logger_init(&rt_logger, "rt",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&rt_logger), NULL);
+	zassert_ok(data_logger_write_batch(&rt_logger, dps, ARRAY_SIZE(dps)),
+		   NULL);
+	zassert_ok(data_logger_close(&rt_logger), NULL);
+
+	zassert_ok(data_logger_convert_multi(outs, ARRAY_SIZE(outs)), NULL);
+
+	zassert_true(read_file(RT_INFLUX_PATH, buf, sizeof(buf)) > 0, NULL);
+	zassert_not_null(strstr(buf, "type=baro"), NULL);
+	zassert_is_null(strstr(buf, "sm_audit"), "audit kept out of influx");
+
+	zassert_true(read_file(RT_AUDIT_PATH, buf, sizeof(buf)) > 0, NULL);
+	zassert_not_null(strstr(buf, "transition"), "%s", buf);
+	zassert_not_null(strstr(buf, "ARMED"), "%s", buf);
+	zassert_not_null(strstr(buf, text), "event text reassembled: %s", buf);
+	zassert_is_null(strstr(buf, "101500"), "sensor data kept out");
+}
+#endif /* CONFIG_DATA_LOGGER_CONVERT_AUDIT */
+#endif /* CONFIG_DATA_LOGGER_CONVERT_INFLUX */
+
+#if defined(CONFIG_DATA_LOGGER_BIN_BACKEND_FLASH)
+/**
+ * @brief After the ring wraps, conversion starts at the oldest surviving
+ *        frame, wherever the wrap point landed.
+ *
+ * One record per frame, so frame i carries pressure 1000 + i.  The
+ * ring holds fewer than 70 slots, so frame 0 is overwritten
+ * and the newest frame sits early in the partition.
+ */
+ZTEST(data_logger_convert, test_convert_after_wrap)
+{
+	const uint32_t wrap_frames = 70;
+	const uint64_t t0 = k_ticks_to_ns_floor64(k_uptime_ticks()) +
+			    10000000ULL;
+	static char buf[16384];
+
+	zassert_ok(data_logger_init(&rt_logger, "rt",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&rt_logger), NULL);
+
+	for (uint32_t i = 0; i < wrap_frames; i++) {
+		struct datapoint dp = {
+			.timestamp_ns  = t0 + (uint64_t)i * 100000000ULL,
+			.type          = AURORA_DATA_BARO,
+			.channel_count = 2,
+			.channels = {
+				{.val1 = 20, .val2 = 0},
+				{.val1 = 1000 + (int32_t)i, .val2 = 0},
+			},
+		};
+
+		zassert_ok(data_logger_write(&rt_logger, &dp), NULL);
+		zassert_ok(data_logger_flush(&rt_logger), NULL);
+	}
+	zassert_ok(data_logger_close(&rt_logger), NULL);
+
+	zassert_ok(data_logger_convert(&data_logger_csv_formatter,
+				       RT_CSV_PATH), NULL);
+
+	int n = read_file(RT_CSV_PATH, buf, sizeof(buf));
+
+	zassert_true(n > 0, NULL);
+	zassert_is_null(strstr(buf, "1000.000000"),
+			"Frame 0 was overwritten by the wrap");
+	zassert_not_null(strstr(buf, "1040.000000"),
+			 "Frames behind the wrap point must be converted");
+	zassert_not_null(strstr(buf, "1069.000000"),
+			 "The newest frame must be converted");
+}
+#endif /* CONFIG_DATA_LOGGER_BIN_BACKEND_FLASH */
+
+/**
+ * @brief Conversion of a freshly-erased partition produces a header-only
+ *        CSV (no records) and returns success.
+ */
+ZTEST(data_logger_convert, test_convert_empty_partition)
+{
+	char buf[256];
+
+	zassert_ok(data_logger_convert(&data_logger_csv_formatter,
+				       RT_CSV_PATH),
+		   "convert on empty partition must succeed");
+
+	int n = read_file(RT_CSV_PATH, buf, sizeof(buf));
+
+	zassert_true(n > 0, "CSV must at least carry the header row");
+	zassert_not_null(strstr(buf, "timestamp_ns"), NULL);
+}
+
+#endif /* CONFIG_DATA_LOGGER_BIN && CONFIG_DATA_LOGGER_CONVERT_CSV */
 
 /* ================================================================== */
 /*  Suite 5: flash backend on-flash layout & single-instance semantics */
@@ -1213,6 +1978,7 @@ static int flash_read_frame(off_t off, void *buf, size_t len)
 	return rc;
 }
 
+#if !defined(CONFIG_DATA_LOGGER_BIN_PACKED)
 /**
  * @brief A single datapoint produces a valid frame at offset 0 with the
  *        record placed immediately after the 32-byte header.
@@ -1262,6 +2028,53 @@ ZTEST(data_logger_flash, test_flash_frame_layout)
 	zassert_equal(rec->channels[1].val1, 101325, NULL);
 	zassert_equal(rec->channels[1].val2, 0, NULL);
 }
+#else
+/**
+ * @brief A single datapoint produces a v3 frame at offset 0 whose payload
+ *        starts with the packed type/channel-count tag.
+ */
+ZTEST(data_logger_flash, test_flash_packed_layout)
+{
+	uint8_t frame[BIN_FRAME_BYTES];
+
+	struct datapoint dp = {
+		.timestamp_ns  = 1000ULL,
+		.type          = AURORA_DATA_BARO,
+		.channel_count = 2,
+		.channels = {
+			{.val1 = 23, .val2 = 500000},
+			{.val1 = 101325, .val2 = 0},
+		},
+	};
+
+	zassert_ok(data_logger_init(&flash_logger, "flash",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&flash_logger), NULL);
+	zassert_ok(data_logger_write(&flash_logger, &dp), NULL);
+	zassert_ok(data_logger_close(&flash_logger), NULL);
+
+	zassert_ok(flash_read_frame(0, frame, sizeof(frame)), NULL);
+
+	const struct aurora_bin_frame_header *h =
+		(const struct aurora_bin_frame_header *)frame;
+	const uint8_t *p = frame + sizeof(struct aurora_bin_frame_header);
+
+	zassert_mem_equal(h->magic, AURORA_BIN_FRAME_MAGIC, 4, NULL);
+	zassert_equal(h->version, AURORA_BIN_VERSION_PACKED,
+		      "Packed build must write format v3 frames");
+	zassert_equal(h->seq, 0U, NULL);
+
+	/* Timestamp predates base_ts_ns, so it clamps to a zero delta. */
+	zassert_equal(p[0], (2U << 6) | (uint8_t)AURORA_DATA_BARO,
+		      "Tag must carry channel_count and type");
+	zassert_equal(p[1], 0x00, "ts delta must zigzag-encode to 0");
+	zassert_equal(p[2], 46U, "val1 23 must zigzag-encode to 46");
+
+	/* Only one short record was written; the rest stays erased. */
+	zassert_equal(frame[BIN_FRAME_BYTES - 1], 0xFF, NULL);
+	zassert_equal(p[32], 0xFF, "packed record must be under 32 bytes");
+}
+#endif /* !CONFIG_DATA_LOGGER_BIN_PACKED */
 
 /**
  * @brief Filling one frame and writing one extra record produces a second
@@ -1269,9 +2082,15 @@ ZTEST(data_logger_flash, test_flash_frame_layout)
  */
 ZTEST(data_logger_flash, test_flash_seq_across_frames)
 {
+#if defined(CONFIG_DATA_LOGGER_BIN_PACKED)
+	/* Every packed record is at least one byte, so this overflows. */
+	const size_t records_per_frame =
+		BIN_FRAME_BYTES - sizeof(struct aurora_bin_frame_header);
+#else
 	const size_t records_per_frame =
 		(BIN_FRAME_BYTES - sizeof(struct aurora_bin_frame_header)) /
 		sizeof(struct aurora_bin_record);
+#endif
 
 	zassert_ok(data_logger_init(&flash_logger, "seq",
 				    &data_logger_bin_formatter), NULL);
@@ -1312,6 +2131,144 @@ ZTEST(data_logger_flash, test_flash_seq_across_frames)
 		      "Both frames must carry the same flight_id");
 }
 
+/**
+ * @brief A batch that overflows one frame rotates mid-batch exactly like
+ *        the same datapoints written one at a time.
+ */
+ZTEST(data_logger_flash, test_flash_batch_across_frames)
+{
+#if defined(CONFIG_DATA_LOGGER_BIN_PACKED)
+	const size_t count =
+		BIN_FRAME_BYTES - sizeof(struct aurora_bin_frame_header) + 1;
+#else
+	const size_t count =
+		(BIN_FRAME_BYTES - sizeof(struct aurora_bin_frame_header)) /
+		sizeof(struct aurora_bin_record) + 1;
+#endif
+	static struct datapoint dps[BIN_FRAME_BYTES];
+
+	zassert_true(count <= ARRAY_SIZE(dps), NULL);
+	for (size_t i = 0; i < count; i++) {
+		dps[i] = (struct datapoint){
+			.timestamp_ns  = (uint64_t)(i + 1) * 100,
+			.type          = AURORA_DATA_BARO,
+			.channel_count = 2,
+			.channels = {
+				{.val1 = (int32_t)i, .val2 = 0},
+				{.val1 = 100000, .val2 = 0},
+			},
+		};
+	}
+
+	zassert_ok(data_logger_init(&flash_logger, "batch",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&flash_logger), NULL);
+	zassert_ok(data_logger_write_batch(&flash_logger, dps, count), NULL);
+	zassert_ok(data_logger_close(&flash_logger), NULL);
+
+	uint8_t frame[BIN_FRAME_BYTES];
+	const struct aurora_bin_frame_header *h =
+		(const struct aurora_bin_frame_header *)frame;
+
+	zassert_ok(flash_read_frame(0, frame, sizeof(frame)), NULL);
+	zassert_mem_equal(h->magic, AURORA_BIN_FRAME_MAGIC, 4, NULL);
+	zassert_equal(h->seq, 0U, NULL);
+
+	zassert_ok(flash_read_frame((off_t)BIN_FRAME_BYTES,
+				    frame, sizeof(frame)), NULL);
+	zassert_mem_equal(h->magic, AURORA_BIN_FRAME_MAGIC, 4,
+			  "The overflow record must open a second frame");
+	zassert_equal(h->seq, 1U, NULL);
+#if !defined(CONFIG_DATA_LOGGER_BIN_PACKED)
+	const struct aurora_bin_record *r =
+		(const struct aurora_bin_record *)(frame + sizeof(*h));
+
+	zassert_equal(r[0].channels[0].val1, (int32_t)(count - 1), NULL);
+	zassert_equal(r[1].type, 0xFF, NULL);
+#endif
+}
+
+#if !defined(CONFIG_DATA_LOGGER_BIN_PACKED)
+/**
+ * @brief A record written in place via reserve/commit lands in the frame
+ *        exactly like one passed through data_logger_write; committing
+ *        an invalid type discards the slot.
+ */
+ZTEST(data_logger_flash, test_flash_reserve_commit)
+{
+	uint8_t frame[BIN_FRAME_BYTES];
+	struct aurora_bin_record *rec;
+
+	zassert_ok(data_logger_init(&flash_logger, "rsv",
+				    &data_logger_bin_formatter), NULL);
+	zassert_equal(data_logger_reserve(&flash_logger, 0, &rec), -EAGAIN,
+		      "Reserve before start must not hand out a slot");
+	zassert_ok(data_logger_start(&flash_logger), NULL);
+
+	zassert_ok(data_logger_reserve(&flash_logger, 0, &rec), NULL);
+	rec->type = 0xFE;
+	zassert_equal(data_logger_commit(&flash_logger, rec), -EINVAL,
+		      "Invalid type must abort the reservation");
+
+	zassert_ok(data_logger_reserve(&flash_logger, 0, &rec), NULL);
+	rec->type               = (uint8_t)AURORA_DATA_IMU_GYRO;
+	rec->channel_count      = 1;
+	rec->channels[0].val1   = -3;
+	rec->channels[0].val2   = -125000;
+	rec->channels[1].val1   = 77;	/* beyond channel_count: zeroed */
+	zassert_ok(data_logger_commit(&flash_logger, rec), NULL);
+
+	zassert_ok(data_logger_close(&flash_logger), NULL);
+	zassert_ok(flash_read_frame(0, frame, sizeof(frame)), NULL);
+
+	const struct aurora_bin_record *r =
+		(const struct aurora_bin_record *)(frame +
+			sizeof(struct aurora_bin_frame_header));
+
+	zassert_equal(r[0].type, (uint8_t)AURORA_DATA_IMU_GYRO,
+		      "Aborted slot must be reused by the next reservation");
+	zassert_equal(r[0].channel_count, 1, NULL);
+	zassert_equal(r[0].channels[0].val1, -3, NULL);
+	zassert_equal(r[0].channels[0].val2, -125000, NULL);
+	zassert_equal(r[0].channels[1].val1, 0, NULL);
+	zassert_equal(r[1].type, 0xFF, "Only one record may be committed");
+}
+#endif /* !CONFIG_DATA_LOGGER_BIN_PACKED */
+
+#if defined(CONFIG_DATA_LOGGER_BIN_ZERO_COPY)
+/**
+ * @brief While the sample queue holds a record, log_record() queues the
+ *        sample behind it instead of writing it into the live frame
+ *        ahead of the older record.
+ */
+ZTEST(data_logger_flash, test_flash_zero_copy_keeps_queue_order)
+{
+	uint8_t frame[BIN_FRAME_BYTES];
+	struct datapoint dp = {.type = AURORA_DATA_VBAT, .channel_count = 1};
+	const struct sensor_value ch = {.val1 = 1};
+
+	zassert_ok(data_logger_init(&sm_logger, "zc",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&sm_logger), NULL);
+	atomic_set(&sm_logger_live, 1);
+
+	log_enqueue(&dp);
+	zassert_true(log_queue_used() > 0, NULL);
+	log_record(AURORA_DATA_IMU_GYRO, 1000, &ch, 1);
+
+	atomic_set(&sm_logger_live, 0);
+	zassert_ok(data_logger_close(&sm_logger), NULL);
+	zassert_ok(flash_read_frame(0, frame, sizeof(frame)), NULL);
+
+	const struct aurora_bin_record *r =
+		(const struct aurora_bin_record *)(frame +
+			sizeof(struct aurora_bin_frame_header));
+
+	zassert_equal(r[0].type, 0xFF,
+		      "The sample overtook a queued record");
+}
+#endif /* CONFIG_DATA_LOGGER_BIN_ZERO_COPY */
+
 /**
  * @brief A second concurrent open of the flash backend is rejected with
  *        -EBUSY; reopening after close succeeds.
@@ -1355,4 +2312,267 @@ ZTEST(data_logger_flash, test_flash_event_hooks)
 	zassert_ok(data_logger_close(&flash_logger), NULL);
 }
 
+#if CONFIG_DATA_LOGGER_BIN_ERASE_AHEAD > 0 && \
+	CONFIG_DATA_LOGGER_BIN_PRETRIGGER_FRAMES == 0
+/**
+ * @brief While idle the writer keeps ERASE_AHEAD frames past the write
+ *        offset erased, and touches nothing beyond them.
+ */
+ZTEST(data_logger_flash, test_flash_erase_ahead)
+{
+	const uint32_t ahead = CONFIG_DATA_LOGGER_BIN_ERASE_AHEAD;
+	static uint8_t frame[BIN_FRAME_BYTES];
+	const struct flash_area *fa;
+
+	/* Dirty the slots after frame 0 so erased ones stand out. */
+	memset(frame, 0x00, sizeof(frame));
+	zassert_ok(flash_area_open(FLASH_LOG_ID, &fa), NULL);
+	for (uint32_t i = 1; i <= ahead + 1U; i++) {
+		zassert_ok(flash_area_write(fa, (off_t)(i * BIN_FRAME_BYTES),
+					    frame, sizeof(frame)), NULL);
+	}
+	flash_area_close(fa);
+
+	struct datapoint dp = {
+		.timestamp_ns  = 1000ULL,
+		.type          = AURORA_DATA_BARO,
+		.channel_count = 2,
+	};
+
+	zassert_ok(data_logger_init(&flash_logger, "ahead",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&flash_logger), NULL);
+	zassert_ok(data_logger_write(&flash_logger, &dp), NULL);
+	zassert_ok(data_logger_flush(&flash_logger), NULL);
+
+	/* Give the writer its idle turns. */
+	k_msleep(100);
+	zassert_ok(data_logger_close(&flash_logger), NULL);
+
+	zassert_ok(flash_read_frame(0, frame, sizeof(frame)), NULL);
+	zassert_mem_equal(frame, AURORA_BIN_FRAME_MAGIC, 4, NULL);
+
+	for (uint32_t i = 1; i <= ahead; i++) {
+		zassert_ok(flash_read_frame((off_t)(i * BIN_FRAME_BYTES),
+					    frame, sizeof(frame)), NULL);
+		for (size_t j = 0; j < sizeof(frame); j++) {
+			zassert_equal(frame[j], 0xFF,
+				      "Slot %u must be pre-erased", i);
+		}
+	}
+
+	zassert_ok(flash_read_frame((off_t)((ahead + 1U) * BIN_FRAME_BYTES),
+				    frame, sizeof(frame)), NULL);
+	zassert_equal(frame[0], 0x00,
+		      "Nothing beyond the reserve may be erased");
+}
+#endif /* CONFIG_DATA_LOGGER_BIN_ERASE_AHEAD > 0 && !PRETRIGGER_FRAMES */
+
+#if CONFIG_DATA_LOGGER_BIN_PRETRIGGER_FRAMES > 0 && \
+	!defined(CONFIG_DATA_LOGGER_BIN_PACKED)
+/**
+ * @brief Pre-boost frames aging out of the RAM history are decimated to
+ *        flash; BOOST writes the full-rate history right behind them,
+ *        all under one contiguous seq run.
+ *
+ * Nine frames fill before BOOST and frame 9 is live when it fires.
+ * With FRAMES=4 and DECIMATE=2, frames 0..4 age out and 0, 2, 4 are
+ * kept, then BOOST releases 5..8 and close writes frame 9.
+ */
+ZTEST(data_logger_flash, test_flash_pretrigger_history)
+{
+	BUILD_ASSERT(CONFIG_DATA_LOGGER_BIN_PRETRIGGER_FRAMES == 4 &&
+		     CONFIG_DATA_LOGGER_BIN_PRETRIGGER_DECIMATE == 2,
+		     "expected frame list below assumes FRAMES=4, DECIMATE=2");
+	static const int32_t expect[] = { 0, 2, 4, 5, 6, 7, 8, 9 };
+	const size_t per_frame =
+		(BIN_FRAME_BYTES - sizeof(struct aurora_bin_frame_header)) /
+		sizeof(struct aurora_bin_record);
+	uint8_t frame[BIN_FRAME_BYTES];
+
+	zassert_ok(data_logger_init(&flash_logger, "pre",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&flash_logger), NULL);
+
+	for (size_t i = 0; i < 10 * per_frame; i++) {
+		struct datapoint dp = {
+			.timestamp_ns  = (uint64_t)(i + 1) * 100,
+			.type          = AURORA_DATA_BARO,
+			.channel_count = 2,
+			.channels = {
+				{.val1 = (int32_t)(i / per_frame), .val2 = 0},
+			},
+		};
+
+		zassert_ok(data_logger_write(&flash_logger, &dp), NULL);
+	}
+
+	/* Let the writer commit the decimated frames. */
+	k_msleep(50);
+	zassert_ok(flash_read_frame(0, frame, sizeof(frame)), NULL);
+	zassert_mem_equal(frame, AURORA_BIN_FRAME_MAGIC, 4,
+			  "Decimated frame 0 must already be on flash");
+	zassert_ok(flash_read_frame((off_t)(3 * BIN_FRAME_BYTES),
+				    frame, sizeof(frame)), NULL);
+	zassert_equal(frame[0], 0xFF, "History must stay in RAM until BOOST");
+
+	zassert_ok(data_logger_event(&flash_logger, DLE_BOOST), NULL);
+	zassert_ok(data_logger_close(&flash_logger), NULL);
+
+	const struct aurora_bin_frame_header *h =
+		(const struct aurora_bin_frame_header *)frame;
+	const struct aurora_bin_record *r =
+		(const struct aurora_bin_record *)(frame + sizeof(*h));
+
+	for (size_t slot = 0; slot < ARRAY_SIZE(expect); slot++) {
+		zassert_ok(flash_read_frame((off_t)(slot * BIN_FRAME_BYTES),
+					    frame, sizeof(frame)), NULL);
+		zassert_equal(h->seq, slot, "Slot %zu seq", slot);
+		zassert_equal(r[0].channels[0].val1, expect[slot],
+			      "Slot %zu must hold frame %d", slot,
+			      expect[slot]);
+	}
+
+	zassert_ok(flash_read_frame((off_t)(ARRAY_SIZE(expect) *
+					    BIN_FRAME_BYTES),
+				    frame, sizeof(frame)), NULL);
+	zassert_equal(frame[0], 0xFF, "Nothing may follow frame 9");
+}
+#endif /* CONFIG_DATA_LOGGER_BIN_PRETRIGGER_FRAMES > 0 && !PACKED */
+
+#if defined(CONFIG_DATA_LOGGER_BIN_INDEX)
+/**
+ * @brief The index in the last partition slot points BOOST and APOGEE at
+ *        the frames that were open when they fired, and a time lookup
+ *        finds the newest indexed frame.
+ */
+ZTEST(data_logger_flash, test_flash_index_seek)
+{
+	struct datapoint dp = {
+		.timestamp_ns  = 1000ULL,
+		.type          = AURORA_DATA_BARO,
+		.channel_count = 2,
+	};
+	struct data_logger_seek pos;
+	uint8_t frame[BIN_FRAME_BYTES];
+	const struct flash_area *fa;
+	off_t index_off;
+
+	zassert_ok(flash_area_open(FLASH_LOG_ID, &fa), NULL);
+	index_off = (off_t)(fa->fa_size - BIN_FRAME_BYTES);
+	flash_area_close(fa);
+
+	zassert_ok(data_logger_init(&flash_logger, "idx",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&flash_logger), NULL);
+	zassert_ok(data_logger_event(&flash_logger, DLE_BOOST), NULL);
+
+	/* Frames 0 and 1, then APOGEE while frame 2 is open. */
+	for (int i = 0; i < 2; i++) {
+		zassert_ok(data_logger_write(&flash_logger, &dp), NULL);
+		zassert_ok(data_logger_flush(&flash_logger), NULL);
+	}
+	zassert_ok(data_logger_event(&flash_logger, DLE_APOGEE), NULL);
+	zassert_ok(data_logger_write(&flash_logger, &dp), NULL);
+	zassert_ok(data_logger_close(&flash_logger), NULL);
+
+	zassert_ok(flash_read_frame(index_off, frame, sizeof(frame)), NULL);
+	zassert_mem_equal(frame, AURORA_BIN_INDEX_MAGIC, 4,
+			  "Index must sit in the last partition slot");
+
+	zassert_ok(data_logger_seek_event(DLE_BOOST, &pos), NULL);
+	zassert_equal(pos.seq, 0U, NULL);
+	zassert_equal(pos.offset, 0, NULL);
+
+	zassert_ok(data_logger_seek_event(DLE_APOGEE, &pos), NULL);
+	zassert_equal(pos.seq, 2U, NULL);
+	zassert_equal(pos.offset, (off_t)(2 * BIN_FRAME_BYTES), NULL);
+
+	zassert_equal(data_logger_seek_event(DLE_LANDED, &pos), -ENOENT,
+		      "LANDED never fired");
+
+	zassert_ok(data_logger_seek_time(UINT64_MAX, &pos), NULL);
+	zassert_equal(pos.seq, 2U, "Newest indexed frame is the APOGEE one");
+	zassert_equal(data_logger_seek_time(0, &pos), -ENOENT,
+		      "Nothing starts before the first frame");
+}
+#endif /* CONFIG_DATA_LOGGER_BIN_INDEX */
+
+#if defined(CONFIG_DATA_LOGGER_DUMP)
+struct dump_seen {
+	uint32_t seq[8];
+	size_t frames;
+	size_t calls;
+};
+
+static int dump_collect(const void *frames, size_t len, void *user_data)
+{
+	struct dump_seen *seen = user_data;
+
+	zassert_equal(len % BIN_FRAME_BYTES, 0, "Runs hold whole frames");
+	for (size_t off = 0; off < len; off += BIN_FRAME_BYTES) {
+		const struct aurora_bin_frame_header *h =
+			(const void *)((const uint8_t *)frames + off);
+
+		zassert_true(seen->frames < ARRAY_SIZE(seen->seq), NULL);
+		seen->seq[seen->frames++] = h->seq;
+	}
+	seen->calls++;
+	return 0;
+}
+
+/**
+ * @brief A dump hands over exactly the frames of its seq or time range,
+ *        in batches of CONFIG_DATA_LOGGER_DUMP_BATCH_FRAMES.
+ */
+ZTEST(data_logger_flash, test_flash_dump_range)
+{
+	struct datapoint dp = {
+		.type          = AURORA_DATA_BARO,
+		.channel_count = 2,
+	};
+	struct data_logger_dump_range range = {
+		.first_seq = 1,
+		.last_seq  = 3,
+		.to_ns     = UINT64_MAX,
+	};
+	struct dump_seen seen = { 0 };
+
+	zassert_ok(data_logger_init(&flash_logger, "dump",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&flash_logger), NULL);
+
+	/* Frames 0..5, frame i starting at (i + 1) ms. */
+	for (int i = 0; i < 6; i++) {
+		dp.timestamp_ns = (uint64_t)(i + 1) * NSEC_PER_MSEC;
+		zassert_ok(data_logger_write(&flash_logger, &dp), NULL);
+		zassert_ok(data_logger_flush(&flash_logger), NULL);
+	}
+	zassert_ok(data_logger_close(&flash_logger), NULL);
+
+	zassert_equal(data_logger_dump(&range, dump_collect, &seen), 3, NULL);
+	zassert_equal(seen.seq[0], 1U, NULL);
+	zassert_equal(seen.seq[2], 3U, NULL);
+	zassert_equal(seen.calls,
+		      DIV_ROUND_UP(3, CONFIG_DATA_LOGGER_DUMP_BATCH_FRAMES),
+		      "One callback per storage read");
+
+	/* Frames starting in [3 ms, 5 ms] are seq 2..4. */
+	range = (struct data_logger_dump_range){
+		.last_seq = UINT32_MAX,
+		.from_ns  = 3 * NSEC_PER_MSEC,
+		.to_ns    = 5 * NSEC_PER_MSEC,
+	};
+	seen = (struct dump_seen){ 0 };
+	zassert_equal(data_logger_dump(&range, dump_collect, &seen), 3, NULL);
+	zassert_equal(seen.seq[0], 2U, NULL);
+	zassert_equal(seen.seq[2], 4U, NULL);
+
+	range.first_seq = 4;
+	range.last_seq  = 3;
+	zassert_equal(data_logger_dump(&range, dump_collect, &seen), -EINVAL,
+		      "An empty range is rejected");
+}
+#endif /* CONFIG_DATA_LOGGER_DUMP */
+
 #endif /* CONFIG_DATA_LOGGER_BIN && CONFIG_DATA_LOGGER_BIN_BACKEND_FLASH */
@@ -0,0 +1,939 @@
+/**
+ * @file main.c
+ * @brief Unit tests for the disk-backed binary flight-log backend.
+ *
+ * The flight-log raw region covers a whole RAM disk ("LOG"), so frame n
+ * lives at sector n * (frame size / sector size).  Six suites:
+ *
+ *  1. **data_logger_disk** — binary → CSV round-trip through
+ *     data_logger_convert(); runs with either frame layout.
+ *
+ *  2. **data_logger_disk_columnar** (CONFIG_DATA_LOGGER_BIN_COLUMNAR) —
+ *     asserts the single-type struct-of-arrays frame layout, the
+ *     reserved1 type tag, frame rotation on full / flush and the
+ *     time-ordered merge of the types on conversion.
+ *
+ *  3. **data_logger_disk_sessions** (CONFIG_DATA_LOGGER_DISK_SESSIONS) —
+ *     flights appended behind a catalogue in slot 0, per-flight
+ *     conversion and recovery of a flight that was never closed.
+ *
+ *  4. **data_logger_disk_mirror** (CONFIG_DATA_LOGGER_BIN_MIRROR) —
+ *     the flash partition receives a contiguous copy of the flight,
+ *     critical records included.
+ *
+ *  5. **data_logger_disk_bench** (CONFIG_DATA_LOGGER_DISK_BENCH) — the
+ *     card benchmark tests the end of the region only and refuses to
+ *     run under an open logger.
+ *
+ *  6. **data_logger_disk_trail** (CONFIG_DATA_LOGGER_CONVERT_TRAIL) —
+ *     frames are converted behind the writer while the logger is open.
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <errno.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/storage/disk_access.h>
+#if defined(CONFIG_DATA_LOGGER_BIN_MIRROR)
+#include <zephyr/storage/flash_map.h>
+#endif
+
+#include <aurora/lib/data_logger.h>
+
+#define DISK_NODE       DT_CHOSEN(auxspace_flight_log_disk)
+#define DISK_NAME       DT_PROP(DISK_NODE, disk_name)
+#define SECTOR_BYTES    512U
+#define FRAME_BYTES     ((size_t)CONFIG_DATA_LOGGER_BIN_FRAME_SIZE)
+#define FRAME_SECTORS   (FRAME_BYTES / SECTOR_BYTES)
+#define WIPE_FRAMES     16U
+#define CSV_PATH        CONFIG_DATA_LOGGER_BASE_PATH "/disk.csv"
+
+static struct data_logger disk_logger;
+static uint8_t frame_buf[FRAME_BYTES] __aligned(4);
+
+static int read_file(const char *path, char *buf, size_t size)
+{
+	struct fs_file_t f;
+
+	fs_file_t_init(&f);
+
+	int rc = fs_open(&f, path, FS_O_READ);
+
+	if (rc < 0) {
+		return rc;
+	}
+
+	ssize_t n = fs_read(&f, buf, size - 1);
+
+	fs_close(&f);
+
+	if (n < 0) {
+		return (int)n;
+	}
+
+	buf[n] = '\0';
+	return (int)n;
+}
+
+static void read_disk_frame(uint32_t idx)
+{
+	zassert_ok(disk_access_read(DISK_NAME, frame_buf,
+				    idx * FRAME_SECTORS, FRAME_SECTORS),
+		   "Reading frame %u from the raw region must succeed", idx);
+}
+
+/* Erase the head of the raw region so every test starts on blank
+ * (0xFF) sectors and never picks up a previous test's frames.
+ */
+static void disk_before(void *fixture)
+{
+	(void)fixture;
+	memset(&disk_logger, 0, sizeof(disk_logger));
+	fs_unlink(CSV_PATH);
+
+	zassert_ok(disk_access_init(DISK_NAME), NULL);
+	memset(frame_buf, 0xFF, sizeof(frame_buf));
+	for (uint32_t i = 0; i < WIPE_FRAMES; i++) {
+		zassert_ok(disk_access_write(DISK_NAME, frame_buf,
+					     i * FRAME_SECTORS,
+					     FRAME_SECTORS), NULL);
+	}
+}
+
+/* ========================================================================== */
+/*  Suite 1: binary → CSV round-trip                                          */
+/* ========================================================================== */
+
+ZTEST_SUITE(data_logger_disk, NULL, NULL, disk_before, NULL, NULL);
+
+/**
+ * @brief Interleaved baro and accel datapoints written to the disk backend
+ *        convert back to CSV with every channel preserved.
+ */
+ZTEST(data_logger_disk, test_disk_to_csv_roundtrip)
+{
+	char buf[1024];
+	const uint64_t t0 = k_ticks_to_ns_floor64(k_uptime_ticks()) +
+			    10000000ULL;
+
+	zassert_ok(data_logger_init(&disk_logger, "disk",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&disk_logger), NULL);
+
+	struct datapoint baro = {
+		.timestamp_ns  = t0,
+		.type          = AURORA_DATA_BARO,
+		.channel_count = 2,
+		.channels = {
+			{.val1 = 25, .val2 = 500000},
+			{.val1 = 101500, .val2 = 0},
+		},
+	};
+	struct datapoint accel = {
+		.timestamp_ns  = t0 + 5000000ULL,
+		.type          = AURORA_DATA_IMU_ACCEL,
+		.channel_count = 3,
+		.channels = {
+			{.val1 = 1, .val2 = 100000},
+			{.val1 = -2, .val2 = -200000},
+			{.val1 = 9, .val2 = 810000},
+		},
+	};
+
+	zassert_ok(data_logger_write(&disk_logger, &baro), NULL);
+	zassert_ok(data_logger_write(&disk_logger, &accel), NULL);
+	zassert_ok(data_logger_close(&disk_logger), NULL);
+
+	zassert_ok(data_logger_convert(&data_logger_csv_formatter, CSV_PATH),
+		   "convert must succeed");
+
+	int n = read_file(CSV_PATH, buf, sizeof(buf));
+
+	zassert_true(n > 0, "CSV output must not be empty");
+	zassert_not_null(strstr(buf, "25.500000"), NULL);
+	zassert_not_null(strstr(buf, "101500.000000"), NULL);
+	zassert_not_null(strstr(buf, "-2.200000"), NULL);
+	zassert_not_null(strstr(buf, "9.810000"), NULL);
+}
+
+struct export_count {
+	uint32_t frames;
+	uint32_t next_seq;
+};
+
+static int count_frame(const void *frame, size_t len, void *user_data)
+{
+	const struct aurora_bin_frame_header *h = frame;
+	struct export_count *c = user_data;
+
+	zassert_equal(len, FRAME_BYTES, NULL);
+	zassert_mem_equal(h->magic, AURORA_BIN_FRAME_MAGIC, 4, NULL);
+	zassert_equal(h->seq, c->next_seq, "Frames must arrive in seq order");
+	c->next_seq++;
+	c->frames++;
+	return 0;
+}
+
+/**
+ * @brief data_logger_export() hands over the flight's frames unconverted
+ *        and stops at the end of the flight.
+ */
+ZTEST(data_logger_disk, test_disk_export_raw_frames)
+{
+	struct export_count c = { 0 };
+	struct datapoint baro = {
+		.timestamp_ns  = 1000000ULL,
+		.type          = AURORA_DATA_BARO,
+		.channel_count = 2,
+		.channels = {
+			{.val1 = 20, .val2 = 0},
+			{.val1 = 101000, .val2 = 0},
+		},
+	};
+
+	zassert_equal(data_logger_export(count_frame, &c), 0,
+		      "A blank region exports no frames");
+
+	zassert_ok(data_logger_init(&disk_logger, "exp",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&disk_logger), NULL);
+	zassert_ok(data_logger_write(&disk_logger, &baro), NULL);
+	zassert_ok(data_logger_close(&disk_logger), NULL);
+
+	zassert_equal(data_logger_export(count_frame, &c), 1, NULL);
+	zassert_equal(c.frames, 1U, NULL);
+}
+
+/**
+ * @brief A power fail gets the partially filled live frame onto the card
+ *        without a flush or close.
+ */
+ZTEST(data_logger_disk, test_disk_powerfail_commits_live_frame)
+{
+	const uint32_t first = IS_ENABLED(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+		? 1U : 0U;
+	const struct aurora_bin_frame_header *h =
+		(const struct aurora_bin_frame_header *)frame_buf;
+	struct datapoint baro = {
+		.timestamp_ns  = 1000000ULL,
+		.type          = AURORA_DATA_BARO,
+		.channel_count = 2,
+		.channels = {
+			{.val1 = 20, .val2 = 0},
+			{.val1 = 101000, .val2 = 0},
+		},
+	};
+
+	zassert_ok(data_logger_init(&disk_logger, "pf",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&disk_logger), NULL);
+	zassert_ok(data_logger_write(&disk_logger, &baro), NULL);
+
+	read_disk_frame(first);
+	zassert_equal(frame_buf[0], 0xFF, "The live frame is still in RAM");
+
+	data_logger_powerfail(true);
+	zassert_equal(atomic_get(&disk_logger.state->running), 0,
+		      "A power fail must stop the logger");
+
+	for (int i = 0; i < 100 && frame_buf[0] == 0xFF; i++) {
+		k_msleep(1);
+		read_disk_frame(first);
+	}
+	zassert_mem_equal(h->magic, AURORA_BIN_FRAME_MAGIC, 4,
+			  "The live frame must reach the card");
+	zassert_equal(h->seq, 0U, NULL);
+
+	data_logger_powerfail(false);
+	zassert_equal(atomic_get(&disk_logger.state->running), 1, NULL);
+	zassert_ok(data_logger_close(&disk_logger), NULL);
+}
+
+#if defined(CONFIG_DATA_LOGGER_BIN_CRC)
+/**
+ * @brief A frame whose CRC trailer no longer matches is skipped by the
+ *        converter, and the frames after it still convert.
+ */
+ZTEST(data_logger_disk, test_disk_crc_skips_corrupt_frame)
+{
+	char buf[1024];
+	const struct aurora_bin_frame_header *h =
+		(const struct aurora_bin_frame_header *)frame_buf;
+	struct datapoint baro = {
+		.timestamp_ns  = 1000000ULL,
+		.type          = AURORA_DATA_BARO,
+		.channel_count = 2,
+		.channels = {
+			{.val1 = 20, .val2 = 0},
+			{.val1 = 101001, .val2 = 0},
+		},
+	};
+
+	zassert_ok(data_logger_init(&disk_logger, "crc",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&disk_logger), NULL);
+	zassert_ok(data_logger_write(&disk_logger, &baro), NULL);
+	zassert_ok(data_logger_flush(&disk_logger), NULL);
+	baro.channels[1].val1 = 101002;
+	zassert_ok(data_logger_write(&disk_logger, &baro), NULL);
+	zassert_ok(data_logger_close(&disk_logger), NULL);
+
+	read_disk_frame(0);
+	zassert_true((h->reserved0 & AURORA_BIN_FLAG_CRC) != 0U,
+		     "Frames must be flagged as carrying a CRC");
+
+	/* Flip one payload bit of the first frame, as a torn write would. */
+	frame_buf[sizeof(*h) + 8] ^= 0x01U;
+	zassert_ok(disk_access_write(DISK_NAME, frame_buf, 0, FRAME_SECTORS),
+		   NULL);
+
+	zassert_ok(data_logger_convert(&data_logger_csv_formatter, CSV_PATH),
+		   NULL);
+	zassert_true(read_file(CSV_PATH, buf, sizeof(buf)) > 0, NULL);
+	zassert_is_null(strstr(buf, "101001.000000"),
+			"The corrupted frame must be dropped");
+	zassert_not_null(strstr(buf, "101002.000000"),
+			 "The frame after it must still convert");
+}
+#endif /* CONFIG_DATA_LOGGER_BIN_CRC */
+
+#if defined(CONFIG_DATA_LOGGER_BIN_STATS)
+/**
+ * @brief The writer statistics count every frame and byte written and
+ *        put each write in exactly one latency bucket.
+ */
+ZTEST(data_logger_disk, test_disk_writer_stats)
+{
+	struct data_logger_bin_stats st;
+	struct datapoint baro = {
+		.timestamp_ns  = 1000000ULL,
+		.type          = AURORA_DATA_BARO,
+		.channel_count = 2,
+		.channels = {
+			{.val1 = 20, .val2 = 0},
+			{.val1 = 101000, .val2 = 0},
+		},
+	};
+
+	zassert_ok(data_logger_init(&disk_logger, "stats",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&disk_logger), NULL);
+	zassert_ok(data_logger_write(&disk_logger, &baro), NULL);
+	zassert_ok(data_logger_close(&disk_logger), NULL);
+
+	zassert_ok(data_logger_bin_stats(&st), NULL);
+	zassert_equal(st.frames, 1U, NULL);
+	zassert_equal(st.bytes, FRAME_BYTES, NULL);
+	zassert_equal(st.ring_size, CONFIG_DATA_LOGGER_BIN_RING_FRAMES - 1, NULL);
+	zassert_true(st.ring_max <= st.ring_size, NULL);
+
+	uint32_t sum = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(st.lat_hist); i++) {
+		sum += st.lat_hist[i];
+	}
+	zassert_equal(sum, st.writes, "Every write lands in one bucket");
+
+	data_logger_bin_stats_reset();
+	zassert_ok(data_logger_bin_stats(&st), NULL);
+	zassert_equal(st.frames, 0U, NULL);
+	zassert_equal(st.ring_size, CONFIG_DATA_LOGGER_BIN_RING_FRAMES - 1,
+		      "Reset must keep the queue size");
+}
+#endif /* CONFIG_DATA_LOGGER_BIN_STATS */
+
+/* ========================================================================== */
+/*  Suite 2: columnar (v4) frame layout                                       */
+/* ========================================================================== */
+
+#if defined(CONFIG_DATA_LOGGER_BIN_COLUMNAR)
+
+ZTEST_SUITE(data_logger_disk_columnar, NULL, NULL, disk_before, NULL, NULL);
+
+static struct datapoint baro_dp(uint64_t ts, int32_t pressure)
+{
+	struct datapoint dp = {
+		.timestamp_ns  = ts,
+		.type          = AURORA_DATA_BARO,
+		.channel_count = 2,
+		.channels = {
+			{.val1 = 20, .val2 = 0},
+			{.val1 = pressure, .val2 = 0},
+		},
+	};
+
+	return dp;
+}
+
+/**
+ * @brief Interleaved types land in separate frames; each frame carries
+ *        its type, channel count and record count in reserved1 and
+ *        stores the values column-wise.
+ */
+ZTEST(data_logger_disk_columnar, test_columnar_split_by_type)
+{
+	const uint64_t t0 = 1000000000ULL;
+
+	zassert_ok(data_logger_init(&disk_logger, "col",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&disk_logger), NULL);
+
+	for (int i = 0; i < 3; i++) {
+		struct datapoint b = baro_dp(t0 + (uint64_t)i * 2000000ULL,
+					     101000 + i);
+		struct datapoint g = {
+			.timestamp_ns  = t0 + (uint64_t)i * 2000000ULL + 1000ULL,
+			.type          = AURORA_DATA_IMU_GYRO,
+			.channel_count = 3,
+			.channels = {
+				{.val1 = i}, {.val1 = -i}, {.val1 = 7},
+			},
+		};
+
+		zassert_ok(data_logger_write(&disk_logger, &b), NULL);
+		zassert_ok(data_logger_write(&disk_logger, &g), NULL);
+	}
+
+	zassert_ok(data_logger_close(&disk_logger), NULL);
+
+	/* Flush commits open staging frames oldest first: baro first. */
+	read_disk_frame(0);
+
+	const struct aurora_bin_frame_header *h =
+		(const struct aurora_bin_frame_header *)frame_buf;
+	size_t cap = AURORA_BIN_COL_CAPACITY(FRAME_BYTES, 2);
+	const uint32_t *ts = (const uint32_t *)
+		(frame_buf + AURORA_BIN_COL_OFFSET(cap, 0));
+	const int32_t *press = (const int32_t *)
+		(frame_buf + AURORA_BIN_COL_OFFSET(cap, 3));
+
+	zassert_mem_equal(h->magic, AURORA_BIN_FRAME_MAGIC, 4, NULL);
+	zassert_equal(h->version, AURORA_BIN_VERSION_COLUMNAR, NULL);
+	zassert_equal(h->seq, 0U, NULL);
+	zassert_equal(AURORA_BIN_COL_TAG_TYPE(h->reserved1),
+		      AURORA_DATA_BARO, NULL);
+	zassert_equal(AURORA_BIN_COL_TAG_CHANNELS(h->reserved1), 2, NULL);
+	zassert_equal(AURORA_BIN_COL_TAG_COUNT(h->reserved1), 3, NULL);
+	zassert_equal(h->base_ts_ns, t0,
+		      "Frame base must be the first sample's timestamp");
+	zassert_equal(ts[0], 0U, NULL);
+	zassert_equal(ts[2], 4000U, NULL);
+	zassert_equal(press[0], 101000, NULL);
+	zassert_equal(press[2], 101002, NULL);
+
+	read_disk_frame(1);
+
+	cap = AURORA_BIN_COL_CAPACITY(FRAME_BYTES, 3);
+	const int32_t *gy = (const int32_t *)
+		(frame_buf + AURORA_BIN_COL_OFFSET(cap, 3));
+
+	zassert_equal(h->seq, 1U, NULL);
+	zassert_equal(AURORA_BIN_COL_TAG_TYPE(h->reserved1),
+		      AURORA_DATA_IMU_GYRO, NULL);
+	zassert_equal(AURORA_BIN_COL_TAG_COUNT(h->reserved1), 3, NULL);
+	zassert_equal(gy[1], -1, NULL);
+	zassert_equal(gy[2], -2, NULL);
+
+	read_disk_frame(2);
+	zassert_equal(frame_buf[0], 0xFF, "Only two frames may be written");
+}
+
+/**
+ * @brief Filling a type's frame to capacity rotates it; the overflow
+ *        record opens the next frame with contiguous seq.
+ */
+ZTEST(data_logger_disk_columnar, test_columnar_rotate_on_full)
+{
+	const size_t cap = AURORA_BIN_COL_CAPACITY(FRAME_BYTES, 2);
+
+	zassert_ok(data_logger_init(&disk_logger, "full",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&disk_logger), NULL);
+
+	for (size_t i = 0; i < cap + 1; i++) {
+		struct datapoint b = baro_dp(1000000ULL * (i + 1),
+					     (int32_t)i);
+
+		zassert_ok(data_logger_write(&disk_logger, &b), NULL);
+	}
+
+	zassert_ok(data_logger_close(&disk_logger), NULL);
+
+	const struct aurora_bin_frame_header *h =
+		(const struct aurora_bin_frame_header *)frame_buf;
+
+	read_disk_frame(0);
+	zassert_equal(h->seq, 0U, NULL);
+	zassert_equal(AURORA_BIN_COL_TAG_COUNT(h->reserved1), cap, NULL);
+
+	read_disk_frame(1);
+	zassert_equal(h->seq, 1U, NULL);
+	zassert_equal(AURORA_BIN_COL_TAG_COUNT(h->reserved1), 1, NULL);
+
+	const int32_t *press = (const int32_t *)
+		(frame_buf + AURORA_BIN_COL_OFFSET(cap, 3));
+
+	zassert_equal(press[0], (int32_t)cap, NULL);
+}
+
+/* Output formatter that only checks the order it is fed in. */
+static struct {
+	uint64_t last_ns;
+	uint32_t count;
+	uint32_t backwards;
+} capture;
+
+static int capture_init(struct data_logger *logger, const char *path)
+{
+	ARG_UNUSED(logger);
+	ARG_UNUSED(path);
+	memset(&capture, 0, sizeof(capture));
+	return 0;
+}
+
+static int capture_nop(struct data_logger *logger)
+{
+	ARG_UNUSED(logger);
+	return 0;
+}
+
+static int capture_write(struct data_logger *logger,
+			 const struct datapoint *dp)
+{
+	ARG_UNUSED(logger);
+	if (capture.count > 0U && dp->timestamp_ns < capture.last_ns) {
+		capture.backwards++;
+	}
+	capture.last_ns = dp->timestamp_ns;
+	capture.count++;
+	return 0;
+}
+
+static const struct data_logger_formatter capture_formatter = {
+	.init            = capture_init,
+	.write_header    = capture_nop,
+	.write_datapoint = capture_write,
+	.flush           = capture_nop,
+	.close           = capture_nop,
+	.name            = "capture",
+};
+
+/**
+ * @brief A gyro frame that fills up while an older baro frame is still
+ *        open goes out behind it, and the converter merges the types
+ *        back into one stream with monotonic timestamps.
+ */
+ZTEST(data_logger_disk_columnar, test_columnar_convert_time_ordered)
+{
+	const size_t cap = AURORA_BIN_COL_CAPACITY(FRAME_BYTES, 3);
+	const uint32_t gyros = 2U * (uint32_t)cap + 5U;
+	const uint64_t t0 = 1000000000ULL;
+	uint32_t written = 0;
+
+	zassert_ok(data_logger_init(&disk_logger, "merge",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&disk_logger), NULL);
+
+	for (uint32_t i = 0; i < gyros; i++) {
+		const uint64_t ts = t0 + (uint64_t)i * 1000000ULL;
+		struct datapoint g = {
+			.timestamp_ns  = ts + 1000ULL,
+			.type          = AURORA_DATA_IMU_GYRO,
+			.channel_count = 3,
+			.channels = {
+				{.val1 = (int32_t)i}, {.val1 = 0}, {.val1 = 0},
+			},
+		};
+
+		if (i % 10U == 0U) {
+			struct datapoint b = baro_dp(ts, (int32_t)i);
+
+			zassert_ok(data_logger_write(&disk_logger, &b), NULL);
+			written++;
+		}
+		zassert_ok(data_logger_write(&disk_logger, &g), NULL);
+		written++;
+	}
+
+	zassert_ok(data_logger_close(&disk_logger), NULL);
+
+	const struct aurora_bin_frame_header *h =
+		(const struct aurora_bin_frame_header *)frame_buf;
+	uint64_t last_base = 0;
+	uint32_t frames = 0;
+
+	for (uint32_t f = 0; f < WIPE_FRAMES; f++) {
+		read_disk_frame(f);
+		if (frame_buf[0] == 0xFF) {
+			break;
+		}
+		zassert_true(h->base_ts_ns >= last_base,
+			     "Frame %u opened before its predecessor", f);
+		last_base = h->base_ts_ns;
+		frames++;
+	}
+	zassert_true(frames > 3U, "Both types must span several frames");
+
+	zassert_ok(data_logger_convert(&capture_formatter, "unused"), NULL);
+	zassert_equal(capture.count, written, "Every record must be converted");
+	zassert_equal(capture.backwards, 0U,
+		      "Output timestamps must not go backwards across types");
+}
+
+#endif /* CONFIG_DATA_LOGGER_BIN_COLUMNAR */
+
+/* ========================================================================== */
+/*  Suite 3: multi-flight session catalogue                                   */
+/* ========================================================================== */
+
+#if defined(CONFIG_DATA_LOGGER_DISK_SESSIONS)
+
+ZTEST_SUITE(data_logger_disk_sessions, NULL, NULL, disk_before, NULL, NULL);
+
+/* Record one flight holding a single baro sample of @p pressure Pa. */
+static void log_flight(const char *name, int32_t pressure)
+{
+	struct datapoint b = {
+		.timestamp_ns  = k_ticks_to_ns_floor64(k_uptime_ticks()),
+		.type          = AURORA_DATA_BARO,
+		.channel_count = 2,
+		.channels = {
+			{.val1 = 20, .val2 = 0},
+			{.val1 = pressure, .val2 = 0},
+		},
+	};
+
+	memset(&disk_logger, 0, sizeof(disk_logger));
+	zassert_ok(data_logger_init(&disk_logger, name,
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&disk_logger), NULL);
+	zassert_ok(data_logger_write(&disk_logger, &b), NULL);
+	zassert_ok(data_logger_close(&disk_logger), NULL);
+}
+
+/**
+ * @brief Two flights land behind each other after the catalogue, and
+ *        each converts on its own and is marked converted.
+ */
+ZTEST(data_logger_disk_sessions, test_sessions_append_and_convert)
+{
+	struct data_logger_session list[4];
+	char buf[1024];
+
+	log_flight("s0", 101001);
+	log_flight("s1", 101002);
+
+	zassert_equal(data_logger_sessions(list, ARRAY_SIZE(list)), 2, NULL);
+	zassert_equal(list[0].number, 0U, NULL);
+	zassert_equal(list[1].number, 1U, NULL);
+	zassert_equal(list[0].offset, (off_t)FRAME_BYTES,
+		      "First flight must start behind the catalogue");
+	zassert_equal(list[1].offset, (off_t)(2 * FRAME_BYTES), NULL);
+	zassert_equal(list[0].frames, 1U, NULL);
+	zassert_equal(list[1].frames, 1U, NULL);
+	zassert_true(list[1].flight_id > list[0].flight_id, NULL);
+	zassert_false(list[0].converted, NULL);
+
+	read_disk_frame(2);
+	zassert_mem_equal(frame_buf, AURORA_BIN_FRAME_MAGIC, 4, NULL);
+
+	for (int i = 0; i < 2; i++) {
+		struct data_logger_convert_out out = {
+			.fmt  = &data_logger_csv_formatter,
+			.path = CSV_PATH,
+		};
+
+		fs_unlink(CSV_PATH);
+		zassert_ok(data_logger_convert_session(&list[i], &out, 1),
+			   NULL);
+		zassert_true(read_file(CSV_PATH, buf, sizeof(buf)) > 0, NULL);
+		zassert_not_null(strstr(buf, i == 0 ? "101001.000000"
+						    : "101002.000000"),
+				 "Flight %d must hold its own sample", i);
+		zassert_is_null(strstr(buf, i == 0 ? "101002.000000"
+						   : "101001.000000"),
+				"Flight %d must not hold the other sample", i);
+	}
+
+	zassert_equal(data_logger_sessions(list, ARRAY_SIZE(list)), 2, NULL);
+	zassert_true(list[0].converted && list[1].converted, NULL);
+
+	/* data_logger_convert() still means the newest flight. */
+	fs_unlink(CSV_PATH);
+	zassert_ok(data_logger_convert(&data_logger_csv_formatter, CSV_PATH),
+		   NULL);
+	zassert_true(read_file(CSV_PATH, buf, sizeof(buf)) > 0, NULL);
+	zassert_not_null(strstr(buf, "101002.000000"), NULL);
+	zassert_is_null(strstr(buf, "101001.000000"), NULL);
+}
+
+/**
+ * @brief A flight whose close never reached the catalogue gets its
+ *        frame count recovered when the next flight opens.
+ */
+ZTEST(data_logger_disk_sessions, test_sessions_recover_open_flight)
+{
+	struct data_logger_session list[4];
+	uint8_t sector[SECTOR_BYTES] __aligned(4);
+
+	log_flight("s0", 101001);
+
+	/* Pretend power was cut before bin_close() updated the entry. */
+	zassert_ok(disk_access_read(DISK_NAME, sector, 0, 1), NULL);
+	struct aurora_bin_session_entry *e = (struct aurora_bin_session_entry *)
+		(sector + sizeof(struct aurora_bin_session_header));
+
+	zassert_equal(e->frames, 1U, NULL);
+	e->frames = AURORA_BIN_SESSION_OPEN;
+	zassert_ok(disk_access_write(DISK_NAME, sector, 0, 1), NULL);
+
+	zassert_equal(data_logger_sessions(list, ARRAY_SIZE(list)), 1, NULL);
+	zassert_equal(list[0].frames, AURORA_BIN_SESSION_OPEN, NULL);
+
+	log_flight("s1", 101002);
+
+	zassert_equal(data_logger_sessions(list, ARRAY_SIZE(list)), 2, NULL);
+	zassert_equal(list[0].frames, 1U,
+		      "Open flight must be recovered from its frames");
+	zassert_equal(list[1].offset, (off_t)(2 * FRAME_BYTES),
+		      "Next flight must start behind the recovered one");
+}
+
+#endif /* CONFIG_DATA_LOGGER_DISK_SESSIONS */
+
+/* ========================================================================== */
+/*  Suite 4: flash mirror                                                     */
+/* ========================================================================== */
+
+#if defined(CONFIG_DATA_LOGGER_BIN_MIRROR)
+
+#define MIRROR_AREA_ID DT_FIXED_PARTITION_ID(DT_CHOSEN(auxspace_flight_log))
+
+ZTEST_SUITE(data_logger_disk_mirror, NULL, NULL, disk_before, NULL, NULL);
+
+/**
+ * @brief Every disk frame is either on flash or counted as thinned out,
+ *        the flash copy is one contiguous seq run of the same flight,
+ *        and the pyro record made it.
+ */
+ZTEST(data_logger_disk_mirror, test_mirror_copies_flight)
+{
+	const struct flash_area *fa;
+	struct data_logger_bin_stats st;
+	struct data_logger_bin_mirror_stats ms;
+	struct datapoint baro = {
+		.type          = AURORA_DATA_BARO,
+		.channel_count = 2,
+		.channels = {
+			{.val1 = 20, .val2 = 0},
+			{.val1 = 101000, .val2 = 0},
+		},
+	};
+	const struct datapoint pyro = {
+		.timestamp_ns  = 50000000ULL,
+		.type          = AURORA_DATA_PYRO_FIRE,
+		.channel_count = 3,
+		.channels = { {.val1 = 1}, {.val1 = 12}, {.val1 = 0} },
+	};
+	bool pyro_seen = false;
+
+	zassert_ok(data_logger_init(&disk_logger, "mirror",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&disk_logger), NULL);
+	for (int i = 0; i < 100; i++) {
+		baro.timestamp_ns = (uint64_t)i * 1000000ULL;
+		zassert_ok(data_logger_write(&disk_logger, &baro), NULL);
+		if (i == 50) {
+			zassert_ok(data_logger_write(&disk_logger, &pyro),
+				   NULL);
+		}
+	}
+	zassert_ok(data_logger_close(&disk_logger), NULL);
+
+	zassert_ok(data_logger_bin_stats(&st), NULL);
+	zassert_ok(data_logger_bin_mirror_stats(&ms), NULL);
+	zassert_true(st.frames > 1U, "Flight must span several frames");
+	zassert_equal(ms.frames + ms.decimated + ms.dropped, st.frames,
+		      "Every committed frame must be accounted for");
+	zassert_true(ms.frames >= 1U, NULL);
+	zassert_false(ms.disk_lost, NULL);
+
+	read_disk_frame(0);
+	const uint64_t flight_id =
+		((const struct aurora_bin_frame_header *)frame_buf)->flight_id;
+
+	zassert_ok(flash_area_open(MIRROR_AREA_ID, &fa), NULL);
+	for (uint32_t i = 0; i < ms.frames; i++) {
+		const struct aurora_bin_frame_header *h =
+			(const struct aurora_bin_frame_header *)frame_buf;
+
+		zassert_ok(flash_area_read(fa, (off_t)(i * FRAME_BYTES),
+					   frame_buf, FRAME_BYTES), NULL);
+		zassert_mem_equal(h->magic, AURORA_BIN_FRAME_MAGIC,
+				  sizeof(h->magic), NULL);
+		zassert_equal(h->seq, i, "Mirror seq must be contiguous");
+		zassert_equal(h->flight_id, flight_id, NULL);
+
+		for (size_t off = sizeof(*h);
+		     off + sizeof(struct aurora_bin_record) <= FRAME_BYTES;
+		     off += sizeof(struct aurora_bin_record)) {
+			const struct aurora_bin_record *rec =
+				(const struct aurora_bin_record *)
+				(frame_buf + off);
+
+			if (rec->type == AURORA_DATA_PYRO_FIRE) {
+				pyro_seen = true;
+			}
+		}
+	}
+	flash_area_close(fa);
+
+	zassert_true(pyro_seen, "Critical frames must reach the mirror");
+}
+
+#endif /* CONFIG_DATA_LOGGER_BIN_MIRROR */
+
+/* ========================================================================== */
+/*  Suite 5: SD card benchmark                                                */
+/* ========================================================================== */
+
+#if defined(CONFIG_DATA_LOGGER_DISK_BENCH)
+
+ZTEST_SUITE(data_logger_disk_bench, NULL, NULL, disk_before, NULL, NULL);
+
+/**
+ * @brief A RAM disk passes, the pattern lands at the end of the region
+ *        and the head of the region is left alone.
+ */
+ZTEST(data_logger_disk_bench, test_bench_tail_of_region)
+{
+	struct data_logger_disk_bench_result r;
+
+	zassert_ok(data_logger_disk_bench(32, 0, &r), NULL);
+	zassert_equal(r.frames, 32U, NULL);
+	zassert_equal(r.batch_frames, CONFIG_DATA_LOGGER_BIN_MAX_BATCH_FRAMES,
+		      NULL);
+	zassert_equal(r.writes, DIV_ROUND_UP(32U, r.batch_frames), NULL);
+	zassert_equal(r.bad_frames, 0U, NULL);
+	zassert_true(r.write_p99_us <= r.write_max_us, NULL);
+	zassert_true(r.pass, "A RAM disk must qualify");
+
+	zassert_true(r.first_sector >= WIPE_FRAMES * FRAME_SECTORS,
+		     "Bench must stay behind the head of the region");
+	for (uint32_t i = 0; i < WIPE_FRAMES; i++) {
+		read_disk_frame(i);
+		for (size_t b = 0; b < FRAME_BYTES; b++) {
+			zassert_equal(frame_buf[b], 0xFF,
+				      "Frame %u must be untouched", i);
+		}
+	}
+
+	read_disk_frame(r.first_sector / FRAME_SECTORS);
+	zassert_not_equal(frame_buf[0], 0xFF, "First tested frame is written");
+}
+
+/**
+ * @brief The benchmark is refused while the bin logger owns the disk,
+ *        and a batch larger than the ring is cut to fit.
+ */
+ZTEST(data_logger_disk_bench, test_bench_busy_and_batch_limit)
+{
+	struct data_logger_disk_bench_result r;
+
+	zassert_ok(data_logger_init(&disk_logger, "bench",
+				    &data_logger_bin_formatter), NULL);
+	zassert_equal(data_logger_disk_bench(8, 0, &r), -EBUSY, NULL);
+	zassert_ok(data_logger_close(&disk_logger), NULL);
+
+	zassert_ok(data_logger_disk_bench(8, 1000, &r), NULL);
+	zassert_equal(r.batch_frames, CONFIG_DATA_LOGGER_BIN_RING_FRAMES - 1,
+		      NULL);
+	zassert_equal(r.writes, 1U, NULL);
+	zassert_equal(data_logger_disk_bench(8, 0, NULL), -EINVAL, NULL);
+}
+
+#endif /* CONFIG_DATA_LOGGER_DISK_BENCH */
+
+/* ========================================================================== */
+/*  Suite 6: conversion trailing the live logger                              */
+/* ========================================================================== */
+
+#if defined(CONFIG_DATA_LOGGER_CONVERT_TRAIL)
+
+ZTEST_SUITE(data_logger_disk_trail, NULL, NULL, disk_before, NULL, NULL);
+
+static void write_baro(int32_t pressure)
+{
+	struct datapoint b = {
+		.timestamp_ns  = k_ticks_to_ns_floor64(k_uptime_ticks()),
+		.type          = AURORA_DATA_BARO,
+		.channel_count = 2,
+		.channels = {
+			{.val1 = 20, .val2 = 0},
+			{.val1 = pressure, .val2 = 0},
+		},
+	};
+
+	zassert_ok(data_logger_write(&disk_logger, &b), NULL);
+}
+
+/**
+ * @brief Frames on the card are converted and flushed while the logger
+ *        is still open; the rest follows once it is closed.
+ */
+ZTEST(data_logger_disk_trail, test_trail_converts_behind_writer)
+{
+	struct data_logger_session live;
+	struct data_logger_convert_out out = {
+		.fmt  = &data_logger_csv_formatter,
+		.path = CSV_PATH,
+	};
+	char buf[1024];
+
+	zassert_equal(data_logger_live_session(&live), -ENODEV,
+		      "No flight is being logged yet");
+
+	zassert_ok(data_logger_init(&disk_logger, "trail",
+				    &data_logger_bin_formatter), NULL);
+	zassert_ok(data_logger_start(&disk_logger), NULL);
+	zassert_ok(data_logger_live_session(&live), NULL);
+	zassert_equal(live.frames, AURORA_BIN_SESSION_OPEN, NULL);
+
+	zassert_ok(data_logger_convert_trail_begin(&live, &out, 1), NULL);
+	zassert_equal(data_logger_convert_trail_step(), 0,
+		      "Nothing is on the card yet");
+	zassert_equal(data_logger_convert(&data_logger_csv_formatter,
+					  CSV_PATH), -EBUSY,
+		      "A full conversion must not take over the trail's outputs");
+
+	write_baro(101001);
+	zassert_ok(data_logger_flush(&disk_logger), NULL);
+	zassert_equal(data_logger_convert_trail_step(), 1, NULL);
+	zassert_true(read_file(CSV_PATH, buf, sizeof(buf)) > 0, NULL);
+	zassert_not_null(strstr(buf, "101001.000000"),
+			 "A step must flush the frames it converted");
+
+	write_baro(101002);
+	zassert_ok(data_logger_flush(&disk_logger), NULL);
+	zassert_equal(data_logger_convert_trail_end(), -EBUSY,
+		      "The trail cannot end while the flight is logged");
+
+	write_baro(101003);
+	zassert_ok(data_logger_close(&disk_logger), NULL);
+	zassert_equal(data_logger_convert_trail_end(), 3, NULL);
+	zassert_equal(out.rc, 0, NULL);
+
+	zassert_true(read_file(CSV_PATH, buf, sizeof(buf)) > 0, NULL);
+	zassert_not_null(strstr(buf, "101001.000000"), NULL);
+	zassert_not_null(strstr(buf, "101002.000000"), NULL);
+	zassert_not_null(strstr(buf, "101003.000000"), NULL);
+	zassert_equal(data_logger_convert_trail_step(), -EINVAL, NULL);
+}
+
+#endif /* CONFIG_DATA_LOGGER_CONVERT_TRAIL */
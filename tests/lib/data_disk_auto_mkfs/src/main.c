@@ -70,6 +70,18 @@ extern int flight_log_disk_auto_format(void);
 #define FS_NODE  DT_CHOSEN(auxspace_ffs)
 FS_FSTAB_DECLARE_ENTRY(FS_NODE);
 
+/* With CONFIG_DATA_LOGGER_DISK_AUTO_MKFS_ASYNC the boot-time rebuild
+ * runs on its own thread; every suite starts once it has finished.
+ */
+#define FAT_SETTLE_TIMEOUT K_SECONDS(30)
+
+static void *wait_fat_settled(void)
+{
+	zassert_ok(flight_log_fat_wait(FAT_SETTLE_TIMEOUT),
+		   "boot-time FAT rebuild did not finish");
+	return NULL;
+}
+
 /* One-sector scratch buffer for raw disk_access_read/write probes. */
 static uint8_t scratch[512];
 
@@ -89,7 +101,8 @@ static uint32_t sector_size_bytes(void)
 /*  Suite 1: format-on-mismatch (blank disk → mounted FAT)                    */
 /* ========================================================================== */
 
-ZTEST_SUITE(disk_auto_mkfs_blank, NULL, NULL, NULL, NULL, NULL);
+ZTEST_SUITE(disk_auto_mkfs_blank, NULL, wait_fat_settled, NULL, NULL,
+	    NULL);
 
 /**
  * @brief A blank RAM disk is reformatted at SYS_INIT and the FAT volume
@@ -148,11 +161,27 @@ ZTEST(disk_auto_mkfs_blank, test_blank_disk_filesystem_writable)
 			  "freshly formatted FAT volume");
 }
 
+/**
+ * @brief The settle latch stays released after boot.
+ *
+ * Later callers (converter, audit writer) poll it with K_NO_WAIT; once
+ * the boot-time rebuild is done they must never see -EAGAIN again, and
+ * the raw region must be online independently of the FAT.
+ */
+ZTEST(disk_auto_mkfs_blank, test_fat_wait_latched)
+{
+	zassert_ok(flight_log_fat_wait(K_NO_WAIT), NULL);
+	zassert_ok(flight_log_fat_wait(K_NO_WAIT),
+		   "a waiter must not consume the settle latch");
+	zassert_true(flight_log_online(), NULL);
+}
+
 /* ========================================================================== */
 /*  Suite 2: preservation (magic at offset → no reformat across "reboot")     */
 /* ========================================================================== */
 
-ZTEST_SUITE(disk_auto_mkfs_preserve, NULL, NULL, NULL, NULL, NULL);
+ZTEST_SUITE(disk_auto_mkfs_preserve, NULL, wait_fat_settled, NULL, NULL,
+	    NULL);
 
 /**
  * @brief A re-invocation of the auto-format entry point with the AURORA
@@ -200,7 +229,8 @@ ZTEST(disk_auto_mkfs_preserve, test_magic_survives_reentry)
 /*  Suite 3: corrupt FAT + flight data (rebuild FAT, preserve raw region)     */
 /* ========================================================================== */
 
-ZTEST_SUITE(disk_auto_mkfs_corrupt, NULL, NULL, NULL, NULL, NULL);
+ZTEST_SUITE(disk_auto_mkfs_corrupt, NULL, wait_fat_settled, NULL, NULL,
+	    NULL);
 
 /**
  * @brief A corrupt/unmountable FAT that still carries a valid flight log
@@ -15,8 +15,8 @@
 #define FLOAT_TOL 0.001
 
 /** @brief Helper: assert two doubles are approximately equal. */
-#define zassert_near(a, b, tol, msg) \
-	zassert_true(fabs((a) - (b)) < (tol), msg)
+#define zassert_near(a, b, tol, ...) \
+	zassert_true(fabs((a) - (b)) < (tol), __VA_ARGS__)
 
 /**
  * @brief Expected noise values from Kconfig defaults.
@@ -28,6 +28,9 @@
 #define EXPECTED_Q_ALT (100.0 / 1000.0)
 #define EXPECTED_Q_VEL (500.0 / 1000.0)
 #define EXPECTED_R     (4000.0 / 1000.0)
+#if defined(CONFIG_FILTER_KALMAN3)
+#define EXPECTED_Q_BIAS (10.0 / 1000.0)
+#endif /* CONFIG_FILTER_KALMAN3 */
 
 /** @brief Nanoseconds per millisecond for dt conversion. */
 #define NS_PER_MS 1000000LL
@@ -136,6 +139,16 @@ ZTEST(kalman_filter_tests, test_init_values)
 	zassert_near(f.noise_p[1][1], EXPECTED_Q_VEL, FLOAT_TOL,
 		     "Q_vel should match Kconfig");
 
+#if defined(CONFIG_FILTER_KALMAN3)
+	/* Bias starts at zero, uncorrelated */
+	zassert_near(f.state[2], 0.0, FLOAT_TOL, "Initial bias should be 0");
+	zassert_near(f.covariance[2][2], 0.1, FLOAT_TOL, "P[2][2] should be 0.1");
+	zassert_near(f.covariance[0][2], 0.0, FLOAT_TOL, "P[0][2] should be 0");
+	zassert_near(f.covariance[1][2], 0.0, FLOAT_TOL, "P[1][2] should be 0");
+	zassert_near(f.noise_p[2][2], EXPECTED_Q_BIAS, FLOAT_TOL,
+		     "Q_bias should match Kconfig");
+#endif /* CONFIG_FILTER_KALMAN3 */
+
 	/* Measurement noise from Kconfig */
 	zassert_near(f.noise_m, EXPECTED_R, FLOAT_TOL,
 		     "R should match Kconfig");
@@ -381,6 +394,119 @@ ZTEST(kalman_filter_tests, test_update_gate_rejects_glitch)
 		     "Rejected update must not shrink covariance");
 }
 
+/* ----------------------------------------------------------------
+ * filter_predict_batch / filter_step tests
+ * ---------------------------------------------------------------- */
+
+/**
+ * @brief Test batch predict rejects bad arguments without touching state.
+ */
+ZTEST(kalman_filter_tests, test_predict_batch_invalid)
+{
+	const struct filter_sample ok = { .dt = 10 * NS_PER_MS, .a_vert = 1.0 };
+	const struct filter_sample bad[] = {
+		{ .dt = 10 * NS_PER_MS, .a_vert = 1.0 },
+		{ .dt = 0, .a_vert = 1.0 },
+	};
+	const struct filter_sample too_long[] = {
+		{ .dt = 600 * NS_PER_MS, .a_vert = 1.0 },
+		{ .dt = 600 * NS_PER_MS, .a_vert = 1.0 },
+	};
+
+	filt.state[1] = 3.0;
+	zassert_equal(filter_predict_batch(NULL, &ok, 1), -EINVAL, "NULL filter");
+	zassert_equal(filter_predict_batch(&filt, NULL, 1), -EINVAL, "NULL samples");
+	zassert_equal(filter_predict_batch(&filt, &ok, 0), -EINVAL, "empty batch");
+	zassert_equal(filter_predict_batch(&filt, bad, ARRAY_SIZE(bad)), -EINVAL,
+		      "zero dt inside the batch");
+	zassert_equal(filter_predict_batch(&filt, too_long, ARRAY_SIZE(too_long)),
+		      -EINVAL, "batch longer than 1 s");
+	zassert_near(filt.state[0], 0.0, FLOAT_TOL, "rejected batch must not move state");
+	zassert_near(filt.covariance[0][0], 10.0, FLOAT_TOL,
+		     "rejected batch must not grow covariance");
+}
+
+/**
+ * @brief Test batch predict matches per-sample filter_predict().
+ */
+ZTEST(kalman_filter_tests, test_predict_batch_matches_sequential)
+{
+	struct filter_sample batch[40];
+	struct filter seq;
+
+	filter_init(&seq);
+	filt.state[1] = seq.state[1] = 20.0;
+	filt.covariance[0][1] = filt.covariance[1][0] = 0.5;
+	seq.covariance[0][1] = seq.covariance[1][0] = 0.5;
+
+	for (size_t i = 0; i < ARRAY_SIZE(batch); i++) {
+		batch[i].dt = (1 + i % 3) * NS_PER_MS;
+		batch[i].a_vert = 30.0 * sin((double)i * 0.4);
+		zassert_equal(filter_predict(&seq, batch[i].dt, batch[i].a_vert), 0,
+			      "sequential predict ok");
+	}
+	zassert_equal(filter_predict_batch(&filt, batch, ARRAY_SIZE(batch)), 0,
+		      "batch predict ok");
+
+	zassert_near(filt.state[0], seq.state[0], FLOAT_TOL, "altitude matches");
+	zassert_near(filt.state[1], seq.state[1], FLOAT_TOL, "velocity matches");
+	for (int r = 0; r < FILTER_NUM_STATES; r++) {
+		for (int c = 0; c < FILTER_NUM_STATES; c++) {
+			zassert_near(filt.covariance[r][c], seq.covariance[r][c],
+				     FLOAT_TOL, "P[%d][%d] matches", r, c);
+		}
+	}
+	zassert_near(filt.last_accel_vert, batch[ARRAY_SIZE(batch) - 1].a_vert,
+		     FLOAT_TOL, "last accel is the newest sample");
+}
+
+/**
+ * @brief Test filter_step predicts over the batch and applies the baro.
+ */
+ZTEST(kalman_filter_tests, test_step_predicts_then_updates)
+{
+	const struct filter_sample batch[] = {
+		{ .dt = 50 * NS_PER_MS, .a_vert = 0.0 },
+		{ .dt = 50 * NS_PER_MS, .a_vert = 0.0 },
+	};
+	struct filter ref;
+
+	filter_init(&ref);
+	filter_predict(&ref, 100 * NS_PER_MS, 0.0);
+	filter_update(&ref, 5.0);
+
+	zassert_equal(filter_step(&filt, batch, ARRAY_SIZE(batch), 5.0), 0,
+		      "filter_step should apply the update");
+	zassert_near(filt.state[0], ref.state[0], FLOAT_TOL, "altitude matches");
+	zassert_near(filt.covariance[0][0], ref.covariance[0][0], FLOAT_TOL,
+		     "P[0][0] matches");
+	zassert_equal(filter_step(&filt, batch, 0, 5.0), -EINVAL,
+		      "empty batch is rejected before the update");
+}
+
+/**
+ * @brief Test velocity variance is exposed and grows with prediction.
+ */
+ZTEST(kalman_filter_tests, test_velocity_variance)
+{
+	zassert_true(filter_velocity_variance(NULL) < 0.0, "NULL filter");
+	zassert_near(filter_velocity_variance(&filt), 10.0, FLOAT_TOL,
+		     "initial velocity variance");
+
+	/* The 3-state backend also carries the bias variance into
+	 * velocity: F P F^T adds dt^2 * P[2][2].
+	 */
+	double expected = 10.0 + EXPECTED_Q_VEL * 0.1;
+
+	if (IS_ENABLED(CONFIG_FILTER_KALMAN3)) {
+		expected += 0.1 * 0.1 * 0.1;
+	}
+
+	filter_predict(&filt, 100 * NS_PER_MS, 0.0);
+	zassert_near(filter_velocity_variance(&filt), expected,
+		     FLOAT_TOL, "variance grows by q_vel * dt");
+}
+
 /* ----------------------------------------------------------------
  * filter_detect_apogee tests
  * ---------------------------------------------------------------- */
@@ -836,3 +962,148 @@ ZTEST(hypsometric_pipeline_tests, test_steady_state_tracking)
 	zassert_near(filt.state[1], 0.0, 1.0,
 		     "Filter velocity should be near zero at steady state");
 }
+
+/* ================================================================
+ * Suite 3: Divergence from a double-precision reference
+ * ================================================================ */
+
+/**
+ * @brief Double-precision reference of the filter's predict/update cycle.
+ *
+ * Kept independent of the library so a CONFIG_FILTER_FLOAT build can be
+ * checked against it; in the double build both match to rounding.
+ */
+struct ref_filter {
+	double x[2];
+	double P[2][2];
+	int updates;
+};
+
+static void ref_init(struct ref_filter *r)
+{
+	*r = (struct ref_filter){ .P = { { 10.0, 0.0 }, { 0.0, 10.0 } } };
+}
+
+static void ref_predict(struct ref_filter *r, double dt, double a)
+{
+	const double P00 = r->P[0][0], P01 = r->P[0][1];
+	const double P10 = r->P[1][0], P11 = r->P[1][1];
+
+	r->x[0] += r->x[1] * dt + 0.5 * a * dt * dt;
+	r->x[1] += a * dt;
+	r->P[0][0] = P00 + dt * (P10 + P01) + dt * dt * P11 + EXPECTED_Q_ALT * dt;
+	r->P[0][1] = P01 + dt * P11;
+	r->P[1][0] = P10 + dt * P11;
+	r->P[1][1] = P11 + EXPECTED_Q_VEL * dt;
+}
+
+static int ref_update(struct ref_filter *r, double z)
+{
+	const double y = z - r->x[0];
+	const double S = r->P[0][0] + EXPECTED_R;
+
+	r->updates++;
+	if (r->updates > 30 && r->P[0][0] <= EXPECTED_R && y * y > 25.0 * S) {
+		return 1;
+	}
+
+	const double K0 = r->P[0][0] / S;
+	const double K1 = r->P[1][0] / S;
+	const double P00 = r->P[0][0], P01 = r->P[0][1];
+	const double P10 = r->P[1][0], P11 = r->P[1][1];
+
+	r->x[0] += K0 * y;
+	r->x[1] += K1 * y;
+	r->P[0][0] = P00 - K0 * P00;
+	r->P[0][1] = P01 - K0 * P01;
+	r->P[1][0] = P10 - K1 * P00;
+	r->P[1][1] = P11 - K1 * P01;
+	return 0;
+}
+
+ZTEST_SUITE(kalman_reference_tests, NULL, NULL, kalman_filter_before,
+	    NULL, NULL);
+
+/**
+ * @brief Bounded divergence from the double reference over a flight.
+ *
+ * 60 s at 50 Hz: 3 s boost at 80 m/s^2, ballistic coast and a
+ * drag-limited descent, with deterministic baro noise.  The library and
+ * the reference must make the same gate decisions and stay within a few
+ * centimetres, which bounds the single-precision error in the float
+ * build.
+ */
+ZTEST(kalman_reference_tests, test_flight_tracks_double_reference)
+{
+	/* The reference is the 2-state model. */
+	Z_TEST_SKIP_IFDEF(CONFIG_FILTER_KALMAN3);
+
+	const int64_t dt_ns = 20 * NS_PER_MS;
+	const double dt = 0.02;
+	struct ref_filter ref;
+	double alt = 0.0, vel = 0.0;
+	double max_alt = 0.0, max_vel = 0.0;
+
+	ref_init(&ref);
+
+	for (int i = 0; i < 3000; i++) {
+		const double t = dt * (double)i;
+		double a = 0.0;
+
+		if (t >= 1.0 && t < 4.0) {
+			a = 80.0;
+		} else if (t >= 4.0) {
+			a = -9.81 + (vel < 0.0 ? MIN(9.81, 0.002 * vel * vel) : 0.0);
+		}
+		vel += a * dt;
+		alt += vel * dt;
+
+		const double z = alt + 0.5 * sin((double)i * 1.7);
+
+		zassert_equal(filter_predict(&filt, dt_ns, a), 0, "predict ok");
+		ref_predict(&ref, dt, a);
+		zassert_equal(filter_update(&filt, z), ref_update(&ref, z),
+			      "gate decision differs at step %d", i);
+
+		max_alt = MAX(max_alt, fabs(filt.state[0] - ref.x[0]));
+		max_vel = MAX(max_vel, fabs(filt.state[1] - ref.x[1]));
+	}
+
+	zassert_true(max_alt < 0.05, "altitude diverged by %f m", max_alt);
+	zassert_true(max_vel < 0.05, "velocity diverged by %f m/s", max_vel);
+}
+
+/* ================================================================
+ * Suite 4: Accelerometer bias estimation (3-state backend)
+ * ================================================================ */
+
+ZTEST_SUITE(kalman3_bias_tests, NULL, NULL, kalman_filter_before,
+	    NULL, NULL);
+
+/**
+ * @brief A constant accel offset is learned and not integrated.
+ *
+ * The vehicle sits still while the accelerometer reads 0.5 m/s^2 and
+ * the baro reports ground level with deterministic noise.  After 30 s
+ * at 50 Hz the bias state must have absorbed the offset and velocity
+ * must stay near zero instead of drifting.
+ */
+ZTEST(kalman3_bias_tests, test_bias_converges_on_pad)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_FILTER_KALMAN3);
+
+#if defined(CONFIG_FILTER_KALMAN3)
+	for (int i = 0; i < 1500; i++) {
+		zassert_equal(filter_predict(&filt, 20 * NS_PER_MS, 0.5), 0,
+			      "predict ok");
+		filter_update(&filt, 0.5 * sin((double)i * 1.7));
+	}
+
+	zassert_near(filt.state[2], 0.5, 0.1, "bias estimate %f",
+		     (double)filt.state[2]);
+	zassert_near(filt.state[1], 0.0, 0.2, "velocity drifted to %f",
+		     (double)filt.state[1]);
+	zassert_near(filt.last_accel_vert, 0.5, FLOAT_TOL,
+		     "apogee vote sees the raw accel");
+#endif /* CONFIG_FILTER_KALMAN3 */
+}
@@ -0,0 +1,176 @@
+/**
+ * @file main.c
+ * @brief Unit tests for the thread health monitor.
+ *
+ * A busy thread and a thread that touches a known amount of stack are
+ * sampled; the tests check that the busy thread dominates the load,
+ * that the high-water mark covers the touched stack, and that the
+ * shell prints the sample.
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/shell/shell_dummy.h>
+#include <zephyr/ztest.h>
+
+#include <aurora/lib/health.h>
+
+#define DEEP_TOUCH 1024
+
+static struct health_thread threads[CONFIG_AURORA_HEALTH_MAX_THREADS];
+static atomic_t busy_run;
+
+static void busy_task(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (1) {
+		if (atomic_get(&busy_run)) {
+			k_busy_wait(1000);
+		} else {
+			k_msleep(1);
+		}
+	}
+}
+
+K_SEM_DEFINE(deep_sem, 0, 1);
+
+static void deep_task(void *p1, void *p2, void *p3)
+{
+	volatile uint8_t scratch[DEEP_TOUCH];
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (size_t i = 0; i < sizeof(scratch); i++) {
+		scratch[i] = (uint8_t)i;
+	}
+	(void)k_sem_take(&deep_sem, K_FOREVER);
+}
+
+K_THREAD_DEFINE(busy, 1024, busy_task, NULL, NULL, NULL, 10, 0, 0);
+K_THREAD_DEFINE(deep, 2048, deep_task, NULL, NULL, NULL, 10, 0, 0);
+
+static const struct health_thread *find(size_t n, const char *name)
+{
+	for (size_t i = 0; i < n; i++) {
+		if (strcmp(threads[i].name, name) == 0) {
+			return &threads[i];
+		}
+	}
+	return NULL;
+}
+
+static void *health_setup(void)
+{
+	/* Let both threads come up before the first sample. */
+	k_msleep(10);
+	return NULL;
+}
+
+static void health_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	atomic_clear(&busy_run);
+}
+
+ZTEST(health, test_sample_lists_every_thread)
+{
+	const char *self = k_thread_name_get(k_current_get());
+	int64_t uptime_ms = 0;
+	size_t n;
+
+	zassert_ok(health_sample(), NULL);
+	n = health_get(threads, ARRAY_SIZE(threads), &uptime_ms);
+
+	zassert_true(n > 0, "sample lists threads");
+	zassert_true(uptime_ms > 0, "sample is stamped");
+	zassert_equal(health_skipped(), 0, "all threads tracked");
+	zassert_not_null(find(n, "busy"), "busy thread listed");
+	zassert_not_null(find(n, "deep"), "deep thread listed");
+	if (self != NULL && self[0] != '\0') {
+		zassert_not_null(find(n, self), "%s listed", self);
+	}
+	for (size_t i = 0; i < n; i++) {
+		zassert_true(threads[i].stack_used <= threads[i].stack_size,
+			     "%s: used %u of %u", threads[i].name,
+			     (unsigned int)threads[i].stack_used,
+			     (unsigned int)threads[i].stack_size);
+	}
+}
+
+ZTEST(health, test_busy_thread_dominates_load)
+{
+	const struct health_thread *t;
+	uint64_t sum = 0;
+	size_t n;
+
+	zassert_ok(health_sample(), NULL);
+	atomic_set(&busy_run, 1);
+	k_msleep(200);
+	atomic_clear(&busy_run);
+	zassert_ok(health_sample(), NULL);
+
+	n = health_get(threads, ARRAY_SIZE(threads), NULL);
+	t = find(n, "busy");
+	zassert_not_null(t, NULL);
+	zassert_true(t->load_ppm > 500000U, "busy load %u ppm",
+		     (unsigned int)t->load_ppm);
+
+	for (size_t i = 0; i < n; i++) {
+		sum += threads[i].load_ppm;
+	}
+	zassert_true(sum <= 1010000U, "loads add up to %llu ppm",
+		     (unsigned long long)sum);
+}
+
+ZTEST(health, test_stack_high_water_mark)
+{
+	const struct health_thread *t;
+	size_t n;
+
+	zassert_ok(health_sample(), NULL);
+	n = health_get(threads, ARRAY_SIZE(threads), NULL);
+	t = find(n, "deep");
+
+	zassert_not_null(t, NULL);
+	zassert_true(t->stack_size >= 2048, "stack size %u",
+		     (unsigned int)t->stack_size);
+	zassert_true(t->stack_used >= DEEP_TOUCH, "high-water mark %u",
+		     (unsigned int)t->stack_used);
+}
+
+ZTEST(health, test_get_truncates)
+{
+	int64_t uptime_ms;
+
+	zassert_ok(health_sample(), NULL);
+	zassert_equal(health_get(threads, 1, &uptime_ms), 1, NULL);
+	zassert_equal(health_get(threads, 0, NULL), 0, NULL);
+}
+
+ZTEST(health, test_shell_prints_sample)
+{
+	const struct shell *sh = shell_backend_dummy_get_ptr();
+	const char *out;
+	size_t len;
+
+	shell_backend_dummy_clear_output(sh);
+	zassert_ok(shell_execute_cmd(sh, "health sample"), NULL);
+	out = shell_backend_dummy_get_output(sh, &len);
+
+	zassert_not_null(strstr(out, "busy"), "%s", out);
+	zassert_not_null(strstr(out, "deep"), "%s", out);
+	zassert_not_null(strstr(out, "Thread"), "%s", out);
+}
+
+ZTEST_SUITE(health, NULL, health_setup, health_before, NULL, NULL);
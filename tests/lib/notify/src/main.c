@@ -0,0 +1,235 @@
+/**
+ * @file main.c
+ * @brief Unit tests for the notification dispatcher.
+ *
+ * A recording backend stands in for the LED and buzzer. With
+ * CONFIG_AURORA_NOTIFY_ASYNC it can be held inside a callback to check
+ * that callers do not wait for it and that pending events coalesce.
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <aurora/lib/notify.h>
+
+#define MAX_RECORDS 16
+
+enum rec_type {
+	REC_BOOT,
+	REC_STATE,
+	REC_CAL,
+	REC_ERROR,
+	REC_POWERFAIL,
+};
+
+struct rec {
+	enum rec_type type;
+	int a;
+	int b;
+};
+
+static struct rec recs[MAX_RECORDS];
+static atomic_t rec_count;
+static k_tid_t rec_thread[MAX_RECORDS];
+
+/* Taken by the first callback after hold_next is set. */
+static K_SEM_DEFINE(gate, 0, 1);
+static K_SEM_DEFINE(entered, 0, 1);
+static atomic_t hold_next;
+
+static void record(enum rec_type type, int a, int b)
+{
+	atomic_val_t i = atomic_inc(&rec_count);
+
+	if (i < MAX_RECORDS) {
+		recs[i] = (struct rec){ .type = type, .a = a, .b = b };
+		rec_thread[i] = k_current_get();
+	}
+
+	if (atomic_cas(&hold_next, 1, 0)) {
+		k_sem_give(&entered);
+		(void)k_sem_take(&gate, K_FOREVER);
+	}
+}
+
+static int rec_on_boot(void)
+{
+	record(REC_BOOT, 0, 0);
+	return 0;
+}
+
+static int rec_on_state_change(enum sm_state prev, enum sm_state next)
+{
+	record(REC_STATE, prev, next);
+	return 0;
+}
+
+static int rec_on_calibration_complete(void)
+{
+	record(REC_CAL, 0, 0);
+	return 0;
+}
+
+static int rec_on_error(void)
+{
+	record(REC_ERROR, 0, 0);
+	return 0;
+}
+
+static void rec_on_powerfail(int recover)
+{
+	record(REC_POWERFAIL, recover, 0);
+}
+
+static const struct notify_backend_api rec_api = {
+	.on_boot = rec_on_boot,
+	.on_state_change = rec_on_state_change,
+	.on_calibration_complete = rec_on_calibration_complete,
+	.on_error = rec_on_error,
+	.on_powerfail = rec_on_powerfail,
+};
+
+NOTIFY_BACKEND_DEFINE(test_recorder, &rec_api);
+
+/* Wait until the backend has seen @p n events (immediate in sync mode). */
+static void wait_records(int n)
+{
+	for (int i = 0; i < 100 && atomic_get(&rec_count) < n; i++) {
+		k_msleep(10);
+	}
+	/* Give a wrongly queued extra event the chance to show up. */
+	k_msleep(20);
+}
+
+static void expect(int i, enum rec_type type, int a, int b)
+{
+	zassert_equal(recs[i].type, type, "record %d: type %d", i, recs[i].type);
+	zassert_equal(recs[i].a, a, "record %d: a %d", i, recs[i].a);
+	zassert_equal(recs[i].b, b, "record %d: b %d", i, recs[i].b);
+}
+
+static void notify_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	atomic_clear(&rec_count);
+	atomic_clear(&hold_next);
+	k_sem_reset(&gate);
+	k_sem_reset(&entered);
+}
+
+ZTEST(notify, test_events_in_order)
+{
+	zassert_ok(notify_boot());
+	zassert_ok(notify_calibration_complete());
+	zassert_ok(notify_state_change(SM_IDLE, SM_ARMED));
+	zassert_ok(notify_error());
+	notify_powerfail(0);
+	notify_powerfail(1);
+
+	wait_records(6);
+	zassert_equal(atomic_get(&rec_count), 6);
+	expect(0, REC_BOOT, 0, 0);
+	expect(1, REC_CAL, 0, 0);
+	expect(2, REC_STATE, SM_IDLE, SM_ARMED);
+	expect(3, REC_ERROR, 0, 0);
+	expect(4, REC_POWERFAIL, 0, 0);
+	expect(5, REC_POWERFAIL, 1, 0);
+}
+
+ZTEST(notify, test_dispatch_thread)
+{
+	zassert_ok(notify_state_change(SM_IDLE, SM_ARMED));
+	wait_records(1);
+	zassert_equal(atomic_get(&rec_count), 1);
+
+#if defined(CONFIG_AURORA_NOTIFY_ASYNC)
+	zassert_equal(rec_thread[0], &notify_work_q()->thread,
+		      "backend did not run on the notify work queue");
+#else
+	zassert_equal(rec_thread[0], k_current_get(),
+		      "backend did not run in the caller");
+#endif /* CONFIG_AURORA_NOTIFY_ASYNC */
+}
+
+ZTEST(notify, test_caller_not_blocked)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_AURORA_NOTIFY_ASYNC);
+
+	atomic_set(&hold_next, 1);
+	zassert_ok(notify_state_change(SM_IDLE, SM_ARMED));
+	zassert_ok(k_sem_take(&entered, K_MSEC(500)));
+
+	/* The backend is stuck in its callback; posting must not wait. */
+	const int64_t start = k_uptime_get();
+
+	zassert_ok(notify_state_change(SM_ARMED, SM_BOOST));
+	zassert_ok(notify_error());
+	zassert_true(k_uptime_get() - start < 5, "notify call blocked");
+	zassert_equal(atomic_get(&rec_count), 1);
+
+	k_sem_give(&gate);
+	wait_records(3);
+	zassert_equal(atomic_get(&rec_count), 3);
+	expect(1, REC_STATE, SM_ARMED, SM_BOOST);
+	expect(2, REC_ERROR, 0, 0);
+}
+
+ZTEST(notify, test_repeats_coalesce)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_AURORA_NOTIFY_ASYNC);
+
+	atomic_set(&hold_next, 1);
+	zassert_ok(notify_boot());
+	zassert_ok(k_sem_take(&entered, K_MSEC(500)));
+
+	for (int i = 0; i < 3; i++) {
+		zassert_ok(notify_error());
+	}
+	for (int i = 0; i < 2; i++) {
+		zassert_ok(notify_state_change(SM_ERROR, SM_IDLE));
+	}
+	/* Queued after a transition: must not fold into the first error. */
+	zassert_ok(notify_error());
+
+	k_sem_give(&gate);
+	wait_records(4);
+	zassert_equal(atomic_get(&rec_count), 4);
+	expect(0, REC_BOOT, 0, 0);
+	expect(1, REC_ERROR, 0, 0);
+	expect(2, REC_STATE, SM_ERROR, SM_IDLE);
+	expect(3, REC_ERROR, 0, 0);
+}
+
+ZTEST(notify, test_full_queue_keeps_latest_state)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_AURORA_NOTIFY_ASYNC);
+
+	const int slots = CONFIG_AURORA_NOTIFY_ASYNC_QUEUE_SIZE;
+	enum sm_state s = SM_IDLE;
+
+	zassert_true(slots + 1 < MAX_RECORDS);
+
+	atomic_set(&hold_next, 1);
+	zassert_ok(notify_boot());
+	zassert_ok(k_sem_take(&entered, K_MSEC(500)));
+
+	/* Alternate so that no two consecutive transitions are identical. */
+	for (int i = 0; i < slots + 3; i++) {
+		enum sm_state next = (s == SM_IDLE) ? SM_ARMED : SM_IDLE;
+
+		zassert_ok(notify_state_change(s, next));
+		s = next;
+	}
+
+	k_sem_give(&gate);
+	wait_records(slots + 1);
+	zassert_equal(atomic_get(&rec_count), slots + 1);
+	zassert_equal(recs[slots].type, REC_STATE);
+	zassert_equal(recs[slots].b, s, "latest state not shown last");
+}
+
+ZTEST_SUITE(notify, NULL, NULL, notify_before, NULL, NULL);
@@ -3,13 +3,16 @@
  * @brief Unit tests for the pad_link wire format and snapshot pipeline.
  *
  * Two suites:
- *   - format:  locks the byte layout of pl_raw_payload and
- *              pl_computed_payload so the Python central's hard-coded
+ *   - format:  locks the byte layout of pl_raw_payload,
+ *              pl_computed_payload, the bundle header and the thread
+ *              health payload so the Python central's hard-coded
  *              struct.unpack strings keep decoding correctly.
  *   - snap:    publishes synthetic IMU/baro samples on zbus and calls
  *              pad_link_publish_sm(), then peeks the internal snapshot
  *              through pad_link_test_get_snapshot() to verify packing
  *              and field ordering.
+ *   - sched:   per-characteristic notify rates, deadbands and
+ *              change-driven state and pyro notifications.
  *
  * bt_enable() is intentionally never called: pad_link_publish_sm
  * early-exits when current_conn is NULL, so we exercise the
@@ -31,6 +34,9 @@
 #include <zephyr/zbus/zbus.h>
 
 #include <aurora/lib/baro.h>
+#if defined(CONFIG_AURORA_HEALTH)
+#include <aurora/lib/health.h>
+#endif
 #include <aurora/lib/imu.h>
 #include <aurora/lib/pad_link.h>
 #include <aurora/lib/state/state.h>
@@ -64,6 +70,9 @@ ZTEST(pad_link_format, test_boardcap_flags)
 
 	/* Positioning group — byte 2 */
 	zassert_equal(PL_CAP_GPS, (1u << 16), "GPS flag");
+
+	/* Pyro group — byte 3 */
+	zassert_equal(PL_CAP_PYRO, (1u << 24), "pyro flag");
 }
 
 ZTEST(pad_link_format, test_baro_payload_layout)
@@ -118,6 +127,42 @@ ZTEST(pad_link_format, test_inner_temp_payload_layout)
 	zassert_equal(offsetof(struct pl_inner_temp_payload, temp_us),    4, "temp_us");
 }
 
+ZTEST(pad_link_format, test_pyro_payload_layout)
+{
+	zassert_equal(sizeof(struct pl_pyro_payload), 25,
+		      "pyro payload size drifted: %zu",
+		      sizeof(struct pl_pyro_payload));
+
+	zassert_equal(offsetof(struct pl_pyro_payload, uptime_ms),  0,  "uptime_ms");
+	zassert_equal(offsetof(struct pl_pyro_payload, n_channels), 4,  "n_channels");
+	zassert_equal(offsetof(struct pl_pyro_payload, flags),      5,  "flags");
+	zassert_equal(offsetof(struct pl_pyro_payload, cap_mv),     9,  "cap_mv");
+	zassert_equal(offsetof(struct pl_pyro_payload, sense_mv),   17, "sense_mv");
+
+	zassert_equal(PL_PYRO_F_CAP_VALID,   (1u << 0), "cap valid flag");
+	zassert_equal(PL_PYRO_F_SENSE_VALID, (1u << 1), "sense valid flag");
+	zassert_equal(PL_PYRO_F_ARMED,       (1u << 2), "armed flag");
+	zassert_equal(PL_PYRO_F_FIRED,       (1u << 3), "fired flag");
+}
+
+ZTEST(pad_link_format, test_health_payload_layout)
+{
+	zassert_equal(sizeof(struct pl_health_hdr), 6,
+		      "health header size drifted: %zu",
+		      sizeof(struct pl_health_hdr));
+	zassert_equal(sizeof(struct pl_health_entry), 28,
+		      "health entry size drifted: %zu",
+		      sizeof(struct pl_health_entry));
+
+	zassert_equal(offsetof(struct pl_health_hdr, uptime_ms),    0,  "uptime_ms");
+	zassert_equal(offsetof(struct pl_health_hdr, n_threads),    4,  "n_threads");
+	zassert_equal(offsetof(struct pl_health_hdr, skipped),      5,  "skipped");
+	zassert_equal(offsetof(struct pl_health_entry, name),       0,  "name");
+	zassert_equal(offsetof(struct pl_health_entry, load_ppm),   16, "load_ppm");
+	zassert_equal(offsetof(struct pl_health_entry, stack_size), 20, "stack_size");
+	zassert_equal(offsetof(struct pl_health_entry, stack_used), 24, "stack_used");
+}
+
 ZTEST(pad_link_format, test_raw_payload_layout)
 {
 	zassert_equal(sizeof(struct pl_raw_payload), 68,
@@ -184,6 +229,26 @@ ZTEST(pad_link_format, test_computed_payload_bytes)
 	memcpy(&f, &buf[24], sizeof(f)); zassert_equal(f, 6.0f, "accel_vert");
 }
 
+ZTEST(pad_link_format, test_bundle_header_layout)
+{
+	zassert_equal(sizeof(struct pl_bundle_hdr), 4,
+		      "bundle header size drifted: %zu",
+		      sizeof(struct pl_bundle_hdr));
+
+	zassert_equal(offsetof(struct pl_bundle_hdr, version),  0, "version");
+	zassert_equal(offsetof(struct pl_bundle_hdr, sm_type),  1, "sm_type");
+	zassert_equal(offsetof(struct pl_bundle_hdr, sm_state), 2, "sm_state");
+	zassert_equal(offsetof(struct pl_bundle_hdr, fields),   3, "fields");
+
+	/* Flag order is wire order. */
+	zassert_equal(PL_BUNDLE_F_COMP,       (1u << 0), "comp flag");
+	zassert_equal(PL_BUNDLE_F_ACCEL,      (1u << 1), "accel flag");
+	zassert_equal(PL_BUNDLE_F_GYRO,       (1u << 2), "gyro flag");
+	zassert_equal(PL_BUNDLE_F_BARO,       (1u << 3), "baro flag");
+	zassert_equal(PL_BUNDLE_F_INNER_TEMP, (1u << 4), "inner temp flag");
+	zassert_equal(PL_BUNDLE_MAX_LEN, 120, "full bundle size");
+}
+
 ZTEST_SUITE(pad_link_format, NULL, NULL, NULL, NULL, NULL);
 
 /* ==========================================================
@@ -196,16 +261,8 @@ ZTEST_SUITE(pad_link_format, NULL, NULL, NULL, NULL, NULL);
 ZTEST(pad_link_snap, test_imu_publish_updates_snap_raw)
 {
 	struct imu_data msg = {
-		.accel = {
-			{ .val1 = 1,  .val2 = 100 },
-			{ .val1 = 2,  .val2 = 200 },
-			{ .val1 = 3,  .val2 = 300 },
-		},
-		.gyro = {
-			{ .val1 = 10, .val2 = 1000 },
-			{ .val1 = 20, .val2 = 2000 },
-			{ .val1 = 30, .val2 = 3000 },
-		},
+		.accel = { 1000100, 2000200, 3000300 },
+		.gyro = { 10001000, 20002000, 30003000 },
 	};
 
 	/* k_uptime_get_32() returns 0 during the very first millisecond
@@ -223,13 +280,11 @@ ZTEST(pad_link_snap, test_imu_publish_updates_snap_raw)
 				   NULL, NULL, NULL, NULL, NULL, NULL);
 
 	for (int i = 0; i < 3; i++) {
-		zassert_equal(raw.accel_val1[i], msg.accel[i].val1,
-			      "accel[%d].val1", i);
-		zassert_equal(raw.accel_val2[i], msg.accel[i].val2,
+		zassert_equal(raw.accel_val1[i], i + 1, "accel[%d].val1", i);
+		zassert_equal(raw.accel_val2[i], (i + 1) * 100,
 			      "accel[%d].val2", i);
-		zassert_equal(raw.gyro_val1[i], msg.gyro[i].val1,
-			      "gyro[%d].val1", i);
-		zassert_equal(raw.gyro_val2[i], msg.gyro[i].val2,
+		zassert_equal(raw.gyro_val1[i], (i + 1) * 10, "gyro[%d].val1", i);
+		zassert_equal(raw.gyro_val2[i], (i + 1) * 1000,
 			      "gyro[%d].val2", i);
 	}
 	zassert_true(raw.uptime_ms >= before,
@@ -240,8 +295,8 @@ ZTEST(pad_link_snap, test_imu_publish_updates_snap_raw)
 ZTEST(pad_link_snap, test_baro_publish_updates_snap_raw)
 {
 	struct baro_data msg = {
-		.temperature = { .val1 = 23, .val2 = 456000 },
-		.pressure    = { .val1 = 101, .val2 = 325000 },
+		.temperature = 23456000,
+		.pressure    = 101325000,
 	};
 
 	zassert_ok(zbus_chan_pub(&baro_data_chan, &msg, K_SECONDS(1)),
@@ -251,10 +306,45 @@ ZTEST(pad_link_snap, test_baro_publish_updates_snap_raw)
 	pad_link_test_get_snapshot(NULL, NULL, &raw, NULL,
 				   NULL, NULL, NULL, NULL, NULL, NULL);
 
-	zassert_equal(raw.temp_val1,  msg.temperature.val1, "temp_val1");
-	zassert_equal(raw.temp_val2,  msg.temperature.val2, "temp_val2");
-	zassert_equal(raw.press_val1, msg.pressure.val1,    "press_val1");
-	zassert_equal(raw.press_val2, msg.pressure.val2,    "press_val2");
+	zassert_equal(raw.temp_val1,  23,     "temp_val1");
+	zassert_equal(raw.temp_val2,  456000, "temp_val2");
+	zassert_equal(raw.press_val1, 101,    "press_val1");
+	zassert_equal(raw.press_val2, 325000, "press_val2");
+}
+
+/* raw is composed from the IMU and baro snapshots; a baro publish
+ * must not disturb the IMU half and moves the uptime to its own.
+ */
+ZTEST(pad_link_snap, test_raw_combines_imu_and_baro)
+{
+	const struct imu_data imu = {
+		.accel = { -1500000, 0, 9810000 },
+		.gyro  = { 0, -1, 2 },
+	};
+	const struct baro_data baro = {
+		.temperature = -5250000,
+		.pressure    = 98000000,
+	};
+	struct pl_raw_payload raw;
+
+	zassert_ok(zbus_chan_pub(&imu_data_chan, &imu, K_SECONDS(1)),
+		   "imu publish");
+	k_msleep(2);
+	zassert_ok(zbus_chan_pub(&baro_data_chan, &baro, K_SECONDS(1)),
+		   "baro publish");
+
+	struct pl_baro_payload bp;
+	pad_link_test_get_snapshot(NULL, NULL, &raw, NULL,
+				   NULL, &bp, NULL, NULL, NULL, NULL);
+
+	zassert_equal(raw.uptime_ms, bp.uptime_ms, "uptime of the later publish");
+	zassert_equal(raw.accel_val1[0], -1, "accel[0].val1");
+	zassert_equal(raw.accel_val2[0], -500000, "accel[0].val2");
+	zassert_equal(raw.accel_val1[2], 9, "accel[2].val1");
+	zassert_equal(raw.gyro_val2[1], -1, "gyro[1].val2");
+	zassert_equal(raw.temp_val1, -5, "temp_val1");
+	zassert_equal(raw.temp_val2, -250000, "temp_val2");
+	zassert_equal(raw.press_val1, 98, "press_val1");
 }
 
 ZTEST(pad_link_snap, test_publish_sm_updates_snap_comp)
@@ -341,8 +431,8 @@ ZTEST(pad_link_snap, test_boardcap_flags_set)
 ZTEST(pad_link_snap, test_baro_publish_updates_snap_baro)
 {
 	struct baro_data msg = {
-		.temperature = { .val1 = 23,  .val2 = 456000 },
-		.pressure    = { .val1 = 101, .val2 = 325000 },
+		.temperature = 23456000,
+		.pressure    = 101325000,
 	};
 
 	/* k_uptime_get_32() returns 0 during the very first millisecond
@@ -368,8 +458,8 @@ ZTEST(pad_link_snap, test_baro_publish_updates_snap_baro)
 ZTEST(pad_link_snap, test_baro_publish_updates_snap_inner_temp)
 {
 	struct baro_data msg = {
-		.temperature = { .val1 = 25, .val2 = 100000 },
-		.pressure    = { .val1 = 99, .val2 = 0 },
+		.temperature = 25100000,
+		.pressure    = 99000000,
 	};
 
 	zassert_ok(zbus_chan_pub(&baro_data_chan, &msg, K_SECONDS(1)),
@@ -387,12 +477,8 @@ ZTEST(pad_link_snap, test_baro_publish_updates_snap_inner_temp)
 ZTEST(pad_link_snap, test_imu_publish_updates_snap_accel)
 {
 	struct imu_data msg = {
-		.accel = {
-			{ .val1 = 1, .val2 = 100 },
-			{ .val1 = 2, .val2 = 200 },
-			{ .val1 = 3, .val2 = 300 },
-		},
-		.gyro = { {0}, {0}, {0} },
+		.accel = { 1000100, 2000200, 3000300 },
+		.gyro = { 0 },
 	};
 
 	zassert_ok(zbus_chan_pub(&imu_data_chan, &msg, K_SECONDS(1)),
@@ -403,21 +489,15 @@ ZTEST(pad_link_snap, test_imu_publish_updates_snap_accel)
 				   NULL, NULL, &accel, NULL, NULL, NULL);
 
 	for (int i = 0; i < 3; i++) {
-		int64_t exp = (int64_t)msg.accel[i].val1 * 1000000LL
-			      + msg.accel[i].val2;
-		zassert_equal(accel.accel_us[i], exp, "accel_us[%d]", i);
+		zassert_equal(accel.accel_us[i], msg.accel[i], "accel_us[%d]", i);
 	}
 }
 
 ZTEST(pad_link_snap, test_imu_publish_updates_snap_gyro)
 {
 	struct imu_data msg = {
-		.accel = { {0}, {0}, {0} },
-		.gyro  = {
-			{ .val1 = 10, .val2 = 1000 },
-			{ .val1 = 20, .val2 = 2000 },
-			{ .val1 = 30, .val2 = 3000 },
-		},
+		.accel = { 0 },
+		.gyro  = { 10001000, 20002000, 30003000 },
 	};
 
 	zassert_ok(zbus_chan_pub(&imu_data_chan, &msg, K_SECONDS(1)),
@@ -428,25 +508,15 @@ ZTEST(pad_link_snap, test_imu_publish_updates_snap_gyro)
 				   NULL, NULL, NULL, &gyro, NULL, NULL);
 
 	for (int i = 0; i < 3; i++) {
-		int64_t exp = (int64_t)msg.gyro[i].val1 * 1000000LL
-			      + msg.gyro[i].val2;
-		zassert_equal(gyro.gyro_us[i], exp, "gyro_us[%d]", i);
+		zassert_equal(gyro.gyro_us[i], msg.gyro[i], "gyro_us[%d]", i);
 	}
 }
 
 ZTEST(pad_link_snap, test_imu_publish_updates_snap_imu6)
 {
 	struct imu_data msg = {
-		.accel = {
-			{ .val1 = 5, .val2 = 500 },
-			{ .val1 = 6, .val2 = 600 },
-			{ .val1 = 7, .val2 = 700 },
-		},
-		.gyro = {
-			{ .val1 = 50, .val2 = 5000 },
-			{ .val1 = 60, .val2 = 6000 },
-			{ .val1 = 70, .val2 = 7000 },
-		},
+		.accel = { 5000500, 6000600, 7000700 },
+		.gyro = { 50005000, 60006000, 70007000 },
 	};
 
 	zassert_ok(zbus_chan_pub(&imu_data_chan, &msg, K_SECONDS(1)),
@@ -457,13 +527,295 @@ ZTEST(pad_link_snap, test_imu_publish_updates_snap_imu6)
 				   NULL, NULL, NULL, NULL, &imu6, NULL);
 
 	for (int i = 0; i < 3; i++) {
-		int64_t exp_a = (int64_t)msg.accel[i].val1 * 1000000LL
-				+ msg.accel[i].val2;
-		int64_t exp_g = (int64_t)msg.gyro[i].val1 * 1000000LL
-				+ msg.gyro[i].val2;
-		zassert_equal(imu6.accel_us[i], exp_a, "imu6.accel_us[%d]", i);
-		zassert_equal(imu6.gyro_us[i],  exp_g, "imu6.gyro_us[%d]",  i);
+		zassert_equal(imu6.accel_us[i], msg.accel[i], "imu6.accel_us[%d]", i);
+		zassert_equal(imu6.gyro_us[i],  msg.gyro[i],  "imu6.gyro_us[%d]",  i);
+	}
+}
+
+ZTEST(pad_link_snap, test_bundle_follows_caps)
+{
+	const struct sm_inputs in = {
+		.altitude = 12.5,
+		.velocity = -3.0,
+	};
+	struct baro_data msg = {
+		.temperature = 21000000,
+		.pressure    = 100500000,
+	};
+	uint8_t buf[PL_BUNDLE_MAX_LEN];
+	struct pl_bundle_hdr hdr;
+	struct pl_computed_payload comp;
+	struct pl_baro_payload baro;
+
+	zassert_ok(zbus_chan_pub(&baro_data_chan, &msg, K_SECONDS(1)),
+		   "baro publish");
+	pad_link_publish_sm(SM_ARMED, SM_TYPE_SIMPLE, &in);
+	pad_link_set_caps(PL_CAP_BARO);
+
+	size_t n = pad_link_test_build_bundle(buf, sizeof(buf));
+
+	zassert_equal(n, sizeof(hdr) + sizeof(comp) + sizeof(baro),
+		      "header, comp and baro only: %zu", n);
+	memcpy(&hdr, buf, sizeof(hdr));
+	zassert_equal(hdr.version,  PL_BUNDLE_VERSION,       "version");
+	zassert_equal(hdr.sm_state, (uint8_t)SM_ARMED,       "sm_state");
+	zassert_equal(hdr.sm_type,  (uint8_t)SM_TYPE_SIMPLE, "sm_type");
+	zassert_equal(hdr.fields, PL_BUNDLE_F_COMP | PL_BUNDLE_F_BARO,
+		      "fields 0x%02x", hdr.fields);
+
+	memcpy(&comp, &buf[sizeof(hdr)], sizeof(comp));
+	memcpy(&baro, &buf[sizeof(hdr) + sizeof(comp)], sizeof(baro));
+	zassert_equal(comp.altitude, (float)in.altitude, "comp section");
+	zassert_equal(baro.press_us, (int64_t)100 * 1000000LL + 500000,
+		      "baro section");
+}
+
+ZTEST(pad_link_snap, test_bundle_truncates_to_mtu)
+{
+	uint8_t buf[PL_BUNDLE_MAX_LEN];
+	struct pl_bundle_hdr hdr;
+
+	pad_link_set_caps(PL_CAP_IMU_TYPE(PL_CAP_IMU_TYPE_6DOF) |
+			  PL_CAP_ACCEL | PL_CAP_GYRO |
+			  PL_CAP_BARO | PL_CAP_TEMP_INNER);
+
+	zassert_equal(pad_link_test_build_bundle(buf, sizeof(buf)),
+		      PL_BUNDLE_MAX_LEN, "everything fits");
+
+	/* Default ATT MTU 23: 20-byte notifications. Only the 12-byte
+	 * inner temperature fits next to the header.
+	 */
+	zassert_equal(pad_link_test_build_bundle(buf, 20), sizeof(hdr) + 12,
+		      "header and inner temp");
+	memcpy(&hdr, buf, sizeof(hdr));
+	zassert_equal(hdr.fields, PL_BUNDLE_F_INNER_TEMP,
+		      "fields 0x%02x", hdr.fields);
+
+	/* Room for comp + accel, not gyro; the smaller baro after it
+	 * still fits and is sent.
+	 */
+	size_t n = pad_link_test_build_bundle(buf, 4 + 28 + 28 + 20);
+
+	memcpy(&hdr, buf, sizeof(hdr));
+	zassert_equal(n, 4 + 28 + 28 + 20, "comp, accel, baro");
+	zassert_equal(hdr.fields,
+		      PL_BUNDLE_F_COMP | PL_BUNDLE_F_ACCEL | PL_BUNDLE_F_BARO,
+		      "fields 0x%02x", hdr.fields);
+
+	zassert_equal(pad_link_test_build_bundle(buf, 3), 0, "no header room");
+}
+
+ZTEST(pad_link_snap, test_publish_pyro_updates_snap)
+{
+	const struct pad_link_pyro_channel ch[] = {
+		{ .cap_mv = 8900, .sense_mv = 120,
+		  .flags = PL_PYRO_F_CAP_VALID | PL_PYRO_F_SENSE_VALID |
+			   PL_PYRO_F_ARMED },
+		{ .cap_mv = 70000, .sense_mv = 0,
+		  .flags = PL_PYRO_F_CAP_VALID },
+	};
+	struct pl_pyro_payload pyro;
+
+	pad_link_publish_pyro(ch, ARRAY_SIZE(ch));
+	pad_link_test_get_pyro(&pyro);
+
+	zassert_equal(pyro.n_channels, 2, "n_channels");
+	zassert_equal(pyro.flags[0], ch[0].flags, "flags[0]");
+	zassert_equal(pyro.flags[1], ch[1].flags, "flags[1]");
+	zassert_equal(pyro.cap_mv[0], 8900, "cap_mv[0]");
+	zassert_equal(pyro.sense_mv[0], 120, "sense_mv[0]");
+	zassert_equal(pyro.cap_mv[1], UINT16_MAX, "cap_mv[1] saturates");
+	zassert_equal(pyro.flags[2], 0, "unused channel is zero");
+	zassert_not_equal(pyro.uptime_ms, 0, "uptime_ms should be stamped");
+}
+
+ZTEST(pad_link_snap, test_publish_pyro_caps_channels)
+{
+	struct pad_link_pyro_channel ch[PL_PYRO_MAX_CHANNELS + 2] = { 0 };
+	struct pl_pyro_payload pyro;
+
+	pad_link_publish_pyro(ch, ARRAY_SIZE(ch));
+	pad_link_test_get_pyro(&pyro);
+
+	zassert_equal(pyro.n_channels, PL_PYRO_MAX_CHANNELS,
+		      "extra channels are ignored");
+}
+
+ZTEST(pad_link_snap, test_health_payload)
+{
+	static uint8_t buf[PL_HEALTH_MAX_LEN];
+	struct pl_health_hdr hdr;
+	struct pl_health_entry e;
+	size_t n;
+
+	if (IS_ENABLED(CONFIG_AURORA_HEALTH)) {
+		zassert_ok(health_sample(), "sample");
+	}
+
+	n = pad_link_test_build_health(buf, sizeof(buf));
+	zassert_true(n >= sizeof(hdr), "header always present");
+	memcpy(&hdr, buf, sizeof(hdr));
+	zassert_equal(n, sizeof(hdr) + hdr.n_threads * sizeof(e),
+		      "length matches n_threads");
+
+	if (!IS_ENABLED(CONFIG_AURORA_HEALTH)) {
+		zassert_equal(hdr.n_threads, 0, "no threads without health");
+		return;
+	}
+
+	zassert_true(hdr.n_threads > 0, "sample lists threads");
+	for (size_t i = 0; i < hdr.n_threads; i++) {
+		memcpy(&e, &buf[sizeof(hdr) + i * sizeof(e)], sizeof(e));
+		zassert_not_equal(e.name[0], '\0', "thread %zu named", i);
+		zassert_true(e.stack_used <= e.stack_size,
+			     "%.16s: used %u of %u", e.name,
+			     (unsigned int)e.stack_used,
+			     (unsigned int)e.stack_size);
+		zassert_true(e.load_ppm <= 1000000U, "%.16s: load", e.name);
 	}
+
+	/* Entries that do not fit are counted, not truncated. */
+	n = pad_link_test_build_health(buf, sizeof(hdr) + sizeof(e));
+	memcpy(&hdr, buf, sizeof(hdr));
+	zassert_equal(n, sizeof(hdr) + sizeof(e), "one entry fits");
+	zassert_equal(hdr.n_threads, 1, "one entry served");
+	zassert_true(hdr.skipped > 0, "the rest are counted");
 }
 
 ZTEST_SUITE(pad_link_snap, NULL, NULL, NULL, NULL, NULL);
+
+/* ==========================================================
+ *                     SCHED SUITE
+ * ==========================================================
+ * Change-driven notify scheduling: which characteristics a producer
+ * marks due, read back through pad_link_test_take_pending(). Without
+ * a central the notify pass never consumes the mask.
+ */
+
+static void sched_publish_baro(int32_t kpa, int32_t ukpa)
+{
+	struct baro_data msg = {
+		.temperature = 20000000,
+		.pressure    = kpa * AURORA_SAMPLE_SCALE + ukpa,
+	};
+
+	zassert_ok(zbus_chan_pub(&baro_data_chan, &msg, K_SECONDS(1)),
+		   "baro publish");
+}
+
+ZTEST(pad_link_sched, test_state_only_on_change)
+{
+	const struct sm_inputs in = { 0 };
+
+	pad_link_publish_sm(SM_BOOST, SM_TYPE_SIMPLE, &in);
+	pad_link_test_set_subscribed(BIT(PL_N_STATE));
+
+	pad_link_publish_sm(SM_BOOST, SM_TYPE_SIMPLE, &in);
+	zassert_equal(pad_link_test_take_pending(), 0,
+		      "unchanged state is not sent");
+
+	pad_link_publish_sm(SM_BURNOUT, SM_TYPE_SIMPLE, &in);
+	zassert_equal(pad_link_test_take_pending(), BIT(PL_N_STATE),
+		      "transition is sent");
+}
+
+ZTEST(pad_link_sched, test_period_limits_rate)
+{
+	const struct sm_inputs in = { 0 };
+
+	pad_link_test_set_subscribed(BIT(PL_N_COMP));
+
+	pad_link_publish_sm(SM_IDLE, SM_TYPE_SIMPLE, &in);
+	zassert_equal(pad_link_test_take_pending(), BIT(PL_N_COMP),
+		      "first sample is due");
+
+	pad_link_publish_sm(SM_IDLE, SM_TYPE_SIMPLE, &in);
+	zassert_equal(pad_link_test_take_pending(), 0, "inside the period");
+
+	k_msleep(CONFIG_AURORA_PAD_LINK_COMP_PERIOD_MS + 1);
+	pad_link_publish_sm(SM_IDLE, SM_TYPE_SIMPLE, &in);
+	zassert_equal(pad_link_test_take_pending(), BIT(PL_N_COMP),
+		      "due again after the period");
+}
+
+ZTEST(pad_link_sched, test_transition_bypasses_bundle_period)
+{
+	const struct sm_inputs in = { 0 };
+
+	pad_link_publish_sm(SM_MAIN, SM_TYPE_SIMPLE, &in);
+	pad_link_test_set_subscribed(BIT(PL_N_BUNDLE));
+
+	pad_link_publish_sm(SM_MAIN, SM_TYPE_SIMPLE, &in);
+	zassert_equal(pad_link_test_take_pending(), BIT(PL_N_BUNDLE),
+		      "first bundle is due");
+
+	pad_link_publish_sm(SM_REDUNDANT, SM_TYPE_SIMPLE, &in);
+	zassert_equal(pad_link_test_take_pending(), BIT(PL_N_BUNDLE),
+		      "transition sent inside the period");
+}
+
+ZTEST(pad_link_sched, test_baro_deadband)
+{
+	/* Deadband in micro-kPa of the snapshot. */
+	const int32_t db = CONFIG_AURORA_PAD_LINK_BARO_DEADBAND_PA * 1000;
+
+	if (db == 0) {
+		ztest_test_skip();
+	}
+	pad_link_test_set_subscribed(BIT(PL_N_BARO));
+
+	sched_publish_baro(100, 0);
+	zassert_equal(pad_link_test_take_pending(), BIT(PL_N_BARO),
+		      "first sample is due");
+
+	k_msleep(CONFIG_AURORA_PAD_LINK_BARO_PERIOD_MS + 1);
+	sched_publish_baro(100, db / 2);
+	zassert_equal(pad_link_test_take_pending(), 0,
+		      "change inside the deadband");
+
+	sched_publish_baro(100, 2 * db);
+	zassert_equal(pad_link_test_take_pending(), BIT(PL_N_BARO),
+		      "change beyond the deadband");
+}
+
+ZTEST(pad_link_sched, test_pyro_flag_change_bypasses_period)
+{
+	struct pad_link_pyro_channel ch = {
+		.cap_mv = 100,
+		.flags = PL_PYRO_F_CAP_VALID,
+	};
+
+	pad_link_publish_pyro(&ch, 1);
+	pad_link_test_set_subscribed(BIT(PL_N_PYRO));
+
+	pad_link_publish_pyro(&ch, 1);
+	zassert_equal(pad_link_test_take_pending(), BIT(PL_N_PYRO),
+		      "first sample is due");
+
+	ch.cap_mv = 200;
+	pad_link_publish_pyro(&ch, 1);
+	zassert_equal(pad_link_test_take_pending(), 0,
+		      "voltage change inside the period");
+
+	ch.flags |= PL_PYRO_F_ARMED;
+	pad_link_publish_pyro(&ch, 1);
+	zassert_equal(pad_link_test_take_pending(), BIT(PL_N_PYRO),
+		      "arming is sent inside the period");
+}
+
+ZTEST(pad_link_sched, test_unsubscribed_never_due)
+{
+	const struct sm_inputs in = { 0 };
+	struct imu_data msg = { 0 };
+
+	pad_link_test_set_subscribed(0);
+
+	zassert_ok(zbus_chan_pub(&imu_data_chan, &msg, K_SECONDS(1)),
+		   "imu publish");
+	sched_publish_baro(101, 0);
+	pad_link_publish_sm(SM_LANDED, SM_TYPE_SIMPLE, &in);
+
+	zassert_equal(pad_link_test_take_pending(), 0, "nothing subscribed");
+}
+
+ZTEST_SUITE(pad_link_sched, NULL, NULL, NULL, NULL, NULL);
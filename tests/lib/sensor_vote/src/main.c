@@ -0,0 +1,142 @@
+/**
+ * @file main.c
+ * @brief Unit tests for redundant sensor voting.
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/ztest.h>
+#include <aurora/lib/sensor_vote.h>
+
+#define MS(x) ((uint64_t)(x) * 1000000ULL)
+
+static const double TOL[1] = { 1.0 };
+static struct sensor_vote v;
+
+ZTEST(sensor_vote, test_init_rejects_bad_counts)
+{
+	zassert_equal(sensor_vote_init(&v, SENSOR_VOTE_MEDIAN, 0, 1, TOL, MS(50)),
+		      -EINVAL, NULL);
+	zassert_equal(sensor_vote_init(&v, SENSOR_VOTE_MEDIAN,
+				       SENSOR_VOTE_MAX_INSTANCES + 1, 1, TOL, MS(50)),
+		      -EINVAL, NULL);
+	zassert_equal(sensor_vote_init(&v, SENSOR_VOTE_MEDIAN, 2,
+				       SENSOR_VOTE_MAX_CHANNELS + 1, TOL, MS(50)),
+		      -EINVAL, NULL);
+	zassert_equal(sensor_vote_init(&v, SENSOR_VOTE_MEDIAN, 2, 1, NULL, MS(50)),
+		      -EINVAL, NULL);
+	zassert_ok(sensor_vote_init(&v, SENSOR_VOTE_MEDIAN, 2, 1, TOL, MS(50)), NULL);
+
+	const double x = 1.0;
+	double out;
+
+	zassert_equal(sensor_vote_submit(&v, 2, MS(1), &x, &out), -EINVAL, NULL);
+}
+
+ZTEST(sensor_vote, test_single_instance_passes)
+{
+	double out;
+
+	zassert_ok(sensor_vote_init(&v, SENSOR_VOTE_MEDIAN, 1, 1, TOL, MS(50)), NULL);
+	for (int i = 1; i <= 5; i++) {
+		const double x = 100.0 * i;
+
+		zassert_equal(sensor_vote_submit(&v, 0, MS(i), &x, &out), 1, NULL);
+		zassert_equal(out, x, "a lone sensor is never voted down");
+	}
+}
+
+/* Three IMU-style instances, one per round each; instance 2 is stuck. */
+ZTEST(sensor_vote, test_median_votes_out_outlier)
+{
+	const double good0 = 10.0, good1 = 10.4, stuck = 30.0;
+	double out = 0.0;
+	int outputs = 0;
+
+	zassert_ok(sensor_vote_init(&v, SENSOR_VOTE_MEDIAN, 3, 1, TOL, MS(50)), NULL);
+
+	for (int r = 1; r <= 6; r++) {
+		outputs += sensor_vote_submit(&v, 0, MS(10 * r), &good0, &out) == 1;
+		outputs += sensor_vote_submit(&v, 1, MS(10 * r) + 1, &good1, &out) == 1;
+		zassert_equal(sensor_vote_submit(&v, 2, MS(10 * r) + 2, &stuck, &out),
+			      -EBADMSG, "round %d", r);
+	}
+
+	zassert_within(out, 10.2, 1e-9, "median of the agreeing pair");
+	zassert_true(outputs >= 5, "a rejected instance must not stall rounds");
+	zassert_true(sensor_vote_healthy(&v, 0), NULL);
+	zassert_true(sensor_vote_healthy(&v, 1), NULL);
+	zassert_false(sensor_vote_healthy(&v, 2), "voted out after the fault limit");
+	zassert_equal(v.rejected[2], 6, NULL);
+
+	/* One agreeing sample brings it back. */
+	const double fixed = 10.2;
+
+	(void)sensor_vote_submit(&v, 0, MS(70), &good0, &out);
+	(void)sensor_vote_submit(&v, 1, MS(70) + 1, &good1, &out);
+	zassert_true(sensor_vote_submit(&v, 2, MS(70) + 2, &fixed, &out) >= 0, NULL);
+	zassert_true(sensor_vote_healthy(&v, 2), NULL);
+}
+
+/* Two interleaved barometers: the previous output breaks the tie. */
+ZTEST(sensor_vote, test_pass_two_way_tie)
+{
+	const double a[] = { 100.0, 100.2, 100.4, 100.6 };
+	const double b[] = { 100.1, 100.3, 150.0, 100.7 };
+	double out;
+
+	zassert_ok(sensor_vote_init(&v, SENSOR_VOTE_PASS, 2, 1, TOL, MS(50)), NULL);
+
+	for (int i = 0; i < ARRAY_SIZE(a); i++) {
+		zassert_equal(sensor_vote_submit(&v, 0, MS(10 * i + 10), &a[i], &out), 1,
+			      NULL);
+		zassert_equal(out, a[i], "accepted samples pass unchanged");
+
+		const int rc = sensor_vote_submit(&v, 1, MS(10 * i + 15), &b[i], &out);
+
+		if (i == 2) {
+			zassert_equal(rc, -EBADMSG, "glitch against the good sensor");
+		} else {
+			zassert_equal(rc, 1, NULL);
+			zassert_equal(out, b[i], NULL);
+		}
+	}
+	zassert_true(sensor_vote_healthy(&v, 1), "a single glitch is forgiven");
+}
+
+/* A glitch after an accepted sample must not replace it in the round. */
+ZTEST(sensor_vote, test_reject_while_pending)
+{
+	const double a = 10.0, b = 10.1, glitch = 100.0;
+	double out;
+
+	zassert_ok(sensor_vote_init(&v, SENSOR_VOTE_MEDIAN, 2, 1, TOL, MS(50)), NULL);
+
+	zassert_equal(sensor_vote_submit(&v, 0, MS(10), &a, &out), 0, NULL);
+	zassert_equal(sensor_vote_submit(&v, 1, MS(10) + 1, &b, &out), 1, NULL);
+	zassert_within(out, 10.05, 1e-9, NULL);
+
+	zassert_equal(sensor_vote_submit(&v, 0, MS(20), &a, &out), 0, NULL);
+	zassert_equal(sensor_vote_submit(&v, 0, MS(25), &glitch, &out), -EBADMSG,
+		      NULL);
+	zassert_equal(sensor_vote_submit(&v, 1, MS(30), &b, &out), 1, NULL);
+	zassert_within(out, 10.05, 1e-9, "the rejected sample leaked into the median");
+}
+
+ZTEST(sensor_vote, test_stale_instance_left_out)
+{
+	const double x = 5.0, far = 50.0;
+	double out;
+
+	zassert_ok(sensor_vote_init(&v, SENSOR_VOTE_PASS, 2, 1, TOL, MS(50)), NULL);
+
+	zassert_equal(sensor_vote_submit(&v, 1, MS(10), &far, &out), 1, NULL);
+	/* Instance 1 went silent; 100 ms later its last word no longer counts. */
+	zassert_equal(sensor_vote_submit(&v, 0, MS(110), &x, &out), 1, NULL);
+	zassert_equal(out, x, NULL);
+}
+
+ZTEST_SUITE(sensor_vote, NULL, NULL, NULL, NULL, NULL);
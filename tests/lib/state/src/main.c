@@ -160,6 +160,46 @@ ZTEST(simple_state_tests, test_states_setup)
 	zassert_equal(sm_get_state(), SM_IDLE, "Initial state should be DISARMED");
 }
 
+/**
+ * @brief Test the reported backend type
+ *
+ * Receivers decode state values by sm_get_type(), so it must match the
+ * backend selected in Kconfig.
+ */
+ZTEST(simple_state_tests, test_type_matches_backend)
+{
+	const enum sm_type expected = IS_ENABLED(CONFIG_TABLE_STATE) ?
+		SM_TYPE_TABLE : SM_TYPE_SIMPLE;
+
+	zassert_equal(sm_get_type(), expected, "sm_get_type() should match Kconfig");
+}
+
+/**
+ * @brief Test that sm_fuse() never takes a decision
+ *
+ * Inputs that would arm on sm_update() leave the state and the inputs
+ * reported by sm_get_inputs() untouched when only fused.
+ */
+ZTEST(simple_state_tests, test_fuse_does_not_step)
+{
+	struct sm_inputs inputs = {
+		.armed = 1,
+		.log_ready = 1,
+		.orientation = ORIENT(simple_state_cfg.T_OA),
+		.altitude = 12.0,
+	};
+	struct sm_inputs seen;
+
+	sm_fuse(&inputs);
+	zassert_equal(sm_get_state(), SM_IDLE, "fusing alone must not arm");
+
+	sm_get_inputs(&seen);
+	zassert_equal(seen.armed, 0, "sm_get_inputs() reports the last decision only");
+
+	sm_update(&inputs);
+	zassert_equal(sm_get_state(), SM_ARMED, "the decision arms as usual");
+}
+
 /**
  * @brief Test Simple State Updates in IDLE
  *
@@ -10,6 +10,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <errno.h>
 #include <string.h>
 
 #include <zephyr/kernel.h>
@@ -19,6 +20,7 @@
 
 #include <aurora/lib/state/state.h>
 #include <aurora/lib/state/audit.h>
+#include <aurora/lib/state/profile.h>
 
 /* Build an orientation vector (yaw, pitch, roll) whose up-axis elevation
  * equals @p elev degrees.
@@ -286,3 +288,142 @@ ZTEST(state_shell_tests, test_audit_clear)
 	/* Verify audit command now shows empty */
 	execute_and_check("state_machine audit", "empty");
 }
+
+/*-----------------------------------------------------------
+ * Ring behaviour
+ *----------------------------------------------------------*/
+
+/**
+ * @brief Test that a full ring keeps the newest entries, oldest first.
+ */
+ZTEST(state_shell_tests, test_audit_wraps_oldest_first)
+{
+	static const char *const ev[] = { "e0", "e1", "e2", "e3" };
+	const uint32_t size = CONFIG_AURORA_STATE_MACHINE_AUDIT_LOG_SIZE;
+	struct sm_audit_entry e;
+
+	for (uint32_t i = 0; i < size + 3; i++) {
+		sm_audit_event(SM_IDLE, ev[i % ARRAY_SIZE(ev)]);
+	}
+
+	zassert_equal(sm_audit_count(), size, "ring holds %u entries", size);
+
+	zassert_ok(sm_audit_get(0, &e), "oldest entry readable");
+	zassert_equal(e.event, ev[3 % ARRAY_SIZE(ev)], "oldest is entry 3");
+	zassert_ok(sm_audit_get(size - 1, &e), "newest entry readable");
+	zassert_equal(e.event, ev[(size + 2) % ARRAY_SIZE(ev)],
+		      "newest is the last recorded");
+	zassert_equal(sm_audit_get(size, &e), -EINVAL, "index past the end");
+}
+
+/**
+ * @brief Test that sm_audit_format renders both entry types.
+ */
+ZTEST(state_shell_tests, test_audit_format)
+{
+	const struct sm_audit_entry t = {
+		.timestamp_ns = 42,
+		.type = SM_AUDIT_TRANSITION,
+		.from = SM_IDLE,
+		.to = SM_ARMED,
+	};
+	const struct sm_audit_entry ev = {
+		.timestamp_ns = 43,
+		.type = SM_AUDIT_EVENT,
+		.from = SM_IDLE,
+		.event = "test event",
+	};
+	char line[128];
+
+	zassert_true(sm_audit_format(&t, line, sizeof(line)) > 0, "rendered");
+	zassert_not_null(strstr(line, "transition"), "type shown: %s", line);
+	zassert_not_null(strstr(line, "ARMED"), "target shown: %s", line);
+
+	zassert_true(sm_audit_format(&ev, line, sizeof(line)) > 0, "rendered");
+	zassert_not_null(strstr(line, "test event"), "event shown: %s", line);
+
+	zassert_equal(sm_audit_format(NULL, line, sizeof(line)), -EINVAL,
+		      "NULL entry");
+}
+
+#if defined(CONFIG_AURORA_STATE_MACHINE_PROFILE)
+
+/*-----------------------------------------------------------
+ * profile command
+ *----------------------------------------------------------*/
+
+/**
+ * @brief Test that every sm_update() is accounted to the sm_update stage
+ *        and shown by "state_machine profile".
+ */
+ZTEST(state_shell_tests, test_profile_records_sm_update)
+{
+	struct sm_inputs in = { 0 };
+	struct sm_prof_stats st;
+
+	sm_prof_reset();
+	for (int i = 0; i < 3; i++) {
+		sm_update(&in);
+	}
+
+	zassert_ok(sm_prof_get(SM_PROF_SM_UPDATE, &st), NULL);
+	zassert_equal(st.count, 3, "one run per sm_update(), got %u", st.count);
+	zassert_true(st.min <= st.max, "min %u > max %u", st.min, st.max);
+	zassert_true(st.total >= st.max, "total below max");
+
+	execute_and_check("state_machine profile", "sm_update");
+}
+
+/**
+ * @brief Test min/max/total bookkeeping and argument checks.
+ */
+ZTEST(state_shell_tests, test_profile_accumulates)
+{
+	struct sm_prof_stats st;
+	uint32_t now;
+
+	sm_prof_reset();
+	now = sm_prof_begin();
+	sm_prof_end(SM_PROF_PAD_LINK, now - 1000U);
+	now = sm_prof_begin();
+	sm_prof_end(SM_PROF_PAD_LINK, now - 10U);
+
+	zassert_ok(sm_prof_get(SM_PROF_PAD_LINK, &st), NULL);
+	zassert_equal(st.count, 2, NULL);
+	zassert_true(st.min >= 10U && st.min < 1000U, "min %u", st.min);
+	zassert_true(st.max >= 1000U, "max %u", st.max);
+	zassert_true(st.total >= 1010U, "total %llu",
+		     (unsigned long long)st.total);
+
+	zassert_equal(sm_prof_get(SM_PROF_COUNT, &st), -EINVAL, NULL);
+	zassert_equal(sm_prof_get(SM_PROF_PAD_LINK, NULL), -EINVAL, NULL);
+	zassert_true(sm_prof_cycles_per_sec() > 0, NULL);
+}
+
+/**
+ * @brief Test that "state_machine profile_reset" clears every stage.
+ */
+ZTEST(state_shell_tests, test_profile_reset)
+{
+	struct sm_inputs in = { 0 };
+	struct sm_prof_stats st;
+	size_t size;
+	const char *buf;
+
+	sm_update(&in);
+	execute_and_check("state_machine profile_reset", "cleared");
+
+	for (int i = 0; i < SM_PROF_COUNT; i++) {
+		zassert_ok(sm_prof_get((enum sm_prof_stage)i, &st), NULL);
+		zassert_equal(st.count, 0, "%s not cleared",
+			      sm_prof_stage_str((enum sm_prof_stage)i));
+	}
+
+	shell_backend_dummy_clear_output(sh);
+	zassert_ok(shell_execute_cmd(sh, "state_machine profile"), NULL);
+	buf = shell_backend_dummy_get_output(sh, &size);
+	zassert_is_null(strstr(buf, "sm_update"),
+			"Cleared stages must not be listed:\n%s", buf);
+}
+
+#endif /* CONFIG_AURORA_STATE_MACHINE_PROFILE */
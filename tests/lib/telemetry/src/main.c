@@ -2,8 +2,14 @@
  * @file main.c
  * @brief Unit tests for the telemetry dispatcher and HC-12 backend.
  *
- * Three suites:
+ * Suites:
  *   - format:    locks the HC-12 wire frame byte-for-byte.
+ *   - compact:   key/delta encoding (CONFIG_AURORA_TELEMETRY_HC12_COMPACT).
+ *   - sched:     message classes and per-backend bandwidth budgets.
+ *   - samples:   HC-12 sample decimation / batching
+ *                (CONFIG_AURORA_TELEMETRY_HC12_SAMPLES).
+ *   - canfd:     CAN-FD frame layout and a loopback round trip onto
+ *                the remote zbus channels (CONFIG_AURORA_TELEMETRY_CANFD).
  *   - rate:      exercises the per-backend rate limiter.
  *   - dispatch:  verifies fan-out to multiple registered backends and
  *                the dispatcher's error aggregation.
@@ -18,6 +24,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <math.h>
 #include <string.h>
 
 #include <zephyr/kernel.h>
@@ -28,6 +35,13 @@
 #include <aurora/lib/telemetry.h>
 
 #include "hc12_internal.h"
+#if defined(CONFIG_AURORA_TELEMETRY_CANFD)
+#include <zephyr/zbus/zbus.h>
+
+#include <aurora/lib/telemetry_canfd.h>
+
+#include "canfd_internal.h"
+#endif /* CONFIG_AURORA_TELEMETRY_CANFD */
 
 /* ==========================================================
  *                     STUB BACKENDS
@@ -47,19 +61,19 @@ static int  stub_b_init_rc;
 static int  stub_b_send_rc;
 
 static int stub_a_init(void) { stub_a_init_calls++; return stub_a_init_rc; }
-static int stub_a_send(enum sm_state s, enum sm_type type,
-		       const struct sm_inputs *in)
+static int stub_a_send(enum telemetry_class cls, enum sm_state s,
+		       enum sm_type type, const struct sm_inputs *in)
 {
-	ARG_UNUSED(s); ARG_UNUSED(in);
+	ARG_UNUSED(cls); ARG_UNUSED(s); ARG_UNUSED(in);
 	stub_a_send_calls++;
 	return stub_a_send_rc;
 }
 
 static int stub_b_init(void) { stub_b_init_calls++; return stub_b_init_rc; }
-static int stub_b_send(enum sm_state s, enum sm_type type,
-		       const struct sm_inputs *in)
+static int stub_b_send(enum telemetry_class cls, enum sm_state s,
+		       enum sm_type type, const struct sm_inputs *in)
 {
-	ARG_UNUSED(s); ARG_UNUSED(in);
+	ARG_UNUSED(cls); ARG_UNUSED(s); ARG_UNUSED(in);
 	stub_b_send_calls++;
 	return stub_b_send_rc;
 }
@@ -74,12 +88,39 @@ static const struct telemetry_backend_api stub_b_api = {
 TELEMETRY_BACKEND_DEFINE(stub_a, &stub_a_api);
 TELEMETRY_BACKEND_DEFINE(stub_b, &stub_b_api);
 
+/* Budgeted stub: 100 B/s, so with the default 500 ms burst window its
+ * bucket holds 50 bytes. Charges stub_c_bytes per accepted message
+ * (0 outside the sched suite, so it never throttles other suites).
+ */
+#define STUB_C_BPS 100
+
+static int  stub_c_send_calls;
+static int  stub_c_bytes;
+static enum telemetry_class stub_c_last_cls;
+
+static int stub_c_send(enum telemetry_class cls, enum sm_state s,
+		       enum sm_type type, const struct sm_inputs *in)
+{
+	ARG_UNUSED(s); ARG_UNUSED(in);
+	stub_c_send_calls++;
+	stub_c_last_cls = cls;
+	return stub_c_bytes;
+}
+
+static const struct telemetry_backend_api stub_c_api = {
+	.send_sm_update = stub_c_send,
+};
+
+TELEMETRY_BACKEND_DEFINE_BUDGET(stub_c, &stub_c_api, STUB_C_BPS);
+
 static void stub_reset(void)
 {
 	stub_a_init_calls = 0; stub_a_send_calls = 0;
 	stub_a_init_rc = 0;    stub_a_send_rc = 0;
 	stub_b_init_calls = 0; stub_b_send_calls = 0;
 	stub_b_init_rc = 0;    stub_b_send_rc = 0;
+	stub_c_send_calls = 0; stub_c_bytes = 0;
+	memset(&stub_c_budget, 0, sizeof(stub_c_budget));
 }
 
 /* Minimal valid SM inputs for send_sm_update calls. */
@@ -168,6 +209,316 @@ ZTEST(telemetry_hc12_format, test_buffer_too_small)
 
 ZTEST_SUITE(telemetry_hc12_format, NULL, NULL, NULL, NULL, NULL);
 
+#if defined(CONFIG_AURORA_TELEMETRY_HC12_COMPACT)
+/* ==========================================================
+ *                     COMPACT SUITE
+ * ==========================================================
+ * Decodes the frames the way a ground station would and checks the
+ * reconstructed values, so a drifting delta base fails here.
+ */
+
+static struct hc12_compact_enc compact_enc;
+
+static void compact_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	memset(&compact_enc, 0, sizeof(compact_enc));
+	hc12_compact_reset(&compact_enc);
+}
+
+static size_t compact_frame(uint8_t *buf, size_t sz, uint32_t ts_ms,
+			    double altitude)
+{
+	struct sm_inputs in = DUMMY_INPUTS;
+
+	in.altitude = altitude;
+	return hc12_compact_encode(&compact_enc, buf, sz, 4, ts_ms,
+				   SM_BOOST, SM_TYPE_SIMPLE, &in);
+}
+
+ZTEST(telemetry_hc12_compact, test_key_frame_layout)
+{
+	uint8_t buf[64];
+	struct hc12_sm_key_payload k;
+	size_t n = compact_frame(buf, sizeof(buf), 1000, 123.456);
+
+	/* 4 header + 24 payload + 2 CRC. */
+	zassert_equal(n, 30, "key frame length %zu", n);
+	zassert_equal(buf[2], 0x02, "type=SM_KEY");
+	zassert_equal(buf[3], 24, "payload length byte");
+	zassert_equal(sys_get_le16(&buf[28]),
+		      crc16_ccitt(0xFFFF, &buf[2], 2 + 24), "CRC");
+
+	memcpy(&k, &buf[4], sizeof(k));
+	zassert_equal(k.timestamp_ms, 1000, "timestamp");
+	zassert_equal(k.state, SM_BOOST, "state");
+	zassert_equal(k.armed, 1, "armed");
+	zassert_equal(k.altitude, 12346, "altitude in cm, rounded");
+	zassert_equal(k.acceleration, 981, "acceleration in 0.01 m/s^2");
+	zassert_equal(k.velocity, 125, "velocity in 0.1 m/s");
+	zassert_equal(k.orientation[2], 30, "orientation in 0.01 deg");
+}
+
+ZTEST(telemetry_hc12_compact, test_deltas_between_keys)
+{
+	uint8_t buf[64];
+	int32_t altitude = 0;
+	uint32_t ts = 0;
+
+	for (int i = 0; i < 8; i++) {
+		size_t n = compact_frame(buf, sizeof(buf), 1000 + 100 * i,
+					 50.0 + 3.33 * i);
+
+		if (i % 4 == 0) {
+			struct hc12_sm_key_payload k;
+
+			zassert_equal(buf[2], 0x02, "frame %d is a key", i);
+			memcpy(&k, &buf[4], sizeof(k));
+			altitude = k.altitude;
+			ts = k.timestamp_ms;
+		} else {
+			struct hc12_sm_delta_payload d;
+
+			zassert_equal(n, 24, "delta frame length %zu", n);
+			zassert_equal(buf[2], 0x03, "frame %d is a delta", i);
+			memcpy(&d, &buf[4], sizeof(d));
+			zassert_equal(d.seq, i, "sequence number");
+			zassert_equal(d.state, SM_BOOST | 0x80, "state + armed bit");
+			altitude += d.d_altitude;
+			ts += d.dt_ms;
+		}
+		zassert_equal(ts, 1000 + 100 * i, "reconstructed time");
+		zassert_equal(altitude, lround((50.0 + 3.33 * i) * 100),
+			      "reconstructed altitude at frame %d", i);
+	}
+}
+
+ZTEST(telemetry_hc12_compact, test_large_step_forces_key)
+{
+	uint8_t buf[64];
+
+	(void)compact_frame(buf, sizeof(buf), 1000, 0.0);
+	/* 400 m does not fit an int16 cm delta. */
+	(void)compact_frame(buf, sizeof(buf), 1100, 400.0);
+	zassert_equal(buf[2], 0x02, "altitude jump -> key");
+	/* Neither does a 70 s gap in ms. */
+	(void)compact_frame(buf, sizeof(buf), 71100, 400.0);
+	zassert_equal(buf[2], 0x02, "time gap -> key");
+	(void)compact_frame(buf, sizeof(buf), 71200, 400.0);
+	zassert_equal(buf[2], 0x03, "back to deltas");
+}
+
+ZTEST(telemetry_hc12_compact, test_reset_forces_key)
+{
+	uint8_t buf[64];
+
+	(void)compact_frame(buf, sizeof(buf), 1000, 0.0);
+	(void)compact_frame(buf, sizeof(buf), 1100, 1.0);
+	zassert_equal(buf[2], 0x03, "delta");
+	hc12_compact_reset(&compact_enc);
+	(void)compact_frame(buf, sizeof(buf), 1200, 2.0);
+	zassert_equal(buf[2], 0x02, "key after reset");
+}
+
+ZTEST_SUITE(telemetry_hc12_compact, NULL, NULL, compact_before, NULL, NULL);
+#endif /* CONFIG_AURORA_TELEMETRY_HC12_COMPACT */
+
+#if defined(CONFIG_AURORA_TELEMETRY_HC12_SAMPLES)
+/* ==========================================================
+ *                     SAMPLES SUITE
+ * ==========================================================
+ * Batches of 3-channel records: 3 B record header + 3 * f32 = 15 B,
+ * after the 4 B base timestamp.
+ */
+
+static struct hc12_samples_batch samples_batch;
+
+static const struct sensor_value SAMPLE_CH[3] = {
+	{ .val1 = 1, .val2 = 500000 },
+	{ .val1 = -2, .val2 = -250000 },
+	{ .val1 = 9, .val2 = 810000 },
+};
+
+static void samples_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	hc12_samples_init(&samples_batch, 1, 500);
+}
+
+static size_t add_sample(uint8_t type, uint32_t ts_ms, uint8_t *frame,
+			 size_t sz)
+{
+	return hc12_samples_add(&samples_batch, type,
+				(uint64_t)ts_ms * 1000000ULL, SAMPLE_CH, 3,
+				frame, sz);
+}
+
+ZTEST(telemetry_hc12_samples, test_batch_fills_payload)
+{
+	const int per_batch = (CONFIG_AURORA_TELEMETRY_HC12_SAMPLES_PAYLOAD - 4) / 15;
+	uint8_t frame[300];
+	size_t n = 0;
+	int i;
+
+	for (i = 0; i <= per_batch && n == 0; i++) {
+		n = add_sample(1, 1000 + i, frame, sizeof(frame));
+	}
+	zassert_equal(i, per_batch + 1, "frame closed by the first misfit");
+	zassert_equal(n, 4 + 4 + per_batch * 15 + 2, "frame length %zu", n);
+	zassert_equal(frame[2], 0x04, "type=SAMPLES");
+	zassert_equal(sys_get_le32(&frame[4]), 1000, "base timestamp");
+
+	/* Second record: type 1, 3 channels, 1 ms after base. */
+	const uint8_t *rec = &frame[8 + 15];
+	float v;
+
+	zassert_equal(rec[0], 1 | (3 << 6), "type and channel count");
+	zassert_equal(sys_get_le16(&rec[1]), 1, "dt_ms");
+	memcpy(&v, &rec[3 + 4], sizeof(v));
+	zassert_within(v, -2.25f, 1e-6f, "channel 1 as f32");
+}
+
+ZTEST(telemetry_hc12_samples, test_decimation_per_type)
+{
+	uint8_t frame[300];
+	size_t n;
+
+	hc12_samples_init(&samples_batch, 3, 500);
+	for (int i = 0; i < 6; i++) {
+		(void)add_sample(1, 1000 + i, frame, sizeof(frame));
+		(void)add_sample(2, 1000 + i, frame, sizeof(frame));
+	}
+	/* Close it by age: 2 of 6 kept per type. */
+	n = add_sample(1, 2000, frame, sizeof(frame));
+	zassert_equal(n, 4 + 4 + 4 * 15 + 2, "4 records, got %zu bytes", n);
+}
+
+ZTEST(telemetry_hc12_samples, test_batch_closed_by_age)
+{
+	uint8_t frame[300];
+
+	zassert_equal(add_sample(1, 1000, frame, sizeof(frame)), 0, "batching");
+	zassert_equal(add_sample(1, 1499, frame, sizeof(frame)), 0, "young");
+	zassert_equal(add_sample(1, 1500, frame, sizeof(frame)),
+		      4 + 4 + 2 * 15 + 2, "aged batch closed");
+}
+
+ZTEST_SUITE(telemetry_hc12_samples, NULL, NULL, samples_before, NULL, NULL);
+#endif /* CONFIG_AURORA_TELEMETRY_HC12_SAMPLES */
+
+#if defined(CONFIG_AURORA_TELEMETRY_CANFD)
+/* ==========================================================
+ *                     CAN-FD SUITE
+ * ==========================================================
+ * IMU records are 2 B dt_us + 6 * i32 = 26 B, baro records 10 B,
+ * after the 12 B header; frames are always 64 B.
+ */
+
+static struct canfd_batch canfd_batch;
+static aurora_sample_t canfd_seen[CANFD_IMU_CHANNELS];
+static uint64_t canfd_seen_ts[8];
+static int canfd_seen_count;
+
+static const aurora_sample_t CANFD_CH[CANFD_IMU_CHANNELS] = {
+	9810000, -2250000, 1, 101325000, -1000000, -999999,
+};
+
+static void canfd_collect(uint64_t timestamp_ns, const aurora_sample_t *ch,
+			  void *user_data)
+{
+	ARG_UNUSED(user_data);
+	memcpy(canfd_seen, ch, sizeof(canfd_seen));
+	canfd_seen_ts[canfd_seen_count++ % ARRAY_SIZE(canfd_seen_ts)] =
+		timestamp_ns;
+}
+
+static void canfd_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	canfd_batch_init(&canfd_batch, CANFD_IMU_CHANNELS, 1);
+	canfd_seen_count = 0;
+}
+
+ZTEST(telemetry_canfd, test_imu_frame_holds_two_records)
+{
+	uint8_t frame[CANFD_FRAME_LEN];
+
+	zassert_equal(canfd_batch_add(&canfd_batch, 5000000, CANFD_CH, frame),
+		      0, "batching");
+	zassert_equal(canfd_batch_add(&canfd_batch, 6000000, CANFD_CH, frame),
+		      CANFD_FRAME_LEN, "second record fills the frame");
+	zassert_equal(sys_get_le64(&frame[0]), 5000000, "base timestamp");
+	zassert_equal(frame[8], 2, "record count");
+	zassert_equal(sys_get_le16(&frame[12 + 26]), 1000, "dt_us");
+	zassert_equal((int32_t)sys_get_le32(&frame[12 + 2 + 4]), -2250000,
+		      "channel 1 in millionths");
+
+	zassert_equal(canfd_samples_decode(frame, CANFD_IMU_CHANNELS,
+					   canfd_collect, NULL), 2, NULL);
+	zassert_equal(canfd_seen_ts[1], 6000000, "record timestamp");
+	zassert_mem_equal(canfd_seen, CANFD_CH, sizeof(CANFD_CH),
+			  "samples are lossless");
+}
+
+ZTEST(telemetry_canfd, test_gap_closes_batch)
+{
+	uint8_t frame[CANFD_FRAME_LEN];
+
+	canfd_batch_init(&canfd_batch, CANFD_BARO_CHANNELS, 2);
+	zassert_equal(canfd_batch_add(&canfd_batch, 0, CANFD_CH, frame), 0,
+		      NULL);
+	zassert_equal(canfd_batch_add(&canfd_batch, 1000, CANFD_CH, frame), 0,
+		      "decimated");
+	zassert_equal(canfd_batch_add(&canfd_batch, 100000000, CANFD_CH,
+				      frame),
+		      CANFD_FRAME_LEN, "more than 65535 us later");
+	zassert_equal(frame[8], 1, "only the first sample was kept");
+	zassert_equal(frame[12 + 10], 0, "tail is zeroed");
+}
+
+ZTEST(telemetry_canfd, test_bad_count_rejected)
+{
+	uint8_t frame[CANFD_FRAME_LEN] = { 0 };
+
+	frame[8] = 3;
+	zassert_equal(canfd_samples_decode(frame, CANFD_IMU_CHANNELS,
+					   canfd_collect, NULL), -EINVAL, NULL);
+	zassert_equal(canfd_seen_count, 0, NULL);
+}
+
+ZBUS_SUBSCRIBER_DEFINE(canfd_remote_sub, 4);
+ZBUS_CHAN_ADD_OBS(remote_sm_chan, canfd_remote_sub, 1);
+
+/* The controller runs in loopback mode, so our own snapshot comes back
+ * through the RX filter and lands on remote_sm_chan. Frames queued by the
+ * other suites loop back as well, so wait for the one sent here.
+ */
+ZTEST(telemetry_canfd, test_loopback_sm_republished)
+{
+	const struct zbus_channel *chan;
+	struct telemetry_remote_sm msg = { 0 };
+
+	zassert_ok(telemetry_init(), NULL);
+	clear_rate_window();
+	/* The stub backends may still be set up to fail by another suite. */
+	(void)telemetry_send_sm_class(TELEMETRY_CLASS_EVENT, SM_BOOST,
+				      sm_get_type(), &DUMMY_INPUTS);
+
+	while (msg.state != SM_BOOST) {
+		zassert_ok(zbus_sub_wait(&canfd_remote_sub, &chan, K_SECONDS(1)),
+			   "snapshot did not come back");
+		zassert_equal_ptr(chan, &remote_sm_chan, NULL);
+		zassert_ok(zbus_chan_read(&remote_sm_chan, &msg, K_NO_WAIT),
+			   NULL);
+	}
+	zassert_equal(msg.node, CONFIG_AURORA_TELEMETRY_CANFD_NODE_ID, NULL);
+	zassert_equal(msg.type, sm_get_type(), NULL);
+	zassert_equal(msg.inputs.altitude, DUMMY_INPUTS.altitude, NULL);
+}
+
+ZTEST_SUITE(telemetry_canfd, NULL, NULL, canfd_before, NULL, NULL);
+#endif /* CONFIG_AURORA_TELEMETRY_CANFD */
+
 /* ==========================================================
  *                     RATE LIMITER SUITE
  * ==========================================================
@@ -311,3 +662,102 @@ ZTEST(telemetry_dispatch, test_send_surfaces_first_error)
 }
 
 ZTEST_SUITE(telemetry_dispatch, NULL, NULL, dispatch_before, NULL, NULL);
+
+/* ==========================================================
+ *                     SCHEDULER SUITE
+ * ==========================================================
+ * Class selection and the token bucket of the budgeted stub_c.
+ * Counts calls instead of checking the aggregated rc, which the
+ * HC-12 rate limiter may also set.
+ */
+
+static void sched_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	stub_reset();
+	clear_rate_window();
+}
+
+ZTEST(telemetry_sched, test_invalid_class_rejected)
+{
+	zassert_equal(telemetry_send_sm_class(TELEMETRY_CLASS_COUNT, SM_IDLE,
+					      sm_get_type(), &DUMMY_INPUTS),
+		      -EINVAL, "class out of range");
+	zassert_equal(stub_c_send_calls, 0, "no backend called");
+}
+
+ZTEST(telemetry_sched, test_state_change_is_transition)
+{
+	(void)telemetry_send_sm_update(SM_IDLE, sm_get_type(), &DUMMY_INPUTS);
+	(void)telemetry_send_sm_update(SM_IDLE, sm_get_type(), &DUMMY_INPUTS);
+	zassert_equal(stub_c_last_cls, TELEMETRY_CLASS_KINEMATICS,
+		      "same state is routine");
+
+	(void)telemetry_send_sm_update(SM_ARMED, sm_get_type(), &DUMMY_INPUTS);
+	zassert_equal(stub_c_last_cls, TELEMETRY_CLASS_TRANSITION,
+		      "state change is a transition");
+}
+
+/**
+ * @brief HC-12 MIN_INTERVAL never holds back a transition.
+ */
+ZTEST(telemetry_sched, test_transition_bypasses_rate_limit)
+{
+	(void)telemetry_init();
+	stub_reset();
+
+	(void)telemetry_send_sm_update(SM_IDLE, sm_get_type(), &DUMMY_INPUTS);
+	zassert_equal(telemetry_send_sm_update(SM_ARMED, sm_get_type(),
+					       &DUMMY_INPUTS),
+		      0, "transition inside the rate window still sent");
+	zassert_equal(telemetry_send_sm_update(SM_ARMED, sm_get_type(),
+					       &DUMMY_INPUTS),
+		      -EAGAIN, "routine update inside the window dropped");
+	zassert_equal(telemetry_send_sm_update(SM_IDLE, sm_get_type(),
+					       &DUMMY_INPUTS),
+		      0, "next transition sent");
+}
+
+ZTEST(telemetry_sched, test_budget_holds_back_routine)
+{
+	stub_c_bytes = 60;
+
+	(void)telemetry_send_sm_class(TELEMETRY_CLASS_KINEMATICS, SM_BOOST,
+				      sm_get_type(), &DUMMY_INPUTS);
+	zassert_equal(stub_c_send_calls, 1, "full bucket admits kinematics");
+
+	(void)telemetry_send_sm_class(TELEMETRY_CLASS_KINEMATICS, SM_BOOST,
+				      sm_get_type(), &DUMMY_INPUTS);
+	zassert_equal(stub_c_send_calls, 1, "empty bucket holds kinematics");
+
+	(void)telemetry_send_sm_class(TELEMETRY_CLASS_TRANSITION, SM_BURNOUT,
+				      sm_get_type(), &DUMMY_INPUTS);
+	(void)telemetry_send_sm_class(TELEMETRY_CLASS_EVENT, SM_BURNOUT,
+				      sm_get_type(), &DUMMY_INPUTS);
+	zassert_equal(stub_c_send_calls, 3, "urgent classes overdraw");
+
+	(void)telemetry_send_sm_class(TELEMETRY_CLASS_HEALTH, SM_BURNOUT,
+				      sm_get_type(), &DUMMY_INPUTS);
+	zassert_equal(stub_c_send_calls, 3, "no spare budget for health");
+}
+
+ZTEST(telemetry_sched, test_budget_refills)
+{
+	stub_c_bytes = 60;
+
+	(void)telemetry_send_sm_class(TELEMETRY_CLASS_TRANSITION, SM_APOGEE,
+				      sm_get_type(), &DUMMY_INPUTS);
+	(void)telemetry_send_sm_class(TELEMETRY_CLASS_TRANSITION, SM_APOGEE,
+				      sm_get_type(), &DUMMY_INPUTS);
+	(void)telemetry_send_sm_class(TELEMETRY_CLASS_KINEMATICS, SM_APOGEE,
+				      sm_get_type(), &DUMMY_INPUTS);
+	zassert_equal(stub_c_send_calls, 2, "bucket in debt");
+
+	/* Debt is capped at one bucket (-50 B); 1 s at 100 B/s refills it. */
+	k_msleep(1000);
+	(void)telemetry_send_sm_class(TELEMETRY_CLASS_HEALTH, SM_APOGEE,
+				      sm_get_type(), &DUMMY_INPUTS);
+	zassert_equal(stub_c_send_calls, 3, "refilled bucket admits health");
+}
+
+ZTEST_SUITE(telemetry_sched, NULL, NULL, sched_before, NULL, NULL);
@@ -0,0 +1,455 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Auxspace e.V.
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Decode a raw aurora_bin flight-log dump into columnar arrays.
+
+The input is a byte-for-byte image of the flight-log region (a flash
+partition read back with a debugger, or the raw region of an SD card,
+e.g. ``dd if=/dev/sdX of=flight.bin``) or a stream saved by
+``aurora_export.py --save``. The file is memory-mapped and never read
+into Python objects frame by frame:
+
+* The frame headers are viewed in place as one strided numpy array.
+* The window start is picked like ``find_window_start()`` in
+  lib/data/convert.c: the highest ``flight_id``, then the lowest ``seq``
+  within that flight. Use ``--flight-id`` to pick another flight.
+* The ring is walked in ``seq`` order, wrapping at its end, until the
+  first frame that does not continue it.
+* Fixed (v2) and columnar (v4) frames are decoded with whole-array numpy
+  operations, a chunk of frames at a time. Packed (v3) frames are
+  varint streams and fall back to the per-frame decoder in
+  aurora_export.py.
+
+The output is one table per record type, with ``t_ns`` plus one float64
+column per field named like ``fmt_influx.c`` names it. It is written as
+``.npz`` (default), or with pyarrow installed as one Parquet or Arrow
+IPC file per type:
+
+    tools/aurora_bin.py flight.bin                      # flight.npz
+    tools/aurora_bin.py flight.bin -o out --format parquet
+    tools/aurora_bin.py sdcard.img --list
+
+As a library:
+
+    with aurora_bin.Dump("flight.bin") as dump:
+        tables = aurora_bin.columns(dump.decode(dump.walk()))
+    t, z = tables["accel"]["t_ns"], tables["accel"]["z"]
+"""
+
+import argparse
+import mmap
+import sys
+import time
+import zlib
+from pathlib import Path
+
+import numpy as np
+
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+import aurora_export as ax  # noqa: E402
+
+HDR = np.dtype([
+    ("magic", "S4"),
+    ("version", "<u2"),
+    ("flags", "<u2"),
+    ("seq", "<u4"),
+    ("flight_id", "<u8"),
+    ("base_ts_ns", "<u8"),
+    ("tag", "<u4"),
+])
+REC = np.dtype([
+    ("type", "u1"),
+    ("count", "u1"),
+    ("reserved", "<u2"),
+    ("ts_us", "<u4"),
+    ("ch", "<i4", (ax.DP_MAX_CHANNELS, 2)),
+])
+assert HDR.itemsize == ax.FRAME_HDR.size
+assert REC.itemsize == ax.FIXED_REC.size
+
+FRAME_MAGIC = np.bytes_(ax.FRAME_MAGIC)
+INDEX_MAGIC = np.bytes_(b"AIDX")
+VERSIONS = (ax.VERSION_FIXED, ax.VERSION_PACKED, ax.VERSION_COLUMNAR)
+
+# Frame sizes tried when none is given, as in sensor_board/src/replay_file.c.
+FRAME_SIZES = [64 << i for i in range(11)]
+# Headers looked at per candidate frame size while detecting it.
+DETECT_SLOTS = 4096
+# Frames copied out of the map and decoded per step.
+CHUNK_BYTES = 64 << 20
+
+
+class DecodeError(Exception):
+    pass
+
+
+def _follows(h, flight_id, seq0):
+    """Whether header row i of @p h is frame seq0 + i of @p flight_id."""
+    seq = (np.uint64(seq0) + np.arange(len(h), dtype=np.uint64)) & 0xFFFFFFFF
+    return ((h["magic"] == FRAME_MAGIC) &
+            np.isin(h["version"], VERSIONS) &
+            (h["flight_id"] == np.uint64(flight_id)) &
+            (h["seq"].astype(np.uint64) == seq))
+
+
+class Dump:
+    """A memory-mapped flight-log region (or saved export stream)."""
+
+    def __init__(self, path, frame_size=None, ring_frames=None):
+        self.path = Path(path)
+        self._file = open(self.path, "rb")
+        try:
+            self._map = mmap.mmap(self._file.fileno(), 0,
+                                  access=mmap.ACCESS_READ)
+        except ValueError:
+            self._file.close()
+            raise DecodeError(f"{self.path}: empty file")
+
+        self.offset = 0
+        end = len(self._map)
+        if self._map[:len(ax.EXPORT_MAGIC)] == ax.EXPORT_MAGIC:
+            _, version, _, size = ax.EXPORT_HDR.unpack_from(self._map)
+            if version != ax.EXPORT_VERSION:
+                raise DecodeError(f"unsupported export version {version}")
+            self.offset = ax.EXPORT_HDR.size
+            end -= ax.EXPORT_TRAILER.size
+            frame_size = frame_size or size
+
+        self.frame_size = frame_size or self._detect_frame_size(end)
+        self.slots = (end - self.offset) // self.frame_size
+        if self.slots == 0:
+            raise DecodeError(f"{self.path}: shorter than one frame")
+
+        self.headers = np.ndarray((self.slots,), HDR, buffer=self._map,
+                                  offset=self.offset,
+                                  strides=(self.frame_size,))
+        self._frames = np.ndarray((self.slots, self.frame_size), np.uint8,
+                                  buffer=self._map, offset=self.offset)
+
+        # With CONFIG_DATA_LOGGER_BIN_INDEX the ring ends at the index slot.
+        index = np.flatnonzero(self.headers["magic"] == INDEX_MAGIC)
+        self.ring_frames = ring_frames or (int(index[0]) if index.size
+                                           else self.slots)
+        self.ring_frames = min(self.ring_frames, self.slots)
+
+    def _detect_frame_size(self, end):
+        """Smallest frame size at which two neighbouring slots hold
+        consecutive frames of one flight."""
+        for fs in FRAME_SIZES:
+            n = min((end - self.offset) // fs, DETECT_SLOTS)
+            if n < 2:
+                break
+            h = np.ndarray((n,), HDR, buffer=self._map, offset=self.offset,
+                           strides=(fs,))
+            ok = h["magic"] == FRAME_MAGIC
+            pair = (ok[:-1] & ok[1:] &
+                    (h["flight_id"][:-1] == h["flight_id"][1:]) &
+                    (h["seq"][1:] == h["seq"][:-1] + np.uint32(1)))
+            if pair.any():
+                return fs
+        raise DecodeError(f"{self.path}: cannot tell the frame size, "
+                          "pass --frame-size")
+
+    def close(self):
+        self.headers = self._frames = None
+        try:
+            self._map.close()
+        except BufferError:
+            pass  # a caller still holds a view; unmapped once it is gone
+        self._file.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    def _valid(self):
+        h = self.headers[:self.ring_frames]
+        return h, (h["magic"] == FRAME_MAGIC) & np.isin(h["version"],
+                                                        VERSIONS)
+
+    def flights(self):
+        """``(flight_id, frames on storage, first slot, lowest seq)`` for
+        every flight with a frame in the ring, oldest first."""
+        h, valid = self._valid()
+        slots = np.flatnonzero(valid)
+        out = []
+        for fid in np.unique(h["flight_id"][slots]):
+            mine = slots[h["flight_id"][slots] == fid]
+            first = mine[np.argmin(h["seq"][mine])]
+            out.append((int(fid), int(mine.size), int(first),
+                        int(h["seq"][first])))
+        return out
+
+    def window_start(self, flight_id=None):
+        """``(slot, seq, flight_id)`` the walk starts at, like
+        find_window_start(); the newest flight unless @p flight_id."""
+        h, valid = self._valid()
+        if flight_id is None:
+            if not valid.any():
+                raise DecodeError(f"{self.path}: no frames")
+            flight_id = int(h["flight_id"][valid].max())
+        mine = np.flatnonzero(valid & (h["flight_id"] == np.uint64(flight_id)))
+        if mine.size == 0:
+            raise DecodeError(f"{self.path}: no frames of flight "
+                              f"{flight_id}")
+        start = mine[np.argmin(h["seq"][mine])]
+        return int(start), int(h["seq"][start]), flight_id
+
+    def walk(self, flight_id=None):
+        """Slots of one flight in seq order, as convert_run() visits them."""
+        start, seq0, flight_id = self.window_start(flight_id)
+        order = (start + np.arange(self.ring_frames)) % self.ring_frames
+        follows = _follows(self.headers[order], flight_id, seq0)
+        n = self.ring_frames if follows.all() else int(np.argmin(follows))
+        return order[:n]
+
+    def decode(self, slots, crc=True):
+        """Decode the frames in @p slots, in that order.
+
+        Returns ``{type name: (t_ns, raw)}`` with ``t_ns`` a uint64 array and
+        ``raw`` an int32 array of shape (n, DP_MAX_CHANNELS, 2) holding
+        each channel's sensor_value val1/val2.
+        """
+        parts = {i: [] for i in range(len(ax.TYPES))}
+        step = max(1, CHUNK_BYTES // self.frame_size)
+        dropped = 0
+        for lo in range(0, len(slots), step):
+            chunk = slots[lo:lo + step]
+            dropped += _decode_chunk(self._frames[chunk],
+                                     self.headers[chunk], lo, crc, parts)
+        if dropped:
+            print(f"warning: {dropped} frames failed their CRC or carried "
+                  "bad records, skipped", file=sys.stderr)
+
+        out = {}
+        for type_id, chunks in parts.items():
+            if not chunks:
+                continue
+            pos = np.concatenate([c[0] for c in chunks])
+            order = np.argsort(pos, kind="stable")
+            t = np.concatenate([c[1] for c in chunks])[order]
+            raw = np.concatenate([c[2] for c in chunks])[order]
+            out[ax.TYPES[type_id][0]] = (t, raw)
+        return out
+
+
+def _crc_ok(frame):
+    """bin_codec_crc_ok() on one frame row."""
+    end = len(frame) - ax.CRC_SIZE
+    crc = zlib.crc32(frame[HDR.itemsize:end])
+    crc = zlib.crc32(frame[:HDR.itemsize], crc)
+    return crc == int(frame[end:].view("<u4")[0])
+
+
+def _emit(parts, type_id, pos, t, raw):
+    if t.size:
+        parts[type_id].append((pos, t, raw))
+
+
+def _decode_chunk(frames, hdr, pos0, crc, parts):
+    """Decode one chunk of frames into @p parts; returns frames dropped."""
+    pos = pos0 + np.arange(len(hdr))
+    flagged = (hdr["flags"] & ax.FLAG_CRC) != 0
+    keep = np.ones(len(hdr), dtype=bool)
+    if crc:
+        for i in np.flatnonzero(flagged):
+            keep[i] = _crc_ok(frames[i])
+    dropped = int((~keep).sum())
+
+    base = hdr["base_ts_ns"]
+    fs = frames.shape[1]
+    for trailer in (False, True):
+        end = fs - (ax.CRC_SIZE if trailer else 0)
+        rows = keep & (flagged == trailer)
+
+        fixed = np.flatnonzero(rows & (hdr["version"] == ax.VERSION_FIXED))
+        if fixed.size:
+            _decode_fixed(frames[fixed], base[fixed], pos[fixed], end, parts)
+
+        col = rows & (hdr["version"] == ax.VERSION_COLUMNAR)
+        tag = hdr["tag"]
+        channels = (tag >> 8) & 0xFF
+        bad = col & (((tag & 0xFF) >= len(ax.TYPES)) |
+                     (channels > ax.DP_MAX_CHANNELS))
+        dropped += int(bad.sum())
+        for ch in range(ax.DP_MAX_CHANNELS + 1):
+            sel = np.flatnonzero(col & ~bad & (channels == ch))
+            if sel.size:
+                _decode_columnar(frames[sel], base[sel], pos[sel], tag[sel],
+                                 ch, end, parts)
+
+        for i in np.flatnonzero(rows & (hdr["version"] ==
+                                        ax.VERSION_PACKED)):
+            samples = ax.decode_packed(frames[i, :end].tobytes(),
+                                       int(base[i]))
+            by_type = {}
+            try:
+                for type_id, vals, ts in samples:
+                    by_type.setdefault(type_id, ([], []))
+                    by_type[type_id][0].append(ts)
+                    by_type[type_id][1].append(
+                        vals + [(0, 0)] * (ax.DP_MAX_CHANNELS - len(vals)))
+            except ax.ExportError:
+                dropped += 1
+                continue
+            for type_id, (ts, vals) in by_type.items():
+                _emit(parts, type_id, np.full(len(ts), pos[i]),
+                      np.array(ts, dtype=np.uint64),
+                      np.array(vals, dtype=np.int32))
+    return dropped
+
+
+def _decode_fixed(frames, base, pos, end, parts):
+    k = (end - HDR.itemsize) // REC.itemsize
+    recs = np.ascontiguousarray(
+        frames[:, HDR.itemsize:HDR.itemsize + k * REC.itemsize]).view(REC)
+    types = recs["type"]
+    # Records end at the first end-of-frame tag.
+    live = np.cumprod(types != ax.TAG_END, axis=1).astype(bool)
+    t = base[:, None] + recs["ts_us"].astype(np.uint64) * np.uint64(1000)
+    fpos = np.broadcast_to(pos[:, None], types.shape)
+    for type_id in np.unique(types[live]):
+        if type_id >= len(ax.TYPES):
+            continue
+        sel = live & (types == type_id)
+        _emit(parts, int(type_id), fpos[sel], t[sel], recs["ch"][sel])
+
+
+def _decode_columnar(frames, base, pos, tag, ch, end, parts):
+    cap = (end - HDR.itemsize) // (4 * (1 + 2 * ch))
+    cols = np.ascontiguousarray(
+        frames[:, HDR.itemsize:HDR.itemsize + cap * 4 * (1 + 2 * ch)]
+    ).view("<u4").reshape(len(frames), 1 + 2 * ch, cap)
+    count = np.minimum(tag >> 16, cap)
+    live = np.arange(cap)[None, :] < count[:, None]
+    t = base[:, None] + cols[:, 0, :].astype(np.uint64) * np.uint64(1000)
+    # (frame, record, channel, val1/val2), padded to DP_MAX_CHANNELS.
+    raw = np.zeros((len(frames), cap, ax.DP_MAX_CHANNELS, 2), dtype=np.int32)
+    raw[:, :, :ch, :] = cols[:, 1:, :].view("<i4").reshape(
+        len(frames), ch, 2, cap).transpose(0, 3, 1, 2)
+    fpos = np.broadcast_to(pos[:, None], live.shape)
+    types = tag & 0xFF
+    for type_id in np.unique(types):
+        rows = types == type_id
+        sel = live & rows[:, None]
+        _emit(parts, int(type_id), fpos[sel], t[sel], raw[sel])
+
+
+def columns(decoded):
+    """Turn decode() output into ``{type: {"t_ns": ..., field: float64}}``
+    (val1 + val2 / 1e6 per field).  Audit records have no fields and are
+    left out; see audit_lines()."""
+    out = {}
+    for name, (t, raw) in decoded.items():
+        fields = dict(ax.TYPES)[name]
+        if not fields:
+            continue
+        table = {"t_ns": t}
+        for c, field in enumerate(fields):
+            table[field] = raw[:, c, 0] + raw[:, c, 1] * 1e-6
+        out[name] = table
+    return out
+
+
+def audit_lines(decoded):
+    """The state machine audit trail, as aurora_export.py writes it."""
+    name = ax.TYPES[ax.AUDIT_TYPE][0]
+    if name not in decoded:
+        return iter(())
+    t, raw = decoded[name]
+    samples = ((ax.AUDIT_TYPE, [tuple(int(x) for x in c) for c in r], int(ts))
+               for ts, r in zip(t, raw))
+    return ax.audit_lines(samples)
+
+
+def write_tables(tables, out, fmt):
+    if fmt == "npz":
+        np.savez(out, **{f"{name}.{field}": arr
+                         for name, table in tables.items()
+                         for field, arr in table.items()})
+        return
+    try:
+        import pyarrow as pa
+        import pyarrow.feather as feather
+        import pyarrow.parquet as pq
+    except ImportError:
+        raise DecodeError(f"--format {fmt} needs pyarrow")
+    out.mkdir(parents=True, exist_ok=True)
+    for name, table in tables.items():
+        tab = pa.table(table)
+        if fmt == "parquet":
+            pq.write_table(tab, out / f"{name}.parquet")
+        else:
+            feather.write_feather(tab, out / f"{name}.arrow")
+
+
+def main():
+    ap = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("input", type=Path,
+                    help="Raw flight-log region dump or saved export stream")
+    ap.add_argument("-o", "--output", type=Path, default=None,
+                    help="Output file (npz) or directory (parquet, arrow); "
+                    "default: next to the input")
+    ap.add_argument("--format", choices=("npz", "parquet", "arrow"),
+                    default="npz", help="Output format (default: npz)")
+    ap.add_argument("--frame-size", type=int, default=None,
+                    help="CONFIG_DATA_LOGGER_BIN_FRAME_SIZE (default: detected)")
+    ap.add_argument("--ring-frames", type=int, default=None,
+                    help="Frames in the ring (default: up to the index slot, "
+                    "or the whole dump)")
+    ap.add_argument("--flight-id", type=int, default=None,
+                    help="Flight to decode (default: the newest)")
+    ap.add_argument("--list", action="store_true",
+                    help="List the flights on the dump and exit")
+    ap.add_argument("--no-crc", action="store_true",
+                    help="Do not check frame CRC trailers")
+    ap.add_argument("--audit", type=Path, default=None,
+                    help="Also write the state machine audit trail here")
+    args = ap.parse_args()
+
+    try:
+        with Dump(args.input, args.frame_size, args.ring_frames) as dump:
+            if args.list:
+                print(f"{dump.slots} slots of {dump.frame_size} B, "
+                      f"ring of {dump.ring_frames}")
+                for fid, frames, slot, seq in dump.flights():
+                    print(f"flight {fid}: {frames} frames, seq {seq} "
+                          f"at slot {slot}")
+                return
+
+            t0 = time.monotonic()
+            slots = dump.walk(args.flight_id)
+            decoded = dump.decode(slots, crc=not args.no_crc)
+            tables = columns(decoded)
+            elapsed = time.monotonic() - t0
+
+            if args.audit is not None:
+                with open(args.audit, "w") as f:
+                    f.writelines(audit_lines(decoded))
+            out = args.output
+            if out is None and args.format == "npz":
+                out = args.input.with_suffix(".npz")
+            elif out is None:
+                out = args.input.with_name(
+                    f"{args.input.stem}_{args.format}")
+            write_tables(tables, out, args.format)
+    except DecodeError as e:
+        print(f"error: {e}", file=sys.stderr)
+        sys.exit(1)
+
+    total = sum(len(tab["t_ns"]) for tab in tables.values())
+    print(f"decoded {len(slots)} frames, {total} samples in "
+          f"{elapsed:.2f} s", file=sys.stderr)
+    for name, tab in tables.items():
+        print(f"  {name}: {len(tab['t_ns'])}", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,386 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Auxspace e.V.
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Receive and decode a raw flight-log export from the flight computer.
+
+`data_logger export` (CONFIG_DATA_LOGGER_EXPORT) streams the newest
+flight's binary frames unconverted over the auxspace,data-export port,
+usually a second USB CDC ACM interface. Start this tool on that port
+first, then run the shell command:
+
+    tools/aurora_export.py /dev/ttyACM1 -o flight.influx --save flight.aexp
+    uart:~$ data_logger export
+
+Stream layout (see "Raw export stream" in aurora/lib/data_logger.h):
+
+    header   "AEXP" u16 version, u16 reserved, u32 frame_size
+    frames   frame_size bytes each, back to back
+    trailer  "AEXE" u32 frames, u32 crc32 over all frame bytes
+
+Every frame is decoded by its own header version (fixed v2, packed v3 or
+columnar v4), exactly as lib/data/convert.c does on the board. Frames
+carrying a CRC trailer (CONFIG_DATA_LOGGER_BIN_CRC) are checked first and
+skipped if it does not match. The output
+is InfluxDB line protocol by default, or CSV with --csv (grouped the same
+way as influx_to_csv.py). State machine audit records are left out of
+both and, with --audit, written as a text trail like FLIGHT_<n>.audit.
+Thread health records go to the line protocol output only, tagged with
+their thread name.
+A saved stream (--save, or any file) can be
+decoded again later by passing it as the input.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+import influx_to_csv  # noqa: E402
+
+EXPORT_MAGIC = b"AEXP"
+EXPORT_END_MAGIC = b"AEXE"
+EXPORT_VERSION = 1
+EXPORT_HDR = struct.Struct("<4sHHI")
+EXPORT_TRAILER = struct.Struct("<4sII")
+
+FRAME_MAGIC = b"AURF"
+FRAME_HDR = struct.Struct("<4sHHIQQI")
+VERSION_FIXED = 2
+VERSION_PACKED = 3
+VERSION_COLUMNAR = 4
+FLAG_CRC = 0x0001
+CRC_SIZE = 4
+
+DP_MAX_CHANNELS = 3
+FIXED_REC = struct.Struct("<BBHI" + "ii" * DP_MAX_CHANNELS)
+TAG_END = 0xFF
+
+# enum aurora_data order and the field names fmt_influx.c emits.
+TYPES = [
+        ("baro", ["temp", "pres"]),
+        ("accel", ["x", "y", "z"]),
+        ("gyro", ["x", "y", "z"]),
+        ("mag", ["x", "y", "z"]),
+        ("sm_kinematics", ["accel", "accel_vert"]),
+        ("sm_pose", ["velocity", "altitude"]),
+        ("orientation", ["yaw", "pitch", "roll"]),
+        ("vbat", ["voltage"]),
+        ("sm_audit", []),
+        ("pyro_fire", ["channel", "latency_ms", "delay_ms"]),
+        ("thread_health", []),
+]
+AUDIT_TYPE = 8
+HEALTH_TYPE = 10
+
+# enum sm_state order (sm_state_str() names) for the audit trail.
+SM_STATES = ["IDLE", "ARMED", "BOOST", "BURNOUT", "APOGEE", "MAIN",
+             "REDUNDANT", "LANDED", "ERROR"]
+AUDIT_TEXT_PER_RECORD = 16
+
+
+class ExportError(Exception):
+        pass
+
+
+def sensor_value_str(val1, val2):
+        """Same text as fmt_num_sensor_value(): "%d.%06d", sign shared."""
+        sign = "-" if val1 < 0 or val2 < 0 else ""
+        return f"{sign}{abs(val1)}.{abs(val2):06d}"
+
+
+def field_name(type_id, channel):
+        names = TYPES[type_id][1]
+        return names[channel] if channel < len(names) else "unknown"
+
+
+def unzigzag(v):
+        return (v >> 1) ^ -(v & 1)
+
+
+def get_varint(buf, off):
+        v = 0
+        for i in range(10):
+                if off + i >= len(buf):
+                        break
+                b = buf[off + i]
+                v |= (b & 0x7F) << (7 * i)
+                if not b & 0x80:
+                        return v, off + i + 1
+        raise ExportError("truncated varint")
+
+
+def wrap_i32(v):
+        return (v + 0x80000000) % 0x100000000 - 0x80000000
+
+
+def decode_fixed(frame, base_ts):
+        for off in range(FRAME_HDR.size, len(frame) - FIXED_REC.size + 1,
+                         FIXED_REC.size):
+                rec = FIXED_REC.unpack_from(frame, off)
+                type_id, count, _, ts_us = rec[:4]
+                if type_id == TAG_END:
+                        return
+                if type_id >= len(TYPES):
+                        raise ExportError(f"bad record type {type_id}")
+                count = min(count, DP_MAX_CHANNELS)
+                vals = [(rec[4 + 2 * c], rec[5 + 2 * c]) for c in range(count)]
+                yield type_id, vals, base_ts + ts_us * 1000
+
+
+def decode_packed(frame, base_ts):
+        prev_ts = 0
+        prev = [[[0, 0] for _ in range(DP_MAX_CHANNELS)] for _ in TYPES]
+        off = FRAME_HDR.size
+        while off < len(frame) and frame[off] != TAG_END:
+                tag = frame[off]
+                type_id, count = tag & 0x3F, tag >> 6
+                if type_id >= len(TYPES):
+                        raise ExportError(f"bad record type {type_id}")
+                raw, off = get_varint(frame, off + 1)
+                prev_ts = (prev_ts + unzigzag(raw)) & 0xFFFFFFFF
+                vals = []
+                for c in range(count):
+                        for k in range(2):
+                                raw, off = get_varint(frame, off)
+                                prev[type_id][c][k] = wrap_i32(
+                                        prev[type_id][c][k] + unzigzag(raw))
+                        vals.append(tuple(prev[type_id][c]))
+                yield type_id, vals, base_ts + prev_ts * 1000
+
+
+def decode_columnar(frame, base_ts, tag):
+        type_id, channels, count = tag & 0xFF, (tag >> 8) & 0xFF, tag >> 16
+        if type_id >= len(TYPES) or channels > DP_MAX_CHANNELS:
+                raise ExportError(f"bad columnar tag {tag:#x}")
+        cap = (len(frame) - FRAME_HDR.size) // (4 * (1 + 2 * channels))
+        count = min(count, cap)
+
+        def column(col, fmt):
+                off = FRAME_HDR.size + col * cap * 4
+                return struct.unpack_from(f"<{count}{fmt}", frame, off)
+
+        ts = column(0, "I")
+        cols = [column(1 + c, "i") for c in range(2 * channels)]
+        for i in range(count):
+                vals = [(cols[2 * c][i], cols[2 * c + 1][i])
+                        for c in range(channels)]
+                yield type_id, vals, base_ts + ts[i] * 1000
+
+
+def frame_crc_ok(frame):
+        """Same sum as bin_codec_crc_ok(): payload up to the trailer, then
+        the header."""
+        end = len(frame) - CRC_SIZE
+        crc = zlib.crc32(frame[FRAME_HDR.size:end])
+        crc = zlib.crc32(frame[:FRAME_HDR.size], crc)
+        return crc == struct.unpack_from("<I", frame, end)[0]
+
+
+def decode_frame(frame):
+        magic, version, flags, seq, flight_id, base_ts, tag = \
+                FRAME_HDR.unpack_from(frame)
+        if magic != FRAME_MAGIC:
+                raise ExportError(f"bad frame magic {magic!r}")
+        if flags & FLAG_CRC:
+                if not frame_crc_ok(frame):
+                        print(f"warning: CRC mismatch in frame {seq}, "
+                              "skipped", file=sys.stderr)
+                        return iter(())
+                frame = frame[:len(frame) - CRC_SIZE]
+        if version == VERSION_FIXED:
+                return decode_fixed(frame, base_ts)
+        if version == VERSION_PACKED:
+                return decode_packed(frame, base_ts)
+        if version == VERSION_COLUMNAR:
+                return decode_columnar(frame, base_ts, tag)
+        raise ExportError(f"unsupported frame version {version} (seq {seq})")
+
+
+def audit_lines(samples):
+        """Render AURORA_DATA_SM_AUDIT records like the board's .audit file."""
+        def state(i):
+                return SM_STATES[i] if i < len(SM_STATES) else "UNKNOWN"
+
+        entry = None
+        for type_id, vals, ts in samples:
+                if type_id != AUDIT_TYPE or len(vals) < DP_MAX_CHANNELS:
+                        continue
+                tag, length = vals[0]
+                kind, frm, to, chunk = (tag & 0xFF, (tag >> 8) & 0xFF,
+                                        (tag >> 16) & 0xFF,
+                                        (tag >> 24) & 0xFF)
+                if chunk == 0:
+                        entry = [ts, kind, frm, to, length, b""]
+                elif entry is None or len(entry[5]) != \
+                                chunk * AUDIT_TEXT_PER_RECORD:
+                        entry = None
+                        continue
+                entry[5] += struct.pack("<4i", vals[1][0], vals[1][1],
+                                        vals[2][0], vals[2][1])
+                if len(entry[5]) < entry[4]:
+                        continue
+                ts, kind, frm, to, length, text = entry
+                entry = None
+                if kind == 0:
+                        what, last = "transition", state(to)
+                else:
+                        what = "event"
+                        last = text[:length].decode("utf-8", "replace")
+                yield f"{ts:<12} {what:<12} {state(frm):<12} {last}\n"
+
+
+def health_line(measurement, vals, ts):
+        """Same line as fmt_influx.c writes for AURORA_DATA_THREAD_HEALTH."""
+        raw = struct.pack("<4i", vals[0][0], vals[0][1], vals[1][0],
+                          vals[1][1]).split(b"\0", 1)[0]
+        name = "".join(c if c.isascii() and (c.isalnum() or c == "_")
+                       else "_" for c in raw.decode("latin-1")) or "_"
+        stack_used, ppm = vals[2]
+        load = sensor_value_str(ppm // 1000000, ppm % 1000000)
+        return (f"{measurement},type=thread_health,thread={name} "
+                f"load={load},stack_used={stack_used & 0xFFFFFFFF} {ts}\n")
+
+
+def read_exact(src, n):
+        buf = bytearray()
+        while len(buf) < n:
+                chunk = src.read(n - len(buf))
+                if not chunk:
+                        raise ExportError("stream ended early")
+                buf += chunk
+        return bytes(buf)
+
+
+def sync(src):
+        """Skip anything before the stream magic (e.g. console noise)."""
+        window = b""
+        while window != EXPORT_MAGIC:
+                window = (window + read_exact(src, 1))[-len(EXPORT_MAGIC):]
+
+
+def receive(src, save=None):
+        """Yield raw frames from @p src and check the trailer at the end."""
+        sync(src)
+        rest = read_exact(src, EXPORT_HDR.size - len(EXPORT_MAGIC))
+        _, version, _, frame_size = EXPORT_HDR.unpack(EXPORT_MAGIC + rest)
+        if version != EXPORT_VERSION:
+                raise ExportError(f"unsupported export version {version}")
+        if save is not None:
+                save.write(EXPORT_MAGIC + rest)
+
+        crc = 0
+        frames = 0
+        while True:
+                head = read_exact(src, len(EXPORT_END_MAGIC))
+                if head == EXPORT_END_MAGIC:
+                        rest = read_exact(src, EXPORT_TRAILER.size - len(head))
+                        if save is not None:
+                                save.write(head + rest)
+                        _, sent, sent_crc = EXPORT_TRAILER.unpack(head + rest)
+                        break
+                frame = head + read_exact(src, frame_size - len(head))
+                if save is not None:
+                        save.write(frame)
+                crc = zlib.crc32(frame, crc)
+                frames += 1
+                yield frame
+
+        if sent != frames:
+                raise ExportError(f"trailer reports {sent} frames, "
+                                  f"received {frames}")
+        if sent_crc != crc:
+                raise ExportError(f"CRC mismatch: {sent_crc:#010x} != "
+                                  f"{crc:#010x}")
+        print(f"received {frames} frames, CRC ok", file=sys.stderr)
+
+
+def open_input(path):
+        """Open a serial port in raw mode, or a saved stream as a file."""
+        if path.is_char_device():
+                import termios
+                import tty
+
+                fd = os.open(path, os.O_RDONLY | os.O_NOCTTY)
+                tty.setraw(fd, termios.TCSANOW)
+                return os.fdopen(fd, "rb", buffering=0)
+        return open(path, "rb")
+
+
+def main():
+        ap = argparse.ArgumentParser(description=__doc__,
+                formatter_class=argparse.RawDescriptionHelpFormatter)
+        ap.add_argument("input", type=Path,
+                help="Export port (e.g. /dev/ttyACM1) or a saved stream")
+        ap.add_argument("-o", "--output", type=Path, default=None,
+                help="Output path (default: stdout)")
+        ap.add_argument("--csv", action="store_true",
+                help="Write CSV instead of InfluxDB line protocol")
+        ap.add_argument("--window-ns", type=int, default=1_000_000,
+                help="CSV group window in nanoseconds (default: 1 ms)")
+        ap.add_argument("--measurement", default="telemetry",
+                help="Influx measurement name (default: telemetry)")
+        ap.add_argument("--save", type=Path, default=None,
+                help="Also keep the raw stream in this file")
+        ap.add_argument("--audit", type=Path, default=None,
+                help="Also write the state machine audit trail here")
+        args = ap.parse_args()
+
+        save = open(args.save, "wb") if args.save is not None else None
+        samples = []
+        try:
+                with open_input(args.input) as src:
+                        for frame in receive(src, save):
+                                for type_id, vals, ts in decode_frame(frame):
+                                        samples.append((type_id, vals, ts))
+        except ExportError as e:
+                print(f"error: {e}", file=sys.stderr)
+                sys.exit(1)
+        finally:
+                if save is not None:
+                        save.close()
+
+        if args.audit is not None:
+                with open(args.audit, "w") as f:
+                        f.writelines(audit_lines(samples))
+        samples = [s for s in samples if s[0] != AUDIT_TYPE]
+
+        out = sys.stdout if args.output is None \
+                else open(args.output, "w", newline="")
+        with out:
+                if args.csv:
+                        rows = []
+                        for type_id, vals, ts in samples:
+                                if type_id == HEALTH_TYPE:
+                                        continue
+                                fields = {field_name(type_id, c):
+                                          float(sensor_value_str(*v))
+                                          for c, v in enumerate(vals)}
+                                rows.append((TYPES[type_id][0], fields, ts))
+                        rows.sort(key=lambda s: s[2])
+                        columns = influx_to_csv.collect_columns(rows)
+                        influx_to_csv.write_csv(rows, columns,
+                                                args.window_ns, out)
+                        return
+
+                for type_id, vals, ts in samples:
+                        if type_id == HEALTH_TYPE:
+                                if len(vals) == DP_MAX_CHANNELS:
+                                        out.write(health_line(
+                                                args.measurement, vals, ts))
+                                continue
+                        fields = ",".join(
+                                f"{field_name(type_id, c)}="
+                                f"{sensor_value_str(*v)}"
+                                for c, v in enumerate(vals))
+                        out.write(f"{args.measurement},type="
+                                  f"{TYPES[type_id][0]} {fields} {ts}\n")
+
+
+if __name__ == "__main__":
+        main()
@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Auxspace e.V.
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Read the LZ4-compressed converter outputs (FLIGHT_<n>.csv.lz4,
+FLIGHT_<n>.influx.lz4).
+
+With CONFIG_DATA_LOGGER_CONVERT_LZ4 the board writes its CSV and Influx
+files as standard LZ4 frames (independent blocks, no checksums), so the
+stock ``lz4`` command line tool unpacks them too. This module needs no
+third-party package: it uses ``lz4.frame`` when installed and a pure
+Python block decoder otherwise.
+
+The other tools open their inputs through :func:`open_text`, which
+takes plain and ``.lz4`` files alike. Run on its own it unpacks a file:
+
+    tools/aurora_lz4.py FLIGHT_3.influx.lz4            # -> FLIGHT_3.influx
+    tools/aurora_lz4.py FLIGHT_3.csv.lz4 -o - | head
+"""
+
+import argparse
+import io
+import struct
+import sys
+from pathlib import Path
+
+FRAME_MAGIC = 0x184D2204
+SKIPPABLE_MASK = 0xFFFFFFF0
+SKIPPABLE_MAGIC = 0x184D2A50
+
+try:
+        import lz4.frame as _lz4frame
+except ImportError:
+        _lz4frame = None
+
+
+def decompress_block(src, out):
+        """Append the LZ4 block ``src`` to bytearray ``out``."""
+        i = 0
+        n = len(src)
+        while i < n:
+                token = src[i]
+                i += 1
+                lit = token >> 4
+                if lit == 15:
+                        while True:
+                                b = src[i]
+                                i += 1
+                                lit += b
+                                if b != 255:
+                                        break
+                out += src[i:i + lit]
+                i += lit
+                if i >= n:
+                        break
+                off = src[i] | (src[i + 1] << 8)
+                i += 2
+                if off == 0 or off > len(out):
+                        raise ValueError("LZ4 match offset out of range")
+                mlen = token & 15
+                if mlen == 15:
+                        while True:
+                                b = src[i]
+                                i += 1
+                                mlen += b
+                                if b != 255:
+                                        break
+                mlen += 4
+                start = len(out) - off
+                if mlen <= off:
+                        out += out[start:start + mlen]
+                else:
+                        # Overlapping match: repeat the last off bytes.
+                        chunk = bytes(out[start:])
+                        reps, rest = divmod(mlen, off)
+                        out += chunk * reps + chunk[:rest]
+
+
+def _decompress_frame(data, pos, out):
+        """Decode one frame at ``data[pos]``; return the offset after it."""
+        flg = data[pos + 4]
+        if flg >> 6 != 1:
+                raise ValueError("unsupported LZ4 frame version")
+        block_ck = bool(flg & 0x10)
+        content_size = bool(flg & 0x08)
+        content_ck = bool(flg & 0x04)
+        if flg & 0x01:
+                raise ValueError("LZ4 dictionary frames are not supported")
+        # FLG, BD, optional content size, header checksum.
+        pos += 6 + (8 if content_size else 0) + 1
+
+        # Linked blocks may refer back into earlier blocks of the frame,
+        # which decompress_block() allows as they share ``out``.
+        while True:
+                if pos + 4 > len(data):
+                        # No end mark: the board lost power mid-file.
+                        return len(data)
+                (size,) = struct.unpack_from("<I", data, pos)
+                pos += 4
+                if size == 0:
+                        break
+                raw = bool(size & 0x80000000)
+                size &= 0x7FFFFFFF
+                block = data[pos:pos + size]
+                if len(block) != size:
+                        # Cut short mid-block; keep every complete one.
+                        return len(data)
+                pos += size + (4 if block_ck else 0)
+                if raw:
+                        out += block
+                else:
+                        decompress_block(block, out)
+        return pos + (4 if content_ck else 0)
+
+
+def decompress(data):
+        """Return the content of the LZ4 frame(s) in ``data``."""
+        if _lz4frame is not None:
+                try:
+                        return _lz4frame.decompress(data)
+                except RuntimeError:
+                        # Truncated frame; the decoder below keeps what
+                        # is complete.
+                        pass
+
+        out = bytearray()
+        pos = 0
+        while pos + 4 <= len(data):
+                (magic,) = struct.unpack_from("<I", data, pos)
+                if magic == FRAME_MAGIC:
+                        pos = _decompress_frame(data, pos, out)
+                elif magic & SKIPPABLE_MASK == SKIPPABLE_MAGIC:
+                        (size,) = struct.unpack_from("<I", data, pos + 4)
+                        pos += 8 + size
+                else:
+                        raise ValueError("not an LZ4 frame")
+        return bytes(out)
+
+
+def open_text(path, mode="r", **kwargs):
+        """Open ``path`` for reading text, unpacking it if it ends in .lz4."""
+        path = Path(path)
+        if path.suffix != ".lz4":
+                return open(path, mode, **kwargs)
+        return io.TextIOWrapper(io.BytesIO(decompress(path.read_bytes())),
+                                **kwargs)
+
+
+def main():
+        ap = argparse.ArgumentParser(description=__doc__,
+                formatter_class=argparse.RawDescriptionHelpFormatter)
+        ap.add_argument("input", type=Path, help="LZ4 frame file")
+        ap.add_argument("-o", "--output", default=None,
+                help="Output path, - for stdout (default: input without "
+                     ".lz4)")
+        args = ap.parse_args()
+
+        data = decompress(args.input.read_bytes())
+        if args.output == "-":
+                sys.stdout.buffer.write(data)
+                return
+        out = Path(args.output) if args.output else args.input.with_suffix("")
+        if out == args.input:
+                ap.error("input does not end in .lz4, give -o")
+        out.write_bytes(data)
+        print(f"{args.input} -> {out} ({len(data)} bytes)", file=sys.stderr)
+
+
+if __name__ == "__main__":
+        main()
@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Auxspace e.V.
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+ctypes binding for the host build of the AURORA filter (tools/aurora_sim).
+
+``tools/aurora_sim`` compiles the firmware's ``lib/filter`` and the
+attitude tracker from ``lib/sensor`` as shared libraries, one per filter
+backend::
+
+    cmake -S tools/aurora_sim -B tools/aurora_sim/build
+    cmake --build tools/aurora_sim/build
+
+This module loads one of them and exposes its batch API:
+
+    >>> sim = aurora_sim.load("kalman")
+    >>> flight = aurora_sim.Flight(dt_ns, accel, gyro, baro_alt,
+    ...                            cal_steps=300, detect_from=500)
+    >>> params = [sim.default_params(r_milliscale=r) for r in (2000, 4000)]
+    >>> results = sim.run_batch([flight], params)
+    >>> results[1][0].apogee_step
+
+Inputs may be plain sequences or numpy arrays; nothing here needs numpy.
+"""
+
+import array
+import ctypes
+import math
+import os
+import pathlib
+
+AURORA_DIR = pathlib.Path(os.path.dirname(os.path.abspath(__file__))).parent
+BUILD_DIR = AURORA_DIR / "tools/aurora_sim/build"
+
+# Must match AURORA_SIM_ABI_VERSION in aurora_sim.h.
+ABI_VERSION = 1
+
+BACKENDS = ("kalman", "kalman3")
+
+
+class Params(ctypes.Structure):
+    """``struct aurora_sim_params``: the ``CONFIG_FILTER_*`` tuning knobs."""
+    _fields_ = [
+        ("q_alt_milliscale", ctypes.c_int32),
+        ("q_vel_milliscale", ctypes.c_int32),
+        ("q_bias_milliscale", ctypes.c_int32),
+        ("r_milliscale", ctypes.c_int32),
+        ("apogee_vel_sigma_milliscale", ctypes.c_int32),
+        ("apogee_debounce_samples", ctypes.c_int32),
+    ]
+
+
+class _CFlight(ctypes.Structure):
+    _fields_ = [
+        ("steps", ctypes.c_size_t),
+        ("dt_ns", ctypes.POINTER(ctypes.c_int64)),
+        ("accel", ctypes.POINTER(ctypes.c_double)),
+        ("gyro", ctypes.POINTER(ctypes.c_double)),
+        ("baro_alt", ctypes.POINTER(ctypes.c_double)),
+        ("cal_steps", ctypes.c_size_t),
+        ("detect_from", ctypes.c_size_t),
+    ]
+
+
+class Result(ctypes.Structure):
+    """``struct aurora_sim_result``; steps are -1 when they never happened."""
+    _fields_ = [
+        ("rc", ctypes.c_int32),
+        ("gated", ctypes.c_uint32),
+        ("apogee_step", ctypes.c_int64),
+        ("peak_step", ctypes.c_int64),
+        ("apogee_alt", ctypes.c_double),
+        ("peak_alt", ctypes.c_double),
+    ]
+
+
+def _flat(values, typecode, width):
+    """Copy ``values`` (1-D, or rows of ``width``) into a flat C array."""
+    buf = array.array(typecode)
+    if width == 1:
+        buf.extend(values)
+    else:
+        for row in values:
+            if len(row) != width:
+                raise ValueError(f"expected rows of {width} values")
+            buf.extend(row)
+    return buf
+
+
+class Flight:
+    """One flight sampled at the IMU rate, in the units the firmware uses.
+
+    ``dt_ns[i]`` is the time since step ``i - 1``, ``accel``/``gyro`` are
+    ``steps`` rows of body-frame m/s^2 and rad/s, and ``baro_alt[i]`` is
+    the baro altitude above the pad that arrived with step ``i`` (NaN or
+    None when none did).  The first ``cal_steps`` steps calibrate the
+    attitude tracker; apogee is only looked for from ``detect_from`` on.
+    """
+
+    def __init__(self, dt_ns, accel, gyro, baro_alt, cal_steps, detect_from=0):
+        self._dt = _flat((int(v) for v in dt_ns), "q", 1)
+        self._accel = _flat(accel, "d", 3)
+        self._gyro = _flat(gyro, "d", 3)
+        self._baro = _flat((math.nan if v is None else float(v)
+                            for v in baro_alt), "d", 1)
+        self.steps = len(self._dt)
+        if (len(self._accel) != 3 * self.steps or
+                len(self._gyro) != 3 * self.steps or
+                len(self._baro) != self.steps):
+            raise ValueError("flight arrays differ in length")
+        if not 0 < cal_steps <= self.steps:
+            raise ValueError("cal_steps must be within the flight")
+        self.cal_steps = cal_steps
+        self.detect_from = detect_from
+
+    def _c(self):
+        def ptr(buf, ctype):
+            return ctypes.cast(buf.buffer_info()[0], ctypes.POINTER(ctype))
+
+        return _CFlight(self.steps,
+                        ptr(self._dt, ctypes.c_int64),
+                        ptr(self._accel, ctypes.c_double),
+                        ptr(self._gyro, ctypes.c_double),
+                        ptr(self._baro, ctypes.c_double),
+                        self.cal_steps, self.detect_from)
+
+
+class Sim:
+    """A loaded ``libaurora_sim_<backend>.so``."""
+
+    def __init__(self, path):
+        self.path = str(path)
+        self._lib = ctypes.CDLL(self.path)
+        lib = self._lib
+        lib.aurora_sim_abi_version.restype = ctypes.c_int
+        lib.aurora_sim_backend.restype = ctypes.c_char_p
+        lib.aurora_sim_default_params.argtypes = [ctypes.POINTER(Params)]
+        lib.aurora_sim_run.argtypes = [ctypes.POINTER(_CFlight),
+                                       ctypes.POINTER(Params),
+                                       ctypes.POINTER(Result)]
+        lib.aurora_sim_run.restype = ctypes.c_int
+        lib.aurora_sim_run_batch.argtypes = [ctypes.POINTER(_CFlight),
+                                             ctypes.c_size_t,
+                                             ctypes.POINTER(Params),
+                                             ctypes.c_size_t,
+                                             ctypes.POINTER(Result),
+                                             ctypes.c_uint]
+        lib.aurora_sim_run_batch.restype = ctypes.c_int
+
+        abi = lib.aurora_sim_abi_version()
+        if abi != ABI_VERSION:
+            raise RuntimeError(f"{self.path}: ABI {abi}, expected "
+                               f"{ABI_VERSION}; rebuild tools/aurora_sim")
+        self.backend = lib.aurora_sim_backend().decode()
+
+    def default_params(self, **overrides):
+        """Firmware Kconfig defaults, with ``overrides`` applied by name."""
+        p = Params()
+        self._lib.aurora_sim_default_params(ctypes.byref(p))
+        for name, value in overrides.items():
+            if not hasattr(p, name):
+                raise AttributeError(f"unknown parameter {name}")
+            setattr(p, name, int(value))
+        return p
+
+    def run(self, flight, params):
+        """Run one flight; returns a :class:`Result`."""
+        res = Result()
+        cf = flight._c()
+        rc = self._lib.aurora_sim_run(ctypes.byref(cf), ctypes.byref(params),
+                                      ctypes.byref(res))
+        if rc != 0:
+            raise OSError(-rc, os.strerror(-rc))
+        return res
+
+    def run_batch(self, flights, params, threads=0):
+        """Run every flight with every parameter set.
+
+        Returns ``results[p][f]``.  ``threads=0`` uses every core.
+        """
+        n_f, n_p = len(flights), len(params)
+        c_flights = (_CFlight * n_f)(*(f._c() for f in flights))
+        c_params = (Params * n_p)(*params)
+        out = (Result * (n_f * n_p))()
+        rc = self._lib.aurora_sim_run_batch(c_flights, n_f, c_params, n_p,
+                                            out, threads)
+        if rc != 0:
+            raise OSError(-rc, os.strerror(-rc))
+        return [list(out[p * n_f:(p + 1) * n_f]) for p in range(n_p)]
+
+
+def load(backend="kalman", path=None):
+    """Load the library for ``backend``.
+
+    ``path`` (or ``$AURORA_SIM_LIB``) names the library directly;
+    otherwise it is looked up in ``tools/aurora_sim/build``.
+    """
+    if backend not in BACKENDS:
+        raise ValueError(f"unknown backend {backend}")
+    path = path or os.environ.get("AURORA_SIM_LIB")
+    if path is None:
+        path = BUILD_DIR / f"libaurora_sim_{backend}.so"
+        if not path.exists():
+            raise FileNotFoundError(
+                f"{path} not found; build it with 'cmake -S tools/aurora_sim "
+                f"-B tools/aurora_sim/build && cmake --build "
+                f"tools/aurora_sim/build'")
+    sim = Sim(path)
+    if sim.backend != backend:
+        raise RuntimeError(f"{sim.path} is the {sim.backend} backend, "
+                           f"not {backend}")
+    return sim
@@ -0,0 +1,229 @@
+/**
+ * @file aurora_sim.c
+ * @brief Batch runner around the firmware filter and attitude tracker.
+ *
+ * See aurora_sim.h.  Workers pull (parameter set, flight) jobs off one
+ * atomic counter; each job owns its struct filter and struct attitude
+ * on the stack and publishes its tuning through aurora_sim_active, the
+ * thread-local the Kconfig shims in aurora_sim_config.h read.
+ *
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <zephyr/kernel.h>
+
+#include <aurora/lib/attitude.h>
+#include <aurora/lib/filter.h>
+
+#include "aurora_sim.h"
+
+_Thread_local struct aurora_sim_params aurora_sim_active;
+
+/* aurora_sim_abi_version – see aurora_sim.h */
+int aurora_sim_abi_version(void)
+{
+	return AURORA_SIM_ABI_VERSION;
+}
+
+/* aurora_sim_backend – see aurora_sim.h */
+const char *aurora_sim_backend(void)
+{
+#if defined(CONFIG_FILTER_KALMAN3)
+	return "kalman3";
+#else
+	return "kalman";
+#endif /* CONFIG_FILTER_KALMAN3 */
+}
+
+/* aurora_sim_default_params – see aurora_sim.h */
+void aurora_sim_default_params(struct aurora_sim_params *params)
+{
+	if (params == NULL)
+		return;
+
+	*params = (struct aurora_sim_params){
+		.q_alt_milliscale = 100,
+		.q_vel_milliscale = 500,
+		.q_bias_milliscale = 10,
+		.r_milliscale = 4000,
+		.apogee_vel_sigma_milliscale = 0,
+		.apogee_debounce_samples = 3,
+	};
+}
+
+static void to_attitude(const double *in, attitude_real_t out[ATTITUDE_NUM_AXES])
+{
+	for (int i = 0; i < ATTITUDE_NUM_AXES; i++)
+		out[i] = (attitude_real_t)in[i];
+}
+
+/* aurora_sim_run – see aurora_sim.h */
+int aurora_sim_run(const struct aurora_sim_flight *flight,
+		   const struct aurora_sim_params *params,
+		   struct aurora_sim_result *out)
+{
+	if (flight == NULL || params == NULL || out == NULL ||
+	    flight->dt_ns == NULL || flight->accel == NULL ||
+	    flight->gyro == NULL || flight->baro_alt == NULL ||
+	    flight->cal_steps == 0)
+		return -EINVAL;
+
+	struct filter f;
+	struct attitude att;
+
+	aurora_sim_active = *params;
+	*out = (struct aurora_sim_result){ .apogee_step = -1, .peak_step = -1 };
+
+	(void)filter_init(&f);
+	(void)attitude_init(&att);
+
+	/* Like handle_imu(), a skipped or failed attitude step keeps the
+	 * previous vertical acceleration.
+	 */
+	attitude_real_t a_vert = 0;
+
+	for (size_t i = 0; i < flight->steps; i++) {
+		attitude_real_t accel[ATTITUDE_NUM_AXES];
+		attitude_real_t gyro[ATTITUDE_NUM_AXES];
+		attitude_real_t a_v;
+		const int64_t dt = flight->dt_ns[i];
+		int rc;
+
+		to_attitude(&flight->accel[3 * i], accel);
+		to_attitude(&flight->gyro[3 * i], gyro);
+
+		if (i < flight->cal_steps) {
+			(void)attitude_calibrate_sample(&att, accel, gyro);
+			if (i + 1 == flight->cal_steps)
+				(void)attitude_calibrate_finish(&att);
+			a_vert = 0;
+		} else if (dt > 0 && dt <= (int64_t)NSEC_PER_SEC &&
+			   attitude_update(&att, accel, gyro,
+					   (attitude_real_t)((double)dt / 1e9),
+					   &a_v) == 0) {
+			a_vert = a_v;
+		}
+
+		/* A repeated capture time carries no new measurement, as in
+		 * sm_filter_feed(); a gap that predict rejects still updates.
+		 */
+		if (dt <= 0)
+			continue;
+
+		rc = filter_predict(&f, dt, (filter_real_t)a_vert);
+		if (rc != 0 && out->rc == 0)
+			out->rc = rc;
+
+		if (!isnan(flight->baro_alt[i])) {
+			rc = filter_update(&f, (filter_real_t)flight->baro_alt[i]);
+			if (rc == 1)
+				out->gated++;
+			else if (rc < 0 && out->rc == 0)
+				out->rc = rc;
+		}
+
+		if (out->peak_step < 0 || f.state[0] > out->peak_alt) {
+			out->peak_alt = f.state[0];
+			out->peak_step = (int64_t)i;
+		}
+
+		if (i >= flight->detect_from && out->apogee_step < 0 &&
+		    filter_detect_apogee(&f) == 1) {
+			out->apogee_step = (int64_t)i;
+			out->apogee_alt = f.state[0];
+		}
+	}
+
+	return 0;
+}
+
+struct batch {
+	const struct aurora_sim_flight *flights;
+	size_t n_flights;
+	const struct aurora_sim_params *params;
+	struct aurora_sim_result *out;
+	size_t jobs;
+	atomic_size_t next;
+};
+
+static void *batch_worker(void *arg)
+{
+	struct batch *b = arg;
+
+	for (;;) {
+		size_t job = atomic_fetch_add(&b->next, 1);
+
+		if (job >= b->jobs)
+			break;
+
+		const size_t p = job / b->n_flights;
+		const size_t fl = job % b->n_flights;
+
+		if (aurora_sim_run(&b->flights[fl], &b->params[p],
+				   &b->out[job]) != 0)
+			b->out[job] = (struct aurora_sim_result){
+				.rc = -EINVAL, .apogee_step = -1, .peak_step = -1,
+			};
+	}
+	return NULL;
+}
+
+/* aurora_sim_run_batch – see aurora_sim.h */
+int aurora_sim_run_batch(const struct aurora_sim_flight *flights,
+			 size_t n_flights,
+			 const struct aurora_sim_params *params,
+			 size_t n_params,
+			 struct aurora_sim_result *out,
+			 unsigned int threads)
+{
+	if (flights == NULL || params == NULL || out == NULL)
+		return -EINVAL;
+
+	struct batch b = {
+		.flights = flights,
+		.n_flights = n_flights,
+		.params = params,
+		.out = out,
+		.jobs = n_flights * n_params,
+	};
+
+	atomic_init(&b.next, 0);
+	if (b.jobs == 0)
+		return 0;
+
+	if (threads == 0) {
+		long online = sysconf(_SC_NPROCESSORS_ONLN);
+
+		threads = online > 0 ? (unsigned int)online : 1U;
+	}
+	if (threads > b.jobs)
+		threads = (unsigned int)b.jobs;
+
+	pthread_t *tids = calloc(threads, sizeof(*tids));
+	unsigned int started = 0;
+
+	if (tids == NULL)
+		return -ENOMEM;
+
+	for (; started < threads; started++) {
+		if (pthread_create(&tids[started], NULL, batch_worker, &b) != 0)
+			break;
+	}
+
+	/* With no worker at all nothing ran; otherwise the ones that did
+	 * start drain the queue between them.
+	 */
+	for (unsigned int i = 0; i < started; i++)
+		pthread_join(tids[i], NULL);
+	free(tids);
+
+	return started > 0 ? 0 : -EAGAIN;
+}
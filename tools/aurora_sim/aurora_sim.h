@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef AURORA_SIM_H_
+#define AURORA_SIM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @defgroup tools_aurora_sim Host flight simulator
+ * @{
+ *
+ * @brief The firmware's lib/filter and attitude tracker, built for the
+ *        host, with a batch API that runs many flights on all cores.
+ *
+ * The library compiles the unmodified firmware sources against small
+ * Zephyr shims (see shim/), so a run follows exactly the code that flies.
+ * Filter tuning that is a Kconfig constant on the target is taken from
+ * @ref aurora_sim_params per run instead; the backend, float/double
+ * arithmetic and IMU mounting axis are fixed when the library is built.
+ */
+
+/** @brief Bumped whenever a struct below changes layout. */
+#define AURORA_SIM_ABI_VERSION 1
+
+/**
+ * @brief Per-run filter tuning, named after the Kconfig options it
+ *        replaces (@c CONFIG_FILTER_* without the prefix).
+ */
+struct aurora_sim_params {
+	int32_t q_alt_milliscale;
+	int32_t q_vel_milliscale;
+	int32_t q_bias_milliscale;		/**< Used by kalman3 only. */
+	int32_t r_milliscale;
+	int32_t apogee_vel_sigma_milliscale;
+	int32_t apogee_debounce_samples;
+};
+
+/**
+ * @brief One recorded or synthetic flight, sampled at the IMU rate.
+ *
+ * The arrays are only read, so one flight may be shared by every run of
+ * a batch.
+ */
+struct aurora_sim_flight {
+	size_t steps;			/**< Samples in each array below. */
+	const int64_t *dt_ns;		/**< Time since the previous step. */
+	const double *accel;		/**< steps x 3 body-frame m/s^2. */
+	const double *gyro;		/**< steps x 3 body-frame rad/s. */
+	const double *baro_alt;		/**< Baro altitude (m); NaN = none. */
+	size_t cal_steps;		/**< Leading steps used to calibrate. */
+	size_t detect_from;		/**< First step that votes on apogee. */
+};
+
+/** @brief Outcome of one run. */
+struct aurora_sim_result {
+	int32_t rc;			/**< 0, or -errno of a rejected input. */
+	uint32_t gated;			/**< Baro updates the NIS gate dropped. */
+	int64_t apogee_step;		/**< Step apogee was reported, or -1. */
+	int64_t peak_step;		/**< Step of the highest altitude estimate. */
+	double apogee_alt;		/**< Altitude estimate at apogee_step. */
+	double peak_alt;		/**< Highest altitude estimate. */
+};
+
+/** @brief @ref AURORA_SIM_ABI_VERSION the library was built with. */
+int aurora_sim_abi_version(void);
+
+/** @brief Filter backend compiled in: "kalman" or "kalman3". */
+const char *aurora_sim_backend(void);
+
+/** @brief The firmware's Kconfig defaults for @ref aurora_sim_params. */
+void aurora_sim_default_params(struct aurora_sim_params *params);
+
+/**
+ * @brief Run one flight.
+ *
+ * Per step: calibration samples while @c step < @c cal_steps, otherwise
+ * attitude_update() for the vertical acceleration; then, unless
+ * @c dt_ns is 0, filter_predict(), filter_update() when the step carries
+ * a baro altitude and filter_detect_apogee() from @c detect_from on.
+ * The firmware feeds the last baro altitude on every IMU sample, so pass
+ * it held rather than NaN to reproduce a flight exactly.
+ *
+ * @retval 0 on success (see @c out->rc for the run itself).
+ * @retval -EINVAL if a pointer is NULL or @c cal_steps is 0.
+ */
+int aurora_sim_run(const struct aurora_sim_flight *flight,
+		   const struct aurora_sim_params *params,
+		   struct aurora_sim_result *out);
+
+/**
+ * @brief Run every flight with every parameter set on @p threads threads.
+ *
+ * @p out holds @p n_params * @p n_flights results, the runs of
+ * @c params[p] at @c out[p * n_flights].  Runs share nothing, so the
+ * result does not depend on @p threads.
+ *
+ * @param threads Worker threads; 0 uses every online core.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if a pointer is NULL.
+ * @retval -ENOMEM if the thread table cannot be allocated.
+ * @retval -EAGAIN if no worker thread could be started.
+ */
+int aurora_sim_run_batch(const struct aurora_sim_flight *flights,
+			 size_t n_flights,
+			 const struct aurora_sim_params *params,
+			 size_t n_params,
+			 struct aurora_sim_result *out,
+			 unsigned int threads);
+
+/** @} */
+
+#endif /* AURORA_SIM_H_ */
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Stands in for the generated autoconf.h.  Included ahead of every
+ * firmware source by CMakeLists.txt.  Tuning knobs read the parameters
+ * of the run on the calling thread, see aurora_sim.c; everything else is
+ * the Kconfig default or a build option.
+ */
+
+#ifndef AURORA_SIM_CONFIG_H_
+#define AURORA_SIM_CONFIG_H_
+
+#include "aurora_sim.h"
+
+extern _Thread_local struct aurora_sim_params aurora_sim_active;
+
+#define CONFIG_FILTER 1
+#define CONFIG_ATTITUDE 1
+#define CONFIG_ATTITUDE_GRAVITY 1
+
+#define CONFIG_FILTER_Q_ALT_MILLISCALE (aurora_sim_active.q_alt_milliscale)
+#define CONFIG_FILTER_Q_VEL_MILLISCALE (aurora_sim_active.q_vel_milliscale)
+#define CONFIG_FILTER_Q_BIAS_MILLISCALE (aurora_sim_active.q_bias_milliscale)
+#define CONFIG_FILTER_R_MILLISCALE (aurora_sim_active.r_milliscale)
+#define CONFIG_FILTER_APOGEE_VEL_SIGMA_MILLISCALE \
+	(aurora_sim_active.apogee_vel_sigma_milliscale)
+#define CONFIG_FILTER_APOGEE_DEBOUNCE_SAMPLES \
+	(aurora_sim_active.apogee_debounce_samples)
+
+/* Set by CMakeLists.txt from AURORA_SIM_UP_AXIS. */
+#define CONFIG_IMU_UP_AXIS_INDEX AURORA_SIM_UP_AXIS_INDEX
+#define CONFIG_IMU_UP_AXIS_SIGN AURORA_SIM_UP_AXIS_SIGN
+
+#define CONFIG_AURORA_FILTER_LOG_LEVEL 0
+#define CONFIG_AURORA_SENSORS_LOG_LEVEL 0
+
+#endif /* AURORA_SIM_CONFIG_H_ */
@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * The few <zephyr/kernel.h> definitions lib/filter and lib/sensor use,
+ * with the types Zephyr gives them.
+ */
+
+#ifndef AURORA_SIM_SHIM_ZEPHYR_KERNEL_H_
+#define AURORA_SIM_SHIM_ZEPHYR_KERNEL_H_
+
+#include <stdint.h>
+
+#define NSEC_PER_SEC 1000000000U
+
+#define ARG_UNUSED(x) (void)(x)
+
+#endif /* AURORA_SIM_SHIM_ZEPHYR_KERNEL_H_ */
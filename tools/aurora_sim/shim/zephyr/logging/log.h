@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2026 Auxspace e.V.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Logging compiles out on the host; a sweep would only drown in it.
+ */
+
+#ifndef AURORA_SIM_SHIM_ZEPHYR_LOGGING_LOG_H_
+#define AURORA_SIM_SHIM_ZEPHYR_LOGGING_LOG_H_
+
+#define LOG_MODULE_REGISTER(...) extern int aurora_sim_log_unused
+#define LOG_MODULE_DECLARE(...) extern int aurora_sim_log_unused
+
+#define LOG_ERR(...) ((void)0)
+#define LOG_WRN(...) ((void)0)
+#define LOG_INF(...) ((void)0)
+#define LOG_DBG(...) ((void)0)
+
+#endif /* AURORA_SIM_SHIM_ZEPHYR_LOGGING_LOG_H_ */
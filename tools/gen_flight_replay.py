@@ -16,16 +16,40 @@
 #   const struct replay_imu_sample  replay_accel[REPLAY_ACCEL_LEN];
 #   const struct replay_imu_sample  replay_gyro[REPLAY_GYRO_LEN];
 #   const struct replay_baro_sample replay_baro[REPLAY_BARO_LEN];
+#
+# With --format bin the samples are instead written as a replay file that
+# a native_sim build with CONFIG_AURORA_FAKE_SENSORS_REPLAY_FILE maps at
+# runtime (see sensor_board/src/replay_file.c): a 24-byte header
+#
+#   char magic[4] = "ARPL"; u16 version; u16 0; u32 count; u32 0; u64 span_ns
+#
+# followed by count 24-byte records in timestamp order
+#
+#   u64 t_ns; u8 type (enum aurora_data); u8 pad[3]; f32 v[3]
+#
+# where baro records carry [temperature, pressure, 0].
 
 import argparse
 import csv
 import re
+import struct
 import sys
 from pathlib import Path
 
 # Window padding around the [BOOST, LANDED] interval, in nanoseconds.
 TRIM_PAD_NS = 4 * 1_000_000_000
 
+# Replay file layout, shared with sensor_board/src/replay_file.c.
+REPLAY_FILE_MAGIC = b"ARPL"
+REPLAY_FILE_VERSION = 1
+REPLAY_HEADER = struct.Struct("<4sHHIIQ")
+REPLAY_RECORD = struct.Struct("<QB3xfff")
+
+# enum aurora_data values of the replayed sample types.
+AURORA_DATA_BARO = 0
+AURORA_DATA_IMU_ACCEL = 1
+AURORA_DATA_IMU_GYRO = 2
+
 
 def parse_csv(path):
     accel, gyro, baro = [], [], []
@@ -102,10 +126,34 @@ def emit_baro_array(name, samples, t0):
     return "\n".join(out)
 
 
+def write_replay_file(path, accel, gyro, baro, t0):
+    # Gyro first on equal timestamps so an accel sample is published with
+    # the gyro reading taken at the same time, then accel before baro, as
+    # the compiled-in tables are walked.
+    records = [(t - t0, 1, AURORA_DATA_IMU_ACCEL, x, y, z)
+               for t, x, y, z in accel]
+    records += [(t - t0, 0, AURORA_DATA_IMU_GYRO, x, y, z)
+                for t, x, y, z in gyro]
+    records += [(t - t0, 2, AURORA_DATA_BARO, temp, p, 0.0)
+                for t, p, temp in baro]
+    records.sort(key=lambda r: (r[0], r[1]))
+
+    with open(path, "wb") as f:
+        f.write(REPLAY_HEADER.pack(REPLAY_FILE_MAGIC, REPLAY_FILE_VERSION, 0,
+                                   len(records), 0, records[-1][0]))
+        for t, _, typ, a, b, c in records:
+            f.write(REPLAY_RECORD.pack(t, typ, a, b, c))
+
+
 def main():
     ap = argparse.ArgumentParser()
     ap.add_argument("--input", required=True, help="flights.csv from data_logger")
-    ap.add_argument("--output", required=True, help="generated .c output path")
+    ap.add_argument("--output", required=True,
+                    help="generated .c (or replay file) output path")
+    ap.add_argument("--format", choices=("c", "bin"),
+                    help="c source with embedded tables, or a replay file "
+                         "mapped at runtime (default: bin if --output ends "
+                         "in .bin, else c)")
     ap.add_argument("--state-audit",
                     help="state_audit file from the same flight; if given, "
                          "samples are trimmed to "
@@ -136,6 +184,11 @@ def main():
 
     t0 = min(accel[0][0], gyro[0][0], baro[0][0])
 
+    fmt = args.format or ("bin" if args.output.endswith(".bin") else "c")
+    if fmt == "bin":
+        write_replay_file(args.output, accel, gyro, baro, t0)
+        return 0
+
     header = (
         "/* AUTO-GENERATED by tools/gen_flight_replay.py.\n"
         " * Do not edit. Re-run the build to regenerate.\n"
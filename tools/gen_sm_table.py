@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Auxspace e.V.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Generate the const rule tables for the table-driven state machine
+# (lib/state/table.c) from a flight profile description. See
+# lib/state/profiles/single_stage.yaml for the format.
+#
+# Output schema (see table.c):
+#
+#   static const struct sm_table_rule  sm_table_rules[SM_TABLE_NUM_RULES];
+#   static const struct sm_table_range sm_table_global;
+#   static const struct sm_table_range sm_table_states[SM_TABLE_NUM_STATES];
+#   #define SM_TABLE_MAX_RULES  (most rules evaluated by one step)
+
+import argparse
+import re
+import sys
+from pathlib import Path
+
+import yaml
+
+RULE_KEYS = {"guard", "dwell", "count", "timeout", "hold", "start_event",
+             "event", "to", "error", "retry", "except"}
+IDENT = re.compile(r"^[A-Za-z_][A-Za-z0-9_]*$")
+
+
+class ProfileError(Exception):
+    pass
+
+
+def c_string(s):
+    return '"' + s.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def ident(value, what):
+    if not isinstance(value, str) or not IDENT.match(value):
+        raise ProfileError(f"{what}: not an identifier: {value!r}")
+    return value
+
+
+def rule_initializer(rule, where, is_global):
+    if not isinstance(rule, dict):
+        raise ProfileError(f"{where}: rule must be a mapping")
+    unknown = set(rule) - RULE_KEYS
+    if unknown:
+        raise ProfileError(f"{where}: unknown keys {sorted(unknown)}")
+
+    timers = [k for k in ("dwell", "count", "timeout") if k in rule]
+    if len(timers) > 1:
+        raise ProfileError(f"{where}: only one of dwell/count/timeout")
+    actions = [k for k in ("to", "error", "retry") if k in rule]
+    if len(actions) != 1:
+        raise ProfileError(f"{where}: exactly one of to/error/retry")
+    if "except" in rule and not is_global:
+        raise ProfileError(f"{where}: 'except' only applies to global rules")
+    if "start_event" in rule and "dwell" not in rule:
+        raise ProfileError(f"{where}: 'start_event' needs a dwell")
+
+    fields = []
+    if "guard" in rule:
+        fields.append(f".guard = sm_guard_{ident(rule['guard'], where)}")
+    if timers:
+        kind = timers[0]
+        th = ident(rule[kind], where)
+        fields.append(f".timer = SM_TABLE_{kind.upper()}")
+        fields.append(f".threshold = offsetof(struct sm_thresholds, {th})")
+    if rule.get("hold"):
+        fields.append(".hold = true")
+    if "except" in rule:
+        mask = " | ".join(f"BIT(SM_{ident(s, where)})"
+                          for s in rule["except"])
+        fields.append(f".skip = {mask}")
+    if "start_event" in rule:
+        fields.append(f".start_event = {c_string(rule['start_event'])}")
+    if "event" in rule:
+        fields.append(f".event = {c_string(rule['event'])}")
+    if "to" in rule:
+        fields.append(".action = SM_TABLE_GOTO")
+        fields.append(f".to = SM_{ident(rule['to'], where)}")
+    elif "error" in rule:
+        fields.append(".action = SM_TABLE_ERROR")
+        fields.append(f".reason = SM_ERR_{ident(rule['error'], where)}")
+    else:
+        fields.append(".action = SM_TABLE_RETRY")
+
+    return "\t{ " + ", ".join(fields) + " },"
+
+
+def generate(profile, source):
+    if not isinstance(profile, dict) or "states" not in profile:
+        raise ProfileError("profile needs a 'states' mapping")
+
+    global_rules = profile.get("global") or []
+    states = profile["states"]
+    lines = [
+        f"/* Generated by tools/gen_sm_table.py from {source}. Do not edit. */",
+        "",
+        "static const struct sm_table_rule sm_table_rules[] = {",
+        "\t/* global */",
+    ]
+    for i, rule in enumerate(global_rules):
+        lines.append(rule_initializer(rule, f"global[{i}]", True))
+
+    ranges = []
+    first = len(global_rules)
+    for name, rules in states.items():
+        ident(name, "state")
+        rules = rules or []
+        lines.append(f"\t/* {name} */")
+        for i, rule in enumerate(rules):
+            lines.append(rule_initializer(rule, f"{name}[{i}]", False))
+        ranges.append((name, first, len(rules)))
+        first += len(rules)
+    lines.append("};")
+    lines.append("")
+
+    longest = max((n for _, _, n in ranges), default=0)
+    lines += [
+        f"#define SM_TABLE_NUM_RULES {first}",
+        "",
+        "/* Global rules, then one state's rules. */",
+        f"#define SM_TABLE_MAX_RULES {len(global_rules) + longest}",
+        "",
+        "static const struct sm_table_range sm_table_global = "
+        f"{{ .first = 0, .count = {len(global_rules)} }};",
+        "",
+        "static const struct sm_table_range sm_table_states[SM_TABLE_NUM_STATES] = {",
+    ]
+    for name, start, count in ranges:
+        lines.append(f"\t[SM_{name}] = {{ .first = {start}, .count = {count} }},")
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--input", required=True, help="flight profile (.yaml)")
+    ap.add_argument("--output", required=True, help="generated header path")
+    args = ap.parse_args()
+
+    src = Path(args.input)
+    try:
+        with open(src) as f:
+            out = generate(yaml.safe_load(f), src.name)
+    except (OSError, yaml.YAMLError, ProfileError) as e:
+        print(f"gen_sm_table: {src}: {e}", file=sys.stderr)
+        sys.exit(1)
+
+    Path(args.output).write_text(out)
+
+
+if __name__ == "__main__":
+    main()
@@ -25,6 +25,8 @@ import csv
 import sys
 from pathlib import Path
 
+from aurora_lz4 import open_text
+
 
 def parse_line(line):
         """Parse one InfluxDB line.
@@ -134,7 +136,7 @@ def main():
         if str(args.input) == "-":
                 src = sys.stdin
         else:
-                src = open(args.input, "r")
+                src = open_text(args.input)
 
         samples = []
         malformed = 0
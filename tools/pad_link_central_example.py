@@ -18,12 +18,14 @@ UUID_STATE      = "e8a59102-7c0e-4b5b-9a4c-1f1b6f7c4d70"
 UUID_RAW        = "e8a59103-7c0e-4b5b-9a4c-1f1b6f7c4d70"  # deprecated
 UUID_COMP       = "e8a59104-7c0e-4b5b-9a4c-1f1b6f7c4d70"
 UUID_SMTYPE     = "e8a59105-7c0e-4b5b-9a4c-1f1b6f7c4d70"
+UUID_BUNDLE     = "e8a59106-7c0e-4b5b-9a4c-1f1b6f7c4d70"
 UUID_BOARDCAP   = "e8a591a0-7c0e-4b5b-9a4c-1f1b6f7c4d70"
 UUID_BARO       = "e8a591a1-7c0e-4b5b-9a4c-1f1b6f7c4d70"
 UUID_ACCEL      = "e8a591a2-7c0e-4b5b-9a4c-1f1b6f7c4d70"
 UUID_GYRO       = "e8a591a3-7c0e-4b5b-9a4c-1f1b6f7c4d70"
 UUID_IMU6       = "e8a591a4-7c0e-4b5b-9a4c-1f1b6f7c4d70"
 UUID_INNER_TEMP = "e8a591a7-7c0e-4b5b-9a4c-1f1b6f7c4d70"
+UUID_PYRO       = "e8a591aa-7c0e-4b5b-9a4c-1f1b6f7c4d70"
 
 # Capability register (boardcap characteristic, uint32 LE).
 # Mirrors include/aurora/lib/pad_link.h. Keep in sync.
@@ -42,6 +44,19 @@ CAP_TEMP_MOTOR    = (1 << 10)
 CAP_TEMP_HULL     = (1 << 11)
 # Byte 2 — Positioning
 CAP_GPS           = (1 << 16)
+# Byte 3 — Pyro
+CAP_PYRO          = (1 << 24)
+
+# Telemetry bundle sections, in wire order: (flag, size).
+# Mirrors PL_BUNDLE_F_* in lib/pad_link/pad_link_wire.h. Keep in sync.
+BUNDLE_F_COMP       = (1 << 0)
+BUNDLE_F_ACCEL      = (1 << 1)
+BUNDLE_F_GYRO       = (1 << 2)
+BUNDLE_F_BARO       = (1 << 3)
+BUNDLE_F_INNER_TEMP = (1 << 4)
+BUNDLE_SECTIONS = ((BUNDLE_F_COMP, 28), (BUNDLE_F_ACCEL, 28),
+                   (BUNDLE_F_GYRO, 28), (BUNDLE_F_BARO, 20),
+                   (BUNDLE_F_INNER_TEMP, 12))
 
 SM_STATES = {
     0: ("IDLE", "ARMED", "BOOST", "BURNOUT",
@@ -66,6 +81,7 @@ def print_capabilities(cap):
     print(f"  Motor temp: {'present' if cap & CAP_TEMP_MOTOR else 'not present'}")
     print(f"  Hull temp:  {'present' if cap & CAP_TEMP_HULL  else 'not present'}")
     print(f"  GPS/GNSS:   {'present' if cap & CAP_GPS        else 'not present'}")
+    print(f"  Pyro:       {'present' if cap & CAP_PYRO       else 'not present'}")
 
 
 def decode_baro(data):
@@ -85,6 +101,51 @@ def decode_inner_temp(data):
     return f"inner_temp: {temp_us / 1e6:.2f}°C"
 
 
+def decode_pyro(data):
+    v = struct.unpack("<IB4B4H4H", data[:25])
+    n, flags, cap_mv, sense_mv = v[1], v[2:6], v[6:10], v[10:14]
+    out = []
+    for ch in range(min(n, 4)):
+        f = flags[ch]
+        cap = f"{cap_mv[ch]} mV" if f & 0x1 else "n/a"
+        sense = f"{sense_mv[ch]} mV" if f & 0x2 else "n/a"
+        out.append(f"ch{ch} cap={cap} sense={sense}"
+                   f"{' armed' if f & 0x4 else ''}{' fired' if f & 0x8 else ''}")
+    return "pyro: " + ("; ".join(out) if out else "no channels")
+
+
+def decode_comp(data):
+    ts, alt, vel, yaw, pitch, roll, az = struct.unpack("<Iffffff", data[:28])
+    return (f"t={ts}  alt={alt:+.1f}  v={vel:+.1f}  "
+            f"ypr={yaw:+.1f}/{pitch:+.1f}/{roll:+.1f}")
+
+
+def decode_vec(name, unit, data):
+    _, x, y, z = struct.unpack("<Iqqq", data[:28])
+    return f"{name}: [x={x/1e6:+.3f}, y={y/1e6:+.3f}, z={z/1e6:+.3f}] {unit}"
+
+
+def decode_bundle(sm_type, data):
+    version, _, state, fields = struct.unpack("<BBBB", data[:4])
+    if version != 1:
+        return [f"bundle: unknown version {version}"]
+    name = SM_STATES.get(sm_type, ())
+    lines = [f"state: {name[state] if state < len(name) else state}"]
+    decoders = {
+        BUNDLE_F_COMP:       decode_comp,
+        BUNDLE_F_ACCEL:      lambda d: decode_vec("accel", "m/s²", d),
+        BUNDLE_F_GYRO:       lambda d: decode_vec("gyro", "rad/s", d),
+        BUNDLE_F_BARO:       decode_baro,
+        BUNDLE_F_INNER_TEMP: decode_inner_temp,
+    }
+    off = 4
+    for flag, size in BUNDLE_SECTIONS:
+        if fields & flag:
+            lines.append(decoders[flag](data[off:off + size]))
+            off += size
+    return lines
+
+
 def parse_args():
     p = argparse.ArgumentParser(description=__doc__)
     p.add_argument("--mode", choices=("notify", "poll"), default="notify",
@@ -99,19 +160,26 @@ def parse_args():
 
 
 async def run_notify(c, sm_type, cap, duration):
+    # Not part of the bundle: subscribe on its own either way.
+    if cap & CAP_PYRO:
+        await c.start_notify(UUID_PYRO, lambda _, d: print(decode_pyro(d)))
+
+    if c.services.get_characteristic(UUID_BUNDLE) is not None:
+        def on_bundle(_, data):
+            for line in decode_bundle(sm_type, data):
+                print(line)
+
+        await c.start_notify(UUID_BUNDLE, on_bundle)
+        await asyncio.sleep(duration)
+        return
+
     def on_state(_, data):
         state = data[0]
         name = SM_STATES.get(sm_type, ())
         print("state:", name[state] if state < len(name) else state)
 
-    def on_comp(_, data):
-        ts, alt, vel, yaw, pitch, roll, az = struct.unpack(
-            "<Iffffff", data[:28])
-        print(f"t={ts}  alt={alt:+.1f}  v={vel:+.1f}  "
-              f"ypr={yaw:+.1f}/{pitch:+.1f}/{roll:+.1f}")
-
     await c.start_notify(UUID_STATE, on_state)
-    await c.start_notify(UUID_COMP,  on_comp)
+    await c.start_notify(UUID_COMP,  lambda _, d: print(decode_comp(d)))
 
     if cap & CAP_BARO:
         await c.start_notify(UUID_BARO,
@@ -144,6 +212,8 @@ async def run_poll(c, sm_type, cap, interval, duration):
             print(decode_imu6(await c.read_gatt_char(UUID_IMU6)))
         if cap & CAP_TEMP_INNER:
             print(decode_inner_temp(await c.read_gatt_char(UUID_INNER_TEMP)))
+        if cap & CAP_PYRO:
+            print(decode_pyro(await c.read_gatt_char(UUID_PYRO)))
 
         await asyncio.sleep(interval)
 
@@ -35,6 +35,8 @@ import numpy as np
 import matplotlib as mpl
 import matplotlib.pyplot as plt
 
+from aurora_lz4 import open_text
+
 
 # ---------------------------------------------------------------------------
 # ISA barometric atmosphere (troposphere, h < 11 km)
@@ -96,7 +98,7 @@ def parse_influx(path):
     by :data:`FIELD_SPECS`.
     """
     rows = {k: ([], []) for k in FIELD_SPECS}
-    with open(path) as f:
+    with open_text(path) as f:
         for line in f:
             line = line.strip()
             if not line:
@@ -373,7 +375,7 @@ def trim_flight_log(influx_path, windows_ns, out_dir):
     out_influx = os.path.join(out_dir, "flights_trimmed.influx")
 
     kept = total = 0
-    with open(influx_path) as fin, open(out_influx, "w") as fout:
+    with open_text(influx_path) as fin, open(out_influx, "w") as fout:
         for line in fin:
             total += 1
             stripped = line.strip()
@@ -879,6 +881,9 @@ def plot_raw_flight(sliced, transitions, theme_name, out_path, title=None,
 def run_real_flight(args):
     flight_dir = args.flight
     influx_path = os.path.join(flight_dir, "flights.influx")
+    if not os.path.isfile(influx_path) and \
+            os.path.isfile(influx_path + ".lz4"):
+        influx_path += ".lz4"
     audit_path = os.path.join(flight_dir, "state_audit")
 
     for p in (influx_path, audit_path):
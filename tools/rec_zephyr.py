@@ -61,6 +61,9 @@ uart = UART(1, baudrate=BAUD, tx=Pin(4), rx=Pin(5),
 MAGIC0 = 0xA5
 MAGIC1 = 0x5A
 HC12_TYPE_SM_UPDATE = 0x01
+HC12_TYPE_SM_KEY = 0x02
+HC12_TYPE_SM_DELTA = 0x03
+HC12_TYPE_SAMPLES = 0x04
 
 # State-name tables keyed by the sm_type byte from the protocol.
 # Must match enum sm_type in aurora/include/aurora/lib/state/state.h and the
@@ -68,12 +71,15 @@ HC12_TYPE_SM_UPDATE = 0x01
 # renumber an existing entry, the receiver may be running with a
 # firmware that still emits the old ID.
 SM_TYPE_SIMPLE = 0
-# SM_TYPE_TWO_STAGE = 1
+SM_TYPE_TABLE = 1
+# SM_TYPE_TWO_STAGE = 2
+SIMPLE_STATES = ("IDLE", "ARMED", "BOOST", "BURNOUT",
+                 "APOGEE", "MAIN", "REDUNDANT", "LANDED", "ERROR")
 SM_STATE_TABLES = {
-    SM_TYPE_SIMPLE: ("IDLE", "ARMED", "BOOST", "BURNOUT",
-                     "APOGEE", "MAIN", "REDUNDANT", "LANDED", "ERROR"),
+    SM_TYPE_SIMPLE: SIMPLE_STATES,
+    SM_TYPE_TABLE: SIMPLE_STATES,
 }
-SM_TYPE_NAMES = {SM_TYPE_SIMPLE: "simple"}
+SM_TYPE_NAMES = {SM_TYPE_SIMPLE: "simple", SM_TYPE_TABLE: "table"}
 
 # Wire format: uint32 ts, uint8 state, uint8 armed, uint8 sm_type,
 # uint8 reserved, 7x double. Same 64-byte total as the previous
@@ -82,6 +88,28 @@ SM_TYPE_NAMES = {SM_TYPE_SIMPLE: "simple"}
 SM_UPDATE_FMT = "<IBBBB7d"
 SM_UPDATE_LEN = struct.calcsize(SM_UPDATE_FMT)  # 64
 
+# Compact frames (CONFIG_AURORA_TELEMETRY_HC12_COMPACT), see
+# struct hc12_sm_key_payload / hc12_sm_delta_payload in hc12_internal.h.
+# Key: uint32 ts, uint8 state, armed, sm_type, seq, int32 altitude (cm),
+# then int16 accel, accel_vert (0.01 m/s^2), velocity (0.1 m/s) and
+# orientation[3] (0.01 deg).
+SM_KEY_FMT = "<IBBBBi6h"
+SM_KEY_LEN = struct.calcsize(SM_KEY_FMT)  # 24
+# Delta: uint8 seq, uint8 state (bit 7 = armed), uint16 dt_ms,
+# int16 d_altitude (cm), then the same six int16 fields as the key.
+SM_DELTA_FMT = "<BBHh6h"
+SM_DELTA_LEN = struct.calcsize(SM_DELTA_FMT)  # 18
+
+# Samples (CONFIG_AURORA_TELEMETRY_HC12_SAMPLES): uint32 base ts, then
+# records of uint8 type | (channel count << 6), uint16 dt_ms and
+# count x float32. Types follow enum aurora_data in data_logger.h.
+SAMPLE_TYPE_NAMES = ("baro", "accel", "gyro", "mag", "kinematics",
+                     "pose", "orientation", "vbat")
+
+# Delta base: [ts, altitude_cm, sm_type, next seq] of the last good
+# compact frame, or None until a key frame arrives (and after a gap).
+compact_base = None
+
 # Precomputed CRC-16/CCITT (reflected, poly 0x8408) table.
 def _build_crc_table():
     tbl = []
@@ -113,21 +141,79 @@ read_ix = 0   # next byte to parse
 out_lines = []
 
 
+def queue_sm(ts, state, armed, sm_type, altitude, accel, accel_vert,
+             velocity, yaw, pitch, roll):
+    states = SM_STATE_TABLES.get(sm_type)
+    name = (states[state] if states and state < len(states)
+            else "?%d" % state)
+    tname = SM_TYPE_NAMES.get(sm_type, "?%d" % sm_type)
+    out_lines.append(
+        "[OK ] SM[%s] t=%d ms  state=%-9s armed=%d  alt=%+.2f  "
+        "a=%+.2f  av=%+.2f  v=%+.2f  ypr=%+.2f/%+.2f/%+.2f"
+        % (tname, ts, name, armed, altitude, accel, accel_vert,
+           velocity, yaw, pitch, roll))
+
+
+def queue_compact(ftype, mv):
+    global compact_base
+    if ftype == HC12_TYPE_SM_KEY:
+        (ts, state, armed, sm_type, seq, alt_cm,
+         accel, accel_vert, velocity,
+         yaw, pitch, roll) = struct.unpack_from(SM_KEY_FMT, mv, 0)
+    else:
+        (seq, state, dt, d_alt,
+         accel, accel_vert, velocity,
+         yaw, pitch, roll) = struct.unpack_from(SM_DELTA_FMT, mv, 0)
+        if compact_base is None or seq != compact_base[3]:
+            # Lost a frame: the delta base is stale until the next key.
+            compact_base = None
+            out_lines.append("[GAP] delta seq=%d, waiting for key" % seq)
+            return
+        ts = (compact_base[0] + dt) & 0xFFFFFFFF
+        alt_cm = compact_base[1] + d_alt
+        sm_type = compact_base[2]
+        armed = state >> 7
+        state &= 0x7F
+    compact_base = (ts, alt_cm, sm_type, (seq + 1) & 0xFF)
+    queue_sm(ts, state, armed, sm_type, alt_cm / 100, accel / 100,
+             accel_vert / 100, velocity / 10, yaw / 100, pitch / 100,
+             roll / 100)
+
+
+def queue_samples(mv, plen):
+    base = struct.unpack_from("<I", mv, 0)[0]
+    off = 4
+    while off + 3 <= plen:
+        hdr = mv[off]
+        dt = mv[off + 1] | (mv[off + 2] << 8)
+        count = hdr >> 6
+        off += 3
+        if off + 4 * count > plen:
+            out_lines.append("[BAD] samples record truncated")
+            return
+        vals = struct.unpack_from("<%df" % count, mv, off)
+        off += 4 * count
+        stype = hdr & 0x3F
+        name = (SAMPLE_TYPE_NAMES[stype] if stype < len(SAMPLE_TYPE_NAMES)
+                else "?%d" % stype)
+        out_lines.append("[OK ] %s t=%d ms  %s"
+                         % (name, (base + dt) & 0xFFFFFFFF,
+                            "  ".join("%+.3f" % v for v in vals)))
+
+
 def queue_frame(ftype, mv, plen, crc_ok):
     tag = "OK " if crc_ok else "BAD"
     if ftype == HC12_TYPE_SM_UPDATE and plen == SM_UPDATE_LEN and crc_ok:
         (ts, state, armed, sm_type, _resv,
          altitude, accel, accel_vert, velocity,
          yaw, pitch, roll) = struct.unpack_from(SM_UPDATE_FMT, mv, 0)
-        states = SM_STATE_TABLES.get(sm_type)
-        name = (states[state] if states and state < len(states)
-                else "?%d" % state)
-        tname = SM_TYPE_NAMES.get(sm_type, "?%d" % sm_type)
-        out_lines.append(
-            "[OK ] SM[%s] t=%d ms  state=%-9s armed=%d  alt=%+.2f  "
-            "a=%+.2f  av=%+.2f  v=%+.2f  ypr=%+.2f/%+.2f/%+.2f"
-            % (tname, ts, name, armed, altitude, accel, accel_vert,
-               velocity, yaw, pitch, roll))
+        queue_sm(ts, state, armed, sm_type, altitude, accel, accel_vert,
+                 velocity, yaw, pitch, roll)
+    elif crc_ok and ((ftype == HC12_TYPE_SM_KEY and plen == SM_KEY_LEN) or
+                     (ftype == HC12_TYPE_SM_DELTA and plen == SM_DELTA_LEN)):
+        queue_compact(ftype, mv)
+    elif crc_ok and ftype == HC12_TYPE_SAMPLES and plen >= 4:
+        queue_samples(mv, plen)
     else:
         out_lines.append("[%s] type=0x%02x len=%d" % (tag, ftype, plen))
 
@@ -9,8 +9,13 @@ Simulated rocket flight through the AURORA Kalman filter.
 This script is a 1:1 Python mirror of the firmware's flight pipeline:
 
   * ``aurora/lib/filter/kalman.c``      → :class:`Filter` and the
-    ``filter_init`` / ``filter_predict`` / ``filter_update`` /
-    ``filter_detect_apogee`` free functions below.
+    ``filter_init`` / ``filter_predict`` / ``filter_update`` free
+    functions below.
+  * ``aurora/lib/filter/kalman3.c``     → :class:`Filter3` and
+    ``filter3_init`` / ``filter3_predict`` / ``filter3_update``
+    (``CONFIG_FILTER_KALMAN3``, selected with ``--backend kalman3``).
+  * ``aurora/lib/filter/filter.c``      → ``filter_detect_apogee``,
+    shared by both backends.
   * ``aurora/lib/sensor/attitude.c``    → :class:`Attitude` and
     ``attitude_init`` / ``attitude_calibrate_sample`` /
     ``attitude_calibrate_finish`` / ``attitude_update`` /
@@ -46,13 +51,14 @@ CONFIG_FILTER_Q_VEL_MILLISCALE = 500      # 0.5
 CONFIG_FILTER_R_MILLISCALE = 25000        # 25.0 — boosted from the firmware
                                           # default to track the noisier
                                           # synthetic baro signal.
+CONFIG_FILTER_Q_BIAS_MILLISCALE = 10      # 0.01
 CONFIG_FILTER_APOGEE_DEBOUNCE_SAMPLES = 3
 
 # CONFIG_IMU_UP_AXIS_POS_Z: airframe +Z is the up axis.
 CONFIG_IMU_UP_AXIS_INDEX = 2
 CONFIG_IMU_UP_AXIS_SIGN = 1
 
-# Mirrors of the #define constants in kalman.c.
+# Mirrors of the #define constants in filter_internal.h.
 FILTER_NIS_GATE = 25.0
 FILTER_NIS_WARMUP = 30
 FILTER_APOGEE_ACCEL_BAND = 20.0
@@ -202,8 +208,135 @@ def filter_update(f, z):
     return 0
 
 
+# ---------------------------------------------------------------------------
+# Filter3 — mirrors the 3-state backend in kalman3.c
+# ---------------------------------------------------------------------------
+
+class Filter3(Filter):
+    """``struct filter`` as laid out with ``CONFIG_FILTER_KALMAN3``:
+    ``state[2]`` is the vertical accel bias (m/s²)."""
+
+    __slots__ = ()
+
+    def __init__(self):
+        super().__init__()
+        self.state = [0.0] * 3
+        self.covariance = [[0.0] * 3 for _ in range(3)]
+        self.noise_p = [[0.0] * 3 for _ in range(3)]
+
+
+def _kalman3_propagate(f, T):
+    """Mirror of ``kalman3_propagate`` in kalman3.c: P = F P F^T."""
+    d = T
+    e = -0.5 * T * T
+    g = -T
+    P = f.covariance
+
+    A0 = [P[0][j] + d * P[1][j] + e * P[2][j] for j in range(3)]
+    A1 = [P[1][j] + g * P[2][j] for j in range(3)]
+    A2 = [P[2][j] for j in range(3)]
+
+    for i, A in enumerate((A0, A1, A2)):
+        P[i][0] = A[0] + d * A[1] + e * A[2]
+        P[i][1] = A[1] + g * A[2]
+        P[i][2] = A[2]
+
+
+def filter3_init(f):
+    """Mirror of ``filter_init`` in kalman3.c."""
+    if f is None:
+        return -errno.EINVAL
+
+    f.state = [0.0] * 3
+    f.covariance = [[0.0] * 3 for _ in range(3)]
+    f.noise_p = [[0.0] * 3 for _ in range(3)]
+
+    f.covariance[0][0] = 10.0
+    f.covariance[1][1] = 10.0
+    f.covariance[2][2] = 0.1
+
+    f.noise_p[0][0] = CONFIG_FILTER_Q_ALT_MILLISCALE / FILTER_SCALE_DIVISOR
+    f.noise_p[1][1] = CONFIG_FILTER_Q_VEL_MILLISCALE / FILTER_SCALE_DIVISOR
+    f.noise_p[2][2] = CONFIG_FILTER_Q_BIAS_MILLISCALE / FILTER_SCALE_DIVISOR
+
+    f.noise_m = CONFIG_FILTER_R_MILLISCALE / FILTER_SCALE_DIVISOR
+
+    f.peak_altitude = 0.0
+    f.last_accel_vert = 0.0
+    f.consecutive_apogee = 0
+    f.apogee_latched = 0
+    f.updates_since_init = 0
+
+    return 0
+
+
+def filter3_predict(f, dt_ns, a_vert):
+    """Mirror of ``filter_predict`` in kalman3.c."""
+    if f is None or dt_ns <= 0:
+        return -errno.EINVAL
+
+    dt_s = dt_ns / 1e9
+    if dt_s > 1.0:
+        return -errno.EINVAL
+
+    u = a_vert - f.state[2]
+
+    f.state[0] += f.state[1] * dt_s + 0.5 * u * dt_s * dt_s
+    f.state[1] += u * dt_s
+    f.last_accel_vert = a_vert
+
+    _kalman3_propagate(f, dt_s)
+
+    f.covariance[0][0] += f.noise_p[0][0] * dt_s
+    f.covariance[1][1] += f.noise_p[1][1] * dt_s
+    f.covariance[2][2] += f.noise_p[2][2] * dt_s
+
+    return 0
+
+
+def filter3_update(f, z):
+    """Mirror of ``filter_update`` in kalman3.c (same return codes as
+    :func:`filter_update`)."""
+    if f is None:
+        return -errno.EINVAL
+
+    y = z - f.state[0]
+    S = f.covariance[0][0] + f.noise_m
+
+    if abs(S) < 1e-12:
+        return -errno.EDOM
+
+    f.updates_since_init += 1
+
+    if (f.updates_since_init > FILTER_NIS_WARMUP
+            and f.covariance[0][0] <= f.noise_m
+            and y * y > FILTER_NIS_GATE * S):
+        return 1
+
+    P = f.covariance
+    K = [P[0][0] / S, P[1][0] / S, P[2][0] / S]
+
+    for i in range(3):
+        f.state[i] += K[i] * y
+
+    row0 = list(P[0])
+    for i in range(3):
+        for j in range(3):
+            P[i][j] -= K[i] * row0[j]
+
+    return 0
+
+
+# Backend name -> (struct, init, predict, update), as selected by the
+# FILTER_TYPE Kconfig choice.
+BACKENDS = {
+    "kalman": (Filter, filter_init, filter_predict, filter_update),
+    "kalman3": (Filter3, filter3_init, filter3_predict, filter3_update),
+}
+
+
 def filter_detect_apogee(f):
-    """Mirror of ``filter_detect_apogee`` in kalman.c."""
+    """Mirror of ``filter_detect_apogee`` in filter.c."""
     if f is None:
         return -errno.EINVAL
 
@@ -511,8 +644,14 @@ def run_simulation(args):
     p_ref = noisy_press[0]
     baro_alt = pfd.pressure_to_altitude(noisy_press, p_ref)
 
-    f = Filter()
-    filter_init(f)
+    # A constant offset on the airframe up axis, after calibration, so
+    # the attitude tracker cannot remove it.
+    accel_body[int(pre_launch_s / dt):, CONFIG_IMU_UP_AXIS_INDEX] += (
+        CONFIG_IMU_UP_AXIS_SIGN * args.accel_bias)
+
+    filter_cls, init, predict, update = BACKENDS[args.backend]
+    f = filter_cls()
+    init(f)
     att = Attitude()
     attitude_init(att)
 
@@ -542,8 +681,8 @@ def run_simulation(args):
         accel_vert_hist[i] = a_vert
         g_b_hist[i] = att.g_b
 
-        filter_predict(f, dt_ns, a_vert)
-        rc = filter_update(f, baro_alt[i])
+        predict(f, dt_ns, a_vert)
+        rc = update(f, baro_alt[i])
         gated_hist[i] = (rc == 1)
         if rc == 1:
             gated_count += 1
@@ -573,6 +712,8 @@ def run_simulation(args):
         print("Filter apogee:       not detected")
     print(f"Attitude g_mag:      {att.g_mag:.3f} m/s²")
     print(f"Gated baro updates:  {gated_count}")
+    if args.backend == "kalman3":
+        print(f"Accel bias estimate: {f.state[2]:.3f} m/s²")
 
     themes = ["light", "dark"] if args.theme == "both" else [args.theme]
     for theme in themes:
@@ -604,6 +745,13 @@ def main():
     parser.add_argument(
         "--title", type=str, default=None,
         help="Override the plot title")
+    parser.add_argument(
+        "--backend", choices=sorted(BACKENDS), default="kalman",
+        help="Filter backend to mirror (default: kalman)")
+    parser.add_argument(
+        "--accel-bias", type=float, default=0.0,
+        help="Constant accelerometer offset in m/s² injected after "
+             "calibration (default: 0)")
     args = parser.parse_args()
 
     run_simulation(args)
@@ -2,62 +2,141 @@
 # Copyright (c) 2026 Auxspace e.V.
 # SPDX-License-Identifier: Apache-2.0
 
-"""Refined grid search around the fast region found in coarse sweep."""
+"""Grid search of the filter tuning against recorded flights.
 
+Every (q_vel, r_meas, debounce) combination runs every flight through the
+firmware filter built for the host (tools/aurora_sim, via aurora_sim.py),
+the whole grid in one batch across all cores.
+"""
+
+import argparse
 import itertools
+import math
 import os
-import numpy as np
 import pathlib
 
+import aurora_sim
 from plot_flight_data import (parse_influx, parse_state_audit,
-                              segment_flights)
-from sim_flight_kalman import process_real_flight
+                              pressure_to_altitude, segment_flights)
 
 AURORA_DIR = pathlib.Path(os.path.dirname(os.path.abspath(__file__))).parent
 FLIGHT_DIR = AURORA_DIR / "flight_logs/2026-04-18"
 
-streams = parse_influx(FLIGHT_DIR / "flights.influx")
-events = parse_state_audit(FLIGHT_DIR / "state_audit")
-flights = segment_flights(events)
-
-grid = list(itertools.product(
+GRID = list(itertools.product(
     [1.5, 2.0, 3.0, 4.0, 6.0],    # q_vel
     [2.0, 4.0, 6.0, 8.0, 12.0],   # r_meas
     [1, 2],                       # debounce
 ))
 
-print(f"Sweeping {len(grid)} configs")
-results = []
-for q_vel, r_meas, debounce in grid:
-    deltas = []
-    valid = True
-    for boost_ms, end_ms in flights:
-        res = process_real_flight(streams, events, boost_ms, end_ms,
-                                  dt_s=0.02, pre_boost_s=10.0, cal_s=3.0,
-                                  post_main_s=5.0,
-                                  q_alt=0.1, q_vel=q_vel, r_meas=r_meas,
-                                  apogee_debounce=debounce)
-        apogee_idx = res["apogee_idx"]
-        actual_idx = res["computed_apogee_idx"]
-        if apogee_idx is None:
-            valid = False
-            deltas.append(float("nan"))
-            continue
-        t = res["t"]
-        if t[apogee_idx] < t[actual_idx] - 0.05:
-            valid = False
-        deltas.append(t[apogee_idx] - t[actual_idx])
-
-    f1, f2 = deltas
-    worst = (max(d for d in deltas if not np.isnan(d)) if valid
-             else float("inf"))
-    results.append((q_vel, r_meas, debounce, f1, f2, worst, valid))
-
-valid_results = [r for r in results if r[6]]
-valid_results.sort(key=lambda r: r[5])
-print(f"\nTop 15 configs (lowest worst-case lag, no early fires):")
-print(f"{'q_vel':>6} {'r':>5} {'kσ':>5} {'db':>3} "
-      f"{'f1_Δ':>7} {'f2_Δ':>7} {'worst':>7}")
-for q_vel, r_meas, debounce, f1, f2, worst, _ in valid_results[:15]:
-    print(f"{q_vel:>6.1f} {r_meas:>5.1f} {debounce:>3d} "
-          f"{f1:>+7.2f} {f2:>+7.2f} {worst:>+7.2f}")
+PRE_BOOST_S = 10.0
+CAL_S = 3.0
+POST_END_S = 5.0
+DEFAULT_DURATION_S = 120.0
+MAX_EARLY_S = 0.05
+
+
+def build_flight(streams, boost_ns, end_ns):
+    """Resample one logged flight onto its accel timestamps.
+
+    Gyro is the latest sample at or before each step; the baro altitude
+    is held between samples like the firmware's fusion thread does.
+    Returns the :class:`aurora_sim.Flight`, the step time stamps (s) and
+    the step of the highest baro altitude, taken as the true apogee.
+    """
+    start = boost_ns - int(PRE_BOOST_S * 1e9)
+    stop = ((end_ns if end_ns is not None
+             else boost_ns + int(DEFAULT_DURATION_S * 1e9)) +
+            int(POST_END_S * 1e9))
+
+    def window(name):
+        t_ns, vals = streams[name]
+        return [(int(t), v) for t, v in zip(t_ns, vals) if start <= t <= stop]
+
+    accel, gyro, baro = window("accel"), window("gyro"), window("baro")
+    if not accel or not gyro or not baro:
+        raise ValueError("flight window lacks accel, gyro or baro samples")
+
+    p_ref = baro[0][1][0] * 1000.0
+    dt_ns, acc, gyr, alt, t_s = [], [], [], [], []
+    gi = bi = 0
+    held = 0.0
+    last = None
+    for t, a in accel:
+        while gi + 1 < len(gyro) and gyro[gi + 1][0] <= t:
+            gi += 1
+        while bi < len(baro) and baro[bi][0] <= t:
+            held = pressure_to_altitude(baro[bi][1][0] * 1000.0, p_ref)
+            bi += 1
+        dt_ns.append(0 if last is None else t - last)
+        last = t
+        acc.append(tuple(a))
+        gyr.append(tuple(gyro[gi][1]))
+        alt.append(held)
+        t_s.append((t - start) / 1e9)
+
+    cal_steps = max(1, sum(1 for t in t_s if t < CAL_S))
+    detect_from = next((i for i, t in enumerate(t_s) if t >= PRE_BOOST_S),
+                       len(t_s))
+    peak = max(range(len(alt)), key=alt.__getitem__)
+    return (aurora_sim.Flight(dt_ns, acc, gyr, alt, cal_steps, detect_from),
+            t_s, peak)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--flight", type=pathlib.Path, default=FLIGHT_DIR,
+                    help="directory with flights.influx and state_audit")
+    ap.add_argument("--backend", choices=aurora_sim.BACKENDS,
+                    default="kalman", help="filter backend (default kalman)")
+    ap.add_argument("--lib", help="aurora_sim library to load "
+                    "(default: tools/aurora_sim/build)")
+    ap.add_argument("--threads", type=int, default=0,
+                    help="worker threads; 0 uses every core (default)")
+    args = ap.parse_args()
+
+    sim = aurora_sim.load(args.backend, args.lib)
+    streams = parse_influx(args.flight / "flights.influx")
+    events = parse_state_audit(args.flight / "state_audit")
+    runs = [build_flight(streams, boost_ns, end_ns)
+            for boost_ns, end_ns in segment_flights(events)]
+    if not runs:
+        raise SystemExit(f"{args.flight}: no flights in state_audit")
+
+    params = [sim.default_params(q_alt_milliscale=100,
+                                 q_vel_milliscale=round(q_vel * 1000),
+                                 r_milliscale=round(r_meas * 1000),
+                                 apogee_debounce_samples=debounce)
+              for q_vel, r_meas, debounce in GRID]
+
+    print(f"Sweeping {len(GRID)} configs x {len(runs)} flights "
+          f"({sim.backend})")
+    batch = sim.run_batch([f for f, _, _ in runs], params, args.threads)
+
+    results = []
+    for (q_vel, r_meas, debounce), per_flight in zip(GRID, batch):
+        deltas = []
+        valid = True
+        for (_, t, peak), res in zip(runs, per_flight):
+            if res.apogee_step < 0:
+                valid = False
+                deltas.append(math.nan)
+                continue
+            delta = t[res.apogee_step] - t[peak]
+            if delta < -MAX_EARLY_S:
+                valid = False
+            deltas.append(delta)
+        worst = max(deltas) if valid else math.inf
+        results.append((q_vel, r_meas, debounce, deltas, worst, valid))
+
+    valid_results = sorted((r for r in results if r[5]), key=lambda r: r[4])
+    print(f"\nTop 15 configs (lowest worst-case lag, no early fires):")
+    head = " ".join(f"{f'f{i + 1}_Δ':>7}" for i in range(len(runs)))
+    print(f"{'q_vel':>6} {'r':>5} {'db':>3} {head} {'worst':>7}")
+    for q_vel, r_meas, debounce, deltas, worst, _ in valid_results[:15]:
+        cols = " ".join(f"{d:>+7.2f}" for d in deltas)
+        print(f"{q_vel:>6.1f} {r_meas:>5.1f} {debounce:>3d} {cols} "
+              f"{worst:>+7.2f}")
+
+
+if __name__ == "__main__":
+    main()